@@ -9,7 +9,7 @@ namespace detail
 	template<template<length_t L, typename T, qualifier Q> class vec, typename R, typename T, qualifier Q>
 	struct functor1<vec, 1, R, T, Q>
 	{
-		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static vec<1, R, Q> call(R (*Func) (T x), vec<1, T, Q> const& v)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR_GENERIC static vec<1, R, Q> call(R (*Func) (T x), vec<1, T, Q> const& v)
 		{
 			return vec<1, R, Q>(Func(v.x));
 		}
@@ -18,7 +18,7 @@ namespace detail
 	template<template<length_t L, typename T, qualifier Q> class vec, typename R, typename T, qualifier Q>
 	struct functor1<vec, 2, R, T, Q>
 	{
-		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static vec<2, R, Q> call(R (*Func) (T x), vec<2, T, Q> const& v)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR_GENERIC static vec<2, R, Q> call(R (*Func) (T x), vec<2, T, Q> const& v)
 		{
 			return vec<2, R, Q>(Func(v.x), Func(v.y));
 		}
@@ -27,7 +27,7 @@ namespace detail
 	template<template<length_t L, typename T, qualifier Q> class vec, typename R, typename T, qualifier Q>
 	struct functor1<vec, 3, R, T, Q>
 	{
-		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static vec<3, R, Q> call(R (*Func) (T x), vec<3, T, Q> const& v)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR_GENERIC static vec<3, R, Q> call(R (*Func) (T x), vec<3, T, Q> const& v)
 		{
 			return vec<3, R, Q>(Func(v.x), Func(v.y), Func(v.z));
 		}
@@ -36,7 +36,7 @@ namespace detail
 	template<template<length_t L, typename T, qualifier Q> class vec, typename R, typename T, qualifier Q>
 	struct functor1<vec, 4, R, T, Q>
 	{
-		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static vec<4, R, Q> call(R (*Func) (T x), vec<4, T, Q> const& v)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR_GENERIC static vec<4, R, Q> call(R (*Func) (T x), vec<4, T, Q> const& v)
 		{
 			return vec<4, R, Q>(Func(v.x), Func(v.y), Func(v.z), Func(v.w));
 		}
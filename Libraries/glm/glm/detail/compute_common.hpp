@@ -2,6 +2,7 @@
 
 #include "setup.hpp"
 #include <limits>
+#include <cmath>
 
 namespace glm{
 namespace detail
@@ -13,7 +14,7 @@ namespace detail
 	template<typename genFIType>
 	struct compute_abs<genFIType, true>
 	{
-		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static genFIType call(genFIType x)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR_GENERIC static genFIType call(genFIType x)
 		{
 			GLM_STATIC_ASSERT(
 				std::numeric_limits<genFIType>::is_iec559 || std::numeric_limits<genFIType>::is_signed,
@@ -28,7 +29,7 @@ namespace detail
 	template<>
 	struct compute_abs<float, true>
 	{
-		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static float call(float x)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR_GENERIC static float call(float x)
 		{
 			return fabsf(x);
 		}
@@ -38,7 +39,7 @@ namespace detail
 	template<typename genFIType>
 	struct compute_abs<genFIType, false>
 	{
-		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static genFIType call(genFIType x)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR_GENERIC static genFIType call(genFIType x)
 		{
 			GLM_STATIC_ASSERT(
 				(!std::numeric_limits<genFIType>::is_signed && std::numeric_limits<genFIType>::is_integer),
@@ -46,5 +47,62 @@ namespace detail
 			return x;
 		}
 	};
+
+	// sqrt and tan of the GLM_FORCE_CONSTEXPR functions. The standard library at runtime, series evaluated by the
+	// compiler in constant expressions.
+	template<typename genType>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_MATH genType constexpr_sqrt(genType x)
+	{
+#		if GLM_CONFIG_CONSTEXPR_MATH == GLM_ENABLE
+			if(GLM_IS_CONSTANT_EVALUATED())
+			{
+				if(x < genType(0) || x != x)
+					return std::numeric_limits<genType>::quiet_NaN();
+				if(x == genType(0) || x == std::numeric_limits<genType>::infinity())
+					return x;
+
+				// Newton's method from above the root decreases until it reaches it
+				genType Root = x > genType(1) ? x : genType(1);
+				for(;;)
+				{
+					genType const Next = (Root + x / Root) / genType(2);
+					if(!(Next < Root))
+						return Root;
+					Root = Next;
+				}
+			}
+#		endif
+		return std::sqrt(x);
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_MATH genType constexpr_tan(genType x)
+	{
+#		if GLM_CONFIG_CONSTEXPR_MATH == GLM_ENABLE
+			if(GLM_IS_CONSTANT_EVALUATED())
+			{
+				// tan has a period of pi, reduce to [-pi/2, pi/2] then sin / cos with their Taylor series
+				double const Pi = 3.14159265358979323846264338327950288;
+				double a = static_cast<double>(x);
+				a -= Pi * static_cast<double>(static_cast<long long>(a / Pi));
+				if(a > Pi / 2.0)
+					a -= Pi;
+				else if(a < -Pi / 2.0)
+					a += Pi;
+
+				double Sin = a, Cos = 1.0;
+				double SinTerm = a, CosTerm = 1.0;
+				for(int n = 1; n < 16; ++n)
+				{
+					SinTerm *= -a * a / static_cast<double>((2 * n) * (2 * n + 1));
+					CosTerm *= -a * a / static_cast<double>((2 * n - 1) * (2 * n));
+					Sin += SinTerm;
+					Cos += CosTerm;
+				}
+				return static_cast<genType>(Sin / Cos);
+			}
+#		endif
+		return std::tan(x);
+	}
 }//namespace detail
 }//namespace glm
@@ -3,6 +3,7 @@
 
 #include "../vector_relational.hpp"
 #include "_vectorize.hpp"
+#include "compute_common.hpp"
 #include <limits>
 #include <cmath>
 #include <cassert>
@@ -133,9 +134,9 @@ namespace detail
 
 	// inversesqrt
 	template<typename genType>
-	GLM_FUNC_QUALIFIER genType inversesqrt(genType x)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_MATH genType inversesqrt(genType x)
 	{
-		return static_cast<genType>(1) / sqrt(x);
+		return static_cast<genType>(1) / detail::constexpr_sqrt(x);
 	}
 
 	template<length_t L, typename T, qualifier Q>
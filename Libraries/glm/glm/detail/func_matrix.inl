@@ -7,7 +7,7 @@ namespace detail
 	template<length_t C, length_t R, typename T, qualifier Q, bool Aligned>
 	struct compute_matrixCompMult
 	{
-		GLM_FUNC_QUALIFIER static mat<C, R, T, Q> call(mat<C, R, T, Q> const& x, mat<C, R, T, Q> const& y)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR_MATH static mat<C, R, T, Q> call(mat<C, R, T, Q> const& x, mat<C, R, T, Q> const& y)
 		{
 			mat<C, R, T, Q> Result;
 			for(length_t i = 0; i < Result.length(); ++i)
@@ -22,176 +22,108 @@ namespace detail
 	template<typename T, qualifier Q, bool Aligned>
 	struct compute_transpose<2, 2, T, Q, Aligned>
 	{
-		GLM_FUNC_QUALIFIER static mat<2, 2, T, Q> call(mat<2, 2, T, Q> const& m)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR_MATH static mat<2, 2, T, Q> call(mat<2, 2, T, Q> const& m)
 		{
-			mat<2, 2, T, Q> Result;
-			Result[0][0] = m[0][0];
-			Result[0][1] = m[1][0];
-			Result[1][0] = m[0][1];
-			Result[1][1] = m[1][1];
-			return Result;
+			return mat<2, 2, T, Q>(
+				m[0][0], m[1][0],
+				m[0][1], m[1][1]);
 		}
 	};
 
 	template<typename T, qualifier Q, bool Aligned>
 	struct compute_transpose<2, 3, T, Q, Aligned>
 	{
-		GLM_FUNC_QUALIFIER static mat<3, 2, T, Q> call(mat<2, 3, T, Q> const& m)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR_MATH static mat<3, 2, T, Q> call(mat<2, 3, T, Q> const& m)
 		{
-			mat<3,2, T, Q> Result;
-			Result[0][0] = m[0][0];
-			Result[0][1] = m[1][0];
-			Result[1][0] = m[0][1];
-			Result[1][1] = m[1][1];
-			Result[2][0] = m[0][2];
-			Result[2][1] = m[1][2];
-			return Result;
+			return mat<3, 2, T, Q>(
+				m[0][0], m[1][0],
+				m[0][1], m[1][1],
+				m[0][2], m[1][2]);
 		}
 	};
 
 	template<typename T, qualifier Q, bool Aligned>
 	struct compute_transpose<2, 4, T, Q, Aligned>
 	{
-		GLM_FUNC_QUALIFIER static mat<4, 2, T, Q> call(mat<2, 4, T, Q> const& m)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR_MATH static mat<4, 2, T, Q> call(mat<2, 4, T, Q> const& m)
 		{
-			mat<4, 2, T, Q> Result;
-			Result[0][0] = m[0][0];
-			Result[0][1] = m[1][0];
-			Result[1][0] = m[0][1];
-			Result[1][1] = m[1][1];
-			Result[2][0] = m[0][2];
-			Result[2][1] = m[1][2];
-			Result[3][0] = m[0][3];
-			Result[3][1] = m[1][3];
-			return Result;
+			return mat<4, 2, T, Q>(
+				m[0][0], m[1][0],
+				m[0][1], m[1][1],
+				m[0][2], m[1][2],
+				m[0][3], m[1][3]);
 		}
 	};
 
 	template<typename T, qualifier Q, bool Aligned>
 	struct compute_transpose<3, 2, T, Q, Aligned>
 	{
-		GLM_FUNC_QUALIFIER static mat<2, 3, T, Q> call(mat<3, 2, T, Q> const& m)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR_MATH static mat<2, 3, T, Q> call(mat<3, 2, T, Q> const& m)
 		{
-			mat<2, 3, T, Q> Result;
-			Result[0][0] = m[0][0];
-			Result[0][1] = m[1][0];
-			Result[0][2] = m[2][0];
-			Result[1][0] = m[0][1];
-			Result[1][1] = m[1][1];
-			Result[1][2] = m[2][1];
-			return Result;
+			return mat<2, 3, T, Q>(
+				m[0][0], m[1][0], m[2][0],
+				m[0][1], m[1][1], m[2][1]);
 		}
 	};
 
 	template<typename T, qualifier Q, bool Aligned>
 	struct compute_transpose<3, 3, T, Q, Aligned>
 	{
-		GLM_FUNC_QUALIFIER static mat<3, 3, T, Q> call(mat<3, 3, T, Q> const& m)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR_MATH static mat<3, 3, T, Q> call(mat<3, 3, T, Q> const& m)
 		{
-			mat<3, 3, T, Q> Result;
-			Result[0][0] = m[0][0];
-			Result[0][1] = m[1][0];
-			Result[0][2] = m[2][0];
-
-			Result[1][0] = m[0][1];
-			Result[1][1] = m[1][1];
-			Result[1][2] = m[2][1];
-
-			Result[2][0] = m[0][2];
-			Result[2][1] = m[1][2];
-			Result[2][2] = m[2][2];
-			return Result;
+			return mat<3, 3, T, Q>(
+				m[0][0], m[1][0], m[2][0],
+				m[0][1], m[1][1], m[2][1],
+				m[0][2], m[1][2], m[2][2]);
 		}
 	};
 
 	template<typename T, qualifier Q, bool Aligned>
 	struct compute_transpose<3, 4, T, Q, Aligned>
 	{
-		GLM_FUNC_QUALIFIER static mat<4, 3, T, Q> call(mat<3, 4, T, Q> const& m)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR_MATH static mat<4, 3, T, Q> call(mat<3, 4, T, Q> const& m)
 		{
-			mat<4, 3, T, Q> Result;
-			Result[0][0] = m[0][0];
-			Result[0][1] = m[1][0];
-			Result[0][2] = m[2][0];
-			Result[1][0] = m[0][1];
-			Result[1][1] = m[1][1];
-			Result[1][2] = m[2][1];
-			Result[2][0] = m[0][2];
-			Result[2][1] = m[1][2];
-			Result[2][2] = m[2][2];
-			Result[3][0] = m[0][3];
-			Result[3][1] = m[1][3];
-			Result[3][2] = m[2][3];
-			return Result;
+			return mat<4, 3, T, Q>(
+				m[0][0], m[1][0], m[2][0],
+				m[0][1], m[1][1], m[2][1],
+				m[0][2], m[1][2], m[2][2],
+				m[0][3], m[1][3], m[2][3]);
 		}
 	};
 
 	template<typename T, qualifier Q, bool Aligned>
 	struct compute_transpose<4, 2, T, Q, Aligned>
 	{
-		GLM_FUNC_QUALIFIER static mat<2, 4, T, Q> call(mat<4, 2, T, Q> const& m)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR_MATH static mat<2, 4, T, Q> call(mat<4, 2, T, Q> const& m)
 		{
-			mat<2, 4, T, Q> Result;
-			Result[0][0] = m[0][0];
-			Result[0][1] = m[1][0];
-			Result[0][2] = m[2][0];
-			Result[0][3] = m[3][0];
-			Result[1][0] = m[0][1];
-			Result[1][1] = m[1][1];
-			Result[1][2] = m[2][1];
-			Result[1][3] = m[3][1];
-			return Result;
+			return mat<2, 4, T, Q>(
+				m[0][0], m[1][0], m[2][0], m[3][0],
+				m[0][1], m[1][1], m[2][1], m[3][1]);
 		}
 	};
 
 	template<typename T, qualifier Q, bool Aligned>
 	struct compute_transpose<4, 3, T, Q, Aligned>
 	{
-		GLM_FUNC_QUALIFIER static mat<3, 4, T, Q> call(mat<4, 3, T, Q> const& m)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR_MATH static mat<3, 4, T, Q> call(mat<4, 3, T, Q> const& m)
 		{
-			mat<3, 4, T, Q> Result;
-			Result[0][0] = m[0][0];
-			Result[0][1] = m[1][0];
-			Result[0][2] = m[2][0];
-			Result[0][3] = m[3][0];
-			Result[1][0] = m[0][1];
-			Result[1][1] = m[1][1];
-			Result[1][2] = m[2][1];
-			Result[1][3] = m[3][1];
-			Result[2][0] = m[0][2];
-			Result[2][1] = m[1][2];
-			Result[2][2] = m[2][2];
-			Result[2][3] = m[3][2];
-			return Result;
+			return mat<3, 4, T, Q>(
+				m[0][0], m[1][0], m[2][0], m[3][0],
+				m[0][1], m[1][1], m[2][1], m[3][1],
+				m[0][2], m[1][2], m[2][2], m[3][2]);
 		}
 	};
 
 	template<typename T, qualifier Q, bool Aligned>
 	struct compute_transpose<4, 4, T, Q, Aligned>
 	{
-		GLM_FUNC_QUALIFIER static mat<4, 4, T, Q> call(mat<4, 4, T, Q> const& m)
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR_MATH static mat<4, 4, T, Q> call(mat<4, 4, T, Q> const& m)
 		{
-			mat<4, 4, T, Q> Result;
-			Result[0][0] = m[0][0];
-			Result[0][1] = m[1][0];
-			Result[0][2] = m[2][0];
-			Result[0][3] = m[3][0];
-
-			Result[1][0] = m[0][1];
-			Result[1][1] = m[1][1];
-			Result[1][2] = m[2][1];
-			Result[1][3] = m[3][1];
-
-			Result[2][0] = m[0][2];
-			Result[2][1] = m[1][2];
-			Result[2][2] = m[2][2];
-			Result[2][3] = m[3][2];
-
-			Result[3][0] = m[0][3];
-			Result[3][1] = m[1][3];
-			Result[3][2] = m[2][3];
-			Result[3][3] = m[3][3];
-			return Result;
+			return mat<4, 4, T, Q>(
+				m[0][0], m[1][0], m[2][0], m[3][0],
+				m[0][1], m[1][1], m[2][1], m[3][1],
+				m[0][2], m[1][2], m[2][2], m[3][2],
+				m[0][3], m[1][3], m[2][3], m[3][3]);
 		}
 	};
 
@@ -371,7 +303,7 @@ namespace detail
 	}
 
 	template<length_t C, length_t R, typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER typename mat<C, R, T, Q>::transpose_type transpose(mat<C, R, T, Q> const& m)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_MATH typename mat<C, R, T, Q>::transpose_type transpose(mat<C, R, T, Q> const& m)
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_GENTYPE, "'transpose' only accept floating-point inputs");
 		return detail::compute_transpose<C, R, T, Q, detail::is_aligned<Q>::value>::call(m);
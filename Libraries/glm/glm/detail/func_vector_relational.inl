@@ -1,7 +1,7 @@
 namespace glm
 {
 	template<length_t L, typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, bool, Q> lessThan(vec<L, T, Q> const& x, vec<L, T, Q> const& y)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_GENERIC vec<L, bool, Q> lessThan(vec<L, T, Q> const& x, vec<L, T, Q> const& y)
 	{
 		vec<L, bool, Q> Result(true);
 		for(length_t i = 0; i < L; ++i)
@@ -10,7 +10,7 @@ namespace glm
 	}
 
 	template<length_t L, typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, bool, Q> lessThanEqual(vec<L, T, Q> const& x, vec<L, T, Q> const& y)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_GENERIC vec<L, bool, Q> lessThanEqual(vec<L, T, Q> const& x, vec<L, T, Q> const& y)
 	{
 		vec<L, bool, Q> Result(true);
 		for(length_t i = 0; i < L; ++i)
@@ -19,7 +19,7 @@ namespace glm
 	}
 
 	template<length_t L, typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, bool, Q> greaterThan(vec<L, T, Q> const& x, vec<L, T, Q> const& y)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_GENERIC vec<L, bool, Q> greaterThan(vec<L, T, Q> const& x, vec<L, T, Q> const& y)
 	{
 		vec<L, bool, Q> Result(true);
 		for(length_t i = 0; i < L; ++i)
@@ -28,7 +28,7 @@ namespace glm
 	}
 
 	template<length_t L, typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, bool, Q> greaterThanEqual(vec<L, T, Q> const& x, vec<L, T, Q> const& y)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_GENERIC vec<L, bool, Q> greaterThanEqual(vec<L, T, Q> const& x, vec<L, T, Q> const& y)
 	{
 		vec<L, bool, Q> Result(true);
 		for(length_t i = 0; i < L; ++i)
@@ -37,7 +37,7 @@ namespace glm
 	}
 
 	template<length_t L, typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, bool, Q> equal(vec<L, T, Q> const& x, vec<L, T, Q> const& y)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_GENERIC vec<L, bool, Q> equal(vec<L, T, Q> const& x, vec<L, T, Q> const& y)
 	{
 		vec<L, bool, Q> Result(true);
 		for(length_t i = 0; i < L; ++i)
@@ -46,7 +46,7 @@ namespace glm
 	}
 
 	template<length_t L, typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, bool, Q> notEqual(vec<L, T, Q> const& x, vec<L, T, Q> const& y)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_GENERIC vec<L, bool, Q> notEqual(vec<L, T, Q> const& x, vec<L, T, Q> const& y)
 	{
 		vec<L, bool, Q> Result(true);
 		for(length_t i = 0; i < L; ++i)
@@ -55,7 +55,7 @@ namespace glm
 	}
 
 	template<length_t L, qualifier Q>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR bool any(vec<L, bool, Q> const& v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_GENERIC bool any(vec<L, bool, Q> const& v)
 	{
 		bool Result = false;
 		for(length_t i = 0; i < L; ++i)
@@ -64,7 +64,7 @@ namespace glm
 	}
 
 	template<length_t L, qualifier Q>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR bool all(vec<L, bool, Q> const& v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_GENERIC bool all(vec<L, bool, Q> const& v)
 	{
 		bool Result = true;
 		for(length_t i = 0; i < L; ++i)
@@ -73,7 +73,7 @@ namespace glm
 	}
 
 	template<length_t L, qualifier Q>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<L, bool, Q> not_(vec<L, bool, Q> const& v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_GENERIC vec<L, bool, Q> not_(vec<L, bool, Q> const& v)
 	{
 		vec<L, bool, Q> Result(true);
 		for(length_t i = 0; i < L; ++i)
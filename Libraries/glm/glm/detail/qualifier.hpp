@@ -145,6 +145,26 @@ namespace detail
 	};
 #	endif
 
+#	if GLM_ARCH & GLM_ARCH_NEON_BIT
+	template<>
+	struct storage<4, float, true>
+	{
+		typedef glm_f32vec4 type;
+	};
+
+	template<>
+	struct storage<4, int, true>
+	{
+		typedef glm_i32vec4 type;
+	};
+
+	template<>
+	struct storage<4, unsigned int, true>
+	{
+		typedef glm_u32vec4 type;
+	};
+#	endif
+
 #	if (GLM_ARCH & GLM_ARCH_AVX_BIT)
 	template<>
 	struct storage<4, double, true>
@@ -192,7 +212,7 @@ namespace detail
 	template<typename genType>
 	struct init_gentype<genType, GENTYPE_QUAT>
 	{
-		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static genType identity()
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR_GENERIC static genType identity()
 		{
 			return genType(1, 0, 0, 0);
 		}
@@ -201,7 +221,7 @@ namespace detail
 	template<typename genType>
 	struct init_gentype<genType, GENTYPE_MAT>
 	{
-		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static genType identity()
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR_GENERIC static genType identity()
 		{
 			return genType(1);
 		}
@@ -272,6 +272,34 @@
 		((GLM_COMPILER & GLM_COMPILER_CUDA) && (GLM_COMPILER >= GLM_COMPILER_CUDA70))))
 #endif
 
+// P0595 std::is_constant_evaluated http://www.open-std.org/jtc1/sc22/wg21/docs/papers/2018/p0595r2.html
+// The builtin behind it is available in C++17 mode too.
+#if defined(__has_builtin)
+#	if __has_builtin(__builtin_is_constant_evaluated)
+#		define GLM_HAS_IS_CONSTANT_EVALUATED 1
+#	endif
+#endif
+#ifndef GLM_HAS_IS_CONSTANT_EVALUATED
+#	if ((GLM_COMPILER & GLM_COMPILER_GCC) && __GNUC__ >= 9) || ((GLM_COMPILER & GLM_COMPILER_VC) && _MSC_VER >= 1925)
+#		define GLM_HAS_IS_CONSTANT_EVALUATED 1
+#	else
+#		define GLM_HAS_IS_CONSTANT_EVALUATED 0
+#	endif
+#endif
+
+#if GLM_HAS_IS_CONSTANT_EVALUATED
+#	define GLM_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else
+#	define GLM_IS_CONSTANT_EVALUATED() false
+#endif
+
+// GLM_FORCE_CONSTEXPR, see GLM_CONFIG_CONSTEXPR_MATH below. Default aligned gentypes are SIMD registers, never constexpr.
+#if defined(GLM_FORCE_CONSTEXPR) && (GLM_LANG & GLM_LANG_CXX17_FLAG) && GLM_HAS_IS_CONSTANT_EVALUATED && !defined(GLM_FORCE_DEFAULT_ALIGNED_GENTYPES) && !defined(GLM_FORCE_ALIGNED)
+#	define GLM_CONFIG_CONSTEXPR_MATH GLM_ENABLE
+#else
+#	define GLM_CONFIG_CONSTEXPR_MATH GLM_DISABLE
+#endif
+
 // N2235 Generalized Constant Expressions http://www.open-std.org/jtc1/sc22/wg21/docs/papers/2007/n2235.pdf
 // N3652 Extended Constant Expressions http://www.open-std.org/jtc1/sc22/wg21/docs/papers/2013/n3652.html
 #if (GLM_ARCH & GLM_ARCH_SIMD_BIT) // Compiler SIMD intrinsics don't support constexpr...
@@ -293,6 +321,24 @@
 #	define GLM_CONSTEXPR
 #endif
 
+// GLM_CONSTEXPR of everything but the SIMD specializations. GLM_HAS_CONSTEXPR is 0 on SIMD architectures because of
+// those, but with GLM_FORCE_CONSTEXPR the generic code is constexpr anyway: the constexpr math below is built on it.
+#if GLM_HAS_CONSTEXPR || GLM_CONFIG_CONSTEXPR_MATH == GLM_ENABLE
+#	define GLM_CONSTEXPR_GENERIC constexpr
+#else
+#	define GLM_CONSTEXPR_GENERIC
+#endif
+
+// Matrix arithmetic, transpose, the translate, scale, lookAt and perspective builders and quaternion products,
+// constexpr with GLM_FORCE_CONSTEXPR so constant transforms are computed by the compiler.
+// Requires C++17 and std::is_constant_evaluated: constant evaluation takes scalar code while runtime calls keep
+// the standard library functions. Aligned types keep their SIMD code and stay out of constant expressions.
+#if GLM_CONFIG_CONSTEXPR_MATH == GLM_ENABLE
+#	define GLM_CONSTEXPR_MATH constexpr
+#else
+#	define GLM_CONSTEXPR_MATH
+#endif
+
 //
 #if GLM_LANG & GLM_LANG_CXX11_FLAG
 #	define GLM_HAS_ASSIGNABLE 1
@@ -907,7 +953,12 @@ namespace detail
 #	endif
 
 	// Report build target
-#	if (GLM_ARCH & GLM_ARCH_AVX2_BIT) && (GLM_MODEL == GLM_MODEL_64)
+#	if (GLM_ARCH & GLM_ARCH_AVX512_BIT) && (GLM_MODEL == GLM_MODEL_64)
+#		pragma message("GLM: x86 64 bits with AVX-512 instruction set build target")
+#	elif (GLM_ARCH & GLM_ARCH_AVX512_BIT) && (GLM_MODEL == GLM_MODEL_32)
+#		pragma message("GLM: x86 32 bits with AVX-512 instruction set build target")
+
+#	elif (GLM_ARCH & GLM_ARCH_AVX2_BIT) && (GLM_MODEL == GLM_MODEL_64)
 #		pragma message("GLM: x86 64 bits with AVX2 instruction set build target")
 #	elif (GLM_ARCH & GLM_ARCH_AVX2_BIT) && (GLM_MODEL == GLM_MODEL_32)
 #		pragma message("GLM: x86 32 bits with AVX2 instruction set build target")
@@ -1007,6 +1058,13 @@ namespace detail
 #		pragma message("GLM: GLM_FORCE_SWIZZLE is defined, swizzling functions enabled. Enable compiler C++ language extensions to enable swizzle operators.")
 #	else
 #		pragma message("GLM: GLM_FORCE_SWIZZLE is undefined. swizzling functions or operators are disabled.")
+#	endif
+
+	// Report constexpr matrix and transform functions
+#	if GLM_CONFIG_CONSTEXPR_MATH == GLM_ENABLE
+#		pragma message("GLM: GLM_FORCE_CONSTEXPR is defined. Matrix, transform and quaternion functions are constexpr.")
+#	elif defined(GLM_FORCE_CONSTEXPR)
+#		pragma message("GLM: GLM_FORCE_CONSTEXPR is defined but ignored, it requires C++17, std::is_constant_evaluated and packed default gentypes.")
 #	endif
 
 	// Report .length() type
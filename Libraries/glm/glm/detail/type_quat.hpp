@@ -77,27 +77,27 @@ namespace glm
 
 		typedef length_t length_type;
 		/// Return the count of components of a quaternion
-		GLM_FUNC_DECL static GLM_CONSTEXPR length_type length(){return 4;}
+		GLM_FUNC_DECL static GLM_CONSTEXPR_GENERIC length_type length(){return 4;}
 
-		GLM_FUNC_DECL GLM_CONSTEXPR T & operator[](length_type i);
-		GLM_FUNC_DECL GLM_CONSTEXPR T const& operator[](length_type i) const;
+		GLM_FUNC_DECL GLM_CONSTEXPR_GENERIC T & operator[](length_type i);
+		GLM_FUNC_DECL GLM_CONSTEXPR_GENERIC T const& operator[](length_type i) const;
 
 		// -- Implicit basic constructors --
 
-		GLM_FUNC_DECL GLM_CONSTEXPR qua() GLM_DEFAULT;
-		GLM_FUNC_DECL GLM_CONSTEXPR qua(qua<T, Q> const& q) GLM_DEFAULT;
+		GLM_FUNC_DECL GLM_CONSTEXPR_GENERIC qua() GLM_DEFAULT;
+		GLM_FUNC_DECL GLM_CONSTEXPR_GENERIC qua(qua<T, Q> const& q) GLM_DEFAULT;
 		template<qualifier P>
-		GLM_FUNC_DECL GLM_CONSTEXPR qua(qua<T, P> const& q);
+		GLM_FUNC_DECL GLM_CONSTEXPR_GENERIC qua(qua<T, P> const& q);
 
 		// -- Explicit basic constructors --
 
-		GLM_FUNC_DECL GLM_CONSTEXPR qua(T s, vec<3, T, Q> const& v);
-		GLM_FUNC_DECL GLM_CONSTEXPR qua(T w, T x, T y, T z);
+		GLM_FUNC_DECL GLM_CONSTEXPR_GENERIC qua(T s, vec<3, T, Q> const& v);
+		GLM_FUNC_DECL GLM_CONSTEXPR_GENERIC qua(T w, T x, T y, T z);
 
 		// -- Conversion constructors --
 
 		template<typename U, qualifier P>
-		GLM_FUNC_DECL GLM_CONSTEXPR GLM_EXPLICIT qua(qua<U, P> const& q);
+		GLM_FUNC_DECL GLM_CONSTEXPR_GENERIC GLM_EXPLICIT qua(qua<U, P> const& q);
 
 		/// Explicit conversion operators
 #		if GLM_HAS_EXPLICIT_CONVERSION_OPERATORS
@@ -129,7 +129,7 @@ namespace glm
 		template<typename U>
 		GLM_FUNC_DECL qua<T, Q>& operator-=(qua<U, Q> const& q);
 		template<typename U>
-		GLM_FUNC_DECL qua<T, Q>& operator*=(qua<U, Q> const& q);
+		GLM_FUNC_DECL GLM_CONSTEXPR_MATH qua<T, Q>& operator*=(qua<U, Q> const& q);
 		template<typename U>
 		GLM_FUNC_DECL qua<T, Q>& operator*=(U s);
 		template<typename U>
@@ -153,10 +153,10 @@ namespace glm
 	GLM_FUNC_DECL qua<T, Q> operator-(qua<T, Q> const& q, qua<T, Q> const& p);
 
 	template<typename T, qualifier Q>
-	GLM_FUNC_DECL qua<T, Q> operator*(qua<T, Q> const& q, qua<T, Q> const& p);
+	GLM_FUNC_DECL GLM_CONSTEXPR_MATH qua<T, Q> operator*(qua<T, Q> const& q, qua<T, Q> const& p);
 
 	template<typename T, qualifier Q>
-	GLM_FUNC_DECL vec<3, T, Q> operator*(qua<T, Q> const& q, vec<3, T, Q> const& v);
+	GLM_FUNC_DECL GLM_CONSTEXPR_MATH vec<3, T, Q> operator*(qua<T, Q> const& q, vec<3, T, Q> const& v);
 
 	template<typename T, qualifier Q>
 	GLM_FUNC_DECL vec<3, T, Q> operator*(vec<3, T, Q> const& v, qua<T, Q> const& q);
@@ -168,10 +168,10 @@ namespace glm
 	GLM_FUNC_DECL vec<4, T, Q> operator*(vec<4, T, Q> const& v, qua<T, Q> const& q);
 
 	template<typename T, qualifier Q>
-	GLM_FUNC_DECL qua<T, Q> operator*(qua<T, Q> const& q, T const& s);
+	GLM_FUNC_DECL GLM_CONSTEXPR_MATH qua<T, Q> operator*(qua<T, Q> const& q, T const& s);
 
 	template<typename T, qualifier Q>
-	GLM_FUNC_DECL qua<T, Q> operator*(T const& s, qua<T, Q> const& q);
+	GLM_FUNC_DECL GLM_CONSTEXPR_MATH qua<T, Q> operator*(T const& s, qua<T, Q> const& q);
 
 	template<typename T, qualifier Q>
 	GLM_FUNC_DECL qua<T, Q> operator/(qua<T, Q> const& q, T const& s);
@@ -179,10 +179,10 @@ namespace glm
 	// -- Boolean operators --
 
 	template<typename T, qualifier Q>
-	GLM_FUNC_DECL GLM_CONSTEXPR bool operator==(qua<T, Q> const& q1, qua<T, Q> const& q2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_GENERIC bool operator==(qua<T, Q> const& q1, qua<T, Q> const& q2);
 
 	template<typename T, qualifier Q>
-	GLM_FUNC_DECL GLM_CONSTEXPR bool operator!=(qua<T, Q> const& q1, qua<T, Q> const& q2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_GENERIC bool operator!=(qua<T, Q> const& q1, qua<T, Q> const& q2);
 
 	/// @}
 } //namespace glm
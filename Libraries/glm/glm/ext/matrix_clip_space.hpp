@@ -222,7 +222,7 @@ namespace glm
 	///
 	/// @tparam T A floating-point scalar type
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> perspectiveRH_ZO(
+	GLM_FUNC_DECL GLM_CONSTEXPR_MATH mat<4, 4, T, defaultp> perspectiveRH_ZO(
 		T fovy, T aspect, T near, T far);
 
 	/// Creates a matrix for a right handed, symetric perspective-view frustum.
@@ -235,7 +235,7 @@ namespace glm
 	///
 	/// @tparam T A floating-point scalar type
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> perspectiveRH_NO(
+	GLM_FUNC_DECL GLM_CONSTEXPR_MATH mat<4, 4, T, defaultp> perspectiveRH_NO(
 		T fovy, T aspect, T near, T far);
 
 	/// Creates a matrix for a left handed, symetric perspective-view frustum.
@@ -248,7 +248,7 @@ namespace glm
 	///
 	/// @tparam T A floating-point scalar type
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> perspectiveLH_ZO(
+	GLM_FUNC_DECL GLM_CONSTEXPR_MATH mat<4, 4, T, defaultp> perspectiveLH_ZO(
 		T fovy, T aspect, T near, T far);
 
 	/// Creates a matrix for a left handed, symetric perspective-view frustum.
@@ -261,7 +261,7 @@ namespace glm
 	///
 	/// @tparam T A floating-point scalar type
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> perspectiveLH_NO(
+	GLM_FUNC_DECL GLM_CONSTEXPR_MATH mat<4, 4, T, defaultp> perspectiveLH_NO(
 		T fovy, T aspect, T near, T far);
 
 	/// Creates a matrix for a symetric perspective-view frustum using left-handed coordinates if GLM_FORCE_LEFT_HANDED if defined or right-handed coordinates otherwise.
@@ -274,7 +274,7 @@ namespace glm
 	///
 	/// @tparam T A floating-point scalar type
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> perspectiveZO(
+	GLM_FUNC_DECL GLM_CONSTEXPR_MATH mat<4, 4, T, defaultp> perspectiveZO(
 		T fovy, T aspect, T near, T far);
 
 	/// Creates a matrix for a symetric perspective-view frustum using left-handed coordinates if GLM_FORCE_LEFT_HANDED if defined or right-handed coordinates otherwise.
@@ -287,7 +287,7 @@ namespace glm
 	///
 	/// @tparam T A floating-point scalar type
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> perspectiveNO(
+	GLM_FUNC_DECL GLM_CONSTEXPR_MATH mat<4, 4, T, defaultp> perspectiveNO(
 		T fovy, T aspect, T near, T far);
 
 	/// Creates a matrix for a right handed, symetric perspective-view frustum.
@@ -301,7 +301,7 @@ namespace glm
 	///
 	/// @tparam T A floating-point scalar type
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> perspectiveRH(
+	GLM_FUNC_DECL GLM_CONSTEXPR_MATH mat<4, 4, T, defaultp> perspectiveRH(
 		T fovy, T aspect, T near, T far);
 
 	/// Creates a matrix for a left handed, symetric perspective-view frustum.
@@ -315,7 +315,7 @@ namespace glm
 	///
 	/// @tparam T A floating-point scalar type
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> perspectiveLH(
+	GLM_FUNC_DECL GLM_CONSTEXPR_MATH mat<4, 4, T, defaultp> perspectiveLH(
 		T fovy, T aspect, T near, T far);
 
 	/// Creates a matrix for a symetric perspective-view frustum based on the default handedness and default near and far clip planes definition.
@@ -329,7 +329,7 @@ namespace glm
 	/// @tparam T A floating-point scalar type
 	/// @see <a href="https://www.khronos.org/registry/OpenGL-Refpages/gl2.1/xhtml/gluPerspective.xml">gluPerspective man page</a>
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> perspective(
+	GLM_FUNC_DECL GLM_CONSTEXPR_MATH mat<4, 4, T, defaultp> perspective(
 		T fovy, T aspect, T near, T far);
 
 	/// Builds a perspective projection matrix based on a field of view using right-handed coordinates.
@@ -24,11 +24,11 @@ namespace glm
 
 	/// Return the epsilon constant for floating point types.
 	template<typename genType>
-	GLM_FUNC_DECL GLM_CONSTEXPR genType epsilon();
+	GLM_FUNC_DECL GLM_CONSTEXPR_GENERIC genType epsilon();
 
 	/// Return the pi constant for floating point types.
 	template<typename genType>
-	GLM_FUNC_DECL GLM_CONSTEXPR genType pi();
+	GLM_FUNC_DECL GLM_CONSTEXPR_GENERIC genType pi();
 
 	/// @}
 } //namespace glm
@@ -28,14 +28,14 @@ namespace glm
 	///
 	/// @tparam genType Floating-point or integer scalar types
 	template<typename genType>
-	GLM_FUNC_DECL GLM_CONSTEXPR bool equal(genType const& x, genType const& y, genType const& epsilon);
+	GLM_FUNC_DECL GLM_CONSTEXPR_GENERIC bool equal(genType const& x, genType const& y, genType const& epsilon);
 
 	/// Returns the component-wise comparison of |x - y| >= epsilon.
 	/// True if this expression is not satisfied.
 	///
 	/// @tparam genType Floating-point or integer scalar types
 	template<typename genType>
-	GLM_FUNC_DECL GLM_CONSTEXPR bool notEqual(genType const& x, genType const& y, genType const& epsilon);
+	GLM_FUNC_DECL GLM_CONSTEXPR_GENERIC bool notEqual(genType const& x, genType const& y, genType const& epsilon);
 
 	/// Returns the component-wise comparison between two scalars in term of ULPs.
 	/// True if this expression is satisfied.
@@ -46,7 +46,7 @@ namespace glm
 	///
 	/// @tparam genType Floating-point or integer scalar types
 	template<typename genType>
-	GLM_FUNC_DECL GLM_CONSTEXPR bool equal(genType const& x, genType const& y, int ULPs);
+	GLM_FUNC_DECL GLM_CONSTEXPR_GENERIC bool equal(genType const& x, genType const& y, int ULPs);
 
 	/// Returns the component-wise comparison between two scalars in term of ULPs.
 	/// True if this expression is not satisfied.
@@ -57,7 +57,7 @@ namespace glm
 	///
 	/// @tparam genType Floating-point or integer scalar types
 	template<typename genType>
-	GLM_FUNC_DECL GLM_CONSTEXPR bool notEqual(genType const& x, genType const& y, int ULPs);
+	GLM_FUNC_DECL GLM_CONSTEXPR_GENERIC bool notEqual(genType const& x, genType const& y, int ULPs);
 
 	/// @}
 }//namespace glm
@@ -6,19 +6,19 @@
 namespace glm
 {
 	template<typename genType>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR bool equal(genType const& x, genType const& y, genType const& epsilon)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_GENERIC bool equal(genType const& x, genType const& y, genType const& epsilon)
 	{
 		return abs(x - y) <= epsilon;
 	}
 
 	template<typename genType>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR bool notEqual(genType const& x, genType const& y, genType const& epsilon)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_GENERIC bool notEqual(genType const& x, genType const& y, genType const& epsilon)
 	{
 		return abs(x - y) > epsilon;
 	}
 
 	template<typename genType>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR bool equal(genType const& x, genType const& y, int MaxULPs)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_GENERIC bool equal(genType const& x, genType const& y, int MaxULPs)
 	{
 		detail::float_t<genType> const a(x);
 		detail::float_t<genType> const b(y);
@@ -36,7 +36,7 @@ namespace glm
 	}
 
 	template<typename genType>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR bool notEqual(genType const& x, genType const& y, int ULPs)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_GENERIC bool notEqual(genType const& x, genType const& y, int ULPs)
 	{
 		return !equal(x, y, ULPs);
 	}
@@ -15,6 +15,7 @@
 
 // Dependency:
 #include "type_precision.hpp"
+#include "../simd/packing.h"
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
 #	pragma message("GLM: GLM_GTC_packing extension included")
@@ -722,6 +723,96 @@ namespace glm
 	GLM_FUNC_DECL u32vec2 unpackUint2x32(uint64 p);
 
 
+	/// Converts Count floats into halves, each one with the same bits as packHalf1x16.
+	/// Vectors go through as their components: &v[0].x and 4 * Count for an array of vec4.
+	///
+	/// The batch functions use SSE2 or AVX2 when the CPU has them; GLM_GTX_matrix_batch's setBatchInstructionSet
+	/// selects the instruction set. They don't support overlapping In and Out arrays.
+	///
+	/// @see gtc_packing
+	/// @see uint16 packHalf1x16(float v)
+	GLM_FUNC_DECL void packHalf1x16Batch(float const* In, uint16* Out, std::size_t Count);
+
+	/// Converts Count halves into floats, each one with the same bits as unpackHalf1x16.
+	///
+	/// @see gtc_packing
+	/// @see float unpackHalf1x16(uint16 v)
+	GLM_FUNC_DECL void unpackHalf1x16Batch(uint16 const* In, float* Out, std::size_t Count);
+
+	/// Converts Count normalized floats into 8 bit unsigned integers, each one with the same bits as packUnorm1x8.
+	/// NaN inputs give unspecified values.
+	///
+	/// @see gtc_packing
+	/// @see uint8 packUnorm1x8(float v)
+	GLM_FUNC_DECL void packUnorm1x8Batch(float const* In, uint8* Out, std::size_t Count);
+
+	/// @see gtc_packing
+	/// @see float unpackUnorm1x8(uint8 p)
+	GLM_FUNC_DECL void unpackUnorm1x8Batch(uint8 const* In, float* Out, std::size_t Count);
+
+	/// Converts Count normalized floats into 8 bit signed integers, each one with the same bits as packSnorm1x8.
+	/// NaN inputs give unspecified values.
+	///
+	/// @see gtc_packing
+	/// @see uint8 packSnorm1x8(float v)
+	GLM_FUNC_DECL void packSnorm1x8Batch(float const* In, uint8* Out, std::size_t Count);
+
+	/// @see gtc_packing
+	/// @see float unpackSnorm1x8(uint8 p)
+	GLM_FUNC_DECL void unpackSnorm1x8Batch(uint8 const* In, float* Out, std::size_t Count);
+
+	/// Converts Count normalized floats into 16 bit unsigned integers, each one with the same bits as packUnorm1x16.
+	/// NaN inputs give unspecified values.
+	///
+	/// @see gtc_packing
+	/// @see uint16 packUnorm1x16(float v)
+	GLM_FUNC_DECL void packUnorm1x16Batch(float const* In, uint16* Out, std::size_t Count);
+
+	/// @see gtc_packing
+	/// @see float unpackUnorm1x16(uint16 p)
+	GLM_FUNC_DECL void unpackUnorm1x16Batch(uint16 const* In, float* Out, std::size_t Count);
+
+	/// Converts Count normalized floats into 16 bit signed integers, each one with the same bits as packSnorm1x16.
+	/// NaN inputs give unspecified values.
+	///
+	/// @see gtc_packing
+	/// @see uint16 packSnorm1x16(float v)
+	GLM_FUNC_DECL void packSnorm1x16Batch(float const* In, uint16* Out, std::size_t Count);
+
+	/// @see gtc_packing
+	/// @see float unpackSnorm1x16(uint16 p)
+	GLM_FUNC_DECL void unpackSnorm1x16Batch(uint16 const* In, float* Out, std::size_t Count);
+
+	/// Packs Count vectors, each one with the same bits as packUnorm3x10_1x2. NaN components give unspecified values.
+	///
+	/// @see gtc_packing
+	/// @see uint32 packUnorm3x10_1x2(vec4 const& v)
+	GLM_FUNC_DECL void packUnorm3x10_1x2Batch(vec4 const* In, uint32* Out, std::size_t Count);
+
+	/// @see gtc_packing
+	/// @see vec4 unpackUnorm3x10_1x2(uint32 p)
+	GLM_FUNC_DECL void unpackUnorm3x10_1x2Batch(uint32 const* In, vec4* Out, std::size_t Count);
+
+	/// Packs Count vectors, each one with the same bits as packSnorm3x10_1x2. NaN components give unspecified values.
+	///
+	/// @see gtc_packing
+	/// @see uint32 packSnorm3x10_1x2(vec4 const& v)
+	GLM_FUNC_DECL void packSnorm3x10_1x2Batch(vec4 const* In, uint32* Out, std::size_t Count);
+
+	/// @see gtc_packing
+	/// @see vec4 unpackSnorm3x10_1x2(uint32 p)
+	GLM_FUNC_DECL void unpackSnorm3x10_1x2Batch(uint32 const* In, vec4* Out, std::size_t Count);
+
+	/// Packs Count vectors, each one with the same bits as packF2x11_1x10.
+	///
+	/// @see gtc_packing
+	/// @see uint32 packF2x11_1x10(vec3 const& v)
+	GLM_FUNC_DECL void packF2x11_1x10Batch(vec3 const* In, uint32* Out, std::size_t Count);
+
+	/// @see gtc_packing
+	/// @see vec3 unpackF2x11_1x10(uint32 p)
+	GLM_FUNC_DECL void unpackF2x11_1x10Batch(uint32 const* In, vec3* Out, std::size_t Count);
+
 	/// @}
 }// namespace glm
 
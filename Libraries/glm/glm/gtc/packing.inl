@@ -934,5 +934,309 @@ namespace detail
 		memcpy(&Unpack, &p, sizeof(Unpack));
 		return Unpack;
 	}
-}//namespace glm
 
+	GLM_FUNC_QUALIFIER void packHalf1x16Batch(float const* In, uint16* Out, std::size_t Count)
+	{
+#		if GLM_BATCH_X86
+			switch(detail::batch_current_isa())
+			{
+			case GLM_BATCH_ISA_AVX512:
+			case GLM_BATCH_ISA_AVX2:
+				glm_pack_half_batch_avx2(In, Out, Count);
+				return;
+			case GLM_BATCH_ISA_SSE2:
+				glm_pack_half_batch_sse2(In, Out, Count);
+				return;
+			}
+#		endif
+
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = packHalf1x16(In[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackHalf1x16Batch(uint16 const* In, float* Out, std::size_t Count)
+	{
+#		if GLM_BATCH_X86
+			switch(detail::batch_current_isa())
+			{
+			case GLM_BATCH_ISA_AVX512:
+			case GLM_BATCH_ISA_AVX2:
+				glm_unpack_half_batch_avx2(In, Out, Count);
+				return;
+			case GLM_BATCH_ISA_SSE2:
+				glm_unpack_half_batch_sse2(In, Out, Count);
+				return;
+			}
+#		endif
+
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = unpackHalf1x16(In[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void packUnorm1x8Batch(float const* In, uint8* Out, std::size_t Count)
+	{
+#		if GLM_BATCH_X86
+			switch(detail::batch_current_isa())
+			{
+			case GLM_BATCH_ISA_AVX512:
+			case GLM_BATCH_ISA_AVX2:
+				glm_pack_norm8_batch_avx2(In, Out, Count, false);
+				return;
+			case GLM_BATCH_ISA_SSE2:
+				glm_pack_norm8_batch_sse2(In, Out, Count, false);
+				return;
+			}
+#		endif
+
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = packUnorm1x8(In[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackUnorm1x8Batch(uint8 const* In, float* Out, std::size_t Count)
+	{
+#		if GLM_BATCH_X86
+			switch(detail::batch_current_isa())
+			{
+			case GLM_BATCH_ISA_AVX512:
+			case GLM_BATCH_ISA_AVX2:
+				glm_unpack_norm8_batch_avx2(In, Out, Count, false);
+				return;
+			case GLM_BATCH_ISA_SSE2:
+				glm_unpack_norm8_batch_sse2(In, Out, Count, false);
+				return;
+			}
+#		endif
+
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = unpackUnorm1x8(In[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void packSnorm1x8Batch(float const* In, uint8* Out, std::size_t Count)
+	{
+#		if GLM_BATCH_X86
+			switch(detail::batch_current_isa())
+			{
+			case GLM_BATCH_ISA_AVX512:
+			case GLM_BATCH_ISA_AVX2:
+				glm_pack_norm8_batch_avx2(In, Out, Count, true);
+				return;
+			case GLM_BATCH_ISA_SSE2:
+				glm_pack_norm8_batch_sse2(In, Out, Count, true);
+				return;
+			}
+#		endif
+
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = packSnorm1x8(In[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackSnorm1x8Batch(uint8 const* In, float* Out, std::size_t Count)
+	{
+#		if GLM_BATCH_X86
+			switch(detail::batch_current_isa())
+			{
+			case GLM_BATCH_ISA_AVX512:
+			case GLM_BATCH_ISA_AVX2:
+				glm_unpack_norm8_batch_avx2(In, Out, Count, true);
+				return;
+			case GLM_BATCH_ISA_SSE2:
+				glm_unpack_norm8_batch_sse2(In, Out, Count, true);
+				return;
+			}
+#		endif
+
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = unpackSnorm1x8(In[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void packUnorm1x16Batch(float const* In, uint16* Out, std::size_t Count)
+	{
+#		if GLM_BATCH_X86
+			switch(detail::batch_current_isa())
+			{
+			case GLM_BATCH_ISA_AVX512:
+			case GLM_BATCH_ISA_AVX2:
+				glm_pack_norm16_batch_avx2(In, Out, Count, false);
+				return;
+			case GLM_BATCH_ISA_SSE2:
+				glm_pack_norm16_batch_sse2(In, Out, Count, false);
+				return;
+			}
+#		endif
+
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = packUnorm1x16(In[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackUnorm1x16Batch(uint16 const* In, float* Out, std::size_t Count)
+	{
+#		if GLM_BATCH_X86
+			switch(detail::batch_current_isa())
+			{
+			case GLM_BATCH_ISA_AVX512:
+			case GLM_BATCH_ISA_AVX2:
+				glm_unpack_norm16_batch_avx2(In, Out, Count, false);
+				return;
+			case GLM_BATCH_ISA_SSE2:
+				glm_unpack_norm16_batch_sse2(In, Out, Count, false);
+				return;
+			}
+#		endif
+
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = unpackUnorm1x16(In[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void packSnorm1x16Batch(float const* In, uint16* Out, std::size_t Count)
+	{
+#		if GLM_BATCH_X86
+			switch(detail::batch_current_isa())
+			{
+			case GLM_BATCH_ISA_AVX512:
+			case GLM_BATCH_ISA_AVX2:
+				glm_pack_norm16_batch_avx2(In, Out, Count, true);
+				return;
+			case GLM_BATCH_ISA_SSE2:
+				glm_pack_norm16_batch_sse2(In, Out, Count, true);
+				return;
+			}
+#		endif
+
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = packSnorm1x16(In[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackSnorm1x16Batch(uint16 const* In, float* Out, std::size_t Count)
+	{
+#		if GLM_BATCH_X86
+			switch(detail::batch_current_isa())
+			{
+			case GLM_BATCH_ISA_AVX512:
+			case GLM_BATCH_ISA_AVX2:
+				glm_unpack_norm16_batch_avx2(In, Out, Count, true);
+				return;
+			case GLM_BATCH_ISA_SSE2:
+				glm_unpack_norm16_batch_sse2(In, Out, Count, true);
+				return;
+			}
+#		endif
+
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = unpackSnorm1x16(In[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void packUnorm3x10_1x2Batch(vec4 const* In, uint32* Out, std::size_t Count)
+	{
+#		if GLM_BATCH_X86
+			switch(detail::batch_current_isa())
+			{
+			case GLM_BATCH_ISA_AVX512:
+			case GLM_BATCH_ISA_AVX2:
+				glm_pack_norm3x10_1x2_batch_avx2(&In[0].x, Out, Count, false);
+				return;
+			case GLM_BATCH_ISA_SSE2:
+				glm_pack_norm3x10_1x2_batch_sse2(&In[0].x, Out, Count, false);
+				return;
+			}
+#		endif
+
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = packUnorm3x10_1x2(In[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackUnorm3x10_1x2Batch(uint32 const* In, vec4* Out, std::size_t Count)
+	{
+#		if GLM_BATCH_X86
+			switch(detail::batch_current_isa())
+			{
+			case GLM_BATCH_ISA_AVX512:
+			case GLM_BATCH_ISA_AVX2:
+				glm_unpack_norm3x10_1x2_batch_avx2(In, &Out[0].x, Count, false);
+				return;
+			case GLM_BATCH_ISA_SSE2:
+				glm_unpack_norm3x10_1x2_batch_sse2(In, &Out[0].x, Count, false);
+				return;
+			}
+#		endif
+
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = unpackUnorm3x10_1x2(In[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void packSnorm3x10_1x2Batch(vec4 const* In, uint32* Out, std::size_t Count)
+	{
+#		if GLM_BATCH_X86
+			switch(detail::batch_current_isa())
+			{
+			case GLM_BATCH_ISA_AVX512:
+			case GLM_BATCH_ISA_AVX2:
+				glm_pack_norm3x10_1x2_batch_avx2(&In[0].x, Out, Count, true);
+				return;
+			case GLM_BATCH_ISA_SSE2:
+				glm_pack_norm3x10_1x2_batch_sse2(&In[0].x, Out, Count, true);
+				return;
+			}
+#		endif
+
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = packSnorm3x10_1x2(In[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackSnorm3x10_1x2Batch(uint32 const* In, vec4* Out, std::size_t Count)
+	{
+#		if GLM_BATCH_X86
+			switch(detail::batch_current_isa())
+			{
+			case GLM_BATCH_ISA_AVX512:
+			case GLM_BATCH_ISA_AVX2:
+				glm_unpack_norm3x10_1x2_batch_avx2(In, &Out[0].x, Count, true);
+				return;
+			case GLM_BATCH_ISA_SSE2:
+				glm_unpack_norm3x10_1x2_batch_sse2(In, &Out[0].x, Count, true);
+				return;
+			}
+#		endif
+
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = unpackSnorm3x10_1x2(In[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void packF2x11_1x10Batch(vec3 const* In, uint32* Out, std::size_t Count)
+	{
+#		if GLM_BATCH_X86
+			// The kernels read tightly packed vec3, which aligned gentypes are not
+			switch(sizeof(vec3) == sizeof(float) * 3 ? detail::batch_current_isa() : GLM_BATCH_ISA_SCALAR)
+			{
+			case GLM_BATCH_ISA_AVX512:
+			case GLM_BATCH_ISA_AVX2:
+				glm_pack_f2x11_1x10_batch_avx2(&In[0].x, Out, Count);
+				return;
+			case GLM_BATCH_ISA_SSE2:
+				glm_pack_f2x11_1x10_batch_sse2(&In[0].x, Out, Count);
+				return;
+			}
+#		endif
+
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = packF2x11_1x10(In[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackF2x11_1x10Batch(uint32 const* In, vec3* Out, std::size_t Count)
+	{
+#		if GLM_BATCH_X86
+			switch(sizeof(vec3) == sizeof(float) * 3 ? detail::batch_current_isa() : GLM_BATCH_ISA_SCALAR)
+			{
+			case GLM_BATCH_ISA_AVX512:
+			case GLM_BATCH_ISA_AVX2:
+				glm_unpack_f2x11_1x10_batch_avx2(In, &Out[0].x, Count);
+				return;
+			case GLM_BATCH_ISA_SSE2:
+				glm_unpack_f2x11_1x10_batch_sse2(In, &Out[0].x, Count);
+				return;
+			}
+#		endif
+
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = unpackF2x11_1x10(In[i]);
+	}
+}//namespace glm
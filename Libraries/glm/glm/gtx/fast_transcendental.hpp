@@ -0,0 +1,128 @@
+/// @ref gtx_fast_transcendental
+/// @file glm/gtx/fast_transcendental.hpp
+///
+/// @see core (dependence)
+/// @see gtx_matrix_batch (dependence)
+///
+/// @defgroup gtx_fast_transcendental GLM_GTX_fast_transcendental
+/// @ingroup gtx
+///
+/// Include <glm/gtx/fast_transcendental.hpp> to use the features of this extension.
+///
+/// Polynomial sin, cos, exp, log and pow on float vectors and arrays, with bounded errors:
+/// - approxSin, approxCos, approxSincos: within 3 ULP for |x| <= 8192, NaN for infinities
+/// - approxExp: within 1 ULP for normal results, 0 below ln(2^-150), infinity above ln(FLT_MAX)
+/// - approxLog: within 1 ULP for positive inputs, denormals included
+/// - approxPow: within 2 + 2 |y log(x)| ULP for x >= 0, NaN for negative x
+///
+/// Four component vectors use SSE2 when GLM is built with it. The *Batch functions process arrays with SSE2 or AVX2
+/// kernels picked at runtime, like GLM_GTX_matrix_batch whose setBatchInstructionSet applies to them too.
+/// Other architectures evaluate the same polynomials one component at a time.
+/// GLM_GTX_fast_trigonometry and GLM_GTX_fast_exponential are faster and much less accurate.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "matrix_batch.hpp"
+#include "../simd/transcendental_batch.h"
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_fast_transcendental is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#endif
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_fast_transcendental extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_fast_transcendental
+	/// @{
+
+	/// Sine of x in radians, within 3 ULP for |x| <= 8192.
+	/// From GLM_GTX_fast_transcendental extension.
+	GLM_FUNC_DECL float approxSin(float x);
+
+	/// Sine of each component of x in radians, within 3 ULP for |x| <= 8192.
+	/// From GLM_GTX_fast_transcendental extension.
+	template<length_t L, qualifier Q>
+	GLM_FUNC_DECL vec<L, float, Q> approxSin(vec<L, float, Q> const& x);
+
+	/// Cosine of x in radians, within 3 ULP for |x| <= 8192.
+	/// From GLM_GTX_fast_transcendental extension.
+	GLM_FUNC_DECL float approxCos(float x);
+
+	/// Cosine of each component of x in radians, within 3 ULP for |x| <= 8192.
+	/// From GLM_GTX_fast_transcendental extension.
+	template<length_t L, qualifier Q>
+	GLM_FUNC_DECL vec<L, float, Q> approxCos(vec<L, float, Q> const& x);
+
+	/// Sine and cosine of x together, for the cost of one of them.
+	/// From GLM_GTX_fast_transcendental extension.
+	GLM_FUNC_DECL void approxSincos(float x, float& s, float& c);
+
+	/// Sine and cosine of each component of x together, for the cost of one of them.
+	/// From GLM_GTX_fast_transcendental extension.
+	template<length_t L, qualifier Q>
+	GLM_FUNC_DECL void approxSincos(vec<L, float, Q> const& x, vec<L, float, Q>& s, vec<L, float, Q>& c);
+
+	/// Natural exponentiation of x, within 1 ULP for normal results.
+	/// From GLM_GTX_fast_transcendental extension.
+	GLM_FUNC_DECL float approxExp(float x);
+
+	/// Natural exponentiation of each component of x, within 1 ULP for normal results.
+	/// From GLM_GTX_fast_transcendental extension.
+	template<length_t L, qualifier Q>
+	GLM_FUNC_DECL vec<L, float, Q> approxExp(vec<L, float, Q> const& x);
+
+	/// Natural logarithm of x, within 1 ULP for x > 0.
+	/// From GLM_GTX_fast_transcendental extension.
+	GLM_FUNC_DECL float approxLog(float x);
+
+	/// Natural logarithm of each component of x, within 1 ULP for x > 0.
+	/// From GLM_GTX_fast_transcendental extension.
+	template<length_t L, qualifier Q>
+	GLM_FUNC_DECL vec<L, float, Q> approxLog(vec<L, float, Q> const& x);
+
+	/// x raised to the power y for x >= 0, within 2 + 2 |y log(x)| ULP.
+	/// From GLM_GTX_fast_transcendental extension.
+	GLM_FUNC_DECL float approxPow(float x, float y);
+
+	/// Each component of x raised to the power of the matching component of y for x >= 0, within 2 + 2 |y log(x)| ULP.
+	/// From GLM_GTX_fast_transcendental extension.
+	template<length_t L, qualifier Q>
+	GLM_FUNC_DECL vec<L, float, Q> approxPow(vec<L, float, Q> const& x, vec<L, float, Q> const& y);
+
+	/// Out[i] = approxSin(In[i]) for i in [0, Count). Out may alias In.
+	/// From GLM_GTX_fast_transcendental extension.
+	GLM_FUNC_DECL void sinBatch(float const* In, float* Out, std::size_t Count);
+
+	/// Out[i] = approxCos(In[i]) for i in [0, Count). Out may alias In.
+	/// From GLM_GTX_fast_transcendental extension.
+	GLM_FUNC_DECL void cosBatch(float const* In, float* Out, std::size_t Count);
+
+	/// Sin[i] = approxSin(In[i]) and Cos[i] = approxCos(In[i]) for i in [0, Count). Sin or Cos may alias In.
+	/// From GLM_GTX_fast_transcendental extension.
+	GLM_FUNC_DECL void sincosBatch(float const* In, float* Sin, float* Cos, std::size_t Count);
+
+	/// Out[i] = approxExp(In[i]) for i in [0, Count). Out may alias In.
+	/// From GLM_GTX_fast_transcendental extension.
+	GLM_FUNC_DECL void expBatch(float const* In, float* Out, std::size_t Count);
+
+	/// Out[i] = approxLog(In[i]) for i in [0, Count). Out may alias In.
+	/// From GLM_GTX_fast_transcendental extension.
+	GLM_FUNC_DECL void logBatch(float const* In, float* Out, std::size_t Count);
+
+	/// Out[i] = approxPow(X[i], Y[i]) for i in [0, Count). Out may alias X or Y.
+	/// From GLM_GTX_fast_transcendental extension.
+	GLM_FUNC_DECL void powBatch(float const* X, float const* Y, float* Out, std::size_t Count);
+
+	/// Out[i] = approxPow(X[i], Y) for i in [0, Count), e.g. gamma correction. Out may alias X.
+	/// From GLM_GTX_fast_transcendental extension.
+	GLM_FUNC_DECL void powBatch(float const* X, float Y, float* Out, std::size_t Count);
+
+	/// @}
+}//namespace glm
+
+#include "fast_transcendental.inl"
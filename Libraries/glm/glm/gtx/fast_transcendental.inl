@@ -0,0 +1,378 @@
+/// @ref gtx_fast_transcendental
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace glm{
+namespace detail
+{
+	// Scalar versions of the polynomials in simd/trigonometric.h and simd/exponential.h, see there for the details.
+	GLM_FUNC_QUALIFIER float approx_sincos(float x, float& c)
+	{
+		// Angles past the range of the reduction, infinities and NaNs
+		if(!(std::fabs(x) < 1e9f))
+		{
+			c = std::cos(x);
+			return std::sin(x);
+		}
+
+		int const q = static_cast<int>(std::floor(x * 0.636619772367581343f + 0.5f));
+		float const n = static_cast<float>(q);
+		float r = x - n * 1.5703125f;
+		r = r - n * 4.8351287841796875e-4f;
+		r = r - n * 3.1385570764541625977e-7f;
+		r = r - n * 6.0771006282767103812e-11f;
+		float const r2 = r * r;
+
+		float const s = ((-1.9515295891e-4f * r2 + 8.3321608736e-3f) * r2 - 1.6666654611e-1f) * r2 * r + r;
+		float const k = ((2.443315711809948e-5f * r2 - 1.388731625493765e-3f) * r2 + 4.166664568298827e-2f) * r2 * r2 + (1.0f - r2 * 0.5f);
+
+		float const Sin = q & 1 ? k : s;
+		float const Cos = q & 1 ? s : k;
+		c = (q + 1) & 2 ? -Cos : Cos;
+		return q & 2 ? -Sin : Sin;
+	}
+
+	GLM_FUNC_QUALIFIER float approx_exp(float x)
+	{
+		if(x != x)
+			return x;
+		if(x > 88.7228394f)
+			return std::numeric_limits<float>::infinity();
+		if(x < -103.972084f)
+			return 0.0f;
+
+		int const q = static_cast<int>(std::floor(x * 1.44269504088896341f + 0.5f));
+		float const n = static_cast<float>(q);
+		float r = x - n * 0.693359375f;
+		r = r + n * 2.12194440e-4f;
+
+		float p = 1.9875691500e-4f * r + 1.3981999507e-3f;
+		p = p * r + 8.3334519073e-3f;
+		p = p * r + 4.1665795894e-2f;
+		p = p * r + 1.6666665459e-1f;
+		p = p * r + 5.0000001201e-1f;
+		p = p * r * r + r + 1.0f;
+
+		return std::ldexp(p, q);
+	}
+
+	GLM_FUNC_QUALIFIER float approx_log(float x)
+	{
+		if(x != x || x < 0.0f)
+			return std::numeric_limits<float>::quiet_NaN();
+		if(x == 0.0f)
+			return -std::numeric_limits<float>::infinity();
+		if(x == std::numeric_limits<float>::infinity())
+			return x;
+
+		int Exponent = 0;
+		float m = std::frexp(x, &Exponent);
+		float e = static_cast<float>(Exponent);
+		if(m < 0.707106781186547524f)
+		{
+			e -= 1.0f;
+			m = m + m - 1.0f;
+		}
+		else
+			m = m - 1.0f;
+		float const z = m * m;
+
+		float p = 7.0376836292e-2f * m - 1.1514610310e-1f;
+		p = p * m + 1.1676998740e-1f;
+		p = p * m - 1.2420140846e-1f;
+		p = p * m + 1.4249322787e-1f;
+		p = p * m - 1.6668057665e-1f;
+		p = p * m + 2.0000714765e-1f;
+		p = p * m - 2.4999993993e-1f;
+		p = p * m + 3.3333331174e-1f;
+		p = p * m * z;
+
+		p = p + e * -2.12194440e-4f;
+		p = p - z * 0.5f;
+		return (m + p) + e * 0.693359375f;
+	}
+
+	GLM_FUNC_QUALIFIER float approx_pow(float x, float y)
+	{
+		return y == 0.0f ? 1.0f : approx_exp(y * approx_log(x));
+	}
+
+	template<length_t L, qualifier Q>
+	struct compute_approx_sincos
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<L, float, Q> const& x, vec<L, float, Q>& s, vec<L, float, Q>& c)
+		{
+			for(length_t i = 0; i < L; ++i)
+				s[i] = approx_sincos(x[i], c[i]);
+		}
+	};
+
+	template<length_t L, qualifier Q>
+	struct compute_approx_exp
+	{
+		GLM_FUNC_QUALIFIER static vec<L, float, Q> call(vec<L, float, Q> const& x)
+		{
+			return detail::functor1<vec, L, float, float, Q>::call(approx_exp, x);
+		}
+	};
+
+	template<length_t L, qualifier Q>
+	struct compute_approx_log
+	{
+		GLM_FUNC_QUALIFIER static vec<L, float, Q> call(vec<L, float, Q> const& x)
+		{
+			return detail::functor1<vec, L, float, float, Q>::call(approx_log, x);
+		}
+	};
+
+	template<length_t L, qualifier Q>
+	struct compute_approx_pow
+	{
+		GLM_FUNC_QUALIFIER static vec<L, float, Q> call(vec<L, float, Q> const& x, vec<L, float, Q> const& y)
+		{
+			return detail::functor2<vec, L, float, Q>::call(approx_pow, x, y);
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	// Packed vectors are loaded unaligned, so every four component vector gets the SIMD path.
+	template<qualifier Q>
+	struct compute_approx_sincos<4, Q>
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<4, float, Q> const& x, vec<4, float, Q>& s, vec<4, float, Q>& c)
+		{
+			glm_vec4 Cos;
+			_mm_storeu_ps(&s[0], glm_vec4_sincos(_mm_loadu_ps(&x[0]), &Cos));
+			_mm_storeu_ps(&c[0], Cos);
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_approx_exp<4, Q>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& x)
+		{
+			vec<4, float, Q> Result;
+			_mm_storeu_ps(&Result[0], glm_vec4_exp(_mm_loadu_ps(&x[0])));
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_approx_log<4, Q>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& x)
+		{
+			vec<4, float, Q> Result;
+			_mm_storeu_ps(&Result[0], glm_vec4_log(_mm_loadu_ps(&x[0])));
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_approx_pow<4, Q>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& x, vec<4, float, Q> const& y)
+		{
+			vec<4, float, Q> Result;
+			_mm_storeu_ps(&Result[0], glm_vec4_pow(_mm_loadu_ps(&x[0]), _mm_loadu_ps(&y[0])));
+			return Result;
+		}
+	};
+#	endif
+
+	// The AVX-512 requests of GLM_GTX_matrix_batch run the AVX2 kernels.
+	GLM_FUNC_QUALIFIER void sincos_batch(float const* In, float* Sin, float* Cos, std::size_t Count)
+	{
+#		if GLM_BATCH_X86
+			switch(batch_current_isa())
+			{
+			case GLM_BATCH_ISA_AVX512:
+			case GLM_BATCH_ISA_AVX2:
+				glm_sincos_batch_avx2(In, Sin, Cos, Count);
+				return;
+			case GLM_BATCH_ISA_SSE2:
+				glm_sincos_batch_sse2(In, Sin, Cos, Count);
+				return;
+			}
+#		endif
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			float c;
+			float const s = approx_sincos(In[i], c);
+			if(Sin)
+				Sin[i] = s;
+			if(Cos)
+				Cos[i] = c;
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void exp_batch(float const* In, float* Out, std::size_t Count)
+	{
+#		if GLM_BATCH_X86
+			switch(batch_current_isa())
+			{
+			case GLM_BATCH_ISA_AVX512:
+			case GLM_BATCH_ISA_AVX2:
+				glm_exp_batch_avx2(In, Out, Count);
+				return;
+			case GLM_BATCH_ISA_SSE2:
+				glm_exp_batch_sse2(In, Out, Count);
+				return;
+			}
+#		endif
+
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = approx_exp(In[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void log_batch(float const* In, float* Out, std::size_t Count)
+	{
+#		if GLM_BATCH_X86
+			switch(batch_current_isa())
+			{
+			case GLM_BATCH_ISA_AVX512:
+			case GLM_BATCH_ISA_AVX2:
+				glm_log_batch_avx2(In, Out, Count);
+				return;
+			case GLM_BATCH_ISA_SSE2:
+				glm_log_batch_sse2(In, Out, Count);
+				return;
+			}
+#		endif
+
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = approx_log(In[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void pow_batch(float const* X, float const* Y, std::size_t StrideY, float* Out, std::size_t Count)
+	{
+#		if GLM_BATCH_X86
+			switch(batch_current_isa())
+			{
+			case GLM_BATCH_ISA_AVX512:
+			case GLM_BATCH_ISA_AVX2:
+				glm_pow_batch_avx2(X, Y, StrideY, Out, Count);
+				return;
+			case GLM_BATCH_ISA_SSE2:
+				glm_pow_batch_sse2(X, Y, StrideY, Out, Count);
+				return;
+			}
+#		endif
+
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = approx_pow(X[i], Y[i * StrideY]);
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER float approxSin(float x)
+	{
+		float c;
+		return detail::approx_sincos(x, c);
+	}
+
+	template<length_t L, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, float, Q> approxSin(vec<L, float, Q> const& x)
+	{
+		vec<L, float, Q> s, c;
+		detail::compute_approx_sincos<L, Q>::call(x, s, c);
+		return s;
+	}
+
+	GLM_FUNC_QUALIFIER float approxCos(float x)
+	{
+		float c;
+		detail::approx_sincos(x, c);
+		return c;
+	}
+
+	template<length_t L, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, float, Q> approxCos(vec<L, float, Q> const& x)
+	{
+		vec<L, float, Q> s, c;
+		detail::compute_approx_sincos<L, Q>::call(x, s, c);
+		return c;
+	}
+
+	GLM_FUNC_QUALIFIER void approxSincos(float x, float& s, float& c)
+	{
+		s = detail::approx_sincos(x, c);
+	}
+
+	template<length_t L, qualifier Q>
+	GLM_FUNC_QUALIFIER void approxSincos(vec<L, float, Q> const& x, vec<L, float, Q>& s, vec<L, float, Q>& c)
+	{
+		detail::compute_approx_sincos<L, Q>::call(x, s, c);
+	}
+
+	GLM_FUNC_QUALIFIER float approxExp(float x)
+	{
+		return detail::approx_exp(x);
+	}
+
+	template<length_t L, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, float, Q> approxExp(vec<L, float, Q> const& x)
+	{
+		return detail::compute_approx_exp<L, Q>::call(x);
+	}
+
+	GLM_FUNC_QUALIFIER float approxLog(float x)
+	{
+		return detail::approx_log(x);
+	}
+
+	template<length_t L, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, float, Q> approxLog(vec<L, float, Q> const& x)
+	{
+		return detail::compute_approx_log<L, Q>::call(x);
+	}
+
+	GLM_FUNC_QUALIFIER float approxPow(float x, float y)
+	{
+		return detail::approx_pow(x, y);
+	}
+
+	template<length_t L, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, float, Q> approxPow(vec<L, float, Q> const& x, vec<L, float, Q> const& y)
+	{
+		return detail::compute_approx_pow<L, Q>::call(x, y);
+	}
+
+	GLM_FUNC_QUALIFIER void sinBatch(float const* In, float* Out, std::size_t Count)
+	{
+		detail::sincos_batch(In, Out, NULL, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void cosBatch(float const* In, float* Out, std::size_t Count)
+	{
+		detail::sincos_batch(In, NULL, Out, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void sincosBatch(float const* In, float* Sin, float* Cos, std::size_t Count)
+	{
+		detail::sincos_batch(In, Sin, Cos, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void expBatch(float const* In, float* Out, std::size_t Count)
+	{
+		detail::exp_batch(In, Out, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void logBatch(float const* In, float* Out, std::size_t Count)
+	{
+		detail::log_batch(In, Out, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void powBatch(float const* X, float const* Y, float* Out, std::size_t Count)
+	{
+		detail::pow_batch(X, Y, 1, Out, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void powBatch(float const* X, float Y, float* Out, std::size_t Count)
+	{
+		detail::pow_batch(X, &Y, 0, Out, Count);
+	}
+}//namespace glm
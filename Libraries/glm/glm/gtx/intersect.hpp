@@ -86,6 +86,48 @@ namespace glm
 		genType & intersectionPosition1, genType & intersectionNormal1,
 		genType & intersectionPosition2 = genType(), genType & intersectionNormal2 = genType());
 
+	//! Compute the intersection of a ray and a triangle without gaps along shared edges.
+	//! Rays through an edge or a vertex hit every triangle sharing it, so a ray never passes between
+	//! the triangles of a closed mesh. Based on Woop, Benthin and Wald, Watertight Ray/Triangle Intersection.
+	//! Both faces are hit. baryPosition and distance follow intersectRayTriangle:
+	//! the hit is (1 - x - y) * vert0 + x * vert1 + y * vert2 and orig + distance * dir, distance > 0.
+	//! From GLM_GTX_intersect extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool intersectRayTriangleWatertight(
+		vec<3, T, Q> const& orig, vec<3, T, Q> const& dir,
+		vec<3, T, Q> const& vert0, vec<3, T, Q> const& vert1, vec<3, T, Q> const& vert2,
+		vec<2, T, Q>& baryPosition, T& distance);
+
+	//! Extract the planes of the frustum of a projection or view-projection matrix, for a [0, 1] clip space depth.
+	//! planes receives left, right, bottom, top, near and far as (normal, distance) with unit normals pointing inside,
+	//! so dot(vec3(planes[i]), p) + planes[i].w is the signed distance of p to plane i.
+	//! From GLM_GTX_intersect extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void frustumPlanesZO(mat<4, 4, T, Q> const& m, vec<4, T, Q> planes[6]);
+
+	//! Extract the planes of the frustum of a projection or view-projection matrix, for a [-1, 1] clip space depth.
+	//! @see frustumPlanesZO
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void frustumPlanesNO(mat<4, 4, T, Q> const& m, vec<4, T, Q> planes[6]);
+
+	//! Extract the planes of the frustum of a projection or view-projection matrix,
+	//! for the clip space depth range selected by GLM_FORCE_DEPTH_ZERO_TO_ONE.
+	//! @see frustumPlanesZO
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void frustumPlanes(mat<4, 4, T, Q> const& m, vec<4, T, Q> planes[6]);
+
+	//! Return false when a sphere is entirely behind one of the frustum planes.
+	//! Conservative: spheres near the edges of the frustum may be reported although they are outside.
+	//! From GLM_GTX_intersect extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool intersectSphereFrustum(vec<3, T, Q> const& center, T radius, vec<4, T, Q> const planes[6]);
+
+	//! Return false when an axis aligned box is entirely behind one of the frustum planes.
+	//! Conservative like intersectSphereFrustum.
+	//! From GLM_GTX_intersect extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool intersectAABBFrustum(vec<3, T, Q> const& boxMin, vec<3, T, Q> const& boxMax, vec<4, T, Q> const planes[6]);
+
 	/// @}
 }//namespace glm
 
@@ -194,4 +194,119 @@ namespace glm
 		intersectionNormal2 = (intersectionPoint2 - sphereCenter) / sphereRadius;
 		return true;
 	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool intersectRayTriangleWatertight
+	(
+		vec<3, T, Q> const& orig, vec<3, T, Q> const& dir,
+		vec<3, T, Q> const& vert0, vec<3, T, Q> const& vert1, vec<3, T, Q> const& vert2,
+		vec<2, T, Q>& baryPosition, T& distance
+	)
+	{
+		// z is the largest direction component, x and y the others in an order that keeps the winding
+		length_t const kz = abs(dir.x) > abs(dir.y) ? (abs(dir.x) > abs(dir.z) ? 0 : 2) : (abs(dir.y) > abs(dir.z) ? 1 : 2);
+		length_t kx = kz == 2 ? 0 : kz + 1;
+		length_t ky = kx == 2 ? 0 : kx + 1;
+		if(dir[kz] < static_cast<T>(0))
+		{
+			length_t const Swap = kx;
+			kx = ky;
+			ky = Swap;
+		}
+
+		// shear so the ray runs along z, the test becomes a 2D point in triangle test at the origin
+		T const Sx = dir[kx] / dir[kz];
+		T const Sy = dir[ky] / dir[kz];
+		T const Sz = static_cast<T>(1) / dir[kz];
+
+		vec<3, T, Q> const A = vert0 - orig;
+		vec<3, T, Q> const B = vert1 - orig;
+		vec<3, T, Q> const C = vert2 - orig;
+		T const Ax = A[kx] - Sx * A[kz];
+		T const Ay = A[ky] - Sy * A[kz];
+		T const Bx = B[kx] - Sx * B[kz];
+		T const By = B[ky] - Sy * B[kz];
+		T const Cx = C[kx] - Sx * C[kz];
+		T const Cy = C[ky] - Sy * C[kz];
+
+		// scaled barycentric coordinates, a zero is an edge and counts as inside
+		T const U = Cx * By - Cy * Bx;
+		T const V = Ax * Cy - Ay * Cx;
+		T const W = Bx * Ay - By * Ax;
+		if((U < static_cast<T>(0) || V < static_cast<T>(0) || W < static_cast<T>(0)) && (U > static_cast<T>(0) || V > static_cast<T>(0) || W > static_cast<T>(0)))
+			return false;
+
+		T const det = U + V + W;
+		if(det == static_cast<T>(0))
+			return false;
+
+		T const Dist = U * Sz * A[kz] + V * Sz * B[kz] + W * Sz * C[kz];
+		if(det < static_cast<T>(0) ? Dist >= static_cast<T>(0) : Dist <= static_cast<T>(0))
+			return false;
+
+		T const inv_det = static_cast<T>(1) / det;
+		baryPosition = vec<2, T, Q>(V, W) * inv_det;
+		distance = Dist * inv_det;
+		return true;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void frustumPlanesZO(mat<4, 4, T, Q> const& m, vec<4, T, Q> planes[6])
+	{
+		// Gribb and Hartmann, each plane is a sum of rows of the matrix
+		mat<4, 4, T, Q> const Rows = transpose(m);
+		planes[0] = Rows[3] + Rows[0];
+		planes[1] = Rows[3] - Rows[0];
+		planes[2] = Rows[3] + Rows[1];
+		planes[3] = Rows[3] - Rows[1];
+		planes[4] = Rows[2];
+		planes[5] = Rows[3] - Rows[2];
+		for(length_t i = 0; i < 6; ++i)
+			planes[i] /= length(vec<3, T, Q>(planes[i]));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void frustumPlanesNO(mat<4, 4, T, Q> const& m, vec<4, T, Q> planes[6])
+	{
+		frustumPlanesZO(m, planes);
+		mat<4, 4, T, Q> const Rows = transpose(m);
+		planes[4] = Rows[3] + Rows[2];
+		planes[4] /= length(vec<3, T, Q>(planes[4]));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void frustumPlanes(mat<4, 4, T, Q> const& m, vec<4, T, Q> planes[6])
+	{
+		if(GLM_CONFIG_CLIP_CONTROL & GLM_CLIP_CONTROL_ZO_BIT)
+			frustumPlanesZO(m, planes);
+		else
+			frustumPlanesNO(m, planes);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool intersectSphereFrustum(vec<3, T, Q> const& center, T radius, vec<4, T, Q> const planes[6])
+	{
+		for(length_t i = 0; i < 6; ++i)
+		{
+			if(dot(vec<3, T, Q>(planes[i]), center) + planes[i].w < -radius)
+				return false;
+		}
+		return true;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool intersectAABBFrustum(vec<3, T, Q> const& boxMin, vec<3, T, Q> const& boxMax, vec<4, T, Q> const planes[6])
+	{
+		for(length_t i = 0; i < 6; ++i)
+		{
+			// the corner furthest along the normal
+			vec<3, T, Q> const Corner(
+				planes[i].x < static_cast<T>(0) ? boxMin.x : boxMax.x,
+				planes[i].y < static_cast<T>(0) ? boxMin.y : boxMax.y,
+				planes[i].z < static_cast<T>(0) ? boxMin.z : boxMax.z);
+			if(dot(vec<3, T, Q>(planes[i]), Corner) + planes[i].w < static_cast<T>(0))
+				return false;
+		}
+		return true;
+	}
 }//namespace glm
@@ -0,0 +1,84 @@
+/// @ref gtx_intersect_batch
+/// @file glm/gtx/intersect_batch.hpp
+///
+/// @see core (dependence)
+/// @see gtx_intersect (dependence)
+/// @see gtx_soa (dependence)
+///
+/// @defgroup gtx_intersect_batch GLM_GTX_intersect_batch
+/// @ingroup gtx
+///
+/// Include <glm/gtx/intersect_batch.hpp> to use the features of this extension.
+///
+/// The tests of GLM_GTX_intersect run on many objects at once: frustum culling of bounding spheres and boxes,
+/// and picking of the closest sphere or triangle hit by a ray. The objects are GLM_GTX_soa containers, so
+/// x86 tests 4 objects per iteration with SSE2 and 8 with AVX2, picked at runtime like GLM_GTX_matrix_batch.
+/// Other architectures use a scalar loop.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "intersect.hpp"
+#include "soa.hpp"
+#include "../simd/intersect_batch.h"
+#include <cstddef>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_intersect_batch is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#endif
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_intersect_batch extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_intersect_batch
+	/// @{
+
+	/// Writes to Visible the indices of the spheres that intersectSphereFrustum keeps, in increasing order,
+	/// and returns their number. Planes come from frustumPlanes. Radii must have the size of Centers.
+	/// Visible must have room for Centers.size() indices.
+	/// From GLM_GTX_intersect_batch extension.
+	template<qualifier Q>
+	GLM_FUNC_DECL std::size_t intersectSphereFrustumBatch(vec<4, float, Q> const Planes[6], vec3_soa const& Centers, vec1_soa const& Radii, unsigned int* Visible);
+
+	/// Same with one radius for every sphere, e.g. instances of one mesh.
+	/// From GLM_GTX_intersect_batch extension.
+	template<qualifier Q>
+	GLM_FUNC_DECL std::size_t intersectSphereFrustumBatch(vec<4, float, Q> const Planes[6], vec3_soa const& Centers, float Radius, unsigned int* Visible);
+
+	/// Writes to Visible the indices of the boxes that intersectAABBFrustum keeps, in increasing order,
+	/// and returns their number. Min and Max must have the same size.
+	/// Visible must have room for Min.size() indices.
+	/// From GLM_GTX_intersect_batch extension.
+	template<qualifier Q>
+	GLM_FUNC_DECL std::size_t intersectAABBFrustumBatch(vec<4, float, Q> const Planes[6], vec3_soa const& Min, vec3_soa const& Max, unsigned int* Visible);
+
+	/// Finds the closest sphere hit by a ray, with the distance of intersectRaySphere.
+	/// The direction must be unit length. Radii must have the size of Centers.
+	/// Returns false and leaves Index and Distance untouched when no sphere is hit.
+	/// Equal distances go to the lowest index.
+	/// From GLM_GTX_intersect_batch extension.
+	template<qualifier Q>
+	GLM_FUNC_DECL bool intersectRaySphereBatch(vec<3, float, Q> const& Orig, vec<3, float, Q> const& Dir, vec3_soa const& Centers, vec1_soa const& Radii, std::size_t& Index, float& Distance);
+
+	/// Same with one radius for every sphere.
+	/// From GLM_GTX_intersect_batch extension.
+	template<qualifier Q>
+	GLM_FUNC_DECL bool intersectRaySphereBatch(vec<3, float, Q> const& Orig, vec<3, float, Q> const& Dir, vec3_soa const& Centers, float Radius, std::size_t& Index, float& Distance);
+
+	/// Finds the closest triangle (V0[i], V1[i], V2[i]) hit by a ray, with the watertight test of
+	/// intersectRayTriangleWatertight so a ray never slips between the triangles of a closed mesh.
+	/// V0, V1 and V2 must have the same size. Bary and Distance are those of intersectRayTriangleWatertight.
+	/// Returns false and leaves the outputs untouched when no triangle is hit.
+	/// Equal distances go to the lowest index.
+	/// From GLM_GTX_intersect_batch extension.
+	template<qualifier Q>
+	GLM_FUNC_DECL bool intersectRayTriangleBatch(vec<3, float, Q> const& Orig, vec<3, float, Q> const& Dir, vec3_soa const& V0, vec3_soa const& V1, vec3_soa const& V2, std::size_t& Index, vec<2, float, Q>& Bary, float& Distance);
+
+	/// @}
+}//namespace glm
+
+#include "intersect_batch.inl"
@@ -0,0 +1,257 @@
+/// @ref gtx_intersect_batch
+
+#include <cassert>
+#include <cfloat>
+
+namespace glm{
+namespace detail
+{
+	// Planes holds the 6 planes as 24 floats. The radius stream is read with a stride of RadiusStride,
+	// 0 when every sphere has the same radius. Count is the exact number of objects.
+	GLM_FUNC_QUALIFIER std::size_t sphere_frustum_batch(float const* Planes, float const* Centers, std::size_t Stride, float const* Radii, std::size_t RadiusStride, std::size_t Count, unsigned int* Visible)
+	{
+#		if GLM_BATCH_X86
+			switch(batch_current_isa())
+			{
+			case GLM_BATCH_ISA_AVX512:
+			case GLM_BATCH_ISA_AVX2:
+				return glm_sphere_frustum_batch_avx2(Planes, Centers, Stride, Radii, RadiusStride, Count, Visible);
+			case GLM_BATCH_ISA_SSE2:
+				return glm_sphere_frustum_batch_sse2(Planes, Centers, Stride, Radii, RadiusStride, Count, Visible);
+			}
+#		endif
+
+		vec<4, float, defaultp> p[6];
+		for(length_t k = 0; k < 6; ++k)
+			p[k] = vec<4, float, defaultp>(Planes[k * 4], Planes[k * 4 + 1], Planes[k * 4 + 2], Planes[k * 4 + 3]);
+
+		std::size_t Written = 0;
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			vec<3, float, defaultp> const Center(Centers[i], Centers[Stride + i], Centers[2 * Stride + i]);
+			if(intersectSphereFrustum(Center, Radii[i * RadiusStride], p))
+				Visible[Written++] = static_cast<unsigned int>(i);
+		}
+		return Written;
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t aabb_frustum_batch(float const* Planes, float const* Min, std::size_t MinStride, float const* Max, std::size_t MaxStride, std::size_t Count, unsigned int* Visible)
+	{
+#		if GLM_BATCH_X86
+			switch(batch_current_isa())
+			{
+			case GLM_BATCH_ISA_AVX512:
+			case GLM_BATCH_ISA_AVX2:
+				return glm_aabb_frustum_batch_avx2(Planes, Min, MinStride, Max, MaxStride, Count, Visible);
+			case GLM_BATCH_ISA_SSE2:
+				return glm_aabb_frustum_batch_sse2(Planes, Min, MinStride, Max, MaxStride, Count, Visible);
+			}
+#		endif
+
+		vec<4, float, defaultp> p[6];
+		for(length_t k = 0; k < 6; ++k)
+			p[k] = vec<4, float, defaultp>(Planes[k * 4], Planes[k * 4 + 1], Planes[k * 4 + 2], Planes[k * 4 + 3]);
+
+		std::size_t Written = 0;
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			vec<3, float, defaultp> const BoxMin(Min[i], Min[MinStride + i], Min[2 * MinStride + i]);
+			vec<3, float, defaultp> const BoxMax(Max[i], Max[MaxStride + i], Max[2 * MaxStride + i]);
+			if(intersectAABBFrustum(BoxMin, BoxMax, p))
+				Visible[Written++] = static_cast<unsigned int>(i);
+		}
+		return Written;
+	}
+
+	// Returns Count when no sphere is hit.
+	GLM_FUNC_QUALIFIER std::size_t ray_sphere_batch(float const* Orig, float const* Dir, float const* Centers, std::size_t Stride, float const* Radii, std::size_t RadiusStride, std::size_t Count, float& Distance)
+	{
+#		if GLM_BATCH_X86
+			switch(batch_current_isa())
+			{
+			case GLM_BATCH_ISA_AVX512:
+			case GLM_BATCH_ISA_AVX2:
+				return glm_ray_sphere_batch_avx2(Orig, Dir, Centers, Stride, Radii, RadiusStride, Count, Distance);
+			case GLM_BATCH_ISA_SSE2:
+				return glm_ray_sphere_batch_sse2(Orig, Dir, Centers, Stride, Radii, RadiusStride, Count, Distance);
+			}
+#		endif
+
+		vec<3, float, defaultp> const o(Orig[0], Orig[1], Orig[2]);
+		vec<3, float, defaultp> const d(Dir[0], Dir[1], Dir[2]);
+
+		std::size_t Result = Count;
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			vec<3, float, defaultp> const Center(Centers[i], Centers[Stride + i], Centers[2 * Stride + i]);
+			float const Radius = Radii[i * RadiusStride];
+			float t;
+			if(intersectRaySphere(o, d, Center, Radius * Radius, t) && (Result == Count || t < Distance))
+			{
+				Distance = t;
+				Result = i;
+			}
+		}
+		return Result;
+	}
+
+	// The watertight test on the vertex streams permuted to the kx, ky, kz order of the ray, see
+	// intersectRayTriangleWatertight. Writes the scaled barycentric coordinates and distance, returns
+	// whether triangle i is hit.
+	GLM_FUNC_QUALIFIER bool ray_triangle(float const* const* V, float const* Orig, float const* S, std::size_t i, float& U, float& V1, float& V2, float& Det, float& T)
+	{
+		float x[3], y[3], z[3];
+		for(int k = 0; k < 3; ++k)
+		{
+			z[k] = V[k * 3 + 2][i] - Orig[2];
+			x[k] = V[k * 3][i] - Orig[0] - S[0] * z[k];
+			y[k] = V[k * 3 + 1][i] - Orig[1] - S[1] * z[k];
+		}
+
+		U = x[2] * y[1] - y[2] * x[1];
+		V1 = x[0] * y[2] - y[0] * x[2];
+		V2 = x[1] * y[0] - y[1] * x[0];
+		Det = U + V1 + V2;
+		T = S[2] * (U * z[0] + V1 * z[1] + V2 * z[2]);
+
+		if((U < 0.0f || V1 < 0.0f || V2 < 0.0f) && (U > 0.0f || V1 > 0.0f || V2 > 0.0f))
+			return false;
+		if(Det == 0.0f)
+			return false;
+		return Det < 0.0f ? T < 0.0f : T > 0.0f;
+	}
+
+	// Returns Count when no triangle is hit.
+	GLM_FUNC_QUALIFIER std::size_t ray_triangle_batch(float const* const* V, float const* Orig, float const* S, std::size_t Count, float& Distance)
+	{
+#		if GLM_BATCH_X86
+			switch(batch_current_isa())
+			{
+			case GLM_BATCH_ISA_AVX512:
+			case GLM_BATCH_ISA_AVX2:
+				return glm_ray_triangle_batch_avx2(V, Orig, S, Count, Distance);
+			case GLM_BATCH_ISA_SSE2:
+				return glm_ray_triangle_batch_sse2(V, Orig, S, Count, Distance);
+			}
+#		endif
+
+		std::size_t Result = Count;
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			float U, V1, V2, Det, T;
+			if(!ray_triangle(V, Orig, S, i, U, V1, V2, Det, T))
+				continue;
+			float const t = T / Det;
+			if(Result == Count || t < Distance)
+			{
+				Distance = t;
+				Result = i;
+			}
+		}
+		return Result;
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void flatten_planes(vec<4, float, Q> const Planes[6], float Flat[24])
+	{
+		for(length_t k = 0; k < 6; ++k)
+		for(length_t c = 0; c < 4; ++c)
+			Flat[k * 4 + c] = Planes[k][c];
+	}
+}//namespace detail
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t intersectSphereFrustumBatch(vec<4, float, Q> const Planes[6], vec3_soa const& Centers, vec1_soa const& Radii, unsigned int* Visible)
+	{
+		assert(Radii.size() == Centers.size());
+		if(Centers.empty())
+			return 0;
+		float Flat[24];
+		detail::flatten_planes(Planes, Flat);
+		return detail::sphere_frustum_batch(Flat, Centers.data(0), Centers.capacity(), Radii.data(0), 1, Centers.size(), Visible);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t intersectSphereFrustumBatch(vec<4, float, Q> const Planes[6], vec3_soa const& Centers, float Radius, unsigned int* Visible)
+	{
+		float Flat[24];
+		detail::flatten_planes(Planes, Flat);
+		return detail::sphere_frustum_batch(Flat, Centers.data(0), Centers.capacity(), &Radius, 0, Centers.size(), Visible);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t intersectAABBFrustumBatch(vec<4, float, Q> const Planes[6], vec3_soa const& Min, vec3_soa const& Max, unsigned int* Visible)
+	{
+		assert(Min.size() == Max.size());
+		float Flat[24];
+		detail::flatten_planes(Planes, Flat);
+		return detail::aabb_frustum_batch(Flat, Min.data(0), Min.capacity(), Max.data(0), Max.capacity(), Min.size(), Visible);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER bool intersectRaySphereBatch(vec<3, float, Q> const& Orig, vec<3, float, Q> const& Dir, vec3_soa const& Centers, vec1_soa const& Radii, std::size_t& Index, float& Distance)
+	{
+		assert(Radii.size() == Centers.size());
+		if(Centers.empty())
+			return false;
+		float const o[3] = {Orig.x, Orig.y, Orig.z};
+		float const d[3] = {Dir.x, Dir.y, Dir.z};
+		float t = 0.0f;
+		std::size_t const i = detail::ray_sphere_batch(o, d, Centers.data(0), Centers.capacity(), Radii.data(0), 1, Centers.size(), t);
+		if(i == Centers.size())
+			return false;
+		Index = i;
+		Distance = t;
+		return true;
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER bool intersectRaySphereBatch(vec<3, float, Q> const& Orig, vec<3, float, Q> const& Dir, vec3_soa const& Centers, float Radius, std::size_t& Index, float& Distance)
+	{
+		float const o[3] = {Orig.x, Orig.y, Orig.z};
+		float const d[3] = {Dir.x, Dir.y, Dir.z};
+		float t = 0.0f;
+		std::size_t const i = detail::ray_sphere_batch(o, d, Centers.data(0), Centers.capacity(), &Radius, 0, Centers.size(), t);
+		if(i == Centers.size())
+			return false;
+		Index = i;
+		Distance = t;
+		return true;
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER bool intersectRayTriangleBatch(vec<3, float, Q> const& Orig, vec<3, float, Q> const& Dir, vec3_soa const& V0, vec3_soa const& V1, vec3_soa const& V2, std::size_t& Index, vec<2, float, Q>& Bary, float& Distance)
+	{
+		assert(V0.size() == V1.size() && V0.size() == V2.size());
+
+		// Same axes and shear as intersectRayTriangleWatertight, applied once for every triangle
+		length_t const kz = abs(Dir.x) > abs(Dir.y) ? (abs(Dir.x) > abs(Dir.z) ? 0 : 2) : (abs(Dir.y) > abs(Dir.z) ? 1 : 2);
+		length_t kx = kz == 2 ? 0 : kz + 1;
+		length_t ky = kx == 2 ? 0 : kx + 1;
+		if(Dir[kz] < 0.0f)
+		{
+			length_t const Swap = kx;
+			kx = ky;
+			ky = Swap;
+		}
+
+		float const o[3] = {Orig[kx], Orig[ky], Orig[kz]};
+		float const S[3] = {Dir[kx] / Dir[kz], Dir[ky] / Dir[kz], 1.0f / Dir[kz]};
+		float const* const V[9] = {
+			V0.data(kx), V0.data(ky), V0.data(kz),
+			V1.data(kx), V1.data(ky), V1.data(kz),
+			V2.data(kx), V2.data(ky), V2.data(kz)};
+
+		float t = 0.0f;
+		std::size_t const i = detail::ray_triangle_batch(V, o, S, V0.size(), t);
+		if(i == V0.size())
+			return false;
+
+		float U, W1, W2, Det, T;
+		detail::ray_triangle(V, o, S, i, U, W1, W2, Det, T);
+		Index = i;
+		Bary = vec<2, float, Q>(W1, W2) / Det;
+		Distance = t;
+		return true;
+	}
+}//namespace glm
@@ -0,0 +1,87 @@
+/// @ref gtx_matrix_batch
+/// @file glm/gtx/matrix_batch.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_matrix_batch GLM_GTX_matrix_batch
+/// @ingroup gtx
+///
+/// Include <glm/gtx/matrix_batch.hpp> to use the features of this extension.
+///
+/// Products, inverses and vector transforms over arrays of 4x4 float matrices.
+/// On x86 the work is done by SSE2, AVX2 or AVX-512 kernels picked at runtime from what the CPU supports,
+/// independently of the instruction set the program is compiled for. Other architectures use a scalar loop.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/type_ptr.hpp"
+#include "../simd/matrix_batch.h"
+#include <cstring>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_matrix_batch is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#endif
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_matrix_batch extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_matrix_batch
+	/// @{
+
+	/// Instruction sets the batch functions can run on.
+	enum batch_instruction_set
+	{
+		BATCH_SCALAR = GLM_BATCH_ISA_SCALAR,
+		BATCH_SSE2 = GLM_BATCH_ISA_SSE2,
+		BATCH_AVX2 = GLM_BATCH_ISA_AVX2,
+		BATCH_AVX512 = GLM_BATCH_ISA_AVX512
+	};
+
+	/// Instruction set the batch functions currently use. Defaults to the best one the CPU supports.
+	/// From GLM_GTX_matrix_batch extension.
+	GLM_FUNC_DECL batch_instruction_set batchInstructionSet();
+
+	/// Restricts the batch functions to an instruction set, to compare the code paths.
+	/// Requests above what the CPU supports are lowered. Returns the instruction set actually used.
+	/// From GLM_GTX_matrix_batch extension.
+	GLM_FUNC_DECL batch_instruction_set setBatchInstructionSet(batch_instruction_set Set);
+
+	/// Out[i] = A[i] * B[i] for i in [0, Count).
+	/// Out may alias A or B.
+	/// From GLM_GTX_matrix_batch extension.
+	template<qualifier Q>
+	GLM_FUNC_DECL void mulBatch(mat<4, 4, float, Q> const* A, mat<4, 4, float, Q> const* B, mat<4, 4, float, Q>* Out, std::size_t Count);
+
+	/// Out[i] = A * B[i] for i in [0, Count), e.g. a view-projection matrix times every model matrix.
+	/// Out may alias B.
+	/// From GLM_GTX_matrix_batch extension.
+	template<qualifier Q>
+	GLM_FUNC_DECL void mulBatch(mat<4, 4, float, Q> const& A, mat<4, 4, float, Q> const* B, mat<4, 4, float, Q>* Out, std::size_t Count);
+
+	/// Out[i] = inverse(In[i]) for i in [0, Count).
+	/// Out may alias In.
+	/// From GLM_GTX_matrix_batch extension.
+	template<qualifier Q>
+	GLM_FUNC_DECL void inverseBatch(mat<4, 4, float, Q> const* In, mat<4, 4, float, Q>* Out, std::size_t Count);
+
+	/// Out[i] = M * In[i] for i in [0, Count).
+	/// Out may alias In.
+	/// From GLM_GTX_matrix_batch extension.
+	template<qualifier Q>
+	GLM_FUNC_DECL void transformBatch(mat<4, 4, float, Q> const& M, vec<4, float, Q> const* In, vec<4, float, Q>* Out, std::size_t Count);
+
+	/// Out[i] = M[i] * In[i] for i in [0, Count).
+	/// Out may alias In.
+	/// From GLM_GTX_matrix_batch extension.
+	template<qualifier Q>
+	GLM_FUNC_DECL void transformBatch(mat<4, 4, float, Q> const* M, vec<4, float, Q> const* In, vec<4, float, Q>* Out, std::size_t Count);
+
+	/// @}
+}//namespace glm
+
+#include "matrix_batch.inl"
@@ -0,0 +1,125 @@
+/// @ref gtx_matrix_batch
+
+namespace glm{
+namespace detail
+{
+	// Every kernel reads its whole input before writing an output, so Out can alias the inputs.
+	GLM_FUNC_QUALIFIER void mat4_mul_batch(float const* A, std::size_t StrideA, float const* B, float* Out, std::size_t Count)
+	{
+#		if GLM_BATCH_X86
+			switch(batch_current_isa())
+			{
+			case GLM_BATCH_ISA_AVX512:
+				glm_mat4_mul_batch_avx512(A, StrideA, B, Out, Count);
+				return;
+			case GLM_BATCH_ISA_AVX2:
+				glm_mat4_mul_batch_avx2(A, StrideA, B, Out, Count);
+				return;
+			case GLM_BATCH_ISA_SSE2:
+				glm_mat4_mul_batch_sse2(A, StrideA, B, Out, Count);
+				return;
+			}
+#		endif
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			mat<4, 4, float, defaultp> const a = make_mat4(A + i * StrideA);
+			mat<4, 4, float, defaultp> const b = make_mat4(B + i * 16);
+			mat<4, 4, float, defaultp> const o = a * b;
+			memcpy(Out + i * 16, &o[0][0], sizeof(o));
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void mat4_inverse_batch(float const* In, float* Out, std::size_t Count)
+	{
+#		if GLM_BATCH_X86
+			switch(batch_current_isa())
+			{
+			case GLM_BATCH_ISA_AVX512:
+				glm_mat4_inverse_batch_avx512(In, Out, Count);
+				return;
+			case GLM_BATCH_ISA_AVX2:
+				glm_mat4_inverse_batch_avx2(In, Out, Count);
+				return;
+			case GLM_BATCH_ISA_SSE2:
+				glm_mat4_inverse_batch_sse2(In, Out, Count);
+				return;
+			}
+#		endif
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			mat<4, 4, float, defaultp> const o = inverse(make_mat4(In + i * 16));
+			memcpy(Out + i * 16, &o[0][0], sizeof(o));
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void mat4_mul_vec4_batch(float const* M, std::size_t StrideM, float const* In, float* Out, std::size_t Count)
+	{
+#		if GLM_BATCH_X86
+			switch(batch_current_isa())
+			{
+			case GLM_BATCH_ISA_AVX512:
+				glm_mat4_mul_vec4_batch_avx512(M, StrideM, In, Out, Count);
+				return;
+			case GLM_BATCH_ISA_AVX2:
+				glm_mat4_mul_vec4_batch_avx2(M, StrideM, In, Out, Count);
+				return;
+			case GLM_BATCH_ISA_SSE2:
+				glm_mat4_mul_vec4_batch_sse2(M, StrideM, In, Out, Count);
+				return;
+			}
+#		endif
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			vec<4, float, defaultp> v;
+			memcpy(&v[0], In + i * 4, sizeof(v));
+			vec<4, float, defaultp> const o = make_mat4(M + i * StrideM) * v;
+			memcpy(Out + i * 4, &o[0], sizeof(o));
+		}
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER batch_instruction_set batchInstructionSet()
+	{
+		return static_cast<batch_instruction_set>(detail::batch_current_isa());
+	}
+
+	GLM_FUNC_QUALIFIER batch_instruction_set setBatchInstructionSet(batch_instruction_set Set)
+	{
+		int const Supported = detail::batch_supported_isa();
+		detail::batch_current_isa() = static_cast<int>(Set) < Supported ? static_cast<int>(Set) : Supported;
+		return batchInstructionSet();
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void mulBatch(mat<4, 4, float, Q> const* A, mat<4, 4, float, Q> const* B, mat<4, 4, float, Q>* Out, std::size_t Count)
+	{
+		detail::mat4_mul_batch(reinterpret_cast<float const*>(A), 16, reinterpret_cast<float const*>(B), reinterpret_cast<float*>(Out), Count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void mulBatch(mat<4, 4, float, Q> const& A, mat<4, 4, float, Q> const* B, mat<4, 4, float, Q>* Out, std::size_t Count)
+	{
+		detail::mat4_mul_batch(&A[0][0], 0, reinterpret_cast<float const*>(B), reinterpret_cast<float*>(Out), Count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void inverseBatch(mat<4, 4, float, Q> const* In, mat<4, 4, float, Q>* Out, std::size_t Count)
+	{
+		detail::mat4_inverse_batch(reinterpret_cast<float const*>(In), reinterpret_cast<float*>(Out), Count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void transformBatch(mat<4, 4, float, Q> const& M, vec<4, float, Q> const* In, vec<4, float, Q>* Out, std::size_t Count)
+	{
+		detail::mat4_mul_vec4_batch(&M[0][0], 0, reinterpret_cast<float const*>(In), reinterpret_cast<float*>(Out), Count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void transformBatch(mat<4, 4, float, Q> const* M, vec<4, float, Q> const* In, vec<4, float, Q>* Out, std::size_t Count)
+	{
+		detail::mat4_mul_vec4_batch(reinterpret_cast<float const*>(M), 16, reinterpret_cast<float const*>(In), reinterpret_cast<float*>(Out), Count);
+	}
+}//namespace glm
@@ -0,0 +1,96 @@
+/// @ref gtx_noise_batch
+/// @file glm/gtx/noise_batch.hpp
+///
+/// @see core (dependence)
+/// @see gtc_noise (dependence)
+/// @see gtx_matrix_batch (dependence)
+///
+/// @defgroup gtx_noise_batch GLM_GTX_noise_batch
+/// @ingroup gtx
+///
+/// Include <glm/gtx/noise_batch.hpp> to use the features of this extension.
+///
+/// The perlin and simplex noises of GLM_GTC_noise over many points at once, their fractal sums (fBm and
+/// ridged) and images of them computed on several threads. x86 evaluates 4 samples per instruction with SSE2
+/// and 8 with AVX2, picked at runtime like GLM_GTX_matrix_batch. Other architectures use a scalar loop.
+/// Only float points are supported.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/noise.hpp"
+#include "matrix_batch.hpp"
+#include "../simd/noise_batch.h"
+#include <cstddef>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_noise_batch is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#endif
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_noise_batch extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_noise_batch
+	/// @{
+
+	/// Noise summed by the fractal functions.
+	enum noise_basis
+	{
+		NOISE_PERLIN,
+		NOISE_SIMPLEX
+	};
+
+	/// Fractional Brownian motion: sum over k < Octaves of Gain^k * noise(p * Lacunarity^k).
+	/// One octave gives perlin(p) or simplex(p).
+	/// From GLM_GTX_noise_batch extension.
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL T fbm(vec<L, T, Q> const& p, noise_basis Basis, int Octaves, T Lacunarity = static_cast<T>(2), T Gain = static_cast<T>(0.5));
+
+	/// Ridged noise: sum over k < Octaves of Gain^k * (1 - |noise(p * Lacunarity^k)|)^2.
+	/// From GLM_GTX_noise_batch extension.
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL T ridged(vec<L, T, Q> const& p, noise_basis Basis, int Octaves, T Lacunarity = static_cast<T>(2), T Gain = static_cast<T>(0.5));
+
+	/// Out[i] = perlin(In[i]) for Count points.
+	/// From GLM_GTX_noise_batch extension.
+	template<length_t L, qualifier Q>
+	GLM_FUNC_DECL void perlinBatch(vec<L, float, Q> const* In, float* Out, std::size_t Count);
+
+	/// Out[i] = simplex(In[i]) for Count points.
+	/// From GLM_GTX_noise_batch extension.
+	template<length_t L, qualifier Q>
+	GLM_FUNC_DECL void simplexBatch(vec<L, float, Q> const* In, float* Out, std::size_t Count);
+
+	/// Out[i] = fbm(In[i], Basis, Octaves, Lacunarity, Gain) for Count points.
+	/// From GLM_GTX_noise_batch extension.
+	template<length_t L, qualifier Q>
+	GLM_FUNC_DECL void fbmBatch(vec<L, float, Q> const* In, float* Out, std::size_t Count, noise_basis Basis, int Octaves, float Lacunarity = 2.0f, float Gain = 0.5f);
+
+	/// Out[i] = ridged(In[i], Basis, Octaves, Lacunarity, Gain) for Count points.
+	/// From GLM_GTX_noise_batch extension.
+	template<length_t L, qualifier Q>
+	GLM_FUNC_DECL void ridgedBatch(vec<L, float, Q> const* In, float* Out, std::size_t Count, noise_basis Basis, int Octaves, float Lacunarity = 2.0f, float Gain = 0.5f);
+
+	/// Fills a Width x Height image, Out[y * Width + x] = fbm(Origin + DeltaX * x + DeltaY * y, ...).
+	/// The image is a plane of the noise space, e.g. a texture from 2D noise or a slice of 3D noise animated along z.
+	/// Bands of rows are handed out to Threads threads, 0 uses every hardware thread.
+	/// Without C++11 threads the calling thread computes the whole image.
+	/// From GLM_GTX_noise_batch extension.
+	template<length_t L, qualifier Q>
+	GLM_FUNC_DECL void fbmImage(float* Out, std::size_t Width, std::size_t Height, vec<L, float, Q> const& Origin, vec<L, float, Q> const& DeltaX, vec<L, float, Q> const& DeltaY,
+		noise_basis Basis, int Octaves, float Lacunarity = 2.0f, float Gain = 0.5f, unsigned int Threads = 0);
+
+	/// Same as fbmImage with the ridged sum.
+	/// From GLM_GTX_noise_batch extension.
+	template<length_t L, qualifier Q>
+	GLM_FUNC_DECL void ridgedImage(float* Out, std::size_t Width, std::size_t Height, vec<L, float, Q> const& Origin, vec<L, float, Q> const& DeltaX, vec<L, float, Q> const& DeltaY,
+		noise_basis Basis, int Octaves, float Lacunarity = 2.0f, float Gain = 0.5f, unsigned int Threads = 0);
+
+	/// @}
+}//namespace glm
+
+#include "noise_batch.inl"
@@ -0,0 +1,181 @@
+/// @ref gtx_noise_batch
+
+#if GLM_HAS_CXX11_STL
+#	include <atomic>
+#	include <thread>
+#	include <vector>
+#endif
+
+namespace glm{
+namespace detail
+{
+	template<length_t L, qualifier Q>
+	GLM_FUNC_QUALIFIER float noise_fractal_scalar(vec<L, float, Q> const& p, noise_fractal const& Fractal)
+	{
+		noise_basis const Basis = static_cast<noise_basis>(Fractal.Basis);
+		return Fractal.Ridged ?
+			ridged(p, Basis, Fractal.Octaves, Fractal.Lacunarity, Fractal.Gain) :
+			fbm(p, Basis, Fractal.Octaves, Fractal.Lacunarity, Fractal.Gain);
+	}
+
+	template<length_t L, qualifier Q>
+	GLM_FUNC_QUALIFIER void noise_batch(vec<L, float, Q> const* In, float* Out, std::size_t Count, noise_fractal const& Fractal)
+	{
+#		if GLM_BATCH_X86
+			// Aligned vec3 are padded to 4 floats.
+			std::size_t const Stride = sizeof(vec<L, float, Q>) / sizeof(float);
+			switch(batch_current_isa())
+			{
+			case GLM_BATCH_ISA_AVX512:
+			case GLM_BATCH_ISA_AVX2:
+				glm_noise_batch_avx2<L>(&In[0][0], Stride, Out, Count, Fractal);
+				return;
+			case GLM_BATCH_ISA_SSE2:
+				glm_noise_batch_sse2<L>(&In[0][0], Stride, Out, Count, Fractal);
+				return;
+			}
+#		endif
+
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = noise_fractal_scalar(In[i], Fractal);
+	}
+
+	// Rows [Row, Row + Rows) of the image.
+	template<length_t L>
+	GLM_FUNC_QUALIFIER void noise_rows(float* Out, std::size_t Width, std::size_t Row, std::size_t Rows, vec<L, float, defaultp> const& Origin, vec<L, float, defaultp> const& DeltaX, vec<L, float, defaultp> const& DeltaY, noise_fractal const& Fractal)
+	{
+#		if GLM_BATCH_X86
+			switch(batch_current_isa())
+			{
+			case GLM_BATCH_ISA_AVX512:
+			case GLM_BATCH_ISA_AVX2:
+				glm_noise_grid_avx2<L>(Out, Width, Row, Rows, &Origin[0], &DeltaX[0], &DeltaY[0], Fractal);
+				return;
+			case GLM_BATCH_ISA_SSE2:
+				glm_noise_grid_sse2<L>(Out, Width, Row, Rows, &Origin[0], &DeltaX[0], &DeltaY[0], Fractal);
+				return;
+			}
+#		endif
+
+		for(std::size_t y = Row; y < Row + Rows; ++y)
+		for(std::size_t x = 0; x < Width; ++x)
+			Out[y * Width + x] = noise_fractal_scalar(Origin + DeltaX * static_cast<float>(x) + DeltaY * static_cast<float>(y), Fractal);
+	}
+
+	template<length_t L, qualifier Q>
+	GLM_FUNC_QUALIFIER void noise_image(float* Out, std::size_t Width, std::size_t Height, vec<L, float, Q> const& Origin, vec<L, float, Q> const& DeltaX, vec<L, float, Q> const& DeltaY, noise_fractal const& Fractal, unsigned int Threads)
+	{
+		if(Width == 0 || Height == 0)
+			return;
+
+		vec<L, float, defaultp> const o(Origin), dx(DeltaX), dy(DeltaY);
+
+#		if GLM_HAS_CXX11_STL
+			// Bands of about 4096 samples, small enough to balance the threads, large enough to amortize the hand out.
+			std::size_t const BandRows = Width < 4096 ? 4096 / Width : 1;
+			std::size_t const Bands = (Height + BandRows - 1) / BandRows;
+
+			if(Threads == 0)
+				Threads = std::thread::hardware_concurrency();
+			std::size_t const Workers = Threads == 0 ? 1 : (Threads < Bands ? Threads : Bands);
+
+			std::atomic<std::size_t> Next(0);
+			auto Work = [&]()
+			{
+				for(std::size_t Band = Next++; Band < Bands; Band = Next++)
+				{
+					std::size_t const Row = Band * BandRows;
+					noise_rows<L>(Out, Width, Row, Height - Row < BandRows ? Height - Row : BandRows, o, dx, dy, Fractal);
+				}
+			};
+
+			std::vector<std::thread> Pool;
+			Pool.reserve(Workers - 1);
+			for(std::size_t k = 1; k < Workers; ++k)
+				Pool.emplace_back(Work);
+			Work();
+			for(std::size_t k = 0; k < Pool.size(); ++k)
+				Pool[k].join();
+#		else
+			static_cast<void>(Threads);
+			noise_rows<L>(Out, Width, 0, Height, o, dx, dy, Fractal);
+#		endif
+	}
+}//namespace detail
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER T fbm(vec<L, T, Q> const& p, noise_basis Basis, int Octaves, T Lacunarity, T Gain)
+	{
+		T Sum(0);
+		T Amplitude(1);
+		T Frequency(1);
+		for(int o = 0; o < Octaves; ++o)
+		{
+			T const n = Basis == NOISE_SIMPLEX ? simplex(p * Frequency) : perlin(p * Frequency);
+			Sum += Amplitude * n;
+			Amplitude *= Gain;
+			Frequency *= Lacunarity;
+		}
+		return Sum;
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER T ridged(vec<L, T, Q> const& p, noise_basis Basis, int Octaves, T Lacunarity, T Gain)
+	{
+		T Sum(0);
+		T Amplitude(1);
+		T Frequency(1);
+		for(int o = 0; o < Octaves; ++o)
+		{
+			T const r = static_cast<T>(1) - abs(Basis == NOISE_SIMPLEX ? simplex(p * Frequency) : perlin(p * Frequency));
+			Sum += Amplitude * (r * r);
+			Amplitude *= Gain;
+			Frequency *= Lacunarity;
+		}
+		return Sum;
+	}
+
+	template<length_t L, qualifier Q>
+	GLM_FUNC_QUALIFIER void perlinBatch(vec<L, float, Q> const* In, float* Out, std::size_t Count)
+	{
+		detail::noise_fractal const Fractal = {NOISE_PERLIN, false, 1, 1.0f, 1.0f};
+		detail::noise_batch(In, Out, Count, Fractal);
+	}
+
+	template<length_t L, qualifier Q>
+	GLM_FUNC_QUALIFIER void simplexBatch(vec<L, float, Q> const* In, float* Out, std::size_t Count)
+	{
+		detail::noise_fractal const Fractal = {NOISE_SIMPLEX, false, 1, 1.0f, 1.0f};
+		detail::noise_batch(In, Out, Count, Fractal);
+	}
+
+	template<length_t L, qualifier Q>
+	GLM_FUNC_QUALIFIER void fbmBatch(vec<L, float, Q> const* In, float* Out, std::size_t Count, noise_basis Basis, int Octaves, float Lacunarity, float Gain)
+	{
+		detail::noise_fractal const Fractal = {Basis, false, Octaves, Lacunarity, Gain};
+		detail::noise_batch(In, Out, Count, Fractal);
+	}
+
+	template<length_t L, qualifier Q>
+	GLM_FUNC_QUALIFIER void ridgedBatch(vec<L, float, Q> const* In, float* Out, std::size_t Count, noise_basis Basis, int Octaves, float Lacunarity, float Gain)
+	{
+		detail::noise_fractal const Fractal = {Basis, true, Octaves, Lacunarity, Gain};
+		detail::noise_batch(In, Out, Count, Fractal);
+	}
+
+	template<length_t L, qualifier Q>
+	GLM_FUNC_QUALIFIER void fbmImage(float* Out, std::size_t Width, std::size_t Height, vec<L, float, Q> const& Origin, vec<L, float, Q> const& DeltaX, vec<L, float, Q> const& DeltaY,
+		noise_basis Basis, int Octaves, float Lacunarity, float Gain, unsigned int Threads)
+	{
+		detail::noise_fractal const Fractal = {Basis, false, Octaves, Lacunarity, Gain};
+		detail::noise_image(Out, Width, Height, Origin, DeltaX, DeltaY, Fractal, Threads);
+	}
+
+	template<length_t L, qualifier Q>
+	GLM_FUNC_QUALIFIER void ridgedImage(float* Out, std::size_t Width, std::size_t Height, vec<L, float, Q> const& Origin, vec<L, float, Q> const& DeltaX, vec<L, float, Q> const& DeltaY,
+		noise_basis Basis, int Octaves, float Lacunarity, float Gain, unsigned int Threads)
+	{
+		detail::noise_fractal const Fractal = {Basis, true, Octaves, Lacunarity, Gain};
+		detail::noise_image(Out, Width, Height, Origin, DeltaX, DeltaY, Fractal, Threads);
+	}
+}//namespace glm
@@ -0,0 +1,93 @@
+/// @ref gtx_quaternion_batch
+/// @file glm/gtx/quaternion_batch.hpp
+///
+/// @see core (dependence)
+/// @see gtx_matrix_batch (dependence)
+/// @see gtx_dual_quaternion (dependence)
+///
+/// @defgroup gtx_quaternion_batch GLM_GTX_quaternion_batch
+/// @ingroup gtx
+///
+/// Include <glm/gtx/quaternion_batch.hpp> to use the features of this extension.
+///
+/// Products, interpolations and matrix conversions over arrays of float quaternions, and dual quaternion
+/// blending for skinning. Like GLM_GTX_matrix_batch, x86 runs SSE2 or AVX2 kernels picked at runtime and
+/// setBatchInstructionSet applies to both extensions. Other architectures use a scalar loop.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/quaternion.hpp"
+#include "../ext/quaternion_common.hpp"
+#include "matrix_batch.hpp"
+#include "dual_quaternion.hpp"
+#include "../simd/quaternion_batch.h"
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_quaternion_batch is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#endif
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_quaternion_batch extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_quaternion_batch
+	/// @{
+
+	/// Out[i] = A[i] * B[i] for i in [0, Count).
+	/// Out may alias A or B.
+	/// From GLM_GTX_quaternion_batch extension.
+	template<qualifier Q>
+	GLM_FUNC_DECL void mulBatch(qua<float, Q> const* A, qua<float, Q> const* B, qua<float, Q>* Out, std::size_t Count);
+
+	/// Out[i] = slerp(A[i], B[i], a) for i in [0, Count), taking the shortest path like glm::slerp.
+	/// The angle goes through polynomial approximations, the results are within 1e-6 of glm::slerp for unit quaternions.
+	/// Out may alias A or B.
+	/// From GLM_GTX_quaternion_batch extension.
+	template<qualifier Q>
+	GLM_FUNC_DECL void slerpBatch(qua<float, Q> const* A, qua<float, Q> const* B, float a, qua<float, Q>* Out, std::size_t Count);
+
+	/// Out[i] = slerp(A[i], B[i], a[i]) for i in [0, Count).
+	/// @see slerpBatch
+	template<qualifier Q>
+	GLM_FUNC_DECL void slerpBatch(qua<float, Q> const* A, qua<float, Q> const* B, float const* a, qua<float, Q>* Out, std::size_t Count);
+
+	/// Out[i] = normalize(lerp(A[i], B[i], a)) for i in [0, Count), with B[i] negated when dot(A[i], B[i]) < 0.
+	/// Cheaper than slerpBatch and usually enough to blend animation keys.
+	/// Out may alias A or B.
+	/// From GLM_GTX_quaternion_batch extension.
+	template<qualifier Q>
+	GLM_FUNC_DECL void nlerpBatch(qua<float, Q> const* A, qua<float, Q> const* B, float a, qua<float, Q>* Out, std::size_t Count);
+
+	/// Out[i] = normalize(lerp(A[i], B[i], a[i])) for i in [0, Count).
+	/// @see nlerpBatch
+	template<qualifier Q>
+	GLM_FUNC_DECL void nlerpBatch(qua<float, Q> const* A, qua<float, Q> const* B, float const* a, qua<float, Q>* Out, std::size_t Count);
+
+	/// Converts the unit quaternions In[i] to 3x4 rotation matrices for i in [0, Count).
+	/// Out[i][r] is row r of mat3_cast(In[i]), with a zero fourth component: the layout mat3x4_cast gives for dual quaternions,
+	/// ready to upload as instance transforms.
+	/// From GLM_GTX_quaternion_batch extension.
+	template<qualifier Q>
+	GLM_FUNC_DECL void mat3x4CastBatch(qua<float, Q> const* In, mat<3, 4, float, Q>* Out, std::size_t Count);
+
+	/// Same as mat3x4CastBatch with Translation[i] stored in the fourth component of the rows.
+	/// From GLM_GTX_quaternion_batch extension.
+	template<qualifier Q>
+	GLM_FUNC_DECL void mat3x4CastBatch(qua<float, Q> const* In, vec<3, float, Q> const* Translation, mat<3, 4, float, Q>* Out, std::size_t Count);
+
+	/// Dual quaternion linear blending of Count vertices, each with Influences bones.
+	/// Vertex i blends Bones[Indices[i * Influences + k]] weighted by Weights[i * Influences + k],
+	/// flipping bones to the hemisphere of its first influence, and normalizes the sum.
+	/// Bones must be unit dual quaternions. Out must not alias Bones.
+	/// From GLM_GTX_quaternion_batch extension.
+	template<qualifier Q>
+	GLM_FUNC_DECL void dualQuatBlendBatch(tdualquat<float, Q> const* Bones, uint const* Indices, float const* Weights, std::size_t Influences, tdualquat<float, Q>* Out, std::size_t Count);
+
+	/// @}
+}//namespace glm
+
+#include "quaternion_batch.inl"
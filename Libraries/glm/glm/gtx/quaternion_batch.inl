@@ -0,0 +1,196 @@
+/// @ref gtx_quaternion_batch
+
+namespace glm{
+namespace detail
+{
+	GLM_FUNC_QUALIFIER qua<float, defaultp> make_quat_batch(float const* q)
+	{
+		return qua<float, defaultp>(q[3], q[0], q[1], q[2]);
+	}
+
+	GLM_FUNC_QUALIFIER void store_quat_batch(qua<float, defaultp> const& q, float* Out)
+	{
+		Out[0] = q.x;
+		Out[1] = q.y;
+		Out[2] = q.z;
+		Out[3] = q.w;
+	}
+
+	// The AVX-512 kernels of GLM_GTX_matrix_batch gain nothing on four component quaternions, AVX2 is used instead.
+	GLM_FUNC_QUALIFIER void quat_mul_batch(float const* A, float const* B, float* Out, std::size_t Count)
+	{
+#		if GLM_BATCH_X86
+			switch(batch_current_isa())
+			{
+			case GLM_BATCH_ISA_AVX512:
+			case GLM_BATCH_ISA_AVX2:
+				glm_quat_mul_batch_avx2(A, B, Out, Count);
+				return;
+			case GLM_BATCH_ISA_SSE2:
+				glm_quat_mul_batch_sse2(A, B, Out, Count);
+				return;
+			}
+#		endif
+
+		for(std::size_t i = 0; i < Count; ++i)
+			store_quat_batch(make_quat_batch(A + i * 4) * make_quat_batch(B + i * 4), Out + i * 4);
+	}
+
+	GLM_FUNC_QUALIFIER void quat_nlerp_batch(float const* A, float const* B, float const* T, std::size_t StrideT, float* Out, std::size_t Count)
+	{
+#		if GLM_BATCH_X86
+			switch(batch_current_isa())
+			{
+			case GLM_BATCH_ISA_AVX512:
+			case GLM_BATCH_ISA_AVX2:
+				glm_quat_nlerp_batch_avx2(A, B, T, StrideT, Out, Count);
+				return;
+			case GLM_BATCH_ISA_SSE2:
+				glm_quat_nlerp_batch_sse2(A, B, T, StrideT, Out, Count);
+				return;
+			}
+#		endif
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			qua<float, defaultp> const a = make_quat_batch(A + i * 4);
+			qua<float, defaultp> const b = make_quat_batch(B + i * 4);
+			store_quat_batch(normalize(lerp(a, dot(a, b) < 0.0f ? -b : b, T[i * StrideT])), Out + i * 4);
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void quat_slerp_batch(float const* A, float const* B, float const* T, std::size_t StrideT, float* Out, std::size_t Count)
+	{
+#		if GLM_BATCH_X86
+			switch(batch_current_isa())
+			{
+			case GLM_BATCH_ISA_AVX512:
+			case GLM_BATCH_ISA_AVX2:
+				glm_quat_slerp_batch_avx2(A, B, T, StrideT, Out, Count);
+				return;
+			case GLM_BATCH_ISA_SSE2:
+				glm_quat_slerp_batch_sse2(A, B, T, StrideT, Out, Count);
+				return;
+			}
+#		endif
+
+		for(std::size_t i = 0; i < Count; ++i)
+			store_quat_batch(slerp(make_quat_batch(A + i * 4), make_quat_batch(B + i * 4), T[i * StrideT]), Out + i * 4);
+	}
+
+	GLM_FUNC_QUALIFIER void quat_to_mat3x4_batch(float const* In, float const* Translation, std::size_t StrideT, float* Out, std::size_t Count)
+	{
+#		if GLM_BATCH_X86
+			switch(batch_current_isa())
+			{
+			case GLM_BATCH_ISA_AVX512:
+			case GLM_BATCH_ISA_AVX2:
+				glm_quat_to_mat3x4_batch_avx2(In, Translation, StrideT, Out, Count);
+				return;
+			case GLM_BATCH_ISA_SSE2:
+				glm_quat_to_mat3x4_batch_sse2(In, Translation, StrideT, Out, Count);
+				return;
+			}
+#		endif
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			mat<3, 3, float, defaultp> const m = mat3_cast(make_quat_batch(In + i * 4));
+			for(length_t r = 0; r < 3; ++r)
+			{
+				float* Row = Out + i * 12 + r * 4;
+				Row[0] = m[0][r];
+				Row[1] = m[1][r];
+				Row[2] = m[2][r];
+				Row[3] = Translation ? Translation[i * StrideT + r] : 0.0f;
+			}
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void dualquat_blend_batch(float const* Bones, uint const* Indices, float const* Weights, std::size_t Influences, float* Out, std::size_t Count)
+	{
+		if(Influences == 0)
+			return;
+
+#		if GLM_BATCH_X86
+			switch(batch_current_isa())
+			{
+			case GLM_BATCH_ISA_AVX512:
+			case GLM_BATCH_ISA_AVX2:
+				glm_dualquat_blend_batch_avx2(Bones, Indices, Weights, Influences, Out, Count);
+				return;
+			case GLM_BATCH_ISA_SSE2:
+				glm_dualquat_blend_batch_sse2(Bones, Indices, Weights, Influences, Out, Count);
+				return;
+			}
+#		endif
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			uint const* Index = Indices + i * Influences;
+			float const* Weight = Weights + i * Influences;
+			qua<float, defaultp> const First = make_quat_batch(Bones + Index[0] * 8);
+			qua<float, defaultp> Real(0.0f, 0.0f, 0.0f, 0.0f);
+			qua<float, defaultp> Dual(0.0f, 0.0f, 0.0f, 0.0f);
+			for(std::size_t k = 0; k < Influences; ++k)
+			{
+				qua<float, defaultp> const r = make_quat_batch(Bones + Index[k] * 8);
+				float const w = dot(First, r) < 0.0f ? -Weight[k] : Weight[k];
+				Real = Real + r * w;
+				Dual = Dual + make_quat_batch(Bones + Index[k] * 8 + 4) * w;
+			}
+			float const InvLength = 1.0f / length(Real);
+			store_quat_batch(Real * InvLength, Out + i * 8);
+			store_quat_batch(Dual * InvLength, Out + i * 8 + 4);
+		}
+	}
+}//namespace detail
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void mulBatch(qua<float, Q> const* A, qua<float, Q> const* B, qua<float, Q>* Out, std::size_t Count)
+	{
+		detail::quat_mul_batch(reinterpret_cast<float const*>(A), reinterpret_cast<float const*>(B), reinterpret_cast<float*>(Out), Count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void slerpBatch(qua<float, Q> const* A, qua<float, Q> const* B, float a, qua<float, Q>* Out, std::size_t Count)
+	{
+		detail::quat_slerp_batch(reinterpret_cast<float const*>(A), reinterpret_cast<float const*>(B), &a, 0, reinterpret_cast<float*>(Out), Count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void slerpBatch(qua<float, Q> const* A, qua<float, Q> const* B, float const* a, qua<float, Q>* Out, std::size_t Count)
+	{
+		detail::quat_slerp_batch(reinterpret_cast<float const*>(A), reinterpret_cast<float const*>(B), a, 1, reinterpret_cast<float*>(Out), Count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void nlerpBatch(qua<float, Q> const* A, qua<float, Q> const* B, float a, qua<float, Q>* Out, std::size_t Count)
+	{
+		detail::quat_nlerp_batch(reinterpret_cast<float const*>(A), reinterpret_cast<float const*>(B), &a, 0, reinterpret_cast<float*>(Out), Count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void nlerpBatch(qua<float, Q> const* A, qua<float, Q> const* B, float const* a, qua<float, Q>* Out, std::size_t Count)
+	{
+		detail::quat_nlerp_batch(reinterpret_cast<float const*>(A), reinterpret_cast<float const*>(B), a, 1, reinterpret_cast<float*>(Out), Count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void mat3x4CastBatch(qua<float, Q> const* In, mat<3, 4, float, Q>* Out, std::size_t Count)
+	{
+		detail::quat_to_mat3x4_batch(reinterpret_cast<float const*>(In), NULL, 0, reinterpret_cast<float*>(Out), Count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void mat3x4CastBatch(qua<float, Q> const* In, vec<3, float, Q> const* Translation, mat<3, 4, float, Q>* Out, std::size_t Count)
+	{
+		detail::quat_to_mat3x4_batch(reinterpret_cast<float const*>(In), reinterpret_cast<float const*>(Translation), sizeof(vec<3, float, Q>) / sizeof(float), reinterpret_cast<float*>(Out), Count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void dualQuatBlendBatch(tdualquat<float, Q> const* Bones, uint const* Indices, float const* Weights, std::size_t Influences, tdualquat<float, Q>* Out, std::size_t Count)
+	{
+		detail::dualquat_blend_batch(reinterpret_cast<float const*>(Bones), Indices, Weights, Influences, reinterpret_cast<float*>(Out), Count);
+	}
+}//namespace glm
@@ -0,0 +1,187 @@
+/// @ref gtx_soa
+/// @file glm/gtx/soa.hpp
+///
+/// @see core (dependence)
+/// @see gtx_matrix_batch (dependence)
+///
+/// @defgroup gtx_soa GLM_GTX_soa
+/// @ingroup gtx
+///
+/// Include <glm/gtx/soa.hpp> to use the features of this extension.
+///
+/// Structure of arrays containers for float vectors and 4x4 matrices, and bulk operations on them.
+/// Each component lives in its own stream, aligned to 64 bytes and padded to a multiple of 16 floats, so a
+/// SIMD register always holds the same component of consecutive elements and no operation needs a tail loop.
+/// Like GLM_GTX_matrix_batch, x86 runs SSE2 or AVX2 kernels picked at runtime and setBatchInstructionSet
+/// applies. Other architectures use a scalar loop.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../ext/vector_float1.hpp"
+#include "matrix_batch.hpp"
+#include "../simd/soa_batch.h"
+#include <cstddef>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_soa is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#endif
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_soa extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_soa
+	/// @{
+
+namespace detail
+{
+	// N streams of floats sharing one allocation.
+	template<length_t N>
+	class soa_storage
+	{
+	public:
+		/// Floats every stream is padded to, enough for the widest kernel.
+		static std::size_t const padding = 16;
+
+		soa_storage();
+		explicit soa_storage(std::size_t Size);
+		soa_storage(soa_storage const& Other);
+		~soa_storage();
+		soa_storage& operator=(soa_storage const& Other);
+
+		/// Number of elements.
+		std::size_t size() const { return Size; }
+		bool empty() const { return Size == 0; }
+
+		/// Number of floats in each stream, a multiple of padding. Also the distance between two streams.
+		std::size_t capacity() const { return Capacity; }
+
+		/// Size rounded up to padding, the number of elements the kernels process.
+		std::size_t padded_size() const { return (Size + padding - 1) / padding * padding; }
+
+		/// Elements past the previous size are zero. Values in the padding past size() are unspecified.
+		void resize(std::size_t NewSize);
+		void reserve(std::size_t NewCapacity);
+		void clear() { Size = 0; }
+		void swap(soa_storage& Other);
+
+		/// Stream of one component, 64 byte aligned, readable and writable up to capacity().
+		float* data(length_t Component) { return Data + Component * Capacity; }
+		float const* data(length_t Component) const { return Data + Component * Capacity; }
+
+	protected:
+		float* Data;
+		void* Allocation;
+		std::size_t Size;
+		std::size_t Capacity;
+	};
+}//namespace detail
+
+	/// L component float vectors stored as L streams: x values, then y values, and so on.
+	template<length_t L>
+	class vec_soa : public detail::soa_storage<L>
+	{
+	public:
+		typedef vec<L, float, defaultp> value_type;
+
+		vec_soa() {}
+		explicit vec_soa(std::size_t Size) : detail::soa_storage<L>(Size) {}
+
+		value_type get(std::size_t i) const;
+		void set(std::size_t i, value_type const& v);
+		void push_back(value_type const& v);
+	};
+
+	typedef vec_soa<1> vec1_soa;
+	typedef vec_soa<2> vec2_soa;
+	typedef vec_soa<3> vec3_soa;
+	typedef vec_soa<4> vec4_soa;
+
+	/// Column major 4x4 float matrices stored as 16 streams, element (Column, Row) of every matrix in one stream.
+	class mat4_soa : public detail::soa_storage<16>
+	{
+	public:
+		typedef mat<4, 4, float, defaultp> value_type;
+
+		mat4_soa() {}
+		explicit mat4_soa(std::size_t Size) : detail::soa_storage<16>(Size) {}
+
+		using detail::soa_storage<16>::data;
+		float* data(length_t Column, length_t Row) { return data(Column * 4 + Row); }
+		float const* data(length_t Column, length_t Row) const { return data(Column * 4 + Row); }
+
+		value_type get(std::size_t i) const;
+		void set(std::size_t i, value_type const& m);
+		void push_back(value_type const& m);
+	};
+
+	/// Replaces the content of Out with In[0, Count).
+	/// Stride is the number of bytes between two consecutive vectors, 0 when they are contiguous. It lets the
+	/// vectors be read from an array of structures, e.g. packSoA(&Vertices[0].pos, n, Positions, sizeof(Vertex)).
+	/// From GLM_GTX_soa extension.
+	template<length_t L, qualifier Q>
+	GLM_FUNC_DECL void packSoA(vec<L, float, Q> const* In, std::size_t Count, vec_soa<L>& Out, std::size_t Stride = 0);
+
+	/// Replaces the content of Out with In[0, Count).
+	/// @see packSoA
+	template<qualifier Q>
+	GLM_FUNC_DECL void packSoA(mat<4, 4, float, Q> const* In, std::size_t Count, mat4_soa& Out, std::size_t Stride = 0);
+
+	/// Writes the In.size() vectors of In to Out, Stride bytes apart or contiguous when Stride is 0.
+	/// From GLM_GTX_soa extension.
+	template<length_t L, qualifier Q>
+	GLM_FUNC_DECL void unpackSoA(vec_soa<L> const& In, vec<L, float, Q>* Out, std::size_t Stride = 0);
+
+	/// Writes the In.size() matrices of In to Out, Stride bytes apart or contiguous when Stride is 0.
+	/// From GLM_GTX_soa extension.
+	template<qualifier Q>
+	GLM_FUNC_DECL void unpackSoA(mat4_soa const& In, mat<4, 4, float, Q>* Out, std::size_t Stride = 0);
+
+	/// Out[i] = M * vec4(In[i], 1) for 3 component points, M * In[i] for 4 component vectors.
+	/// Points drop the w of the result, the transformation is expected to be affine.
+	/// Out is resized to In.size() and may be In.
+	/// From GLM_GTX_soa extension.
+	template<length_t L, qualifier Q>
+	GLM_FUNC_DECL void transformSoA(mat<4, 4, float, Q> const& M, vec_soa<L> const& In, vec_soa<L>& Out);
+
+	/// Out[i] = M[i] * vec4(In[i], 1) for 3 component points, M[i] * In[i] for 4 component vectors.
+	/// M and In must have the same size. Out is resized to In.size() and may be In.
+	/// From GLM_GTX_soa extension.
+	template<length_t L>
+	GLM_FUNC_DECL void transformSoA(mat4_soa const& M, vec_soa<L> const& In, vec_soa<L>& Out);
+
+	/// Out[i] = A * B[i], e.g. a view-projection matrix times every model matrix.
+	/// Out is resized to B.size() and may be B.
+	/// From GLM_GTX_soa extension.
+	template<qualifier Q>
+	GLM_FUNC_DECL void mulSoA(mat<4, 4, float, Q> const& A, mat4_soa const& B, mat4_soa& Out);
+
+	/// Out[i] = normalize(In[i]). Zero length vectors give NaNs, like normalize.
+	/// Out is resized to In.size() and may be In.
+	/// From GLM_GTX_soa extension.
+	template<length_t L>
+	GLM_FUNC_DECL void normalizeSoA(vec_soa<L> const& In, vec_soa<L>& Out);
+
+	/// Out[i] = dot(A[i], B[i]). A and B must have the same size, Out is resized to it.
+	/// From GLM_GTX_soa extension.
+	template<length_t L>
+	GLM_FUNC_DECL void dotSoA(vec_soa<L> const& A, vec_soa<L> const& B, vec1_soa& Out);
+
+	/// Out[i] = cross(A[i], B[i]). A and B must have the same size, Out is resized to it and may be A or B.
+	/// From GLM_GTX_soa extension.
+	GLM_FUNC_DECL void crossSoA(vec3_soa const& A, vec3_soa const& B, vec3_soa& Out);
+
+	/// Component-wise minimum and maximum of the elements of In, e.g. the bounding box of a point cloud.
+	/// Leaves Min and Max untouched and returns false when In is empty.
+	/// From GLM_GTX_soa extension.
+	template<length_t L, qualifier Q>
+	GLM_FUNC_DECL bool boundsSoA(vec_soa<L> const& In, vec<L, float, Q>& Min, vec<L, float, Q>& Max);
+
+	/// @}
+}//namespace glm
+
+#include "soa.inl"
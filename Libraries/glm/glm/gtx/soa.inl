@@ -0,0 +1,465 @@
+/// @ref gtx_soa
+
+#include <cstring>
+#include <cassert>
+
+namespace glm{
+namespace detail
+{
+	template<length_t N>
+	GLM_FUNC_QUALIFIER soa_storage<N>::soa_storage()
+		: Data(0), Allocation(0), Size(0), Capacity(0)
+	{}
+
+	template<length_t N>
+	GLM_FUNC_QUALIFIER soa_storage<N>::soa_storage(std::size_t NewSize)
+		: Data(0), Allocation(0), Size(0), Capacity(0)
+	{
+		this->resize(NewSize);
+	}
+
+	template<length_t N>
+	GLM_FUNC_QUALIFIER soa_storage<N>::soa_storage(soa_storage const& Other)
+		: Data(0), Allocation(0), Size(0), Capacity(0)
+	{
+		this->reserve(Other.Size);
+		for(length_t c = 0; c < N; ++c)
+			memcpy(this->data(c), Other.data(c), Other.Size * sizeof(float));
+		Size = Other.Size;
+	}
+
+	template<length_t N>
+	GLM_FUNC_QUALIFIER soa_storage<N>::~soa_storage()
+	{
+		::operator delete(Allocation);
+	}
+
+	template<length_t N>
+	GLM_FUNC_QUALIFIER soa_storage<N>& soa_storage<N>::operator=(soa_storage const& Other)
+	{
+		soa_storage Copy(Other);
+		this->swap(Copy);
+		return *this;
+	}
+
+	template<length_t N>
+	GLM_FUNC_QUALIFIER void soa_storage<N>::swap(soa_storage& Other)
+	{
+		float* const OtherData = Other.Data;
+		void* const OtherAllocation = Other.Allocation;
+		std::size_t const OtherSize = Other.Size;
+		std::size_t const OtherCapacity = Other.Capacity;
+		Other.Data = Data;
+		Other.Allocation = Allocation;
+		Other.Size = Size;
+		Other.Capacity = Capacity;
+		Data = OtherData;
+		Allocation = OtherAllocation;
+		Size = OtherSize;
+		Capacity = OtherCapacity;
+	}
+
+	template<length_t N>
+	GLM_FUNC_QUALIFIER void soa_storage<N>::reserve(std::size_t NewCapacity)
+	{
+		if(NewCapacity <= Capacity)
+			return;
+
+		NewCapacity = (NewCapacity + padding - 1) / padding * padding;
+		// Streams 4 KB apart map to the same cache sets, a wide matrix kernel would evict its own inputs.
+		if(NewCapacity % 1024 == 0)
+			NewCapacity += padding;
+		std::size_t const Bytes = N * NewCapacity * sizeof(float);
+		void* const NewAllocation = ::operator new(Bytes + 64);
+		float* const NewData = reinterpret_cast<float*>((reinterpret_cast<std::size_t>(NewAllocation) + 63) & ~static_cast<std::size_t>(63));
+		memset(NewData, 0, Bytes);
+		for(length_t c = 0; c < N; ++c)
+			memcpy(NewData + c * NewCapacity, this->data(c), Size * sizeof(float));
+
+		::operator delete(Allocation);
+		Allocation = NewAllocation;
+		Data = NewData;
+		Capacity = NewCapacity;
+	}
+
+	template<length_t N>
+	GLM_FUNC_QUALIFIER void soa_storage<N>::resize(std::size_t NewSize)
+	{
+		if(NewSize > Capacity)
+			this->reserve(NewSize > Capacity * 2 ? NewSize : Capacity * 2);
+		if(NewSize > Size)
+		{
+			for(length_t c = 0; c < N; ++c)
+				memset(this->data(c) + Size, 0, (NewSize - Size) * sizeof(float));
+		}
+		Size = NewSize;
+	}
+
+	// The kernels read every input of an element before writing its outputs, so outputs can alias inputs.
+	// Count is a multiple of 16, the strides are the capacities of the containers.
+	template<length_t I, length_t O>
+	GLM_FUNC_QUALIFIER void soa_transform(float const* M, float const* In, std::size_t InStride, float* Out, std::size_t OutStride, std::size_t Count)
+	{
+#		if GLM_BATCH_X86
+			switch(batch_current_isa())
+			{
+			case GLM_BATCH_ISA_AVX512:
+			case GLM_BATCH_ISA_AVX2:
+				glm_soa_transform_batch_avx2<I, O>(M, In, InStride, Out, OutStride, Count);
+				return;
+			case GLM_BATCH_ISA_SSE2:
+				glm_soa_transform_batch_sse2<I, O>(M, In, InStride, Out, OutStride, Count);
+				return;
+			}
+#		endif
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			float r[O];
+			for(length_t j = 0; j < O; ++j)
+			{
+				float const s = M[j] * In[i] + M[4 + j] * In[InStride + i] + M[8 + j] * In[2 * InStride + i];
+				r[j] = I == 4 ? s + M[12 + j] * In[3 * InStride + i] : s + M[12 + j];
+			}
+			for(length_t j = 0; j < O; ++j)
+				Out[j * OutStride + i] = r[j];
+		}
+	}
+
+	template<length_t I, length_t O>
+	GLM_FUNC_QUALIFIER void soa_mat4_transform(float const* M, std::size_t MStride, float const* In, std::size_t InStride, float* Out, std::size_t OutStride, std::size_t Count)
+	{
+#		if GLM_BATCH_X86
+			switch(batch_current_isa())
+			{
+			case GLM_BATCH_ISA_AVX512:
+			case GLM_BATCH_ISA_AVX2:
+				glm_soa_mat4_transform_batch_avx2<I, O>(M, MStride, In, InStride, Out, OutStride, Count);
+				return;
+			case GLM_BATCH_ISA_SSE2:
+				glm_soa_mat4_transform_batch_sse2<I, O>(M, MStride, In, InStride, Out, OutStride, Count);
+				return;
+			}
+#		endif
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			float r[O];
+			for(length_t j = 0; j < O; ++j)
+			{
+				float const s = M[j * MStride + i] * In[i] + M[(4 + j) * MStride + i] * In[InStride + i] + M[(8 + j) * MStride + i] * In[2 * InStride + i];
+				r[j] = I == 4 ? s + M[(12 + j) * MStride + i] * In[3 * InStride + i] : s + M[(12 + j) * MStride + i];
+			}
+			for(length_t j = 0; j < O; ++j)
+				Out[j * OutStride + i] = r[j];
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void soa_mat4_mul(float const* A, float const* B, std::size_t BStride, float* Out, std::size_t OutStride, std::size_t Count)
+	{
+#		if GLM_BATCH_X86
+			switch(batch_current_isa())
+			{
+			case GLM_BATCH_ISA_AVX512:
+			case GLM_BATCH_ISA_AVX2:
+				glm_soa_mat4_mul_batch_avx2(A, B, BStride, Out, OutStride, Count);
+				return;
+			case GLM_BATCH_ISA_SSE2:
+				glm_soa_mat4_mul_batch_sse2(A, B, BStride, Out, OutStride, Count);
+				return;
+			}
+#		endif
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			float r[16];
+			for(length_t c = 0; c < 4; ++c)
+			for(length_t j = 0; j < 4; ++j)
+				r[c * 4 + j] = A[j] * B[(c * 4) * BStride + i] + A[4 + j] * B[(c * 4 + 1) * BStride + i] + A[8 + j] * B[(c * 4 + 2) * BStride + i] + A[12 + j] * B[(c * 4 + 3) * BStride + i];
+			for(length_t k = 0; k < 16; ++k)
+				Out[k * OutStride + i] = r[k];
+		}
+	}
+
+	template<length_t L>
+	GLM_FUNC_QUALIFIER void soa_normalize(float const* In, std::size_t InStride, float* Out, std::size_t OutStride, std::size_t Count)
+	{
+#		if GLM_BATCH_X86
+			switch(batch_current_isa())
+			{
+			case GLM_BATCH_ISA_AVX512:
+			case GLM_BATCH_ISA_AVX2:
+				glm_soa_normalize_batch_avx2<L>(In, InStride, Out, OutStride, Count);
+				return;
+			case GLM_BATCH_ISA_SSE2:
+				glm_soa_normalize_batch_sse2<L>(In, InStride, Out, OutStride, Count);
+				return;
+			}
+#		endif
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			float d = 0.0f;
+			for(length_t c = 0; c < L; ++c)
+				d += In[c * InStride + i] * In[c * InStride + i];
+			float const Inv = 1.0f / std::sqrt(d);
+			for(length_t c = 0; c < L; ++c)
+				Out[c * OutStride + i] = In[c * InStride + i] * Inv;
+		}
+	}
+
+	template<length_t L>
+	GLM_FUNC_QUALIFIER void soa_dot(float const* A, std::size_t AStride, float const* B, std::size_t BStride, float* Out, std::size_t Count)
+	{
+#		if GLM_BATCH_X86
+			switch(batch_current_isa())
+			{
+			case GLM_BATCH_ISA_AVX512:
+			case GLM_BATCH_ISA_AVX2:
+				glm_soa_dot_batch_avx2<L>(A, AStride, B, BStride, Out, Count);
+				return;
+			case GLM_BATCH_ISA_SSE2:
+				glm_soa_dot_batch_sse2<L>(A, AStride, B, BStride, Out, Count);
+				return;
+			}
+#		endif
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			float d = A[i] * B[i];
+			for(length_t c = 1; c < L; ++c)
+				d += A[c * AStride + i] * B[c * BStride + i];
+			Out[i] = d;
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void soa_cross(float const* A, std::size_t AStride, float const* B, std::size_t BStride, float* Out, std::size_t OutStride, std::size_t Count)
+	{
+#		if GLM_BATCH_X86
+			switch(batch_current_isa())
+			{
+			case GLM_BATCH_ISA_AVX512:
+			case GLM_BATCH_ISA_AVX2:
+				glm_soa_cross_batch_avx2(A, AStride, B, BStride, Out, OutStride, Count);
+				return;
+			case GLM_BATCH_ISA_SSE2:
+				glm_soa_cross_batch_sse2(A, AStride, B, BStride, Out, OutStride, Count);
+				return;
+			}
+#		endif
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			vec<3, float, defaultp> const a(A[i], A[AStride + i], A[2 * AStride + i]);
+			vec<3, float, defaultp> const b(B[i], B[BStride + i], B[2 * BStride + i]);
+			vec<3, float, defaultp> const r = cross(a, b);
+			for(length_t c = 0; c < 3; ++c)
+				Out[c * OutStride + i] = r[c];
+		}
+	}
+
+	// Count is the exact number of elements here, the padding must not take part.
+	template<length_t L>
+	GLM_FUNC_QUALIFIER void soa_bounds(float const* In, std::size_t Stride, std::size_t Count, float Min[L], float Max[L])
+	{
+#		if GLM_BATCH_X86
+			switch(batch_current_isa())
+			{
+			case GLM_BATCH_ISA_AVX512:
+			case GLM_BATCH_ISA_AVX2:
+				glm_soa_bounds_avx2<L>(In, Stride, Count, Min, Max);
+				return;
+			case GLM_BATCH_ISA_SSE2:
+				glm_soa_bounds_sse2<L>(In, Stride, Count, Min, Max);
+				return;
+			}
+#		endif
+
+		for(length_t c = 0; c < L; ++c)
+		{
+			float const* Stream = In + c * Stride;
+			Min[c] = Max[c] = Stream[0];
+			for(std::size_t i = 1; i < Count; ++i)
+			{
+				Min[c] = Stream[i] < Min[c] ? Stream[i] : Min[c];
+				Max[c] = Stream[i] > Max[c] ? Stream[i] : Max[c];
+			}
+		}
+	}
+}//namespace detail
+
+	template<length_t L>
+	GLM_FUNC_QUALIFIER typename vec_soa<L>::value_type vec_soa<L>::get(std::size_t i) const
+	{
+		assert(i < this->size());
+		value_type v;
+		for(length_t c = 0; c < L; ++c)
+			v[c] = this->data(c)[i];
+		return v;
+	}
+
+	template<length_t L>
+	GLM_FUNC_QUALIFIER void vec_soa<L>::set(std::size_t i, value_type const& v)
+	{
+		assert(i < this->size());
+		for(length_t c = 0; c < L; ++c)
+			this->data(c)[i] = v[c];
+	}
+
+	template<length_t L>
+	GLM_FUNC_QUALIFIER void vec_soa<L>::push_back(value_type const& v)
+	{
+		this->resize(this->size() + 1);
+		this->set(this->size() - 1, v);
+	}
+
+	GLM_FUNC_QUALIFIER mat4_soa::value_type mat4_soa::get(std::size_t i) const
+	{
+		assert(i < this->size());
+		value_type m;
+		for(length_t c = 0; c < 4; ++c)
+		for(length_t r = 0; r < 4; ++r)
+			m[c][r] = this->data(c, r)[i];
+		return m;
+	}
+
+	GLM_FUNC_QUALIFIER void mat4_soa::set(std::size_t i, value_type const& m)
+	{
+		assert(i < this->size());
+		for(length_t c = 0; c < 4; ++c)
+		for(length_t r = 0; r < 4; ++r)
+			this->data(c, r)[i] = m[c][r];
+	}
+
+	GLM_FUNC_QUALIFIER void mat4_soa::push_back(value_type const& m)
+	{
+		this->resize(this->size() + 1);
+		this->set(this->size() - 1, m);
+	}
+
+	template<length_t L, qualifier Q>
+	GLM_FUNC_QUALIFIER void packSoA(vec<L, float, Q> const* In, std::size_t Count, vec_soa<L>& Out, std::size_t Stride)
+	{
+		char const* const Bytes = reinterpret_cast<char const*>(In);
+		std::size_t const Step = Stride ? Stride : sizeof(vec<L, float, Q>);
+
+		Out.resize(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			vec<L, float, Q> const& v = *reinterpret_cast<vec<L, float, Q> const*>(Bytes + i * Step);
+			for(length_t c = 0; c < L; ++c)
+				Out.data(c)[i] = v[c];
+		}
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void packSoA(mat<4, 4, float, Q> const* In, std::size_t Count, mat4_soa& Out, std::size_t Stride)
+	{
+		char const* const Bytes = reinterpret_cast<char const*>(In);
+		std::size_t const Step = Stride ? Stride : sizeof(mat<4, 4, float, Q>);
+
+		Out.resize(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			mat<4, 4, float, Q> const& m = *reinterpret_cast<mat<4, 4, float, Q> const*>(Bytes + i * Step);
+			for(length_t c = 0; c < 4; ++c)
+			for(length_t r = 0; r < 4; ++r)
+				Out.data(c, r)[i] = m[c][r];
+		}
+	}
+
+	template<length_t L, qualifier Q>
+	GLM_FUNC_QUALIFIER void unpackSoA(vec_soa<L> const& In, vec<L, float, Q>* Out, std::size_t Stride)
+	{
+		char* const Bytes = reinterpret_cast<char*>(Out);
+		std::size_t const Step = Stride ? Stride : sizeof(vec<L, float, Q>);
+
+		for(std::size_t i = 0, n = In.size(); i < n; ++i)
+		{
+			vec<L, float, Q>& v = *reinterpret_cast<vec<L, float, Q>*>(Bytes + i * Step);
+			for(length_t c = 0; c < L; ++c)
+				v[c] = In.data(c)[i];
+		}
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void unpackSoA(mat4_soa const& In, mat<4, 4, float, Q>* Out, std::size_t Stride)
+	{
+		char* const Bytes = reinterpret_cast<char*>(Out);
+		std::size_t const Step = Stride ? Stride : sizeof(mat<4, 4, float, Q>);
+
+		for(std::size_t i = 0, n = In.size(); i < n; ++i)
+		{
+			mat<4, 4, float, Q>& m = *reinterpret_cast<mat<4, 4, float, Q>*>(Bytes + i * Step);
+			for(length_t c = 0; c < 4; ++c)
+			for(length_t r = 0; r < 4; ++r)
+				m[c][r] = In.data(c, r)[i];
+		}
+	}
+
+	template<length_t L, qualifier Q>
+	GLM_FUNC_QUALIFIER void transformSoA(mat<4, 4, float, Q> const& M, vec_soa<L> const& In, vec_soa<L>& Out)
+	{
+		GLM_STATIC_ASSERT(L == 3 || L == 4, "'transformSoA' only accepts 3 or 4 component vectors");
+
+		Out.resize(In.size());
+		detail::soa_transform<L, L>(&M[0][0], In.data(0), In.capacity(), Out.data(0), Out.capacity(), In.padded_size());
+	}
+
+	template<length_t L>
+	GLM_FUNC_QUALIFIER void transformSoA(mat4_soa const& M, vec_soa<L> const& In, vec_soa<L>& Out)
+	{
+		GLM_STATIC_ASSERT(L == 3 || L == 4, "'transformSoA' only accepts 3 or 4 component vectors");
+		assert(M.size() == In.size());
+
+		Out.resize(In.size());
+		detail::soa_mat4_transform<L, L>(M.data(0), M.capacity(), In.data(0), In.capacity(), Out.data(0), Out.capacity(), In.padded_size());
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void mulSoA(mat<4, 4, float, Q> const& A, mat4_soa const& B, mat4_soa& Out)
+	{
+		Out.resize(B.size());
+		detail::soa_mat4_mul(&A[0][0], B.data(0), B.capacity(), Out.data(0), Out.capacity(), B.padded_size());
+	}
+
+	template<length_t L>
+	GLM_FUNC_QUALIFIER void normalizeSoA(vec_soa<L> const& In, vec_soa<L>& Out)
+	{
+		Out.resize(In.size());
+		detail::soa_normalize<L>(In.data(0), In.capacity(), Out.data(0), Out.capacity(), In.padded_size());
+	}
+
+	template<length_t L>
+	GLM_FUNC_QUALIFIER void dotSoA(vec_soa<L> const& A, vec_soa<L> const& B, vec1_soa& Out)
+	{
+		assert(A.size() == B.size());
+
+		Out.resize(A.size());
+		detail::soa_dot<L>(A.data(0), A.capacity(), B.data(0), B.capacity(), Out.data(0), A.padded_size());
+	}
+
+	GLM_FUNC_QUALIFIER void crossSoA(vec3_soa const& A, vec3_soa const& B, vec3_soa& Out)
+	{
+		assert(A.size() == B.size());
+
+		Out.resize(A.size());
+		detail::soa_cross(A.data(0), A.capacity(), B.data(0), B.capacity(), Out.data(0), Out.capacity(), A.padded_size());
+	}
+
+	template<length_t L, qualifier Q>
+	GLM_FUNC_QUALIFIER bool boundsSoA(vec_soa<L> const& In, vec<L, float, Q>& Min, vec<L, float, Q>& Max)
+	{
+		if(In.empty())
+			return false;
+
+		float Low[L], High[L];
+		detail::soa_bounds<L>(In.data(0), In.capacity(), In.size(), Low, High);
+		for(length_t c = 0; c < L; ++c)
+		{
+			Min[c] = Low[c];
+			Max[c] = High[c];
+		}
+		return true;
+	}
+}//namespace glm
@@ -129,7 +129,7 @@ namespace detail
 	/// @see <a href="http://www.opengl.org/sdk/docs/manglsl/xhtml/transpose.xml">GLSL transpose man page</a>
 	/// @see <a href="http://www.opengl.org/registry/doc/GLSLangSpec.4.20.8.pdf">GLSL 4.20.8 specification, section 8.6 Matrix Functions</a>
 	template<length_t C, length_t R, typename T, qualifier Q>
-	GLM_FUNC_DECL typename mat<C, R, T, Q>::transpose_type transpose(mat<C, R, T, Q> const& x);
+	GLM_FUNC_DECL GLM_CONSTEXPR_MATH typename mat<C, R, T, Q>::transpose_type transpose(mat<C, R, T, Q> const& x);
 
 	/// Return the determinant of a squared matrix.
 	///
@@ -237,4 +237,212 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_inf(glm_vec4 x)
 	return _mm_castsi128_ps(_mm_cmpeq_epi32(t2, _mm_set1_epi32(int(0xFF000000))));		// exponent is all 1s, fraction is 0
 }
 
-#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+#elif GLM_ARCH & GLM_ARCH_NEON_BIT
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_set(float x, float y, float z, float w)
+{
+	float const v[4] = {x, y, z, w};
+	return vld1q_f32(v);
+}
+
+GLM_FUNC_QUALIFIER glm_ivec4 glm_ivec4_set(int x, int y, int z, int w)
+{
+	int const v[4] = {x, y, z, w};
+	return vld1q_s32(v);
+}
+
+// Non zero when every lane of the mask is set.
+GLM_FUNC_QUALIFIER bool glm_uvec4_all(glm_uvec4 m)
+{
+#	if GLM_NEON_AARCH64
+		return vminvq_u32(m) != 0;
+#	else
+		uint32x2_t const min0 = vpmin_u32(vget_low_u32(m), vget_high_u32(m));
+		return vget_lane_u32(vpmin_u32(min0, min0), 0) != 0;
+#	endif
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_add(glm_vec4 a, glm_vec4 b)
+{
+	return vaddq_f32(a, b);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_sub(glm_vec4 a, glm_vec4 b)
+{
+	return vsubq_f32(a, b);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_mul(glm_vec4 a, glm_vec4 b)
+{
+	return vmulq_f32(a, b);
+}
+
+// The reciprocal estimate is only good to 8 bits, each Newton-Raphson step doubles that.
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_rcp(glm_vec4 x)
+{
+	glm_vec4 const rcp0 = vrecpeq_f32(x);
+	glm_vec4 const rcp1 = vmulq_f32(vrecpsq_f32(x, rcp0), rcp0);
+	glm_vec4 const rcp2 = vmulq_f32(vrecpsq_f32(x, rcp1), rcp1);
+	return rcp2;
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_div(glm_vec4 a, glm_vec4 b)
+{
+#	if GLM_NEON_AARCH64
+		return vdivq_f32(a, b);
+#	else
+		return vmulq_f32(a, glm_vec4_rcp(b));
+#	endif
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_div_lowp(glm_vec4 a, glm_vec4 b)
+{
+	glm_vec4 const rcp0 = vrecpeq_f32(b);
+	glm_vec4 const rcp1 = vmulq_f32(vrecpsq_f32(b, rcp0), rcp0);
+	return vmulq_f32(a, rcp1);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_fma(glm_vec4 a, glm_vec4 b, glm_vec4 c)
+{
+#	if GLM_NEON_AARCH64
+		return vfmaq_f32(c, a, b);
+#	else
+		return vmlaq_f32(c, a, b);
+#	endif
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_sqrt(glm_vec4 x)
+{
+#	if GLM_NEON_AARCH64
+		return vsqrtq_f32(x);
+#	else
+		glm_vec4 const isr0 = vrsqrteq_f32(x);
+		glm_vec4 const isr1 = vmulq_f32(vrsqrtsq_f32(vmulq_f32(x, isr0), isr0), isr0);
+		glm_vec4 const isr2 = vmulq_f32(vrsqrtsq_f32(vmulq_f32(x, isr1), isr1), isr1);
+		glm_vec4 const sqt0 = vmulq_f32(x, isr2);
+		// x * 1/sqrt(x) is 0 * inf for zero inputs
+		return vbslq_f32(vceqq_f32(x, vdupq_n_f32(0.0f)), x, sqt0);
+#	endif
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_abs(glm_vec4 x)
+{
+	return vabsq_f32(x);
+}
+
+GLM_FUNC_QUALIFIER glm_ivec4 glm_ivec4_abs(glm_ivec4 x)
+{
+	return vabsq_s32(x);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_sign(glm_vec4 x)
+{
+	glm_vec4 const zro0 = vdupq_n_f32(0.0f);
+	glm_vec4 const pos0 = vbslq_f32(vcgtq_f32(x, zro0), vdupq_n_f32(1.0f), zro0);
+	glm_vec4 const neg0 = vbslq_f32(vcltq_f32(x, zro0), vdupq_n_f32(-1.0f), pos0);
+	return neg0;
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_round(glm_vec4 x)
+{
+#	if GLM_NEON_AARCH64
+		return vrndnq_f32(x);
+#	else
+		// Adding and removing 2^23 with the sign of x drops the fraction bits, values above 2^23 are already integers.
+		glm_uvec4 const sgn0 = vandq_u32(vreinterpretq_u32_f32(x), vdupq_n_u32(0x80000000));
+		glm_vec4 const or0 = vreinterpretq_f32_u32(vorrq_u32(sgn0, vreinterpretq_u32_f32(vdupq_n_f32(8388608.0f))));
+		glm_vec4 const add0 = vaddq_f32(x, or0);
+		glm_vec4 const sub0 = vsubq_f32(add0, or0);
+		return vbslq_f32(vcaltq_f32(x, vdupq_n_f32(8388608.0f)), sub0, x);
+#	endif
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_roundEven(glm_vec4 x)
+{
+	return glm_vec4_round(x);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_floor(glm_vec4 x)
+{
+#	if GLM_NEON_AARCH64
+		return vrndmq_f32(x);
+#	else
+		glm_vec4 const rnd0 = glm_vec4_round(x);
+		glm_uvec4 const cmp0 = vcltq_f32(x, rnd0);
+		glm_vec4 const and0 = vreinterpretq_f32_u32(vandq_u32(cmp0, vreinterpretq_u32_f32(vdupq_n_f32(1.0f))));
+		return vsubq_f32(rnd0, and0);
+#	endif
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_ceil(glm_vec4 x)
+{
+#	if GLM_NEON_AARCH64
+		return vrndpq_f32(x);
+#	else
+		glm_vec4 const rnd0 = glm_vec4_round(x);
+		glm_uvec4 const cmp0 = vcgtq_f32(x, rnd0);
+		glm_vec4 const and0 = vreinterpretq_f32_u32(vandq_u32(cmp0, vreinterpretq_u32_f32(vdupq_n_f32(1.0f))));
+		return vaddq_f32(rnd0, and0);
+#	endif
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_fract(glm_vec4 x)
+{
+	glm_vec4 const flr0 = glm_vec4_floor(x);
+	glm_vec4 const sub0 = glm_vec4_sub(x, flr0);
+	return sub0;
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_mod(glm_vec4 x, glm_vec4 y)
+{
+	glm_vec4 const div0 = glm_vec4_div(x, y);
+	glm_vec4 const flr0 = glm_vec4_floor(div0);
+	glm_vec4 const mul0 = glm_vec4_mul(y, flr0);
+	glm_vec4 const sub0 = glm_vec4_sub(x, mul0);
+	return sub0;
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_clamp(glm_vec4 v, glm_vec4 minVal, glm_vec4 maxVal)
+{
+	glm_vec4 const min0 = vminq_f32(v, maxVal);
+	glm_vec4 const max0 = vmaxq_f32(min0, minVal);
+	return max0;
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_mix(glm_vec4 v1, glm_vec4 v2, glm_vec4 a)
+{
+	glm_vec4 const sub0 = glm_vec4_sub(vdupq_n_f32(1.0f), a);
+	glm_vec4 const mul0 = glm_vec4_mul(v1, sub0);
+	glm_vec4 const mad0 = glm_vec4_fma(v2, a, mul0);
+	return mad0;
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_step(glm_vec4 edge, glm_vec4 x)
+{
+	return vbslq_f32(vcltq_f32(x, edge), vdupq_n_f32(0.0f), vdupq_n_f32(1.0f));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_smoothstep(glm_vec4 edge0, glm_vec4 edge1, glm_vec4 x)
+{
+	glm_vec4 const sub0 = glm_vec4_sub(x, edge0);
+	glm_vec4 const sub1 = glm_vec4_sub(edge1, edge0);
+	glm_vec4 const div0 = glm_vec4_div(sub0, sub1);
+	glm_vec4 const clp0 = glm_vec4_clamp(div0, vdupq_n_f32(0.0f), vdupq_n_f32(1.0f));
+	glm_vec4 const mul0 = glm_vec4_mul(vdupq_n_f32(2.0f), clp0);
+	glm_vec4 const sub2 = glm_vec4_sub(vdupq_n_f32(3.0f), mul0);
+	glm_vec4 const mul1 = glm_vec4_mul(clp0, clp0);
+	glm_vec4 const mul2 = glm_vec4_mul(mul1, sub2);
+	return mul2;
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_nan(glm_vec4 x)
+{
+	return vreinterpretq_f32_u32(vmvnq_u32(vceqq_f32(x, x)));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_inf(glm_vec4 x)
+{
+	return vreinterpretq_f32_u32(vceqq_f32(vabsq_f32(x), vreinterpretq_f32_u32(vdupq_n_u32(0x7F800000))));
+}
+
+#endif//GLM_ARCH
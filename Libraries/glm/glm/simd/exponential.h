@@ -4,6 +4,7 @@
 #pragma once
 
 #include "platform.h"
+#include <limits>
 
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
@@ -17,4 +18,92 @@ GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_sqrt_lowp(glm_f32vec4 x)
 	return _mm_mul_ps(_mm_rsqrt_ps(x), x);
 }
 
+// 2^n for n in [-252, 254], as two powers of two so the results reaching the infinite or denormal range stay exact.
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_exp2i(glm_i32vec4 n, glm_f32vec4 x)
+{
+	glm_i32vec4 const Half = _mm_srai_epi32(n, 1);
+	glm_f32vec4 const a = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(Half, _mm_set1_epi32(127)), 23));
+	glm_f32vec4 const b = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_sub_epi32(n, Half), _mm_set1_epi32(127)), 23));
+	return _mm_mul_ps(_mm_mul_ps(x, a), b);
+}
+
+// e^x from a minimax polynomial on [-ln(2)/2, ln(2)/2] scaled by 2^n. Within 1 ULP of the exact result
+// for normal results, 0 below ln(2^-150), infinity above ln(FLT_MAX).
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_exp(glm_f32vec4 x)
+{
+	glm_f32vec4 const Max = _mm_set1_ps(88.7228394f);
+	glm_f32vec4 const Min = _mm_set1_ps(-103.972084f);
+	glm_f32vec4 const v = _mm_min_ps(_mm_max_ps(x, Min), Max);
+
+	glm_i32vec4 const q = _mm_cvtps_epi32(_mm_mul_ps(v, _mm_set1_ps(1.44269504088896341f)));
+	glm_f32vec4 const n = _mm_cvtepi32_ps(q);
+	glm_f32vec4 r = _mm_sub_ps(v, _mm_mul_ps(n, _mm_set1_ps(0.693359375f)));
+	r = _mm_add_ps(r, _mm_mul_ps(n, _mm_set1_ps(2.12194440e-4f)));
+
+	glm_f32vec4 p = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(1.9875691500e-4f), r), _mm_set1_ps(1.3981999507e-3f));
+	p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(8.3334519073e-3f));
+	p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(4.1665795894e-2f));
+	p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(1.6666665459e-1f));
+	p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(5.0000001201e-1f));
+	p = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_mul_ps(p, r), r), r), _mm_set1_ps(1.0f));
+
+	glm_f32vec4 Result = glm_vec4_exp2i(q, p);
+	glm_f32vec4 const Overflow = _mm_cmpgt_ps(x, Max);
+	glm_f32vec4 const Underflow = _mm_cmplt_ps(x, Min);
+	glm_f32vec4 const NaN = _mm_cmpunord_ps(x, x);
+	Result = _mm_or_ps(_mm_andnot_ps(Overflow, Result), _mm_and_ps(Overflow, _mm_set1_ps(std::numeric_limits<float>::infinity())));
+	Result = _mm_andnot_ps(Underflow, Result);
+	return _mm_or_ps(_mm_andnot_ps(NaN, Result), _mm_and_ps(NaN, x));
+}
+
+// Natural logarithm from the exponent and a minimax polynomial of the mantissa on [sqrt(2)/2, sqrt(2)].
+// Within 1 ULP of the exact result for positive inputs, denormals included.
+// log(0) is -infinity, log(+infinity) is +infinity, negative inputs and NaNs give NaNs.
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_log(glm_f32vec4 x)
+{
+	glm_f32vec4 const Denormal = _mm_cmplt_ps(x, _mm_set1_ps(std::numeric_limits<float>::min()));
+	glm_f32vec4 const v = _mm_or_ps(_mm_andnot_ps(Denormal, x), _mm_and_ps(Denormal, _mm_mul_ps(x, _mm_set1_ps(8388608.0f))));
+	glm_i32vec4 const Bits = _mm_castps_si128(v);
+
+	// v = m * 2^e with m in [0.5, 1), moved to [sqrt(2)/2, sqrt(2)) by taking one from the exponent.
+	glm_f32vec4 e = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(Bits, 23), _mm_set1_epi32(126)));
+	e = _mm_sub_ps(e, _mm_and_ps(Denormal, _mm_set1_ps(23.0f)));
+	glm_f32vec4 m = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(Bits, _mm_set1_epi32(0x007fffff)), _mm_set1_epi32(0x3f000000)));
+	glm_f32vec4 const Small = _mm_cmplt_ps(m, _mm_set1_ps(0.707106781186547524f));
+	e = _mm_sub_ps(e, _mm_and_ps(Small, _mm_set1_ps(1.0f)));
+	m = _mm_add_ps(_mm_sub_ps(m, _mm_set1_ps(1.0f)), _mm_and_ps(Small, m));
+	glm_f32vec4 const z = _mm_mul_ps(m, m);
+
+	glm_f32vec4 p = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(7.0376836292e-2f), m), _mm_set1_ps(-1.1514610310e-1f));
+	p = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(1.1676998740e-1f));
+	p = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(-1.2420140846e-1f));
+	p = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(1.4249322787e-1f));
+	p = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(-1.6668057665e-1f));
+	p = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(2.0000714765e-1f));
+	p = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(-2.4999993993e-1f));
+	p = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(3.3333331174e-1f));
+	p = _mm_mul_ps(_mm_mul_ps(p, m), z);
+
+	p = _mm_add_ps(p, _mm_mul_ps(e, _mm_set1_ps(-2.12194440e-4f)));
+	p = _mm_sub_ps(p, _mm_mul_ps(z, _mm_set1_ps(0.5f)));
+	glm_f32vec4 Result = _mm_add_ps(_mm_add_ps(m, p), _mm_mul_ps(e, _mm_set1_ps(0.693359375f)));
+
+	glm_f32vec4 const Zero = _mm_cmpeq_ps(x, _mm_setzero_ps());
+	glm_f32vec4 const Invalid = _mm_or_ps(_mm_cmplt_ps(x, _mm_setzero_ps()), _mm_cmpunord_ps(x, x));
+	glm_f32vec4 const Infinite = _mm_cmpeq_ps(x, _mm_set1_ps(std::numeric_limits<float>::infinity()));
+	Result = _mm_or_ps(_mm_andnot_ps(Zero, Result), _mm_and_ps(Zero, _mm_set1_ps(-std::numeric_limits<float>::infinity())));
+	Result = _mm_or_ps(_mm_andnot_ps(Infinite, Result), _mm_and_ps(Infinite, x));
+	return _mm_or_ps(Result, Invalid);
+}
+
+// x^y as e^(y log(x)) for x >= 0. The rounding of y log(x) is magnified by the exponential, so the error is within
+// 2 + 2 |y log(x)| ULP, which reaches tens of ULP as the result nears the limits of the float range.
+// Negative x gives NaN, even for integral exponents. x^0 is 1.
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_pow(glm_f32vec4 x, glm_f32vec4 y)
+{
+	glm_f32vec4 const Result = glm_vec4_exp(_mm_mul_ps(y, glm_vec4_log(x)));
+	glm_f32vec4 const One = _mm_cmpeq_ps(y, _mm_setzero_ps());
+	return _mm_or_ps(_mm_andnot_ps(One, Result), _mm_and_ps(One, _mm_set1_ps(1.0f)));
+}
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
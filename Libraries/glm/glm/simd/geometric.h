@@ -121,4 +121,103 @@ GLM_FUNC_QUALIFIER __m128 glm_vec4_refract(glm_vec4 I, glm_vec4 N, glm_vec4 eta)
 	return sub2;
 }
 
-#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+#elif GLM_ARCH & GLM_ARCH_NEON_BIT
+
+// Horizontal sum, broadcast to every lane.
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_hadd(glm_vec4 v)
+{
+#	if GLM_NEON_AARCH64
+		return vdupq_n_f32(vaddvq_f32(v));
+#	else
+		float32x2_t const add0 = vadd_f32(vget_low_f32(v), vget_high_f32(v));
+		float32x2_t const add1 = vpadd_f32(add0, add0);
+		return vcombine_f32(add1, add1);
+#	endif
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_dot(glm_vec4 v1, glm_vec4 v2)
+{
+	return glm_vec4_hadd(vmulq_f32(v1, v2));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec1_dot(glm_vec4 v1, glm_vec4 v2)
+{
+	return glm_vec4_dot(v1, v2);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_length(glm_vec4 x)
+{
+	glm_vec4 const dot0 = glm_vec4_dot(x, x);
+	glm_vec4 const sqt0 = glm_vec4_sqrt(dot0);
+	return sqt0;
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_distance(glm_vec4 p0, glm_vec4 p1)
+{
+	glm_vec4 const sub0 = vsubq_f32(p0, p1);
+	glm_vec4 const len0 = glm_vec4_length(sub0);
+	return len0;
+}
+
+// (y, z, x, w)
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_swizzle_yzxw(glm_vec4 v)
+{
+	float32x2_t const xy = vget_low_f32(v);
+	float32x2_t const zw = vget_high_f32(v);
+	float32x2_t const yz = vext_f32(xy, zw, 1);
+	float32x2_t const xw = vset_lane_f32(vget_lane_f32(xy, 0), zw, 0);
+	return vcombine_f32(yz, xw);
+}
+
+// cross(a, b) = (a * b.yzx - a.yzx * b).yzx, which only needs the one swizzle. w ends up as 0.
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_cross(glm_vec4 v1, glm_vec4 v2)
+{
+	glm_vec4 const swp0 = glm_vec4_swizzle_yzxw(v1);
+	glm_vec4 const swp1 = glm_vec4_swizzle_yzxw(v2);
+	glm_vec4 const mul0 = vmulq_f32(v1, swp1);
+	glm_vec4 const sub0 = vmlsq_f32(mul0, swp0, v2);
+	return glm_vec4_swizzle_yzxw(sub0);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_normalize(glm_vec4 v)
+{
+	glm_vec4 const dot0 = glm_vec4_dot(v, v);
+	glm_vec4 const len0 = glm_vec4_sqrt(dot0);
+	return glm_vec4_div(v, len0);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_faceforward(glm_vec4 N, glm_vec4 I, glm_vec4 Nref)
+{
+	glm_vec4 const dot0 = glm_vec4_dot(Nref, I);
+	return vbslq_f32(vcltq_f32(dot0, vdupq_n_f32(0.0f)), N, vnegq_f32(N));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_reflect(glm_vec4 I, glm_vec4 N)
+{
+	glm_vec4 const dot0 = glm_vec4_dot(N, I);
+	glm_vec4 const mul0 = vmulq_f32(N, dot0);
+	glm_vec4 const mul1 = vmulq_f32(mul0, vdupq_n_f32(2.0f));
+	glm_vec4 const sub0 = vsubq_f32(I, mul1);
+	return sub0;
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_refract(glm_vec4 I, glm_vec4 N, glm_vec4 eta)
+{
+	glm_vec4 const dot0 = glm_vec4_dot(N, I);
+	glm_vec4 const mul0 = vmulq_f32(eta, eta);
+	glm_vec4 const sub0 = vmlsq_f32(vdupq_n_f32(1.0f), dot0, dot0);
+	glm_vec4 const k = vmlsq_f32(vdupq_n_f32(1.0f), mul0, sub0);
+
+	if(vgetq_lane_f32(k, 0) < 0.0f)
+		return vdupq_n_f32(0.0f);
+
+	glm_vec4 const sqt0 = glm_vec4_sqrt(k);
+	glm_vec4 const mad0 = glm_vec4_fma(eta, dot0, sqt0);
+	glm_vec4 const mul4 = vmulq_f32(mad0, N);
+	glm_vec4 const mul5 = vmulq_f32(eta, I);
+	glm_vec4 const sub2 = vsubq_f32(mul5, mul4);
+
+	return sub2;
+}
+
+#endif//GLM_ARCH
@@ -0,0 +1,349 @@
+/// @ref simd
+/// @file glm/simd/intersect_batch.h
+///
+/// Kernels for GLM_GTX_intersect_batch: frustum culling of spheres and boxes, and closest hit searches of a ray
+/// among spheres and triangles. Objects are stored in structure of arrays form like GLM_GTX_soa, component c of
+/// object i at Stream[c * Stride + i], 64 byte aligned and padded to 16 floats, so loads never need a tail.
+/// Count is the exact number of objects, the lanes past it are ignored.
+/// The instruction set is picked at runtime, see matrix_batch.h.
+
+#pragma once
+
+#include "matrix_batch.h"
+
+#include <cfloat>
+
+#if GLM_BATCH_X86
+
+// Appends Base + k to Visible for the set bits k of Mask, only the first Lanes bits are looked at.
+GLM_FUNC_QUALIFIER std::size_t glm_batch_compact(int Mask, unsigned int Base, std::size_t Lanes, unsigned int* Visible, std::size_t Written)
+{
+	for(std::size_t k = 0; k < Lanes; ++k)
+	{
+		Visible[Written] = Base + static_cast<unsigned int>(k);
+		Written += static_cast<std::size_t>((Mask >> k) & 1);
+	}
+	return Written;
+}
+
+// Closest of several candidates kept one per lane, ties go to the lowest index like a sequential search.
+GLM_FUNC_QUALIFIER std::size_t glm_batch_closest(float const* Distance, int const* Index, int Lanes, std::size_t NotFound, float& Closest)
+{
+	std::size_t Result = NotFound;
+	for(int k = 0; k < Lanes; ++k)
+	{
+		if(Index[k] < 0)
+			continue;
+		if(Result == NotFound || Distance[k] < Closest || (Distance[k] == Closest && static_cast<std::size_t>(Index[k]) < Result))
+		{
+			Closest = Distance[k];
+			Result = static_cast<std::size_t>(Index[k]);
+		}
+	}
+	return Result;
+}
+
+// Planes holds 6 planes as (normal, distance), Radii a stream or, when RadiusStride is 0, one radius for every sphere.
+GLM_FUNC_QUALIFIER std::size_t glm_sphere_frustum_batch_sse2(float const* Planes, float const* Centers, std::size_t Stride, float const* Radii, std::size_t RadiusStride, std::size_t Count, unsigned int* Visible)
+{
+	glm_vec4 p[24];
+	for(int k = 0; k < 24; ++k)
+		p[k] = _mm_set1_ps(Planes[k]);
+	glm_vec4 const CommonRadius = _mm_set1_ps(Radii[0]);
+
+	std::size_t Written = 0;
+	for(std::size_t i = 0; i < Count; i += 4)
+	{
+		glm_vec4 const x = _mm_load_ps(Centers + i);
+		glm_vec4 const y = _mm_load_ps(Centers + Stride + i);
+		glm_vec4 const z = _mm_load_ps(Centers + 2 * Stride + i);
+		glm_vec4 const r = RadiusStride ? _mm_load_ps(Radii + i) : CommonRadius;
+
+		// Smallest signed distance to the planes, visible when it's at least -radius.
+		glm_vec4 d = _mm_add_ps(_mm_add_ps(_mm_mul_ps(p[0], x), _mm_mul_ps(p[1], y)), _mm_add_ps(_mm_mul_ps(p[2], z), p[3]));
+		for(int k = 1; k < 6; ++k)
+			d = _mm_min_ps(d, _mm_add_ps(_mm_add_ps(_mm_mul_ps(p[k * 4], x), _mm_mul_ps(p[k * 4 + 1], y)), _mm_add_ps(_mm_mul_ps(p[k * 4 + 2], z), p[k * 4 + 3])));
+		int const Mask = _mm_movemask_ps(_mm_cmpge_ps(_mm_add_ps(d, r), _mm_setzero_ps()));
+
+		Written = glm_batch_compact(Mask, static_cast<unsigned int>(i), Count - i < 4 ? Count - i : 4, Visible, Written);
+	}
+	return Written;
+}
+
+// Boxes are tested through the corner furthest along each plane normal.
+GLM_FUNC_QUALIFIER std::size_t glm_aabb_frustum_batch_sse2(float const* Planes, float const* Min, std::size_t MinStride, float const* Max, std::size_t MaxStride, std::size_t Count, unsigned int* Visible)
+{
+	glm_vec4 p[24];
+	int Corner[6][3];
+	for(int k = 0; k < 6; ++k)
+	for(int c = 0; c < 4; ++c)
+	{
+		p[k * 4 + c] = _mm_set1_ps(Planes[k * 4 + c]);
+		if(c < 3)
+			Corner[k][c] = Planes[k * 4 + c] < 0.0f ? 0 : 1;
+	}
+
+	std::size_t Written = 0;
+	for(std::size_t i = 0; i < Count; i += 4)
+	{
+		glm_vec4 b[2][3];
+		for(int c = 0; c < 3; ++c)
+		{
+			b[0][c] = _mm_load_ps(Min + c * MinStride + i);
+			b[1][c] = _mm_load_ps(Max + c * MaxStride + i);
+		}
+
+		glm_vec4 d = _mm_set1_ps(FLT_MAX);
+		for(int k = 0; k < 6; ++k)
+		{
+			glm_vec4 const x = b[Corner[k][0]][0];
+			glm_vec4 const y = b[Corner[k][1]][1];
+			glm_vec4 const z = b[Corner[k][2]][2];
+			d = _mm_min_ps(d, _mm_add_ps(_mm_add_ps(_mm_mul_ps(p[k * 4], x), _mm_mul_ps(p[k * 4 + 1], y)), _mm_add_ps(_mm_mul_ps(p[k * 4 + 2], z), p[k * 4 + 3])));
+		}
+		int const Mask = _mm_movemask_ps(_mm_cmpge_ps(d, _mm_setzero_ps()));
+
+		Written = glm_batch_compact(Mask, static_cast<unsigned int>(i), Count - i < 4 ? Count - i : 4, Visible, Written);
+	}
+	return Written;
+}
+
+// Nearest sphere hit by the ray, the direction is unit length. Same distance as intersectRaySphere: the entry point,
+// or the exit point when the origin is inside. Returns Count when nothing is hit.
+GLM_FUNC_QUALIFIER std::size_t glm_ray_sphere_batch_sse2(float const* Orig, float const* Dir, float const* Centers, std::size_t Stride, float const* Radii, std::size_t RadiusStride, std::size_t Count, float& Distance)
+{
+	glm_vec4 const ox = _mm_set1_ps(Orig[0]), oy = _mm_set1_ps(Orig[1]), oz = _mm_set1_ps(Orig[2]);
+	glm_vec4 const dx = _mm_set1_ps(Dir[0]), dy = _mm_set1_ps(Dir[1]), dz = _mm_set1_ps(Dir[2]);
+	glm_vec4 const CommonRadius = _mm_set1_ps(Radii[0]);
+	glm_vec4 const Epsilon = _mm_set1_ps(FLT_EPSILON);
+	glm_ivec4 const Last = _mm_set1_epi32(static_cast<int>(Count));
+
+	glm_vec4 Best = _mm_set1_ps(FLT_MAX);
+	glm_ivec4 BestIndex = _mm_set1_epi32(-1);
+	glm_ivec4 Index = _mm_setr_epi32(0, 1, 2, 3);
+	for(std::size_t i = 0; i < Count; i += 4, Index = _mm_add_epi32(Index, _mm_set1_epi32(4)))
+	{
+		glm_vec4 const x = _mm_sub_ps(_mm_load_ps(Centers + i), ox);
+		glm_vec4 const y = _mm_sub_ps(_mm_load_ps(Centers + Stride + i), oy);
+		glm_vec4 const z = _mm_sub_ps(_mm_load_ps(Centers + 2 * Stride + i), oz);
+		glm_vec4 const r = RadiusStride ? _mm_load_ps(Radii + i) : CommonRadius;
+
+		glm_vec4 const t0 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, dx), _mm_mul_ps(y, dy)), _mm_mul_ps(z, dz));
+		glm_vec4 const d2 = _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)), _mm_mul_ps(t0, t0));
+		glm_vec4 const r2 = _mm_mul_ps(r, r);
+		glm_vec4 const t1 = _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(r2, d2), _mm_setzero_ps()));
+		glm_vec4 const Front = _mm_cmpgt_ps(t0, _mm_add_ps(t1, Epsilon));
+		glm_vec4 const t = _mm_or_ps(_mm_and_ps(Front, _mm_sub_ps(t0, t1)), _mm_andnot_ps(Front, _mm_add_ps(t0, t1)));
+
+		glm_vec4 Hit = _mm_and_ps(_mm_cmple_ps(d2, r2), _mm_cmpgt_ps(t, Epsilon));
+		Hit = _mm_and_ps(Hit, _mm_cmplt_ps(t, Best));
+		Hit = _mm_and_ps(Hit, _mm_castsi128_ps(_mm_cmplt_epi32(Index, Last)));
+		Best = _mm_or_ps(_mm_and_ps(Hit, t), _mm_andnot_ps(Hit, Best));
+		BestIndex = _mm_or_si128(_mm_and_si128(_mm_castps_si128(Hit), Index), _mm_andnot_si128(_mm_castps_si128(Hit), BestIndex));
+	}
+
+	float Distances[4];
+	int Indices[4];
+	_mm_storeu_ps(Distances, Best);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(Indices), BestIndex);
+	return glm_batch_closest(Distances, Indices, 4, Count, Distance);
+}
+
+// Nearest triangle hit by the ray with the watertight test of intersectRayTriangleWatertight. V holds the 9 vertex
+// streams (v0, v1 and v2) and Orig the ray origin, both already permuted to the kx, ky, kz order of the ray;
+// S holds the shear constants Sx, Sy and Sz. Returns Count when nothing is hit.
+GLM_FUNC_QUALIFIER std::size_t glm_ray_triangle_batch_sse2(float const* const* V, float const* Orig, float const* S, std::size_t Count, float& Distance)
+{
+	glm_vec4 const o[3] = {_mm_set1_ps(Orig[0]), _mm_set1_ps(Orig[1]), _mm_set1_ps(Orig[2])};
+	glm_vec4 const Sx = _mm_set1_ps(S[0]), Sy = _mm_set1_ps(S[1]), Sz = _mm_set1_ps(S[2]);
+	glm_vec4 const Zero = _mm_setzero_ps();
+	glm_vec4 const SignBit = _mm_set1_ps(-0.0f);
+	glm_ivec4 const Last = _mm_set1_epi32(static_cast<int>(Count));
+
+	glm_vec4 Best = _mm_set1_ps(FLT_MAX);
+	glm_ivec4 BestIndex = _mm_set1_epi32(-1);
+	glm_ivec4 Index = _mm_setr_epi32(0, 1, 2, 3);
+	for(std::size_t i = 0; i < Count; i += 4, Index = _mm_add_epi32(Index, _mm_set1_epi32(4)))
+	{
+		// Vertices relative to the origin, sheared so the ray runs along z.
+		glm_vec4 x[3], y[3], z[3];
+		for(int k = 0; k < 3; ++k)
+		{
+			z[k] = _mm_sub_ps(_mm_load_ps(V[k * 3 + 2] + i), o[2]);
+			x[k] = _mm_sub_ps(_mm_sub_ps(_mm_load_ps(V[k * 3] + i), o[0]), _mm_mul_ps(Sx, z[k]));
+			y[k] = _mm_sub_ps(_mm_sub_ps(_mm_load_ps(V[k * 3 + 1] + i), o[1]), _mm_mul_ps(Sy, z[k]));
+		}
+
+		glm_vec4 const U = _mm_sub_ps(_mm_mul_ps(x[2], y[1]), _mm_mul_ps(y[2], x[1]));
+		glm_vec4 const W0 = _mm_sub_ps(_mm_mul_ps(x[0], y[2]), _mm_mul_ps(y[0], x[2]));
+		glm_vec4 const W1 = _mm_sub_ps(_mm_mul_ps(x[1], y[0]), _mm_mul_ps(y[1], x[0]));
+
+		glm_vec4 const Negative = _mm_or_ps(_mm_or_ps(_mm_cmplt_ps(U, Zero), _mm_cmplt_ps(W0, Zero)), _mm_cmplt_ps(W1, Zero));
+		glm_vec4 const Positive = _mm_or_ps(_mm_or_ps(_mm_cmpgt_ps(U, Zero), _mm_cmpgt_ps(W0, Zero)), _mm_cmpgt_ps(W1, Zero));
+		glm_vec4 const Det = _mm_add_ps(_mm_add_ps(U, W0), W1);
+
+		// The distance has the sign of the determinant when the hit is in front of the origin.
+		glm_vec4 const Sign = _mm_and_ps(Det, SignBit);
+		glm_vec4 const T = _mm_mul_ps(Sz, _mm_add_ps(_mm_add_ps(_mm_mul_ps(U, z[0]), _mm_mul_ps(W0, z[1])), _mm_mul_ps(W1, z[2])));
+		glm_vec4 const t = _mm_div_ps(_mm_xor_ps(T, Sign), _mm_xor_ps(Det, Sign));
+
+		glm_vec4 Hit = _mm_andnot_ps(_mm_and_ps(Negative, Positive), _mm_cmpneq_ps(Det, Zero));
+		Hit = _mm_and_ps(Hit, _mm_cmpgt_ps(_mm_xor_ps(T, Sign), Zero));
+		Hit = _mm_and_ps(Hit, _mm_cmplt_ps(t, Best));
+		Hit = _mm_and_ps(Hit, _mm_castsi128_ps(_mm_cmplt_epi32(Index, Last)));
+		Best = _mm_or_ps(_mm_and_ps(Hit, t), _mm_andnot_ps(Hit, Best));
+		BestIndex = _mm_or_si128(_mm_and_si128(_mm_castps_si128(Hit), Index), _mm_andnot_si128(_mm_castps_si128(Hit), BestIndex));
+	}
+
+	float Distances[4];
+	int Indices[4];
+	_mm_storeu_ps(Distances, Best);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(Indices), BestIndex);
+	return glm_batch_closest(Distances, Indices, 4, Count, Distance);
+}
+
+inline GLM_BATCH_AVX2 std::size_t glm_sphere_frustum_batch_avx2(float const* Planes, float const* Centers, std::size_t Stride, float const* Radii, std::size_t RadiusStride, std::size_t Count, unsigned int* Visible)
+{
+	__m256 p[24];
+	for(int k = 0; k < 24; ++k)
+		p[k] = _mm256_set1_ps(Planes[k]);
+	__m256 const CommonRadius = _mm256_set1_ps(Radii[0]);
+
+	std::size_t Written = 0;
+	for(std::size_t i = 0; i < Count; i += 8)
+	{
+		__m256 const x = _mm256_load_ps(Centers + i);
+		__m256 const y = _mm256_load_ps(Centers + Stride + i);
+		__m256 const z = _mm256_load_ps(Centers + 2 * Stride + i);
+		__m256 const r = RadiusStride ? _mm256_load_ps(Radii + i) : CommonRadius;
+
+		__m256 d = _mm256_fmadd_ps(p[0], x, _mm256_fmadd_ps(p[1], y, _mm256_fmadd_ps(p[2], z, p[3])));
+		for(int k = 1; k < 6; ++k)
+			d = _mm256_min_ps(d, _mm256_fmadd_ps(p[k * 4], x, _mm256_fmadd_ps(p[k * 4 + 1], y, _mm256_fmadd_ps(p[k * 4 + 2], z, p[k * 4 + 3]))));
+		int const Mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_add_ps(d, r), _mm256_setzero_ps(), _CMP_GE_OQ));
+
+		Written = glm_batch_compact(Mask, static_cast<unsigned int>(i), Count - i < 8 ? Count - i : 8, Visible, Written);
+	}
+	return Written;
+}
+
+inline GLM_BATCH_AVX2 std::size_t glm_aabb_frustum_batch_avx2(float const* Planes, float const* Min, std::size_t MinStride, float const* Max, std::size_t MaxStride, std::size_t Count, unsigned int* Visible)
+{
+	__m256 p[24];
+	int Corner[6][3];
+	for(int k = 0; k < 6; ++k)
+	for(int c = 0; c < 4; ++c)
+	{
+		p[k * 4 + c] = _mm256_set1_ps(Planes[k * 4 + c]);
+		if(c < 3)
+			Corner[k][c] = Planes[k * 4 + c] < 0.0f ? 0 : 1;
+	}
+
+	std::size_t Written = 0;
+	for(std::size_t i = 0; i < Count; i += 8)
+	{
+		__m256 b[2][3];
+		for(int c = 0; c < 3; ++c)
+		{
+			b[0][c] = _mm256_load_ps(Min + c * MinStride + i);
+			b[1][c] = _mm256_load_ps(Max + c * MaxStride + i);
+		}
+
+		__m256 d = _mm256_set1_ps(FLT_MAX);
+		for(int k = 0; k < 6; ++k)
+			d = _mm256_min_ps(d, _mm256_fmadd_ps(p[k * 4], b[Corner[k][0]][0], _mm256_fmadd_ps(p[k * 4 + 1], b[Corner[k][1]][1], _mm256_fmadd_ps(p[k * 4 + 2], b[Corner[k][2]][2], p[k * 4 + 3]))));
+		int const Mask = _mm256_movemask_ps(_mm256_cmp_ps(d, _mm256_setzero_ps(), _CMP_GE_OQ));
+
+		Written = glm_batch_compact(Mask, static_cast<unsigned int>(i), Count - i < 8 ? Count - i : 8, Visible, Written);
+	}
+	return Written;
+}
+
+inline GLM_BATCH_AVX2 std::size_t glm_ray_sphere_batch_avx2(float const* Orig, float const* Dir, float const* Centers, std::size_t Stride, float const* Radii, std::size_t RadiusStride, std::size_t Count, float& Distance)
+{
+	__m256 const ox = _mm256_set1_ps(Orig[0]), oy = _mm256_set1_ps(Orig[1]), oz = _mm256_set1_ps(Orig[2]);
+	__m256 const dx = _mm256_set1_ps(Dir[0]), dy = _mm256_set1_ps(Dir[1]), dz = _mm256_set1_ps(Dir[2]);
+	__m256 const CommonRadius = _mm256_set1_ps(Radii[0]);
+	__m256 const Epsilon = _mm256_set1_ps(FLT_EPSILON);
+	__m256i const Last = _mm256_set1_epi32(static_cast<int>(Count));
+
+	__m256 Best = _mm256_set1_ps(FLT_MAX);
+	__m256i BestIndex = _mm256_set1_epi32(-1);
+	__m256i Index = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+	for(std::size_t i = 0; i < Count; i += 8, Index = _mm256_add_epi32(Index, _mm256_set1_epi32(8)))
+	{
+		__m256 const x = _mm256_sub_ps(_mm256_load_ps(Centers + i), ox);
+		__m256 const y = _mm256_sub_ps(_mm256_load_ps(Centers + Stride + i), oy);
+		__m256 const z = _mm256_sub_ps(_mm256_load_ps(Centers + 2 * Stride + i), oz);
+		__m256 const r = RadiusStride ? _mm256_load_ps(Radii + i) : CommonRadius;
+
+		__m256 const t0 = _mm256_fmadd_ps(x, dx, _mm256_fmadd_ps(y, dy, _mm256_mul_ps(z, dz)));
+		__m256 const d2 = _mm256_fnmadd_ps(t0, t0, _mm256_fmadd_ps(x, x, _mm256_fmadd_ps(y, y, _mm256_mul_ps(z, z))));
+		__m256 const r2 = _mm256_mul_ps(r, r);
+		__m256 const t1 = _mm256_sqrt_ps(_mm256_max_ps(_mm256_sub_ps(r2, d2), _mm256_setzero_ps()));
+		__m256 const Front = _mm256_cmp_ps(t0, _mm256_add_ps(t1, Epsilon), _CMP_GT_OQ);
+		__m256 const t = _mm256_blendv_ps(_mm256_add_ps(t0, t1), _mm256_sub_ps(t0, t1), Front);
+
+		__m256 Hit = _mm256_and_ps(_mm256_cmp_ps(d2, r2, _CMP_LE_OQ), _mm256_cmp_ps(t, Epsilon, _CMP_GT_OQ));
+		Hit = _mm256_and_ps(Hit, _mm256_cmp_ps(t, Best, _CMP_LT_OQ));
+		Hit = _mm256_and_ps(Hit, _mm256_castsi256_ps(_mm256_cmpgt_epi32(Last, Index)));
+		Best = _mm256_blendv_ps(Best, t, Hit);
+		BestIndex = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(BestIndex), _mm256_castsi256_ps(Index), Hit));
+	}
+
+	float Distances[8];
+	int Indices[8];
+	_mm256_storeu_ps(Distances, Best);
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(Indices), BestIndex);
+	return glm_batch_closest(Distances, Indices, 8, Count, Distance);
+}
+
+inline GLM_BATCH_AVX2 std::size_t glm_ray_triangle_batch_avx2(float const* const* V, float const* Orig, float const* S, std::size_t Count, float& Distance)
+{
+	__m256 const o[3] = {_mm256_set1_ps(Orig[0]), _mm256_set1_ps(Orig[1]), _mm256_set1_ps(Orig[2])};
+	__m256 const Sx = _mm256_set1_ps(S[0]), Sy = _mm256_set1_ps(S[1]), Sz = _mm256_set1_ps(S[2]);
+	__m256 const Zero = _mm256_setzero_ps();
+	__m256 const SignBit = _mm256_set1_ps(-0.0f);
+	__m256i const Last = _mm256_set1_epi32(static_cast<int>(Count));
+
+	__m256 Best = _mm256_set1_ps(FLT_MAX);
+	__m256i BestIndex = _mm256_set1_epi32(-1);
+	__m256i Index = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+	for(std::size_t i = 0; i < Count; i += 8, Index = _mm256_add_epi32(Index, _mm256_set1_epi32(8)))
+	{
+		__m256 x[3], y[3], z[3];
+		for(int k = 0; k < 3; ++k)
+		{
+			z[k] = _mm256_sub_ps(_mm256_load_ps(V[k * 3 + 2] + i), o[2]);
+			x[k] = _mm256_fnmadd_ps(Sx, z[k], _mm256_sub_ps(_mm256_load_ps(V[k * 3] + i), o[0]));
+			y[k] = _mm256_fnmadd_ps(Sy, z[k], _mm256_sub_ps(_mm256_load_ps(V[k * 3 + 1] + i), o[1]));
+		}
+
+		__m256 const U = _mm256_fmsub_ps(x[2], y[1], _mm256_mul_ps(y[2], x[1]));
+		__m256 const W0 = _mm256_fmsub_ps(x[0], y[2], _mm256_mul_ps(y[0], x[2]));
+		__m256 const W1 = _mm256_fmsub_ps(x[1], y[0], _mm256_mul_ps(y[1], x[0]));
+
+		__m256 const Negative = _mm256_or_ps(_mm256_or_ps(_mm256_cmp_ps(U, Zero, _CMP_LT_OQ), _mm256_cmp_ps(W0, Zero, _CMP_LT_OQ)), _mm256_cmp_ps(W1, Zero, _CMP_LT_OQ));
+		__m256 const Positive = _mm256_or_ps(_mm256_or_ps(_mm256_cmp_ps(U, Zero, _CMP_GT_OQ), _mm256_cmp_ps(W0, Zero, _CMP_GT_OQ)), _mm256_cmp_ps(W1, Zero, _CMP_GT_OQ));
+		__m256 const Det = _mm256_add_ps(_mm256_add_ps(U, W0), W1);
+
+		__m256 const Sign = _mm256_and_ps(Det, SignBit);
+		__m256 const T = _mm256_xor_ps(_mm256_mul_ps(Sz, _mm256_fmadd_ps(U, z[0], _mm256_fmadd_ps(W0, z[1], _mm256_mul_ps(W1, z[2])))), Sign);
+		__m256 const t = _mm256_div_ps(T, _mm256_xor_ps(Det, Sign));
+
+		__m256 Hit = _mm256_andnot_ps(_mm256_and_ps(Negative, Positive), _mm256_cmp_ps(Det, Zero, _CMP_NEQ_UQ));
+		Hit = _mm256_and_ps(Hit, _mm256_cmp_ps(T, Zero, _CMP_GT_OQ));
+		Hit = _mm256_and_ps(Hit, _mm256_cmp_ps(t, Best, _CMP_LT_OQ));
+		Hit = _mm256_and_ps(Hit, _mm256_castsi256_ps(_mm256_cmpgt_epi32(Last, Index)));
+		Best = _mm256_blendv_ps(Best, t, Hit);
+		BestIndex = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(BestIndex), _mm256_castsi256_ps(Index), Hit));
+	}
+
+	float Distances[8];
+	int Indices[8];
+	_mm256_storeu_ps(Distances, Best);
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(Indices), BestIndex);
+	return glm_batch_closest(Distances, Indices, 8, Count, Distance);
+}
+
+#endif//GLM_BATCH_X86
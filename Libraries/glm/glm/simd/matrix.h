@@ -1025,4 +1025,178 @@ GLM_FUNC_QUALIFIER void glm_mat4_outerProduct(__m128 const& c, __m128 const& r,
 	out[3] = _mm_mul_ps(c, _mm_shuffle_ps(r, r, _MM_SHUFFLE(3, 3, 3, 3)));
 }
 
-#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+#elif GLM_ARCH & GLM_ARCH_NEON_BIT
+
+GLM_FUNC_QUALIFIER void glm_mat4_matrixCompMult(glm_vec4 const in1[4], glm_vec4 const in2[4], glm_vec4 out[4])
+{
+	out[0] = vmulq_f32(in1[0], in2[0]);
+	out[1] = vmulq_f32(in1[1], in2[1]);
+	out[2] = vmulq_f32(in1[2], in2[2]);
+	out[3] = vmulq_f32(in1[3], in2[3]);
+}
+
+GLM_FUNC_QUALIFIER void glm_mat4_add(glm_vec4 const in1[4], glm_vec4 const in2[4], glm_vec4 out[4])
+{
+	out[0] = vaddq_f32(in1[0], in2[0]);
+	out[1] = vaddq_f32(in1[1], in2[1]);
+	out[2] = vaddq_f32(in1[2], in2[2]);
+	out[3] = vaddq_f32(in1[3], in2[3]);
+}
+
+GLM_FUNC_QUALIFIER void glm_mat4_sub(glm_vec4 const in1[4], glm_vec4 const in2[4], glm_vec4 out[4])
+{
+	out[0] = vsubq_f32(in1[0], in2[0]);
+	out[1] = vsubq_f32(in1[1], in2[1]);
+	out[2] = vsubq_f32(in1[2], in2[2]);
+	out[3] = vsubq_f32(in1[3], in2[3]);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_mat4_mul_vec4(glm_vec4 const m[4], glm_vec4 v)
+{
+	float32x2_t const xy = vget_low_f32(v);
+	float32x2_t const zw = vget_high_f32(v);
+
+	glm_vec4 const m0 = vmulq_lane_f32(m[0], xy, 0);
+	glm_vec4 const m1 = vmulq_lane_f32(m[1], xy, 1);
+	glm_vec4 const a0 = vmlaq_lane_f32(m0, m[2], zw, 0);
+	glm_vec4 const a1 = vmlaq_lane_f32(m1, m[3], zw, 1);
+
+	return vaddq_f32(a0, a1);
+}
+
+GLM_FUNC_QUALIFIER void glm_mat4_transpose(glm_vec4 const in[4], glm_vec4 out[4])
+{
+	float32x4x2_t const trn0 = vtrnq_f32(in[0], in[1]);
+	float32x4x2_t const trn1 = vtrnq_f32(in[2], in[3]);
+
+	out[0] = vcombine_f32(vget_low_f32(trn0.val[0]), vget_low_f32(trn1.val[0]));
+	out[1] = vcombine_f32(vget_low_f32(trn0.val[1]), vget_low_f32(trn1.val[1]));
+	out[2] = vcombine_f32(vget_high_f32(trn0.val[0]), vget_high_f32(trn1.val[0]));
+	out[3] = vcombine_f32(vget_high_f32(trn0.val[1]), vget_high_f32(trn1.val[1]));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_mul_mat4(glm_vec4 v, glm_vec4 const m[4])
+{
+	glm_vec4 const m0 = vmulq_f32(v, m[0]);
+	glm_vec4 const m1 = vmulq_f32(v, m[1]);
+	glm_vec4 const m2 = vmulq_f32(v, m[2]);
+	glm_vec4 const m3 = vmulq_f32(v, m[3]);
+
+#	if GLM_NEON_AARCH64
+		return vpaddq_f32(vpaddq_f32(m0, m1), vpaddq_f32(m2, m3));
+#	else
+		glm_vec4 const mul[4] = {m0, m1, m2, m3};
+		glm_vec4 trn[4];
+		glm_mat4_transpose(mul, trn);
+		return vaddq_f32(vaddq_f32(trn[0], trn[1]), vaddq_f32(trn[2], trn[3]));
+#	endif
+}
+
+GLM_FUNC_QUALIFIER void glm_mat4_mul(glm_vec4 const in1[4], glm_vec4 const in2[4], glm_vec4 out[4])
+{
+	out[0] = glm_mat4_mul_vec4(in1, in2[0]);
+	out[1] = glm_mat4_mul_vec4(in1, in2[1]);
+	out[2] = glm_mat4_mul_vec4(in1, in2[2]);
+	out[3] = glm_mat4_mul_vec4(in1, in2[3]);
+}
+
+// (v[1], v[0], v[0], v[0])
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_swizzle_yxxx(glm_vec4 v)
+{
+	float32x2_t const xy = vget_low_f32(v);
+	return vcombine_f32(vrev64_f32(xy), vdup_lane_f32(xy, 0));
+}
+
+// (v[2], v[2], v[1], v[1])
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_swizzle_zzyy(glm_vec4 v)
+{
+	return vcombine_f32(vdup_lane_f32(vget_high_f32(v), 0), vdup_lane_f32(vget_low_f32(v), 1));
+}
+
+// (v[3], v[3], v[3], v[2])
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_swizzle_wwwz(glm_vec4 v)
+{
+	float32x2_t const zw = vget_high_f32(v);
+	return vcombine_f32(vdup_lane_f32(zw, 1), vrev64_f32(zw));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_mat4_determinant(glm_vec4 const m[4])
+{
+	// Same cofactor expansion along the first column as the SSE version, with the 2x2 sub determinants
+	//	SubFactor(p, q) = m[2][p] * m[3][q] - m[3][p] * m[2][q]
+	// laid out so that
+	//	DetCof = m[1].yxxx * FacA - m[1].zzyy * FacB + m[1].wwwz * FacC
+	glm_vec4 const P2 = glm_vec4_swizzle_yxxx(m[2]);
+	glm_vec4 const Q2 = glm_vec4_swizzle_zzyy(m[2]);
+	glm_vec4 const R2 = glm_vec4_swizzle_wwwz(m[2]);
+	glm_vec4 const P3 = glm_vec4_swizzle_yxxx(m[3]);
+	glm_vec4 const Q3 = glm_vec4_swizzle_zzyy(m[3]);
+	glm_vec4 const R3 = glm_vec4_swizzle_wwwz(m[3]);
+
+	glm_vec4 const FacA = vmlsq_f32(vmulq_f32(Q2, R3), Q3, R2);
+	glm_vec4 const FacB = vmlsq_f32(vmulq_f32(P2, R3), P3, R2);
+	glm_vec4 const FacC = vmlsq_f32(vmulq_f32(P2, Q3), P3, Q2);
+
+	glm_vec4 const Mul0 = vmulq_f32(glm_vec4_swizzle_yxxx(m[1]), FacA);
+	glm_vec4 const Sub0 = vmlsq_f32(Mul0, glm_vec4_swizzle_zzyy(m[1]), FacB);
+	glm_vec4 const Add0 = vmlaq_f32(Sub0, glm_vec4_swizzle_wwwz(m[1]), FacC);
+	glm_vec4 const DetCof = vmulq_f32(Add0, glm_vec4_set(1.0f, -1.0f, 1.0f, -1.0f));
+
+	return glm_vec4_dot(m[0], DetCof);
+}
+
+GLM_FUNC_QUALIFIER void glm_mat4_inverse(glm_vec4 const in[4], glm_vec4 out[4])
+{
+	// Same algorithm as the SSE version. Each of its shuffled operands is a column of a small transposed matrix:
+	//	X[p] = (m[2][p], m[2][p], m[1][p], m[1][p])
+	//	Y[p] = (m[3][p], m[3][p], m[3][p], m[2][p])
+	//	Vec[p] = (m[1][p], m[0][p], m[0][p], m[0][p])
+	glm_vec4 X[4], Y[4], Vec[4];
+	{
+		glm_vec4 const SrcX[4] = {in[2], in[2], in[1], in[1]};
+		glm_vec4 const SrcY[4] = {in[3], in[3], in[3], in[2]};
+		glm_vec4 const SrcVec[4] = {in[1], in[0], in[0], in[0]};
+		glm_mat4_transpose(SrcX, X);
+		glm_mat4_transpose(SrcY, Y);
+		glm_mat4_transpose(SrcVec, Vec);
+	}
+
+	// FacN[0] = SubFactor0N = m[2][p] * m[3][q] - m[3][p] * m[2][q], and so on down the rows.
+	glm_vec4 const Fac0 = vmlsq_f32(vmulq_f32(X[2], Y[3]), Y[2], X[3]);
+	glm_vec4 const Fac1 = vmlsq_f32(vmulq_f32(X[1], Y[3]), Y[1], X[3]);
+	glm_vec4 const Fac2 = vmlsq_f32(vmulq_f32(X[1], Y[2]), Y[1], X[2]);
+	glm_vec4 const Fac3 = vmlsq_f32(vmulq_f32(X[0], Y[3]), Y[0], X[3]);
+	glm_vec4 const Fac4 = vmlsq_f32(vmulq_f32(X[0], Y[2]), Y[0], X[2]);
+	glm_vec4 const Fac5 = vmlsq_f32(vmulq_f32(X[0], Y[1]), Y[0], X[1]);
+
+	glm_vec4 const SignA = glm_vec4_set(-1.0f, 1.0f,-1.0f, 1.0f);
+	glm_vec4 const SignB = glm_vec4_set( 1.0f,-1.0f, 1.0f,-1.0f);
+
+	glm_vec4 const Inv0 = vmulq_f32(SignB, vmlaq_f32(vmlsq_f32(vmulq_f32(Vec[1], Fac0), Vec[2], Fac1), Vec[3], Fac2));
+	glm_vec4 const Inv1 = vmulq_f32(SignA, vmlaq_f32(vmlsq_f32(vmulq_f32(Vec[0], Fac0), Vec[2], Fac3), Vec[3], Fac4));
+	glm_vec4 const Inv2 = vmulq_f32(SignB, vmlaq_f32(vmlsq_f32(vmulq_f32(Vec[0], Fac1), Vec[1], Fac3), Vec[3], Fac5));
+	glm_vec4 const Inv3 = vmulq_f32(SignA, vmlaq_f32(vmlsq_f32(vmulq_f32(Vec[0], Fac2), Vec[1], Fac4), Vec[2], Fac5));
+
+	// (Inv0[0], Inv1[0], Inv2[0], Inv3[0])
+	float32x4x2_t const trn0 = vtrnq_f32(Inv0, Inv1);
+	float32x4x2_t const trn1 = vtrnq_f32(Inv2, Inv3);
+	glm_vec4 const Row0 = vcombine_f32(vget_low_f32(trn0.val[0]), vget_low_f32(trn1.val[0]));
+
+	glm_vec4 const Det0 = glm_vec4_dot(in[0], Row0);
+	glm_vec4 const Rcp0 = glm_vec4_div(vdupq_n_f32(1.0f), Det0);
+
+	out[0] = vmulq_f32(Inv0, Rcp0);
+	out[1] = vmulq_f32(Inv1, Rcp0);
+	out[2] = vmulq_f32(Inv2, Rcp0);
+	out[3] = vmulq_f32(Inv3, Rcp0);
+}
+
+GLM_FUNC_QUALIFIER void glm_mat4_outerProduct(glm_vec4 const& c, glm_vec4 const& r, glm_vec4 out[4])
+{
+	out[0] = vmulq_lane_f32(c, vget_low_f32(r), 0);
+	out[1] = vmulq_lane_f32(c, vget_low_f32(r), 1);
+	out[2] = vmulq_lane_f32(c, vget_high_f32(r), 0);
+	out[3] = vmulq_lane_f32(c, vget_high_f32(r), 1);
+}
+
+#endif//GLM_ARCH
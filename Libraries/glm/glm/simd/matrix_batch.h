@@ -0,0 +1,497 @@
+/// @ref simd
+/// @file glm/simd/matrix_batch.h
+///
+/// Kernels for GLM_GTX_matrix_batch: products, inverses and vector transforms over arrays of 4x4 float matrices.
+/// Matrices are 16 column major floats, vectors 4 floats, no alignment is required.
+///
+/// The AVX2 and AVX-512 kernels are compiled with function level target attributes, so they're available even when
+/// the rest of the program is built for SSE2. glm_batch_cpu_isa tells which of them the running CPU can execute.
+
+#pragma once
+
+#include "matrix.h"
+
+#include <cstddef>
+
+#define GLM_BATCH_ISA_SCALAR	0
+#define GLM_BATCH_ISA_SSE2		1
+#define GLM_BATCH_ISA_AVX2		2
+#define GLM_BATCH_ISA_AVX512	3
+
+#if (GLM_ARCH & GLM_ARCH_SSE2_BIT) && (GLM_COMPILER & (GLM_COMPILER_GCC | GLM_COMPILER_CLANG | GLM_COMPILER_VC))
+#	define GLM_BATCH_X86 1
+#	include <immintrin.h>
+#	if GLM_COMPILER & GLM_COMPILER_VC
+#		include <intrin.h>
+		// Visual C++ lets any function use any intrinsic.
+#		define GLM_BATCH_AVX2
+#		define GLM_BATCH_AVX512
+#	else
+#		define GLM_BATCH_AVX2 __attribute__((target("avx2,fma")))
+#		define GLM_BATCH_AVX512 __attribute__((target("avx512f,avx2,fma")))
+#	endif
+#	define GLM_BATCH_AVX2_INLINE GLM_INLINE GLM_BATCH_AVX2
+#	define GLM_BATCH_AVX512_INLINE GLM_INLINE GLM_BATCH_AVX512
+#else
+#	define GLM_BATCH_X86 0
+#endif
+
+#if GLM_BATCH_X86
+
+namespace glm{
+namespace detail
+{
+#	if GLM_COMPILER & GLM_COMPILER_VC
+	// GCC and Clang already define the arithmetic operators on vector types, the structure of arrays kernels rely on them.
+	GLM_FUNC_QUALIFIER __m128 operator+(__m128 a, __m128 b) { return _mm_add_ps(a, b); }
+	GLM_FUNC_QUALIFIER __m128 operator-(__m128 a, __m128 b) { return _mm_sub_ps(a, b); }
+	GLM_FUNC_QUALIFIER __m128 operator*(__m128 a, __m128 b) { return _mm_mul_ps(a, b); }
+	GLM_FUNC_QUALIFIER __m256 operator+(__m256 a, __m256 b) { return _mm256_add_ps(a, b); }
+	GLM_FUNC_QUALIFIER __m256 operator-(__m256 a, __m256 b) { return _mm256_sub_ps(a, b); }
+	GLM_FUNC_QUALIFIER __m256 operator*(__m256 a, __m256 b) { return _mm256_mul_ps(a, b); }
+	GLM_FUNC_QUALIFIER __m256 operator/(__m256 a, __m256 b) { return _mm256_div_ps(a, b); }
+	GLM_FUNC_QUALIFIER __m256 operator-(__m256 a) { return _mm256_sub_ps(_mm256_setzero_ps(), a); }
+	GLM_FUNC_QUALIFIER __m512 operator+(__m512 a, __m512 b) { return _mm512_add_ps(a, b); }
+	GLM_FUNC_QUALIFIER __m512 operator-(__m512 a, __m512 b) { return _mm512_sub_ps(a, b); }
+	GLM_FUNC_QUALIFIER __m512 operator*(__m512 a, __m512 b) { return _mm512_mul_ps(a, b); }
+	GLM_FUNC_QUALIFIER __m512 operator/(__m512 a, __m512 b) { return _mm512_div_ps(a, b); }
+	GLM_FUNC_QUALIFIER __m512 operator-(__m512 a) { return _mm512_sub_ps(_mm512_setzero_ps(), a); }
+#	endif
+
+	// Inverse of N matrices at once, in structure of arrays form: a[i] holds element i of every matrix.
+	// Cofactors through 2x2 sub-determinants. Written against the transposed matrix, which gives the transposed
+	// inverse, so indexing the column major storage as row major still produces the inverse in column major order.
+	template<typename V>
+	GLM_FUNC_QUALIFIER void glm_soa_mat4_inverse(V const a[16], V const& one, V r[16])
+	{
+		V const s0 = a[0] * a[5] - a[4] * a[1];
+		V const s1 = a[0] * a[6] - a[4] * a[2];
+		V const s2 = a[0] * a[7] - a[4] * a[3];
+		V const s3 = a[1] * a[6] - a[5] * a[2];
+		V const s4 = a[1] * a[7] - a[5] * a[3];
+		V const s5 = a[2] * a[7] - a[6] * a[3];
+
+		V const c5 = a[10] * a[15] - a[14] * a[11];
+		V const c4 = a[9] * a[15] - a[13] * a[11];
+		V const c3 = a[9] * a[14] - a[13] * a[10];
+		V const c2 = a[8] * a[15] - a[12] * a[11];
+		V const c1 = a[8] * a[14] - a[12] * a[10];
+		V const c0 = a[8] * a[13] - a[12] * a[9];
+
+		V const det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+		V const invDet = one / det;
+
+		r[0] = (a[5] * c5 - a[6] * c4 + a[7] * c3) * invDet;
+		r[1] = (a[2] * c4 - a[1] * c5 - a[3] * c3) * invDet;
+		r[2] = (a[13] * s5 - a[14] * s4 + a[15] * s3) * invDet;
+		r[3] = (a[10] * s4 - a[9] * s5 - a[11] * s3) * invDet;
+
+		r[4] = (a[6] * c2 - a[4] * c5 - a[7] * c1) * invDet;
+		r[5] = (a[0] * c5 - a[2] * c2 + a[3] * c1) * invDet;
+		r[6] = (a[14] * s2 - a[12] * s5 - a[15] * s1) * invDet;
+		r[7] = (a[8] * s5 - a[10] * s2 + a[11] * s1) * invDet;
+
+		r[8] = (a[4] * c4 - a[5] * c2 + a[7] * c0) * invDet;
+		r[9] = (a[1] * c2 - a[0] * c4 - a[3] * c0) * invDet;
+		r[10] = (a[12] * s4 - a[13] * s2 + a[15] * s0) * invDet;
+		r[11] = (a[9] * s2 - a[8] * s4 - a[11] * s0) * invDet;
+
+		r[12] = (a[5] * c1 - a[4] * c3 - a[6] * c0) * invDet;
+		r[13] = (a[0] * c3 - a[1] * c1 + a[2] * c0) * invDet;
+		r[14] = (a[13] * s1 - a[12] * s3 - a[14] * s0) * invDet;
+		r[15] = (a[8] * s3 - a[9] * s1 + a[10] * s0) * invDet;
+	}
+}//namespace detail
+}//namespace glm
+
+/// Highest instruction set the running CPU (and OS, for the wider register state) supports.
+GLM_FUNC_QUALIFIER int glm_batch_cpu_isa()
+{
+#	if GLM_COMPILER & GLM_COMPILER_VC
+		int Info[4];
+		__cpuid(Info, 0);
+		int const MaxLeaf = Info[0];
+
+		__cpuid(Info, 1);
+		bool const OSXSave = (Info[2] & (1 << 27)) != 0;
+		bool const FMA = (Info[2] & (1 << 12)) != 0;
+		if(!OSXSave || !FMA || MaxLeaf < 7)
+			return GLM_BATCH_ISA_SSE2;
+
+		unsigned long long const XCR0 = _xgetbv(0);
+		__cpuidex(Info, 7, 0);
+		bool const AVX2 = (Info[1] & (1 << 5)) != 0 && (XCR0 & 0x06) == 0x06;
+		bool const AVX512 = (Info[1] & (1 << 16)) != 0 && (XCR0 & 0xE6) == 0xE6;
+#	else
+		__builtin_cpu_init();
+		bool const AVX2 = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+		bool const AVX512 = AVX2 && __builtin_cpu_supports("avx512f");
+#	endif
+
+	if(AVX512)
+		return GLM_BATCH_ISA_AVX512;
+	if(AVX2)
+		return GLM_BATCH_ISA_AVX2;
+	return GLM_BATCH_ISA_SSE2;
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+// SSE2, one matrix at a time with the existing kernels.
+
+// Out[i] = A[i] * B[i]. With StrideA == 0 the same A is used for every product.
+GLM_FUNC_QUALIFIER void glm_mat4_mul_batch_sse2(float const* A, std::size_t StrideA, float const* B, float* Out, std::size_t Count)
+{
+	for(std::size_t i = 0; i < Count; ++i, A += StrideA, B += 16, Out += 16)
+	{
+		glm_vec4 const a[4] = {_mm_loadu_ps(A), _mm_loadu_ps(A + 4), _mm_loadu_ps(A + 8), _mm_loadu_ps(A + 12)};
+		glm_vec4 const b[4] = {_mm_loadu_ps(B), _mm_loadu_ps(B + 4), _mm_loadu_ps(B + 8), _mm_loadu_ps(B + 12)};
+		glm_vec4 o[4];
+		glm_mat4_mul(a, b, o);
+		_mm_storeu_ps(Out, o[0]);
+		_mm_storeu_ps(Out + 4, o[1]);
+		_mm_storeu_ps(Out + 8, o[2]);
+		_mm_storeu_ps(Out + 12, o[3]);
+	}
+}
+
+GLM_FUNC_QUALIFIER void glm_mat4_inverse_batch_sse2(float const* In, float* Out, std::size_t Count)
+{
+	for(std::size_t i = 0; i < Count; ++i, In += 16, Out += 16)
+	{
+		glm_vec4 const m[4] = {_mm_loadu_ps(In), _mm_loadu_ps(In + 4), _mm_loadu_ps(In + 8), _mm_loadu_ps(In + 12)};
+		glm_vec4 o[4];
+		glm_mat4_inverse(m, o);
+		_mm_storeu_ps(Out, o[0]);
+		_mm_storeu_ps(Out + 4, o[1]);
+		_mm_storeu_ps(Out + 8, o[2]);
+		_mm_storeu_ps(Out + 12, o[3]);
+	}
+}
+
+// Out[i] = M[i] * In[i]. With StrideM == 0 the same M is used for every vector.
+GLM_FUNC_QUALIFIER void glm_mat4_mul_vec4_batch_sse2(float const* M, std::size_t StrideM, float const* In, float* Out, std::size_t Count)
+{
+	for(std::size_t i = 0; i < Count; ++i, M += StrideM, In += 4, Out += 4)
+	{
+		glm_vec4 const m[4] = {_mm_loadu_ps(M), _mm_loadu_ps(M + 4), _mm_loadu_ps(M + 8), _mm_loadu_ps(M + 12)};
+		_mm_storeu_ps(Out, glm_mat4_mul_vec4(m, _mm_loadu_ps(In)));
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+// AVX2, two matrices per register: the low 128 bit lane holds a column of the first matrix, the high lane the same column of the second.
+
+// Loads columns [Col, Col + 1] of two consecutive matrices and regroups them per column: {M0.Col, M1.Col}, {M0.Col+1, M1.Col+1}.
+GLM_BATCH_AVX2_INLINE void glm_batch_load_pair_avx2(float const* M0, float const* M1, __m256 c[4])
+{
+	__m256 const a01 = _mm256_loadu_ps(M0);
+	__m256 const a23 = _mm256_loadu_ps(M0 + 8);
+	__m256 const b01 = _mm256_loadu_ps(M1);
+	__m256 const b23 = _mm256_loadu_ps(M1 + 8);
+	c[0] = _mm256_permute2f128_ps(a01, b01, 0x20);
+	c[1] = _mm256_permute2f128_ps(a01, b01, 0x31);
+	c[2] = _mm256_permute2f128_ps(a23, b23, 0x20);
+	c[3] = _mm256_permute2f128_ps(a23, b23, 0x31);
+}
+
+GLM_BATCH_AVX2_INLINE void glm_batch_store_pair_avx2(__m256 const c[4], float* M0, float* M1)
+{
+	_mm256_storeu_ps(M0, _mm256_permute2f128_ps(c[0], c[1], 0x20));
+	_mm256_storeu_ps(M0 + 8, _mm256_permute2f128_ps(c[2], c[3], 0x20));
+	_mm256_storeu_ps(M1, _mm256_permute2f128_ps(c[0], c[1], 0x31));
+	_mm256_storeu_ps(M1 + 8, _mm256_permute2f128_ps(c[2], c[3], 0x31));
+}
+
+// Per lane matrix * vector, with the vector components splatted inside each lane.
+GLM_BATCH_AVX2_INLINE __m256 glm_batch_mul_vec_avx2(__m256 const m[4], __m256 v)
+{
+	__m256 r = _mm256_mul_ps(m[0], _mm256_permute_ps(v, 0x00));
+	r = _mm256_fmadd_ps(m[1], _mm256_permute_ps(v, 0x55), r);
+	r = _mm256_fmadd_ps(m[2], _mm256_permute_ps(v, 0xAA), r);
+	r = _mm256_fmadd_ps(m[3], _mm256_permute_ps(v, 0xFF), r);
+	return r;
+}
+
+inline GLM_BATCH_AVX2 void glm_mat4_mul_batch_avx2(float const* A, std::size_t StrideA, float const* B, float* Out, std::size_t Count)
+{
+	std::size_t i = 0;
+	__m256 a[4];
+	for(int k = 0; k < 4; ++k)
+		a[k] = StrideA == 0 ? _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(A + k * 4)) : _mm256_setzero_ps();
+
+	for(; i + 2 <= Count; i += 2, A += StrideA * 2, B += 32, Out += 32)
+	{
+		if(StrideA != 0)
+			glm_batch_load_pair_avx2(A, A + StrideA, a);
+
+		__m256 b[4], o[4];
+		glm_batch_load_pair_avx2(B, B + 16, b);
+		for(int j = 0; j < 4; ++j)
+			o[j] = glm_batch_mul_vec_avx2(a, b[j]);
+		glm_batch_store_pair_avx2(o, Out, Out + 16);
+	}
+
+	glm_mat4_mul_batch_sse2(A, StrideA, B, Out, Count - i);
+}
+
+inline GLM_BATCH_AVX2 void glm_mat4_mul_vec4_batch_avx2(float const* M, std::size_t StrideM, float const* In, float* Out, std::size_t Count)
+{
+	std::size_t i = 0;
+	__m256 m[4];
+
+	if(StrideM == 0)
+	{
+		for(int k = 0; k < 4; ++k)
+			m[k] = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(M + k * 4));
+
+		// Two independent chains per iteration to hide the FMA latency.
+		for(; i + 4 <= Count; i += 4, In += 16, Out += 16)
+		{
+			__m256 const r0 = glm_batch_mul_vec_avx2(m, _mm256_loadu_ps(In));
+			__m256 const r1 = glm_batch_mul_vec_avx2(m, _mm256_loadu_ps(In + 8));
+			_mm256_storeu_ps(Out, r0);
+			_mm256_storeu_ps(Out + 8, r1);
+		}
+	}
+	else
+	{
+		for(; i + 2 <= Count; i += 2, M += StrideM * 2, In += 8, Out += 8)
+		{
+			glm_batch_load_pair_avx2(M, M + StrideM, m);
+			_mm256_storeu_ps(Out, glm_batch_mul_vec_avx2(m, _mm256_loadu_ps(In)));
+		}
+	}
+
+	glm_mat4_mul_vec4_batch_sse2(M, StrideM, In, Out, Count - i);
+}
+
+// 8x8 transpose of the rows r[0..7], the standard unpack / shuffle / lane permute sequence.
+GLM_BATCH_AVX2_INLINE void glm_batch_transpose8_avx2(__m256 r[8])
+{
+	__m256 const t0 = _mm256_unpacklo_ps(r[0], r[1]);
+	__m256 const t1 = _mm256_unpackhi_ps(r[0], r[1]);
+	__m256 const t2 = _mm256_unpacklo_ps(r[2], r[3]);
+	__m256 const t3 = _mm256_unpackhi_ps(r[2], r[3]);
+	__m256 const t4 = _mm256_unpacklo_ps(r[4], r[5]);
+	__m256 const t5 = _mm256_unpackhi_ps(r[4], r[5]);
+	__m256 const t6 = _mm256_unpacklo_ps(r[6], r[7]);
+	__m256 const t7 = _mm256_unpackhi_ps(r[6], r[7]);
+
+	__m256 const u0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+	__m256 const u1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+	__m256 const u2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+	__m256 const u3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+	__m256 const u4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+	__m256 const u5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+	__m256 const u6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+	__m256 const u7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+
+	r[0] = _mm256_permute2f128_ps(u0, u4, 0x20);
+	r[1] = _mm256_permute2f128_ps(u1, u5, 0x20);
+	r[2] = _mm256_permute2f128_ps(u2, u6, 0x20);
+	r[3] = _mm256_permute2f128_ps(u3, u7, 0x20);
+	r[4] = _mm256_permute2f128_ps(u0, u4, 0x31);
+	r[5] = _mm256_permute2f128_ps(u1, u5, 0x31);
+	r[6] = _mm256_permute2f128_ps(u2, u6, 0x31);
+	r[7] = _mm256_permute2f128_ps(u3, u7, 0x31);
+}
+
+// Eight matrices at a time, transposed to structure of arrays so every instruction works on one element of eight matrices.
+inline GLM_BATCH_AVX2 void glm_mat4_inverse_batch_avx2(float const* In, float* Out, std::size_t Count)
+{
+	std::size_t i = 0;
+	__m256 const One = _mm256_set1_ps(1.0f);
+
+	for(; i + 8 <= Count; i += 8, In += 128, Out += 128)
+	{
+		__m256 a[16], r[16];
+		for(int k = 0; k < 8; ++k)
+		{
+			a[k] = _mm256_loadu_ps(In + k * 16);
+			a[k + 8] = _mm256_loadu_ps(In + k * 16 + 8);
+		}
+		glm_batch_transpose8_avx2(a);
+		glm_batch_transpose8_avx2(a + 8);
+
+		glm::detail::glm_soa_mat4_inverse(a, One, r);
+
+		glm_batch_transpose8_avx2(r);
+		glm_batch_transpose8_avx2(r + 8);
+		for(int k = 0; k < 8; ++k)
+		{
+			_mm256_storeu_ps(Out + k * 16, r[k]);
+			_mm256_storeu_ps(Out + k * 16 + 8, r[k + 8]);
+		}
+	}
+
+	glm_mat4_inverse_batch_sse2(In, Out, Count - i);
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+// AVX-512, four matrices per register, one per 128 bit lane.
+//
+// The lane shuffles below use the zero masked forms with every lane selected. They're the same instructions, but the
+// unmasked ones pass _mm512_undefined_ps() as the merge source, which GCC 12 reports as uninitialized once they're
+// inlined into the target("avx512f") functions (-Wuninitialized/-Wmaybe-uninitialized in every including file).
+#define GLM_BATCH_ALL_LANES static_cast<__mmask16>(0xFFFF)
+
+// Turns four registers holding one whole matrix each into four registers holding one column of each matrix, and back (it's its own inverse).
+GLM_BATCH_AVX512_INLINE void glm_batch_transpose_lanes_avx512(__m512 m[4])
+{
+	__m512 const t0 = _mm512_maskz_shuffle_f32x4(GLM_BATCH_ALL_LANES, m[0], m[1], 0x44);
+	__m512 const t1 = _mm512_maskz_shuffle_f32x4(GLM_BATCH_ALL_LANES, m[0], m[1], 0xEE);
+	__m512 const t2 = _mm512_maskz_shuffle_f32x4(GLM_BATCH_ALL_LANES, m[2], m[3], 0x44);
+	__m512 const t3 = _mm512_maskz_shuffle_f32x4(GLM_BATCH_ALL_LANES, m[2], m[3], 0xEE);
+	m[0] = _mm512_maskz_shuffle_f32x4(GLM_BATCH_ALL_LANES, t0, t2, 0x88);
+	m[1] = _mm512_maskz_shuffle_f32x4(GLM_BATCH_ALL_LANES, t0, t2, 0xDD);
+	m[2] = _mm512_maskz_shuffle_f32x4(GLM_BATCH_ALL_LANES, t1, t3, 0x88);
+	m[3] = _mm512_maskz_shuffle_f32x4(GLM_BATCH_ALL_LANES, t1, t3, 0xDD);
+}
+
+GLM_BATCH_AVX512_INLINE __m512 glm_batch_mul_vec_avx512(__m512 const m[4], __m512 v)
+{
+	__m512 r = _mm512_mul_ps(m[0], _mm512_maskz_permute_ps(GLM_BATCH_ALL_LANES, v, 0x00));
+	r = _mm512_fmadd_ps(m[1], _mm512_maskz_permute_ps(GLM_BATCH_ALL_LANES, v, 0x55), r);
+	r = _mm512_fmadd_ps(m[2], _mm512_maskz_permute_ps(GLM_BATCH_ALL_LANES, v, 0xAA), r);
+	r = _mm512_fmadd_ps(m[3], _mm512_maskz_permute_ps(GLM_BATCH_ALL_LANES, v, 0xFF), r);
+	return r;
+}
+
+GLM_BATCH_AVX512_INLINE void glm_batch_load_quad_avx512(float const* M, std::size_t Stride, __m512 c[4])
+{
+	for(int k = 0; k < 4; ++k)
+		c[k] = _mm512_loadu_ps(M + k * Stride);
+	glm_batch_transpose_lanes_avx512(c);
+}
+
+inline GLM_BATCH_AVX512 void glm_mat4_mul_batch_avx512(float const* A, std::size_t StrideA, float const* B, float* Out, std::size_t Count)
+{
+	std::size_t i = 0;
+	__m512 a[4];
+	for(int k = 0; k < 4; ++k)
+		a[k] = StrideA == 0 ? _mm512_maskz_broadcast_f32x4(GLM_BATCH_ALL_LANES, _mm_loadu_ps(A + k * 4)) : _mm512_setzero_ps();
+
+	for(; i + 4 <= Count; i += 4, A += StrideA * 4, B += 64, Out += 64)
+	{
+		if(StrideA != 0)
+			glm_batch_load_quad_avx512(A, StrideA, a);
+
+		__m512 b[4], o[4];
+		glm_batch_load_quad_avx512(B, 16, b);
+		for(int j = 0; j < 4; ++j)
+			o[j] = glm_batch_mul_vec_avx512(a, b[j]);
+
+		glm_batch_transpose_lanes_avx512(o);
+		for(int k = 0; k < 4; ++k)
+			_mm512_storeu_ps(Out + k * 16, o[k]);
+	}
+
+	glm_mat4_mul_batch_avx2(A, StrideA, B, Out, Count - i);
+}
+
+inline GLM_BATCH_AVX512 void glm_mat4_mul_vec4_batch_avx512(float const* M, std::size_t StrideM, float const* In, float* Out, std::size_t Count)
+{
+	std::size_t i = 0;
+	__m512 m[4];
+
+	if(StrideM == 0)
+	{
+		for(int k = 0; k < 4; ++k)
+			m[k] = _mm512_maskz_broadcast_f32x4(GLM_BATCH_ALL_LANES, _mm_loadu_ps(M + k * 4));
+
+		for(; i + 8 <= Count; i += 8, In += 32, Out += 32)
+		{
+			__m512 const r0 = glm_batch_mul_vec_avx512(m, _mm512_loadu_ps(In));
+			__m512 const r1 = glm_batch_mul_vec_avx512(m, _mm512_loadu_ps(In + 16));
+			_mm512_storeu_ps(Out, r0);
+			_mm512_storeu_ps(Out + 16, r1);
+		}
+	}
+	else
+	{
+		for(; i + 4 <= Count; i += 4, M += StrideM * 4, In += 16, Out += 16)
+		{
+			glm_batch_load_quad_avx512(M, StrideM, m);
+			_mm512_storeu_ps(Out, glm_batch_mul_vec_avx512(m, _mm512_loadu_ps(In)));
+		}
+	}
+
+	glm_mat4_mul_vec4_batch_avx2(M, StrideM, In, Out, Count - i);
+}
+
+// 16x16 transpose of the rows r[0..15]: unpack, shuffle within lanes, then two rounds of 128 bit lane shuffles.
+GLM_BATCH_AVX512_INLINE void glm_batch_transpose16_avx512(__m512 r[16])
+{
+	__m512 t[16], u[16];
+	for(int j = 0; j < 16; j += 2)
+	{
+		t[j + 0] = _mm512_maskz_unpacklo_ps(GLM_BATCH_ALL_LANES, r[j], r[j + 1]);
+		t[j + 1] = _mm512_maskz_unpackhi_ps(GLM_BATCH_ALL_LANES, r[j], r[j + 1]);
+	}
+	for(int j = 0; j < 16; j += 4)
+	{
+		u[j + 0] = _mm512_maskz_shuffle_ps(GLM_BATCH_ALL_LANES, t[j + 0], t[j + 2], 0x44);
+		u[j + 1] = _mm512_maskz_shuffle_ps(GLM_BATCH_ALL_LANES, t[j + 0], t[j + 2], 0xEE);
+		u[j + 2] = _mm512_maskz_shuffle_ps(GLM_BATCH_ALL_LANES, t[j + 1], t[j + 3], 0x44);
+		u[j + 3] = _mm512_maskz_shuffle_ps(GLM_BATCH_ALL_LANES, t[j + 1], t[j + 3], 0xEE);
+	}
+	for(int c = 0; c < 4; ++c)
+	{
+		__m512 const v0 = _mm512_maskz_shuffle_f32x4(GLM_BATCH_ALL_LANES, u[c], u[c + 4], 0x88);
+		__m512 const v1 = _mm512_maskz_shuffle_f32x4(GLM_BATCH_ALL_LANES, u[c], u[c + 4], 0xDD);
+		__m512 const w0 = _mm512_maskz_shuffle_f32x4(GLM_BATCH_ALL_LANES, u[c + 8], u[c + 12], 0x88);
+		__m512 const w1 = _mm512_maskz_shuffle_f32x4(GLM_BATCH_ALL_LANES, u[c + 8], u[c + 12], 0xDD);
+		r[c + 0] = _mm512_maskz_shuffle_f32x4(GLM_BATCH_ALL_LANES, v0, w0, 0x88);
+		r[c + 4] = _mm512_maskz_shuffle_f32x4(GLM_BATCH_ALL_LANES, v1, w1, 0x88);
+		r[c + 8] = _mm512_maskz_shuffle_f32x4(GLM_BATCH_ALL_LANES, v0, w0, 0xDD);
+		r[c + 12] = _mm512_maskz_shuffle_f32x4(GLM_BATCH_ALL_LANES, v1, w1, 0xDD);
+	}
+}
+
+// Sixteen matrices at a time. One register per matrix is exactly a 16x16 transpose away from structure of arrays.
+inline GLM_BATCH_AVX512 void glm_mat4_inverse_batch_avx512(float const* In, float* Out, std::size_t Count)
+{
+	std::size_t i = 0;
+	__m512 const One = _mm512_set1_ps(1.0f);
+
+	for(; i + 16 <= Count; i += 16, In += 256, Out += 256)
+	{
+		__m512 a[16], r[16];
+		for(int k = 0; k < 16; ++k)
+			a[k] = _mm512_loadu_ps(In + k * 16);
+		glm_batch_transpose16_avx512(a);
+
+		glm::detail::glm_soa_mat4_inverse(a, One, r);
+
+		glm_batch_transpose16_avx512(r);
+		for(int k = 0; k < 16; ++k)
+			_mm512_storeu_ps(Out + k * 16, r[k]);
+	}
+
+	glm_mat4_inverse_batch_avx2(In, Out, Count - i);
+}
+
+#endif//GLM_BATCH_X86
+
+namespace glm{
+namespace detail
+{
+	GLM_FUNC_QUALIFIER int batch_supported_isa()
+	{
+#		if GLM_BATCH_X86
+			static int const Supported = glm_batch_cpu_isa();
+			return Supported;
+#		else
+			return GLM_BATCH_ISA_SCALAR;
+#		endif
+	}
+
+	// Shared by every translation unit, function local statics of inline functions have a single instance.
+	// Every batch kernel dispatches on it, the gtc ones included, setBatchInstructionSet changes it.
+	GLM_FUNC_QUALIFIER int& batch_current_isa()
+	{
+		static int Current = batch_supported_isa();
+		return Current;
+	}
+}//namespace detail
+}//namespace glm
@@ -0,0 +1,1078 @@
+/// @ref simd
+/// @file glm/simd/noise_batch.h
+///
+/// Kernels for GLM_GTX_noise_batch: the perlin and simplex noises of GLM_GTC_noise, one sample per lane.
+/// Each lane runs the operations of the scalar function in the same order, so the SSE2 kernels give the same
+/// results unless the compiler contracts some of them into FMA.
+/// The points are read with a stride or generated over a grid.
+/// The instruction set is picked at runtime, see matrix_batch.h.
+
+#pragma once
+
+#include "matrix_batch.h"
+#include "common.h"
+
+#include <cstddef>
+
+namespace glm{
+namespace detail
+{
+	// Sum over Octaves of Gain^k * f(noise(p * Lacunarity^k)), f(n) = n for fBm and (1 - |n|)^2 when Ridged.
+	// Basis is 0 for perlin and 1 for simplex.
+	struct noise_fractal
+	{
+		int Basis;
+		bool Ridged;
+		int Octaves;
+		float Lacunarity;
+		float Gain;
+	};
+}//namespace detail
+}//namespace glm
+
+#if GLM_BATCH_X86
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_noise_fract_sse2(glm_vec4 x)
+{
+	return _mm_sub_ps(x, glm_vec4_floor(x));
+}
+
+// x - floor(x * (1 / 289)) * 289, detail::mod289
+GLM_FUNC_QUALIFIER glm_vec4 glm_noise_mod289_sse2(glm_vec4 x)
+{
+	return _mm_sub_ps(x, _mm_mul_ps(glm_vec4_floor(_mm_mul_ps(x, _mm_set1_ps(1.0f / 289.0f))), _mm_set1_ps(289.0f)));
+}
+
+// x - 289 * floor(x / 289), mod(x, 289)
+GLM_FUNC_QUALIFIER glm_vec4 glm_noise_mod_sse2(glm_vec4 x)
+{
+	return _mm_sub_ps(x, _mm_mul_ps(_mm_set1_ps(289.0f), glm_vec4_floor(_mm_div_ps(x, _mm_set1_ps(289.0f)))));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_noise_permute_sse2(glm_vec4 x)
+{
+	return glm_noise_mod289_sse2(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(34.0f)), _mm_set1_ps(1.0f)), x));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_noise_taylor_inv_sqrt_sse2(glm_vec4 r)
+{
+	return _mm_sub_ps(_mm_set1_ps(1.79284291400159f), _mm_mul_ps(_mm_set1_ps(0.85373472095314f), r));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_noise_fade_sse2(glm_vec4 t)
+{
+	glm_vec4 const Poly = _mm_add_ps(_mm_mul_ps(t, _mm_sub_ps(_mm_mul_ps(t, _mm_set1_ps(6.0f)), _mm_set1_ps(15.0f))), _mm_set1_ps(10.0f));
+	return _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(t, t), t), Poly);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_noise_mix_sse2(glm_vec4 x, glm_vec4 y, glm_vec4 a)
+{
+	return _mm_add_ps(x, _mm_mul_ps(a, _mm_sub_ps(y, x)));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_noise_abs_sse2(glm_vec4 x)
+{
+	return _mm_andnot_ps(_mm_set1_ps(-0.0f), x);
+}
+
+// step(Edge, x): 0 when x < Edge, 1 otherwise
+GLM_FUNC_QUALIFIER glm_vec4 glm_noise_step_sse2(glm_vec4 Edge, glm_vec4 x)
+{
+	return _mm_and_ps(_mm_cmpnlt_ps(x, Edge), _mm_set1_ps(1.0f));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_noise_less_sse2(glm_vec4 x, glm_vec4 y)
+{
+	return _mm_and_ps(_mm_cmplt_ps(x, y), _mm_set1_ps(1.0f));
+}
+
+// Corner gradient of the 2D perlin noise dotted with the offset (fx, fy).
+GLM_FUNC_QUALIFIER glm_vec4 glm_perlin2_corner_sse2(glm_vec4 i, glm_vec4 fx, glm_vec4 fy)
+{
+	glm_vec4 gx = _mm_sub_ps(_mm_mul_ps(_mm_set1_ps(2.0f), glm_noise_fract_sse2(_mm_div_ps(i, _mm_set1_ps(41.0f)))), _mm_set1_ps(1.0f));
+	glm_vec4 gy = _mm_sub_ps(glm_noise_abs_sse2(gx), _mm_set1_ps(0.5f));
+	gx = _mm_sub_ps(gx, glm_vec4_floor(_mm_add_ps(gx, _mm_set1_ps(0.5f))));
+
+	glm_vec4 const Norm = glm_noise_taylor_inv_sqrt_sse2(_mm_add_ps(_mm_mul_ps(gx, gx), _mm_mul_ps(gy, gy)));
+	gx = _mm_mul_ps(gx, Norm);
+	gy = _mm_mul_ps(gy, Norm);
+	return _mm_add_ps(_mm_mul_ps(gx, fx), _mm_mul_ps(gy, fy));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_perlin_sse2(glm_vec4 const (&p)[2])
+{
+	glm_vec4 Pi0[2], Pi1[2], Pf0[2], Pf1[2];
+	for(int c = 0; c < 2; ++c)
+	{
+		glm_vec4 const Floor = glm_vec4_floor(p[c]);
+		Pi0[c] = glm_noise_mod_sse2(Floor);
+		Pi1[c] = glm_noise_mod_sse2(_mm_add_ps(Floor, _mm_set1_ps(1.0f)));
+		Pf0[c] = glm_noise_fract_sse2(p[c]);
+		Pf1[c] = _mm_sub_ps(Pf0[c], _mm_set1_ps(1.0f));
+	}
+
+	glm_vec4 const px0 = glm_noise_permute_sse2(Pi0[0]);
+	glm_vec4 const px1 = glm_noise_permute_sse2(Pi1[0]);
+	glm_vec4 const n00 = glm_perlin2_corner_sse2(glm_noise_permute_sse2(_mm_add_ps(px0, Pi0[1])), Pf0[0], Pf0[1]);
+	glm_vec4 const n10 = glm_perlin2_corner_sse2(glm_noise_permute_sse2(_mm_add_ps(px1, Pi0[1])), Pf1[0], Pf0[1]);
+	glm_vec4 const n01 = glm_perlin2_corner_sse2(glm_noise_permute_sse2(_mm_add_ps(px0, Pi1[1])), Pf0[0], Pf1[1]);
+	glm_vec4 const n11 = glm_perlin2_corner_sse2(glm_noise_permute_sse2(_mm_add_ps(px1, Pi1[1])), Pf1[0], Pf1[1]);
+
+	glm_vec4 const FadeX = glm_noise_fade_sse2(Pf0[0]);
+	glm_vec4 const FadeY = glm_noise_fade_sse2(Pf0[1]);
+	glm_vec4 const nx0 = glm_noise_mix_sse2(n00, n10, FadeX);
+	glm_vec4 const nx1 = glm_noise_mix_sse2(n01, n11, FadeX);
+	return _mm_mul_ps(_mm_set1_ps(2.3f), glm_noise_mix_sse2(nx0, nx1, FadeY));
+}
+
+// Corner gradient of the 3D perlin noise from the hash h, dotted with the offset f.
+GLM_FUNC_QUALIFIER glm_vec4 glm_perlin3_corner_sse2(glm_vec4 h, glm_vec4 fx, glm_vec4 fy, glm_vec4 fz)
+{
+	glm_vec4 gx = _mm_mul_ps(h, _mm_set1_ps(static_cast<float>(1.0 / 7.0)));
+	glm_vec4 gy = _mm_sub_ps(glm_noise_fract_sse2(_mm_mul_ps(glm_vec4_floor(gx), _mm_set1_ps(static_cast<float>(1.0 / 7.0)))), _mm_set1_ps(0.5f));
+	gx = glm_noise_fract_sse2(gx);
+	glm_vec4 const gz = _mm_sub_ps(_mm_sub_ps(_mm_set1_ps(0.5f), glm_noise_abs_sse2(gx)), glm_noise_abs_sse2(gy));
+	glm_vec4 const Zero = _mm_setzero_ps();
+	glm_vec4 const sz = glm_noise_step_sse2(gz, Zero);
+	gx = _mm_sub_ps(gx, _mm_mul_ps(sz, _mm_sub_ps(glm_noise_step_sse2(Zero, gx), _mm_set1_ps(0.5f))));
+	gy = _mm_sub_ps(gy, _mm_mul_ps(sz, _mm_sub_ps(glm_noise_step_sse2(Zero, gy), _mm_set1_ps(0.5f))));
+
+	glm_vec4 const Norm = glm_noise_taylor_inv_sqrt_sse2(_mm_add_ps(_mm_add_ps(_mm_mul_ps(gx, gx), _mm_mul_ps(gy, gy)), _mm_mul_ps(gz, gz)));
+	return _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_mul_ps(gx, Norm), fx), _mm_mul_ps(_mm_mul_ps(gy, Norm), fy)), _mm_mul_ps(_mm_mul_ps(gz, Norm), fz));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_perlin_sse2(glm_vec4 const (&p)[3])
+{
+	glm_vec4 Pi[2][3], Pf[2][3];
+	for(int c = 0; c < 3; ++c)
+	{
+		glm_vec4 const Floor = glm_vec4_floor(p[c]);
+		Pi[0][c] = glm_noise_mod289_sse2(Floor);
+		Pi[1][c] = glm_noise_mod289_sse2(_mm_add_ps(Floor, _mm_set1_ps(1.0f)));
+		Pf[0][c] = glm_noise_fract_sse2(p[c]);
+		Pf[1][c] = _mm_sub_ps(Pf[0][c], _mm_set1_ps(1.0f));
+	}
+
+	// n[x + 2 * y + 4 * z] for the corner (x, y, z)
+	glm_vec4 n[8];
+	for(int y = 0; y < 2; ++y)
+	for(int x = 0; x < 2; ++x)
+	{
+		glm_vec4 const ixy = glm_noise_permute_sse2(_mm_add_ps(glm_noise_permute_sse2(Pi[x][0]), Pi[y][1]));
+		for(int z = 0; z < 2; ++z)
+			n[x + 2 * y + 4 * z] = glm_perlin3_corner_sse2(glm_noise_permute_sse2(_mm_add_ps(ixy, Pi[z][2])), Pf[x][0], Pf[y][1], Pf[z][2]);
+	}
+
+	glm_vec4 const FadeX = glm_noise_fade_sse2(Pf[0][0]);
+	glm_vec4 const FadeY = glm_noise_fade_sse2(Pf[0][1]);
+	glm_vec4 const FadeZ = glm_noise_fade_sse2(Pf[0][2]);
+	glm_vec4 nz[4];
+	for(int k = 0; k < 4; ++k)
+		nz[k] = glm_noise_mix_sse2(n[k], n[k + 4], FadeZ);
+	glm_vec4 const nyz0 = glm_noise_mix_sse2(nz[0], nz[2], FadeY);
+	glm_vec4 const nyz1 = glm_noise_mix_sse2(nz[1], nz[3], FadeY);
+	return _mm_mul_ps(_mm_set1_ps(2.2f), glm_noise_mix_sse2(nyz0, nyz1, FadeX));
+}
+
+// Corner gradient of the 4D perlin noise from the hash h, dotted with the offset f.
+GLM_FUNC_QUALIFIER glm_vec4 glm_perlin4_corner_sse2(glm_vec4 h, glm_vec4 const f[4])
+{
+	glm_vec4 const Half = _mm_set1_ps(0.5f);
+	glm_vec4 gx = _mm_div_ps(h, _mm_set1_ps(7.0f));
+	glm_vec4 gy = _mm_div_ps(glm_vec4_floor(gx), _mm_set1_ps(7.0f));
+	glm_vec4 gz = _mm_div_ps(glm_vec4_floor(gy), _mm_set1_ps(6.0f));
+	gx = _mm_sub_ps(glm_noise_fract_sse2(gx), Half);
+	gy = _mm_sub_ps(glm_noise_fract_sse2(gy), Half);
+	gz = _mm_sub_ps(glm_noise_fract_sse2(gz), Half);
+	glm_vec4 const gw = _mm_sub_ps(_mm_sub_ps(_mm_sub_ps(_mm_set1_ps(0.75f), glm_noise_abs_sse2(gx)), glm_noise_abs_sse2(gy)), glm_noise_abs_sse2(gz));
+	glm_vec4 const Zero = _mm_setzero_ps();
+	glm_vec4 const sw = glm_noise_step_sse2(gw, Zero);
+	gx = _mm_sub_ps(gx, _mm_mul_ps(sw, _mm_sub_ps(glm_noise_step_sse2(Zero, gx), Half)));
+	gy = _mm_sub_ps(gy, _mm_mul_ps(sw, _mm_sub_ps(glm_noise_step_sse2(Zero, gy), Half)));
+
+	glm_vec4 const Norm = glm_noise_taylor_inv_sqrt_sse2(_mm_add_ps(
+		_mm_add_ps(_mm_mul_ps(gx, gx), _mm_mul_ps(gy, gy)),
+		_mm_add_ps(_mm_mul_ps(gz, gz), _mm_mul_ps(gw, gw))));
+	return _mm_add_ps(
+		_mm_add_ps(_mm_mul_ps(_mm_mul_ps(gx, Norm), f[0]), _mm_mul_ps(_mm_mul_ps(gy, Norm), f[1])),
+		_mm_add_ps(_mm_mul_ps(_mm_mul_ps(gz, Norm), f[2]), _mm_mul_ps(_mm_mul_ps(gw, Norm), f[3])));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_perlin_sse2(glm_vec4 const (&p)[4])
+{
+	glm_vec4 Pi[2][4], Pf[2][4];
+	for(int c = 0; c < 4; ++c)
+	{
+		glm_vec4 const Floor = glm_vec4_floor(p[c]);
+		Pi[0][c] = glm_noise_mod_sse2(Floor);
+		Pi[1][c] = glm_noise_mod_sse2(_mm_add_ps(Floor, _mm_set1_ps(1.0f)));
+		Pf[0][c] = glm_noise_fract_sse2(p[c]);
+		Pf[1][c] = _mm_sub_ps(Pf[0][c], _mm_set1_ps(1.0f));
+	}
+
+	// n[x + 2 * y + 4 * z + 8 * w] for the corner (x, y, z, w)
+	glm_vec4 n[16];
+	for(int y = 0; y < 2; ++y)
+	for(int x = 0; x < 2; ++x)
+	{
+		glm_vec4 const ixy = glm_noise_permute_sse2(_mm_add_ps(glm_noise_permute_sse2(Pi[x][0]), Pi[y][1]));
+		for(int z = 0; z < 2; ++z)
+		{
+			glm_vec4 const ixyz = glm_noise_permute_sse2(_mm_add_ps(ixy, Pi[z][2]));
+			for(int w = 0; w < 2; ++w)
+			{
+				glm_vec4 const f[4] = {Pf[x][0], Pf[y][1], Pf[z][2], Pf[w][3]};
+				n[x + 2 * y + 4 * z + 8 * w] = glm_perlin4_corner_sse2(glm_noise_permute_sse2(_mm_add_ps(ixyz, Pi[w][3])), f);
+			}
+		}
+	}
+
+	glm_vec4 const FadeX = glm_noise_fade_sse2(Pf[0][0]);
+	glm_vec4 const FadeY = glm_noise_fade_sse2(Pf[0][1]);
+	glm_vec4 const FadeZ = glm_noise_fade_sse2(Pf[0][2]);
+	glm_vec4 const FadeW = glm_noise_fade_sse2(Pf[0][3]);
+	glm_vec4 nzw[4];
+	for(int k = 0; k < 4; ++k)
+		nzw[k] = glm_noise_mix_sse2(glm_noise_mix_sse2(n[k], n[k + 8], FadeW), glm_noise_mix_sse2(n[k + 4], n[k + 12], FadeW), FadeZ);
+	glm_vec4 const nyzw0 = glm_noise_mix_sse2(nzw[0], nzw[2], FadeY);
+	glm_vec4 const nyzw1 = glm_noise_mix_sse2(nzw[1], nzw[3], FadeY);
+	return _mm_mul_ps(_mm_set1_ps(2.2f), glm_noise_mix_sse2(nyzw0, nyzw1, FadeX));
+}
+
+// Contribution of a 2D simplex corner at the offset (x, y) with the hash h, before the final scale.
+GLM_FUNC_QUALIFIER glm_vec4 glm_simplex2_corner_sse2(glm_vec4 h, glm_vec4 x, glm_vec4 y)
+{
+	glm_vec4 m = _mm_max_ps(_mm_sub_ps(_mm_set1_ps(0.5f), _mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y))), _mm_setzero_ps());
+	m = _mm_mul_ps(m, m);
+	m = _mm_mul_ps(m, m);
+
+	glm_vec4 const gx = _mm_sub_ps(_mm_mul_ps(_mm_set1_ps(2.0f), glm_noise_fract_sse2(_mm_mul_ps(h, _mm_set1_ps(0.024390243902439f)))), _mm_set1_ps(1.0f));
+	glm_vec4 const gh = _mm_sub_ps(glm_noise_abs_sse2(gx), _mm_set1_ps(0.5f));
+	glm_vec4 const a0 = _mm_sub_ps(gx, glm_vec4_floor(_mm_add_ps(gx, _mm_set1_ps(0.5f))));
+
+	m = _mm_mul_ps(m, glm_noise_taylor_inv_sqrt_sse2(_mm_add_ps(_mm_mul_ps(a0, a0), _mm_mul_ps(gh, gh))));
+	return _mm_mul_ps(m, _mm_add_ps(_mm_mul_ps(a0, x), _mm_mul_ps(gh, y)));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_simplex_sse2(glm_vec4 const (&v)[2])
+{
+	glm_vec4 const Cx = _mm_set1_ps(0.211324865405187f);
+	glm_vec4 const Cy = _mm_set1_ps(0.366025403784439f);
+	glm_vec4 const Cz = _mm_set1_ps(-0.577350269189626f);
+	glm_vec4 const One = _mm_set1_ps(1.0f);
+
+	// First corner
+	glm_vec4 const s = _mm_add_ps(_mm_mul_ps(v[0], Cy), _mm_mul_ps(v[1], Cy));
+	glm_vec4 ix = glm_vec4_floor(_mm_add_ps(v[0], s));
+	glm_vec4 iy = glm_vec4_floor(_mm_add_ps(v[1], s));
+	glm_vec4 const t = _mm_add_ps(_mm_mul_ps(ix, Cx), _mm_mul_ps(iy, Cx));
+	glm_vec4 const x0 = _mm_add_ps(_mm_sub_ps(v[0], ix), t);
+	glm_vec4 const y0 = _mm_add_ps(_mm_sub_ps(v[1], iy), t);
+
+	// Other corners
+	glm_vec4 const i1x = _mm_and_ps(_mm_cmpgt_ps(x0, y0), One);
+	glm_vec4 const i1y = _mm_sub_ps(One, i1x);
+	glm_vec4 const x1 = _mm_sub_ps(_mm_add_ps(x0, Cx), i1x);
+	glm_vec4 const y1 = _mm_sub_ps(_mm_add_ps(y0, Cx), i1y);
+	glm_vec4 const x2 = _mm_add_ps(x0, Cz);
+	glm_vec4 const y2 = _mm_add_ps(y0, Cz);
+
+	// Permutations
+	ix = glm_noise_mod_sse2(ix);
+	iy = glm_noise_mod_sse2(iy);
+	glm_vec4 const p0 = glm_noise_permute_sse2(_mm_add_ps(glm_noise_permute_sse2(iy), ix));
+	glm_vec4 const p1 = glm_noise_permute_sse2(_mm_add_ps(_mm_add_ps(glm_noise_permute_sse2(_mm_add_ps(iy, i1y)), ix), i1x));
+	glm_vec4 const p2 = glm_noise_permute_sse2(_mm_add_ps(_mm_add_ps(glm_noise_permute_sse2(_mm_add_ps(iy, One)), ix), One));
+
+	glm_vec4 const n0 = glm_simplex2_corner_sse2(p0, x0, y0);
+	glm_vec4 const n1 = glm_simplex2_corner_sse2(p1, x1, y1);
+	glm_vec4 const n2 = glm_simplex2_corner_sse2(p2, x2, y2);
+	return _mm_mul_ps(_mm_set1_ps(130.0f), _mm_add_ps(_mm_add_ps(n0, n1), n2));
+}
+
+// Normalized gradient of a 3D simplex corner from the hash p, dotted with the offset x, before the falloff.
+GLM_FUNC_QUALIFIER glm_vec4 glm_simplex3_gradient_sse2(glm_vec4 p, glm_vec4 const x[3])
+{
+	float const n_ = 0.142857142857f;
+	glm_vec4 const nsx = _mm_set1_ps(n_ * 2.0f - 0.0f);
+	glm_vec4 const nsy = _mm_set1_ps(n_ * 0.5f - 1.0f);
+	glm_vec4 const nsz = _mm_set1_ps(n_ * 1.0f - 0.0f);
+
+	glm_vec4 const j = _mm_sub_ps(p, _mm_mul_ps(_mm_set1_ps(49.0f), glm_vec4_floor(_mm_mul_ps(_mm_mul_ps(p, nsz), nsz))));
+	glm_vec4 const x_ = glm_vec4_floor(_mm_mul_ps(j, nsz));
+	glm_vec4 const y_ = glm_vec4_floor(_mm_sub_ps(j, _mm_mul_ps(_mm_set1_ps(7.0f), x_)));
+
+	glm_vec4 const gx = _mm_add_ps(_mm_mul_ps(x_, nsx), nsy);
+	glm_vec4 const gy = _mm_add_ps(_mm_mul_ps(y_, nsx), nsy);
+	glm_vec4 const h = _mm_sub_ps(_mm_sub_ps(_mm_set1_ps(1.0f), glm_noise_abs_sse2(gx)), glm_noise_abs_sse2(gy));
+
+	glm_vec4 const Two = _mm_set1_ps(2.0f);
+	glm_vec4 const One = _mm_set1_ps(1.0f);
+	glm_vec4 const sx = _mm_add_ps(_mm_mul_ps(glm_vec4_floor(gx), Two), One);
+	glm_vec4 const sy = _mm_add_ps(_mm_mul_ps(glm_vec4_floor(gy), Two), One);
+	glm_vec4 const sh = _mm_sub_ps(_mm_setzero_ps(), glm_noise_step_sse2(h, _mm_setzero_ps()));
+
+	glm_vec4 const ax = _mm_add_ps(gx, _mm_mul_ps(sx, sh));
+	glm_vec4 const ay = _mm_add_ps(gy, _mm_mul_ps(sy, sh));
+
+	glm_vec4 const Norm = glm_noise_taylor_inv_sqrt_sse2(_mm_add_ps(_mm_add_ps(_mm_mul_ps(ax, ax), _mm_mul_ps(ay, ay)), _mm_mul_ps(h, h)));
+	return _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_mul_ps(ax, Norm), x[0]), _mm_mul_ps(_mm_mul_ps(ay, Norm), x[1])), _mm_mul_ps(_mm_mul_ps(h, Norm), x[2]));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_simplex_sse2(glm_vec4 const (&v)[3])
+{
+	glm_vec4 const Cx = _mm_set1_ps(static_cast<float>(1.0 / 6.0));
+	glm_vec4 const Cy = _mm_set1_ps(static_cast<float>(1.0 / 3.0));
+	glm_vec4 const One = _mm_set1_ps(1.0f);
+
+	// First corner
+	glm_vec4 const s = _mm_add_ps(_mm_add_ps(_mm_mul_ps(v[0], Cy), _mm_mul_ps(v[1], Cy)), _mm_mul_ps(v[2], Cy));
+	glm_vec4 i[3];
+	for(int c = 0; c < 3; ++c)
+		i[c] = glm_vec4_floor(_mm_add_ps(v[c], s));
+	glm_vec4 const t = _mm_add_ps(_mm_add_ps(_mm_mul_ps(i[0], Cx), _mm_mul_ps(i[1], Cx)), _mm_mul_ps(i[2], Cx));
+	glm_vec4 x0[3];
+	for(int c = 0; c < 3; ++c)
+		x0[c] = _mm_add_ps(_mm_sub_ps(v[c], i[c]), t);
+
+	// Other corners
+	glm_vec4 g[3], i1[3], i2[3];
+	for(int c = 0; c < 3; ++c)
+		g[c] = glm_noise_step_sse2(x0[(c + 1) % 3], x0[c]);
+	for(int c = 0; c < 3; ++c)
+	{
+		glm_vec4 const l = _mm_sub_ps(One, g[(c + 2) % 3]);
+		i1[c] = _mm_min_ps(g[c], l);
+		i2[c] = _mm_max_ps(g[c], l);
+	}
+
+	glm_vec4 x1[3], x2[3], x3[3];
+	for(int c = 0; c < 3; ++c)
+	{
+		x1[c] = _mm_add_ps(_mm_sub_ps(x0[c], i1[c]), Cx);
+		x2[c] = _mm_add_ps(_mm_sub_ps(x0[c], i2[c]), Cy);
+		x3[c] = _mm_sub_ps(x0[c], _mm_set1_ps(0.5f));
+	}
+
+	// Permutations
+	for(int c = 0; c < 3; ++c)
+		i[c] = glm_noise_mod289_sse2(i[c]);
+	glm_vec4 p[4];
+	for(int k = 0; k < 4; ++k)
+	{
+		glm_vec4 o[3];
+		for(int c = 0; c < 3; ++c)
+			o[c] = k == 0 ? _mm_setzero_ps() : k == 1 ? i1[c] : k == 2 ? i2[c] : One;
+		p[k] = glm_noise_permute_sse2(_mm_add_ps(_mm_add_ps(glm_noise_permute_sse2(_mm_add_ps(_mm_add_ps(glm_noise_permute_sse2(
+			_mm_add_ps(i[2], o[2])), i[1]), o[1])), i[0]), o[0]));
+	}
+
+	// Mix final noise value
+	glm_vec4 const* const x[4] = {x0, x1, x2, x3};
+	glm_vec4 n[4];
+	for(int k = 0; k < 4; ++k)
+	{
+		glm_vec4 m = _mm_max_ps(_mm_sub_ps(_mm_set1_ps(0.6f), _mm_add_ps(_mm_add_ps(_mm_mul_ps(x[k][0], x[k][0]), _mm_mul_ps(x[k][1], x[k][1])), _mm_mul_ps(x[k][2], x[k][2]))), _mm_setzero_ps());
+		m = _mm_mul_ps(m, m);
+		n[k] = _mm_mul_ps(_mm_mul_ps(m, m), glm_simplex3_gradient_sse2(p[k], x[k]));
+	}
+	return _mm_mul_ps(_mm_set1_ps(42.0f), _mm_add_ps(_mm_add_ps(n[0], n[1]), _mm_add_ps(n[2], n[3])));
+}
+
+// gtc::grad4 normalized and dotted with the offset x.
+GLM_FUNC_QUALIFIER glm_vec4 glm_simplex4_gradient_sse2(glm_vec4 j, glm_vec4 const x[4])
+{
+	glm_vec4 const ip[3] = {_mm_set1_ps(1.0f / 294.0f), _mm_set1_ps(1.0f / 49.0f), _mm_set1_ps(1.0f / 7.0f)};
+	glm_vec4 g[4];
+	for(int c = 0; c < 3; ++c)
+		g[c] = _mm_sub_ps(_mm_mul_ps(glm_vec4_floor(_mm_mul_ps(glm_noise_fract_sse2(_mm_mul_ps(j, ip[c])), _mm_set1_ps(7.0f))), ip[2]), _mm_set1_ps(1.0f));
+	g[3] = _mm_sub_ps(_mm_set1_ps(1.5f), _mm_add_ps(_mm_add_ps(glm_noise_abs_sse2(g[0]), glm_noise_abs_sse2(g[1])), glm_noise_abs_sse2(g[2])));
+
+	glm_vec4 const Zero = _mm_setzero_ps();
+	glm_vec4 const sw = glm_noise_less_sse2(g[3], Zero);
+	for(int c = 0; c < 3; ++c)
+		g[c] = _mm_add_ps(g[c], _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(glm_noise_less_sse2(g[c], Zero), _mm_set1_ps(2.0f)), _mm_set1_ps(1.0f)), sw));
+
+	glm_vec4 const Norm = glm_noise_taylor_inv_sqrt_sse2(_mm_add_ps(
+		_mm_add_ps(_mm_mul_ps(g[0], g[0]), _mm_mul_ps(g[1], g[1])),
+		_mm_add_ps(_mm_mul_ps(g[2], g[2]), _mm_mul_ps(g[3], g[3]))));
+	return _mm_add_ps(
+		_mm_add_ps(_mm_mul_ps(_mm_mul_ps(g[0], Norm), x[0]), _mm_mul_ps(_mm_mul_ps(g[1], Norm), x[1])),
+		_mm_add_ps(_mm_mul_ps(_mm_mul_ps(g[2], Norm), x[2]), _mm_mul_ps(_mm_mul_ps(g[3], Norm), x[3])));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_simplex_sse2(glm_vec4 const (&v)[4])
+{
+	glm_vec4 const C[4] = {
+		_mm_set1_ps(0.138196601125011f),
+		_mm_set1_ps(0.276393202250021f),
+		_mm_set1_ps(0.414589803375032f),
+		_mm_set1_ps(-0.447213595499958f)};
+	glm_vec4 const F4 = _mm_set1_ps(0.309016994374947451f);
+	glm_vec4 const Zero = _mm_setzero_ps();
+	glm_vec4 const One = _mm_set1_ps(1.0f);
+
+	// First corner
+	glm_vec4 const s = _mm_add_ps(_mm_add_ps(_mm_mul_ps(v[0], F4), _mm_mul_ps(v[1], F4)), _mm_add_ps(_mm_mul_ps(v[2], F4), _mm_mul_ps(v[3], F4)));
+	glm_vec4 i[4];
+	for(int c = 0; c < 4; ++c)
+		i[c] = glm_vec4_floor(_mm_add_ps(v[c], s));
+	glm_vec4 const t = _mm_add_ps(_mm_add_ps(_mm_mul_ps(i[0], C[0]), _mm_mul_ps(i[1], C[0])), _mm_add_ps(_mm_mul_ps(i[2], C[0]), _mm_mul_ps(i[3], C[0])));
+	glm_vec4 x[5][4];
+	for(int c = 0; c < 4; ++c)
+		x[0][c] = _mm_add_ps(_mm_sub_ps(v[c], i[c]), t);
+
+	// Rank sorting, i0 holds 0, 1, 2 and 3 once each
+	glm_vec4 const isXy = glm_noise_step_sse2(x[0][1], x[0][0]);
+	glm_vec4 const isXz = glm_noise_step_sse2(x[0][2], x[0][0]);
+	glm_vec4 const isXw = glm_noise_step_sse2(x[0][3], x[0][0]);
+	glm_vec4 const isYz = glm_noise_step_sse2(x[0][2], x[0][1]);
+	glm_vec4 const isYw = glm_noise_step_sse2(x[0][3], x[0][1]);
+	glm_vec4 const isZw = glm_noise_step_sse2(x[0][3], x[0][2]);
+	glm_vec4 i0[4];
+	i0[0] = _mm_add_ps(_mm_add_ps(isXy, isXz), isXw);
+	i0[1] = _mm_add_ps(_mm_sub_ps(One, isXy), _mm_add_ps(isYz, isYw));
+	i0[2] = _mm_add_ps(_mm_add_ps(_mm_sub_ps(One, isXz), _mm_sub_ps(One, isYz)), isZw);
+	i0[3] = _mm_add_ps(_mm_add_ps(_mm_sub_ps(One, isXw), _mm_sub_ps(One, isYw)), _mm_sub_ps(One, isZw));
+
+	// ic[k] is i(k + 1): i1, i2 and i3
+	glm_vec4 ic[3][4];
+	for(int c = 0; c < 4; ++c)
+	{
+		ic[2][c] = _mm_min_ps(_mm_max_ps(i0[c], Zero), One);
+		ic[1][c] = _mm_min_ps(_mm_max_ps(_mm_sub_ps(i0[c], One), Zero), One);
+		ic[0][c] = _mm_min_ps(_mm_max_ps(_mm_sub_ps(i0[c], _mm_set1_ps(2.0f)), Zero), One);
+	}
+
+	for(int c = 0; c < 4; ++c)
+	{
+		for(int k = 0; k < 3; ++k)
+			x[k + 1][c] = _mm_add_ps(_mm_sub_ps(x[0][c], ic[k][c]), C[k]);
+		x[4][c] = _mm_add_ps(x[0][c], C[3]);
+	}
+
+	// Permutations
+	for(int c = 0; c < 4; ++c)
+		i[c] = glm_noise_mod_sse2(i[c]);
+	glm_vec4 j[5];
+	j[0] = glm_noise_permute_sse2(_mm_add_ps(glm_noise_permute_sse2(_mm_add_ps(glm_noise_permute_sse2(_mm_add_ps(glm_noise_permute_sse2(i[3]), i[2])), i[1])), i[0]));
+	for(int k = 1; k < 5; ++k)
+	{
+		glm_vec4 const* o = k < 4 ? ic[k - 1] : NULL;
+		glm_vec4 h = glm_noise_permute_sse2(_mm_add_ps(i[3], o ? o[3] : One));
+		for(int c = 2; c >= 0; --c)
+			h = glm_noise_permute_sse2(_mm_add_ps(_mm_add_ps(h, i[c]), o ? o[c] : One));
+		j[k] = h;
+	}
+
+	// Mix contributions from the five corners
+	glm_vec4 n[5];
+	for(int k = 0; k < 5; ++k)
+	{
+		glm_vec4 m = _mm_max_ps(_mm_sub_ps(_mm_set1_ps(0.6f), _mm_add_ps(
+			_mm_add_ps(_mm_mul_ps(x[k][0], x[k][0]), _mm_mul_ps(x[k][1], x[k][1])),
+			_mm_add_ps(_mm_mul_ps(x[k][2], x[k][2]), _mm_mul_ps(x[k][3], x[k][3])))), Zero);
+		m = _mm_mul_ps(m, m);
+		n[k] = _mm_mul_ps(_mm_mul_ps(m, m), glm_simplex4_gradient_sse2(j[k], x[k]));
+	}
+	return _mm_mul_ps(_mm_set1_ps(49.0f), _mm_add_ps(_mm_add_ps(_mm_add_ps(n[0], n[1]), n[2]), _mm_add_ps(n[3], n[4])));
+}
+
+template<glm::length_t L>
+GLM_FUNC_QUALIFIER glm_vec4 glm_noise_fractal_sse2(glm_vec4 const (&p)[L], glm::detail::noise_fractal const& Fractal)
+{
+	glm_vec4 Sum = _mm_setzero_ps();
+	float Amplitude = 1.0f;
+	float Frequency = 1.0f;
+	for(int o = 0; o < Fractal.Octaves; ++o)
+	{
+		glm_vec4 q[L];
+		for(glm::length_t c = 0; c < L; ++c)
+			q[c] = _mm_mul_ps(p[c], _mm_set1_ps(Frequency));
+		glm_vec4 n = Fractal.Basis ? glm_simplex_sse2(q) : glm_perlin_sse2(q);
+		if(Fractal.Ridged)
+		{
+			n = _mm_sub_ps(_mm_set1_ps(1.0f), glm_noise_abs_sse2(n));
+			n = _mm_mul_ps(n, n);
+		}
+		Sum = _mm_add_ps(Sum, _mm_mul_ps(_mm_set1_ps(Amplitude), n));
+		Amplitude *= Fractal.Gain;
+		Frequency *= Fractal.Lacunarity;
+	}
+	return Sum;
+}
+
+GLM_FUNC_QUALIFIER void glm_noise_store_sse2(glm_vec4 v, float* Out, std::size_t Count)
+{
+	if(Count >= 4)
+	{
+		_mm_storeu_ps(Out, v);
+		return;
+	}
+
+	float Tail[4];
+	_mm_storeu_ps(Tail, v);
+	for(std::size_t k = 0; k < Count; ++k)
+		Out[k] = Tail[k];
+}
+
+// Out[i] = fractal noise of the point at In + i * Stride. The last group repeats its last point.
+template<glm::length_t L>
+GLM_FUNC_QUALIFIER void glm_noise_batch_sse2(float const* In, std::size_t Stride, float* Out, std::size_t Count, glm::detail::noise_fractal const& Fractal)
+{
+	for(std::size_t i = 0; i < Count; i += 4)
+	{
+		std::size_t const n = Count - i < 4 ? Count - i : 4;
+		float const* const a = In + i * Stride;
+		float const* const b = In + (i + (n > 1 ? 1 : 0)) * Stride;
+		float const* const c = In + (i + (n > 2 ? 2 : n - 1)) * Stride;
+		float const* const d = In + (i + n - 1) * Stride;
+
+		glm_vec4 p[L];
+		for(glm::length_t k = 0; k < L; ++k)
+			p[k] = _mm_setr_ps(a[k], b[k], c[k], d[k]);
+		glm_noise_store_sse2(glm_noise_fractal_sse2(p, Fractal), Out + i, n);
+	}
+}
+
+// Out[x - First] for x in [First, Last) = fractal noise at Origin + DeltaX * x + DeltaY * y.
+template<glm::length_t L>
+GLM_FUNC_QUALIFIER void glm_noise_row_sse2(float* Out, std::size_t First, std::size_t Last, float y, float const* Origin, float const* DeltaX, float const* DeltaY, glm::detail::noise_fractal const& Fractal)
+{
+	glm_vec4 const Lanes = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+	glm_vec4 const Y = _mm_set1_ps(y);
+	for(std::size_t x = First; x < Last; x += 4)
+	{
+		glm_vec4 const X = _mm_add_ps(_mm_set1_ps(static_cast<float>(x)), Lanes);
+		glm_vec4 p[L];
+		for(glm::length_t c = 0; c < L; ++c)
+			p[c] = _mm_add_ps(_mm_add_ps(_mm_set1_ps(Origin[c]), _mm_mul_ps(_mm_set1_ps(DeltaX[c]), X)), _mm_mul_ps(_mm_set1_ps(DeltaY[c]), Y));
+		glm_noise_store_sse2(glm_noise_fractal_sse2(p, Fractal), Out + (x - First), Last - x);
+	}
+}
+
+// Rows [Row, Row + Rows) of a Width wide image.
+template<glm::length_t L>
+GLM_FUNC_QUALIFIER void glm_noise_grid_sse2(float* Out, std::size_t Width, std::size_t Row, std::size_t Rows, float const* Origin, float const* DeltaX, float const* DeltaY, glm::detail::noise_fractal const& Fractal)
+{
+	for(std::size_t y = Row; y < Row + Rows; ++y)
+		glm_noise_row_sse2<L>(Out + y * Width, 0, Width, static_cast<float>(y), Origin, DeltaX, DeltaY, Fractal);
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+// AVX2, the same operations 8 samples at a time. GCC and Clang contract the products and sums into FMA here,
+// which moves the results by about 1e-5 from the SSE2 ones.
+
+GLM_BATCH_AVX2_INLINE __m256 glm_noise_fract_avx2(__m256 x)
+{
+	return _mm256_sub_ps(x, _mm256_floor_ps(x));
+}
+
+// x - floor(x * (1 / 289)) * 289, detail::mod289
+GLM_BATCH_AVX2_INLINE __m256 glm_noise_mod289_avx2(__m256 x)
+{
+	return _mm256_sub_ps(x, _mm256_mul_ps(_mm256_floor_ps(_mm256_mul_ps(x, _mm256_set1_ps(1.0f / 289.0f))), _mm256_set1_ps(289.0f)));
+}
+
+// x - 289 * floor(x / 289), mod(x, 289)
+GLM_BATCH_AVX2_INLINE __m256 glm_noise_mod_avx2(__m256 x)
+{
+	return _mm256_sub_ps(x, _mm256_mul_ps(_mm256_set1_ps(289.0f), _mm256_floor_ps(_mm256_div_ps(x, _mm256_set1_ps(289.0f)))));
+}
+
+GLM_BATCH_AVX2_INLINE __m256 glm_noise_permute_avx2(__m256 x)
+{
+	return glm_noise_mod289_avx2(_mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(x, _mm256_set1_ps(34.0f)), _mm256_set1_ps(1.0f)), x));
+}
+
+GLM_BATCH_AVX2_INLINE __m256 glm_noise_taylor_inv_sqrt_avx2(__m256 r)
+{
+	return _mm256_sub_ps(_mm256_set1_ps(1.79284291400159f), _mm256_mul_ps(_mm256_set1_ps(0.85373472095314f), r));
+}
+
+GLM_BATCH_AVX2_INLINE __m256 glm_noise_fade_avx2(__m256 t)
+{
+	__m256 const Poly = _mm256_add_ps(_mm256_mul_ps(t, _mm256_sub_ps(_mm256_mul_ps(t, _mm256_set1_ps(6.0f)), _mm256_set1_ps(15.0f))), _mm256_set1_ps(10.0f));
+	return _mm256_mul_ps(_mm256_mul_ps(_mm256_mul_ps(t, t), t), Poly);
+}
+
+GLM_BATCH_AVX2_INLINE __m256 glm_noise_mix_avx2(__m256 x, __m256 y, __m256 a)
+{
+	return _mm256_add_ps(x, _mm256_mul_ps(a, _mm256_sub_ps(y, x)));
+}
+
+GLM_BATCH_AVX2_INLINE __m256 glm_noise_abs_avx2(__m256 x)
+{
+	return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), x);
+}
+
+// step(Edge, x): 0 when x < Edge, 1 otherwise
+GLM_BATCH_AVX2_INLINE __m256 glm_noise_step_avx2(__m256 Edge, __m256 x)
+{
+	return _mm256_and_ps(_mm256_cmp_ps(x, Edge, _CMP_NLT_UQ), _mm256_set1_ps(1.0f));
+}
+
+GLM_BATCH_AVX2_INLINE __m256 glm_noise_less_avx2(__m256 x, __m256 y)
+{
+	return _mm256_and_ps(_mm256_cmp_ps(x, y, _CMP_LT_OQ), _mm256_set1_ps(1.0f));
+}
+
+// Corner gradient of the 2D perlin noise dotted with the offset (fx, fy).
+GLM_BATCH_AVX2_INLINE __m256 glm_perlin2_corner_avx2(__m256 i, __m256 fx, __m256 fy)
+{
+	__m256 gx = _mm256_sub_ps(_mm256_mul_ps(_mm256_set1_ps(2.0f), glm_noise_fract_avx2(_mm256_div_ps(i, _mm256_set1_ps(41.0f)))), _mm256_set1_ps(1.0f));
+	__m256 gy = _mm256_sub_ps(glm_noise_abs_avx2(gx), _mm256_set1_ps(0.5f));
+	gx = _mm256_sub_ps(gx, _mm256_floor_ps(_mm256_add_ps(gx, _mm256_set1_ps(0.5f))));
+
+	__m256 const Norm = glm_noise_taylor_inv_sqrt_avx2(_mm256_add_ps(_mm256_mul_ps(gx, gx), _mm256_mul_ps(gy, gy)));
+	gx = _mm256_mul_ps(gx, Norm);
+	gy = _mm256_mul_ps(gy, Norm);
+	return _mm256_add_ps(_mm256_mul_ps(gx, fx), _mm256_mul_ps(gy, fy));
+}
+
+GLM_BATCH_AVX2_INLINE __m256 glm_perlin_avx2(__m256 const (&p)[2])
+{
+	__m256 Pi0[2], Pi1[2], Pf0[2], Pf1[2];
+	for(int c = 0; c < 2; ++c)
+	{
+		__m256 const Floor = _mm256_floor_ps(p[c]);
+		Pi0[c] = glm_noise_mod_avx2(Floor);
+		Pi1[c] = glm_noise_mod_avx2(_mm256_add_ps(Floor, _mm256_set1_ps(1.0f)));
+		Pf0[c] = glm_noise_fract_avx2(p[c]);
+		Pf1[c] = _mm256_sub_ps(Pf0[c], _mm256_set1_ps(1.0f));
+	}
+
+	__m256 const px0 = glm_noise_permute_avx2(Pi0[0]);
+	__m256 const px1 = glm_noise_permute_avx2(Pi1[0]);
+	__m256 const n00 = glm_perlin2_corner_avx2(glm_noise_permute_avx2(_mm256_add_ps(px0, Pi0[1])), Pf0[0], Pf0[1]);
+	__m256 const n10 = glm_perlin2_corner_avx2(glm_noise_permute_avx2(_mm256_add_ps(px1, Pi0[1])), Pf1[0], Pf0[1]);
+	__m256 const n01 = glm_perlin2_corner_avx2(glm_noise_permute_avx2(_mm256_add_ps(px0, Pi1[1])), Pf0[0], Pf1[1]);
+	__m256 const n11 = glm_perlin2_corner_avx2(glm_noise_permute_avx2(_mm256_add_ps(px1, Pi1[1])), Pf1[0], Pf1[1]);
+
+	__m256 const FadeX = glm_noise_fade_avx2(Pf0[0]);
+	__m256 const FadeY = glm_noise_fade_avx2(Pf0[1]);
+	__m256 const nx0 = glm_noise_mix_avx2(n00, n10, FadeX);
+	__m256 const nx1 = glm_noise_mix_avx2(n01, n11, FadeX);
+	return _mm256_mul_ps(_mm256_set1_ps(2.3f), glm_noise_mix_avx2(nx0, nx1, FadeY));
+}
+
+// Corner gradient of the 3D perlin noise from the hash h, dotted with the offset f.
+GLM_BATCH_AVX2_INLINE __m256 glm_perlin3_corner_avx2(__m256 h, __m256 fx, __m256 fy, __m256 fz)
+{
+	__m256 gx = _mm256_mul_ps(h, _mm256_set1_ps(static_cast<float>(1.0 / 7.0)));
+	__m256 gy = _mm256_sub_ps(glm_noise_fract_avx2(_mm256_mul_ps(_mm256_floor_ps(gx), _mm256_set1_ps(static_cast<float>(1.0 / 7.0)))), _mm256_set1_ps(0.5f));
+	gx = glm_noise_fract_avx2(gx);
+	__m256 const gz = _mm256_sub_ps(_mm256_sub_ps(_mm256_set1_ps(0.5f), glm_noise_abs_avx2(gx)), glm_noise_abs_avx2(gy));
+	__m256 const Zero = _mm256_setzero_ps();
+	__m256 const sz = glm_noise_step_avx2(gz, Zero);
+	gx = _mm256_sub_ps(gx, _mm256_mul_ps(sz, _mm256_sub_ps(glm_noise_step_avx2(Zero, gx), _mm256_set1_ps(0.5f))));
+	gy = _mm256_sub_ps(gy, _mm256_mul_ps(sz, _mm256_sub_ps(glm_noise_step_avx2(Zero, gy), _mm256_set1_ps(0.5f))));
+
+	__m256 const Norm = glm_noise_taylor_inv_sqrt_avx2(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(gx, gx), _mm256_mul_ps(gy, gy)), _mm256_mul_ps(gz, gz)));
+	return _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(gx, Norm), fx), _mm256_mul_ps(_mm256_mul_ps(gy, Norm), fy)), _mm256_mul_ps(_mm256_mul_ps(gz, Norm), fz));
+}
+
+GLM_BATCH_AVX2_INLINE __m256 glm_perlin_avx2(__m256 const (&p)[3])
+{
+	__m256 Pi[2][3], Pf[2][3];
+	for(int c = 0; c < 3; ++c)
+	{
+		__m256 const Floor = _mm256_floor_ps(p[c]);
+		Pi[0][c] = glm_noise_mod289_avx2(Floor);
+		Pi[1][c] = glm_noise_mod289_avx2(_mm256_add_ps(Floor, _mm256_set1_ps(1.0f)));
+		Pf[0][c] = glm_noise_fract_avx2(p[c]);
+		Pf[1][c] = _mm256_sub_ps(Pf[0][c], _mm256_set1_ps(1.0f));
+	}
+
+	// n[x + 2 * y + 4 * z] for the corner (x, y, z)
+	__m256 n[8];
+	for(int y = 0; y < 2; ++y)
+	for(int x = 0; x < 2; ++x)
+	{
+		__m256 const ixy = glm_noise_permute_avx2(_mm256_add_ps(glm_noise_permute_avx2(Pi[x][0]), Pi[y][1]));
+		for(int z = 0; z < 2; ++z)
+			n[x + 2 * y + 4 * z] = glm_perlin3_corner_avx2(glm_noise_permute_avx2(_mm256_add_ps(ixy, Pi[z][2])), Pf[x][0], Pf[y][1], Pf[z][2]);
+	}
+
+	__m256 const FadeX = glm_noise_fade_avx2(Pf[0][0]);
+	__m256 const FadeY = glm_noise_fade_avx2(Pf[0][1]);
+	__m256 const FadeZ = glm_noise_fade_avx2(Pf[0][2]);
+	__m256 nz[4];
+	for(int k = 0; k < 4; ++k)
+		nz[k] = glm_noise_mix_avx2(n[k], n[k + 4], FadeZ);
+	__m256 const nyz0 = glm_noise_mix_avx2(nz[0], nz[2], FadeY);
+	__m256 const nyz1 = glm_noise_mix_avx2(nz[1], nz[3], FadeY);
+	return _mm256_mul_ps(_mm256_set1_ps(2.2f), glm_noise_mix_avx2(nyz0, nyz1, FadeX));
+}
+
+// Corner gradient of the 4D perlin noise from the hash h, dotted with the offset f.
+GLM_BATCH_AVX2_INLINE __m256 glm_perlin4_corner_avx2(__m256 h, __m256 const f[4])
+{
+	__m256 const Half = _mm256_set1_ps(0.5f);
+	__m256 gx = _mm256_div_ps(h, _mm256_set1_ps(7.0f));
+	__m256 gy = _mm256_div_ps(_mm256_floor_ps(gx), _mm256_set1_ps(7.0f));
+	__m256 gz = _mm256_div_ps(_mm256_floor_ps(gy), _mm256_set1_ps(6.0f));
+	gx = _mm256_sub_ps(glm_noise_fract_avx2(gx), Half);
+	gy = _mm256_sub_ps(glm_noise_fract_avx2(gy), Half);
+	gz = _mm256_sub_ps(glm_noise_fract_avx2(gz), Half);
+	__m256 const gw = _mm256_sub_ps(_mm256_sub_ps(_mm256_sub_ps(_mm256_set1_ps(0.75f), glm_noise_abs_avx2(gx)), glm_noise_abs_avx2(gy)), glm_noise_abs_avx2(gz));
+	__m256 const Zero = _mm256_setzero_ps();
+	__m256 const sw = glm_noise_step_avx2(gw, Zero);
+	gx = _mm256_sub_ps(gx, _mm256_mul_ps(sw, _mm256_sub_ps(glm_noise_step_avx2(Zero, gx), Half)));
+	gy = _mm256_sub_ps(gy, _mm256_mul_ps(sw, _mm256_sub_ps(glm_noise_step_avx2(Zero, gy), Half)));
+
+	__m256 const Norm = glm_noise_taylor_inv_sqrt_avx2(_mm256_add_ps(
+		_mm256_add_ps(_mm256_mul_ps(gx, gx), _mm256_mul_ps(gy, gy)),
+		_mm256_add_ps(_mm256_mul_ps(gz, gz), _mm256_mul_ps(gw, gw))));
+	return _mm256_add_ps(
+		_mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(gx, Norm), f[0]), _mm256_mul_ps(_mm256_mul_ps(gy, Norm), f[1])),
+		_mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(gz, Norm), f[2]), _mm256_mul_ps(_mm256_mul_ps(gw, Norm), f[3])));
+}
+
+GLM_BATCH_AVX2_INLINE __m256 glm_perlin_avx2(__m256 const (&p)[4])
+{
+	__m256 Pi[2][4], Pf[2][4];
+	for(int c = 0; c < 4; ++c)
+	{
+		__m256 const Floor = _mm256_floor_ps(p[c]);
+		Pi[0][c] = glm_noise_mod_avx2(Floor);
+		Pi[1][c] = glm_noise_mod_avx2(_mm256_add_ps(Floor, _mm256_set1_ps(1.0f)));
+		Pf[0][c] = glm_noise_fract_avx2(p[c]);
+		Pf[1][c] = _mm256_sub_ps(Pf[0][c], _mm256_set1_ps(1.0f));
+	}
+
+	// n[x + 2 * y + 4 * z + 8 * w] for the corner (x, y, z, w)
+	__m256 n[16];
+	for(int y = 0; y < 2; ++y)
+	for(int x = 0; x < 2; ++x)
+	{
+		__m256 const ixy = glm_noise_permute_avx2(_mm256_add_ps(glm_noise_permute_avx2(Pi[x][0]), Pi[y][1]));
+		for(int z = 0; z < 2; ++z)
+		{
+			__m256 const ixyz = glm_noise_permute_avx2(_mm256_add_ps(ixy, Pi[z][2]));
+			for(int w = 0; w < 2; ++w)
+			{
+				__m256 const f[4] = {Pf[x][0], Pf[y][1], Pf[z][2], Pf[w][3]};
+				n[x + 2 * y + 4 * z + 8 * w] = glm_perlin4_corner_avx2(glm_noise_permute_avx2(_mm256_add_ps(ixyz, Pi[w][3])), f);
+			}
+		}
+	}
+
+	__m256 const FadeX = glm_noise_fade_avx2(Pf[0][0]);
+	__m256 const FadeY = glm_noise_fade_avx2(Pf[0][1]);
+	__m256 const FadeZ = glm_noise_fade_avx2(Pf[0][2]);
+	__m256 const FadeW = glm_noise_fade_avx2(Pf[0][3]);
+	__m256 nzw[4];
+	for(int k = 0; k < 4; ++k)
+		nzw[k] = glm_noise_mix_avx2(glm_noise_mix_avx2(n[k], n[k + 8], FadeW), glm_noise_mix_avx2(n[k + 4], n[k + 12], FadeW), FadeZ);
+	__m256 const nyzw0 = glm_noise_mix_avx2(nzw[0], nzw[2], FadeY);
+	__m256 const nyzw1 = glm_noise_mix_avx2(nzw[1], nzw[3], FadeY);
+	return _mm256_mul_ps(_mm256_set1_ps(2.2f), glm_noise_mix_avx2(nyzw0, nyzw1, FadeX));
+}
+
+// Contribution of a 2D simplex corner at the offset (x, y) with the hash h, before the final scale.
+GLM_BATCH_AVX2_INLINE __m256 glm_simplex2_corner_avx2(__m256 h, __m256 x, __m256 y)
+{
+	__m256 m = _mm256_max_ps(_mm256_sub_ps(_mm256_set1_ps(0.5f), _mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y))), _mm256_setzero_ps());
+	m = _mm256_mul_ps(m, m);
+	m = _mm256_mul_ps(m, m);
+
+	__m256 const gx = _mm256_sub_ps(_mm256_mul_ps(_mm256_set1_ps(2.0f), glm_noise_fract_avx2(_mm256_mul_ps(h, _mm256_set1_ps(0.024390243902439f)))), _mm256_set1_ps(1.0f));
+	__m256 const gh = _mm256_sub_ps(glm_noise_abs_avx2(gx), _mm256_set1_ps(0.5f));
+	__m256 const a0 = _mm256_sub_ps(gx, _mm256_floor_ps(_mm256_add_ps(gx, _mm256_set1_ps(0.5f))));
+
+	m = _mm256_mul_ps(m, glm_noise_taylor_inv_sqrt_avx2(_mm256_add_ps(_mm256_mul_ps(a0, a0), _mm256_mul_ps(gh, gh))));
+	return _mm256_mul_ps(m, _mm256_add_ps(_mm256_mul_ps(a0, x), _mm256_mul_ps(gh, y)));
+}
+
+GLM_BATCH_AVX2_INLINE __m256 glm_simplex_avx2(__m256 const (&v)[2])
+{
+	__m256 const Cx = _mm256_set1_ps(0.211324865405187f);
+	__m256 const Cy = _mm256_set1_ps(0.366025403784439f);
+	__m256 const Cz = _mm256_set1_ps(-0.577350269189626f);
+	__m256 const One = _mm256_set1_ps(1.0f);
+
+	// First corner
+	__m256 const s = _mm256_add_ps(_mm256_mul_ps(v[0], Cy), _mm256_mul_ps(v[1], Cy));
+	__m256 ix = _mm256_floor_ps(_mm256_add_ps(v[0], s));
+	__m256 iy = _mm256_floor_ps(_mm256_add_ps(v[1], s));
+	__m256 const t = _mm256_add_ps(_mm256_mul_ps(ix, Cx), _mm256_mul_ps(iy, Cx));
+	__m256 const x0 = _mm256_add_ps(_mm256_sub_ps(v[0], ix), t);
+	__m256 const y0 = _mm256_add_ps(_mm256_sub_ps(v[1], iy), t);
+
+	// Other corners
+	__m256 const i1x = _mm256_and_ps(_mm256_cmp_ps(x0, y0, _CMP_GT_OQ), One);
+	__m256 const i1y = _mm256_sub_ps(One, i1x);
+	__m256 const x1 = _mm256_sub_ps(_mm256_add_ps(x0, Cx), i1x);
+	__m256 const y1 = _mm256_sub_ps(_mm256_add_ps(y0, Cx), i1y);
+	__m256 const x2 = _mm256_add_ps(x0, Cz);
+	__m256 const y2 = _mm256_add_ps(y0, Cz);
+
+	// Permutations
+	ix = glm_noise_mod_avx2(ix);
+	iy = glm_noise_mod_avx2(iy);
+	__m256 const p0 = glm_noise_permute_avx2(_mm256_add_ps(glm_noise_permute_avx2(iy), ix));
+	__m256 const p1 = glm_noise_permute_avx2(_mm256_add_ps(_mm256_add_ps(glm_noise_permute_avx2(_mm256_add_ps(iy, i1y)), ix), i1x));
+	__m256 const p2 = glm_noise_permute_avx2(_mm256_add_ps(_mm256_add_ps(glm_noise_permute_avx2(_mm256_add_ps(iy, One)), ix), One));
+
+	__m256 const n0 = glm_simplex2_corner_avx2(p0, x0, y0);
+	__m256 const n1 = glm_simplex2_corner_avx2(p1, x1, y1);
+	__m256 const n2 = glm_simplex2_corner_avx2(p2, x2, y2);
+	return _mm256_mul_ps(_mm256_set1_ps(130.0f), _mm256_add_ps(_mm256_add_ps(n0, n1), n2));
+}
+
+// Normalized gradient of a 3D simplex corner from the hash p, dotted with the offset x, before the falloff.
+GLM_BATCH_AVX2_INLINE __m256 glm_simplex3_gradient_avx2(__m256 p, __m256 const x[3])
+{
+	float const n_ = 0.142857142857f;
+	__m256 const nsx = _mm256_set1_ps(n_ * 2.0f - 0.0f);
+	__m256 const nsy = _mm256_set1_ps(n_ * 0.5f - 1.0f);
+	__m256 const nsz = _mm256_set1_ps(n_ * 1.0f - 0.0f);
+
+	__m256 const j = _mm256_sub_ps(p, _mm256_mul_ps(_mm256_set1_ps(49.0f), _mm256_floor_ps(_mm256_mul_ps(_mm256_mul_ps(p, nsz), nsz))));
+	__m256 const x_ = _mm256_floor_ps(_mm256_mul_ps(j, nsz));
+	__m256 const y_ = _mm256_floor_ps(_mm256_sub_ps(j, _mm256_mul_ps(_mm256_set1_ps(7.0f), x_)));
+
+	__m256 const gx = _mm256_add_ps(_mm256_mul_ps(x_, nsx), nsy);
+	__m256 const gy = _mm256_add_ps(_mm256_mul_ps(y_, nsx), nsy);
+	__m256 const h = _mm256_sub_ps(_mm256_sub_ps(_mm256_set1_ps(1.0f), glm_noise_abs_avx2(gx)), glm_noise_abs_avx2(gy));
+
+	__m256 const Two = _mm256_set1_ps(2.0f);
+	__m256 const One = _mm256_set1_ps(1.0f);
+	__m256 const sx = _mm256_add_ps(_mm256_mul_ps(_mm256_floor_ps(gx), Two), One);
+	__m256 const sy = _mm256_add_ps(_mm256_mul_ps(_mm256_floor_ps(gy), Two), One);
+	__m256 const sh = _mm256_sub_ps(_mm256_setzero_ps(), glm_noise_step_avx2(h, _mm256_setzero_ps()));
+
+	__m256 const ax = _mm256_add_ps(gx, _mm256_mul_ps(sx, sh));
+	__m256 const ay = _mm256_add_ps(gy, _mm256_mul_ps(sy, sh));
+
+	__m256 const Norm = glm_noise_taylor_inv_sqrt_avx2(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(ax, ax), _mm256_mul_ps(ay, ay)), _mm256_mul_ps(h, h)));
+	return _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(ax, Norm), x[0]), _mm256_mul_ps(_mm256_mul_ps(ay, Norm), x[1])), _mm256_mul_ps(_mm256_mul_ps(h, Norm), x[2]));
+}
+
+GLM_BATCH_AVX2_INLINE __m256 glm_simplex_avx2(__m256 const (&v)[3])
+{
+	__m256 const Cx = _mm256_set1_ps(static_cast<float>(1.0 / 6.0));
+	__m256 const Cy = _mm256_set1_ps(static_cast<float>(1.0 / 3.0));
+	__m256 const One = _mm256_set1_ps(1.0f);
+
+	// First corner
+	__m256 const s = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(v[0], Cy), _mm256_mul_ps(v[1], Cy)), _mm256_mul_ps(v[2], Cy));
+	__m256 i[3];
+	for(int c = 0; c < 3; ++c)
+		i[c] = _mm256_floor_ps(_mm256_add_ps(v[c], s));
+	__m256 const t = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(i[0], Cx), _mm256_mul_ps(i[1], Cx)), _mm256_mul_ps(i[2], Cx));
+	__m256 x0[3];
+	for(int c = 0; c < 3; ++c)
+		x0[c] = _mm256_add_ps(_mm256_sub_ps(v[c], i[c]), t);
+
+	// Other corners
+	__m256 g[3], i1[3], i2[3];
+	for(int c = 0; c < 3; ++c)
+		g[c] = glm_noise_step_avx2(x0[(c + 1) % 3], x0[c]);
+	for(int c = 0; c < 3; ++c)
+	{
+		__m256 const l = _mm256_sub_ps(One, g[(c + 2) % 3]);
+		i1[c] = _mm256_min_ps(g[c], l);
+		i2[c] = _mm256_max_ps(g[c], l);
+	}
+
+	__m256 x1[3], x2[3], x3[3];
+	for(int c = 0; c < 3; ++c)
+	{
+		x1[c] = _mm256_add_ps(_mm256_sub_ps(x0[c], i1[c]), Cx);
+		x2[c] = _mm256_add_ps(_mm256_sub_ps(x0[c], i2[c]), Cy);
+		x3[c] = _mm256_sub_ps(x0[c], _mm256_set1_ps(0.5f));
+	}
+
+	// Permutations
+	for(int c = 0; c < 3; ++c)
+		i[c] = glm_noise_mod289_avx2(i[c]);
+	__m256 p[4];
+	for(int k = 0; k < 4; ++k)
+	{
+		__m256 o[3];
+		for(int c = 0; c < 3; ++c)
+			o[c] = k == 0 ? _mm256_setzero_ps() : k == 1 ? i1[c] : k == 2 ? i2[c] : One;
+		p[k] = glm_noise_permute_avx2(_mm256_add_ps(_mm256_add_ps(glm_noise_permute_avx2(_mm256_add_ps(_mm256_add_ps(glm_noise_permute_avx2(
+			_mm256_add_ps(i[2], o[2])), i[1]), o[1])), i[0]), o[0]));
+	}
+
+	// Mix final noise value
+	__m256 const* const x[4] = {x0, x1, x2, x3};
+	__m256 n[4];
+	for(int k = 0; k < 4; ++k)
+	{
+		__m256 m = _mm256_max_ps(_mm256_sub_ps(_mm256_set1_ps(0.6f), _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x[k][0], x[k][0]), _mm256_mul_ps(x[k][1], x[k][1])), _mm256_mul_ps(x[k][2], x[k][2]))), _mm256_setzero_ps());
+		m = _mm256_mul_ps(m, m);
+		n[k] = _mm256_mul_ps(_mm256_mul_ps(m, m), glm_simplex3_gradient_avx2(p[k], x[k]));
+	}
+	return _mm256_mul_ps(_mm256_set1_ps(42.0f), _mm256_add_ps(_mm256_add_ps(n[0], n[1]), _mm256_add_ps(n[2], n[3])));
+}
+
+// gtc::grad4 normalized and dotted with the offset x.
+GLM_BATCH_AVX2_INLINE __m256 glm_simplex4_gradient_avx2(__m256 j, __m256 const x[4])
+{
+	__m256 const ip[3] = {_mm256_set1_ps(1.0f / 294.0f), _mm256_set1_ps(1.0f / 49.0f), _mm256_set1_ps(1.0f / 7.0f)};
+	__m256 g[4];
+	for(int c = 0; c < 3; ++c)
+		g[c] = _mm256_sub_ps(_mm256_mul_ps(_mm256_floor_ps(_mm256_mul_ps(glm_noise_fract_avx2(_mm256_mul_ps(j, ip[c])), _mm256_set1_ps(7.0f))), ip[2]), _mm256_set1_ps(1.0f));
+	g[3] = _mm256_sub_ps(_mm256_set1_ps(1.5f), _mm256_add_ps(_mm256_add_ps(glm_noise_abs_avx2(g[0]), glm_noise_abs_avx2(g[1])), glm_noise_abs_avx2(g[2])));
+
+	__m256 const Zero = _mm256_setzero_ps();
+	__m256 const sw = glm_noise_less_avx2(g[3], Zero);
+	for(int c = 0; c < 3; ++c)
+		g[c] = _mm256_add_ps(g[c], _mm256_mul_ps(_mm256_sub_ps(_mm256_mul_ps(glm_noise_less_avx2(g[c], Zero), _mm256_set1_ps(2.0f)), _mm256_set1_ps(1.0f)), sw));
+
+	__m256 const Norm = glm_noise_taylor_inv_sqrt_avx2(_mm256_add_ps(
+		_mm256_add_ps(_mm256_mul_ps(g[0], g[0]), _mm256_mul_ps(g[1], g[1])),
+		_mm256_add_ps(_mm256_mul_ps(g[2], g[2]), _mm256_mul_ps(g[3], g[3]))));
+	return _mm256_add_ps(
+		_mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(g[0], Norm), x[0]), _mm256_mul_ps(_mm256_mul_ps(g[1], Norm), x[1])),
+		_mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(g[2], Norm), x[2]), _mm256_mul_ps(_mm256_mul_ps(g[3], Norm), x[3])));
+}
+
+GLM_BATCH_AVX2_INLINE __m256 glm_simplex_avx2(__m256 const (&v)[4])
+{
+	__m256 const C[4] = {
+		_mm256_set1_ps(0.138196601125011f),
+		_mm256_set1_ps(0.276393202250021f),
+		_mm256_set1_ps(0.414589803375032f),
+		_mm256_set1_ps(-0.447213595499958f)};
+	__m256 const F4 = _mm256_set1_ps(0.309016994374947451f);
+	__m256 const Zero = _mm256_setzero_ps();
+	__m256 const One = _mm256_set1_ps(1.0f);
+
+	// First corner
+	__m256 const s = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(v[0], F4), _mm256_mul_ps(v[1], F4)), _mm256_add_ps(_mm256_mul_ps(v[2], F4), _mm256_mul_ps(v[3], F4)));
+	__m256 i[4];
+	for(int c = 0; c < 4; ++c)
+		i[c] = _mm256_floor_ps(_mm256_add_ps(v[c], s));
+	__m256 const t = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(i[0], C[0]), _mm256_mul_ps(i[1], C[0])), _mm256_add_ps(_mm256_mul_ps(i[2], C[0]), _mm256_mul_ps(i[3], C[0])));
+	__m256 x[5][4];
+	for(int c = 0; c < 4; ++c)
+		x[0][c] = _mm256_add_ps(_mm256_sub_ps(v[c], i[c]), t);
+
+	// Rank sorting, i0 holds 0, 1, 2 and 3 once each
+	__m256 const isXy = glm_noise_step_avx2(x[0][1], x[0][0]);
+	__m256 const isXz = glm_noise_step_avx2(x[0][2], x[0][0]);
+	__m256 const isXw = glm_noise_step_avx2(x[0][3], x[0][0]);
+	__m256 const isYz = glm_noise_step_avx2(x[0][2], x[0][1]);
+	__m256 const isYw = glm_noise_step_avx2(x[0][3], x[0][1]);
+	__m256 const isZw = glm_noise_step_avx2(x[0][3], x[0][2]);
+	__m256 i0[4];
+	i0[0] = _mm256_add_ps(_mm256_add_ps(isXy, isXz), isXw);
+	i0[1] = _mm256_add_ps(_mm256_sub_ps(One, isXy), _mm256_add_ps(isYz, isYw));
+	i0[2] = _mm256_add_ps(_mm256_add_ps(_mm256_sub_ps(One, isXz), _mm256_sub_ps(One, isYz)), isZw);
+	i0[3] = _mm256_add_ps(_mm256_add_ps(_mm256_sub_ps(One, isXw), _mm256_sub_ps(One, isYw)), _mm256_sub_ps(One, isZw));
+
+	// ic[k] is i(k + 1): i1, i2 and i3
+	__m256 ic[3][4];
+	for(int c = 0; c < 4; ++c)
+	{
+		ic[2][c] = _mm256_min_ps(_mm256_max_ps(i0[c], Zero), One);
+		ic[1][c] = _mm256_min_ps(_mm256_max_ps(_mm256_sub_ps(i0[c], One), Zero), One);
+		ic[0][c] = _mm256_min_ps(_mm256_max_ps(_mm256_sub_ps(i0[c], _mm256_set1_ps(2.0f)), Zero), One);
+	}
+
+	for(int c = 0; c < 4; ++c)
+	{
+		for(int k = 0; k < 3; ++k)
+			x[k + 1][c] = _mm256_add_ps(_mm256_sub_ps(x[0][c], ic[k][c]), C[k]);
+		x[4][c] = _mm256_add_ps(x[0][c], C[3]);
+	}
+
+	// Permutations
+	for(int c = 0; c < 4; ++c)
+		i[c] = glm_noise_mod_avx2(i[c]);
+	__m256 j[5];
+	j[0] = glm_noise_permute_avx2(_mm256_add_ps(glm_noise_permute_avx2(_mm256_add_ps(glm_noise_permute_avx2(_mm256_add_ps(glm_noise_permute_avx2(i[3]), i[2])), i[1])), i[0]));
+	for(int k = 1; k < 5; ++k)
+	{
+		__m256 const* o = k < 4 ? ic[k - 1] : NULL;
+		__m256 h = glm_noise_permute_avx2(_mm256_add_ps(i[3], o ? o[3] : One));
+		for(int c = 2; c >= 0; --c)
+			h = glm_noise_permute_avx2(_mm256_add_ps(_mm256_add_ps(h, i[c]), o ? o[c] : One));
+		j[k] = h;
+	}
+
+	// Mix contributions from the five corners
+	__m256 n[5];
+	for(int k = 0; k < 5; ++k)
+	{
+		__m256 m = _mm256_max_ps(_mm256_sub_ps(_mm256_set1_ps(0.6f), _mm256_add_ps(
+			_mm256_add_ps(_mm256_mul_ps(x[k][0], x[k][0]), _mm256_mul_ps(x[k][1], x[k][1])),
+			_mm256_add_ps(_mm256_mul_ps(x[k][2], x[k][2]), _mm256_mul_ps(x[k][3], x[k][3])))), Zero);
+		m = _mm256_mul_ps(m, m);
+		n[k] = _mm256_mul_ps(_mm256_mul_ps(m, m), glm_simplex4_gradient_avx2(j[k], x[k]));
+	}
+	return _mm256_mul_ps(_mm256_set1_ps(49.0f), _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(n[0], n[1]), n[2]), _mm256_add_ps(n[3], n[4])));
+}
+
+template<glm::length_t L>
+GLM_BATCH_AVX2_INLINE __m256 glm_noise_fractal_avx2(__m256 const (&p)[L], glm::detail::noise_fractal const& Fractal)
+{
+	__m256 Sum = _mm256_setzero_ps();
+	float Amplitude = 1.0f;
+	float Frequency = 1.0f;
+	for(int o = 0; o < Fractal.Octaves; ++o)
+	{
+		__m256 q[L];
+		for(glm::length_t c = 0; c < L; ++c)
+			q[c] = _mm256_mul_ps(p[c], _mm256_set1_ps(Frequency));
+		__m256 n = Fractal.Basis ? glm_simplex_avx2(q) : glm_perlin_avx2(q);
+		if(Fractal.Ridged)
+		{
+			n = _mm256_sub_ps(_mm256_set1_ps(1.0f), glm_noise_abs_avx2(n));
+			n = _mm256_mul_ps(n, n);
+		}
+		Sum = _mm256_add_ps(Sum, _mm256_mul_ps(_mm256_set1_ps(Amplitude), n));
+		Amplitude *= Fractal.Gain;
+		Frequency *= Fractal.Lacunarity;
+	}
+	return Sum;
+}
+
+// Full groups of 8 points are gathered, the rest goes to the SSE2 kernel.
+template<glm::length_t L>
+inline GLM_BATCH_AVX2 void glm_noise_batch_avx2(float const* In, std::size_t Stride, float* Out, std::size_t Count, glm::detail::noise_fractal const& Fractal)
+{
+	__m256i const Index = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(static_cast<int>(Stride)));
+	std::size_t i = 0;
+	for(; i + 8 <= Count; i += 8)
+	{
+		__m256 p[L];
+		for(glm::length_t c = 0; c < L; ++c)
+			p[c] = _mm256_i32gather_ps(In + i * Stride + c, Index, 4);
+		_mm256_storeu_ps(Out + i, glm_noise_fractal_avx2(p, Fractal));
+	}
+
+	glm_noise_batch_sse2<L>(In + i * Stride, Stride, Out + i, Count - i, Fractal);
+}
+
+template<glm::length_t L>
+inline GLM_BATCH_AVX2 void glm_noise_row_avx2(float* Out, std::size_t First, std::size_t Last, float y, float const* Origin, float const* DeltaX, float const* DeltaY, glm::detail::noise_fractal const& Fractal)
+{
+	__m256 const Lanes = _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f);
+	__m256 const Y = _mm256_set1_ps(y);
+	std::size_t x = First;
+	for(; x + 8 <= Last; x += 8)
+	{
+		__m256 const X = _mm256_add_ps(_mm256_set1_ps(static_cast<float>(x)), Lanes);
+		__m256 p[L];
+		for(glm::length_t c = 0; c < L; ++c)
+			p[c] = _mm256_add_ps(_mm256_add_ps(_mm256_set1_ps(Origin[c]), _mm256_mul_ps(_mm256_set1_ps(DeltaX[c]), X)), _mm256_mul_ps(_mm256_set1_ps(DeltaY[c]), Y));
+		_mm256_storeu_ps(Out + (x - First), glm_noise_fractal_avx2(p, Fractal));
+	}
+
+	glm_noise_row_sse2<L>(Out + (x - First), x, Last, y, Origin, DeltaX, DeltaY, Fractal);
+}
+
+template<glm::length_t L>
+inline GLM_BATCH_AVX2 void glm_noise_grid_avx2(float* Out, std::size_t Width, std::size_t Row, std::size_t Rows, float const* Origin, float const* DeltaX, float const* DeltaY, glm::detail::noise_fractal const& Fractal)
+{
+	for(std::size_t y = Row; y < Row + Rows; ++y)
+		glm_noise_row_avx2<L>(Out + y * Width, 0, Width, static_cast<float>(y), Origin, DeltaX, DeltaY, Fractal);
+}
+
+#endif//GLM_BATCH_X86
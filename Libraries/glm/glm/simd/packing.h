@@ -1,8 +1,713 @@
 /// @ref simd
 /// @file glm/simd/packing.h
+///
+/// Kernels for the GLM_GTC_packing batch functions: float arrays to and from half, 8 and 16 bit normalized integers,
+/// 10:10:10:2 normalized and 11:11:10 floats. Every kernel gives the same bits as the scalar gtc_packing function
+/// it replaces. The instruction set is picked at runtime, see matrix_batch.h.
+///
+/// The half conversions are integer code rather than F16C: toFloat16 rounds ties away from zero and keeps NaN
+/// payloads, vcvtps2ph rounds ties to even and quiets NaNs.
 
 #pragma once
 
-#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+#include "matrix_batch.h"
+#include <cstring>
 
-#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+#if GLM_BATCH_X86
+
+///////////////////////////////////////////////////////////////////////////////////
+// SSE2
+
+GLM_FUNC_QUALIFIER glm_ivec4 glm_batch_select_sse2(glm_ivec4 Mask, glm_ivec4 a, glm_ivec4 b)
+{
+	return _mm_or_si128(_mm_and_si128(Mask, a), _mm_andnot_si128(Mask, b));
+}
+
+// round(), halfway cases away from zero. The fraction is exact, so unlike floor(x + 0.5) nothing rounds twice.
+GLM_FUNC_QUALIFIER glm_ivec4 glm_vec4_round_away_sse2(glm_vec4 x)
+{
+	glm_ivec4 const t = _mm_cvttps_epi32(x);
+	glm_vec4 const f = _mm_sub_ps(x, _mm_cvtepi32_ps(t));
+	glm_ivec4 const Up = _mm_castps_si128(_mm_cmpge_ps(f, _mm_set1_ps(0.5f)));
+	glm_ivec4 const Down = _mm_castps_si128(_mm_cmple_ps(f, _mm_set1_ps(-0.5f)));
+	return _mm_add_epi32(_mm_sub_epi32(t, Up), Down);
+}
+
+// round(clamp(v, Min, 1) * Scale)
+GLM_FUNC_QUALIFIER glm_ivec4 glm_vec4_norm_sse2(glm_vec4 v, glm_vec4 Min, glm_vec4 Scale)
+{
+	return glm_vec4_round_away_sse2(_mm_mul_ps(_mm_min_ps(_mm_max_ps(v, Min), _mm_set1_ps(1.0f)), Scale));
+}
+
+// detail::toFloat16, the half in the low 16 bits of each lane.
+GLM_FUNC_QUALIFIER glm_ivec4 glm_vec4_to_half_sse2(glm_vec4 v)
+{
+	glm_ivec4 const i = _mm_castps_si128(v);
+	glm_ivec4 const a = _mm_and_si128(i, _mm_set1_epi32(0x7fffffff));
+	glm_ivec4 const Sign = _mm_and_si128(_mm_srli_epi32(i, 16), _mm_set1_epi32(0x8000));
+
+	// Normalized: rebias the exponent, a carry out of the rounded significand bumps it, overflow becomes infinity.
+	glm_ivec4 Normal = _mm_srli_epi32(_mm_add_epi32(_mm_sub_epi32(a, _mm_set1_epi32(0x38000000)), _mm_set1_epi32(0x1000)), 13);
+	Normal = glm_batch_select_sse2(_mm_cmpgt_epi32(Normal, _mm_set1_epi32(0x7bff)), _mm_set1_epi32(0x7c00), Normal);
+
+	// Denormalized, or zero below half the smallest denormal: the half is |v| * 2^24 rounded.
+	glm_ivec4 const Denormal = glm_vec4_round_away_sse2(_mm_mul_ps(_mm_castsi128_ps(a), _mm_set1_ps(16777216.0f)));
+
+	// Infinity, or a NaN keeping the 10 leftmost bits of its significand and at least one of them set.
+	glm_ivec4 const Significand = _mm_srli_epi32(_mm_and_si128(a, _mm_set1_epi32(0x007fffff)), 13);
+	glm_ivec4 const NaN = _mm_cmpgt_epi32(a, _mm_set1_epi32(0x7f800000));
+	glm_ivec4 const Quiet = _mm_and_si128(_mm_and_si128(NaN, _mm_cmpeq_epi32(Significand, _mm_setzero_si128())), _mm_set1_epi32(1));
+	glm_ivec4 const Special = _mm_or_si128(_mm_or_si128(Significand, Quiet), _mm_set1_epi32(0x7c00));
+
+	glm_ivec4 Result = glm_batch_select_sse2(_mm_cmplt_epi32(a, _mm_set1_epi32(0x38800000)), Denormal, Normal);
+	Result = glm_batch_select_sse2(_mm_cmpgt_epi32(a, _mm_set1_epi32(0x7f7fffff)), Special, Result);
+	return _mm_or_si128(Result, Sign);
+}
+
+// detail::toFloat32 of the half in the low 16 bits of each lane, the upper bits are zero.
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_from_half_sse2(glm_ivec4 h)
+{
+	glm_ivec4 const Shifted = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x7fff)), 13);
+	glm_ivec4 const Exponent = _mm_and_si128(Shifted, _mm_set1_epi32(0x0f800000));
+	glm_ivec4 Result = _mm_add_epi32(Shifted, _mm_set1_epi32(0x38000000));
+
+	// Infinity and NaN: one more rebias takes the exponent to 255.
+	Result = _mm_add_epi32(Result, _mm_and_si128(_mm_cmpeq_epi32(Exponent, _mm_set1_epi32(0x0f800000)), _mm_set1_epi32(0x38000000)));
+
+	// Zero and denormals: 2^-14 * (1 + m / 1024) - 2^-14 is exactly m * 2^-24.
+	glm_vec4 const Denormal = _mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(Result, _mm_set1_epi32(0x00800000))), _mm_set1_ps(6.103515625e-5f));
+	Result = glm_batch_select_sse2(_mm_cmpeq_epi32(Exponent, _mm_setzero_si128()), _mm_castps_si128(Denormal), Result);
+
+	return _mm_castsi128_ps(_mm_or_si128(Result, _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x8000)), 16)));
+}
+
+// detail::floatTo11bit with 6 significand bits, floatTo10bit with 5. The sign is dropped.
+GLM_FUNC_QUALIFIER glm_ivec4 glm_vec4_to_packed_float_sse2(glm_vec4 v, int SignificandBits)
+{
+	glm_ivec4 const f = _mm_castps_si128(v);
+	glm_ivec4 const Shift = _mm_cvtsi32_si128(23 - SignificandBits);
+	glm_ivec4 const ExponentMask = _mm_set1_epi32(0x1f << SignificandBits);
+
+	glm_ivec4 const Exponent = _mm_and_si128(_mm_srl_epi32(_mm_sub_epi32(_mm_and_si128(f, _mm_set1_epi32(0x7f800000)), _mm_set1_epi32(0x38000000)), Shift), ExponentMask);
+	glm_ivec4 const Significand = _mm_and_si128(_mm_srl_epi32(f, Shift), _mm_set1_epi32((1 << SignificandBits) - 1));
+	glm_ivec4 Result = _mm_or_si128(Exponent, Significand);
+
+	glm_ivec4 const Inf = _mm_cmpeq_epi32(_mm_and_si128(f, _mm_set1_epi32(0x7fffffff)), _mm_set1_epi32(0x7f800000));
+	Result = glm_batch_select_sse2(Inf, ExponentMask, Result);
+	Result = _mm_or_si128(Result, _mm_castps_si128(_mm_cmpunord_ps(v, v)));
+	Result = _mm_andnot_si128(_mm_castps_si128(_mm_cmpeq_ps(v, _mm_setzero_ps())), Result);
+	return _mm_and_si128(Result, _mm_set1_epi32((1 << (SignificandBits + 5)) - 1));
+}
+
+// detail::packed11bitToFloat and packed10bitToFloat, including their quirks: p isn't masked before the zero, NaN
+// and infinity tests, and NaN and infinity both come back as -1.
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_from_packed_float_sse2(glm_ivec4 p, int SignificandBits)
+{
+	glm_ivec4 const Shift = _mm_cvtsi32_si128(23 - SignificandBits);
+	glm_ivec4 const ExponentMask = _mm_set1_epi32(0x1f << SignificandBits);
+
+	glm_ivec4 const Exponent = _mm_and_si128(_mm_add_epi32(_mm_sll_epi32(_mm_and_si128(p, ExponentMask), Shift), _mm_set1_epi32(0x38000000)), _mm_set1_epi32(0x7f800000));
+	glm_ivec4 Result = _mm_or_si128(Exponent, _mm_sll_epi32(_mm_and_si128(p, _mm_set1_epi32((1 << SignificandBits) - 1)), Shift));
+
+	glm_ivec4 const Special = _mm_or_si128(_mm_cmpeq_epi32(p, ExponentMask), _mm_cmpeq_epi32(p, _mm_set1_epi32((1 << (SignificandBits + 5)) - 1)));
+	Result = glm_batch_select_sse2(Special, _mm_set1_epi32(static_cast<int>(0xbf800000)), Result);
+	Result = _mm_andnot_si128(_mm_cmpeq_epi32(p, _mm_setzero_si128()), Result);
+	return _mm_castsi128_ps(Result);
+}
+
+// Low 16 bits of each lane of a then b.
+GLM_FUNC_QUALIFIER glm_ivec4 glm_batch_narrow16_sse2(glm_ivec4 a, glm_ivec4 b)
+{
+	return _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(a, 16), 16), _mm_srai_epi32(_mm_slli_epi32(b, 16), 16));
+}
+
+// Low 8 bits of each lane of a, b, c then d.
+GLM_FUNC_QUALIFIER glm_ivec4 glm_batch_narrow8_sse2(glm_ivec4 a, glm_ivec4 b, glm_ivec4 c, glm_ivec4 d)
+{
+	glm_ivec4 const Mask = _mm_set1_epi32(0xff);
+	glm_ivec4 const ab = _mm_packs_epi32(_mm_and_si128(a, Mask), _mm_and_si128(b, Mask));
+	glm_ivec4 const cd = _mm_packs_epi32(_mm_and_si128(c, Mask), _mm_and_si128(d, Mask));
+	return _mm_packus_epi16(ab, cd);
+}
+
+GLM_FUNC_QUALIFIER void glm_batch_transpose4_sse2(glm_vec4 r[4])
+{
+	glm_vec4 const t0 = _mm_unpacklo_ps(r[0], r[1]);
+	glm_vec4 const t1 = _mm_unpacklo_ps(r[2], r[3]);
+	glm_vec4 const t2 = _mm_unpackhi_ps(r[0], r[1]);
+	glm_vec4 const t3 = _mm_unpackhi_ps(r[2], r[3]);
+	r[0] = _mm_movelh_ps(t0, t1);
+	r[1] = _mm_movehl_ps(t1, t0);
+	r[2] = _mm_movelh_ps(t2, t3);
+	r[3] = _mm_movehl_ps(t3, t2);
+}
+
+// Four vec3 {x0 y0 z0 x1} {y1 z1 x2 y2} {z2 x3 y3 z3} to {x0 x1 x2 x3} {y0 y1 y2 y3} {z0 z1 z2 z3}.
+GLM_FUNC_QUALIFIER void glm_batch_deinterleave3_sse2(glm_vec4 const a, glm_vec4 const b, glm_vec4 const c, glm_vec4 r[3])
+{
+	r[0] = _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+	r[1] = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+	r[2] = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), c, _MM_SHUFFLE(3, 0, 2, 0));
+}
+
+// The inverse of glm_batch_deinterleave3_sse2.
+GLM_FUNC_QUALIFIER void glm_batch_interleave3_sse2(glm_vec4 const x, glm_vec4 const y, glm_vec4 const z, glm_vec4 r[3])
+{
+	r[0] = _mm_shuffle_ps(_mm_unpacklo_ps(x, y), _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 1, 0));
+	r[1] = _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), _mm_unpackhi_ps(x, y), _MM_SHUFFLE(1, 0, 2, 0));
+	r[2] = _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+}
+
+// Eight floats to eight halves.
+GLM_FUNC_QUALIFIER void glm_pack_half8_sse2(float const* In, unsigned short* Out)
+{
+	glm_ivec4 const a = glm_vec4_to_half_sse2(_mm_loadu_ps(In));
+	glm_ivec4 const b = glm_vec4_to_half_sse2(_mm_loadu_ps(In + 4));
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(Out), glm_batch_narrow16_sse2(a, b));
+}
+
+GLM_FUNC_QUALIFIER void glm_unpack_half8_sse2(unsigned short const* In, float* Out)
+{
+	glm_ivec4 const h = _mm_loadu_si128(reinterpret_cast<__m128i const*>(In));
+	_mm_storeu_ps(Out, glm_vec4_from_half_sse2(_mm_unpacklo_epi16(h, _mm_setzero_si128())));
+	_mm_storeu_ps(Out + 4, glm_vec4_from_half_sse2(_mm_unpackhi_epi16(h, _mm_setzero_si128())));
+}
+
+// Sixteen floats to 8 bit normalized integers, snorm when Signed, unorm otherwise.
+template<bool Signed>
+GLM_FUNC_QUALIFIER void glm_pack_norm8x16_sse2(float const* In, unsigned char* Out)
+{
+	glm_vec4 const Min = _mm_set1_ps(Signed ? -1.0f : 0.0f);
+	glm_vec4 const Scale = _mm_set1_ps(Signed ? 127.0f : 255.0f);
+	glm_ivec4 const a = glm_vec4_norm_sse2(_mm_loadu_ps(In), Min, Scale);
+	glm_ivec4 const b = glm_vec4_norm_sse2(_mm_loadu_ps(In + 4), Min, Scale);
+	glm_ivec4 const c = glm_vec4_norm_sse2(_mm_loadu_ps(In + 8), Min, Scale);
+	glm_ivec4 const d = glm_vec4_norm_sse2(_mm_loadu_ps(In + 12), Min, Scale);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(Out), glm_batch_narrow8_sse2(a, b, c, d));
+}
+
+template<bool Signed>
+GLM_FUNC_QUALIFIER void glm_unpack_norm8x16_sse2(unsigned char const* In, float* Out)
+{
+	glm_ivec4 const p = _mm_loadu_si128(reinterpret_cast<__m128i const*>(In));
+	glm_ivec4 const Zero = _mm_setzero_si128();
+	glm_ivec4 i[4];
+	if(Signed)
+	{
+		glm_ivec4 const lo = _mm_unpacklo_epi8(p, p);
+		glm_ivec4 const hi = _mm_unpackhi_epi8(p, p);
+		i[0] = _mm_srai_epi32(_mm_unpacklo_epi16(lo, lo), 24);
+		i[1] = _mm_srai_epi32(_mm_unpackhi_epi16(lo, lo), 24);
+		i[2] = _mm_srai_epi32(_mm_unpacklo_epi16(hi, hi), 24);
+		i[3] = _mm_srai_epi32(_mm_unpackhi_epi16(hi, hi), 24);
+	}
+	else
+	{
+		glm_ivec4 const lo = _mm_unpacklo_epi8(p, Zero);
+		glm_ivec4 const hi = _mm_unpackhi_epi8(p, Zero);
+		i[0] = _mm_unpacklo_epi16(lo, Zero);
+		i[1] = _mm_unpackhi_epi16(lo, Zero);
+		i[2] = _mm_unpacklo_epi16(hi, Zero);
+		i[3] = _mm_unpackhi_epi16(hi, Zero);
+	}
+
+	// Same constants as unpackSnorm1x8 and unpackUnorm1x8, only the signed values need the clamp.
+	glm_vec4 const Scale = _mm_set1_ps(Signed ? 0.00787401574803149606299212598425f : static_cast<float>(0.0039215686274509803921568627451));
+	for(int k = 0; k < 4; ++k)
+	{
+		glm_vec4 v = _mm_mul_ps(_mm_cvtepi32_ps(i[k]), Scale);
+		if(Signed)
+			v = _mm_min_ps(_mm_max_ps(v, _mm_set1_ps(-1.0f)), _mm_set1_ps(1.0f));
+		_mm_storeu_ps(Out + k * 4, v);
+	}
+}
+
+// Eight floats to 16 bit normalized integers.
+template<bool Signed>
+GLM_FUNC_QUALIFIER void glm_pack_norm16x8_sse2(float const* In, unsigned short* Out)
+{
+	glm_vec4 const Min = _mm_set1_ps(Signed ? -1.0f : 0.0f);
+	glm_vec4 const Scale = _mm_set1_ps(Signed ? 32767.0f : 65535.0f);
+	glm_ivec4 const a = glm_vec4_norm_sse2(_mm_loadu_ps(In), Min, Scale);
+	glm_ivec4 const b = glm_vec4_norm_sse2(_mm_loadu_ps(In + 4), Min, Scale);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(Out), glm_batch_narrow16_sse2(a, b));
+}
+
+template<bool Signed>
+GLM_FUNC_QUALIFIER void glm_unpack_norm16x8_sse2(unsigned short const* In, float* Out)
+{
+	glm_ivec4 const p = _mm_loadu_si128(reinterpret_cast<__m128i const*>(In));
+	glm_ivec4 i[2];
+	if(Signed)
+	{
+		i[0] = _mm_srai_epi32(_mm_unpacklo_epi16(p, p), 16);
+		i[1] = _mm_srai_epi32(_mm_unpackhi_epi16(p, p), 16);
+	}
+	else
+	{
+		i[0] = _mm_unpacklo_epi16(p, _mm_setzero_si128());
+		i[1] = _mm_unpackhi_epi16(p, _mm_setzero_si128());
+	}
+
+	glm_vec4 const Scale = _mm_set1_ps(Signed ? 3.0518509475997192297128208258309e-5f : 1.5259021896696421759365224689097e-5f);
+	for(int k = 0; k < 2; ++k)
+	{
+		glm_vec4 v = _mm_mul_ps(_mm_cvtepi32_ps(i[k]), Scale);
+		if(Signed)
+			v = _mm_min_ps(_mm_max_ps(v, _mm_set1_ps(-1.0f)), _mm_set1_ps(1.0f));
+		_mm_storeu_ps(Out + k * 4, v);
+	}
+}
+
+// Four vec4 to 10:10:10:2, packSnorm3x10_1x2 when Signed, packUnorm3x10_1x2 otherwise.
+template<bool Signed>
+GLM_FUNC_QUALIFIER void glm_pack_norm3x10_1x2x4_sse2(float const* In, unsigned int* Out)
+{
+	glm_vec4 r[4] = {_mm_loadu_ps(In), _mm_loadu_ps(In + 4), _mm_loadu_ps(In + 8), _mm_loadu_ps(In + 12)};
+	glm_batch_transpose4_sse2(r);
+
+	glm_vec4 const Min = _mm_set1_ps(Signed ? -1.0f : 0.0f);
+	glm_vec4 const Scale = _mm_set1_ps(Signed ? 511.0f : 1023.0f);
+	glm_ivec4 const Mask = _mm_set1_epi32(0x3ff);
+	glm_ivec4 const x = _mm_and_si128(glm_vec4_norm_sse2(r[0], Min, Scale), Mask);
+	glm_ivec4 const y = _mm_and_si128(glm_vec4_norm_sse2(r[1], Min, Scale), Mask);
+	glm_ivec4 const z = _mm_and_si128(glm_vec4_norm_sse2(r[2], Min, Scale), Mask);
+	glm_ivec4 const w = glm_vec4_norm_sse2(r[3], Min, _mm_set1_ps(Signed ? 1.0f : 3.0f));
+
+	glm_ivec4 const Result = _mm_or_si128(_mm_or_si128(x, _mm_slli_epi32(y, 10)), _mm_or_si128(_mm_slli_epi32(z, 20), _mm_slli_epi32(w, 30)));
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(Out), Result);
+}
+
+template<bool Signed>
+GLM_FUNC_QUALIFIER void glm_unpack_norm3x10_1x2x4_sse2(unsigned int const* In, float* Out)
+{
+	glm_ivec4 const p = _mm_loadu_si128(reinterpret_cast<__m128i const*>(In));
+	glm_vec4 r[4];
+	if(Signed)
+	{
+		glm_vec4 const Scale = _mm_set1_ps(1.f / 511.f);
+		glm_vec4 const Min = _mm_set1_ps(-1.0f);
+		glm_vec4 const Max = _mm_set1_ps(1.0f);
+		r[0] = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(p, 22), 22)), Scale), Min), Max);
+		r[1] = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(p, 12), 22)), Scale), Min), Max);
+		r[2] = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(p, 2), 22)), Scale), Min), Max);
+		r[3] = _mm_min_ps(_mm_max_ps(_mm_cvtepi32_ps(_mm_srai_epi32(p, 30)), Min), Max);
+	}
+	else
+	{
+		glm_vec4 const Scale = _mm_set1_ps(1.0f / 1023.f);
+		glm_ivec4 const Mask = _mm_set1_epi32(0x3ff);
+		r[0] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(p, Mask)), Scale);
+		r[1] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(p, 10), Mask)), Scale);
+		r[2] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(p, 20), Mask)), Scale);
+		r[3] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(p, 30)), _mm_set1_ps(1.0f / 3.f));
+	}
+
+	glm_batch_transpose4_sse2(r);
+	for(int k = 0; k < 4; ++k)
+		_mm_storeu_ps(Out + k * 4, r[k]);
+}
+
+// Four vec3 to 11:11:10 floats.
+GLM_FUNC_QUALIFIER void glm_pack_f2x11_1x10x4_sse2(float const* In, unsigned int* Out)
+{
+	glm_vec4 r[3];
+	glm_batch_deinterleave3_sse2(_mm_loadu_ps(In), _mm_loadu_ps(In + 4), _mm_loadu_ps(In + 8), r);
+
+	glm_ivec4 const x = glm_vec4_to_packed_float_sse2(r[0], 6);
+	glm_ivec4 const y = glm_vec4_to_packed_float_sse2(r[1], 6);
+	glm_ivec4 const z = glm_vec4_to_packed_float_sse2(r[2], 5);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(Out), _mm_or_si128(_mm_or_si128(x, _mm_slli_epi32(y, 11)), _mm_slli_epi32(z, 22)));
+}
+
+GLM_FUNC_QUALIFIER void glm_unpack_f2x11_1x10x4_sse2(unsigned int const* In, float* Out)
+{
+	glm_ivec4 const p = _mm_loadu_si128(reinterpret_cast<__m128i const*>(In));
+	glm_vec4 r[3];
+	glm_batch_interleave3_sse2(
+		glm_vec4_from_packed_float_sse2(p, 6),
+		glm_vec4_from_packed_float_sse2(_mm_srli_epi32(p, 11), 6),
+		glm_vec4_from_packed_float_sse2(_mm_srli_epi32(p, 22), 5), r);
+	_mm_storeu_ps(Out, r[0]);
+	_mm_storeu_ps(Out + 4, r[1]);
+	_mm_storeu_ps(Out + 8, r[2]);
+}
+
+// Runs Block over the whole groups of N elements, then over a zero padded copy of the last partial group.
+// An element is InStride values of In and OutStride values of Out.
+template<std::size_t N, std::size_t InStride, std::size_t OutStride, typename inType, typename outType>
+GLM_FUNC_QUALIFIER void glm_batch_blocks_sse2(inType const* In, outType* Out, std::size_t Count, void (*Block)(inType const*, outType*))
+{
+	std::size_t i = 0;
+	for(; i + N <= Count; i += N)
+		Block(In + i * InStride, Out + i * OutStride);
+	if(i == Count)
+		return;
+
+	inType Tail[N * InStride];
+	outType Result[N * OutStride];
+	std::memset(Tail, 0, sizeof(Tail));
+	std::memcpy(Tail, In + i * InStride, (Count - i) * InStride * sizeof(inType));
+	Block(Tail, Result);
+	std::memcpy(Out + i * OutStride, Result, (Count - i) * OutStride * sizeof(outType));
+}
+
+GLM_FUNC_QUALIFIER void glm_pack_half_batch_sse2(float const* In, unsigned short* Out, std::size_t Count)
+{
+	glm_batch_blocks_sse2<8, 1, 1>(In, Out, Count, glm_pack_half8_sse2);
+}
+
+GLM_FUNC_QUALIFIER void glm_unpack_half_batch_sse2(unsigned short const* In, float* Out, std::size_t Count)
+{
+	glm_batch_blocks_sse2<8, 1, 1>(In, Out, Count, glm_unpack_half8_sse2);
+}
+
+GLM_FUNC_QUALIFIER void glm_pack_norm8_batch_sse2(float const* In, unsigned char* Out, std::size_t Count, bool Signed)
+{
+	glm_batch_blocks_sse2<16, 1, 1>(In, Out, Count, Signed ? glm_pack_norm8x16_sse2<true> : glm_pack_norm8x16_sse2<false>);
+}
+
+GLM_FUNC_QUALIFIER void glm_unpack_norm8_batch_sse2(unsigned char const* In, float* Out, std::size_t Count, bool Signed)
+{
+	glm_batch_blocks_sse2<16, 1, 1>(In, Out, Count, Signed ? glm_unpack_norm8x16_sse2<true> : glm_unpack_norm8x16_sse2<false>);
+}
+
+GLM_FUNC_QUALIFIER void glm_pack_norm16_batch_sse2(float const* In, unsigned short* Out, std::size_t Count, bool Signed)
+{
+	glm_batch_blocks_sse2<8, 1, 1>(In, Out, Count, Signed ? glm_pack_norm16x8_sse2<true> : glm_pack_norm16x8_sse2<false>);
+}
+
+GLM_FUNC_QUALIFIER void glm_unpack_norm16_batch_sse2(unsigned short const* In, float* Out, std::size_t Count, bool Signed)
+{
+	glm_batch_blocks_sse2<8, 1, 1>(In, Out, Count, Signed ? glm_unpack_norm16x8_sse2<true> : glm_unpack_norm16x8_sse2<false>);
+}
+
+// In holds 4 floats per element.
+GLM_FUNC_QUALIFIER void glm_pack_norm3x10_1x2_batch_sse2(float const* In, unsigned int* Out, std::size_t Count, bool Signed)
+{
+	glm_batch_blocks_sse2<4, 4, 1>(In, Out, Count, Signed ? glm_pack_norm3x10_1x2x4_sse2<true> : glm_pack_norm3x10_1x2x4_sse2<false>);
+}
+
+GLM_FUNC_QUALIFIER void glm_unpack_norm3x10_1x2_batch_sse2(unsigned int const* In, float* Out, std::size_t Count, bool Signed)
+{
+	glm_batch_blocks_sse2<4, 1, 4>(In, Out, Count, Signed ? glm_unpack_norm3x10_1x2x4_sse2<true> : glm_unpack_norm3x10_1x2x4_sse2<false>);
+}
+
+// In holds 3 floats per element.
+GLM_FUNC_QUALIFIER void glm_pack_f2x11_1x10_batch_sse2(float const* In, unsigned int* Out, std::size_t Count)
+{
+	glm_batch_blocks_sse2<4, 3, 1>(In, Out, Count, glm_pack_f2x11_1x10x4_sse2);
+}
+
+GLM_FUNC_QUALIFIER void glm_unpack_f2x11_1x10_batch_sse2(unsigned int const* In, float* Out, std::size_t Count)
+{
+	glm_batch_blocks_sse2<4, 1, 3>(In, Out, Count, glm_unpack_f2x11_1x10x4_sse2);
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+// AVX2, the same conversions eight lanes wide. The tails go through the SSE2 kernels.
+
+GLM_BATCH_AVX2_INLINE __m256i glm_vec8_round_away_avx2(__m256 x)
+{
+	__m256i const t = _mm256_cvttps_epi32(x);
+	__m256 const f = _mm256_sub_ps(x, _mm256_cvtepi32_ps(t));
+	__m256i const Up = _mm256_castps_si256(_mm256_cmp_ps(f, _mm256_set1_ps(0.5f), _CMP_GE_OQ));
+	__m256i const Down = _mm256_castps_si256(_mm256_cmp_ps(f, _mm256_set1_ps(-0.5f), _CMP_LE_OQ));
+	return _mm256_add_epi32(_mm256_sub_epi32(t, Up), Down);
+}
+
+GLM_BATCH_AVX2_INLINE __m256i glm_vec8_norm_avx2(__m256 v, __m256 Min, __m256 Scale)
+{
+	return glm_vec8_round_away_avx2(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(v, Min), _mm256_set1_ps(1.0f)), Scale));
+}
+
+GLM_BATCH_AVX2_INLINE __m256i glm_vec8_to_half_avx2(__m256 v)
+{
+	__m256i const i = _mm256_castps_si256(v);
+	__m256i const a = _mm256_and_si256(i, _mm256_set1_epi32(0x7fffffff));
+	__m256i const Sign = _mm256_and_si256(_mm256_srli_epi32(i, 16), _mm256_set1_epi32(0x8000));
+
+	__m256i const Normal = _mm256_min_epi32(_mm256_srli_epi32(_mm256_add_epi32(_mm256_sub_epi32(a, _mm256_set1_epi32(0x38000000)), _mm256_set1_epi32(0x1000)), 13), _mm256_set1_epi32(0x7c00));
+	__m256i const Denormal = glm_vec8_round_away_avx2(_mm256_mul_ps(_mm256_castsi256_ps(a), _mm256_set1_ps(16777216.0f)));
+
+	__m256i const Significand = _mm256_srli_epi32(_mm256_and_si256(a, _mm256_set1_epi32(0x007fffff)), 13);
+	__m256i const NaN = _mm256_cmpgt_epi32(a, _mm256_set1_epi32(0x7f800000));
+	__m256i const Quiet = _mm256_and_si256(_mm256_and_si256(NaN, _mm256_cmpeq_epi32(Significand, _mm256_setzero_si256())), _mm256_set1_epi32(1));
+	__m256i const Special = _mm256_or_si256(_mm256_or_si256(Significand, Quiet), _mm256_set1_epi32(0x7c00));
+
+	__m256i Result = _mm256_blendv_epi8(Normal, Denormal, _mm256_cmpgt_epi32(_mm256_set1_epi32(0x38800000), a));
+	Result = _mm256_blendv_epi8(Result, Special, _mm256_cmpgt_epi32(a, _mm256_set1_epi32(0x7f7fffff)));
+	return _mm256_or_si256(Result, Sign);
+}
+
+GLM_BATCH_AVX2_INLINE __m256 glm_vec8_from_half_avx2(__m256i h)
+{
+	__m256i const Shifted = _mm256_slli_epi32(_mm256_and_si256(h, _mm256_set1_epi32(0x7fff)), 13);
+	__m256i const Exponent = _mm256_and_si256(Shifted, _mm256_set1_epi32(0x0f800000));
+	__m256i Result = _mm256_add_epi32(Shifted, _mm256_set1_epi32(0x38000000));
+	Result = _mm256_add_epi32(Result, _mm256_and_si256(_mm256_cmpeq_epi32(Exponent, _mm256_set1_epi32(0x0f800000)), _mm256_set1_epi32(0x38000000)));
+
+	__m256 const Denormal = _mm256_sub_ps(_mm256_castsi256_ps(_mm256_add_epi32(Result, _mm256_set1_epi32(0x00800000))), _mm256_set1_ps(6.103515625e-5f));
+	Result = _mm256_blendv_epi8(Result, _mm256_castps_si256(Denormal), _mm256_cmpeq_epi32(Exponent, _mm256_setzero_si256()));
+
+	return _mm256_castsi256_ps(_mm256_or_si256(Result, _mm256_slli_epi32(_mm256_and_si256(h, _mm256_set1_epi32(0x8000)), 16)));
+}
+
+GLM_BATCH_AVX2_INLINE __m256i glm_vec8_to_packed_float_avx2(__m256 v, int SignificandBits)
+{
+	__m256i const f = _mm256_castps_si256(v);
+	__m128i const Shift = _mm_cvtsi32_si128(23 - SignificandBits);
+	__m256i const ExponentMask = _mm256_set1_epi32(0x1f << SignificandBits);
+
+	__m256i const Exponent = _mm256_and_si256(_mm256_srl_epi32(_mm256_sub_epi32(_mm256_and_si256(f, _mm256_set1_epi32(0x7f800000)), _mm256_set1_epi32(0x38000000)), Shift), ExponentMask);
+	__m256i const Significand = _mm256_and_si256(_mm256_srl_epi32(f, Shift), _mm256_set1_epi32((1 << SignificandBits) - 1));
+	__m256i Result = _mm256_or_si256(Exponent, Significand);
+
+	__m256i const Inf = _mm256_cmpeq_epi32(_mm256_and_si256(f, _mm256_set1_epi32(0x7fffffff)), _mm256_set1_epi32(0x7f800000));
+	Result = _mm256_blendv_epi8(Result, ExponentMask, Inf);
+	Result = _mm256_or_si256(Result, _mm256_castps_si256(_mm256_cmp_ps(v, v, _CMP_UNORD_Q)));
+	Result = _mm256_andnot_si256(_mm256_castps_si256(_mm256_cmp_ps(v, _mm256_setzero_ps(), _CMP_EQ_OQ)), Result);
+	return _mm256_and_si256(Result, _mm256_set1_epi32((1 << (SignificandBits + 5)) - 1));
+}
+
+GLM_BATCH_AVX2_INLINE __m256 glm_vec8_from_packed_float_avx2(__m256i p, int SignificandBits)
+{
+	__m128i const Shift = _mm_cvtsi32_si128(23 - SignificandBits);
+	__m256i const ExponentMask = _mm256_set1_epi32(0x1f << SignificandBits);
+
+	__m256i const Exponent = _mm256_and_si256(_mm256_add_epi32(_mm256_sll_epi32(_mm256_and_si256(p, ExponentMask), Shift), _mm256_set1_epi32(0x38000000)), _mm256_set1_epi32(0x7f800000));
+	__m256i Result = _mm256_or_si256(Exponent, _mm256_sll_epi32(_mm256_and_si256(p, _mm256_set1_epi32((1 << SignificandBits) - 1)), Shift));
+
+	__m256i const Special = _mm256_or_si256(_mm256_cmpeq_epi32(p, ExponentMask), _mm256_cmpeq_epi32(p, _mm256_set1_epi32((1 << (SignificandBits + 5)) - 1)));
+	Result = _mm256_blendv_epi8(Result, _mm256_set1_epi32(static_cast<int>(0xbf800000)), Special);
+	Result = _mm256_andnot_si256(_mm256_cmpeq_epi32(p, _mm256_setzero_si256()), Result);
+	return _mm256_castsi256_ps(Result);
+}
+
+// Low 16 bits of each lane of a then b, in order.
+GLM_BATCH_AVX2_INLINE __m256i glm_batch_narrow16_avx2(__m256i a, __m256i b)
+{
+	__m256i const Packed = _mm256_packs_epi32(_mm256_srai_epi32(_mm256_slli_epi32(a, 16), 16), _mm256_srai_epi32(_mm256_slli_epi32(b, 16), 16));
+	return _mm256_permute4x64_epi64(Packed, _MM_SHUFFLE(3, 1, 2, 0));
+}
+
+GLM_BATCH_AVX2_INLINE __m256 glm_batch_load2_avx2(float const* Lo, float const* Hi)
+{
+	return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(Lo)), _mm_loadu_ps(Hi), 1);
+}
+
+GLM_BATCH_AVX2_INLINE void glm_batch_store2_avx2(__m256 v, float* Lo, float* Hi)
+{
+	_mm_storeu_ps(Lo, _mm256_castps256_ps128(v));
+	_mm_storeu_ps(Hi, _mm256_extractf128_ps(v, 1));
+}
+
+// glm_batch_transpose4_sse2 in each 128 bit lane.
+GLM_BATCH_AVX2_INLINE void glm_batch_transpose4_avx2(__m256 r[4])
+{
+	__m256 const t0 = _mm256_unpacklo_ps(r[0], r[1]);
+	__m256 const t1 = _mm256_unpacklo_ps(r[2], r[3]);
+	__m256 const t2 = _mm256_unpackhi_ps(r[0], r[1]);
+	__m256 const t3 = _mm256_unpackhi_ps(r[2], r[3]);
+	r[0] = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+	r[1] = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+	r[2] = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+	r[3] = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+}
+
+inline GLM_BATCH_AVX2 void glm_pack_half_batch_avx2(float const* In, unsigned short* Out, std::size_t Count)
+{
+	std::size_t i = 0;
+	for(; i + 16 <= Count; i += 16)
+	{
+		__m256i const a = glm_vec8_to_half_avx2(_mm256_loadu_ps(In + i));
+		__m256i const b = glm_vec8_to_half_avx2(_mm256_loadu_ps(In + i + 8));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(Out + i), glm_batch_narrow16_avx2(a, b));
+	}
+
+	glm_pack_half_batch_sse2(In + i, Out + i, Count - i);
+}
+
+inline GLM_BATCH_AVX2 void glm_unpack_half_batch_avx2(unsigned short const* In, float* Out, std::size_t Count)
+{
+	std::size_t i = 0;
+	for(; i + 8 <= Count; i += 8)
+		_mm256_storeu_ps(Out + i, glm_vec8_from_half_avx2(_mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const*>(In + i)))));
+
+	glm_unpack_half_batch_sse2(In + i, Out + i, Count - i);
+}
+
+inline GLM_BATCH_AVX2 void glm_pack_norm8_batch_avx2(float const* In, unsigned char* Out, std::size_t Count, bool Signed)
+{
+	__m256 const Min = _mm256_set1_ps(Signed ? -1.0f : 0.0f);
+	__m256 const Scale = _mm256_set1_ps(Signed ? 127.0f : 255.0f);
+	__m256i const Mask = _mm256_set1_epi32(0xff);
+
+	std::size_t i = 0;
+	for(; i + 16 <= Count; i += 16)
+	{
+		__m256i const a = _mm256_and_si256(glm_vec8_norm_avx2(_mm256_loadu_ps(In + i), Min, Scale), Mask);
+		__m256i const b = _mm256_and_si256(glm_vec8_norm_avx2(_mm256_loadu_ps(In + i + 8), Min, Scale), Mask);
+		__m256i const Words = _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), _MM_SHUFFLE(3, 1, 2, 0));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(Out + i), _mm_packus_epi16(_mm256_castsi256_si128(Words), _mm256_extracti128_si256(Words, 1)));
+	}
+
+	glm_pack_norm8_batch_sse2(In + i, Out + i, Count - i, Signed);
+}
+
+inline GLM_BATCH_AVX2 void glm_unpack_norm8_batch_avx2(unsigned char const* In, float* Out, std::size_t Count, bool Signed)
+{
+	__m256 const Scale = _mm256_set1_ps(Signed ? 0.00787401574803149606299212598425f : static_cast<float>(0.0039215686274509803921568627451));
+
+	std::size_t i = 0;
+	for(; i + 8 <= Count; i += 8)
+	{
+		__m128i const p = _mm_loadl_epi64(reinterpret_cast<__m128i const*>(In + i));
+		__m256 v = _mm256_mul_ps(_mm256_cvtepi32_ps(Signed ? _mm256_cvtepi8_epi32(p) : _mm256_cvtepu8_epi32(p)), Scale);
+		if(Signed)
+			v = _mm256_min_ps(_mm256_max_ps(v, _mm256_set1_ps(-1.0f)), _mm256_set1_ps(1.0f));
+		_mm256_storeu_ps(Out + i, v);
+	}
+
+	glm_unpack_norm8_batch_sse2(In + i, Out + i, Count - i, Signed);
+}
+
+inline GLM_BATCH_AVX2 void glm_pack_norm16_batch_avx2(float const* In, unsigned short* Out, std::size_t Count, bool Signed)
+{
+	__m256 const Min = _mm256_set1_ps(Signed ? -1.0f : 0.0f);
+	__m256 const Scale = _mm256_set1_ps(Signed ? 32767.0f : 65535.0f);
+
+	std::size_t i = 0;
+	for(; i + 16 <= Count; i += 16)
+	{
+		__m256i const a = glm_vec8_norm_avx2(_mm256_loadu_ps(In + i), Min, Scale);
+		__m256i const b = glm_vec8_norm_avx2(_mm256_loadu_ps(In + i + 8), Min, Scale);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(Out + i), glm_batch_narrow16_avx2(a, b));
+	}
+
+	glm_pack_norm16_batch_sse2(In + i, Out + i, Count - i, Signed);
+}
+
+inline GLM_BATCH_AVX2 void glm_unpack_norm16_batch_avx2(unsigned short const* In, float* Out, std::size_t Count, bool Signed)
+{
+	__m256 const Scale = _mm256_set1_ps(Signed ? 3.0518509475997192297128208258309e-5f : 1.5259021896696421759365224689097e-5f);
+
+	std::size_t i = 0;
+	for(; i + 8 <= Count; i += 8)
+	{
+		__m128i const p = _mm_loadu_si128(reinterpret_cast<__m128i const*>(In + i));
+		__m256 v = _mm256_mul_ps(_mm256_cvtepi32_ps(Signed ? _mm256_cvtepi16_epi32(p) : _mm256_cvtepu16_epi32(p)), Scale);
+		if(Signed)
+			v = _mm256_min_ps(_mm256_max_ps(v, _mm256_set1_ps(-1.0f)), _mm256_set1_ps(1.0f));
+		_mm256_storeu_ps(Out + i, v);
+	}
+
+	glm_unpack_norm16_batch_sse2(In + i, Out + i, Count - i, Signed);
+}
+
+// Elements i..i+3 in the low lanes, i+4..i+7 in the high lanes, so the transposed rows come out in order.
+inline GLM_BATCH_AVX2 void glm_pack_norm3x10_1x2_batch_avx2(float const* In, unsigned int* Out, std::size_t Count, bool Signed)
+{
+	__m256 const Min = _mm256_set1_ps(Signed ? -1.0f : 0.0f);
+	__m256 const Scale = _mm256_set1_ps(Signed ? 511.0f : 1023.0f);
+	__m256 const ScaleW = _mm256_set1_ps(Signed ? 1.0f : 3.0f);
+	__m256i const Mask = _mm256_set1_epi32(0x3ff);
+
+	std::size_t i = 0;
+	for(; i + 8 <= Count; i += 8)
+	{
+		float const* v = In + i * 4;
+		__m256 r[4] = {glm_batch_load2_avx2(v, v + 16), glm_batch_load2_avx2(v + 4, v + 20), glm_batch_load2_avx2(v + 8, v + 24), glm_batch_load2_avx2(v + 12, v + 28)};
+		glm_batch_transpose4_avx2(r);
+
+		__m256i const x = _mm256_and_si256(glm_vec8_norm_avx2(r[0], Min, Scale), Mask);
+		__m256i const y = _mm256_and_si256(glm_vec8_norm_avx2(r[1], Min, Scale), Mask);
+		__m256i const z = _mm256_and_si256(glm_vec8_norm_avx2(r[2], Min, Scale), Mask);
+		__m256i const w = glm_vec8_norm_avx2(r[3], Min, ScaleW);
+		__m256i const Result = _mm256_or_si256(_mm256_or_si256(x, _mm256_slli_epi32(y, 10)), _mm256_or_si256(_mm256_slli_epi32(z, 20), _mm256_slli_epi32(w, 30)));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(Out + i), Result);
+	}
+
+	glm_pack_norm3x10_1x2_batch_sse2(In + i * 4, Out + i, Count - i, Signed);
+}
+
+inline GLM_BATCH_AVX2 void glm_unpack_norm3x10_1x2_batch_avx2(unsigned int const* In, float* Out, std::size_t Count, bool Signed)
+{
+	std::size_t i = 0;
+	for(; i + 8 <= Count; i += 8)
+	{
+		__m256i const p = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(In + i));
+		__m256 r[4];
+		if(Signed)
+		{
+			__m256 const Scale = _mm256_set1_ps(1.f / 511.f);
+			__m256 const Min = _mm256_set1_ps(-1.0f);
+			__m256 const Max = _mm256_set1_ps(1.0f);
+			r[0] = _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srai_epi32(_mm256_slli_epi32(p, 22), 22)), Scale), Min), Max);
+			r[1] = _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srai_epi32(_mm256_slli_epi32(p, 12), 22)), Scale), Min), Max);
+			r[2] = _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srai_epi32(_mm256_slli_epi32(p, 2), 22)), Scale), Min), Max);
+			r[3] = _mm256_min_ps(_mm256_max_ps(_mm256_cvtepi32_ps(_mm256_srai_epi32(p, 30)), Min), Max);
+		}
+		else
+		{
+			__m256 const Scale = _mm256_set1_ps(1.0f / 1023.f);
+			__m256i const Mask = _mm256_set1_epi32(0x3ff);
+			r[0] = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_and_si256(p, Mask)), Scale);
+			r[1] = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(p, 10), Mask)), Scale);
+			r[2] = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(p, 20), Mask)), Scale);
+			r[3] = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(p, 30)), _mm256_set1_ps(1.0f / 3.f));
+		}
+
+		glm_batch_transpose4_avx2(r);
+		float* v = Out + i * 4;
+		for(int k = 0; k < 4; ++k)
+			glm_batch_store2_avx2(r[k], v + k * 4, v + 16 + k * 4);
+	}
+
+	glm_unpack_norm3x10_1x2_batch_sse2(In + i, Out + i * 4, Count - i, Signed);
+}
+
+// glm_batch_deinterleave3_sse2 in each 128 bit lane.
+inline GLM_BATCH_AVX2 void glm_pack_f2x11_1x10_batch_avx2(float const* In, unsigned int* Out, std::size_t Count)
+{
+	std::size_t i = 0;
+	for(; i + 8 <= Count; i += 8)
+	{
+		float const* v = In + i * 3;
+		__m256 const a = glm_batch_load2_avx2(v, v + 12);
+		__m256 const b = glm_batch_load2_avx2(v + 4, v + 16);
+		__m256 const c = glm_batch_load2_avx2(v + 8, v + 20);
+		__m256 const x = _mm256_shuffle_ps(a, _mm256_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+		__m256 const y = _mm256_shuffle_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm256_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+		__m256 const z = _mm256_shuffle_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), c, _MM_SHUFFLE(3, 0, 2, 0));
+
+		__m256i const Result = _mm256_or_si256(_mm256_or_si256(
+			glm_vec8_to_packed_float_avx2(x, 6),
+			_mm256_slli_epi32(glm_vec8_to_packed_float_avx2(y, 6), 11)),
+			_mm256_slli_epi32(glm_vec8_to_packed_float_avx2(z, 5), 22));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(Out + i), Result);
+	}
+
+	glm_pack_f2x11_1x10_batch_sse2(In + i * 3, Out + i, Count - i);
+}
+
+inline GLM_BATCH_AVX2 void glm_unpack_f2x11_1x10_batch_avx2(unsigned int const* In, float* Out, std::size_t Count)
+{
+	std::size_t i = 0;
+	for(; i + 8 <= Count; i += 8)
+	{
+		__m256i const p = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(In + i));
+		__m256 const x = glm_vec8_from_packed_float_avx2(p, 6);
+		__m256 const y = glm_vec8_from_packed_float_avx2(_mm256_srli_epi32(p, 11), 6);
+		__m256 const z = glm_vec8_from_packed_float_avx2(_mm256_srli_epi32(p, 22), 5);
+
+		float* v = Out + i * 3;
+		glm_batch_store2_avx2(_mm256_shuffle_ps(_mm256_unpacklo_ps(x, y), _mm256_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 1, 0)), v, v + 12);
+		glm_batch_store2_avx2(_mm256_shuffle_ps(_mm256_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), _mm256_unpackhi_ps(x, y), _MM_SHUFFLE(1, 0, 2, 0)), v + 4, v + 16);
+		glm_batch_store2_avx2(_mm256_shuffle_ps(_mm256_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm256_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)), v + 8, v + 20);
+	}
+
+	glm_unpack_f2x11_1x10_batch_sse2(In + i, Out + i * 3, Count - i);
+}
+
+#endif//GLM_BATCH_X86
@@ -0,0 +1,465 @@
+/// @ref simd
+/// @file glm/simd/quaternion_batch.h
+///
+/// Kernels for GLM_GTX_quaternion_batch: products, interpolation, conversion to 3x4 matrices and dual quaternion
+/// blending over arrays of float quaternions. Quaternions are 4 floats stored x, y, z, w; dual quaternions are the real
+/// quaternion followed by the dual one. No alignment is required.
+///
+/// Quaternions are transposed to structure of arrays form, four at a time with SSE2 and eight with AVX2, so each
+/// instruction works on one component of several quaternions. Dual quaternion blending gathers bones through indices
+/// and works one vertex at a time instead. The instruction set is picked at runtime, see matrix_batch.h.
+
+#pragma once
+
+#include "matrix_batch.h"
+
+#if GLM_BATCH_X86
+
+namespace glm{
+namespace detail
+{
+	// r = a * b, each argument holds the x, y, z and w components of several quaternions.
+	template<typename V>
+	GLM_FUNC_QUALIFIER void glm_soa_quat_mul(V const a[4], V const b[4], V r[4])
+	{
+		r[0] = a[3] * b[0] + a[0] * b[3] + a[1] * b[2] - a[2] * b[1];
+		r[1] = a[3] * b[1] + a[1] * b[3] + a[2] * b[0] - a[0] * b[2];
+		r[2] = a[3] * b[2] + a[2] * b[3] + a[0] * b[1] - a[1] * b[0];
+		r[3] = a[3] * b[3] - a[0] * b[0] - a[1] * b[1] - a[2] * b[2];
+	}
+
+	// Rows of the rotation matrix of the unit quaternion q with the translation t in the fourth column,
+	// r[0..3] being the first row. That is the layout mat3x4_cast uses for dual quaternions.
+	template<typename V>
+	GLM_FUNC_QUALIFIER void glm_soa_quat_to_mat3x4(V const q[4], V const t[3], V const& one, V r[12])
+	{
+		V const x2 = q[0] + q[0];
+		V const y2 = q[1] + q[1];
+		V const z2 = q[2] + q[2];
+		V const xx = q[0] * x2;
+		V const yy = q[1] * y2;
+		V const zz = q[2] * z2;
+		V const xy = q[0] * y2;
+		V const xz = q[0] * z2;
+		V const yz = q[1] * z2;
+		V const wx = q[3] * x2;
+		V const wy = q[3] * y2;
+		V const wz = q[3] * z2;
+
+		r[0] = one - (yy + zz);
+		r[1] = xy - wz;
+		r[2] = xz + wy;
+		r[3] = t[0];
+		r[4] = xy + wz;
+		r[5] = one - (xx + zz);
+		r[6] = yz - wx;
+		r[7] = t[1];
+		r[8] = xz - wy;
+		r[9] = yz + wx;
+		r[10] = one - (xx + yy);
+		r[11] = t[2];
+	}
+
+	// acos on [0, 1] is sqrt(1 - x) times this polynomial, within 2e-8 (Abramowitz and Stegun 4.4.46).
+	GLM_FUNC_QUALIFIER float const* glm_batch_acos_coefficients()
+	{
+		static float const Coef[8] = {1.5707963050f, -0.2145988016f, 0.0889789874f, -0.0501743046f, 0.0308918810f, -0.0170881256f, 0.0066700901f, -0.0012624911f};
+		return Coef;
+	}
+
+	// Taylor series of sin(x) / x in x^2, enough for 6e-8 on [0, pi / 2], the only range slerp needs.
+	GLM_FUNC_QUALIFIER float const* glm_batch_sin_coefficients()
+	{
+		static float const Coef[6] = {1.0f, -1.0f / 6.0f, 1.0f / 120.0f, -1.0f / 5040.0f, 1.0f / 362880.0f, -1.0f / 39916800.0f};
+		return Coef;
+	}
+}//namespace detail
+}//namespace glm
+
+///////////////////////////////////////////////////////////////////////////////////
+// SSE2, four quaternions per register.
+
+// Loads Count quaternions (at most four, Stride floats apart) and transposes them to x, y, z, w registers.
+// Missing quaternions are identities so they never produce NaNs.
+GLM_FUNC_QUALIFIER void glm_quat_load4_sse2(float const* Q, std::size_t Stride, std::size_t Count, glm_vec4 r[4])
+{
+	if(Count >= 4)
+	{
+		r[0] = _mm_loadu_ps(Q);
+		r[1] = _mm_loadu_ps(Q + Stride);
+		r[2] = _mm_loadu_ps(Q + Stride * 2);
+		r[3] = _mm_loadu_ps(Q + Stride * 3);
+	}
+	else for(std::size_t k = 0; k < 4; ++k)
+		r[k] = k < Count ? _mm_loadu_ps(Q + k * Stride) : _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f);
+	_MM_TRANSPOSE4_PS(r[0], r[1], r[2], r[3]);
+}
+
+GLM_FUNC_QUALIFIER void glm_quat_store4_sse2(glm_vec4 const q[4], float* Out, std::size_t Stride, std::size_t Count)
+{
+	glm_vec4 r0 = q[0], r1 = q[1], r2 = q[2], r3 = q[3];
+	_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+	if(Count >= 4)
+	{
+		_mm_storeu_ps(Out, r0);
+		_mm_storeu_ps(Out + Stride, r1);
+		_mm_storeu_ps(Out + Stride * 2, r2);
+		_mm_storeu_ps(Out + Stride * 3, r3);
+		return;
+	}
+	glm_vec4 const r[4] = {r0, r1, r2, r3};
+	for(std::size_t k = 0; k < Count; ++k)
+		_mm_storeu_ps(Out + k * Stride, r[k]);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_quat_load_factor4_sse2(float const* A, std::size_t StrideA, std::size_t Count)
+{
+	if(StrideA == 0)
+		return _mm_set1_ps(*A);
+	if(Count >= 4)
+		return StrideA == 1 ? _mm_loadu_ps(A) : _mm_setr_ps(A[0], A[StrideA], A[StrideA * 2], A[StrideA * 3]);
+	float f[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+	for(std::size_t k = 0; k < Count && k < 4; ++k)
+		f[k] = A[k * StrideA];
+	return _mm_loadu_ps(f);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_quat_dot4_sse2(glm_vec4 const a[4], glm_vec4 const b[4])
+{
+	return _mm_add_ps(_mm_add_ps(_mm_mul_ps(a[0], b[0]), _mm_mul_ps(a[1], b[1])), _mm_add_ps(_mm_mul_ps(a[2], b[2]), _mm_mul_ps(a[3], b[3])));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_quat_poly_sse2(glm_vec4 x, float const* Coef, int Degree)
+{
+	glm_vec4 r = _mm_set1_ps(Coef[Degree]);
+	for(int k = Degree - 1; k >= 0; --k)
+		r = _mm_add_ps(_mm_mul_ps(r, x), _mm_set1_ps(Coef[k]));
+	return r;
+}
+
+// sin(x) for x in [0, pi / 2]
+GLM_FUNC_QUALIFIER glm_vec4 glm_quat_sin_sse2(glm_vec4 x)
+{
+	return _mm_mul_ps(x, glm_quat_poly_sse2(_mm_mul_ps(x, x), glm::detail::glm_batch_sin_coefficients(), 5));
+}
+
+// Flips b to the hemisphere of a, so the interpolation takes the short way around. Returns |dot(a, b)|.
+GLM_FUNC_QUALIFIER glm_vec4 glm_quat_shortest4_sse2(glm_vec4 const a[4], glm_vec4 b[4])
+{
+	glm_vec4 const SignBit = _mm_set1_ps(-0.0f);
+	glm_vec4 const Cos = glm_quat_dot4_sse2(a, b);
+	glm_vec4 const Sign = _mm_and_ps(Cos, SignBit);
+	for(int c = 0; c < 4; ++c)
+		b[c] = _mm_xor_ps(b[c], Sign);
+	return _mm_xor_ps(Cos, Sign);
+}
+
+// Out[i] = A[i] * B[i]
+GLM_FUNC_QUALIFIER void glm_quat_mul_batch_sse2(float const* A, float const* B, float* Out, std::size_t Count)
+{
+	for(std::size_t i = 0; i < Count; i += 4, A += 16, B += 16, Out += 16)
+	{
+		glm_vec4 a[4], b[4], r[4];
+		glm_quat_load4_sse2(A, 4, Count - i, a);
+		glm_quat_load4_sse2(B, 4, Count - i, b);
+		glm::detail::glm_soa_quat_mul(a, b, r);
+		glm_quat_store4_sse2(r, Out, 4, Count - i);
+	}
+}
+
+// Out[i] = normalize(lerp(A[i], +-B[i], T[i * StrideT])), with the sign of B picked for the shortest path.
+GLM_FUNC_QUALIFIER void glm_quat_nlerp_batch_sse2(float const* A, float const* B, float const* T, std::size_t StrideT, float* Out, std::size_t Count)
+{
+	glm_vec4 const One = _mm_set1_ps(1.0f);
+
+	for(std::size_t i = 0; i < Count; i += 4, A += 16, B += 16, T += StrideT * 4, Out += 16)
+	{
+		glm_vec4 a[4], b[4], r[4];
+		glm_quat_load4_sse2(A, 4, Count - i, a);
+		glm_quat_load4_sse2(B, 4, Count - i, b);
+		glm_vec4 const t = glm_quat_load_factor4_sse2(T, StrideT, Count - i);
+
+		glm_quat_shortest4_sse2(a, b);
+		for(int c = 0; c < 4; ++c)
+			r[c] = _mm_add_ps(a[c], _mm_mul_ps(t, _mm_sub_ps(b[c], a[c])));
+
+		glm_vec4 const InvLength = _mm_div_ps(One, _mm_sqrt_ps(glm_quat_dot4_sse2(r, r)));
+		for(int c = 0; c < 4; ++c)
+			r[c] = _mm_mul_ps(r[c], InvLength);
+		glm_quat_store4_sse2(r, Out, 4, Count - i);
+	}
+}
+
+// Out[i] = slerp(A[i], B[i], T[i * StrideT]), with the same shortest path and near parallel fallback as glm::slerp.
+GLM_FUNC_QUALIFIER void glm_quat_slerp_batch_sse2(float const* A, float const* B, float const* T, std::size_t StrideT, float* Out, std::size_t Count)
+{
+	glm_vec4 const One = _mm_set1_ps(1.0f);
+	glm_vec4 const Threshold = _mm_set1_ps(1.0f - std::numeric_limits<float>::epsilon());
+
+	for(std::size_t i = 0; i < Count; i += 4, A += 16, B += 16, T += StrideT * 4, Out += 16)
+	{
+		glm_vec4 a[4], b[4], r[4];
+		glm_quat_load4_sse2(A, 4, Count - i, a);
+		glm_quat_load4_sse2(B, 4, Count - i, b);
+		glm_vec4 const t = glm_quat_load_factor4_sse2(T, StrideT, Count - i);
+
+		glm_vec4 const Cos = _mm_min_ps(glm_quat_shortest4_sse2(a, b), One);
+		glm_vec4 const Angle = _mm_mul_ps(_mm_sqrt_ps(_mm_sub_ps(One, Cos)), glm_quat_poly_sse2(Cos, glm::detail::glm_batch_acos_coefficients(), 7));
+		glm_vec4 const InvSin = _mm_div_ps(One, glm_quat_sin_sse2(Angle));
+		glm_vec4 const Linear = _mm_cmpgt_ps(Cos, Threshold);
+
+		glm_vec4 const s0 = _mm_mul_ps(glm_quat_sin_sse2(_mm_mul_ps(_mm_sub_ps(One, t), Angle)), InvSin);
+		glm_vec4 const s1 = _mm_mul_ps(glm_quat_sin_sse2(_mm_mul_ps(t, Angle)), InvSin);
+		glm_vec4 const k0 = _mm_or_ps(_mm_and_ps(Linear, _mm_sub_ps(One, t)), _mm_andnot_ps(Linear, s0));
+		glm_vec4 const k1 = _mm_or_ps(_mm_and_ps(Linear, t), _mm_andnot_ps(Linear, s1));
+
+		for(int c = 0; c < 4; ++c)
+			r[c] = _mm_add_ps(_mm_mul_ps(a[c], k0), _mm_mul_ps(b[c], k1));
+		glm_quat_store4_sse2(r, Out, 4, Count - i);
+	}
+}
+
+// Out[i] = the 12 floats of the 3x4 affine transform rotating by In[i] and translating by Translation[i * StrideT].
+// Translation may be null.
+GLM_FUNC_QUALIFIER void glm_quat_to_mat3x4_batch_sse2(float const* In, float const* Translation, std::size_t StrideT, float* Out, std::size_t Count)
+{
+	glm_vec4 const One = _mm_set1_ps(1.0f);
+
+	for(std::size_t i = 0; i < Count; i += 4, In += 16, Out += 48)
+	{
+		glm_vec4 q[4], t[3], r[12];
+		glm_quat_load4_sse2(In, 4, Count - i, q);
+		for(int c = 0; c < 3; ++c)
+			t[c] = Translation ? glm_quat_load_factor4_sse2(Translation + (i * StrideT) + c, StrideT, Count - i) : _mm_setzero_ps();
+
+		glm::detail::glm_soa_quat_to_mat3x4(q, t, One, r);
+
+		for(int Row = 0; Row < 3; ++Row)
+			glm_quat_store4_sse2(r + Row * 4, Out + Row * 4, 12, Count - i);
+	}
+}
+
+// Out[i] = normalize(sum of Weights[i * Influences + k] * Bones[Indices[i * Influences + k]]), the dual quaternion linear blend
+// used for skinning. Every bone is flipped to the hemisphere of the first influence.
+// The bones are gathered through indices, so each vertex is blended in its own registers rather than transposed.
+GLM_FUNC_QUALIFIER void glm_dualquat_blend_batch_sse2(float const* Bones, unsigned int const* Indices, float const* Weights, std::size_t Influences, float* Out, std::size_t Count)
+{
+	glm_vec4 const SignBit = _mm_set1_ps(-0.0f);
+
+	for(std::size_t i = 0; i < Count; ++i, Indices += Influences, Weights += Influences, Out += 8)
+	{
+		glm_vec4 const First = _mm_loadu_ps(Bones + 8 * Indices[0]);
+		glm_vec4 Real = _mm_mul_ps(First, _mm_set1_ps(Weights[0]));
+		glm_vec4 Dual = _mm_mul_ps(_mm_loadu_ps(Bones + 8 * Indices[0] + 4), _mm_set1_ps(Weights[0]));
+
+		for(std::size_t k = 1; k < Influences; ++k)
+		{
+			glm_vec4 const r = _mm_loadu_ps(Bones + 8 * Indices[k]);
+			glm_vec4 const d = _mm_loadu_ps(Bones + 8 * Indices[k] + 4);
+			glm_vec4 const w = _mm_xor_ps(_mm_set1_ps(Weights[k]), _mm_and_ps(glm_vec4_dot(First, r), SignBit));
+			Real = _mm_add_ps(Real, _mm_mul_ps(w, r));
+			Dual = _mm_add_ps(Dual, _mm_mul_ps(w, d));
+		}
+
+		glm_vec4 const InvLength = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(glm_vec4_dot(Real, Real)));
+		_mm_storeu_ps(Out, _mm_mul_ps(Real, InvLength));
+		_mm_storeu_ps(Out + 4, _mm_mul_ps(Dual, InvLength));
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+// AVX2, eight quaternions per register.
+// Quaternions are loaded two per register and transposed inside each 128 bit lane, so the low lane holds
+// quaternions 0, 2, 4, 6 and the high lane 1, 3, 5, 7. Transposing back restores the order.
+
+GLM_BATCH_AVX2_INLINE void glm_batch_transpose4_lanes_avx2(__m256 r[4])
+{
+	__m256 const t0 = _mm256_unpacklo_ps(r[0], r[1]);
+	__m256 const t1 = _mm256_unpacklo_ps(r[2], r[3]);
+	__m256 const t2 = _mm256_unpackhi_ps(r[0], r[1]);
+	__m256 const t3 = _mm256_unpackhi_ps(r[2], r[3]);
+	r[0] = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+	r[1] = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+	r[2] = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+	r[3] = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+}
+
+GLM_BATCH_AVX2_INLINE void glm_quat_load8_avx2(float const* Q, __m256 r[4])
+{
+	for(int k = 0; k < 4; ++k)
+		r[k] = _mm256_loadu_ps(Q + k * 8);
+	glm_batch_transpose4_lanes_avx2(r);
+}
+
+GLM_BATCH_AVX2_INLINE void glm_quat_store8_avx2(__m256 const q[4], float* Out)
+{
+	__m256 r[4] = {q[0], q[1], q[2], q[3]};
+	glm_batch_transpose4_lanes_avx2(r);
+	for(int k = 0; k < 4; ++k)
+		_mm256_storeu_ps(Out + k * 8, r[k]);
+}
+
+// Eight factors, in the lane order of glm_quat_load8_avx2.
+GLM_BATCH_AVX2_INLINE __m256 glm_quat_load_factor8_avx2(float const* A, std::size_t StrideA)
+{
+	if(StrideA == 0)
+		return _mm256_set1_ps(*A);
+	if(StrideA == 1)
+		return _mm256_permutevar8x32_ps(_mm256_loadu_ps(A), _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7));
+	return _mm256_setr_ps(A[0], A[2 * StrideA], A[4 * StrideA], A[6 * StrideA], A[StrideA], A[3 * StrideA], A[5 * StrideA], A[7 * StrideA]);
+}
+
+GLM_BATCH_AVX2_INLINE __m256 glm_quat_dot8_avx2(__m256 const a[4], __m256 const b[4])
+{
+	__m256 r = _mm256_mul_ps(a[0], b[0]);
+	r = _mm256_fmadd_ps(a[1], b[1], r);
+	r = _mm256_fmadd_ps(a[2], b[2], r);
+	return _mm256_fmadd_ps(a[3], b[3], r);
+}
+
+GLM_BATCH_AVX2_INLINE __m256 glm_quat_poly_avx2(__m256 x, float const* Coef, int Degree)
+{
+	__m256 r = _mm256_set1_ps(Coef[Degree]);
+	for(int k = Degree - 1; k >= 0; --k)
+		r = _mm256_fmadd_ps(r, x, _mm256_set1_ps(Coef[k]));
+	return r;
+}
+
+GLM_BATCH_AVX2_INLINE __m256 glm_quat_sin_avx2(__m256 x)
+{
+	return _mm256_mul_ps(x, glm_quat_poly_avx2(_mm256_mul_ps(x, x), glm::detail::glm_batch_sin_coefficients(), 5));
+}
+
+GLM_BATCH_AVX2_INLINE __m256 glm_quat_shortest8_avx2(__m256 const a[4], __m256 b[4])
+{
+	__m256 const Cos = glm_quat_dot8_avx2(a, b);
+	__m256 const Sign = _mm256_and_ps(Cos, _mm256_set1_ps(-0.0f));
+	for(int c = 0; c < 4; ++c)
+		b[c] = _mm256_xor_ps(b[c], Sign);
+	return _mm256_xor_ps(Cos, Sign);
+}
+
+inline GLM_BATCH_AVX2 void glm_quat_mul_batch_avx2(float const* A, float const* B, float* Out, std::size_t Count)
+{
+	std::size_t i = 0;
+	for(; i + 8 <= Count; i += 8, A += 32, B += 32, Out += 32)
+	{
+		__m256 a[4], b[4], r[4];
+		glm_quat_load8_avx2(A, a);
+		glm_quat_load8_avx2(B, b);
+		glm::detail::glm_soa_quat_mul(a, b, r);
+		glm_quat_store8_avx2(r, Out);
+	}
+
+	glm_quat_mul_batch_sse2(A, B, Out, Count - i);
+}
+
+inline GLM_BATCH_AVX2 void glm_quat_nlerp_batch_avx2(float const* A, float const* B, float const* T, std::size_t StrideT, float* Out, std::size_t Count)
+{
+	std::size_t i = 0;
+	for(; i + 8 <= Count; i += 8, A += 32, B += 32, T += StrideT * 8, Out += 32)
+	{
+		__m256 a[4], b[4], r[4];
+		glm_quat_load8_avx2(A, a);
+		glm_quat_load8_avx2(B, b);
+		__m256 const t = glm_quat_load_factor8_avx2(T, StrideT);
+
+		glm_quat_shortest8_avx2(a, b);
+		for(int c = 0; c < 4; ++c)
+			r[c] = _mm256_fmadd_ps(t, _mm256_sub_ps(b[c], a[c]), a[c]);
+
+		__m256 const InvLength = _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(glm_quat_dot8_avx2(r, r)));
+		for(int c = 0; c < 4; ++c)
+			r[c] = _mm256_mul_ps(r[c], InvLength);
+		glm_quat_store8_avx2(r, Out);
+	}
+
+	glm_quat_nlerp_batch_sse2(A, B, T, StrideT, Out, Count - i);
+}
+
+inline GLM_BATCH_AVX2 void glm_quat_slerp_batch_avx2(float const* A, float const* B, float const* T, std::size_t StrideT, float* Out, std::size_t Count)
+{
+	__m256 const One = _mm256_set1_ps(1.0f);
+	__m256 const Threshold = _mm256_set1_ps(1.0f - std::numeric_limits<float>::epsilon());
+
+	std::size_t i = 0;
+	for(; i + 8 <= Count; i += 8, A += 32, B += 32, T += StrideT * 8, Out += 32)
+	{
+		__m256 a[4], b[4], r[4];
+		glm_quat_load8_avx2(A, a);
+		glm_quat_load8_avx2(B, b);
+		__m256 const t = glm_quat_load_factor8_avx2(T, StrideT);
+
+		__m256 const Cos = _mm256_min_ps(glm_quat_shortest8_avx2(a, b), One);
+		__m256 const Angle = _mm256_mul_ps(_mm256_sqrt_ps(_mm256_sub_ps(One, Cos)), glm_quat_poly_avx2(Cos, glm::detail::glm_batch_acos_coefficients(), 7));
+		__m256 const InvSin = _mm256_div_ps(One, glm_quat_sin_avx2(Angle));
+		__m256 const Linear = _mm256_cmp_ps(Cos, Threshold, _CMP_GT_OQ);
+
+		__m256 const s0 = _mm256_mul_ps(glm_quat_sin_avx2(_mm256_mul_ps(_mm256_sub_ps(One, t), Angle)), InvSin);
+		__m256 const s1 = _mm256_mul_ps(glm_quat_sin_avx2(_mm256_mul_ps(t, Angle)), InvSin);
+		__m256 const k0 = _mm256_blendv_ps(s0, _mm256_sub_ps(One, t), Linear);
+		__m256 const k1 = _mm256_blendv_ps(s1, t, Linear);
+
+		for(int c = 0; c < 4; ++c)
+			r[c] = _mm256_fmadd_ps(a[c], k0, _mm256_mul_ps(b[c], k1));
+		glm_quat_store8_avx2(r, Out);
+	}
+
+	glm_quat_slerp_batch_sse2(A, B, T, StrideT, Out, Count - i);
+}
+
+inline GLM_BATCH_AVX2 void glm_quat_to_mat3x4_batch_avx2(float const* In, float const* Translation, std::size_t StrideT, float* Out, std::size_t Count)
+{
+	__m256 const One = _mm256_set1_ps(1.0f);
+
+	std::size_t i = 0;
+	for(; i + 8 <= Count; i += 8, In += 32, Out += 96)
+	{
+		__m256 q[4], t[3], r[12];
+		glm_quat_load8_avx2(In, q);
+		for(int c = 0; c < 3; ++c)
+			t[c] = Translation ? glm_quat_load_factor8_avx2(Translation + i * StrideT + c, StrideT) : _mm256_setzero_ps();
+
+		glm::detail::glm_soa_quat_to_mat3x4(q, t, One, r);
+
+		// After the transposes, register k of each row holds that row for quaternions 2k (low lane) and 2k + 1 (high lane).
+		glm_batch_transpose4_lanes_avx2(r);
+		glm_batch_transpose4_lanes_avx2(r + 4);
+		glm_batch_transpose4_lanes_avx2(r + 8);
+		for(int k = 0; k < 4; ++k)
+		{
+			_mm256_storeu_ps(Out + k * 24, _mm256_permute2f128_ps(r[k], r[k + 4], 0x20));
+			_mm256_storeu_ps(Out + k * 24 + 8, _mm256_permute2f128_ps(r[k + 8], r[k], 0x30));
+			_mm256_storeu_ps(Out + k * 24 + 16, _mm256_permute2f128_ps(r[k + 4], r[k + 8], 0x31));
+		}
+	}
+
+	glm_quat_to_mat3x4_batch_sse2(In, Translation ? Translation + i * StrideT : Translation, StrideT, Out, Count - i);
+}
+
+// One vertex per iteration with the real and dual parts of a bone in the two lanes of a register.
+inline GLM_BATCH_AVX2 void glm_dualquat_blend_batch_avx2(float const* Bones, unsigned int const* Indices, float const* Weights, std::size_t Influences, float* Out, std::size_t Count)
+{
+	__m256 const SignBit = _mm256_set1_ps(-0.0f);
+
+	for(std::size_t i = 0; i < Count; ++i, Indices += Influences, Weights += Influences, Out += 8)
+	{
+		__m256 const First = _mm256_loadu_ps(Bones + 8 * Indices[0]);
+		__m128 const FirstReal = _mm256_castps256_ps128(First);
+		__m256 Sum = _mm256_mul_ps(First, _mm256_set1_ps(Weights[0]));
+
+		for(std::size_t k = 1; k < Influences; ++k)
+		{
+			__m256 const d = _mm256_loadu_ps(Bones + 8 * Indices[k]);
+			__m256 const Dot = _mm256_broadcastss_ps(_mm_dp_ps(FirstReal, _mm256_castps256_ps128(d), 0xF1));
+			__m256 const w = _mm256_xor_ps(_mm256_set1_ps(Weights[k]), _mm256_and_ps(Dot, SignBit));
+			Sum = _mm256_fmadd_ps(w, d, Sum);
+		}
+
+		__m128 const Real = _mm256_castps256_ps128(Sum);
+		__m256 const Length = _mm256_sqrt_ps(_mm256_broadcastss_ps(_mm_dp_ps(Real, Real, 0xF1)));
+		_mm256_storeu_ps(Out, _mm256_div_ps(Sum, Length));
+	}
+}
+
+#endif//GLM_BATCH_X86
@@ -0,0 +1,317 @@
+/// @ref simd
+/// @file glm/simd/soa_batch.h
+///
+/// Kernels for GLM_GTX_soa. Vectors and matrices are stored one component per stream: component c of element i
+/// is at Data[c * Stride + i]. The streams are aligned to 64 bytes and padded, so apart from the bounds every
+/// kernel takes a Count that is a multiple of 16 and works on whole registers without a tail.
+/// The instruction set is picked at runtime, see matrix_batch.h.
+
+#pragma once
+
+#include "matrix_batch.h"
+
+#if GLM_BATCH_X86
+
+namespace glm{
+namespace detail
+{
+	// r = m * (v, 1) when I is 3, m * v when I is 4, keeping the first O components.
+	// m holds the 16 components of a column major matrix, broadcast or one matrix per lane.
+	template<typename V, length_t I, length_t O>
+	GLM_FUNC_QUALIFIER void glm_soa_transform(V const m[16], V const v[I], V r[O])
+	{
+		for(length_t j = 0; j < O; ++j)
+		{
+			V const s = m[j] * v[0] + m[4 + j] * v[1] + m[8 + j] * v[2];
+			r[j] = I == 4 ? s + m[12 + j] * v[3] : s + m[12 + j];
+		}
+	}
+
+	// r = a * b, each argument holds the 16 components of several column major matrices.
+	template<typename V>
+	GLM_FUNC_QUALIFIER void glm_soa_mat4_mul(V const a[16], V const b[16], V r[16])
+	{
+		for(length_t c = 0; c < 4; ++c)
+		for(length_t j = 0; j < 4; ++j)
+			r[c * 4 + j] = a[j] * b[c * 4] + a[4 + j] * b[c * 4 + 1] + a[8 + j] * b[c * 4 + 2] + a[12 + j] * b[c * 4 + 3];
+	}
+
+	// Returns through d, __m256 return values would change the ABI of the non AVX instantiations.
+	template<typename V, length_t L>
+	GLM_FUNC_QUALIFIER void glm_soa_dot(V const a[L], V const b[L], V& d)
+	{
+		d = a[0] * b[0];
+		for(length_t c = 1; c < L; ++c)
+			d = d + a[c] * b[c];
+	}
+
+	template<typename V>
+	GLM_FUNC_QUALIFIER void glm_soa_cross(V const a[3], V const b[3], V r[3])
+	{
+		r[0] = a[1] * b[2] - a[2] * b[1];
+		r[1] = a[2] * b[0] - a[0] * b[2];
+		r[2] = a[0] * b[1] - a[1] * b[0];
+	}
+}//namespace detail
+}//namespace glm
+
+template<glm::length_t L>
+GLM_FUNC_QUALIFIER void glm_soa_load_sse2(float const* In, std::size_t Stride, glm_vec4 v[L])
+{
+	for(glm::length_t c = 0; c < L; ++c)
+		v[c] = _mm_load_ps(In + c * Stride);
+}
+
+template<glm::length_t L>
+GLM_FUNC_QUALIFIER void glm_soa_store_sse2(glm_vec4 const v[L], float* Out, std::size_t Stride)
+{
+	for(glm::length_t c = 0; c < L; ++c)
+		_mm_store_ps(Out + c * Stride, v[c]);
+}
+
+template<glm::length_t I, glm::length_t O>
+GLM_FUNC_QUALIFIER void glm_soa_transform_batch_sse2(float const* M, float const* In, std::size_t InStride, float* Out, std::size_t OutStride, std::size_t Count)
+{
+	glm_vec4 m[16];
+	for(int k = 0; k < 16; ++k)
+		m[k] = _mm_set1_ps(M[k]);
+
+	for(std::size_t i = 0; i < Count; i += 4)
+	{
+		glm_vec4 v[I], r[O];
+		glm_soa_load_sse2<I>(In + i, InStride, v);
+		glm::detail::glm_soa_transform<glm_vec4, I, O>(m, v, r);
+		glm_soa_store_sse2<O>(r, Out + i, OutStride);
+	}
+}
+
+template<glm::length_t I, glm::length_t O>
+GLM_FUNC_QUALIFIER void glm_soa_mat4_transform_batch_sse2(float const* M, std::size_t MStride, float const* In, std::size_t InStride, float* Out, std::size_t OutStride, std::size_t Count)
+{
+	for(std::size_t i = 0; i < Count; i += 4)
+	{
+		glm_vec4 m[16], v[I], r[O];
+		glm_soa_load_sse2<16>(M + i, MStride, m);
+		glm_soa_load_sse2<I>(In + i, InStride, v);
+		glm::detail::glm_soa_transform<glm_vec4, I, O>(m, v, r);
+		glm_soa_store_sse2<O>(r, Out + i, OutStride);
+	}
+}
+
+GLM_FUNC_QUALIFIER void glm_soa_mat4_mul_batch_sse2(float const* A, float const* B, std::size_t BStride, float* Out, std::size_t OutStride, std::size_t Count)
+{
+	glm_vec4 a[16];
+	for(int k = 0; k < 16; ++k)
+		a[k] = _mm_set1_ps(A[k]);
+
+	for(std::size_t i = 0; i < Count; i += 4)
+	{
+		glm_vec4 b[16], r[16];
+		glm_soa_load_sse2<16>(B + i, BStride, b);
+		glm::detail::glm_soa_mat4_mul(a, b, r);
+		glm_soa_store_sse2<16>(r, Out + i, OutStride);
+	}
+}
+
+template<glm::length_t L>
+GLM_FUNC_QUALIFIER void glm_soa_dot_batch_sse2(float const* A, std::size_t AStride, float const* B, std::size_t BStride, float* Out, std::size_t Count)
+{
+	for(std::size_t i = 0; i < Count; i += 4)
+	{
+		glm_vec4 a[L], b[L];
+		glm_soa_load_sse2<L>(A + i, AStride, a);
+		glm_soa_load_sse2<L>(B + i, BStride, b);
+		glm_vec4 d;
+		glm::detail::glm_soa_dot<glm_vec4, L>(a, b, d);
+		_mm_store_ps(Out + i, d);
+	}
+}
+
+GLM_FUNC_QUALIFIER void glm_soa_cross_batch_sse2(float const* A, std::size_t AStride, float const* B, std::size_t BStride, float* Out, std::size_t OutStride, std::size_t Count)
+{
+	for(std::size_t i = 0; i < Count; i += 4)
+	{
+		glm_vec4 a[3], b[3], r[3];
+		glm_soa_load_sse2<3>(A + i, AStride, a);
+		glm_soa_load_sse2<3>(B + i, BStride, b);
+		glm::detail::glm_soa_cross(a, b, r);
+		glm_soa_store_sse2<3>(r, Out + i, OutStride);
+	}
+}
+
+// Divides by the length like normalize, zero vectors give NaNs.
+template<glm::length_t L>
+GLM_FUNC_QUALIFIER void glm_soa_normalize_batch_sse2(float const* In, std::size_t InStride, float* Out, std::size_t OutStride, std::size_t Count)
+{
+	for(std::size_t i = 0; i < Count; i += 4)
+	{
+		glm_vec4 v[L];
+		glm_soa_load_sse2<L>(In + i, InStride, v);
+		glm_vec4 d;
+		glm::detail::glm_soa_dot<glm_vec4, L>(v, v, d);
+		glm_vec4 const Inv = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(d));
+		for(glm::length_t c = 0; c < L; ++c)
+			v[c] = _mm_mul_ps(v[c], Inv);
+		glm_soa_store_sse2<L>(v, Out + i, OutStride);
+	}
+}
+
+// Adds Stream[First, Count) to the running minimum and maximum, then reduces them to one value.
+GLM_FUNC_QUALIFIER void glm_soa_bounds_finish_sse2(float const* Stream, std::size_t First, std::size_t Count, glm_vec4 Low, glm_vec4 High, float& Min, float& Max)
+{
+	for(std::size_t i = First; i < Count; ++i)
+	{
+		glm_vec4 const v = _mm_set1_ps(Stream[i]);
+		Low = _mm_min_ps(Low, v);
+		High = _mm_max_ps(High, v);
+	}
+
+	Low = _mm_min_ps(Low, _mm_shuffle_ps(Low, Low, _MM_SHUFFLE(1, 0, 3, 2)));
+	High = _mm_max_ps(High, _mm_shuffle_ps(High, High, _MM_SHUFFLE(1, 0, 3, 2)));
+	Min = _mm_cvtss_f32(_mm_min_ss(Low, _mm_shuffle_ps(Low, Low, _MM_SHUFFLE(2, 3, 0, 1))));
+	Max = _mm_cvtss_f32(_mm_max_ss(High, _mm_shuffle_ps(High, High, _MM_SHUFFLE(2, 3, 0, 1))));
+}
+
+// Component-wise minimum and maximum of the first Count elements, Count > 0. The padding is skipped.
+template<glm::length_t L>
+GLM_FUNC_QUALIFIER void glm_soa_bounds_sse2(float const* In, std::size_t Stride, std::size_t Count, float Min[L], float Max[L])
+{
+	for(glm::length_t c = 0; c < L; ++c)
+	{
+		float const* Stream = In + c * Stride;
+		glm_vec4 Low = _mm_set1_ps(Stream[0]);
+		glm_vec4 High = Low;
+		std::size_t i = 0;
+		for(; i + 4 <= Count; i += 4)
+		{
+			glm_vec4 const v = _mm_load_ps(Stream + i);
+			Low = _mm_min_ps(Low, v);
+			High = _mm_max_ps(High, v);
+		}
+		glm_soa_bounds_finish_sse2(Stream, i, Count, Low, High, Min[c], Max[c]);
+	}
+}
+
+template<glm::length_t L>
+GLM_BATCH_AVX2_INLINE void glm_soa_load_avx2(float const* In, std::size_t Stride, __m256 v[L])
+{
+	for(glm::length_t c = 0; c < L; ++c)
+		v[c] = _mm256_load_ps(In + c * Stride);
+}
+
+template<glm::length_t L>
+GLM_BATCH_AVX2_INLINE void glm_soa_store_avx2(__m256 const v[L], float* Out, std::size_t Stride)
+{
+	for(glm::length_t c = 0; c < L; ++c)
+		_mm256_store_ps(Out + c * Stride, v[c]);
+}
+
+template<glm::length_t I, glm::length_t O>
+inline GLM_BATCH_AVX2 void glm_soa_transform_batch_avx2(float const* M, float const* In, std::size_t InStride, float* Out, std::size_t OutStride, std::size_t Count)
+{
+	__m256 m[16];
+	for(int k = 0; k < 16; ++k)
+		m[k] = _mm256_set1_ps(M[k]);
+
+	for(std::size_t i = 0; i < Count; i += 8)
+	{
+		__m256 v[I], r[O];
+		glm_soa_load_avx2<I>(In + i, InStride, v);
+		glm::detail::glm_soa_transform<__m256, I, O>(m, v, r);
+		glm_soa_store_avx2<O>(r, Out + i, OutStride);
+	}
+}
+
+template<glm::length_t I, glm::length_t O>
+inline GLM_BATCH_AVX2 void glm_soa_mat4_transform_batch_avx2(float const* M, std::size_t MStride, float const* In, std::size_t InStride, float* Out, std::size_t OutStride, std::size_t Count)
+{
+	for(std::size_t i = 0; i < Count; i += 8)
+	{
+		__m256 m[16], v[I], r[O];
+		glm_soa_load_avx2<16>(M + i, MStride, m);
+		glm_soa_load_avx2<I>(In + i, InStride, v);
+		glm::detail::glm_soa_transform<__m256, I, O>(m, v, r);
+		glm_soa_store_avx2<O>(r, Out + i, OutStride);
+	}
+}
+
+inline GLM_BATCH_AVX2 void glm_soa_mat4_mul_batch_avx2(float const* A, float const* B, std::size_t BStride, float* Out, std::size_t OutStride, std::size_t Count)
+{
+	__m256 a[16];
+	for(int k = 0; k < 16; ++k)
+		a[k] = _mm256_set1_ps(A[k]);
+
+	for(std::size_t i = 0; i < Count; i += 8)
+	{
+		__m256 b[16], r[16];
+		glm_soa_load_avx2<16>(B + i, BStride, b);
+		glm::detail::glm_soa_mat4_mul(a, b, r);
+		glm_soa_store_avx2<16>(r, Out + i, OutStride);
+	}
+}
+
+template<glm::length_t L>
+inline GLM_BATCH_AVX2 void glm_soa_dot_batch_avx2(float const* A, std::size_t AStride, float const* B, std::size_t BStride, float* Out, std::size_t Count)
+{
+	for(std::size_t i = 0; i < Count; i += 8)
+	{
+		__m256 a[L], b[L];
+		glm_soa_load_avx2<L>(A + i, AStride, a);
+		glm_soa_load_avx2<L>(B + i, BStride, b);
+		__m256 d;
+		glm::detail::glm_soa_dot<__m256, L>(a, b, d);
+		_mm256_store_ps(Out + i, d);
+	}
+}
+
+inline GLM_BATCH_AVX2 void glm_soa_cross_batch_avx2(float const* A, std::size_t AStride, float const* B, std::size_t BStride, float* Out, std::size_t OutStride, std::size_t Count)
+{
+	for(std::size_t i = 0; i < Count; i += 8)
+	{
+		__m256 a[3], b[3], r[3];
+		glm_soa_load_avx2<3>(A + i, AStride, a);
+		glm_soa_load_avx2<3>(B + i, BStride, b);
+		glm::detail::glm_soa_cross(a, b, r);
+		glm_soa_store_avx2<3>(r, Out + i, OutStride);
+	}
+}
+
+template<glm::length_t L>
+inline GLM_BATCH_AVX2 void glm_soa_normalize_batch_avx2(float const* In, std::size_t InStride, float* Out, std::size_t OutStride, std::size_t Count)
+{
+	for(std::size_t i = 0; i < Count; i += 8)
+	{
+		__m256 v[L];
+		glm_soa_load_avx2<L>(In + i, InStride, v);
+		__m256 d;
+		glm::detail::glm_soa_dot<__m256, L>(v, v, d);
+		__m256 const Inv = _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(d));
+		for(glm::length_t c = 0; c < L; ++c)
+			v[c] = _mm256_mul_ps(v[c], Inv);
+		glm_soa_store_avx2<L>(v, Out + i, OutStride);
+	}
+}
+
+template<glm::length_t L>
+inline GLM_BATCH_AVX2 void glm_soa_bounds_avx2(float const* In, std::size_t Stride, std::size_t Count, float Min[L], float Max[L])
+{
+	for(glm::length_t c = 0; c < L; ++c)
+	{
+		float const* Stream = In + c * Stride;
+		__m256 Low = _mm256_set1_ps(Stream[0]);
+		__m256 High = Low;
+		std::size_t i = 0;
+		for(; i + 8 <= Count; i += 8)
+		{
+			__m256 const v = _mm256_load_ps(Stream + i);
+			Low = _mm256_min_ps(Low, v);
+			High = _mm256_max_ps(High, v);
+		}
+
+		glm_soa_bounds_finish_sse2(Stream, i, Count,
+			_mm_min_ps(_mm256_castps256_ps128(Low), _mm256_extractf128_ps(Low, 1)),
+			_mm_max_ps(_mm256_castps256_ps128(High), _mm256_extractf128_ps(High, 1)), Min[c], Max[c]);
+	}
+}
+
+#endif//GLM_BATCH_X86
@@ -0,0 +1,228 @@
+/// @ref simd
+/// @file glm/simd/transcendental_batch.h
+///
+/// Kernels for GLM_GTX_fast_transcendental over float arrays. The SSE2 kernels run the four wide functions of
+/// trigonometric.h and exponential.h, the AVX2 kernels the same polynomials eight wide with FMA.
+/// The instruction set is picked at runtime, see matrix_batch.h.
+
+#pragma once
+
+#include "matrix_batch.h"
+#include "trigonometric.h"
+#include "exponential.h"
+#include <cstring>
+
+#if GLM_BATCH_X86
+
+// Up to four floats, the missing ones are ones so the tail never takes a special case path.
+GLM_FUNC_QUALIFIER glm_vec4 glm_batch_load_tail_sse2(float const* In, std::size_t Count)
+{
+	float Tail[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+	std::memcpy(Tail, In, Count * sizeof(float));
+	return _mm_loadu_ps(Tail);
+}
+
+GLM_FUNC_QUALIFIER void glm_batch_store_tail_sse2(glm_vec4 v, float* Out, std::size_t Count)
+{
+	float Tail[4];
+	_mm_storeu_ps(Tail, v);
+	std::memcpy(Out, Tail, Count * sizeof(float));
+}
+
+// Sin or Cos may be null.
+GLM_FUNC_QUALIFIER void glm_sincos_batch_sse2(float const* In, float* Sin, float* Cos, std::size_t Count)
+{
+	for(std::size_t i = 0; i < Count; i += 4)
+	{
+		std::size_t const n = Count - i < 4 ? Count - i : 4;
+		glm_vec4 c;
+		glm_vec4 const s = glm_vec4_sincos(n == 4 ? _mm_loadu_ps(In + i) : glm_batch_load_tail_sse2(In + i, n), &c);
+		if(n == 4)
+		{
+			if(Sin)
+				_mm_storeu_ps(Sin + i, s);
+			if(Cos)
+				_mm_storeu_ps(Cos + i, c);
+		}
+		else
+		{
+			if(Sin)
+				glm_batch_store_tail_sse2(s, Sin + i, n);
+			if(Cos)
+				glm_batch_store_tail_sse2(c, Cos + i, n);
+		}
+	}
+}
+
+GLM_FUNC_QUALIFIER void glm_exp_batch_sse2(float const* In, float* Out, std::size_t Count)
+{
+	std::size_t i = 0;
+	for(; i + 4 <= Count; i += 4)
+		_mm_storeu_ps(Out + i, glm_vec4_exp(_mm_loadu_ps(In + i)));
+	if(i < Count)
+		glm_batch_store_tail_sse2(glm_vec4_exp(glm_batch_load_tail_sse2(In + i, Count - i)), Out + i, Count - i);
+}
+
+GLM_FUNC_QUALIFIER void glm_log_batch_sse2(float const* In, float* Out, std::size_t Count)
+{
+	std::size_t i = 0;
+	for(; i + 4 <= Count; i += 4)
+		_mm_storeu_ps(Out + i, glm_vec4_log(_mm_loadu_ps(In + i)));
+	if(i < Count)
+		glm_batch_store_tail_sse2(glm_vec4_log(glm_batch_load_tail_sse2(In + i, Count - i)), Out + i, Count - i);
+}
+
+// Y is a single exponent when StrideY is 0, one per element when it's 1.
+GLM_FUNC_QUALIFIER void glm_pow_batch_sse2(float const* X, float const* Y, std::size_t StrideY, float* Out, std::size_t Count)
+{
+	glm_vec4 const Common = StrideY ? _mm_setzero_ps() : _mm_set1_ps(*Y);
+	std::size_t i = 0;
+	for(; i + 4 <= Count; i += 4)
+		_mm_storeu_ps(Out + i, glm_vec4_pow(_mm_loadu_ps(X + i), StrideY ? _mm_loadu_ps(Y + i) : Common));
+	if(i < Count)
+	{
+		glm_vec4 const y = StrideY ? glm_batch_load_tail_sse2(Y + i, Count - i) : Common;
+		glm_batch_store_tail_sse2(glm_vec4_pow(glm_batch_load_tail_sse2(X + i, Count - i), y), Out + i, Count - i);
+	}
+}
+
+GLM_BATCH_AVX2_INLINE __m256 glm_vec8_sincos_avx2(__m256 x, __m256* c)
+{
+	__m256i const q = _mm256_cvtps_epi32(_mm256_mul_ps(x, _mm256_set1_ps(0.636619772367581343f)));
+	__m256 const n = _mm256_cvtepi32_ps(q);
+
+	__m256 r = _mm256_fnmadd_ps(n, _mm256_set1_ps(1.5703125f), x);
+	r = _mm256_fnmadd_ps(n, _mm256_set1_ps(4.8351287841796875e-4f), r);
+	r = _mm256_fnmadd_ps(n, _mm256_set1_ps(3.1385570764541625977e-7f), r);
+	r = _mm256_fnmadd_ps(n, _mm256_set1_ps(6.0771006282767103812e-11f), r);
+	__m256 const r2 = _mm256_mul_ps(r, r);
+
+	__m256 s = _mm256_fmadd_ps(_mm256_set1_ps(-1.9515295891e-4f), r2, _mm256_set1_ps(8.3321608736e-3f));
+	s = _mm256_fmadd_ps(s, r2, _mm256_set1_ps(-1.6666654611e-1f));
+	s = _mm256_fmadd_ps(_mm256_mul_ps(s, r2), r, r);
+
+	__m256 k = _mm256_fmadd_ps(_mm256_set1_ps(2.443315711809948e-5f), r2, _mm256_set1_ps(-1.388731625493765e-3f));
+	k = _mm256_fmadd_ps(k, r2, _mm256_set1_ps(4.166664568298827e-2f));
+	k = _mm256_fmadd_ps(_mm256_mul_ps(k, r2), r2, _mm256_fnmadd_ps(r2, _mm256_set1_ps(0.5f), _mm256_set1_ps(1.0f)));
+
+	__m256 const Swap = _mm256_castsi256_ps(_mm256_slli_epi32(q, 31));
+	__m256 const SinSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(q, _mm256_set1_epi32(2)), 30));
+	__m256 const CosSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(q, _mm256_set1_epi32(1)), _mm256_set1_epi32(2)), 30));
+
+	*c = _mm256_xor_ps(_mm256_blendv_ps(k, s, Swap), CosSign);
+	return _mm256_xor_ps(_mm256_blendv_ps(s, k, Swap), SinSign);
+}
+
+GLM_BATCH_AVX2_INLINE __m256 glm_vec8_exp_avx2(__m256 x)
+{
+	__m256 const Max = _mm256_set1_ps(88.7228394f);
+	__m256 const Min = _mm256_set1_ps(-103.972084f);
+	__m256 const v = _mm256_min_ps(_mm256_max_ps(x, Min), Max);
+
+	__m256i const q = _mm256_cvtps_epi32(_mm256_mul_ps(v, _mm256_set1_ps(1.44269504088896341f)));
+	__m256 const n = _mm256_cvtepi32_ps(q);
+	__m256 r = _mm256_fnmadd_ps(n, _mm256_set1_ps(0.693359375f), v);
+	r = _mm256_fmadd_ps(n, _mm256_set1_ps(2.12194440e-4f), r);
+
+	__m256 p = _mm256_fmadd_ps(_mm256_set1_ps(1.9875691500e-4f), r, _mm256_set1_ps(1.3981999507e-3f));
+	p = _mm256_fmadd_ps(p, r, _mm256_set1_ps(8.3334519073e-3f));
+	p = _mm256_fmadd_ps(p, r, _mm256_set1_ps(4.1665795894e-2f));
+	p = _mm256_fmadd_ps(p, r, _mm256_set1_ps(1.6666665459e-1f));
+	p = _mm256_fmadd_ps(p, r, _mm256_set1_ps(5.0000001201e-1f));
+	p = _mm256_add_ps(_mm256_fmadd_ps(_mm256_mul_ps(p, r), r, r), _mm256_set1_ps(1.0f));
+
+	__m256i const Half = _mm256_srai_epi32(q, 1);
+	__m256 const a = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(Half, _mm256_set1_epi32(127)), 23));
+	__m256 const b = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(_mm256_sub_epi32(q, Half), _mm256_set1_epi32(127)), 23));
+	__m256 Result = _mm256_mul_ps(_mm256_mul_ps(p, a), b);
+
+	Result = _mm256_blendv_ps(Result, _mm256_set1_ps(std::numeric_limits<float>::infinity()), _mm256_cmp_ps(x, Max, _CMP_GT_OQ));
+	Result = _mm256_andnot_ps(_mm256_cmp_ps(x, Min, _CMP_LT_OQ), Result);
+	return _mm256_blendv_ps(Result, x, _mm256_cmp_ps(x, x, _CMP_UNORD_Q));
+}
+
+GLM_BATCH_AVX2_INLINE __m256 glm_vec8_log_avx2(__m256 x)
+{
+	__m256 const Denormal = _mm256_cmp_ps(x, _mm256_set1_ps(std::numeric_limits<float>::min()), _CMP_LT_OQ);
+	__m256 const v = _mm256_blendv_ps(x, _mm256_mul_ps(x, _mm256_set1_ps(8388608.0f)), Denormal);
+	__m256i const Bits = _mm256_castps_si256(v);
+
+	__m256 e = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(Bits, 23), _mm256_set1_epi32(126)));
+	e = _mm256_sub_ps(e, _mm256_and_ps(Denormal, _mm256_set1_ps(23.0f)));
+	__m256 m = _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(Bits, _mm256_set1_epi32(0x007fffff)), _mm256_set1_epi32(0x3f000000)));
+	__m256 const Small = _mm256_cmp_ps(m, _mm256_set1_ps(0.707106781186547524f), _CMP_LT_OQ);
+	e = _mm256_sub_ps(e, _mm256_and_ps(Small, _mm256_set1_ps(1.0f)));
+	m = _mm256_add_ps(_mm256_sub_ps(m, _mm256_set1_ps(1.0f)), _mm256_and_ps(Small, m));
+	__m256 const z = _mm256_mul_ps(m, m);
+
+	__m256 p = _mm256_fmadd_ps(_mm256_set1_ps(7.0376836292e-2f), m, _mm256_set1_ps(-1.1514610310e-1f));
+	p = _mm256_fmadd_ps(p, m, _mm256_set1_ps(1.1676998740e-1f));
+	p = _mm256_fmadd_ps(p, m, _mm256_set1_ps(-1.2420140846e-1f));
+	p = _mm256_fmadd_ps(p, m, _mm256_set1_ps(1.4249322787e-1f));
+	p = _mm256_fmadd_ps(p, m, _mm256_set1_ps(-1.6668057665e-1f));
+	p = _mm256_fmadd_ps(p, m, _mm256_set1_ps(2.0000714765e-1f));
+	p = _mm256_fmadd_ps(p, m, _mm256_set1_ps(-2.4999993993e-1f));
+	p = _mm256_fmadd_ps(p, m, _mm256_set1_ps(3.3333331174e-1f));
+	p = _mm256_mul_ps(_mm256_mul_ps(p, m), z);
+
+	p = _mm256_fmadd_ps(e, _mm256_set1_ps(-2.12194440e-4f), p);
+	p = _mm256_fnmadd_ps(z, _mm256_set1_ps(0.5f), p);
+	__m256 Result = _mm256_fmadd_ps(e, _mm256_set1_ps(0.693359375f), _mm256_add_ps(m, p));
+
+	__m256 const Invalid = _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_NGE_UQ);
+	Result = _mm256_blendv_ps(Result, _mm256_set1_ps(-std::numeric_limits<float>::infinity()), _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_EQ_OQ));
+	Result = _mm256_blendv_ps(Result, x, _mm256_cmp_ps(x, _mm256_set1_ps(std::numeric_limits<float>::infinity()), _CMP_EQ_OQ));
+	return _mm256_or_ps(Result, Invalid);
+}
+
+GLM_BATCH_AVX2_INLINE __m256 glm_vec8_pow_avx2(__m256 x, __m256 y)
+{
+	__m256 const Result = glm_vec8_exp_avx2(_mm256_mul_ps(y, glm_vec8_log_avx2(x)));
+	return _mm256_blendv_ps(Result, _mm256_set1_ps(1.0f), _mm256_cmp_ps(y, _mm256_setzero_ps(), _CMP_EQ_OQ));
+}
+
+inline GLM_BATCH_AVX2 void glm_sincos_batch_avx2(float const* In, float* Sin, float* Cos, std::size_t Count)
+{
+	std::size_t i = 0;
+	for(; i + 8 <= Count; i += 8)
+	{
+		__m256 c;
+		__m256 const s = glm_vec8_sincos_avx2(_mm256_loadu_ps(In + i), &c);
+		if(Sin)
+			_mm256_storeu_ps(Sin + i, s);
+		if(Cos)
+			_mm256_storeu_ps(Cos + i, c);
+	}
+
+	glm_sincos_batch_sse2(In + i, Sin ? Sin + i : Sin, Cos ? Cos + i : Cos, Count - i);
+}
+
+inline GLM_BATCH_AVX2 void glm_exp_batch_avx2(float const* In, float* Out, std::size_t Count)
+{
+	std::size_t i = 0;
+	for(; i + 8 <= Count; i += 8)
+		_mm256_storeu_ps(Out + i, glm_vec8_exp_avx2(_mm256_loadu_ps(In + i)));
+
+	glm_exp_batch_sse2(In + i, Out + i, Count - i);
+}
+
+inline GLM_BATCH_AVX2 void glm_log_batch_avx2(float const* In, float* Out, std::size_t Count)
+{
+	std::size_t i = 0;
+	for(; i + 8 <= Count; i += 8)
+		_mm256_storeu_ps(Out + i, glm_vec8_log_avx2(_mm256_loadu_ps(In + i)));
+
+	glm_log_batch_sse2(In + i, Out + i, Count - i);
+}
+
+inline GLM_BATCH_AVX2 void glm_pow_batch_avx2(float const* X, float const* Y, std::size_t StrideY, float* Out, std::size_t Count)
+{
+	__m256 const Common = StrideY ? _mm256_setzero_ps() : _mm256_set1_ps(*Y);
+	std::size_t i = 0;
+	for(; i + 8 <= Count; i += 8)
+		_mm256_storeu_ps(Out + i, glm_vec8_pow_avx2(_mm256_loadu_ps(X + i), StrideY ? _mm256_loadu_ps(Y + i) : Common));
+
+	glm_pow_batch_sse2(X + i, StrideY ? Y + i : Y, StrideY, Out + i, Count - i);
+}
+
+#endif//GLM_BATCH_X86
@@ -0,0 +1,131 @@
+#ifndef GLM_FORCE_CONSTEXPR
+#	define GLM_FORCE_CONSTEXPR
+#endif//GLM_FORCE_CONSTEXPR
+#include <glm/glm.hpp>
+
+#if GLM_CONFIG_CONSTEXPR_MATH == GLM_ENABLE
+
+#include <glm/ext/matrix_clip_space.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+#if GLM_CONFIG_SIMD == GLM_ENABLE && GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
+
+static int test_mat()
+{
+	constexpr glm::mat4 A(
+		1, 2, 3, 4,
+		5, 6, 7, 8,
+		9, 10, 11, 12,
+		13, 14, 15, 16);
+	constexpr glm::mat4 B = A * glm::mat4(2.0f);
+	static_assert(B[1][2] == 14.0f, "GLM: Failed constexpr");
+	static_assert(B == A + A, "GLM: Failed constexpr");
+	static_assert(B - A == A, "GLM: Failed constexpr");
+	static_assert(-A + A * 2.0f == A, "GLM: Failed constexpr");
+	static_assert(B / 2.0f != B, "GLM: Failed constexpr");
+
+	constexpr glm::mat4 C = glm::transpose(A);
+	static_assert(C[0][1] == 5.0f && C[1][0] == 2.0f, "GLM: Failed constexpr");
+	static_assert(glm::transpose(C) == A, "GLM: Failed constexpr");
+
+	constexpr glm::vec4 V = A * glm::vec4(1, 0, 0, 1);
+	static_assert(V == glm::vec4(14, 16, 18, 20), "GLM: Failed constexpr");
+
+	constexpr glm::mat3x2 D = glm::mat2x2(2.0f) * glm::mat3x2(1, 2, 3, 4, 5, 6);
+	static_assert(D[2] == glm::vec2(10, 12), "GLM: Failed constexpr");
+
+	constexpr glm::mat3 E = glm::mat3x4(1.0f) * glm::mat4x3(1.0f);
+	static_assert(E == glm::mat3(1.0f), "GLM: Failed constexpr");
+
+	return 0;
+}
+
+static int test_transform()
+{
+	int Error = 0;
+
+	constexpr glm::mat4 Model = glm::scale(glm::translate(glm::mat4(1.0f), glm::vec3(1, 2, 3)), glm::vec3(2.0f));
+	static_assert(Model * glm::vec4(1, 1, 1, 1) == glm::vec4(3, 4, 5, 1), "GLM: Failed constexpr");
+
+	constexpr glm::vec3 Eye(2.0f, 10.0f, 42.0f);
+	constexpr glm::mat4 View = glm::lookAt(Eye, glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+	static_assert(glm::abs(glm::dot(glm::vec3(View[0]), glm::vec3(View[1]))) < 0.00001f, "GLM: Failed constexpr");
+	static_assert(glm::abs((View * glm::vec4(Eye, 1.0f)).z) < 0.0001f, "GLM: Failed constexpr");
+
+	constexpr glm::mat4 Proj = glm::perspective(glm::radians(90.0f), 1.0f, 0.1f, 64.0f);
+	static_assert(glm::abs(Proj[1][1] - 1.0f) < 0.00001f, "GLM: Failed constexpr");
+	static_assert(Proj[0][0] == Proj[1][1] && Proj[2][3] == -1.0f, "GLM: Failed constexpr");
+
+	// Same results as the standard library path taken at runtime
+	glm::vec3 const Center(0.0f);
+	float Aspect = 1.0f;
+	Error += glm::all(glm::equal(View, glm::lookAt(Eye, Center, glm::vec3(0.0f, 1.0f, 0.0f)), 0.00001f)) ? 0 : 1;
+	Error += glm::all(glm::equal(Proj, glm::perspective(glm::radians(90.0f), Aspect, 0.1f, 64.0f), 0.00001f)) ? 0 : 1;
+
+	constexpr glm::mat4 Narrow = glm::perspectiveLH_NO(glm::radians(30.0f), 1.5f, 1.0f, 100.0f);
+	Error += glm::all(glm::equal(Narrow, glm::perspectiveLH_NO(glm::radians(30.0f), Aspect * 1.5f, 1.0f, 100.0f), 0.00001f)) ? 0 : 1;
+
+	constexpr float InvSqrt = glm::inversesqrt(16.0f);
+	static_assert(InvSqrt == 0.25f, "GLM: Failed constexpr");
+
+	return Error;
+}
+
+static int test_quat()
+{
+	constexpr glm::quat I(0.0f, 1.0f, 0.0f, 0.0f);
+	constexpr glm::quat J(0.0f, 0.0f, 1.0f, 0.0f);
+	static_assert(I * J == glm::quat(0.0f, 0.0f, 0.0f, 1.0f), "GLM: Failed constexpr");
+	static_assert(I * I == glm::quat(-1.0f, 0.0f, 0.0f, 0.0f), "GLM: Failed constexpr");
+	static_assert(I * 2.0f == 2.0f * I, "GLM: Failed constexpr");
+
+	// Half turn around z
+	constexpr glm::vec3 V = (I * J) * glm::vec3(1.0f, 0.0f, 0.0f);
+	static_assert(V == glm::vec3(-1.0f, 0.0f, 0.0f), "GLM: Failed constexpr");
+
+	return 0;
+}
+
+// Aligned types are out of constant expressions and keep their SIMD code at runtime
+static int test_aligned()
+{
+	int Error = 0;
+
+#	if GLM_CONFIG_SIMD == GLM_ENABLE && GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		static_assert(glm::detail::is_aligned<glm::aligned_highp>::value, "GLM: aligned types must take the SIMD specializations");
+
+		glm::aligned_vec4 const A(1.0f, 2.0f, 3.0f, 4.0f);
+		glm::aligned_vec4 const B(glm::normalize(A)); // Approximated reciprocal square root
+		Error += glm::abs(glm::dot(B, B) - 1.0f) < 0.001f ? 0 : 1;
+		Error += glm::abs(glm::dot(A, A) - glm::dot(glm::vec4(A), glm::vec4(A))) < 0.0001f ? 0 : 1;
+
+		glm::aligned_mat4 const M = glm::aligned_mat4(2.0f) * glm::aligned_mat4(3.0f);
+		Error += M[2][2] == 6.0f ? 0 : 1;
+#	endif
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_mat();
+	Error += test_transform();
+	Error += test_quat();
+	Error += test_aligned();
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif//GLM_CONFIG_CONSTEXPR_MATH == GLM_ENABLE
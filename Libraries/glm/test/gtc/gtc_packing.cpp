@@ -1,8 +1,12 @@
+#define GLM_ENABLE_EXPERIMENTAL
 #include <glm/packing.hpp>
 #include <glm/gtc/packing.hpp>
+#include <glm/gtx/matrix_batch.hpp>
 #include <glm/gtc/epsilon.hpp>
 #include <glm/ext/vector_relational.hpp>
 #include <cstdio>
+#include <cstring>
+#include <limits>
 #include <vector>
 
 void print_bits(float const& s)
@@ -822,6 +826,277 @@ int test_packInt2x32()
 	return Error;
 }
 
+// The batch functions must give the bits of the scalar functions at every instruction set.
+// Odd counts so that every kernel goes through its tail.
+
+static glm::uint32 next_bits(glm::uint32& Seed)
+{
+	Seed = Seed * 1664525u + 1013904223u;
+	return Seed;
+}
+
+static float bits_to_float(glm::uint32 Bits)
+{
+	float f;
+	std::memcpy(&f, &Bits, sizeof(f));
+	return f;
+}
+
+// Every kind of float: zeros, denormals, halfway cases of the half rounding, overflow, infinities and NaN payloads.
+static std::vector<float> make_half_inputs()
+{
+	glm::uint32 const Bits[] = {
+		0x00000000, 0x80000000, 0x00000001, 0x807fffff, 0x33000000, 0x33000001, 0x32ffffff, 0x33c00000,
+		0x387fc000, 0x387fe000, 0x38800000, 0x3f801000, 0x3f803000, 0x3f800fff, 0x477fe000, 0x477fefff,
+		0x477ff000, 0x7f7fffff, 0x7f800000, 0xff800000, 0x7f800001, 0x7fc00000, 0xffc00001, 0x7f802000};
+
+	std::vector<float> Values;
+	for(std::size_t i = 0; i < sizeof(Bits) / sizeof(Bits[0]); ++i)
+		Values.push_back(bits_to_float(Bits[i]));
+
+	glm::uint32 Seed = 1;
+	for(std::size_t i = 0; i < 4001; ++i)
+	{
+		glm::uint32 const Random = next_bits(Seed);
+		// Most of them in the half range, the others anywhere
+		Values.push_back(i % 4 ? bits_to_float((Random & 0x8fffffff) | 0x30000000) : bits_to_float(Random));
+	}
+	return Values;
+}
+
+// Normalized values and a bit beyond, the infinities and exact halfway products.
+static std::vector<float> make_norm_inputs()
+{
+	std::vector<float> Values;
+	Values.push_back(0.0f);
+	Values.push_back(-0.0f);
+	Values.push_back(1.0f);
+	Values.push_back(-1.0f);
+	Values.push_back(0.5f / 255.0f);
+	Values.push_back(2.5f / 127.0f);
+	Values.push_back(std::numeric_limits<float>::infinity());
+	Values.push_back(-std::numeric_limits<float>::infinity());
+
+	glm::uint32 Seed = 2;
+	for(std::size_t i = 0; i < 4003; ++i)
+		Values.push_back(static_cast<float>(next_bits(Seed) >> 8) / static_cast<float>(1 << 24) * 3.0f - 1.5f);
+	return Values;
+}
+
+template<typename T>
+static int compare_bits(std::vector<T> const& Expected, std::vector<T> const& Result)
+{
+	return Expected.size() == Result.size() && std::memcmp(&Expected[0], &Result[0], Expected.size() * sizeof(T)) == 0 ? 0 : 1;
+}
+
+static int test_Half1x16Batch()
+{
+	int Error = 0;
+
+	std::vector<float> const Floats = make_half_inputs();
+	std::vector<glm::uint16> Expected(Floats.size());
+	for(std::size_t i = 0; i < Floats.size(); ++i)
+		Expected[i] = glm::packHalf1x16(Floats[i]);
+
+	std::vector<glm::uint16> Halves(65536);
+	std::vector<float> ExpectedFloats(Halves.size());
+	for(std::size_t i = 0; i < Halves.size(); ++i)
+	{
+		Halves[i] = static_cast<glm::uint16>(i);
+		ExpectedFloats[i] = glm::unpackHalf1x16(Halves[i]);
+	}
+
+	int const Best = glm::setBatchInstructionSet(glm::BATCH_AVX512);
+	for(int Set = glm::BATCH_SCALAR; Set <= Best; ++Set)
+	{
+		glm::setBatchInstructionSet(static_cast<glm::batch_instruction_set>(Set));
+
+		std::vector<glm::uint16> Packed(Floats.size());
+		glm::packHalf1x16Batch(&Floats[0], &Packed[0], Floats.size());
+		Error += compare_bits(Expected, Packed);
+
+		std::vector<float> Unpacked(Halves.size() - 3);
+		glm::unpackHalf1x16Batch(&Halves[0], &Unpacked[0], Unpacked.size());
+		Error += compare_bits(std::vector<float>(ExpectedFloats.begin(), ExpectedFloats.end() - 3), Unpacked);
+	}
+	glm::setBatchInstructionSet(static_cast<glm::batch_instruction_set>(Best));
+
+	return Error;
+}
+
+static int test_Norm1x8Batch()
+{
+	int Error = 0;
+
+	std::vector<float> const Floats = make_norm_inputs();
+	std::vector<glm::uint8> ExpectedUnorm(Floats.size()), ExpectedSnorm(Floats.size());
+	for(std::size_t i = 0; i < Floats.size(); ++i)
+	{
+		ExpectedUnorm[i] = glm::packUnorm1x8(Floats[i]);
+		ExpectedSnorm[i] = glm::packSnorm1x8(Floats[i]);
+	}
+
+	std::vector<glm::uint8> Bytes(255);
+	std::vector<float> ExpectedUnormFloats(Bytes.size()), ExpectedSnormFloats(Bytes.size());
+	for(std::size_t i = 0; i < Bytes.size(); ++i)
+	{
+		Bytes[i] = static_cast<glm::uint8>(i + 1);
+		ExpectedUnormFloats[i] = glm::unpackUnorm1x8(Bytes[i]);
+		ExpectedSnormFloats[i] = glm::unpackSnorm1x8(Bytes[i]);
+	}
+
+	int const Best = glm::setBatchInstructionSet(glm::BATCH_AVX512);
+	for(int Set = glm::BATCH_SCALAR; Set <= Best; ++Set)
+	{
+		glm::setBatchInstructionSet(static_cast<glm::batch_instruction_set>(Set));
+
+		std::vector<glm::uint8> Packed(Floats.size());
+		glm::packUnorm1x8Batch(&Floats[0], &Packed[0], Floats.size());
+		Error += compare_bits(ExpectedUnorm, Packed);
+		glm::packSnorm1x8Batch(&Floats[0], &Packed[0], Floats.size());
+		Error += compare_bits(ExpectedSnorm, Packed);
+
+		std::vector<float> Unpacked(Bytes.size());
+		glm::unpackUnorm1x8Batch(&Bytes[0], &Unpacked[0], Bytes.size());
+		Error += compare_bits(ExpectedUnormFloats, Unpacked);
+		glm::unpackSnorm1x8Batch(&Bytes[0], &Unpacked[0], Bytes.size());
+		Error += compare_bits(ExpectedSnormFloats, Unpacked);
+	}
+	glm::setBatchInstructionSet(static_cast<glm::batch_instruction_set>(Best));
+
+	return Error;
+}
+
+static int test_Norm1x16Batch()
+{
+	int Error = 0;
+
+	std::vector<float> const Floats = make_norm_inputs();
+	std::vector<glm::uint16> ExpectedUnorm(Floats.size()), ExpectedSnorm(Floats.size());
+	for(std::size_t i = 0; i < Floats.size(); ++i)
+	{
+		ExpectedUnorm[i] = glm::packUnorm1x16(Floats[i]);
+		ExpectedSnorm[i] = glm::packSnorm1x16(Floats[i]);
+	}
+
+	std::vector<glm::uint16> Words(65535);
+	std::vector<float> ExpectedUnormFloats(Words.size()), ExpectedSnormFloats(Words.size());
+	for(std::size_t i = 0; i < Words.size(); ++i)
+	{
+		Words[i] = static_cast<glm::uint16>(i);
+		ExpectedUnormFloats[i] = glm::unpackUnorm1x16(Words[i]);
+		ExpectedSnormFloats[i] = glm::unpackSnorm1x16(Words[i]);
+	}
+
+	int const Best = glm::setBatchInstructionSet(glm::BATCH_AVX512);
+	for(int Set = glm::BATCH_SCALAR; Set <= Best; ++Set)
+	{
+		glm::setBatchInstructionSet(static_cast<glm::batch_instruction_set>(Set));
+
+		std::vector<glm::uint16> Packed(Floats.size());
+		glm::packUnorm1x16Batch(&Floats[0], &Packed[0], Floats.size());
+		Error += compare_bits(ExpectedUnorm, Packed);
+		glm::packSnorm1x16Batch(&Floats[0], &Packed[0], Floats.size());
+		Error += compare_bits(ExpectedSnorm, Packed);
+
+		std::vector<float> Unpacked(Words.size());
+		glm::unpackUnorm1x16Batch(&Words[0], &Unpacked[0], Words.size());
+		Error += compare_bits(ExpectedUnormFloats, Unpacked);
+		glm::unpackSnorm1x16Batch(&Words[0], &Unpacked[0], Words.size());
+		Error += compare_bits(ExpectedSnormFloats, Unpacked);
+	}
+	glm::setBatchInstructionSet(static_cast<glm::batch_instruction_set>(Best));
+
+	return Error;
+}
+
+static int test_3x10_1x2Batch()
+{
+	int Error = 0;
+
+	std::vector<float> const Floats = make_norm_inputs();
+	std::vector<glm::vec4> Vectors(Floats.size() / 4);
+	std::vector<glm::uint32> ExpectedUnorm(Vectors.size()), ExpectedSnorm(Vectors.size());
+	for(std::size_t i = 0; i < Vectors.size(); ++i)
+	{
+		Vectors[i] = glm::vec4(Floats[i * 4], Floats[i * 4 + 1], Floats[i * 4 + 2], Floats[i * 4 + 3]);
+		ExpectedUnorm[i] = glm::packUnorm3x10_1x2(Vectors[i]);
+		ExpectedSnorm[i] = glm::packSnorm3x10_1x2(Vectors[i]);
+	}
+
+	glm::uint32 Seed = 3;
+	std::vector<glm::uint32> Packs(1001);
+	std::vector<glm::vec4> ExpectedUnormVectors(Packs.size()), ExpectedSnormVectors(Packs.size());
+	for(std::size_t i = 0; i < Packs.size(); ++i)
+	{
+		Packs[i] = next_bits(Seed);
+		ExpectedUnormVectors[i] = glm::unpackUnorm3x10_1x2(Packs[i]);
+		ExpectedSnormVectors[i] = glm::unpackSnorm3x10_1x2(Packs[i]);
+	}
+
+	int const Best = glm::setBatchInstructionSet(glm::BATCH_AVX512);
+	for(int Set = glm::BATCH_SCALAR; Set <= Best; ++Set)
+	{
+		glm::setBatchInstructionSet(static_cast<glm::batch_instruction_set>(Set));
+
+		std::vector<glm::uint32> Packed(Vectors.size());
+		glm::packUnorm3x10_1x2Batch(&Vectors[0], &Packed[0], Vectors.size());
+		Error += compare_bits(ExpectedUnorm, Packed);
+		glm::packSnorm3x10_1x2Batch(&Vectors[0], &Packed[0], Vectors.size());
+		Error += compare_bits(ExpectedSnorm, Packed);
+
+		std::vector<glm::vec4> Unpacked(Packs.size());
+		glm::unpackUnorm3x10_1x2Batch(&Packs[0], &Unpacked[0], Packs.size());
+		Error += compare_bits(ExpectedUnormVectors, Unpacked);
+		glm::unpackSnorm3x10_1x2Batch(&Packs[0], &Unpacked[0], Packs.size());
+		Error += compare_bits(ExpectedSnormVectors, Unpacked);
+	}
+	glm::setBatchInstructionSet(static_cast<glm::batch_instruction_set>(Best));
+
+	return Error;
+}
+
+static int test_F2x11_1x10Batch()
+{
+	int Error = 0;
+
+	std::vector<float> const Floats = make_half_inputs();
+	std::vector<glm::vec3> Vectors(Floats.size() / 3);
+	std::vector<glm::uint32> Expected(Vectors.size());
+	for(std::size_t i = 0; i < Vectors.size(); ++i)
+	{
+		Vectors[i] = glm::vec3(Floats[i * 3], Floats[i * 3 + 1], Floats[i * 3 + 2]);
+		Expected[i] = glm::packF2x11_1x10(Vectors[i]);
+	}
+
+	// The unpacking has special cases on the whole word, not only on the component bits
+	glm::uint32 const Special[] = {0, 0x7ff, 0x7c0, 0x7ff << 11, 0x7c0 << 11, 0x3ffu << 22, 0x3e0u << 22, 0x7ffu | (0x7ffu << 11), 1, 1 << 11};
+	std::vector<glm::uint32> Packs(Special, Special + sizeof(Special) / sizeof(Special[0]));
+	glm::uint32 Seed = 4;
+	for(std::size_t i = 0; i < 1001; ++i)
+		Packs.push_back(next_bits(Seed));
+	std::vector<glm::vec3> ExpectedVectors(Packs.size());
+	for(std::size_t i = 0; i < Packs.size(); ++i)
+		ExpectedVectors[i] = glm::unpackF2x11_1x10(Packs[i]);
+
+	int const Best = glm::setBatchInstructionSet(glm::BATCH_AVX512);
+	for(int Set = glm::BATCH_SCALAR; Set <= Best; ++Set)
+	{
+		glm::setBatchInstructionSet(static_cast<glm::batch_instruction_set>(Set));
+
+		std::vector<glm::uint32> Packed(Vectors.size());
+		glm::packF2x11_1x10Batch(&Vectors[0], &Packed[0], Vectors.size());
+		Error += compare_bits(Expected, Packed);
+
+		std::vector<glm::vec3> Unpacked(Packs.size());
+		glm::unpackF2x11_1x10Batch(&Packs[0], &Unpacked[0], Packs.size());
+		Error += compare_bits(ExpectedVectors, Unpacked);
+	}
+	glm::setBatchInstructionSet(static_cast<glm::batch_instruction_set>(Best));
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
@@ -874,5 +1149,11 @@ int main()
 	Error += test_Half1x16();
 	Error += test_Half4x16();
 
+	Error += test_Half1x16Batch();
+	Error += test_Norm1x8Batch();
+	Error += test_Norm1x16Batch();
+	Error += test_3x10_1x2Batch();
+	Error += test_F2x11_1x10Batch();
+
 	return Error;
 }
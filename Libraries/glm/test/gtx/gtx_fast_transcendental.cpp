@@ -0,0 +1,213 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/fast_transcendental.hpp>
+#include <glm/gtc/ulp.hpp>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <cstdio>
+
+static glm::batch_instruction_set const Sets[] = {glm::BATCH_SCALAR, glm::BATCH_SSE2, glm::BATCH_AVX2, glm::BATCH_AVX512};
+
+// Counts that exercise the 4 and 8 wide main loops and every remainder.
+static std::size_t const Counts[] = {0, 1, 3, 4, 5, 8, 11, 16, 17};
+
+static std::size_t const Samples = 20000;
+
+// ULP distance to the correctly rounded result, computed in double. Rounding the reference adds up to half a ULP,
+// so the tests allow one more than the documented bounds.
+static int ulp(float Result, double Expected)
+{
+	float const Rounded = static_cast<float>(Expected);
+	if(Result == Rounded)
+		return 0;
+	if(Result != Result || Rounded != Rounded || std::fabs(Rounded) == std::numeric_limits<float>::infinity())
+		return std::numeric_limits<int>::max();
+	return glm::abs(glm::float_distance(Result, Rounded));
+}
+
+static float sample(std::size_t i, float Min, float Max)
+{
+	return Min + (Max - Min) * static_cast<float>(i) / static_cast<float>(Samples - 1);
+}
+
+// Bound for pow: 2 + 2 |y log(x)| ULP
+static int pow_bound(float x, float y)
+{
+	return 3 + static_cast<int>(2.0 * std::fabs(static_cast<double>(y) * std::log(static_cast<double>(x))));
+}
+
+static int test_scalar()
+{
+	int Error = 0;
+
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		float const a = sample(i, -8192.0f, 8192.0f);
+		float s, c;
+		glm::approxSincos(a, s, c);
+		Error += ulp(s, std::sin(static_cast<double>(a))) <= 4 ? 0 : 1;
+		Error += ulp(c, std::cos(static_cast<double>(a))) <= 4 ? 0 : 1;
+		Error += glm::approxSin(a) == s && glm::approxCos(a) == c ? 0 : 1;
+
+		float const e = sample(i, -87.0f, 88.0f);
+		Error += ulp(glm::approxExp(e), std::exp(static_cast<double>(e))) <= 2 ? 0 : 1;
+
+		float const l = std::exp(sample(i, -100.0f, 88.0f));
+		Error += ulp(glm::approxLog(l), std::log(static_cast<double>(l))) <= 2 ? 0 : 1;
+
+		float const x = sample(i, 0.01f, 100.0f);
+		float const y = sample(Samples - 1 - i, -8.0f, 8.0f);
+		Error += ulp(glm::approxPow(x, y), std::pow(static_cast<double>(x), static_cast<double>(y))) <= pow_bound(x, y) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<typename vecType>
+static int test_vec()
+{
+	int Error = 0;
+
+	for(std::size_t i = 0; i < Samples; i += 4)
+	{
+		vecType a, e, l, x, y;
+		for(glm::length_t k = 0; k < a.length(); ++k)
+		{
+			a[k] = sample(i + k, -8192.0f, 8192.0f);
+			e[k] = sample(i + k, -87.0f, 88.0f);
+			l[k] = std::exp(sample(i + k, -100.0f, 88.0f));
+			x[k] = sample(i + k, 0.01f, 100.0f);
+			y[k] = sample(Samples - 1 - i - k, -8.0f, 8.0f);
+		}
+
+		vecType s, c;
+		glm::approxSincos(a, s, c);
+		vecType const Sin = glm::approxSin(a);
+		vecType const Cos = glm::approxCos(a);
+		vecType const Exp = glm::approxExp(e);
+		vecType const Log = glm::approxLog(l);
+		vecType const Pow = glm::approxPow(x, y);
+
+		for(glm::length_t k = 0; k < a.length(); ++k)
+		{
+			Error += ulp(s[k], std::sin(static_cast<double>(a[k]))) <= 4 ? 0 : 1;
+			Error += ulp(c[k], std::cos(static_cast<double>(a[k]))) <= 4 ? 0 : 1;
+			Error += Sin[k] == s[k] && Cos[k] == c[k] ? 0 : 1;
+			Error += ulp(Exp[k], std::exp(static_cast<double>(e[k]))) <= 2 ? 0 : 1;
+			Error += ulp(Log[k], std::log(static_cast<double>(l[k]))) <= 2 ? 0 : 1;
+			Error += ulp(Pow[k], std::pow(static_cast<double>(x[k]), static_cast<double>(y[k]))) <= pow_bound(x[k], y[k]) ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+static int test_special()
+{
+	int Error = 0;
+
+	float const Inf = std::numeric_limits<float>::infinity();
+	float const NaN = std::numeric_limits<float>::quiet_NaN();
+
+	glm::vec4 const Sin = glm::approxSin(glm::vec4(0.0f, Inf, -Inf, NaN));
+	Error += Sin.x == 0.0f && glm::isnan(Sin.y) && glm::isnan(Sin.z) && glm::isnan(Sin.w) ? 0 : 1;
+
+	glm::vec4 const Exp = glm::approxExp(glm::vec4(-Inf, Inf, -200.0f, 0.0f));
+	Error += Exp.x == 0.0f && Exp.y == Inf && Exp.z == 0.0f && Exp.w == 1.0f ? 0 : 1;
+	Error += glm::isnan(glm::approxExp(NaN)) ? 0 : 1;
+
+	glm::vec4 const Log = glm::approxLog(glm::vec4(0.0f, Inf, -1.0f, 1.0f));
+	Error += Log.x == -Inf && Log.y == Inf && glm::isnan(Log.z) && Log.w == 0.0f ? 0 : 1;
+	Error += glm::isnan(glm::approxLog(NaN)) ? 0 : 1;
+	Error += ulp(glm::approxLog(std::numeric_limits<float>::denorm_min()), std::log(static_cast<double>(std::numeric_limits<float>::denorm_min()))) <= 2 ? 0 : 1;
+
+	glm::vec4 const Pow = glm::approxPow(glm::vec4(0.0f, 0.0f, 2.0f, -2.0f), glm::vec4(2.0f, 0.0f, 0.0f, 0.5f));
+	Error += Pow.x == 0.0f && Pow.y == 1.0f && Pow.z == 1.0f && glm::isnan(Pow.w) ? 0 : 1;
+
+	// The scalar code gives the same special values.
+	Error += glm::approxExp(-Inf) == 0.0f && glm::approxExp(Inf) == Inf ? 0 : 1;
+	Error += glm::approxLog(0.0f) == -Inf && glm::isnan(glm::approxLog(-1.0f)) ? 0 : 1;
+	Error += glm::approxPow(0.0f, 0.0f) == 1.0f && glm::isnan(glm::approxSin(Inf)) ? 0 : 1;
+
+	return Error;
+}
+
+static int test_batch()
+{
+	int Error = 0;
+
+	std::vector<float> a(Samples), e(Samples), l(Samples), x(Samples), y(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		a[i] = sample(i, -8192.0f, 8192.0f);
+		e[i] = sample(i, -87.0f, 88.0f);
+		l[i] = std::exp(sample(i, -100.0f, 88.0f));
+		x[i] = sample(i, 0.01f, 100.0f);
+		y[i] = sample(Samples - 1 - i, -8.0f, 8.0f);
+	}
+
+	std::vector<float> Sin(Samples), Cos(Samples), SinOnly(Samples), CosOnly(Samples), Exp(Samples), Log(Samples), Pow(Samples), Gamma(Samples);
+	glm::sincosBatch(&a[0], &Sin[0], &Cos[0], Samples);
+	glm::sinBatch(&a[0], &SinOnly[0], Samples);
+	glm::cosBatch(&a[0], &CosOnly[0], Samples);
+	glm::expBatch(&e[0], &Exp[0], Samples);
+	glm::logBatch(&l[0], &Log[0], Samples);
+	glm::powBatch(&x[0], &y[0], &Pow[0], Samples);
+	glm::powBatch(&x[0], 1.0f / 2.2f, &Gamma[0], Samples);
+
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		Error += ulp(Sin[i], std::sin(static_cast<double>(a[i]))) <= 4 ? 0 : 1;
+		Error += ulp(Cos[i], std::cos(static_cast<double>(a[i]))) <= 4 ? 0 : 1;
+		Error += SinOnly[i] == Sin[i] && CosOnly[i] == Cos[i] ? 0 : 1;
+		Error += ulp(Exp[i], std::exp(static_cast<double>(e[i]))) <= 2 ? 0 : 1;
+		Error += ulp(Log[i], std::log(static_cast<double>(l[i]))) <= 2 ? 0 : 1;
+		Error += ulp(Pow[i], std::pow(static_cast<double>(x[i]), static_cast<double>(y[i]))) <= pow_bound(x[i], y[i]) ? 0 : 1;
+		Error += ulp(Gamma[i], std::pow(static_cast<double>(x[i]), 1.0 / 2.2)) <= pow_bound(x[i], 1.0f / 2.2f) ? 0 : 1;
+	}
+
+	// Nothing past the end gets written, and the results match the element wise functions in place.
+	for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+	{
+		std::size_t const Count = Counts[c];
+		std::vector<float> Out(Count + 1, 42.0f), InPlace(e.begin(), e.begin() + Count + 1);
+		glm::expBatch(&e[0], &Out[0], Count);
+		glm::expBatch(&InPlace[0], &InPlace[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += ulp(Out[i], std::exp(static_cast<double>(e[i]))) <= 2 && InPlace[i] == Out[i] ? 0 : 1;
+		Error += Out[Count] == 42.0f && InPlace[Count] == e[Count] ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_scalar();
+	Error += test_vec<glm::vec4>();
+	Error += test_vec<glm::vec3>();
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		Error += test_vec<glm::aligned_vec4>();
+#	endif
+	Error += test_special();
+
+	glm::batch_instruction_set const Best = glm::setBatchInstructionSet(glm::BATCH_AVX512);
+
+	// Run every code path the CPU can execute.
+	for(std::size_t s = 0; s < sizeof(Sets) / sizeof(Sets[0]) && Sets[s] <= Best; ++s)
+	{
+		glm::setBatchInstructionSet(Sets[s]);
+
+		int const SetError = test_batch();
+		if(SetError != 0)
+			std::printf("instruction set %d: %d errors\n", static_cast<int>(Sets[s]), SetError);
+		Error += SetError;
+	}
+
+	return Error;
+}
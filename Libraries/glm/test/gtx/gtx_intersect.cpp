@@ -2,6 +2,8 @@
 #include <glm/glm.hpp>
 #include <glm/gtc/epsilon.hpp>
 #include <glm/gtx/intersect.hpp>
+#include <glm/ext/matrix_clip_space.hpp>
+#include <glm/ext/matrix_transform.hpp>
 
 int test_intersectRayTriangle()
 {
@@ -43,12 +45,111 @@ int test_intersectLineTriangle()
 	return Error;
 }
 
+int test_intersectRayTriangleWatertight()
+{
+	int Error = 0;
+
+	glm::vec3 const Vert0(0, 0, 0);
+	glm::vec3 const Vert1(-1, -1, 0);
+	glm::vec3 const Vert2(1, -1, 0);
+
+	// Same result as intersectRayTriangle inside the triangle, from both sides
+	{
+		glm::vec3 const Orig[] = {glm::vec3(0.1f, -0.5f, 2.0f), glm::vec3(-0.2f, -0.7f, -3.0f), glm::vec3(5.0f, 4.0f, 1.0f)};
+		glm::vec3 const Target[] = {glm::vec3(0.1f, -0.5f, 0.0f), glm::vec3(-0.2f, -0.7f, 0.0f), glm::vec3(0.3f, -0.6f, 0.0f)};
+		for(int i = 0; i < 3; ++i)
+		{
+			glm::vec3 const Dir = glm::normalize(Target[i] - Orig[i]);
+			glm::vec2 Bary(0), Expected(0);
+			float Distance = 0, ExpectedDistance = 0;
+			bool const Result = glm::intersectRayTriangleWatertight(Orig[i], Dir, Vert0, Vert1, Vert2, Bary, Distance);
+			bool const ExpectedResult = glm::intersectRayTriangle(Orig[i], Dir, Vert0, Vert1, Vert2, Expected, ExpectedDistance);
+			Error += Result && ExpectedResult ? 0 : 1;
+			Error += glm::all(glm::epsilonEqual(Bary, Expected, 0.0001f)) ? 0 : 1;
+			Error += glm::abs(Distance - ExpectedDistance) <= 0.0001f ? 0 : 1;
+		}
+	}
+
+	// Misses: outside, behind the origin and parallel to the triangle
+	{
+		glm::vec2 Bary(0);
+		float Distance = 0;
+		Error += !glm::intersectRayTriangleWatertight(glm::vec3(2, -0.5f, 2), glm::vec3(0, 0, -1), Vert0, Vert1, Vert2, Bary, Distance) ? 0 : 1;
+		Error += !glm::intersectRayTriangleWatertight(glm::vec3(0, -0.5f, 2), glm::vec3(0, 0, 1), Vert0, Vert1, Vert2, Bary, Distance) ? 0 : 1;
+		Error += !glm::intersectRayTriangleWatertight(glm::vec3(-2, -0.5f, 0), glm::vec3(1, 0, 0), Vert0, Vert1, Vert2, Bary, Distance) ? 0 : 1;
+	}
+
+	// Rays through the edge shared by the two triangles of a quad hit at least one of them
+	{
+		glm::vec3 const A(-1.0f, -1.0f, 0.3f), B(1.0f, -1.0f, -0.2f), C(1.0f, 1.0f, 0.1f), D(-1.0f, 1.0f, 0.7f);
+		glm::vec3 const Orig(0.123f, 0.456f, 5.0f);
+		for(int i = 1; i < 64; ++i)
+		{
+			float const a = static_cast<float>(i) / 64.0f;
+			glm::vec3 const Target = glm::mix(A, C, a);
+			glm::vec3 const Dir = glm::normalize(Target - Orig);
+			glm::vec2 Bary(0);
+			float Distance = 0;
+			bool const Hit0 = glm::intersectRayTriangleWatertight(Orig, Dir, A, B, C, Bary, Distance);
+			bool const Hit1 = glm::intersectRayTriangleWatertight(Orig, Dir, A, C, D, Bary, Distance);
+			Error += Hit0 || Hit1 ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+int test_frustumPlanes()
+{
+	int Error = 0;
+
+	glm::mat4 const View = glm::lookAt(glm::vec3(1, 2, 3), glm::vec3(0), glm::vec3(0, 1, 0));
+	glm::mat4 const ProjZO = glm::perspectiveZO(glm::radians(60.0f), 1.5f, 0.5f, 50.0f);
+	glm::mat4 const ProjNO = glm::perspectiveNO(glm::radians(60.0f), 1.5f, 0.5f, 50.0f);
+
+	glm::vec4 PlanesZO[6], PlanesNO[6];
+	glm::frustumPlanesZO(ProjZO * View, PlanesZO);
+	glm::frustumPlanesNO(ProjNO * View, PlanesNO);
+
+	// Both depth conventions describe the same volume
+	for(int i = 0; i < 6; ++i)
+	{
+		Error += glm::abs(glm::length(glm::vec3(PlanesZO[i])) - 1.0f) <= 0.0001f ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(PlanesZO[i], PlanesNO[i], 0.001f)) ? 0 : 1;
+	}
+
+	// Points of the frustum in world space are inside every plane
+	glm::mat4 const InvViewProj = glm::inverse(ProjZO * View);
+	for(int i = 0; i < 27; ++i)
+	{
+		glm::vec4 const Clip(static_cast<float>(i % 3) - 1.0f, static_cast<float>(i / 3 % 3) - 1.0f, static_cast<float>(i / 9) * 0.45f + 0.05f, 1.0f);
+		glm::vec4 const Inside = InvViewProj * (Clip * glm::vec4(0.9f, 0.9f, 1.0f, 1.0f));
+		glm::vec3 const Point = glm::vec3(Inside) / Inside.w;
+		for(int p = 0; p < 6; ++p)
+			Error += glm::dot(glm::vec3(PlanesZO[p]), Point) + PlanesZO[p].w >= 0.0f ? 0 : 1;
+	}
+
+	Error += glm::intersectSphereFrustum(glm::vec3(0), 0.1f, PlanesZO) ? 0 : 1;
+	Error += !glm::intersectSphereFrustum(glm::vec3(2, 4, 6), 0.1f, PlanesZO) ? 0 : 1;
+	Error += glm::intersectSphereFrustum(glm::vec3(1, 2, 3), 1.0f, PlanesZO) ? 0 : 1;
+	Error += !glm::intersectSphereFrustum(glm::vec3(-100, 0, 0), 1.0f, PlanesZO) ? 0 : 1;
+
+	Error += glm::intersectAABBFrustum(glm::vec3(-0.5f), glm::vec3(0.5f), PlanesZO) ? 0 : 1;
+	Error += !glm::intersectAABBFrustum(glm::vec3(1.8f, 3.8f, 5.8f), glm::vec3(2.2f, 4.2f, 6.2f), PlanesZO) ? 0 : 1;
+	Error += glm::intersectAABBFrustum(glm::vec3(-100, -1, -1), glm::vec3(100, 1, 1), PlanesZO) ? 0 : 1;
+	Error += !glm::intersectAABBFrustum(glm::vec3(-101, -1, -1), glm::vec3(-100, 1, 1), PlanesZO) ? 0 : 1;
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
 
 	Error += test_intersectRayTriangle();
 	Error += test_intersectLineTriangle();
+	Error += test_intersectRayTriangleWatertight();
+	Error += test_frustumPlanes();
 
 	return Error;
 }
@@ -0,0 +1,322 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/intersect_batch.hpp>
+#include <glm/ext/matrix_clip_space.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <vector>
+#include <cstdio>
+
+// Counts below, at and above the register widths and the 16 float padding.
+static std::size_t const Counts[] = {0, 1, 3, 4, 7, 8, 9, 15, 16, 17, 33, 100, 1000};
+
+static glm::batch_instruction_set const Sets[] = {glm::BATCH_SCALAR, glm::BATCH_SSE2, glm::BATCH_AVX2, glm::BATCH_AVX512};
+
+// Results may differ from the scalar functions when an object is this close to a decision, FMA rounds differently.
+static float const Tolerance = 0.0001f;
+
+static float random(unsigned int& Seed)
+{
+	Seed = Seed * 1664525u + 1013904223u;
+	return static_cast<float>(Seed >> 8) / static_cast<float>(1 << 24);
+}
+
+static glm::vec3 random_vec3(unsigned int& Seed, float Scale)
+{
+	float const x = random(Seed);
+	float const y = random(Seed);
+	float const z = random(Seed);
+	return (glm::vec3(x, y, z) * 2.0f - 1.0f) * Scale;
+}
+
+// Fills Out with Count values and leaves other values in its padding, which must not take part.
+static void fill(glm::vec3_soa& Out, std::vector<glm::vec3> const& In, std::size_t Count)
+{
+	Out.resize(0);
+	for(std::size_t i = 0; i < Count + 16; ++i)
+		Out.push_back(In[i % In.size()]);
+	Out.resize(Count);
+}
+
+static void frustum(glm::vec4 Planes[6])
+{
+	glm::mat4 const View = glm::lookAt(glm::vec3(2, 3, 10), glm::vec3(0), glm::vec3(0, 1, 0));
+	glm::frustumPlanesZO(glm::perspectiveZO(glm::radians(60.0f), 1.5f, 0.5f, 30.0f) * View, Planes);
+}
+
+static float sphere_margin(glm::vec4 const Planes[6], glm::vec3 const& Center, float Radius)
+{
+	float Margin = 1e30f;
+	for(int p = 0; p < 6; ++p)
+		Margin = glm::min(Margin, glm::abs(glm::dot(glm::vec3(Planes[p]), Center) + Planes[p].w + Radius));
+	return Margin;
+}
+
+// Visible must be the increasing indices Expected keeps, apart from objects within Tolerance of a plane.
+static int check_visible(std::vector<bool> const& Expected, std::vector<float> const& Margin, std::vector<unsigned int> const& Visible, std::size_t Written)
+{
+	int Error = 0;
+	std::vector<bool> Found(Expected.size(), false);
+	for(std::size_t i = 0; i < Written; ++i)
+	{
+		Error += Visible[i] < Expected.size() ? 0 : 1;
+		Error += i == 0 || Visible[i - 1] < Visible[i] ? 0 : 1;
+		if(Visible[i] < Expected.size())
+			Found[Visible[i]] = true;
+	}
+	for(std::size_t i = 0; i < Expected.size(); ++i)
+		Error += Found[i] == Expected[i] || Margin[i] < Tolerance ? 0 : 1;
+	return Error;
+}
+
+static int test_sphereFrustum()
+{
+	int Error = 0;
+
+	glm::vec4 Planes[6];
+	frustum(Planes);
+
+	unsigned int Seed = 1;
+	std::vector<glm::vec3> Centers(1016, glm::vec3(0.0f));
+	std::vector<glm::vec3> Radii(1016, glm::vec3(0.0f));
+	for(std::size_t i = 0; i < Centers.size(); ++i)
+	{
+		Centers[i] = random_vec3(Seed, 20.0f);
+		Radii[i] = glm::vec3(random(Seed) * 2.0f);
+	}
+
+	for(std::size_t n = 0; n < sizeof(Counts) / sizeof(Counts[0]); ++n)
+	{
+		std::size_t const Count = Counts[n];
+
+		glm::vec3_soa SoACenters;
+		glm::vec1_soa SoARadii;
+		fill(SoACenters, Centers, Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			SoARadii.push_back(glm::vec1(Radii[i].x));
+
+		std::vector<unsigned int> Visible(Count + 1);
+		std::vector<bool> Expected(Count);
+		std::vector<float> Margin(Count);
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Expected[i] = glm::intersectSphereFrustum(Centers[i], Radii[i].x, Planes);
+			Margin[i] = sphere_margin(Planes, Centers[i], Radii[i].x);
+		}
+		Error += check_visible(Expected, Margin, Visible, glm::intersectSphereFrustumBatch(Planes, SoACenters, SoARadii, &Visible[0]));
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Expected[i] = glm::intersectSphereFrustum(Centers[i], 1.5f, Planes);
+			Margin[i] = sphere_margin(Planes, Centers[i], 1.5f);
+		}
+		Error += check_visible(Expected, Margin, Visible, glm::intersectSphereFrustumBatch(Planes, SoACenters, 1.5f, &Visible[0]));
+	}
+
+	return Error;
+}
+
+static int test_aabbFrustum()
+{
+	int Error = 0;
+
+	glm::vec4 Planes[6];
+	frustum(Planes);
+
+	unsigned int Seed = 2;
+	std::vector<glm::vec3> Min(1016, glm::vec3(0.0f)), Max(1016, glm::vec3(0.0f));
+	for(std::size_t i = 0; i < Min.size(); ++i)
+	{
+		Min[i] = random_vec3(Seed, 20.0f);
+		Max[i] = Min[i] + glm::abs(random_vec3(Seed, 3.0f));
+	}
+
+	for(std::size_t n = 0; n < sizeof(Counts) / sizeof(Counts[0]); ++n)
+	{
+		std::size_t const Count = Counts[n];
+
+		glm::vec3_soa SoAMin, SoAMax;
+		fill(SoAMin, Min, Count);
+		fill(SoAMax, Max, Count);
+
+		std::vector<unsigned int> Visible(Count + 1);
+		std::vector<bool> Expected(Count);
+		std::vector<float> Margin(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Expected[i] = glm::intersectAABBFrustum(Min[i], Max[i], Planes);
+			Margin[i] = 1e30f;
+			for(int p = 0; p < 6; ++p)
+			{
+				glm::vec3 const Corner(glm::mix(Max[i], Min[i], glm::lessThan(glm::vec3(Planes[p]), glm::vec3(0))));
+				Margin[i] = glm::min(Margin[i], glm::abs(glm::dot(glm::vec3(Planes[p]), Corner) + Planes[p].w));
+			}
+		}
+		Error += check_visible(Expected, Margin, Visible, glm::intersectAABBFrustumBatch(Planes, SoAMin, SoAMax, &Visible[0]));
+	}
+
+	return Error;
+}
+
+// Index and Distance must match a sequential search, equal distances aside.
+static int check_closest(bool Hit, std::size_t Index, float Distance, bool ExpectedHit, std::size_t ExpectedIndex, float ExpectedDistance)
+{
+	if(Hit != ExpectedHit)
+		return 1;
+	if(!Hit)
+		return 0;
+	int Error = 0;
+	Error += glm::abs(Distance - ExpectedDistance) <= Tolerance * (1.0f + ExpectedDistance) ? 0 : 1;
+	Error += Index == ExpectedIndex || Distance == ExpectedDistance ? 0 : 1;
+	return Error;
+}
+
+static int test_raySphere()
+{
+	int Error = 0;
+
+	unsigned int Seed = 3;
+	std::vector<glm::vec3> Centers(1016, glm::vec3(0.0f));
+	for(std::size_t i = 0; i < Centers.size(); ++i)
+		Centers[i] = random_vec3(Seed, 20.0f);
+
+	for(std::size_t n = 0; n < sizeof(Counts) / sizeof(Counts[0]); ++n)
+	{
+		std::size_t const Count = Counts[n];
+
+		glm::vec3_soa SoACenters;
+		glm::vec1_soa SoARadii;
+		fill(SoACenters, Centers, Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			SoARadii.push_back(glm::vec1(0.5f + static_cast<float>(i % 3) * 0.5f));
+
+		for(int r = 0; r < 16; ++r)
+		{
+			// Rays toward the objects hit something, others mostly miss. The first one starts inside a sphere.
+			glm::vec3 const Orig = r == 0 && Count > 0 ? Centers[0] : random_vec3(Seed, 25.0f);
+			glm::vec3 const Target = Count > 0 && r % 2 == 0 ? Centers[(r * 7) % Count] : random_vec3(Seed, 25.0f);
+			glm::vec3 const Dir = glm::normalize(Target - Orig + glm::vec3(0.01f));
+
+			std::size_t ExpectedIndex = 0, Index = 0;
+			float ExpectedDistance = 0.0f, Distance = 0.0f;
+			bool ExpectedHit = false;
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				float const Radius = SoARadii.get(i).x;
+				float t = 0.0f;
+				if(glm::intersectRaySphere(Orig, Dir, Centers[i], Radius * Radius, t) && (!ExpectedHit || t < ExpectedDistance))
+				{
+					ExpectedHit = true;
+					ExpectedIndex = i;
+					ExpectedDistance = t;
+				}
+			}
+			bool const Hit = glm::intersectRaySphereBatch(Orig, Dir, SoACenters, SoARadii, Index, Distance);
+			Error += check_closest(Hit, Index, Distance, ExpectedHit, ExpectedIndex, ExpectedDistance);
+
+			ExpectedHit = false;
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				float t = 0.0f;
+				if(glm::intersectRaySphere(Orig, Dir, Centers[i], 0.75f * 0.75f, t) && (!ExpectedHit || t < ExpectedDistance))
+				{
+					ExpectedHit = true;
+					ExpectedIndex = i;
+					ExpectedDistance = t;
+				}
+			}
+			bool const CommonHit = glm::intersectRaySphereBatch(Orig, Dir, SoACenters, 0.75f, Index, Distance);
+			Error += check_closest(CommonHit, Index, Distance, ExpectedHit, ExpectedIndex, ExpectedDistance);
+		}
+	}
+
+	return Error;
+}
+
+static int test_rayTriangle()
+{
+	int Error = 0;
+
+	unsigned int Seed = 4;
+	std::vector<glm::vec3> V0(1016, glm::vec3(0.0f)), V1(1016, glm::vec3(0.0f)), V2(1016, glm::vec3(0.0f));
+	for(std::size_t i = 0; i < V0.size(); ++i)
+	{
+		V0[i] = random_vec3(Seed, 20.0f);
+		V1[i] = V0[i] + random_vec3(Seed, 2.0f);
+		V2[i] = V0[i] + random_vec3(Seed, 2.0f);
+	}
+
+	for(std::size_t n = 0; n < sizeof(Counts) / sizeof(Counts[0]); ++n)
+	{
+		std::size_t const Count = Counts[n];
+
+		glm::vec3_soa SoAV0, SoAV1, SoAV2;
+		fill(SoAV0, V0, Count);
+		fill(SoAV1, V1, Count);
+		fill(SoAV2, V2, Count);
+
+		// Rays along every axis in both directions, so each permutation of the shear is used.
+		for(int r = 0; r < 24; ++r)
+		{
+			glm::vec3 const Orig = random_vec3(Seed, 25.0f);
+			glm::vec3 Dir;
+			if(r < 6)
+			{
+				Dir = glm::vec3(0.1f, -0.2f, 0.15f);
+				Dir[r % 3] = r < 3 ? 1.0f : -1.0f;
+			}
+			else if(Count > 0 && r % 2 == 0)
+				Dir = (V0[(r * 5) % Count] + V1[(r * 5) % Count] + V2[(r * 5) % Count]) / 3.0f - Orig;
+			else
+				Dir = random_vec3(Seed, 1.0f);
+			Dir = glm::normalize(Dir);
+
+			std::size_t ExpectedIndex = 0, Index = 0;
+			glm::vec2 ExpectedBary(0.0f), Bary(0.0f);
+			float ExpectedDistance = 0.0f, Distance = 0.0f;
+			bool ExpectedHit = false;
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				glm::vec2 b(0.0f);
+				float t = 0.0f;
+				if(glm::intersectRayTriangleWatertight(Orig, Dir, V0[i], V1[i], V2[i], b, t) && (!ExpectedHit || t < ExpectedDistance))
+				{
+					ExpectedHit = true;
+					ExpectedIndex = i;
+					ExpectedBary = b;
+					ExpectedDistance = t;
+				}
+			}
+			bool const Hit = glm::intersectRayTriangleBatch(Orig, Dir, SoAV0, SoAV1, SoAV2, Index, Bary, Distance);
+			Error += check_closest(Hit, Index, Distance, ExpectedHit, ExpectedIndex, ExpectedDistance);
+			if(Hit && ExpectedHit && Index == ExpectedIndex)
+				Error += glm::all(glm::lessThanEqual(glm::abs(Bary - ExpectedBary), glm::vec2(0.001f))) ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	glm::batch_instruction_set const Best = glm::setBatchInstructionSet(glm::BATCH_AVX512);
+
+	// Run every code path the CPU can execute.
+	for(std::size_t s = 0; s < sizeof(Sets) / sizeof(Sets[0]) && Sets[s] <= Best; ++s)
+	{
+		glm::setBatchInstructionSet(Sets[s]);
+
+		int SetError = 0;
+		SetError += test_sphereFrustum();
+		SetError += test_aabbFrustum();
+		SetError += test_raySphere();
+		SetError += test_rayTriangle();
+
+		if(SetError != 0)
+			std::printf("instruction set %d: %d errors\n", static_cast<int>(Sets[s]), SetError);
+		Error += SetError;
+	}
+
+	return Error;
+}
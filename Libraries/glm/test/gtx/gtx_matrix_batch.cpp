@@ -0,0 +1,175 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/matrix_batch.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
+#include <vector>
+#include <cstdio>
+
+// Counts that exercise the 2, 4, 8 and 16 wide main loops and every remainder.
+static std::size_t const Counts[] = {0, 1, 2, 3, 4, 7, 8, 9, 15, 16, 17, 33, 100};
+
+static glm::batch_instruction_set const Sets[] = {glm::BATCH_SCALAR, glm::BATCH_SSE2, glm::BATCH_AVX2, glm::BATCH_AVX512};
+
+template<typename matType>
+static matType make_matrix(std::size_t i)
+{
+	float const f = static_cast<float>(i);
+	glm::mat4 M = glm::translate(glm::mat4(1.0f), glm::vec3(f, -2.0f * f, 0.5f));
+	M = glm::rotate(M, 0.1f + 0.37f * f, glm::normalize(glm::vec3(1.0f, f, 2.0f)));
+	M = glm::scale(M, glm::vec3(1.0f + 0.01f * f, 2.0f, 0.5f + 0.1f * f));
+	M[0][3] = 0.01f * f; // Not affine, so the whole inverse formula gets used.
+	return matType(M);
+}
+
+template<typename matType>
+static int test_mulBatch()
+{
+	int Error = 0;
+
+	for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+	{
+		std::size_t const Count = Counts[c];
+		std::vector<matType> A(Count + 1), B(Count + 1), Out(Count + 1), Common(Count + 1);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			A[i] = make_matrix<matType>(i);
+			B[i] = make_matrix<matType>(i + 100);
+		}
+
+		matType const Sentinel(42.0f);
+		Out[Count] = Sentinel;
+		Common[Count] = Sentinel;
+
+		glm::mulBatch(&A[0], &B[0], &Out[0], Count);
+		glm::mulBatch(A[0], &B[0], &Common[0], Count);
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += glm::all(glm::equal(Out[i], A[i] * B[i], 0.001f)) ? 0 : 1;
+			Error += glm::all(glm::equal(Common[i], A[0] * B[i], 0.001f)) ? 0 : 1;
+		}
+
+		// Nothing past the end gets written.
+		Error += glm::all(glm::equal(Out[Count], Sentinel, 0.0f)) ? 0 : 1;
+		Error += glm::all(glm::equal(Common[Count], Sentinel, 0.0f)) ? 0 : 1;
+
+		// In place
+		std::vector<matType> InPlace(B);
+		glm::mulBatch(&A[0], &InPlace[0], &InPlace[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(InPlace[i], A[i] * B[i], 0.001f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<typename matType>
+static int test_inverseBatch()
+{
+	int Error = 0;
+
+	for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+	{
+		std::size_t const Count = Counts[c];
+		std::vector<matType> In(Count + 1), Out(Count + 1);
+		for(std::size_t i = 0; i < Count; ++i)
+			In[i] = make_matrix<matType>(i);
+
+		matType const Sentinel(42.0f);
+		Out[Count] = Sentinel;
+
+		glm::inverseBatch(&In[0], &Out[0], Count);
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += glm::all(glm::equal(Out[i], glm::inverse(In[i]), 0.001f)) ? 0 : 1;
+			Error += glm::all(glm::equal(Out[i] * In[i], matType(1.0f), 0.001f)) ? 0 : 1;
+		}
+		Error += glm::all(glm::equal(Out[Count], Sentinel, 0.0f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<typename matType, typename vecType>
+static int test_transformBatch()
+{
+	int Error = 0;
+
+	for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+	{
+		std::size_t const Count = Counts[c];
+		std::vector<matType> M(Count + 1);
+		std::vector<vecType> In(Count + 1), Out(Count + 1), Common(Count + 1);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			M[i] = make_matrix<matType>(i);
+			float const f = static_cast<float>(i);
+			In[i] = vecType(f, 1.0f - f, 0.25f * f, 1.0f);
+		}
+
+		vecType const Sentinel(42.0f);
+		Out[Count] = Sentinel;
+		Common[Count] = Sentinel;
+
+		glm::transformBatch(&M[0], &In[0], &Out[0], Count);
+		glm::transformBatch(M[0], &In[0], &Common[0], Count);
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += glm::all(glm::equal(Out[i], M[i] * In[i], 0.001f)) ? 0 : 1;
+			Error += glm::all(glm::equal(Common[i], M[0] * In[i], 0.001f)) ? 0 : 1;
+		}
+		Error += glm::all(glm::equal(Out[Count], Sentinel, 0.0f)) ? 0 : 1;
+		Error += glm::all(glm::equal(Common[Count], Sentinel, 0.0f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int test_instructionSet()
+{
+	int Error = 0;
+
+	// Scalar is always available, and requests above what the CPU supports get lowered.
+	Error += glm::setBatchInstructionSet(glm::BATCH_SCALAR) == glm::BATCH_SCALAR ? 0 : 1;
+	Error += glm::batchInstructionSet() == glm::BATCH_SCALAR ? 0 : 1;
+	Error += glm::setBatchInstructionSet(glm::BATCH_AVX512) <= glm::BATCH_AVX512 ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_instructionSet();
+
+	glm::batch_instruction_set const Best = glm::setBatchInstructionSet(glm::BATCH_AVX512);
+
+	// Run every code path the CPU can execute.
+	for(std::size_t s = 0; s < sizeof(Sets) / sizeof(Sets[0]) && Sets[s] <= Best; ++s)
+	{
+		glm::setBatchInstructionSet(Sets[s]);
+
+		int SetError = 0;
+		SetError += test_mulBatch<glm::mat4>();
+		SetError += test_inverseBatch<glm::mat4>();
+		SetError += test_transformBatch<glm::mat4, glm::vec4>();
+#		if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+			SetError += test_mulBatch<glm::aligned_mat4>();
+			SetError += test_inverseBatch<glm::aligned_mat4>();
+			SetError += test_transformBatch<glm::aligned_mat4, glm::aligned_vec4>();
+#		endif
+
+		if(SetError != 0)
+			std::printf("instruction set %d: %d errors\n", static_cast<int>(Sets[s]), SetError);
+		Error += SetError;
+	}
+
+	return Error;
+}
@@ -0,0 +1,192 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/noise_batch.hpp>
+#include <vector>
+#include <cstdio>
+
+// Counts below, at and above the register widths.
+static std::size_t const Counts[] = {0, 1, 3, 4, 5, 7, 8, 9, 15, 16, 17, 100, 1000};
+
+static glm::batch_instruction_set const Sets[] = {glm::BATCH_SCALAR, glm::BATCH_SSE2, glm::BATCH_AVX2, glm::BATCH_AVX512};
+
+// The SSE2 kernels match the scalar functions, FMA contraction moves the AVX2 results by about 1e-5.
+static float const Tolerance = 0.0001f;
+
+static float random(unsigned int& Seed)
+{
+	Seed = Seed * 1664525u + 1013904223u;
+	return static_cast<float>(Seed >> 8) / static_cast<float>(1 << 24);
+}
+
+template<glm::length_t L, glm::qualifier Q>
+static std::vector<glm::vec<L, float, Q> > random_points(std::size_t Count, float Scale)
+{
+	unsigned int Seed = 7u;
+	std::vector<glm::vec<L, float, Q> > Points(Count, glm::vec<L, float, Q>(0.0f));
+	for(std::size_t i = 0; i < Count; ++i)
+	for(glm::length_t c = 0; c < L; ++c)
+		Points[i][c] = (random(Seed) * 2.0f - 1.0f) * Scale;
+	return Points;
+}
+
+static int test_fractal()
+{
+	int Error = 0;
+
+	glm::vec3 const p(1.3f, -7.1f, 0.4f);
+
+	Error += glm::fbm(p, glm::NOISE_PERLIN, 1) == glm::perlin(p) ? 0 : 1;
+	Error += glm::fbm(p, glm::NOISE_SIMPLEX, 1) == glm::simplex(p) ? 0 : 1;
+	Error += glm::fbm(p, glm::NOISE_PERLIN, 0) == 0.0f ? 0 : 1;
+
+	float const r = 1.0f - glm::abs(glm::simplex(p));
+	Error += glm::ridged(p, glm::NOISE_SIMPLEX, 1) == r * r ? 0 : 1;
+
+	float const Sum = glm::perlin(p) + 0.5f * glm::perlin(p * 2.0f) + 0.25f * glm::perlin(p * 4.0f);
+	Error += glm::abs(glm::fbm(p, glm::NOISE_PERLIN, 3) - Sum) < 0.00001f ? 0 : 1;
+
+	// Octaves of decreasing amplitude stay in a bounded range.
+	std::vector<glm::vec2> const Points = random_points<2, glm::defaultp>(1000, 50.0f);
+	for(std::size_t i = 0; i < Points.size(); ++i)
+	{
+		float const f = glm::fbm(Points[i], glm::NOISE_SIMPLEX, 6);
+		float const g = glm::ridged(Points[i], glm::NOISE_PERLIN, 6);
+		Error += f > -2.0f && f < 2.0f ? 0 : 1;
+		Error += g >= 0.0f && g <= 2.0f ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<glm::length_t L, glm::qualifier Q>
+static int test_batch()
+{
+	int Error = 0;
+
+	std::vector<glm::vec<L, float, Q> > const Points = random_points<L, Q>(1000, 40.0f);
+	std::vector<float> Result(1000 + 1);
+
+	for(std::size_t k = 0; k < sizeof(Counts) / sizeof(Counts[0]); ++k)
+	{
+		std::size_t const Count = Counts[k];
+		Result[Count] = -42.0f;
+
+		glm::perlinBatch(&Points[0], &Result[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::abs(Result[i] - glm::perlin(Points[i])) < Tolerance ? 0 : 1;
+
+		glm::simplexBatch(&Points[0], &Result[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::abs(Result[i] - glm::simplex(Points[i])) < Tolerance ? 0 : 1;
+
+		glm::fbmBatch(&Points[0], &Result[0], Count, glm::NOISE_PERLIN, 5, 1.9f, 0.55f);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::abs(Result[i] - glm::fbm(Points[i], glm::NOISE_PERLIN, 5, 1.9f, 0.55f)) < Tolerance * 2.0f ? 0 : 1;
+
+		glm::ridgedBatch(&Points[0], &Result[0], Count, glm::NOISE_SIMPLEX, 4);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::abs(Result[i] - glm::ridged(Points[i], glm::NOISE_SIMPLEX, 4)) < Tolerance * 2.0f ? 0 : 1;
+
+		// Nothing written past Count
+		Error += Result[Count] == -42.0f ? 0 : 1;
+	}
+
+	// Lattice points, cell borders and far away points
+	std::vector<glm::vec<L, float, Q> > Special;
+	Special.push_back(glm::vec<L, float, Q>(0.0f));
+	Special.push_back(glm::vec<L, float, Q>(-1.0f));
+	Special.push_back(glm::vec<L, float, Q>(288.0f));
+	Special.push_back(glm::vec<L, float, Q>(289.0f));
+	Special.push_back(glm::vec<L, float, Q>(-289.5f));
+	Special.push_back(glm::vec<L, float, Q>(12345.25f));
+	Special.push_back(glm::vec<L, float, Q>(0.5f));
+	Special.push_back(glm::vec<L, float, Q>(-0.0f));
+	Special.push_back(glm::vec<L, float, Q>(1e-7f));
+	std::vector<float> SpecialResult(Special.size());
+
+	glm::perlinBatch(&Special[0], &SpecialResult[0], Special.size());
+	for(std::size_t i = 0; i < Special.size(); ++i)
+		Error += glm::abs(SpecialResult[i] - glm::perlin(Special[i])) < Tolerance ? 0 : 1;
+
+	glm::simplexBatch(&Special[0], &SpecialResult[0], Special.size());
+	for(std::size_t i = 0; i < Special.size(); ++i)
+		Error += glm::abs(SpecialResult[i] - glm::simplex(Special[i])) < Tolerance ? 0 : 1;
+
+	return Error;
+}
+
+template<glm::length_t L>
+static int test_image()
+{
+	int Error = 0;
+
+	std::size_t const Width = 37;
+	std::size_t const Height = 23;
+
+	glm::vec<L, float, glm::defaultp> Origin(0.25f), DeltaX(0.0f), DeltaY(0.0f);
+	Origin[0] = -3.0f;
+	DeltaX[0] = 0.173f;
+	DeltaY[1] = 0.211f;
+	DeltaX[L - 1] = 0.05f;
+
+	std::vector<float> Single(Width * Height, -42.0f), Multi(Width * Height, -42.0f);
+	glm::fbmImage(&Single[0], Width, Height, Origin, DeltaX, DeltaY, glm::NOISE_SIMPLEX, 3, 2.0f, 0.5f, 1);
+	glm::fbmImage(&Multi[0], Width, Height, Origin, DeltaX, DeltaY, glm::NOISE_SIMPLEX, 3, 2.0f, 0.5f, 4);
+
+	for(std::size_t y = 0; y < Height; ++y)
+	for(std::size_t x = 0; x < Width; ++x)
+	{
+		glm::vec<L, float, glm::defaultp> const p = Origin + DeltaX * static_cast<float>(x) + DeltaY * static_cast<float>(y);
+		Error += glm::abs(Single[y * Width + x] - glm::fbm(p, glm::NOISE_SIMPLEX, 3)) < Tolerance ? 0 : 1;
+		Error += Single[y * Width + x] == Multi[y * Width + x] ? 0 : 1;
+	}
+
+	// Wide enough for bands of a single row, more threads than bands.
+	std::size_t const WideWidth = 5000;
+	std::vector<float> Wide(WideWidth * 3);
+	glm::ridgedImage(&Wide[0], WideWidth, 3, Origin, DeltaX * 0.01f, DeltaY, glm::NOISE_PERLIN, 2, 2.0f, 0.5f, 16);
+	for(std::size_t y = 0; y < 3; ++y)
+	for(std::size_t x = 0; x < WideWidth; x += 97)
+	{
+		glm::vec<L, float, glm::defaultp> const p = Origin + (DeltaX * 0.01f) * static_cast<float>(x) + DeltaY * static_cast<float>(y);
+		Error += glm::abs(Wide[y * WideWidth + x] - glm::ridged(p, glm::NOISE_PERLIN, 2)) < Tolerance ? 0 : 1;
+	}
+
+	// Empty images don't touch the output.
+	glm::fbmImage(static_cast<float*>(NULL), 0, 10, Origin, DeltaX, DeltaY, glm::NOISE_PERLIN, 1);
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_fractal();
+
+	glm::batch_instruction_set const Best = glm::setBatchInstructionSet(glm::BATCH_AVX512);
+
+	// Run every code path the CPU can execute.
+	for(std::size_t s = 0; s < sizeof(Sets) / sizeof(Sets[0]) && Sets[s] <= Best; ++s)
+	{
+		glm::setBatchInstructionSet(Sets[s]);
+
+		int SetError = 0;
+		SetError += test_batch<2, glm::defaultp>();
+		SetError += test_batch<3, glm::defaultp>();
+		SetError += test_batch<4, glm::defaultp>();
+#		if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+			SetError += test_batch<3, glm::aligned_highp>(); // Padded to 4 floats
+#		endif
+		SetError += test_image<2>();
+		SetError += test_image<3>();
+		SetError += test_image<4>();
+
+		if(SetError != 0)
+			std::printf("instruction set %d: %d errors\n", static_cast<int>(Sets[s]), SetError);
+		Error += SetError;
+	}
+
+	glm::setBatchInstructionSet(Best);
+
+	return Error;
+}
@@ -0,0 +1,234 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/quaternion_batch.hpp>
+#include <glm/gtx/quaternion.hpp>
+#include <glm/ext/quaternion_relational.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
+#include <vector>
+#include <cstdio>
+
+// Counts that exercise the 4 and 8 wide main loops and every remainder.
+static std::size_t const Counts[] = {0, 1, 2, 3, 4, 7, 8, 9, 15, 16, 17, 33, 100};
+
+static glm::batch_instruction_set const Sets[] = {glm::BATCH_SCALAR, glm::BATCH_SSE2, glm::BATCH_AVX2, glm::BATCH_AVX512};
+
+template<typename quatType>
+static quatType make_quat(std::size_t i)
+{
+	float const f = static_cast<float>(i);
+	return quatType(glm::angleAxis(0.1f + 0.37f * f, glm::normalize(glm::vec3(1.0f, f, 2.0f))));
+}
+
+// Every fifth pair is identical or opposite, for the near parallel and the shortest path cases.
+template<typename quatType>
+static void make_pairs(std::size_t Count, std::vector<quatType>& A, std::vector<quatType>& B)
+{
+	A.resize(Count + 1);
+	B.resize(Count + 1);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		A[i] = make_quat<quatType>(i);
+		B[i] = i % 5 == 0 ? A[i] : i % 5 == 1 ? -A[i] : make_quat<quatType>(i + 100);
+	}
+}
+
+static glm::quat nlerp(glm::quat const& a, glm::quat const& b, float t)
+{
+	return glm::normalize(glm::lerp(a, glm::dot(a, b) < 0.0f ? -b : b, t));
+}
+
+template<typename quatType>
+static int test_mulBatch()
+{
+	int Error = 0;
+
+	for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+	{
+		std::size_t const Count = Counts[c];
+		std::vector<quatType> A, B, Out(Count + 1);
+		make_pairs(Count, A, B);
+
+		quatType const Sentinel(42.0f, 42.0f, 42.0f, 42.0f);
+		Out[Count] = Sentinel;
+
+		glm::mulBatch(&A[0], &B[0], &Out[0], Count);
+
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(Out[i], A[i] * B[i], 0.00001f)) ? 0 : 1;
+		Error += Out[Count] == Sentinel ? 0 : 1;
+
+		// In place
+		std::vector<quatType> InPlace(B);
+		glm::mulBatch(&A[0], &InPlace[0], &InPlace[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(InPlace[i], A[i] * B[i], 0.00001f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<typename quatType>
+static int test_interpolationBatch()
+{
+	int Error = 0;
+
+	for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+	{
+		std::size_t const Count = Counts[c];
+		std::vector<quatType> A, B, Slerp(Count + 1), SlerpEach(Count + 1), Nlerp(Count + 1), NlerpEach(Count + 1);
+		make_pairs(Count, A, B);
+		std::vector<float> T(Count + 1);
+		for(std::size_t i = 0; i < Count; ++i)
+			T[i] = static_cast<float>(i % 11) * 0.1f;
+
+		quatType const Sentinel(42.0f, 42.0f, 42.0f, 42.0f);
+		Slerp[Count] = SlerpEach[Count] = Nlerp[Count] = NlerpEach[Count] = Sentinel;
+
+		glm::slerpBatch(&A[0], &B[0], 0.3f, &Slerp[0], Count);
+		glm::slerpBatch(&A[0], &B[0], &T[0], &SlerpEach[0], Count);
+		glm::nlerpBatch(&A[0], &B[0], 0.3f, &Nlerp[0], Count);
+		glm::nlerpBatch(&A[0], &B[0], &T[0], &NlerpEach[0], Count);
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::quat const a(A[i]), b(B[i]);
+			Error += glm::all(glm::equal(glm::quat(Slerp[i]), glm::slerp(a, b, 0.3f), 0.00001f)) ? 0 : 1;
+			Error += glm::all(glm::equal(glm::quat(SlerpEach[i]), glm::slerp(a, b, T[i]), 0.00001f)) ? 0 : 1;
+			Error += glm::all(glm::equal(glm::quat(Nlerp[i]), nlerp(a, b, 0.3f), 0.00001f)) ? 0 : 1;
+			Error += glm::all(glm::equal(glm::quat(NlerpEach[i]), nlerp(a, b, T[i]), 0.00001f)) ? 0 : 1;
+		}
+		Error += Slerp[Count] == Sentinel ? 0 : 1;
+		Error += SlerpEach[Count] == Sentinel ? 0 : 1;
+		Error += Nlerp[Count] == Sentinel ? 0 : 1;
+		Error += NlerpEach[Count] == Sentinel ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<typename quatType, typename vecType, typename matType>
+static int test_mat3x4CastBatch()
+{
+	int Error = 0;
+
+	for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+	{
+		std::size_t const Count = Counts[c];
+		std::vector<quatType> In(Count + 1);
+		std::vector<vecType> Translation(Count + 1);
+		std::vector<matType> Out(Count + 1), Moved(Count + 1);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			float const f = static_cast<float>(i);
+			In[i] = make_quat<quatType>(i);
+			Translation[i] = vecType(f, -2.0f * f, 0.5f);
+		}
+
+		matType const Sentinel(42.0f);
+		Out[Count] = Moved[Count] = Sentinel;
+
+		glm::mat3x4CastBatch(&In[0], &Out[0], Count);
+		glm::mat3x4CastBatch(&In[0], &Translation[0], &Moved[0], Count);
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::mat3x4 const Expected = glm::mat3x4_cast(glm::dualquat(glm::quat(In[i]), glm::vec3(0.0f)));
+			glm::mat3x4 const ExpectedMoved = glm::mat3x4_cast(glm::dualquat(glm::quat(In[i]), glm::vec3(Translation[i])));
+			Error += glm::all(glm::equal(glm::mat3x4(Out[i]), Expected, 0.00001f)) ? 0 : 1;
+			Error += glm::all(glm::equal(glm::mat3x4(Moved[i]), ExpectedMoved, 0.0001f)) ? 0 : 1;
+		}
+		Error += glm::all(glm::equal(Out[Count], Sentinel, 0.0f)) ? 0 : 1;
+		Error += glm::all(glm::equal(Moved[Count], Sentinel, 0.0f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int test_dualQuatBlendBatch()
+{
+	int Error = 0;
+
+	std::size_t const BoneCount = 13;
+	std::vector<glm::dualquat> Bones(BoneCount);
+	for(std::size_t b = 0; b < BoneCount; ++b)
+	{
+		glm::quat const q = make_quat<glm::quat>(b * 7);
+		Bones[b] = glm::dualquat(b % 2 ? -q : q, glm::vec3(static_cast<float>(b), 1.0f, -0.5f * static_cast<float>(b)));
+	}
+
+	std::size_t const Influences[] = {1, 2, 4};
+	for(std::size_t n = 0; n < sizeof(Influences) / sizeof(Influences[0]); ++n)
+	for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+	{
+		std::size_t const Count = Counts[c];
+		std::size_t const Influence = Influences[n];
+		std::vector<glm::uint> Indices(Count * Influence + 1);
+		std::vector<float> Weights(Count * Influence + 1);
+		for(std::size_t i = 0; i < Count; ++i)
+		for(std::size_t k = 0; k < Influence; ++k)
+		{
+			Indices[i * Influence + k] = static_cast<glm::uint>((i * 3 + k * 5) % BoneCount);
+			Weights[i * Influence + k] = 1.0f / static_cast<float>(Influence) + (k == 0 ? 0.1f : -0.1f / static_cast<float>(Influence));
+		}
+
+		std::vector<glm::dualquat> Out(Count + 1);
+		glm::dualquat const Sentinel(glm::quat(42.0f, 42.0f, 42.0f, 42.0f), glm::quat(42.0f, 42.0f, 42.0f, 42.0f));
+		Out[Count] = Sentinel;
+
+		glm::dualQuatBlendBatch(&Bones[0], &Indices[0], &Weights[0], Influence, &Out[0], Count);
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::dualquat const First = Bones[Indices[i * Influence]];
+			glm::dualquat Sum(glm::quat(0.0f, 0.0f, 0.0f, 0.0f), glm::quat(0.0f, 0.0f, 0.0f, 0.0f));
+			for(std::size_t k = 0; k < Influence; ++k)
+			{
+				glm::dualquat const& Bone = Bones[Indices[i * Influence + k]];
+				float const w = Weights[i * Influence + k];
+				Sum = Sum + Bone * (glm::dot(First.real, Bone.real) < 0.0f ? -w : w);
+			}
+			glm::dualquat const Expected = glm::normalize(Sum);
+
+			Error += glm::all(glm::equal(Out[i].real, Expected.real, 0.00001f)) ? 0 : 1;
+			Error += glm::all(glm::equal(Out[i].dual, Expected.dual, 0.0001f)) ? 0 : 1;
+		}
+		Error += Out[Count].real == Sentinel.real ? 0 : 1;
+		Error += Out[Count].dual == Sentinel.dual ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	glm::batch_instruction_set const Best = glm::setBatchInstructionSet(glm::BATCH_AVX512);
+
+	// Run every code path the CPU can execute.
+	for(std::size_t s = 0; s < sizeof(Sets) / sizeof(Sets[0]) && Sets[s] <= Best; ++s)
+	{
+		glm::setBatchInstructionSet(Sets[s]);
+
+		int SetError = 0;
+		SetError += test_mulBatch<glm::quat>();
+		SetError += test_interpolationBatch<glm::quat>();
+		SetError += test_mat3x4CastBatch<glm::quat, glm::vec3, glm::mat3x4>();
+		SetError += test_dualQuatBlendBatch();
+#		if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+			typedef glm::qua<float, glm::aligned_highp> aligned_quat;
+			SetError += test_mulBatch<aligned_quat>();
+			SetError += test_interpolationBatch<aligned_quat>();
+			SetError += test_mat3x4CastBatch<aligned_quat, glm::aligned_vec3, glm::aligned_mat3x4>();
+#		endif
+
+		if(SetError != 0)
+			std::printf("instruction set %d: %d errors\n", static_cast<int>(Sets[s]), SetError);
+		Error += SetError;
+	}
+
+	return Error;
+}
@@ -0,0 +1,324 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/soa.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <vector>
+#include <cstdio>
+
+// Counts below, at and above the 16 float padding, and a few odd ones.
+static std::size_t const Counts[] = {0, 1, 3, 4, 7, 8, 15, 16, 17, 33, 100};
+
+static glm::batch_instruction_set const Sets[] = {glm::BATCH_SCALAR, glm::BATCH_SSE2, glm::BATCH_AVX2, glm::BATCH_AVX512};
+
+// A vertex like structure, to read and write vectors between other members.
+struct vertex
+{
+	glm::vec3 Position;
+	glm::vec2 TexCoord;
+	glm::vec3 Normal;
+};
+
+static glm::vec4 make_vec4(std::size_t i)
+{
+	float const f = static_cast<float>(i);
+	return glm::vec4(f * 0.5f - 3.0f, 1.0f - f * 0.25f, f * f * 0.01f + 0.5f, 2.0f - f * 0.125f);
+}
+
+static glm::mat4 make_mat4(std::size_t i)
+{
+	float const f = static_cast<float>(i);
+	glm::mat4 const R = glm::rotate(glm::mat4(1.0f), 0.3f + f * 0.1f, glm::normalize(glm::vec3(1.0f, f, 2.0f)));
+	return glm::scale(glm::translate(R, glm::vec3(f, -1.0f, 2.0f)), glm::vec3(1.0f + f * 0.01f));
+}
+
+template<glm::length_t L>
+static glm::vec<L, float, glm::defaultp> make_vec(std::size_t i)
+{
+	glm::vec4 const v = make_vec4(i);
+	glm::vec<L, float, glm::defaultp> r;
+	for(glm::length_t c = 0; c < L; ++c)
+		r[c] = v[c];
+	return r;
+}
+
+template<glm::length_t L>
+static void fill(glm::vec_soa<L>& Out, std::size_t Count, std::size_t Offset)
+{
+	Out.resize(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Out.set(i, make_vec<L>(i + Offset));
+}
+
+static int test_storage()
+{
+	int Error = 0;
+
+	glm::vec3_soa A(5);
+	Error += A.size() == 5 ? 0 : 1;
+	Error += A.capacity() % 16 == 0 && A.padded_size() == 16 ? 0 : 1;
+	for(glm::length_t c = 0; c < 3; ++c)
+		Error += reinterpret_cast<std::size_t>(A.data(c)) % 64 == 0 ? 0 : 1;
+	for(std::size_t i = 0; i < A.size(); ++i)
+		Error += A.get(i) == glm::vec3(0.0f) ? 0 : 1;
+
+	// Growing keeps the elements and zeroes the new ones, also after a shrink left old values behind.
+	for(std::size_t i = 0; i < 100; ++i)
+		A.push_back(make_vec<3>(i));
+	Error += A.size() == 105 ? 0 : 1;
+	for(std::size_t i = 0; i < 100; ++i)
+		Error += A.get(i + 5) == make_vec<3>(i) ? 0 : 1;
+	A.resize(10);
+	A.resize(20);
+	for(std::size_t i = 10; i < 20; ++i)
+		Error += A.get(i) == glm::vec3(0.0f) ? 0 : 1;
+
+	glm::vec3_soa B(A);
+	glm::vec3_soa C;
+	C = A;
+	A.set(0, glm::vec3(7.0f));
+	Error += B.size() == 20 && C.size() == 20 ? 0 : 1;
+	Error += B.get(0) == glm::vec3(0.0f) && C.get(0) == glm::vec3(0.0f) ? 0 : 1;
+	Error += B.get(6) == make_vec<3>(1) && C.get(6) == make_vec<3>(1) ? 0 : 1;
+
+	B.swap(A);
+	Error += B.get(0) == glm::vec3(7.0f) && A.get(0) == glm::vec3(0.0f) ? 0 : 1;
+
+	A.clear();
+	Error += A.empty() && A.padded_size() == 0 ? 0 : 1;
+
+	glm::mat4_soa M;
+	M.push_back(make_mat4(3));
+	M.push_back(make_mat4(4));
+	Error += M.size() == 2 && M.get(1) == make_mat4(4) ? 0 : 1;
+	Error += M.data(3, 1)[0] == make_mat4(3)[3][1] ? 0 : 1;
+
+	return Error;
+}
+
+static int test_pack()
+{
+	int Error = 0;
+
+	for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+	{
+		std::size_t const Count = Counts[c];
+
+		vertex const Sentinel = {glm::vec3(42.0f), glm::vec2(42.0f), glm::vec3(42.0f)};
+		std::vector<vertex> Vertices(Count + 1, Sentinel);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Vertices[i].Position = make_vec<3>(i);
+			Vertices[i].TexCoord = make_vec<2>(i + 1);
+			Vertices[i].Normal = make_vec<3>(i + 2);
+		}
+
+		glm::vec3_soa Positions;
+		glm::packSoA(&Vertices[0].Position, Count, Positions, sizeof(vertex));
+		Error += Positions.size() == Count ? 0 : 1;
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += Positions.get(i) == Vertices[i].Position ? 0 : 1;
+
+		// Writes the positions back into the normals, the other members stay.
+		glm::unpackSoA(Positions, &Vertices[0].Normal, sizeof(vertex));
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += Vertices[i].Normal == make_vec<3>(i) ? 0 : 1;
+			Error += Vertices[i].TexCoord == make_vec<2>(i + 1) ? 0 : 1;
+		}
+		Error += Vertices[Count].Normal == glm::vec3(42.0f) ? 0 : 1;
+
+		std::vector<glm::vec4> V(Count + 1, glm::vec4(42.0f)), W(Count + 1, glm::vec4(42.0f));
+		for(std::size_t i = 0; i < Count; ++i)
+			V[i] = make_vec4(i);
+		glm::vec4_soa S;
+		glm::packSoA(&V[0], Count, S);
+		glm::unpackSoA(S, &W[0]);
+		for(std::size_t i = 0; i <= Count; ++i)
+			Error += W[i] == V[i] ? 0 : 1;
+
+		std::vector<glm::mat4> M(Count + 1, glm::mat4(42.0f)), N(Count + 1, glm::mat4(42.0f));
+		for(std::size_t i = 0; i < Count; ++i)
+			M[i] = make_mat4(i);
+		glm::mat4_soa T;
+		glm::packSoA(&M[0], Count, T);
+		glm::unpackSoA(T, &N[0]);
+		for(std::size_t i = 0; i <= Count; ++i)
+			Error += N[i] == M[i] ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int test_transformSoA()
+{
+	int Error = 0;
+
+	glm::mat4 const M = make_mat4(7);
+
+	for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+	{
+		std::size_t const Count = Counts[c];
+
+		glm::vec3_soa P, Q;
+		glm::vec4_soa V, W;
+		glm::mat4_soa Models;
+		fill(P, Count, 0);
+		fill(V, Count, 0);
+		for(std::size_t i = 0; i < Count; ++i)
+			Models.push_back(make_mat4(i));
+
+		glm::transformSoA(M, P, Q);
+		glm::transformSoA(M, V, W);
+		Error += Q.size() == Count && W.size() == Count ? 0 : 1;
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += glm::all(glm::equal(Q.get(i), glm::vec3(M * glm::vec4(P.get(i), 1.0f)), 0.0001f)) ? 0 : 1;
+			Error += glm::all(glm::equal(W.get(i), M * V.get(i), 0.0001f)) ? 0 : 1;
+		}
+
+		glm::transformSoA(Models, P, Q);
+		glm::transformSoA(Models, V, W);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += glm::all(glm::equal(Q.get(i), glm::vec3(Models.get(i) * glm::vec4(P.get(i), 1.0f)), 0.0001f)) ? 0 : 1;
+			Error += glm::all(glm::equal(W.get(i), Models.get(i) * V.get(i), 0.0001f)) ? 0 : 1;
+		}
+
+		// In place.
+		glm::transformSoA(M, P, P);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(P.get(i), glm::vec3(M * glm::vec4(make_vec<3>(i), 1.0f)), 0.0001f)) ? 0 : 1;
+
+		glm::mat4_soa Out;
+		glm::mulSoA(M, Models, Out);
+		glm::mulSoA(M, Models, Models);
+		Error += Out.size() == Count ? 0 : 1;
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += glm::all(glm::equal(Out.get(i), M * make_mat4(i), 0.0001f)) ? 0 : 1;
+			Error += glm::all(glm::equal(Models.get(i), M * make_mat4(i), 0.0001f)) ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+template<glm::length_t L>
+static int test_geometricSoA()
+{
+	int Error = 0;
+
+	for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+	{
+		std::size_t const Count = Counts[c];
+
+		glm::vec_soa<L> A, B, N;
+		fill(A, Count, 0);
+		fill(B, Count, 50);
+
+		glm::vec1_soa D;
+		glm::dotSoA(A, B, D);
+		glm::normalizeSoA(A, N);
+		Error += D.size() == Count && N.size() == Count ? 0 : 1;
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::vec<L, double, glm::defaultp> const a(A.get(i)), b(B.get(i));
+			Error += glm::abs(D.get(i).x - glm::dot(a, b)) <= 1e-6 * glm::length(a) * glm::length(b) ? 0 : 1;
+			Error += glm::all(glm::lessThanEqual(glm::abs(glm::vec<L, double, glm::defaultp>(N.get(i)) - a / glm::length(a)), glm::vec<L, double, glm::defaultp>(1e-6))) ? 0 : 1;
+		}
+
+		glm::vec<L, float, glm::defaultp> Min(0.0f), Max(0.0f);
+		Error += glm::boundsSoA(A, Min, Max) == (Count > 0) ? 0 : 1;
+		if(Count > 0)
+		{
+			glm::vec<L, float, glm::defaultp> RefMin = A.get(0), RefMax = A.get(0);
+			for(std::size_t i = 1; i < Count; ++i)
+			{
+				RefMin = glm::min(RefMin, A.get(i));
+				RefMax = glm::max(RefMax, A.get(i));
+			}
+			Error += Min == RefMin && Max == RefMax ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+static int test_crossSoA()
+{
+	int Error = 0;
+
+	for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+	{
+		std::size_t const Count = Counts[c];
+
+		glm::vec3_soa A, B, C;
+		fill(A, Count, 0);
+		fill(B, Count, 50);
+
+		glm::crossSoA(A, B, C);
+		Error += C.size() == Count ? 0 : 1;
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::dvec3 const a(A.get(i)), b(B.get(i));
+			Error += glm::all(glm::lessThanEqual(glm::abs(glm::dvec3(C.get(i)) - glm::cross(a, b)), glm::dvec3(1e-6 * glm::length(a) * glm::length(b)))) ? 0 : 1;
+		}
+
+		glm::crossSoA(A, B, A);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(A.get(i), C.get(i), 0.0f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+// The extremes sit in the last element, past the last whole register.
+static int test_bounds_tail()
+{
+	int Error = 0;
+
+	glm::vec3_soa A(19);
+	A.set(18, glm::vec3(-5.0f, 5.0f, 0.0f));
+	glm::vec3 Min, Max;
+	glm::boundsSoA(A, Min, Max);
+	Error += Min == glm::vec3(-5.0f, 0.0f, 0.0f) && Max == glm::vec3(0.0f, 5.0f, 0.0f) ? 0 : 1;
+
+	// The padding after a shrink must not take part.
+	A.set(5, glm::vec3(100.0f, -100.0f, 7.0f));
+	A.resize(3);
+	glm::boundsSoA(A, Min, Max);
+	Error += Min == glm::vec3(0.0f) && Max == glm::vec3(0.0f) ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_storage();
+	Error += test_pack();
+
+	glm::batch_instruction_set const Best = glm::setBatchInstructionSet(glm::BATCH_AVX512);
+
+	// Run every code path the CPU can execute.
+	for(std::size_t s = 0; s < sizeof(Sets) / sizeof(Sets[0]) && Sets[s] <= Best; ++s)
+	{
+		glm::setBatchInstructionSet(Sets[s]);
+
+		int SetError = 0;
+		SetError += test_transformSoA();
+		SetError += test_geometricSoA<2>();
+		SetError += test_geometricSoA<3>();
+		SetError += test_geometricSoA<4>();
+		SetError += test_crossSoA();
+		SetError += test_bounds_tail();
+
+		if(SetError != 0)
+			std::printf("instruction set %d: %d errors\n", static_cast<int>(Sets[s]), SetError);
+		Error += SetError;
+	}
+
+	return Error;
+}
@@ -0,0 +1,85 @@
+#define GLM_FORCE_INLINE
+#include <glm/ext/matrix_float4x4.hpp>
+#include <glm/ext/matrix_clip_space.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/ext/vector_float4.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/common.hpp>
+#include <glm/geometric.hpp>
+#include <glm/matrix.hpp>
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#include <glm/gtc/type_aligned.hpp>
+#include "perf_harness.hpp"
+#include <vector>
+
+// Gribb/Hartmann plane extraction for a [0, 1] depth range: left, right, bottom, top, near, far.
+template <typename matType, typename vecType>
+static void test_extract_planes(std::vector<matType> const& I, std::vector<vecType>& O)
+{
+	for(std::size_t i = 0, n = I.size(); i < n; ++i)
+	{
+		matType const Rows = glm::transpose(I[i]);
+		vecType* const Planes = &O[i * 6];
+		Planes[0] = Rows[3] + Rows[0];
+		Planes[1] = Rows[3] - Rows[0];
+		Planes[2] = Rows[3] + Rows[1];
+		Planes[3] = Rows[3] - Rows[1];
+		Planes[4] = Rows[2];
+		Planes[5] = Rows[3] - Rows[2];
+		for(int p = 0; p < 6; ++p)
+			Planes[p] /= glm::length(glm::vec3(Planes[p]));
+	}
+}
+
+template <typename alignedMatType, typename alignedVecType>
+static int comp_frustum_planes(perf::harness& Harness, char const* Case, std::size_t Samples)
+{
+	int Error = 0;
+
+	glm::mat4 const Projection = glm::perspectiveZO(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 100.0f);
+
+	std::vector<glm::mat4> I(Samples);
+	std::vector<alignedMatType> AlignedI(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		float const f = static_cast<float>(i % 1000) + 1.0f;
+		I[i] = Projection * glm::lookAt(glm::vec3(f, 2.0f, -f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+		AlignedI[i] = alignedMatType(I[i]);
+	}
+
+	std::vector<glm::vec4> SISD(Samples * 6);
+	std::vector<alignedVecType> SIMD(Samples * 6);
+
+	Harness.run(Case, "SISD", Samples, [&]() { test_extract_planes(I, SISD); });
+	Harness.run(Case, "SIMD", Samples, [&]() { test_extract_planes(AlignedI, SIMD); });
+
+	for(std::size_t i = 0; i < Samples * 6; ++i)
+		Error += glm::all(glm::equal(SISD[i], glm::vec4(SIMD[i]), (glm::abs(SISD[i]) + 1.0f) * 0.0001f)) ? 0 : 1;
+
+	return Error;
+}
+
+int main(int argc, char* argv[])
+{
+	perf::harness Harness("perf_frustum", argc, argv);
+
+	int Error = 0;
+
+	for(std::size_t i = 0; i < Harness.sizes().size(); ++i)
+	{
+		std::size_t const Samples = Harness.sizes()[i];
+
+		Error += comp_frustum_planes<glm::aligned_mat4, glm::aligned_vec4>(Harness, "frustum planes", Samples);
+	}
+
+	return Harness.finish(Error);
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
@@ -0,0 +1,315 @@
+/// @ref perf
+/// @file test/perf/perf_harness.hpp
+///
+/// Benchmark harness shared by the perf_* programs.
+///
+/// Every measurement runs a number of untimed warmup passes followed by timed repetitions.
+/// The harness reports the median and the median absolute deviation (MAD) of the repetitions,
+/// the cycles spent per element (time stamp counter cycles, x86 only) and the speedup of each
+/// variant against the first variant measured for the same case and sample size.
+///
+/// Options, given on the command line or through the matching environment variable:
+/// --samples=N[,N...]  GLM_PERF_SAMPLES      Sample sizes each case is measured with
+/// --warmup=N          GLM_PERF_WARMUP       Untimed passes before measuring
+/// --repetitions=N     GLM_PERF_REPETITIONS  Timed passes
+/// --format=F          GLM_PERF_FORMAT       text, json or csv
+/// --output=FILE       GLM_PERF_OUTPUT_DIR   Where json/csv results go; the environment variable names
+///                                           a directory receiving <suite>.json or <suite>.csv
+///
+/// Without an output file, json and csv go to stdout and the human readable lines to stderr.
+
+#pragma once
+
+#include <glm/detail/setup.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#	include <intrin.h>
+#	define GLM_PERF_HAS_TSC 1
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#	include <x86intrin.h>
+#	define GLM_PERF_HAS_TSC 1
+#else
+#	define GLM_PERF_HAS_TSC 0
+#endif
+
+namespace perf
+{
+	enum format
+	{
+		FORMAT_TEXT,
+		FORMAT_JSON,
+		FORMAT_CSV
+	};
+
+	struct result
+	{
+		std::string Case;
+		std::string Variant;
+		std::size_t Elements;
+		double MedianUs;
+		double MadUs;
+		double MinUs;
+		double CyclesPerElement; // Negative when no cycle counter is available
+		double Speedup;
+	};
+
+	inline char const* simd_name()
+	{
+#		if GLM_ARCH & GLM_ARCH_AVX512_BIT
+			return "AVX-512";
+#		elif GLM_ARCH & GLM_ARCH_AVX2_BIT
+			return "AVX2";
+#		elif GLM_ARCH & GLM_ARCH_AVX_BIT
+			return "AVX";
+#		elif GLM_ARCH & GLM_ARCH_SSE42_BIT
+			return "SSE4.2";
+#		elif GLM_ARCH & GLM_ARCH_SSE41_BIT
+			return "SSE4.1";
+#		elif GLM_ARCH & GLM_ARCH_SSSE3_BIT
+			return "SSSE3";
+#		elif GLM_ARCH & GLM_ARCH_SSE3_BIT
+			return "SSE3";
+#		elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+			return "SSE2";
+#		elif GLM_ARCH & GLM_ARCH_NEON_BIT
+			return "NEON";
+#		else
+			return "none";
+#		endif
+	}
+
+	inline unsigned long long cycles()
+	{
+#		if GLM_PERF_HAS_TSC
+			return static_cast<unsigned long long>(__rdtsc());
+#		else
+			return 0;
+#		endif
+	}
+
+	inline double median(std::vector<double> Values)
+	{
+		std::sort(Values.begin(), Values.end());
+		std::size_t const Half = Values.size() / 2;
+		return Values.size() % 2 ? Values[Half] : (Values[Half - 1] + Values[Half]) * 0.5;
+	}
+
+	class harness
+	{
+	public:
+		harness(char const* Suite, int argc, char* argv[]) :
+			Suite(Suite),
+			Warmup(1),
+			Repetitions(5),
+			Format(FORMAT_TEXT),
+			Log(stdout)
+		{
+			read_option("GLM_PERF_SAMPLES", argc, argv, "--samples=");
+			read_option("GLM_PERF_WARMUP", argc, argv, "--warmup=");
+			read_option("GLM_PERF_REPETITIONS", argc, argv, "--repetitions=");
+			read_option("GLM_PERF_FORMAT", argc, argv, "--format=");
+			read_option(NULL, argc, argv, "--output=");
+
+			if(Sizes.empty())
+				Sizes.push_back(100000);
+			if(Output.empty() && Format != FORMAT_TEXT)
+			{
+				char const* Dir = std::getenv("GLM_PERF_OUTPUT_DIR");
+				if(Dir && *Dir)
+					Output = std::string(Dir) + "/" + Suite + (Format == FORMAT_JSON ? ".json" : ".csv");
+			}
+
+			Log = Format == FORMAT_TEXT || !Output.empty() ? stdout : stderr;
+			std::fprintf(Log, "%s: SIMD %s, %d warmup, %d repetitions\n", Suite, simd_name(), Warmup, Repetitions);
+		}
+
+		std::vector<std::size_t> const& sizes() const { return Sizes; }
+
+		// Measures Func, which processes Elements elements per call, and prints one line for it.
+		template <typename funcType>
+		result const& run(char const* Case, char const* Variant, std::size_t Elements, funcType Func)
+		{
+			for(int i = 0; i < Warmup; ++i)
+				Func();
+
+			std::vector<double> Times(static_cast<std::size_t>(Repetitions));
+			std::vector<double> Cycles(static_cast<std::size_t>(Repetitions));
+			for(int i = 0; i < Repetitions; ++i)
+			{
+				std::chrono::steady_clock::time_point const t0 = std::chrono::steady_clock::now();
+				unsigned long long const c0 = cycles();
+				Func();
+				unsigned long long const c1 = cycles();
+				std::chrono::steady_clock::time_point const t1 = std::chrono::steady_clock::now();
+
+				Times[i] = std::chrono::duration<double, std::micro>(t1 - t0).count();
+				Cycles[i] = static_cast<double>(c1 - c0);
+			}
+
+			result Result;
+			Result.Case = Case;
+			Result.Variant = Variant;
+			Result.Elements = Elements;
+			Result.MedianUs = median(Times);
+			Result.MinUs = *std::min_element(Times.begin(), Times.end());
+			std::vector<double> Deviations(Times.size());
+			for(std::size_t i = 0; i < Times.size(); ++i)
+				Deviations[i] = Times[i] > Result.MedianUs ? Times[i] - Result.MedianUs : Result.MedianUs - Times[i];
+			Result.MadUs = median(Deviations);
+			Result.CyclesPerElement = GLM_PERF_HAS_TSC && Elements > 0 ? median(Cycles) / static_cast<double>(Elements) : -1.0;
+			Result.Speedup = 1.0;
+
+			result const* Baseline = NULL;
+			for(std::size_t i = 0; i < Results.size() && !Baseline; ++i)
+				if(Results[i].Case == Result.Case && Results[i].Elements == Elements)
+					Baseline = &Results[i];
+			if(Baseline && Result.MedianUs > 0.0)
+				Result.Speedup = Baseline->MedianUs / Result.MedianUs;
+			if(!Baseline)
+				std::fprintf(Log, "%s (%d elements):\n", Case, static_cast<int>(Elements));
+
+			std::fprintf(Log, "- %s: %.1f us (MAD %.1f us)", Variant, Result.MedianUs, Result.MadUs);
+			if(Result.CyclesPerElement >= 0.0)
+				std::fprintf(Log, ", %.2f cycles/element", Result.CyclesPerElement);
+			if(Baseline)
+				std::fprintf(Log, ", %.2fx", Result.Speedup);
+			std::fprintf(Log, "\n");
+
+			Results.push_back(Result);
+			return Results.back();
+		}
+
+		// Prints the bandwidth of a measurement, given the bytes one call reads and writes.
+		void bandwidth(result const& Result, std::size_t Bytes) const
+		{
+			if(Result.MedianUs > 0.0)
+				std::fprintf(Log, "  %.2f GB/s\n", static_cast<double>(Bytes) / (Result.MedianUs * 1000.0));
+		}
+
+		// Prints the number of elements a measurement processes per second, e.g. noise samples.
+		void throughput(result const& Result, char const* Unit) const
+		{
+			if(Result.MedianUs > 0.0)
+				std::fprintf(Log, "  %.2f M%s/s\n", static_cast<double>(Result.Elements) / Result.MedianUs, Unit);
+		}
+
+		// Writes the json/csv report and returns Error so main can end with 'return Harness.finish(Error);'
+		int finish(int Error) const
+		{
+			if(Format == FORMAT_TEXT)
+				return Error;
+
+			std::FILE* File = Output.empty() ? stdout : std::fopen(Output.c_str(), "w");
+			if(!File)
+			{
+				std::fprintf(stderr, "%s: can't open %s\n", Suite, Output.c_str());
+				return Error + 1;
+			}
+
+			if(Format == FORMAT_JSON)
+				write_json(File);
+			else
+				write_csv(File);
+
+			if(File != stdout)
+				std::fclose(File);
+			return Error;
+		}
+
+	private:
+		void read_option(char const* Env, int argc, char* argv[], char const* Flag)
+		{
+			char const* Value = Env ? std::getenv(Env) : NULL;
+			std::size_t const Length = std::strlen(Flag);
+			for(int i = 1; i < argc; ++i)
+				if(std::strncmp(argv[i], Flag, Length) == 0)
+					Value = argv[i] + Length;
+			if(!Value || !*Value)
+				return;
+
+			if(std::strcmp(Flag, "--samples=") == 0)
+			{
+				Sizes.clear();
+				for(char const* p = Value; *p; )
+				{
+					char* End = NULL;
+					unsigned long const Size = std::strtoul(p, &End, 10);
+					if(End == p)
+						break;
+					if(Size > 0)
+						Sizes.push_back(static_cast<std::size_t>(Size));
+					p = *End == ',' ? End + 1 : End;
+				}
+			}
+			else if(std::strcmp(Flag, "--warmup=") == 0)
+				Warmup = std::max(0, std::atoi(Value));
+			else if(std::strcmp(Flag, "--repetitions=") == 0)
+				Repetitions = std::max(1, std::atoi(Value));
+			else if(std::strcmp(Flag, "--format=") == 0)
+				Format = std::strcmp(Value, "json") == 0 ? FORMAT_JSON : std::strcmp(Value, "csv") == 0 ? FORMAT_CSV : FORMAT_TEXT;
+			else if(std::strcmp(Flag, "--output=") == 0)
+				Output = Value;
+		}
+
+		static void write_number(std::FILE* File, double Value)
+		{
+			if(Value < 0.0)
+				std::fprintf(File, "null");
+			else
+				std::fprintf(File, "%.4f", Value);
+		}
+
+		void write_json(std::FILE* File) const
+		{
+			std::fprintf(File, "{\n\t\"suite\": \"%s\",\n\t\"simd\": \"%s\",\n\t\"warmup\": %d,\n\t\"repetitions\": %d,\n\t\"results\": [",
+				Suite, simd_name(), Warmup, Repetitions);
+			for(std::size_t i = 0; i < Results.size(); ++i)
+			{
+				result const& R = Results[i];
+				std::fprintf(File, "%s\n\t\t{\"case\": \"%s\", \"variant\": \"%s\", \"elements\": %lu, \"median_us\": ",
+					i ? "," : "", R.Case.c_str(), R.Variant.c_str(), static_cast<unsigned long>(R.Elements));
+				write_number(File, R.MedianUs);
+				std::fprintf(File, ", \"mad_us\": ");
+				write_number(File, R.MadUs);
+				std::fprintf(File, ", \"min_us\": ");
+				write_number(File, R.MinUs);
+				std::fprintf(File, ", \"cycles_per_element\": ");
+				write_number(File, R.CyclesPerElement);
+				std::fprintf(File, ", \"speedup\": ");
+				write_number(File, R.Speedup);
+				std::fprintf(File, "}");
+			}
+			std::fprintf(File, "\n\t]\n}\n");
+		}
+
+		void write_csv(std::FILE* File) const
+		{
+			std::fprintf(File, "suite,simd,case,variant,elements,median_us,mad_us,min_us,cycles_per_element,speedup\n");
+			for(std::size_t i = 0; i < Results.size(); ++i)
+			{
+				result const& R = Results[i];
+				std::fprintf(File, "%s,%s,\"%s\",%s,%lu,%.4f,%.4f,%.4f,", Suite, simd_name(), R.Case.c_str(), R.Variant.c_str(),
+					static_cast<unsigned long>(R.Elements), R.MedianUs, R.MadUs, R.MinUs);
+				if(R.CyclesPerElement >= 0.0)
+					std::fprintf(File, "%.4f", R.CyclesPerElement);
+				std::fprintf(File, ",%.4f\n", R.Speedup);
+			}
+		}
+
+		char const* Suite;
+		std::vector<std::size_t> Sizes;
+		int Warmup;
+		int Repetitions;
+		format Format;
+		std::string Output;
+		std::FILE* Log;
+		std::vector<result> Results;
+	};
+}//namespace perf
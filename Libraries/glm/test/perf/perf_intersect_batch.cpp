@@ -0,0 +1,220 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/intersect_batch.hpp>
+#include <glm/ext/matrix_clip_space.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#include "perf_harness.hpp"
+#include <vector>
+
+// The intersection kernels use AVX2 when AVX-512 is requested, so they are measured up to AVX2.
+static char const* const VariantNames[] = {"SoA scalar", "SoA SSE2", "SoA AVX2"};
+
+// Objects scattered around the frustum, roughly a third of them visible.
+static glm::vec3 make_vec3(std::size_t i)
+{
+	float const f = static_cast<float>(i % 1009);
+	return glm::vec3(glm::sin(f * 1.3f) * 40.0f, glm::cos(f * 0.7f) * 20.0f, glm::sin(f * 2.9f) * 40.0f);
+}
+
+static void make_planes(glm::vec4 Planes[6])
+{
+	glm::mat4 const View = glm::lookAt(glm::vec3(0.0f, 5.0f, 30.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+	glm::frustumPlanesZO(glm::perspectiveZO(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 100.0f) * View, Planes);
+}
+
+static int comp_sphere_frustum(perf::harness& Harness, char const* Case, std::size_t Samples, glm::batch_instruction_set Best)
+{
+	int Error = 0;
+
+	glm::vec4 Planes[6];
+	make_planes(Planes);
+
+	std::vector<glm::vec3> Centers(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+		Centers[i] = make_vec3(i);
+
+	std::vector<unsigned int> AoS(Samples), SoA(Samples);
+	std::size_t AoSCount = 0;
+	Harness.run(Case, "AoS vec3", Samples, [&]()
+	{
+		AoSCount = 0;
+		for(std::size_t i = 0; i < Samples; ++i)
+			if(glm::intersectSphereFrustum(Centers[i], 1.5f, Planes))
+				AoS[AoSCount++] = static_cast<unsigned int>(i);
+	});
+
+	glm::vec3_soa SoACenters;
+	glm::packSoA(&Centers[0], Samples, SoACenters);
+	for(int Set = glm::BATCH_SCALAR; Set <= Best; ++Set)
+	{
+		std::size_t SoACount = 0;
+		glm::setBatchInstructionSet(static_cast<glm::batch_instruction_set>(Set));
+		Harness.run(Case, VariantNames[Set], Samples, [&]() { SoACount = glm::intersectSphereFrustumBatch(Planes, SoACenters, 1.5f, &SoA[0]); });
+		Error += SoACount == AoSCount && std::equal(AoS.begin(), AoS.begin() + AoSCount, SoA.begin()) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int comp_aabb_frustum(perf::harness& Harness, char const* Case, std::size_t Samples, glm::batch_instruction_set Best)
+{
+	int Error = 0;
+
+	glm::vec4 Planes[6];
+	make_planes(Planes);
+
+	std::vector<glm::vec3> Min(Samples), Max(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		Min[i] = make_vec3(i) - 1.0f;
+		Max[i] = make_vec3(i) + glm::vec3(1.0f, 2.0f, 0.5f);
+	}
+
+	std::vector<unsigned int> AoS(Samples), SoA(Samples);
+	std::size_t AoSCount = 0;
+	Harness.run(Case, "AoS vec3", Samples, [&]()
+	{
+		AoSCount = 0;
+		for(std::size_t i = 0; i < Samples; ++i)
+			if(glm::intersectAABBFrustum(Min[i], Max[i], Planes))
+				AoS[AoSCount++] = static_cast<unsigned int>(i);
+	});
+
+	glm::vec3_soa SoAMin, SoAMax;
+	glm::packSoA(&Min[0], Samples, SoAMin);
+	glm::packSoA(&Max[0], Samples, SoAMax);
+	for(int Set = glm::BATCH_SCALAR; Set <= Best; ++Set)
+	{
+		std::size_t SoACount = 0;
+		glm::setBatchInstructionSet(static_cast<glm::batch_instruction_set>(Set));
+		Harness.run(Case, VariantNames[Set], Samples, [&]() { SoACount = glm::intersectAABBFrustumBatch(Planes, SoAMin, SoAMax, &SoA[0]); });
+		Error += SoACount == AoSCount && std::equal(AoS.begin(), AoS.begin() + AoSCount, SoA.begin()) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+// Picking: the closest object under the cursor.
+static int comp_ray_sphere(perf::harness& Harness, char const* Case, std::size_t Samples, glm::batch_instruction_set Best)
+{
+	int Error = 0;
+
+	std::vector<glm::vec3> Centers(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+		Centers[i] = make_vec3(i);
+
+	glm::vec3 const Orig(0.0f, 5.0f, 30.0f);
+	glm::vec3 const Dir = glm::normalize(Centers[Samples / 2] - Orig);
+
+	std::size_t AoSIndex = 0;
+	float AoSDistance = 0.0f;
+	Harness.run(Case, "AoS vec3", Samples, [&]()
+	{
+		bool Hit = false;
+		for(std::size_t i = 0; i < Samples; ++i)
+		{
+			float t = 0.0f;
+			if(glm::intersectRaySphere(Orig, Dir, Centers[i], 1.5f * 1.5f, t) && (!Hit || t < AoSDistance))
+			{
+				Hit = true;
+				AoSIndex = i;
+				AoSDistance = t;
+			}
+		}
+	});
+
+	glm::vec3_soa SoACenters;
+	glm::packSoA(&Centers[0], Samples, SoACenters);
+	for(int Set = glm::BATCH_SCALAR; Set <= Best; ++Set)
+	{
+		std::size_t Index = 0;
+		float Distance = 0.0f;
+		glm::setBatchInstructionSet(static_cast<glm::batch_instruction_set>(Set));
+		Harness.run(Case, VariantNames[Set], Samples, [&]() { glm::intersectRaySphereBatch(Orig, Dir, SoACenters, 1.5f, Index, Distance); });
+		Error += Index == AoSIndex && glm::abs(Distance - AoSDistance) <= 0.001f ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int comp_ray_triangle(perf::harness& Harness, char const* Case, std::size_t Samples, glm::batch_instruction_set Best)
+{
+	int Error = 0;
+
+	std::vector<glm::vec3> V0(Samples), V1(Samples), V2(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		V0[i] = make_vec3(i);
+		V1[i] = V0[i] + glm::vec3(2.0f, 0.5f, 0.0f);
+		V2[i] = V0[i] + glm::vec3(0.5f, 2.0f, 1.0f);
+	}
+
+	glm::vec3 const Orig(0.0f, 5.0f, 30.0f);
+	glm::vec3 const Dir = glm::normalize((V0[Samples / 2] + V1[Samples / 2] + V2[Samples / 2]) / 3.0f - Orig);
+
+	std::size_t AoSIndex = 0;
+	float AoSDistance = 0.0f;
+	Harness.run(Case, "AoS vec3", Samples, [&]()
+	{
+		bool Hit = false;
+		for(std::size_t i = 0; i < Samples; ++i)
+		{
+			glm::vec2 Bary(0.0f);
+			float t = 0.0f;
+			if(glm::intersectRayTriangleWatertight(Orig, Dir, V0[i], V1[i], V2[i], Bary, t) && (!Hit || t < AoSDistance))
+			{
+				Hit = true;
+				AoSIndex = i;
+				AoSDistance = t;
+			}
+		}
+	});
+
+	glm::vec3_soa SoAV0, SoAV1, SoAV2;
+	glm::packSoA(&V0[0], Samples, SoAV0);
+	glm::packSoA(&V1[0], Samples, SoAV1);
+	glm::packSoA(&V2[0], Samples, SoAV2);
+	for(int Set = glm::BATCH_SCALAR; Set <= Best; ++Set)
+	{
+		std::size_t Index = 0;
+		glm::vec2 Bary(0.0f);
+		float Distance = 0.0f;
+		glm::setBatchInstructionSet(static_cast<glm::batch_instruction_set>(Set));
+		Harness.run(Case, VariantNames[Set], Samples, [&]() { glm::intersectRayTriangleBatch(Orig, Dir, SoAV0, SoAV1, SoAV2, Index, Bary, Distance); });
+		Error += Index == AoSIndex && glm::abs(Distance - AoSDistance) <= 0.001f ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int main(int argc, char* argv[])
+{
+	perf::harness Harness("perf_intersect_batch", argc, argv);
+
+	int Error = 0;
+
+	glm::batch_instruction_set const Supported = glm::setBatchInstructionSet(glm::BATCH_AVX512);
+	glm::batch_instruction_set const Best = Supported < glm::BATCH_AVX2 ? Supported : glm::BATCH_AVX2;
+
+	for(std::size_t i = 0; i < Harness.sizes().size(); ++i)
+	{
+		std::size_t const Samples = Harness.sizes()[i];
+
+		Error += comp_sphere_frustum(Harness, "sphere vs frustum", Samples, Best);
+		Error += comp_aabb_frustum(Harness, "AABB vs frustum", Samples, Best);
+		Error += comp_ray_sphere(Harness, "ray vs spheres, closest", Samples, Best);
+		Error += comp_ray_triangle(Harness, "ray vs triangles, closest", Samples, Best);
+	}
+
+	return Harness.finish(Error);
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
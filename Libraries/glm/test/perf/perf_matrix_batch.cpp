@@ -0,0 +1,162 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/matrix_batch.hpp>
+#include <glm/ext/matrix_float4x4.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#include <glm/gtc/type_aligned.hpp>
+#include "perf_harness.hpp"
+#include <vector>
+
+static char const* const VariantNames[] = {"batch scalar", "batch SSE2", "batch AVX2", "batch AVX-512"};
+
+template <typename matType>
+static void fill(std::vector<matType>& M, std::size_t Samples)
+{
+	M.resize(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		float const f = static_cast<float>(i % 1000) * 0.01f;
+		M[i] = matType(
+			2.0f + f, 0.1f, 0.2f, 0.0f,
+			0.3f, 3.0f - f, 0.4f, 0.0f,
+			0.5f, 0.6f, 4.0f, 0.0f,
+			f, -f, 1.0f, 1.0f);
+	}
+}
+
+static int comp_mat4_mul_mat4(perf::harness& Harness, char const* Case, std::size_t Samples, glm::batch_instruction_set Best)
+{
+	int Error = 0;
+
+	std::vector<glm::mat4> A, B, SISD(Samples), Batch(Samples);
+	std::vector<glm::aligned_mat4> AlignedA, AlignedB, SIMD(Samples);
+	fill(A, Samples); fill(B, Samples);
+	fill(AlignedA, Samples); fill(AlignedB, Samples);
+
+	Harness.run(Case, "SISD", Samples, [&]()
+	{
+		for(std::size_t i = 0; i < Samples; ++i)
+			SISD[i] = A[i] * B[i];
+	});
+	Harness.run(Case, "SIMD", Samples, [&]()
+	{
+		for(std::size_t i = 0; i < Samples; ++i)
+			SIMD[i] = AlignedA[i] * AlignedB[i];
+	});
+
+	for(int Set = glm::BATCH_SCALAR; Set <= Best; ++Set)
+	{
+		glm::setBatchInstructionSet(static_cast<glm::batch_instruction_set>(Set));
+		Harness.run(Case, VariantNames[Set], Samples, [&]() { glm::mulBatch(&A[0], &B[0], &Batch[0], Samples); });
+
+		for(std::size_t i = 0; i < Samples; ++i)
+			Error += glm::all(glm::equal(SISD[i], Batch[i], 0.001f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int comp_mat4_inverse(perf::harness& Harness, char const* Case, std::size_t Samples, glm::batch_instruction_set Best)
+{
+	int Error = 0;
+
+	std::vector<glm::mat4> I, SISD(Samples), Batch(Samples);
+	std::vector<glm::aligned_mat4> AlignedI, SIMD(Samples);
+	fill(I, Samples);
+	fill(AlignedI, Samples);
+
+	Harness.run(Case, "SISD", Samples, [&]()
+	{
+		for(std::size_t i = 0; i < Samples; ++i)
+			SISD[i] = glm::inverse(I[i]);
+	});
+	Harness.run(Case, "SIMD", Samples, [&]()
+	{
+		for(std::size_t i = 0; i < Samples; ++i)
+			SIMD[i] = glm::inverse(AlignedI[i]);
+	});
+
+	for(int Set = glm::BATCH_SCALAR; Set <= Best; ++Set)
+	{
+		glm::setBatchInstructionSet(static_cast<glm::batch_instruction_set>(Set));
+		Harness.run(Case, VariantNames[Set], Samples, [&]() { glm::inverseBatch(&I[0], &Batch[0], Samples); });
+
+		for(std::size_t i = 0; i < Samples; ++i)
+			Error += glm::all(glm::equal(SISD[i], Batch[i], 0.001f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int comp_mat4_mul_vec4(perf::harness& Harness, char const* Case, std::size_t Samples, glm::batch_instruction_set Best)
+{
+	int Error = 0;
+
+	glm::mat4 const Transform(
+		1.0f, 0.1f, 0.2f, 0.0f,
+		0.3f, 1.0f, 0.4f, 0.0f,
+		0.5f, 0.6f, 1.0f, 0.0f,
+		7.0f, 8.0f, 9.0f, 1.0f);
+	glm::aligned_mat4 const AlignedTransform(Transform);
+
+	std::vector<glm::vec4> I(Samples), SISD(Samples), Batch(Samples);
+	std::vector<glm::aligned_vec4> AlignedI(Samples), SIMD(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		I[i] = glm::vec4(static_cast<float>(i % 1000), 1.0f, -2.0f, 1.0f);
+		AlignedI[i] = glm::aligned_vec4(I[i]);
+	}
+
+	Harness.run(Case, "SISD", Samples, [&]()
+	{
+		for(std::size_t i = 0; i < Samples; ++i)
+			SISD[i] = Transform * I[i];
+	});
+	Harness.run(Case, "SIMD", Samples, [&]()
+	{
+		for(std::size_t i = 0; i < Samples; ++i)
+			SIMD[i] = AlignedTransform * AlignedI[i];
+	});
+
+	for(int Set = glm::BATCH_SCALAR; Set <= Best; ++Set)
+	{
+		glm::setBatchInstructionSet(static_cast<glm::batch_instruction_set>(Set));
+		Harness.run(Case, VariantNames[Set], Samples, [&]() { glm::transformBatch(Transform, &I[0], &Batch[0], Samples); });
+
+		for(std::size_t i = 0; i < Samples; ++i)
+			Error += glm::all(glm::equal(SISD[i], Batch[i], 0.001f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int main(int argc, char* argv[])
+{
+	perf::harness Harness("perf_matrix_batch", argc, argv);
+
+	int Error = 0;
+
+	glm::batch_instruction_set const Best = glm::setBatchInstructionSet(glm::BATCH_AVX512);
+
+	for(std::size_t i = 0; i < Harness.sizes().size(); ++i)
+	{
+		std::size_t const Samples = Harness.sizes()[i];
+
+		Error += comp_mat4_mul_mat4(Harness, "mat4 * mat4", Samples, Best);
+		Error += comp_mat4_inverse(Harness, "inverse(mat4)", Samples, Best);
+		Error += comp_mat4_mul_vec4(Harness, "mat4 * vec4", Samples, Best);
+	}
+
+	return Harness.finish(Error);
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
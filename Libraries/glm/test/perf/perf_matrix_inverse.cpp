@@ -6,9 +6,8 @@
 #include <glm/ext/vector_float4.hpp>
 #if GLM_CONFIG_SIMD == GLM_ENABLE
 #include <glm/gtc/type_aligned.hpp>
+#include "perf_harness.hpp"
 #include <vector>
-#include <chrono>
-#include <cstdio>
 
 template <typename matType>
 static void test_mat_inverse(std::vector<matType> const& I, std::vector<matType>& O)
@@ -18,7 +17,7 @@ static void test_mat_inverse(std::vector<matType> const& I, std::vector<matType>
 }
 
 template <typename matType>
-static int launch_mat_inverse(std::vector<matType>& O, matType const& Scale, std::size_t Samples)
+static void launch_mat_inverse(perf::harness& Harness, char const* Case, char const* Variant, std::vector<matType>& O, matType const& Scale, std::size_t Samples)
 {
 	typedef typename matType::value_type T;
 
@@ -28,15 +27,11 @@ static int launch_mat_inverse(std::vector<matType>& O, matType const& Scale, std
 	for(std::size_t i = 0; i < Samples; ++i)
 		I[i] = Scale * static_cast<T>(i) + Scale;
 
-	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
-	test_mat_inverse<matType>(I, O);
-	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
-
-	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+	Harness.run(Case, Variant, Samples, [&]() { test_mat_inverse<matType>(I, O); });
 }
 
 template <typename packedMatType, typename alignedMatType>
-static int comp_mat2_inverse(std::size_t Samples)
+static int comp_mat2_inverse(perf::harness& Harness, char const* Case, std::size_t Samples)
 {
 	typedef typename packedMatType::value_type T;
 	
@@ -45,10 +40,10 @@ static int comp_mat2_inverse(std::size_t Samples)
 	packedMatType const Scale(0.01, 0.02, 0.03, 0.05);
 
 	std::vector<packedMatType> SISD;
-	printf("- SISD: %d us\n", launch_mat_inverse<packedMatType>(SISD, Scale, Samples));
+	launch_mat_inverse<packedMatType>(Harness, Case, "SISD", SISD, Scale, Samples);
 
 	std::vector<alignedMatType> SIMD;
-	printf("- SIMD: %d us\n", launch_mat_inverse<alignedMatType>(SIMD, Scale, Samples));
+	launch_mat_inverse<alignedMatType>(Harness, Case, "SIMD", SIMD, Scale, Samples);
 
 	for(std::size_t i = 0; i < Samples; ++i)
 	{
@@ -62,7 +57,7 @@ static int comp_mat2_inverse(std::size_t Samples)
 }
 
 template <typename packedMatType, typename alignedMatType>
-static int comp_mat3_inverse(std::size_t Samples)
+static int comp_mat3_inverse(perf::harness& Harness, char const* Case, std::size_t Samples)
 {
 	typedef typename packedMatType::value_type T;
 	
@@ -71,10 +66,10 @@ static int comp_mat3_inverse(std::size_t Samples)
 	packedMatType const Scale(0.01, 0.02, 0.03, 0.05, 0.01, 0.02, 0.03, 0.05, 0.01);
 
 	std::vector<packedMatType> SISD;
-	printf("- SISD: %d us\n", launch_mat_inverse<packedMatType>(SISD, Scale, Samples));
+	launch_mat_inverse<packedMatType>(Harness, Case, "SISD", SISD, Scale, Samples);
 
 	std::vector<alignedMatType> SIMD;
-	printf("- SIMD: %d us\n", launch_mat_inverse<alignedMatType>(SIMD, Scale, Samples));
+	launch_mat_inverse<alignedMatType>(Harness, Case, "SIMD", SIMD, Scale, Samples);
 
 	for(std::size_t i = 0; i < Samples; ++i)
 	{
@@ -88,7 +83,7 @@ static int comp_mat3_inverse(std::size_t Samples)
 }
 
 template <typename packedMatType, typename alignedMatType>
-static int comp_mat4_inverse(std::size_t Samples)
+static int comp_mat4_inverse(perf::harness& Harness, char const* Case, std::size_t Samples)
 {
 	typedef typename packedMatType::value_type T;
 	
@@ -97,10 +92,10 @@ static int comp_mat4_inverse(std::size_t Samples)
 	packedMatType const Scale(0.01, 0.02, 0.05, 0.04, 0.02, 0.08, 0.05, 0.01, 0.08, 0.03, 0.05, 0.06, 0.02, 0.03, 0.07, 0.05);
 
 	std::vector<packedMatType> SISD;
-	printf("- SISD: %d us\n", launch_mat_inverse<packedMatType>(SISD, Scale, Samples));
+	launch_mat_inverse<packedMatType>(Harness, Case, "SISD", SISD, Scale, Samples);
 
 	std::vector<alignedMatType> SIMD;
-	printf("- SIMD: %d us\n", launch_mat_inverse<alignedMatType>(SIMD, Scale, Samples));
+	launch_mat_inverse<alignedMatType>(Harness, Case, "SIMD", SIMD, Scale, Samples);
 
 	for(std::size_t i = 0; i < Samples; ++i)
 	{
@@ -113,31 +108,25 @@ static int comp_mat4_inverse(std::size_t Samples)
 	return Error;
 }
 
-int main()
+int main(int argc, char* argv[])
 {
-	std::size_t const Samples = 100000;
+	perf::harness Harness("perf_matrix_inverse", argc, argv);
 
 	int Error = 0;
 
-	printf("glm::inverse(mat2):\n");
-	Error += comp_mat2_inverse<glm::mat2, glm::aligned_mat2>(Samples);
-	
-	printf("glm::inverse(dmat2):\n");
-	Error += comp_mat2_inverse<glm::dmat2, glm::aligned_dmat2>(Samples);
-
-	printf("glm::inverse(mat3):\n");
-	Error += comp_mat3_inverse<glm::mat3, glm::aligned_mat3>(Samples);
-	
-	printf("glm::inverse(dmat3):\n");
-	Error += comp_mat3_inverse<glm::dmat3, glm::aligned_dmat3>(Samples);
-
-	printf("glm::inverse(mat4):\n");
-	Error += comp_mat4_inverse<glm::mat4, glm::aligned_mat4>(Samples);
-	
-	printf("glm::inverse(dmat4):\n");
-	Error += comp_mat4_inverse<glm::dmat4, glm::aligned_dmat4>(Samples);
+	for(std::size_t i = 0; i < Harness.sizes().size(); ++i)
+	{
+		std::size_t const Samples = Harness.sizes()[i];
+
+		Error += comp_mat2_inverse<glm::mat2, glm::aligned_mat2>(Harness, "glm::inverse(mat2)", Samples);
+		Error += comp_mat2_inverse<glm::dmat2, glm::aligned_dmat2>(Harness, "glm::inverse(dmat2)", Samples);
+		Error += comp_mat3_inverse<glm::mat3, glm::aligned_mat3>(Harness, "glm::inverse(mat3)", Samples);
+		Error += comp_mat3_inverse<glm::dmat3, glm::aligned_dmat3>(Harness, "glm::inverse(dmat3)", Samples);
+		Error += comp_mat4_inverse<glm::mat4, glm::aligned_mat4>(Harness, "glm::inverse(mat4)", Samples);
+		Error += comp_mat4_inverse<glm::dmat4, glm::aligned_dmat4>(Harness, "glm::inverse(dmat4)", Samples);
+	}
 
-	return Error;
+	return Harness.finish(Error);
 }
 
 #else
@@ -10,9 +10,8 @@
 #include <glm/ext/vector_float4.hpp>
 #if GLM_CONFIG_SIMD == GLM_ENABLE
 #include <glm/gtc/type_aligned.hpp>
+#include "perf_harness.hpp"
 #include <vector>
-#include <chrono>
-#include <cstdio>
 
 template <typename matType>
 static void test_mat_mul_mat(matType const& M, std::vector<matType> const& I, std::vector<matType>& O)
@@ -22,7 +21,7 @@ static void test_mat_mul_mat(matType const& M, std::vector<matType> const& I, st
 }
 
 template <typename matType>
-static int launch_mat_mul_mat(std::vector<matType>& O, matType const& Transform, matType const& Scale, std::size_t Samples)
+static void launch_mat_mul_mat(perf::harness& Harness, char const* Case, char const* Variant, std::vector<matType>& O, matType const& Transform, matType const& Scale, std::size_t Samples)
 {
 	typedef typename matType::value_type T;
 
@@ -32,15 +31,11 @@ static int launch_mat_mul_mat(std::vector<matType>& O, matType const& Transform,
 	for(std::size_t i = 0; i < Samples; ++i)
 		I[i] = Scale * static_cast<T>(i);
 
-	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
-	test_mat_mul_mat<matType>(Transform, I, O);
-	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
-
-	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+	Harness.run(Case, Variant, Samples, [&]() { test_mat_mul_mat<matType>(Transform, I, O); });
 }
 
 template <typename packedMatType, typename alignedMatType>
-static int comp_mat2_mul_mat2(std::size_t Samples)
+static int comp_mat2_mul_mat2(perf::harness& Harness, char const* Case, std::size_t Samples)
 {
 	typedef typename packedMatType::value_type T;
 	
@@ -50,10 +45,10 @@ static int comp_mat2_mul_mat2(std::size_t Samples)
 	packedMatType const Scale(0.01, 0.02, 0.03, 0.05);
 
 	std::vector<packedMatType> SISD;
-	printf("- SISD: %d us\n", launch_mat_mul_mat<packedMatType>(SISD, Transform, Scale, Samples));
+	launch_mat_mul_mat<packedMatType>(Harness, Case, "SISD", SISD, Transform, Scale, Samples);
 
 	std::vector<alignedMatType> SIMD;
-	printf("- SIMD: %d us\n", launch_mat_mul_mat<alignedMatType>(SIMD, Transform, Scale, Samples));
+	launch_mat_mul_mat<alignedMatType>(Harness, Case, "SIMD", SIMD, Transform, Scale, Samples);
 
 	for(std::size_t i = 0; i < Samples; ++i)
 	{
@@ -66,7 +61,7 @@ static int comp_mat2_mul_mat2(std::size_t Samples)
 }
 
 template <typename packedMatType, typename alignedMatType>
-static int comp_mat3_mul_mat3(std::size_t Samples)
+static int comp_mat3_mul_mat3(perf::harness& Harness, char const* Case, std::size_t Samples)
 {
 	typedef typename packedMatType::value_type T;
 	
@@ -76,10 +71,10 @@ static int comp_mat3_mul_mat3(std::size_t Samples)
 	packedMatType const Scale(0.01, 0.02, 0.03, 0.05, 0.01, 0.02, 0.03, 0.05, 0.01);
 
 	std::vector<packedMatType> SISD;
-	printf("- SISD: %d us\n", launch_mat_mul_mat<packedMatType>(SISD, Transform, Scale, Samples));
+	launch_mat_mul_mat<packedMatType>(Harness, Case, "SISD", SISD, Transform, Scale, Samples);
 
 	std::vector<alignedMatType> SIMD;
-	printf("- SIMD: %d us\n", launch_mat_mul_mat<alignedMatType>(SIMD, Transform, Scale, Samples));
+	launch_mat_mul_mat<alignedMatType>(Harness, Case, "SIMD", SIMD, Transform, Scale, Samples);
 
 	for(std::size_t i = 0; i < Samples; ++i)
 	{
@@ -92,7 +87,7 @@ static int comp_mat3_mul_mat3(std::size_t Samples)
 }
 
 template <typename packedMatType, typename alignedMatType>
-static int comp_mat4_mul_mat4(std::size_t Samples)
+static int comp_mat4_mul_mat4(perf::harness& Harness, char const* Case, std::size_t Samples)
 {
 	typedef typename packedMatType::value_type T;
 	
@@ -102,10 +97,10 @@ static int comp_mat4_mul_mat4(std::size_t Samples)
 	packedMatType const Scale(0.01, 0.02, 0.03, 0.05, 0.01, 0.02, 0.03, 0.05, 0.01, 0.02, 0.03, 0.05, 0.01, 0.02, 0.03, 0.05);
 
 	std::vector<packedMatType> SISD;
-	printf("- SISD: %d us\n", launch_mat_mul_mat<packedMatType>(SISD, Transform, Scale, Samples));
+	launch_mat_mul_mat<packedMatType>(Harness, Case, "SISD", SISD, Transform, Scale, Samples);
 
 	std::vector<alignedMatType> SIMD;
-	printf("- SIMD: %d us\n", launch_mat_mul_mat<alignedMatType>(SIMD, Transform, Scale, Samples));
+	launch_mat_mul_mat<alignedMatType>(Harness, Case, "SIMD", SIMD, Transform, Scale, Samples);
 
 	for(std::size_t i = 0; i < Samples; ++i)
 	{
@@ -117,31 +112,25 @@ static int comp_mat4_mul_mat4(std::size_t Samples)
 	return Error;
 }
 
-int main()
+int main(int argc, char* argv[])
 {
-	std::size_t const Samples = 100000;
+	perf::harness Harness("perf_matrix_mul", argc, argv);
 
 	int Error = 0;
 
-	printf("mat2 * mat2:\n");
-	Error += comp_mat2_mul_mat2<glm::mat2, glm::aligned_mat2>(Samples);
-	
-	printf("dmat2 * dmat2:\n");
-	Error += comp_mat2_mul_mat2<glm::dmat2, glm::aligned_dmat2>(Samples);
-
-	printf("mat3 * mat3:\n");
-	Error += comp_mat3_mul_mat3<glm::mat3, glm::aligned_mat3>(Samples);
-	
-	printf("dmat3 * dmat3:\n");
-	Error += comp_mat3_mul_mat3<glm::dmat3, glm::aligned_dmat3>(Samples);
-
-	printf("mat4 * mat4:\n");
-	Error += comp_mat4_mul_mat4<glm::mat4, glm::aligned_mat4>(Samples);
-	
-	printf("dmat4 * dmat4:\n");
-	Error += comp_mat4_mul_mat4<glm::dmat4, glm::aligned_dmat4>(Samples);
+	for(std::size_t i = 0; i < Harness.sizes().size(); ++i)
+	{
+		std::size_t const Samples = Harness.sizes()[i];
+
+		Error += comp_mat2_mul_mat2<glm::mat2, glm::aligned_mat2>(Harness, "mat2 * mat2", Samples);
+		Error += comp_mat2_mul_mat2<glm::dmat2, glm::aligned_dmat2>(Harness, "dmat2 * dmat2", Samples);
+		Error += comp_mat3_mul_mat3<glm::mat3, glm::aligned_mat3>(Harness, "mat3 * mat3", Samples);
+		Error += comp_mat3_mul_mat3<glm::dmat3, glm::aligned_dmat3>(Harness, "dmat3 * dmat3", Samples);
+		Error += comp_mat4_mul_mat4<glm::mat4, glm::aligned_mat4>(Harness, "mat4 * mat4", Samples);
+		Error += comp_mat4_mul_mat4<glm::dmat4, glm::aligned_dmat4>(Harness, "dmat4 * dmat4", Samples);
+	}
 
-	return Error;
+	return Harness.finish(Error);
 }
 
 #else
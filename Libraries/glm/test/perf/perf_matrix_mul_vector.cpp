@@ -10,9 +10,8 @@
 #include <glm/ext/vector_float4.hpp>
 #if GLM_CONFIG_SIMD == GLM_ENABLE
 #include <glm/gtc/type_aligned.hpp>
+#include "perf_harness.hpp"
 #include <vector>
-#include <chrono>
-#include <cstdio>
 
 template <typename matType, typename vecType>
 static void test_mat_mul_vec(matType const& M, std::vector<vecType> const& I, std::vector<vecType>& O)
@@ -22,7 +21,7 @@ static void test_mat_mul_vec(matType const& M, std::vector<vecType> const& I, st
 }
 
 template <typename matType, typename vecType>
-static int launch_mat_mul_vec(std::vector<vecType>& O, matType const& Transform, vecType const& Scale, std::size_t Samples)
+static void launch_mat_mul_vec(perf::harness& Harness, char const* Case, char const* Variant, std::vector<vecType>& O, matType const& Transform, vecType const& Scale, std::size_t Samples)
 {
 	typedef typename matType::value_type T;
 
@@ -32,15 +31,11 @@ static int launch_mat_mul_vec(std::vector<vecType>& O, matType const& Transform,
 	for(std::size_t i = 0; i < Samples; ++i)
 		I[i] = Scale * static_cast<T>(i);
 
-	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
-	test_mat_mul_vec<matType, vecType>(Transform, I, O);
-	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
-
-	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+	Harness.run(Case, Variant, Samples, [&]() { test_mat_mul_vec<matType, vecType>(Transform, I, O); });
 }
 
 template <typename packedMatType, typename packedVecType, typename alignedMatType, typename alignedVecType>
-static int comp_mat2_mul_vec2(std::size_t Samples)
+static int comp_mat2_mul_vec2(perf::harness& Harness, char const* Case, std::size_t Samples)
 {
 	typedef typename packedMatType::value_type T;
 	
@@ -50,10 +45,10 @@ static int comp_mat2_mul_vec2(std::size_t Samples)
 	packedVecType const Scale(0.01, 0.02);
 
 	std::vector<packedVecType> SISD;
-	printf("- SISD: %d us\n", launch_mat_mul_vec<packedMatType, packedVecType>(SISD, Transform, Scale, Samples));
+	launch_mat_mul_vec<packedMatType, packedVecType>(Harness, Case, "SISD", SISD, Transform, Scale, Samples);
 
 	std::vector<alignedVecType> SIMD;
-	printf("- SIMD: %d us\n", launch_mat_mul_vec<alignedMatType, alignedVecType>(SIMD, Transform, Scale, Samples));
+	launch_mat_mul_vec<alignedMatType, alignedVecType>(Harness, Case, "SIMD", SIMD, Transform, Scale, Samples);
 
 	for(std::size_t i = 0; i < Samples; ++i)
 	{
@@ -66,7 +61,7 @@ static int comp_mat2_mul_vec2(std::size_t Samples)
 }
 
 template <typename packedMatType, typename packedVecType, typename alignedMatType, typename alignedVecType>
-static int comp_mat3_mul_vec3(std::size_t Samples)
+static int comp_mat3_mul_vec3(perf::harness& Harness, char const* Case, std::size_t Samples)
 {
 	typedef typename packedMatType::value_type T;
 	
@@ -76,10 +71,10 @@ static int comp_mat3_mul_vec3(std::size_t Samples)
 	packedVecType const Scale(0.01, 0.02, 0.05);
 
 	std::vector<packedVecType> SISD;
-	printf("- SISD: %d us\n", launch_mat_mul_vec<packedMatType, packedVecType>(SISD, Transform, Scale, Samples));
+	launch_mat_mul_vec<packedMatType, packedVecType>(Harness, Case, "SISD", SISD, Transform, Scale, Samples);
 
 	std::vector<alignedVecType> SIMD;
-	printf("- SIMD: %d us\n", launch_mat_mul_vec<alignedMatType, alignedVecType>(SIMD, Transform, Scale, Samples));
+	launch_mat_mul_vec<alignedMatType, alignedVecType>(Harness, Case, "SIMD", SIMD, Transform, Scale, Samples);
 
 	for(std::size_t i = 0; i < Samples; ++i)
 	{
@@ -92,7 +87,7 @@ static int comp_mat3_mul_vec3(std::size_t Samples)
 }
 
 template <typename packedMatType, typename packedVecType, typename alignedMatType, typename alignedVecType>
-static int comp_mat4_mul_vec4(std::size_t Samples)
+static int comp_mat4_mul_vec4(perf::harness& Harness, char const* Case, std::size_t Samples)
 {
 	typedef typename packedMatType::value_type T;
 	
@@ -102,10 +97,10 @@ static int comp_mat4_mul_vec4(std::size_t Samples)
 	packedVecType const Scale(0.01, 0.02, 0.03, 0.05);
 
 	std::vector<packedVecType> SISD;
-	printf("- SISD: %d us\n", launch_mat_mul_vec<packedMatType, packedVecType>(SISD, Transform, Scale, Samples));
+	launch_mat_mul_vec<packedMatType, packedVecType>(Harness, Case, "SISD", SISD, Transform, Scale, Samples);
 
 	std::vector<alignedVecType> SIMD;
-	printf("- SIMD: %d us\n", launch_mat_mul_vec<alignedMatType, alignedVecType>(SIMD, Transform, Scale, Samples));
+	launch_mat_mul_vec<alignedMatType, alignedVecType>(Harness, Case, "SIMD", SIMD, Transform, Scale, Samples);
 
 	for(std::size_t i = 0; i < Samples; ++i)
 	{
@@ -117,31 +112,25 @@ static int comp_mat4_mul_vec4(std::size_t Samples)
 	return Error;
 }
 
-int main()
+int main(int argc, char* argv[])
 {
-	std::size_t const Samples = 100000;
-	
-	int Error = 0;
-
-	printf("mat2 * vec2:\n");
-	Error += comp_mat2_mul_vec2<glm::mat2, glm::vec2, glm::aligned_mat2, glm::aligned_vec2>(Samples);
-	
-	printf("dmat2 * dvec2:\n");
-	Error += comp_mat2_mul_vec2<glm::dmat2, glm::dvec2,glm::aligned_dmat2, glm::aligned_dvec2>(Samples);
+	perf::harness Harness("perf_matrix_mul_vector", argc, argv);
 
-	printf("mat3 * vec3:\n");
-	Error += comp_mat3_mul_vec3<glm::mat3, glm::vec3, glm::aligned_mat3, glm::aligned_vec3>(Samples);
-	
-	printf("dmat3 * dvec3:\n");
-	Error += comp_mat3_mul_vec3<glm::dmat3, glm::dvec3, glm::aligned_dmat3, glm::aligned_dvec3>(Samples);
+	int Error = 0;
 
-	printf("mat4 * vec4:\n");
-	Error += comp_mat4_mul_vec4<glm::mat4, glm::vec4, glm::aligned_mat4, glm::aligned_vec4>(Samples);
-	
-	printf("dmat4 * dvec4:\n");
-	Error += comp_mat4_mul_vec4<glm::dmat4, glm::dvec4, glm::aligned_dmat4, glm::aligned_dvec4>(Samples);
+	for(std::size_t i = 0; i < Harness.sizes().size(); ++i)
+	{
+		std::size_t const Samples = Harness.sizes()[i];
+
+		Error += comp_mat2_mul_vec2<glm::mat2, glm::vec2, glm::aligned_mat2, glm::aligned_vec2>(Harness, "mat2 * vec2", Samples);
+		Error += comp_mat2_mul_vec2<glm::dmat2, glm::dvec2,glm::aligned_dmat2, glm::aligned_dvec2>(Harness, "dmat2 * dvec2", Samples);
+		Error += comp_mat3_mul_vec3<glm::mat3, glm::vec3, glm::aligned_mat3, glm::aligned_vec3>(Harness, "mat3 * vec3", Samples);
+		Error += comp_mat3_mul_vec3<glm::dmat3, glm::dvec3, glm::aligned_dmat3, glm::aligned_dvec3>(Harness, "dmat3 * dvec3", Samples);
+		Error += comp_mat4_mul_vec4<glm::mat4, glm::vec4, glm::aligned_mat4, glm::aligned_vec4>(Harness, "mat4 * vec4", Samples);
+		Error += comp_mat4_mul_vec4<glm::dmat4, glm::dvec4, glm::aligned_dmat4, glm::aligned_dvec4>(Harness, "dmat4 * dvec4", Samples);
+	}
 
-	return Error;
+	return Harness.finish(Error);
 }
 
 #else
@@ -0,0 +1,120 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/noise_batch.hpp>
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#include "perf_harness.hpp"
+#include <vector>
+
+// The noise kernels use AVX2 when AVX-512 is requested, so they are measured up to AVX2.
+static char const* const VariantNames[] = {"batch scalar", "batch SSE2", "batch AVX2"};
+
+// Same tolerance as gtx_noise_batch, FMA contraction moves the AVX2 results a little.
+static float const Tolerance = 0.0001f;
+
+template<glm::length_t L>
+static std::vector<glm::vec<L, float, glm::defaultp> > make_points(std::size_t Count)
+{
+	std::vector<glm::vec<L, float, glm::defaultp> > Points(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	for(glm::length_t c = 0; c < L; ++c)
+		Points[i][c] = glm::sin(static_cast<float>(i % 4093) * (1.3f + 0.7f * static_cast<float>(c))) * 32.0f;
+	return Points;
+}
+
+template<glm::length_t L>
+static int comp(perf::harness& Harness, char const* Case, glm::noise_basis Basis, std::size_t Count, glm::batch_instruction_set Best)
+{
+	int Error = 0;
+
+	std::vector<glm::vec<L, float, glm::defaultp> > const Points = make_points<L>(Count);
+	std::vector<float> Expected(Count), Result(Count);
+
+	Harness.throughput(Harness.run(Case, "scalar loop", Count, [&]()
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Expected[i] = Basis == glm::NOISE_SIMPLEX ? glm::simplex(Points[i]) : glm::perlin(Points[i]);
+	}), "samples");
+
+	for(int Set = glm::BATCH_SCALAR; Set <= Best; ++Set)
+	{
+		glm::setBatchInstructionSet(static_cast<glm::batch_instruction_set>(Set));
+		Harness.throughput(Harness.run(Case, VariantNames[Set], Count, [&]()
+		{
+			if(Basis == glm::NOISE_SIMPLEX)
+				glm::simplexBatch(&Points[0], &Result[0], Count);
+			else
+				glm::perlinBatch(&Points[0], &Result[0], Count);
+		}), "samples");
+
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::abs(Result[i] - Expected[i]) < Tolerance ? 0 : 1;
+	}
+
+	return Error;
+}
+
+// A square fBm texture, single threaded then on every hardware thread.
+static int comp_image(perf::harness& Harness, std::size_t Count, glm::batch_instruction_set Best)
+{
+	int Error = 0;
+
+	std::size_t Side = 1;
+	while((Side + 1) * (Side + 1) <= Count)
+		++Side;
+	std::size_t const Samples = Side * Side;
+
+	glm::vec3 const Origin(-8.0f, -8.0f, 0.5f);
+	glm::vec3 const DeltaX(16.0f / static_cast<float>(Side), 0.0f, 0.0f);
+	glm::vec3 const DeltaY(0.0f, 16.0f / static_cast<float>(Side), 0.0f);
+
+	std::vector<float> Single(Samples), Multi(Samples);
+
+	glm::setBatchInstructionSet(Best);
+	Harness.throughput(Harness.run("fbmImage simplex 3D 4 octaves", "1 thread", Samples, [&]()
+	{
+		glm::fbmImage(&Single[0], Side, Side, Origin, DeltaX, DeltaY, glm::NOISE_SIMPLEX, 4, 2.0f, 0.5f, 1);
+	}), "samples");
+	Harness.throughput(Harness.run("fbmImage simplex 3D 4 octaves", "all threads", Samples, [&]()
+	{
+		glm::fbmImage(&Multi[0], Side, Side, Origin, DeltaX, DeltaY, glm::NOISE_SIMPLEX, 4, 2.0f, 0.5f, 0);
+	}), "samples");
+
+	for(std::size_t i = 0; i < Samples; ++i)
+		Error += Single[i] == Multi[i] ? 0 : 1;
+
+	return Error;
+}
+
+int main(int argc, char* argv[])
+{
+	perf::harness Harness("perf_noise", argc, argv);
+
+	int Error = 0;
+
+	glm::batch_instruction_set const Supported = glm::setBatchInstructionSet(glm::BATCH_AVX512);
+	glm::batch_instruction_set const Best = Supported < glm::BATCH_AVX2 ? Supported : glm::BATCH_AVX2;
+
+	for(std::size_t s = 0; s < Harness.sizes().size(); ++s)
+	{
+		std::size_t const Samples = Harness.sizes()[s];
+
+		Error += comp<2>(Harness, "perlin 2D", glm::NOISE_PERLIN, Samples, Best);
+		Error += comp<3>(Harness, "perlin 3D", glm::NOISE_PERLIN, Samples, Best);
+		Error += comp<4>(Harness, "perlin 4D", glm::NOISE_PERLIN, Samples, Best);
+		Error += comp<2>(Harness, "simplex 2D", glm::NOISE_SIMPLEX, Samples, Best);
+		Error += comp<3>(Harness, "simplex 3D", glm::NOISE_SIMPLEX, Samples, Best);
+		Error += comp<4>(Harness, "simplex 4D", glm::NOISE_SIMPLEX, Samples, Best);
+		Error += comp_image(Harness, Samples, Best);
+	}
+
+	return Harness.finish(Error);
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
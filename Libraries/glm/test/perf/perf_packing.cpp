@@ -0,0 +1,97 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtc/packing.hpp>
+#include <glm/gtx/matrix_batch.hpp>
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#include "perf_harness.hpp"
+#include <cstring>
+#include <vector>
+
+// The packing kernels use AVX2 when AVX-512 is requested, so they are measured up to AVX2.
+static char const* const VariantNames[] = {"batch scalar", "batch SSE2", "batch AVX2"};
+
+// Vertex stream like values, in and a bit out of the normalized range.
+static float make_float(std::size_t i)
+{
+	float const f = static_cast<float>(i % 1009);
+	return glm::sin(f * 1.3f) * 1.1f;
+}
+
+template<typename inType, typename outType, typename scalarType, typename batchType>
+static int comp(perf::harness& Harness, char const* Case, std::vector<inType> const& In, scalarType Scalar, batchType Batch, glm::batch_instruction_set Best)
+{
+	int Error = 0;
+
+	std::size_t const Count = In.size();
+	std::size_t const Bytes = Count * (sizeof(inType) + sizeof(outType));
+
+	std::vector<outType> Expected(Count), Result(Count);
+	Harness.bandwidth(Harness.run(Case, "scalar loop", Count, [&]()
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Expected[i] = Scalar(In[i]);
+	}), Bytes);
+
+	for(int Set = glm::BATCH_SCALAR; Set <= Best; ++Set)
+	{
+		glm::setBatchInstructionSet(static_cast<glm::batch_instruction_set>(Set));
+		Harness.bandwidth(Harness.run(Case, VariantNames[Set], Count, [&]() { Batch(&In[0], &Result[0], Count); }), Bytes);
+		Error += std::memcmp(&Expected[0], &Result[0], Count * sizeof(outType)) == 0 ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int main(int argc, char* argv[])
+{
+	perf::harness Harness("perf_packing", argc, argv);
+
+	int Error = 0;
+
+	glm::batch_instruction_set const Supported = glm::setBatchInstructionSet(glm::BATCH_AVX512);
+	glm::batch_instruction_set const Best = Supported < glm::BATCH_AVX2 ? Supported : glm::BATCH_AVX2;
+
+	for(std::size_t s = 0; s < Harness.sizes().size(); ++s)
+	{
+		std::size_t const Samples = Harness.sizes()[s];
+
+		std::vector<float> Floats(Samples);
+		std::vector<glm::vec3> Vec3s(Samples);
+		std::vector<glm::vec4> Vec4s(Samples);
+		for(std::size_t i = 0; i < Samples; ++i)
+		{
+			Floats[i] = make_float(i);
+			Vec3s[i] = glm::abs(glm::vec3(make_float(i), make_float(i + 1), make_float(i + 2))) * 64.0f;
+			Vec4s[i] = glm::vec4(make_float(i), make_float(i + 1), make_float(i + 2), make_float(i + 3));
+		}
+
+		std::vector<glm::uint16> Halves(Samples), Snorm16s(Samples);
+		std::vector<glm::uint8> Unorm8s(Samples);
+		std::vector<glm::uint32> F11s(Samples);
+		glm::packHalf1x16Batch(&Floats[0], &Halves[0], Samples);
+		glm::packSnorm1x16Batch(&Floats[0], &Snorm16s[0], Samples);
+		glm::packUnorm1x8Batch(&Floats[0], &Unorm8s[0], Samples);
+		glm::packF2x11_1x10Batch(&Vec3s[0], &F11s[0], Samples);
+
+		Error += comp<float, glm::uint16>(Harness, "packHalf1x16", Floats, glm::packHalf1x16, glm::packHalf1x16Batch, Best);
+		Error += comp<glm::uint16, float>(Harness, "unpackHalf1x16", Halves, glm::unpackHalf1x16, glm::unpackHalf1x16Batch, Best);
+		Error += comp<float, glm::uint8>(Harness, "packUnorm1x8", Floats, glm::packUnorm1x8, glm::packUnorm1x8Batch, Best);
+		Error += comp<glm::uint8, float>(Harness, "unpackUnorm1x8", Unorm8s, glm::unpackUnorm1x8, glm::unpackUnorm1x8Batch, Best);
+		Error += comp<float, glm::uint16>(Harness, "packSnorm1x16", Floats, glm::packSnorm1x16, glm::packSnorm1x16Batch, Best);
+		Error += comp<glm::uint16, float>(Harness, "unpackSnorm1x16", Snorm16s, glm::unpackSnorm1x16, glm::unpackSnorm1x16Batch, Best);
+		Error += comp<glm::vec4, glm::uint32>(Harness, "packSnorm3x10_1x2", Vec4s, glm::packSnorm3x10_1x2, glm::packSnorm3x10_1x2Batch, Best);
+		Error += comp<glm::vec3, glm::uint32>(Harness, "packF2x11_1x10", Vec3s, glm::packF2x11_1x10, glm::packF2x11_1x10Batch, Best);
+		Error += comp<glm::uint32, glm::vec3>(Harness, "unpackF2x11_1x10", F11s, glm::unpackF2x11_1x10, glm::unpackF2x11_1x10Batch, Best);
+	}
+
+	return Harness.finish(Error);
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
@@ -0,0 +1,283 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtc/quaternion.hpp>
+#include <glm/gtx/quaternion.hpp>
+#include <glm/gtx/quaternion_batch.hpp>
+#include <glm/ext/quaternion_float.hpp>
+#include <glm/ext/quaternion_relational.hpp>
+#include <glm/ext/matrix_float4x4.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#include <glm/gtc/type_aligned.hpp>
+#include "perf_harness.hpp"
+#include <vector>
+
+typedef glm::qua<float, glm::aligned_highp> aligned_quat;
+
+// The quaternion kernels use AVX2 when AVX-512 is requested, so they are measured up to AVX2.
+static char const* const VariantNames[] = {"batch scalar", "batch SSE2", "batch AVX2"};
+
+template <typename quatType>
+static void fill(std::vector<quatType>& Q, std::size_t Samples, float Offset)
+{
+	Q.resize(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		float const Angle = static_cast<float>(i % 1000) * 0.00628f + Offset;
+		Q[i] = quatType(glm::angleAxis(Angle, glm::normalize(glm::vec3(1.0f, Offset, 2.0f))));
+	}
+}
+
+template <typename quatType>
+static int comp_quat_mul_quat(perf::harness& Harness, char const* Case, std::size_t Samples, glm::batch_instruction_set Best)
+{
+	int Error = 0;
+
+	std::vector<glm::quat> A, B, SISD(Samples), Batch(Samples);
+	std::vector<quatType> AlignedA, AlignedB, SIMD(Samples);
+	fill(A, Samples, 0.1f); fill(B, Samples, 0.7f);
+	fill(AlignedA, Samples, 0.1f); fill(AlignedB, Samples, 0.7f);
+
+	Harness.run(Case, "SISD", Samples, [&]()
+	{
+		for(std::size_t i = 0; i < Samples; ++i)
+			SISD[i] = A[i] * B[i];
+	});
+	Harness.run(Case, "SIMD", Samples, [&]()
+	{
+		for(std::size_t i = 0; i < Samples; ++i)
+			SIMD[i] = AlignedA[i] * AlignedB[i];
+	});
+
+	for(std::size_t i = 0; i < Samples; ++i)
+		Error += glm::all(glm::equal(SISD[i], glm::quat(SIMD[i]), 0.001f)) ? 0 : 1;
+
+	for(int Set = glm::BATCH_SCALAR; Set <= Best; ++Set)
+	{
+		glm::setBatchInstructionSet(static_cast<glm::batch_instruction_set>(Set));
+		Harness.run(Case, VariantNames[Set], Samples, [&]() { glm::mulBatch(&A[0], &B[0], &Batch[0], Samples); });
+
+		for(std::size_t i = 0; i < Samples; ++i)
+			Error += glm::all(glm::equal(SISD[i], Batch[i], 0.001f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template <typename quatType, typename vecType>
+static int comp_quat_mul_vec3(perf::harness& Harness, char const* Case, std::size_t Samples)
+{
+	int Error = 0;
+
+	std::vector<glm::quat> Q;
+	std::vector<quatType> AlignedQ;
+	fill(Q, Samples, 0.3f);
+	fill(AlignedQ, Samples, 0.3f);
+
+	std::vector<glm::vec3> I(Samples), SISD(Samples);
+	std::vector<vecType> AlignedI(Samples), SIMD(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		I[i] = glm::vec3(static_cast<float>(i % 100), 1.0f, -2.0f);
+		AlignedI[i] = vecType(I[i]);
+	}
+
+	Harness.run(Case, "SISD", Samples, [&]()
+	{
+		for(std::size_t i = 0; i < Samples; ++i)
+			SISD[i] = Q[i] * I[i];
+	});
+	Harness.run(Case, "SIMD", Samples, [&]()
+	{
+		for(std::size_t i = 0; i < Samples; ++i)
+			SIMD[i] = AlignedQ[i] * AlignedI[i];
+	});
+
+	for(std::size_t i = 0; i < Samples; ++i)
+		Error += glm::all(glm::equal(SISD[i], glm::vec3(SIMD[i]), 0.01f)) ? 0 : 1;
+
+	return Error;
+}
+
+template <typename quatType>
+static int comp_quat_slerp(perf::harness& Harness, char const* Case, std::size_t Samples, glm::batch_instruction_set Best)
+{
+	int Error = 0;
+
+	std::vector<glm::quat> A, B, SISD(Samples), Batch(Samples);
+	std::vector<quatType> AlignedA, AlignedB, SIMD(Samples);
+	fill(A, Samples, 0.1f); fill(B, Samples, 0.7f);
+	fill(AlignedA, Samples, 0.1f); fill(AlignedB, Samples, 0.7f);
+
+	Harness.run(Case, "SISD", Samples, [&]()
+	{
+		for(std::size_t i = 0; i < Samples; ++i)
+			SISD[i] = glm::slerp(A[i], B[i], 0.3f);
+	});
+	Harness.run(Case, "SIMD", Samples, [&]()
+	{
+		for(std::size_t i = 0; i < Samples; ++i)
+			SIMD[i] = glm::slerp(AlignedA[i], AlignedB[i], 0.3f);
+	});
+
+	for(std::size_t i = 0; i < Samples; ++i)
+		Error += glm::all(glm::equal(SISD[i], glm::quat(SIMD[i]), 0.001f)) ? 0 : 1;
+
+	for(int Set = glm::BATCH_SCALAR; Set <= Best; ++Set)
+	{
+		glm::setBatchInstructionSet(static_cast<glm::batch_instruction_set>(Set));
+		Harness.run(Case, VariantNames[Set], Samples, [&]() { glm::slerpBatch(&A[0], &B[0], 0.3f, &Batch[0], Samples); });
+
+		for(std::size_t i = 0; i < Samples; ++i)
+			Error += glm::all(glm::equal(SISD[i], Batch[i], 0.001f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template <typename quatType, typename matType>
+static int comp_mat4_cast(perf::harness& Harness, char const* Case, std::size_t Samples)
+{
+	int Error = 0;
+
+	std::vector<glm::quat> Q;
+	std::vector<quatType> AlignedQ;
+	fill(Q, Samples, 0.5f);
+	fill(AlignedQ, Samples, 0.5f);
+
+	std::vector<glm::mat4> SISD(Samples);
+	std::vector<matType> SIMD(Samples);
+
+	Harness.run(Case, "SISD", Samples, [&]()
+	{
+		for(std::size_t i = 0; i < Samples; ++i)
+			SISD[i] = glm::mat4_cast(Q[i]);
+	});
+	Harness.run(Case, "SIMD", Samples, [&]()
+	{
+		for(std::size_t i = 0; i < Samples; ++i)
+			SIMD[i] = glm::mat4_cast(AlignedQ[i]);
+	});
+
+	for(std::size_t i = 0; i < Samples; ++i)
+		Error += glm::all(glm::equal(SISD[i], glm::mat4(SIMD[i]), 0.001f)) ? 0 : 1;
+
+	return Error;
+}
+
+static int comp_mat3x4_cast(perf::harness& Harness, char const* Case, std::size_t Samples, glm::batch_instruction_set Best)
+{
+	int Error = 0;
+
+	std::vector<glm::quat> Q;
+	fill(Q, Samples, 0.5f);
+	std::vector<glm::vec3> T(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+		T[i] = glm::vec3(static_cast<float>(i % 100), 1.0f, -2.0f);
+
+	std::vector<glm::mat3x4> SISD(Samples), Batch(Samples);
+
+	Harness.run(Case, "SISD", Samples, [&]()
+	{
+		for(std::size_t i = 0; i < Samples; ++i)
+			SISD[i] = glm::mat3x4_cast(glm::dualquat(Q[i], T[i]));
+	});
+
+	for(int Set = glm::BATCH_SCALAR; Set <= Best; ++Set)
+	{
+		glm::setBatchInstructionSet(static_cast<glm::batch_instruction_set>(Set));
+		Harness.run(Case, VariantNames[Set], Samples, [&]() { glm::mat3x4CastBatch(&Q[0], &T[0], &Batch[0], Samples); });
+
+		for(std::size_t i = 0; i < Samples; ++i)
+			Error += glm::all(glm::equal(SISD[i], Batch[i], 0.001f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+// Four bone skinning, the usual vertex format.
+static int comp_dualquat_blend(perf::harness& Harness, char const* Case, std::size_t Samples, glm::batch_instruction_set Best)
+{
+	int Error = 0;
+
+	std::size_t const Influences = 4;
+	std::vector<glm::quat> Q;
+	fill(Q, 64, 0.2f);
+	std::vector<glm::dualquat> Bones(Q.size());
+	for(std::size_t b = 0; b < Bones.size(); ++b)
+		Bones[b] = glm::dualquat(Q[b], glm::vec3(static_cast<float>(b), 0.5f, -1.0f));
+
+	std::vector<glm::uint> Indices(Samples * Influences);
+	std::vector<float> Weights(Samples * Influences);
+	for(std::size_t i = 0; i < Indices.size(); ++i)
+	{
+		Indices[i] = static_cast<glm::uint>((i * 7) % Bones.size());
+		Weights[i] = i % Influences == 0 ? 0.4f : 0.2f;
+	}
+
+	std::vector<glm::dualquat> SISD(Samples), Batch(Samples);
+
+	Harness.run(Case, "SISD", Samples, [&]()
+	{
+		for(std::size_t i = 0; i < Samples; ++i)
+		{
+			glm::dualquat const& First = Bones[Indices[i * Influences]];
+			glm::dualquat Sum = First * Weights[i * Influences];
+			for(std::size_t k = 1; k < Influences; ++k)
+			{
+				glm::dualquat const& Bone = Bones[Indices[i * Influences + k]];
+				float const w = Weights[i * Influences + k];
+				Sum = Sum + Bone * (glm::dot(First.real, Bone.real) < 0.0f ? -w : w);
+			}
+			SISD[i] = glm::normalize(Sum);
+		}
+	});
+
+	for(int Set = glm::BATCH_SCALAR; Set <= Best; ++Set)
+	{
+		glm::setBatchInstructionSet(static_cast<glm::batch_instruction_set>(Set));
+		Harness.run(Case, VariantNames[Set], Samples, [&]() { glm::dualQuatBlendBatch(&Bones[0], &Indices[0], &Weights[0], Influences, &Batch[0], Samples); });
+
+		for(std::size_t i = 0; i < Samples; ++i)
+		{
+			Error += glm::all(glm::equal(SISD[i].real, Batch[i].real, 0.001f)) ? 0 : 1;
+			Error += glm::all(glm::equal(SISD[i].dual, Batch[i].dual, 0.001f)) ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+int main(int argc, char* argv[])
+{
+	perf::harness Harness("perf_quaternion", argc, argv);
+
+	int Error = 0;
+
+	glm::batch_instruction_set const Supported = glm::setBatchInstructionSet(glm::BATCH_AVX512);
+	glm::batch_instruction_set const Best = Supported < glm::BATCH_AVX2 ? Supported : glm::BATCH_AVX2;
+
+	for(std::size_t i = 0; i < Harness.sizes().size(); ++i)
+	{
+		std::size_t const Samples = Harness.sizes()[i];
+
+		Error += comp_quat_mul_quat<aligned_quat>(Harness, "quat * quat", Samples, Best);
+		Error += comp_quat_mul_vec3<aligned_quat, glm::aligned_vec3>(Harness, "quat * vec3", Samples);
+		Error += comp_quat_slerp<aligned_quat>(Harness, "slerp(quat, quat)", Samples, Best);
+		Error += comp_mat4_cast<aligned_quat, glm::aligned_mat4>(Harness, "mat4_cast(quat)", Samples);
+		Error += comp_mat3x4_cast(Harness, "mat3x4_cast(quat, vec3)", Samples, Best);
+		Error += comp_dualquat_blend(Harness, "dual quaternion blend, 4 bones", Samples, Best);
+	}
+
+	return Harness.finish(Error);
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
@@ -0,0 +1,287 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/soa.hpp>
+#include <glm/ext/matrix_float4x4.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/ext/vector_relational.hpp>
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#include <glm/gtc/type_aligned.hpp>
+#include "perf_harness.hpp"
+#include <vector>
+
+// The structure of arrays kernels use AVX2 when AVX-512 is requested, so they are measured up to AVX2.
+static char const* const VariantNames[] = {"SoA scalar", "SoA SSE2", "SoA AVX2"};
+
+// Vectors as they sit in a vertex buffer, position followed by other attributes.
+struct vertex
+{
+	glm::vec3 Position;
+	glm::vec3 Normal;
+	glm::vec2 TexCoord;
+};
+
+static glm::vec3 make_vec3(std::size_t i)
+{
+	float const f = static_cast<float>(i % 1000);
+	return glm::vec3(f * 0.01f - 5.0f, 1.0f + f * 0.002f, 3.0f - f * 0.005f);
+}
+
+template<typename vecType>
+static int check(std::vector<vecType> const& Expected, glm::vec3_soa const& Result, float Epsilon)
+{
+	int Error = 0;
+	for(std::size_t i = 0; i < Expected.size(); ++i)
+		Error += glm::all(glm::equal(glm::vec3(Expected[i]), Result.get(i), Epsilon)) ? 0 : 1;
+	return Error;
+}
+
+static int comp_transform(perf::harness& Harness, char const* Case, std::size_t Samples, glm::batch_instruction_set Best)
+{
+	int Error = 0;
+
+	glm::mat4 const M = glm::rotate(glm::translate(glm::mat4(1.0f), glm::vec3(1.0f, 2.0f, 3.0f)), 0.5f, glm::vec3(0.0f, 1.0f, 0.0f));
+	glm::aligned_mat4 const AlignedM(M);
+
+	std::vector<glm::vec3> In(Samples), AoS(Samples);
+	std::vector<glm::aligned_vec4> AlignedIn(Samples), AlignedAoS(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		In[i] = make_vec3(i);
+		AlignedIn[i] = glm::aligned_vec4(In[i], 1.0f);
+	}
+
+	Harness.run(Case, "AoS vec3", Samples, [&]()
+	{
+		for(std::size_t i = 0; i < Samples; ++i)
+			AoS[i] = glm::vec3(M * glm::vec4(In[i], 1.0f));
+	});
+	Harness.run(Case, "AoS aligned_vec4", Samples, [&]()
+	{
+		for(std::size_t i = 0; i < Samples; ++i)
+			AlignedAoS[i] = AlignedM * AlignedIn[i];
+	});
+
+	glm::vec3_soa SoAIn, SoAOut;
+	glm::packSoA(&In[0], Samples, SoAIn);
+	for(int Set = glm::BATCH_SCALAR; Set <= Best; ++Set)
+	{
+		glm::setBatchInstructionSet(static_cast<glm::batch_instruction_set>(Set));
+		Harness.run(Case, VariantNames[Set], Samples, [&]() { glm::transformSoA(M, SoAIn, SoAOut); });
+		Error += check(AoS, SoAOut, 0.001f);
+	}
+	Error += check(AlignedAoS, SoAOut, 0.001f);
+
+	return Error;
+}
+
+static int comp_normalize(perf::harness& Harness, char const* Case, std::size_t Samples, glm::batch_instruction_set Best)
+{
+	int Error = 0;
+
+	std::vector<glm::vec3> In(Samples), AoS(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+		In[i] = make_vec3(i);
+
+	Harness.run(Case, "AoS vec3", Samples, [&]()
+	{
+		for(std::size_t i = 0; i < Samples; ++i)
+			AoS[i] = glm::normalize(In[i]);
+	});
+
+	glm::vec3_soa SoAIn, SoAOut;
+	glm::packSoA(&In[0], Samples, SoAIn);
+	for(int Set = glm::BATCH_SCALAR; Set <= Best; ++Set)
+	{
+		glm::setBatchInstructionSet(static_cast<glm::batch_instruction_set>(Set));
+		Harness.run(Case, VariantNames[Set], Samples, [&]() { glm::normalizeSoA(SoAIn, SoAOut); });
+		Error += check(AoS, SoAOut, 0.00001f);
+	}
+
+	return Error;
+}
+
+static int comp_dot(perf::harness& Harness, char const* Case, std::size_t Samples, glm::batch_instruction_set Best)
+{
+	int Error = 0;
+
+	std::vector<glm::vec3> A(Samples), B(Samples);
+	std::vector<float> AoS(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		A[i] = make_vec3(i);
+		B[i] = make_vec3(i + 500);
+	}
+
+	Harness.run(Case, "AoS vec3", Samples, [&]()
+	{
+		for(std::size_t i = 0; i < Samples; ++i)
+			AoS[i] = glm::dot(A[i], B[i]);
+	});
+
+	glm::vec3_soa SoAA, SoAB;
+	glm::vec1_soa SoAOut;
+	glm::packSoA(&A[0], Samples, SoAA);
+	glm::packSoA(&B[0], Samples, SoAB);
+	for(int Set = glm::BATCH_SCALAR; Set <= Best; ++Set)
+	{
+		glm::setBatchInstructionSet(static_cast<glm::batch_instruction_set>(Set));
+		Harness.run(Case, VariantNames[Set], Samples, [&]() { glm::dotSoA(SoAA, SoAB, SoAOut); });
+		for(std::size_t i = 0; i < Samples; ++i)
+			Error += glm::abs(AoS[i] - SoAOut.data(0)[i]) <= 0.0001f * (1.0f + glm::abs(AoS[i])) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int comp_cross(perf::harness& Harness, char const* Case, std::size_t Samples, glm::batch_instruction_set Best)
+{
+	int Error = 0;
+
+	std::vector<glm::vec3> A(Samples), B(Samples), AoS(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		A[i] = make_vec3(i);
+		B[i] = make_vec3(i + 500);
+	}
+
+	Harness.run(Case, "AoS vec3", Samples, [&]()
+	{
+		for(std::size_t i = 0; i < Samples; ++i)
+			AoS[i] = glm::cross(A[i], B[i]);
+	});
+
+	glm::vec3_soa SoAA, SoAB, SoAOut;
+	glm::packSoA(&A[0], Samples, SoAA);
+	glm::packSoA(&B[0], Samples, SoAB);
+	for(int Set = glm::BATCH_SCALAR; Set <= Best; ++Set)
+	{
+		glm::setBatchInstructionSet(static_cast<glm::batch_instruction_set>(Set));
+		Harness.run(Case, VariantNames[Set], Samples, [&]() { glm::crossSoA(SoAA, SoAB, SoAOut); });
+		Error += check(AoS, SoAOut, 0.001f);
+	}
+
+	return Error;
+}
+
+static int comp_bounds(perf::harness& Harness, char const* Case, std::size_t Samples, glm::batch_instruction_set Best)
+{
+	int Error = 0;
+
+	std::vector<glm::vec3> In(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+		In[i] = make_vec3(i * 7);
+
+	glm::vec3 AoSMin(In[0]), AoSMax(In[0]);
+	Harness.run(Case, "AoS vec3", Samples, [&]()
+	{
+		AoSMin = AoSMax = In[0];
+		for(std::size_t i = 1; i < Samples; ++i)
+		{
+			AoSMin = glm::min(AoSMin, In[i]);
+			AoSMax = glm::max(AoSMax, In[i]);
+		}
+	});
+
+	glm::vec3_soa SoAIn;
+	glm::packSoA(&In[0], Samples, SoAIn);
+	for(int Set = glm::BATCH_SCALAR; Set <= Best; ++Set)
+	{
+		glm::vec3 Min(0.0f), Max(0.0f);
+		glm::setBatchInstructionSet(static_cast<glm::batch_instruction_set>(Set));
+		Harness.run(Case, VariantNames[Set], Samples, [&]() { glm::boundsSoA(SoAIn, Min, Max); });
+		Error += Min == AoSMin && Max == AoSMax ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int comp_mat4_mul(perf::harness& Harness, char const* Case, std::size_t Samples, glm::batch_instruction_set Best)
+{
+	int Error = 0;
+
+	glm::mat4 const ViewProj = glm::translate(glm::mat4(1.0f), glm::vec3(0.5f, -1.0f, 2.0f));
+	std::vector<glm::mat4> Models(Samples), AoS(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+		Models[i] = glm::translate(glm::mat4(1.0f), make_vec3(i));
+
+	Harness.run(Case, "AoS mat4", Samples, [&]()
+	{
+		for(std::size_t i = 0; i < Samples; ++i)
+			AoS[i] = ViewProj * Models[i];
+	});
+
+	glm::mat4_soa SoAModels, SoAOut;
+	glm::packSoA(&Models[0], Samples, SoAModels);
+	for(int Set = glm::BATCH_SCALAR; Set <= Best; ++Set)
+	{
+		glm::setBatchInstructionSet(static_cast<glm::batch_instruction_set>(Set));
+		Harness.run(Case, VariantNames[Set], Samples, [&]() { glm::mulSoA(ViewProj, SoAModels, SoAOut); });
+		for(std::size_t i = 0; i < Samples; ++i)
+			Error += glm::all(glm::equal(AoS[i], SoAOut.get(i), 0.001f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+// The cost of converting, to weigh against the savings above when the data has to go back to AoS.
+static int comp_pack(perf::harness& Harness, char const* Case, std::size_t Samples)
+{
+	int Error = 0;
+
+	std::vector<vertex> Vertices(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		Vertices[i].Position = make_vec3(i);
+		Vertices[i].Normal = glm::vec3(0.0f, 1.0f, 0.0f);
+		Vertices[i].TexCoord = glm::vec2(0.0f);
+	}
+
+	std::vector<glm::vec3> Copy(Samples);
+	Harness.run(Case, "AoS copy", Samples, [&]()
+	{
+		for(std::size_t i = 0; i < Samples; ++i)
+			Copy[i] = Vertices[i].Position;
+	});
+
+	glm::vec3_soa Positions;
+	Harness.run(Case, "packSoA", Samples, [&]() { glm::packSoA(&Vertices[0].Position, Samples, Positions, sizeof(vertex)); });
+	Harness.run(Case, "unpackSoA", Samples, [&]() { glm::unpackSoA(Positions, &Vertices[0].Position, sizeof(vertex)); });
+	Error += check(Copy, Positions, 0.0f);
+
+	return Error;
+}
+
+int main(int argc, char* argv[])
+{
+	perf::harness Harness("perf_soa", argc, argv);
+
+	int Error = 0;
+
+	glm::batch_instruction_set const Supported = glm::setBatchInstructionSet(glm::BATCH_AVX512);
+	glm::batch_instruction_set const Best = Supported < glm::BATCH_AVX2 ? Supported : glm::BATCH_AVX2;
+
+	for(std::size_t i = 0; i < Harness.sizes().size(); ++i)
+	{
+		std::size_t const Samples = Harness.sizes()[i];
+
+		Error += comp_transform(Harness, "mat4 * vec3 point", Samples, Best);
+		Error += comp_normalize(Harness, "normalize(vec3)", Samples, Best);
+		Error += comp_dot(Harness, "dot(vec3, vec3)", Samples, Best);
+		Error += comp_cross(Harness, "cross(vec3, vec3)", Samples, Best);
+		Error += comp_bounds(Harness, "bounds(vec3)", Samples, Best);
+		Error += comp_mat4_mul(Harness, "mat4 * mat4", Samples, Best);
+		Error += comp_pack(Harness, "vertex position AoS <-> SoA", Samples);
+	}
+
+	return Harness.finish(Error);
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
@@ -0,0 +1,118 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/fast_transcendental.hpp>
+#include <glm/gtx/fast_trigonometry.hpp>
+#include <glm/gtx/fast_exponential.hpp>
+#include <glm/ext/vector_float4.hpp>
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#include "perf_harness.hpp"
+#include <cmath>
+#include <vector>
+
+// The transcendental kernels use AVX2 when AVX-512 is requested, so they are measured up to AVX2.
+static char const* const VariantNames[] = {"batch scalar", "batch SSE2", "batch AVX2"};
+
+static int check(std::vector<float> const& Expected, std::vector<float> const& Result, float Tolerance)
+{
+	int Error = 0;
+	for(std::size_t i = 0; i < Expected.size(); ++i)
+		Error += glm::abs(Expected[i] - Result[i]) <= Tolerance * (1.0f + glm::abs(Expected[i])) ? 0 : 1;
+	return Error;
+}
+
+// Each case times libm, the matching GLM_GTX_fast_trigonometry or GLM_GTX_fast_exponential function
+// (faster, much less accurate, not checked), approx* on vec4 and the batch kernels.
+template <typename libmFunc, typename fastFunc, typename vec4Func, typename batchFunc>
+static int comp_function(perf::harness& Harness, char const* Case, char const* FastName, std::vector<float> const& In, glm::batch_instruction_set Best, float Tolerance,
+	libmFunc Libm, fastFunc Fast, vec4Func Vec4, batchFunc Batch)
+{
+	int Error = 0;
+
+	std::size_t const Samples = In.size();
+	std::vector<float> Expected(Samples), Result(Samples);
+
+	Harness.run(Case, "libm", Samples, [&]()
+	{
+		for(std::size_t i = 0; i < Samples; ++i)
+			Expected[i] = Libm(In[i]);
+	});
+	Harness.run(Case, FastName, Samples, [&]()
+	{
+		for(std::size_t i = 0; i < Samples; ++i)
+			Result[i] = Fast(In[i]);
+	});
+	Harness.run(Case, "approx vec4", Samples, [&]()
+	{
+		for(std::size_t i = 0; i + 4 <= Samples; i += 4)
+		{
+			glm::vec4 const r = Vec4(glm::vec4(In[i], In[i + 1], In[i + 2], In[i + 3]));
+			Result[i] = r.x; Result[i + 1] = r.y; Result[i + 2] = r.z; Result[i + 3] = r.w;
+		}
+	});
+	for(std::size_t i = Samples & ~std::size_t(3); i < Samples; ++i)
+		Result[i] = Libm(In[i]);
+	Error += check(Expected, Result, Tolerance);
+
+	for(int Set = glm::BATCH_SCALAR; Set <= Best; ++Set)
+	{
+		glm::setBatchInstructionSet(static_cast<glm::batch_instruction_set>(Set));
+		Harness.run(Case, VariantNames[Set], Samples, [&]() { Batch(&In[0], &Result[0], Samples); });
+		Error += check(Expected, Result, Tolerance);
+	}
+
+	return Error;
+}
+
+static float libm_sin(float x) { return std::sin(x); }
+static float libm_cos(float x) { return std::cos(x); }
+static float libm_exp(float x) { return std::exp(x); }
+static float libm_log(float x) { return std::log(x); }
+static float libm_gamma(float x) { return std::pow(x, 1.0f / 2.2f); }
+static float fast_gamma(float x) { return glm::fastPow(x, 1.0f / 2.2f); }
+static glm::vec4 approx_sin(glm::vec4 const& x) { return glm::approxSin(x); }
+static glm::vec4 approx_cos(glm::vec4 const& x) { return glm::approxCos(x); }
+static glm::vec4 approx_exp(glm::vec4 const& x) { return glm::approxExp(x); }
+static glm::vec4 approx_log(glm::vec4 const& x) { return glm::approxLog(x); }
+static glm::vec4 approx_gamma(glm::vec4 const& x) { return glm::approxPow(x, glm::vec4(1.0f / 2.2f)); }
+static void batch_gamma(float const* In, float* Out, std::size_t Count) { glm::powBatch(In, 1.0f / 2.2f, Out, Count); }
+
+int main(int argc, char* argv[])
+{
+	perf::harness Harness("perf_transcendental", argc, argv);
+
+	int Error = 0;
+
+	glm::batch_instruction_set const Supported = glm::setBatchInstructionSet(glm::BATCH_AVX512);
+	glm::batch_instruction_set const Best = Supported < glm::BATCH_AVX2 ? Supported : glm::BATCH_AVX2;
+
+	for(std::size_t i = 0; i < Harness.sizes().size(); ++i)
+	{
+		std::size_t const Samples = Harness.sizes()[i];
+
+		std::vector<float> Angle(Samples), Exponent(Samples), Positive(Samples);
+		for(std::size_t j = 0; j < Samples; ++j)
+		{
+			float const f = static_cast<float>(j % 1000) / 1000.0f;
+			Angle[j] = (f - 0.5f) * 20.0f;
+			Exponent[j] = (f - 0.5f) * 40.0f;
+			Positive[j] = 0.001f + f * 100.0f;
+		}
+
+		Error += comp_function(Harness, "sin", "fastSin", Angle, Best, 1e-6f, libm_sin, glm::fastSin<float>, approx_sin, glm::sinBatch);
+		Error += comp_function(Harness, "cos", "fastCos", Angle, Best, 1e-6f, libm_cos, glm::fastCos<float>, approx_cos, glm::cosBatch);
+		Error += comp_function(Harness, "exp", "fastExp", Exponent, Best, 1e-6f, libm_exp, glm::fastExp<float>, approx_exp, glm::expBatch);
+		Error += comp_function(Harness, "log", "fastLog", Positive, Best, 1e-6f, libm_log, glm::fastLog<float>, approx_log, glm::logBatch);
+		Error += comp_function(Harness, "pow(x, 1 / 2.2)", "fastPow", Positive, Best, 1e-5f, libm_gamma, fast_gamma, approx_gamma, batch_gamma);
+	}
+
+	return Harness.finish(Error);
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
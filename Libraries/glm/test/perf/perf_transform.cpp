@@ -0,0 +1,89 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/matrix_batch.hpp>
+#include <glm/ext/matrix_float4x4.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/vector_float3.hpp>
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#include <glm/gtc/type_aligned.hpp>
+#include "perf_harness.hpp"
+#include <vector>
+
+template <typename matType, typename vecType>
+static void test_compose(std::vector<vecType> const& T, std::vector<float> const& A, std::vector<vecType> const& S, std::vector<matType>& O)
+{
+	vecType const Axis(0.0f, 0.6f, 0.8f);
+	for(std::size_t i = 0, n = O.size(); i < n; ++i)
+		O[i] = glm::scale(glm::rotate(glm::translate(matType(1.0f), T[i]), A[i], Axis), S[i]);
+}
+
+static int comp_translate_rotate_scale(perf::harness& Harness, char const* Case, std::size_t Samples)
+{
+	int Error = 0;
+
+	std::vector<glm::vec3> T(Samples), S(Samples);
+	std::vector<glm::aligned_vec3> AlignedT(Samples), AlignedS(Samples);
+	std::vector<float> A(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		float const f = static_cast<float>(i % 1000);
+		T[i] = glm::vec3(f, -f, 0.5f * f);
+		S[i] = glm::vec3(1.0f + f * 0.001f, 2.0f, 0.5f);
+		A[i] = f * 0.00628f;
+		AlignedT[i] = glm::aligned_vec3(T[i]);
+		AlignedS[i] = glm::aligned_vec3(S[i]);
+	}
+
+	std::vector<glm::mat4> SISD(Samples), Batch(Samples), Translate(Samples), RotateScale(Samples);
+	std::vector<glm::aligned_mat4> SIMD(Samples);
+
+	Harness.run(Case, "SISD", Samples, [&]() { test_compose(T, A, S, SISD); });
+	Harness.run(Case, "SIMD", Samples, [&]() { test_compose(AlignedT, A, AlignedS, SIMD); });
+
+	// The batch variant builds the translation and the rotation * scale matrices, then composes them with one mulBatch call.
+	glm::setBatchInstructionSet(glm::BATCH_AVX512);
+	Harness.run(Case, "batch", Samples, [&]()
+	{
+		glm::vec3 const Axis(0.0f, 0.6f, 0.8f);
+		for(std::size_t i = 0; i < Samples; ++i)
+		{
+			Translate[i] = glm::translate(glm::mat4(1.0f), T[i]);
+			RotateScale[i] = glm::scale(glm::rotate(glm::mat4(1.0f), A[i], Axis), S[i]);
+		}
+		glm::mulBatch(&Translate[0], &RotateScale[0], &Batch[0], Samples);
+	});
+
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		Error += glm::all(glm::equal(SISD[i], glm::mat4(SIMD[i]), 0.01f)) ? 0 : 1;
+		Error += glm::all(glm::equal(SISD[i], Batch[i], 0.01f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int main(int argc, char* argv[])
+{
+	perf::harness Harness("perf_transform", argc, argv);
+
+	int Error = 0;
+
+	for(std::size_t i = 0; i < Harness.sizes().size(); ++i)
+	{
+		std::size_t const Samples = Harness.sizes()[i];
+
+		Error += comp_translate_rotate_scale(Harness, "translate * rotate * scale", Samples);
+	}
+
+	return Harness.finish(Error);
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
@@ -10,9 +10,8 @@
 #include <glm/ext/vector_float4.hpp>
 #if GLM_CONFIG_SIMD == GLM_ENABLE
 #include <glm/gtc/type_aligned.hpp>
+#include "perf_harness.hpp"
 #include <vector>
-#include <chrono>
-#include <cstdio>
 
 template <typename matType, typename vecType>
 static void test_vec_mul_mat(matType const& M, std::vector<vecType> const& I, std::vector<vecType>& O)
@@ -22,7 +21,7 @@ static void test_vec_mul_mat(matType const& M, std::vector<vecType> const& I, st
 }
 
 template <typename matType, typename vecType>
-static int launch_vec_mul_mat(std::vector<vecType>& O, matType const& Transform, vecType const& Scale, std::size_t Samples)
+static void launch_vec_mul_mat(perf::harness& Harness, char const* Case, char const* Variant, std::vector<vecType>& O, matType const& Transform, vecType const& Scale, std::size_t Samples)
 {
 	typedef typename matType::value_type T;
 
@@ -32,15 +31,11 @@ static int launch_vec_mul_mat(std::vector<vecType>& O, matType const& Transform,
 	for(std::size_t i = 0; i < Samples; ++i)
 		I[i] = Scale * static_cast<T>(i);
 
-	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
-	test_vec_mul_mat<matType, vecType>(Transform, I, O);
-	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
-
-	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+	Harness.run(Case, Variant, Samples, [&]() { test_vec_mul_mat<matType, vecType>(Transform, I, O); });
 }
 
 template <typename packedMatType, typename packedVecType, typename alignedMatType, typename alignedVecType>
-static int comp_vec2_mul_mat2(std::size_t Samples)
+static int comp_vec2_mul_mat2(perf::harness& Harness, char const* Case, std::size_t Samples)
 {
 	typedef typename packedMatType::value_type T;
 	
@@ -50,10 +45,10 @@ static int comp_vec2_mul_mat2(std::size_t Samples)
 	packedVecType const Scale(0.01, 0.02);
 
 	std::vector<packedVecType> SISD;
-	printf("- SISD: %d us\n", launch_vec_mul_mat<packedMatType, packedVecType>(SISD, Transform, Scale, Samples));
+	launch_vec_mul_mat<packedMatType, packedVecType>(Harness, Case, "SISD", SISD, Transform, Scale, Samples);
 
 	std::vector<alignedVecType> SIMD;
-	printf("- SIMD: %d us\n", launch_vec_mul_mat<alignedMatType, alignedVecType>(SIMD, Transform, Scale, Samples));
+	launch_vec_mul_mat<alignedMatType, alignedVecType>(Harness, Case, "SIMD", SIMD, Transform, Scale, Samples);
 
 	for(std::size_t i = 0; i < Samples; ++i)
 	{
@@ -66,7 +61,7 @@ static int comp_vec2_mul_mat2(std::size_t Samples)
 }
 
 template <typename packedMatType, typename packedVecType, typename alignedMatType, typename alignedVecType>
-static int comp_vec3_mul_mat3(std::size_t Samples)
+static int comp_vec3_mul_mat3(perf::harness& Harness, char const* Case, std::size_t Samples)
 {
 	typedef typename packedMatType::value_type T;
 	
@@ -76,10 +71,10 @@ static int comp_vec3_mul_mat3(std::size_t Samples)
 	packedVecType const Scale(0.01, 0.02, 0.05);
 
 	std::vector<packedVecType> SISD;
-	printf("- SISD: %d us\n", launch_vec_mul_mat<packedMatType, packedVecType>(SISD, Transform, Scale, Samples));
+	launch_vec_mul_mat<packedMatType, packedVecType>(Harness, Case, "SISD", SISD, Transform, Scale, Samples);
 
 	std::vector<alignedVecType> SIMD;
-	printf("- SIMD: %d us\n", launch_vec_mul_mat<alignedMatType, alignedVecType>(SIMD, Transform, Scale, Samples));
+	launch_vec_mul_mat<alignedMatType, alignedVecType>(Harness, Case, "SIMD", SIMD, Transform, Scale, Samples);
 
 	for(std::size_t i = 0; i < Samples; ++i)
 	{
@@ -92,7 +87,7 @@ static int comp_vec3_mul_mat3(std::size_t Samples)
 }
 
 template <typename packedMatType, typename packedVecType, typename alignedMatType, typename alignedVecType>
-static int comp_vec4_mul_mat4(std::size_t Samples)
+static int comp_vec4_mul_mat4(perf::harness& Harness, char const* Case, std::size_t Samples)
 {
 	typedef typename packedMatType::value_type T;
 	
@@ -102,10 +97,10 @@ static int comp_vec4_mul_mat4(std::size_t Samples)
 	packedVecType const Scale(0.01, 0.02, 0.03, 0.05);
 
 	std::vector<packedVecType> SISD;
-	printf("- SISD: %d us\n", launch_vec_mul_mat<packedMatType, packedVecType>(SISD, Transform, Scale, Samples));
+	launch_vec_mul_mat<packedMatType, packedVecType>(Harness, Case, "SISD", SISD, Transform, Scale, Samples);
 
 	std::vector<alignedVecType> SIMD;
-	printf("- SIMD: %d us\n", launch_vec_mul_mat<alignedMatType, alignedVecType>(SIMD, Transform, Scale, Samples));
+	launch_vec_mul_mat<alignedMatType, alignedVecType>(Harness, Case, "SIMD", SIMD, Transform, Scale, Samples);
 
 	for(std::size_t i = 0; i < Samples; ++i)
 	{
@@ -117,31 +112,25 @@ static int comp_vec4_mul_mat4(std::size_t Samples)
 	return Error;
 }
 
-int main()
+int main(int argc, char* argv[])
 {
-	std::size_t const Samples = 100000;
-	
-	int Error = 0;
-
-	printf("vec2 * mat2:\n");
-	Error += comp_vec2_mul_mat2<glm::mat2, glm::vec2, glm::aligned_mat2, glm::aligned_vec2>(Samples);
-	
-	printf("dvec2 * dmat2:\n");
-	Error += comp_vec2_mul_mat2<glm::dmat2, glm::dvec2,glm::aligned_dmat2, glm::aligned_dvec2>(Samples);
+	perf::harness Harness("perf_vector_mul_matrix", argc, argv);
 
-	printf("vec3 * mat3:\n");
-	Error += comp_vec3_mul_mat3<glm::mat3, glm::vec3, glm::aligned_mat3, glm::aligned_vec3>(Samples);
-	
-	printf("dvec3 * dmat3:\n");
-	Error += comp_vec3_mul_mat3<glm::dmat3, glm::dvec3, glm::aligned_dmat3, glm::aligned_dvec3>(Samples);
+	int Error = 0;
 
-	printf("vec4 * mat4:\n");
-	Error += comp_vec4_mul_mat4<glm::mat4, glm::vec4, glm::aligned_mat4, glm::aligned_vec4>(Samples);
-	
-	printf("dvec4 * dmat4:\n");
-	Error += comp_vec4_mul_mat4<glm::dmat4, glm::dvec4, glm::aligned_dmat4, glm::aligned_dvec4>(Samples);
+	for(std::size_t i = 0; i < Harness.sizes().size(); ++i)
+	{
+		std::size_t const Samples = Harness.sizes()[i];
+
+		Error += comp_vec2_mul_mat2<glm::mat2, glm::vec2, glm::aligned_mat2, glm::aligned_vec2>(Harness, "vec2 * mat2", Samples);
+		Error += comp_vec2_mul_mat2<glm::dmat2, glm::dvec2,glm::aligned_dmat2, glm::aligned_dvec2>(Harness, "dvec2 * dmat2", Samples);
+		Error += comp_vec3_mul_mat3<glm::mat3, glm::vec3, glm::aligned_mat3, glm::aligned_vec3>(Harness, "vec3 * mat3", Samples);
+		Error += comp_vec3_mul_mat3<glm::dmat3, glm::dvec3, glm::aligned_dmat3, glm::aligned_dvec3>(Harness, "dvec3 * dmat3", Samples);
+		Error += comp_vec4_mul_mat4<glm::mat4, glm::vec4, glm::aligned_mat4, glm::aligned_vec4>(Harness, "vec4 * mat4", Samples);
+		Error += comp_vec4_mul_mat4<glm::dmat4, glm::dvec4, glm::aligned_dmat4, glm::aligned_dvec4>(Harness, "dvec4 * dmat4", Samples);
+	}
 
-	return Error;
+	return Harness.finish(Error);
 }
 
 #else
@@ -231,6 +231,60 @@ RECENT REVISION HISTORY:
 //
 // ===========================================================================
 //
+// Multithreaded decoding
+//
+// Large JPEG and PNG images are decoded on several threads when the
+// implementation is compiled as C++11 or newer (it uses std::thread); C
+// builds always decode on the calling thread. What gets split up:
+//
+//   - baseline JPEGs with restart markers (DRI): restart intervals don't
+//     depend on each other, so the entropy decoding and IDCT are shared
+//     out between threads at the RST markers
+//   - all JPEGs: upsampling and color conversion, in bands of rows, and
+//     the dequantize/IDCT pass at the end of progressive JPEGs
+//   - PNGs, after inflate: a row filtered with "none" or "sub" doesn't
+//     read the row above it, so the runs of rows between those are
+//     unfiltered on different threads; the bit depth expansion and byte
+//     swapping passes are split in bands of rows
+//
+// Small images always stay on the calling thread, and valid files decode to
+// the same pixels either way (a corrupt restart interval only spoils its own
+// MCUs when decoded in parallel, instead of failing the whole image). By
+// default there's one thread per core:
+//
+//     stbi_set_decode_thread_count(1);   // decode on the calling thread only
+//
+// Define STBI_NO_THREADS to leave the threading out altogether.
+//
+// ===========================================================================
+//
+// Decoding into your own memory
+//
+// stbi_load_into and friends write the pixels into a buffer you provide,
+// such as mapped staging memory for a texture upload, instead of returning
+// one stb allocated:
+//
+//     int x,y,n;
+//     stbi_info(filename, &x, &y, &n);
+//     // ... get row_pitch * y bytes of memory at dest ...
+//     ok = stbi_load_into(filename, dest, x, y, row_pitch, &n, 4);
+//
+// desired_channels is required (1..4). Row j of the image starts at
+// dest + j*row_pitch and row_pitch must be at least x*desired_channels; the
+// bytes between the end of a row and the next are left alone. The image has
+// to be exactly x by y pixels, otherwise the load fails with "size mismatch"
+// (the file may have changed since stbi_info looked at it). Returns 1 on
+// success, 0 on failure; after a failure the destination may be partly
+// written.
+//
+// 8-bit JPEGs and non-interlaced 8-bit-or-less PNGs that already have the
+// requested number of channels (which includes grey/RGB to RGBA expansion for
+// JPEG, RGB to RGBA and palettes to RGB/RGBA for PNG) are decoded straight
+// into the destination. Everything else, and any image while vertical
+// flipping is on, is decoded the usual way and then copied over row by row.
+//
+// ===========================================================================
+//
 // HDR image support   (disable by defining STBI_NO_HDR)
 //
 // stb_image supports loading HDR images in general, and currently the Radiance
@@ -382,6 +436,15 @@ STBIDEF stbi_uc *stbi_load_from_file  (FILE *f, int *x, int *y, int *channels_in
 STBIDEF stbi_uc *stbi_load_gif_from_memory(stbi_uc const *buffer, int len, int **delays, int *x, int *y, int *z, int *comp, int req_comp);
 #endif
 
+// decode into a caller provided buffer, see "Decoding into your own memory" above
+STBIDEF int stbi_load_from_memory_into   (stbi_uc           const *buffer, int len   , stbi_uc *dest, int x, int y, int row_pitch, int *channels_in_file, int desired_channels);
+STBIDEF int stbi_load_from_callbacks_into(stbi_io_callbacks const *clbk  , void *user, stbi_uc *dest, int x, int y, int row_pitch, int *channels_in_file, int desired_channels);
+
+#ifndef STBI_NO_STDIO
+STBIDEF int stbi_load_into          (char const *filename, stbi_uc *dest, int x, int y, int row_pitch, int *channels_in_file, int desired_channels);
+STBIDEF int stbi_load_from_file_into(FILE *f, stbi_uc *dest, int x, int y, int row_pitch, int *channels_in_file, int desired_channels);
+#endif
+
 #ifdef STBI_WINDOWS_UTF8
 STBIDEF int stbi_convert_wchar_to_utf8(char *buffer, size_t bufferlen, const wchar_t* input);
 #endif
@@ -466,6 +529,10 @@ STBIDEF void stbi_convert_iphone_png_to_rgb(int flag_true_if_should_convert);
 // flip the image vertically, so the first pixel in the output array is the bottom left
 STBIDEF void stbi_set_flip_vertically_on_load(int flag_true_if_should_flip);
 
+// upper limit of threads used to decode one large image, 0 (the default) for one per core.
+// see "Multithreaded decoding" above.
+STBIDEF void stbi_set_decode_thread_count(int thread_count);
+
 // ZLIB client - used by PNG, available for other purposes
 
 STBIDEF char *stbi_zlib_decode_malloc_guesssize(const char *buffer, int len, int initial_size, int *outlen);
@@ -540,6 +607,12 @@ STBIDEF int   stbi_zlib_decode_noheader_buffer(char *obuffer, int olen, const ch
 #include <stdio.h>
 #endif
 
+// MSVC reports __cplusplus as 199711L unless /Zc:__cplusplus is given
+#if defined(__cplusplus) && (__cplusplus >= 201103L || (defined(_MSC_VER) && _MSC_VER >= 1900)) && !defined(STBI_NO_THREADS)
+#define STBI__THREADS
+#include <thread>
+#endif
+
 #ifndef STBI_ASSERT
 #include <assert.h>
 #define STBI_ASSERT(x) assert(x)
@@ -568,12 +641,14 @@ typedef unsigned short stbi__uint16;
 typedef   signed short stbi__int16;
 typedef unsigned int   stbi__uint32;
 typedef   signed int   stbi__int32;
+typedef unsigned __int64 stbi__uint64;
 #else
 #include <stdint.h>
 typedef uint16_t stbi__uint16;
 typedef int16_t  stbi__int16;
 typedef uint32_t stbi__uint32;
 typedef int32_t  stbi__int32;
+typedef uint64_t stbi__uint64;
 #endif
 
 // should produce compiler error if size is wrong
@@ -734,6 +809,10 @@ typedef struct
 
    stbi_uc *img_buffer, *img_buffer_end;
    stbi_uc *img_buffer_original, *img_buffer_original_end;
+
+   // stbi_load_into destination, NULL for the allocating loaders
+   stbi_uc *dest;
+   int dest_x, dest_y, dest_pitch;
 } stbi__context;
 
 
@@ -746,6 +825,7 @@ static void stbi__start_mem(stbi__context *s, stbi_uc const *buffer, int len)
    s->read_from_callbacks = 0;
    s->img_buffer = s->img_buffer_original = (stbi_uc *) buffer;
    s->img_buffer_end = s->img_buffer_original_end = (stbi_uc *) buffer+len;
+   s->dest = NULL;
 }
 
 // initialize a callback-based context
@@ -758,6 +838,7 @@ static void stbi__start_callbacks(stbi__context *s, stbi_io_callbacks *c, void *
    s->img_buffer_original = s->buffer_start;
    stbi__refill_buffer(s);
    s->img_buffer_original_end = s->img_buffer_end;
+   s->dest = NULL;
 }
 
 #ifndef STBI_NO_STDIO
@@ -1001,6 +1082,92 @@ STBIDEF void stbi_set_flip_vertically_on_load(int flag_true_if_should_flip)
     stbi__vertically_flip_on_load = flag_true_if_should_flip;
 }
 
+#if !defined(STBI_NO_JPEG) || !defined(STBI_NO_PNG)
+// where a loader can put its 8-bit output directly for stbi_load_into, once it
+// knows the image size; NULL if it has to allocate the image as usual
+static stbi_uc *stbi__load_dest(stbi__context *s, int *pitch)
+{
+   if (!s->dest || stbi__vertically_flip_on_load) return NULL;
+   if (s->img_x != (stbi__uint32) s->dest_x || s->img_y != (stbi__uint32) s->dest_y) return NULL;
+   *pitch = s->dest_pitch;
+   return s->dest;
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  parallel decoding
+//
+//  work is split into `tasks` contiguous ranges of items (rows, restart
+//  intervals...); task 0 runs on the calling thread, the others each get a
+//  thread of their own for the duration of the call
+
+#define STBI__MAX_THREADS  64
+
+static int stbi__decode_thread_count = 0;
+
+STBIDEF void stbi_set_decode_thread_count(int thread_count)
+{
+   stbi__decode_thread_count = thread_count;
+}
+
+#if !defined(STBI_NO_JPEG) || !defined(STBI_NO_PNG)
+typedef void (*stbi__task_func)(void *ctx, int task, int first, int last);
+
+// how many tasks to split `count` items into, with at least min_items each
+static int stbi__parallel_tasks(int count, int min_items)
+{
+   int threads = stbi__decode_thread_count;
+#ifdef STBI__THREADS
+   if (threads <= 0) threads = (int) std::thread::hardware_concurrency();
+#else
+   threads = 1;
+#endif
+   if (threads > STBI__MAX_THREADS) threads = STBI__MAX_THREADS;
+   if (min_items < 1) min_items = 1;
+   if (threads > count / min_items) threads = count / min_items;
+   return threads < 1 ? 1 : threads;
+}
+
+#ifdef STBI__THREADS
+static int stbi__spawn(std::thread *thread, stbi__task_func func, void *ctx, int task, int first, int last)
+{
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+   try {
+      *thread = std::thread(func, ctx, task, first, last);
+   } catch (...) {
+      return 0; // out of threads: the caller runs the task itself
+   }
+#else
+   *thread = std::thread(func, ctx, task, first, last);
+#endif
+   return 1;
+}
+#endif
+
+static void stbi__parallel_run(int tasks, int count, stbi__task_func func, void *ctx)
+{
+   int t, base = count / tasks, extra = count % tasks;
+#ifdef STBI__THREADS
+   std::thread threads[STBI__MAX_THREADS];
+#endif
+   for (t = tasks-1; t >= 0; --t) {
+      int first = t*base + (t < extra ? t : extra);
+      int last  = first + base + (t < extra ? 1 : 0);
+#ifdef STBI__THREADS
+      if (t > 0 && stbi__spawn(&threads[t], func, ctx, t, first, last))
+         continue;
+#endif
+      func(ctx, t, first, last);
+   }
+#ifdef STBI__THREADS
+   for (t = 1; t < tasks; ++t)
+      if (threads[t].joinable())
+         threads[t].join();
+#endif
+}
+#endif
+
 static void *stbi__load_main(stbi__context *s, int *x, int *y, int *comp, int req_comp, stbi__result_info *ri, int bpc)
 {
    memset(ri, 0, sizeof(*ri)); // make sure it's initialized if we add new fields
@@ -1165,6 +1332,45 @@ static stbi__uint16 *stbi__load_and_postprocess_16bit(stbi__context *s, int *x,
    return (stbi__uint16 *) result;
 }
 
+static int stbi__load_into_main(stbi__context *s, stbi_uc *dest, int x, int y, int row_pitch, int *comp, int req_comp)
+{
+   stbi__result_info ri;
+   void *result;
+   int w, h, j;
+   size_t row;
+
+   if (req_comp < 1 || req_comp > 4) return stbi__err("bad req_comp", "Internal error");
+   if (x <= 0 || y <= 0 || row_pitch / req_comp < x) return stbi__err("bad dest", "Destination rows too small");
+
+   s->dest = dest;
+   s->dest_x = x;
+   s->dest_y = y;
+   s->dest_pitch = row_pitch;
+   result = stbi__load_main(s, &w, &h, comp, req_comp, &ri, 8);
+   s->dest = NULL;
+
+   if (result == NULL) return 0;
+   if (result == dest) return 1; // the loader wrote it in place
+
+   if (w != x || h != y) {
+      STBI_FREE(result);
+      return stbi__err("size mismatch", "Image is not the size of the destination");
+   }
+   if (ri.bits_per_channel != 8) {
+      STBI_ASSERT(ri.bits_per_channel == 16);
+      result = stbi__convert_16_to_8((stbi__uint16 *) result, w, h, req_comp);
+      if (result == NULL) return 0;
+   }
+
+   row = (size_t) w * req_comp;
+   for (j=0; j < h; ++j) {
+      int src = stbi__vertically_flip_on_load ? h-1 - j : j;
+      memcpy(dest + (size_t) j * row_pitch, (stbi_uc *) result + src * row, row);
+   }
+   STBI_FREE(result);
+   return 1;
+}
+
 #if !defined(STBI_NO_HDR) && !defined(STBI_NO_LINEAR)
 static void stbi__float_postprocess(float *result, int *x, int *y, int *comp, int req_comp)
 {
@@ -1241,6 +1447,29 @@ STBIDEF stbi_uc *stbi_load_from_file(FILE *f, int *x, int *y, int *comp, int req
    return result;
 }
 
+STBIDEF int stbi_load_into(char const *filename, stbi_uc *dest, int x, int y, int row_pitch, int *comp, int req_comp)
+{
+   FILE *f = stbi__fopen(filename, "rb");
+   int result;
+   if (!f) return stbi__err("can't fopen", "Unable to open file");
+   result = stbi_load_from_file_into(f,dest,x,y,row_pitch,comp,req_comp);
+   fclose(f);
+   return result;
+}
+
+STBIDEF int stbi_load_from_file_into(FILE *f, stbi_uc *dest, int x, int y, int row_pitch, int *comp, int req_comp)
+{
+   int result;
+   stbi__context s;
+   stbi__start_file(&s,f);
+   result = stbi__load_into_main(&s,dest,x,y,row_pitch,comp,req_comp);
+   if (result) {
+      // need to 'unget' all the characters in the IO buffer
+      fseek(f, - (int) (s.img_buffer_end - s.img_buffer), SEEK_CUR);
+   }
+   return result;
+}
+
 STBIDEF stbi__uint16 *stbi_load_from_file_16(FILE *f, int *x, int *y, int *comp, int req_comp)
 {
    stbi__uint16 *result;
@@ -1295,6 +1524,20 @@ STBIDEF stbi_uc *stbi_load_from_callbacks(stbi_io_callbacks const *clbk, void *u
    return stbi__load_and_postprocess_8bit(&s,x,y,comp,req_comp);
 }
 
+STBIDEF int stbi_load_from_memory_into(stbi_uc const *buffer, int len, stbi_uc *dest, int x, int y, int row_pitch, int *comp, int req_comp)
+{
+   stbi__context s;
+   stbi__start_mem(&s,buffer,len);
+   return stbi__load_into_main(&s,dest,x,y,row_pitch,comp,req_comp);
+}
+
+STBIDEF int stbi_load_from_callbacks_into(stbi_io_callbacks const *clbk, void *user, stbi_uc *dest, int x, int y, int row_pitch, int *comp, int req_comp)
+{
+   stbi__context s;
+   stbi__start_callbacks(&s, (stbi_io_callbacks *) clbk, user);
+   return stbi__load_into_main(&s,dest,x,y,row_pitch,comp,req_comp);
+}
+
 #ifndef STBI_NO_GIF
 STBIDEF stbi_uc *stbi_load_gif_from_memory(stbi_uc const *buffer, int len, int **delays, int *x, int *y, int *z, int *comp, int req_comp)
 {
@@ -1811,6 +2054,10 @@ typedef struct
    int scan_n, order[4];
    int restart_interval, todo;
 
+// rest of a callback stream, read into memory to split it between threads
+   stbi_uc *scan_buffer;
+   int (*scan_read)(void *user, char *data, int size);
+
 // kernels
    void (*idct_block_kernel)(stbi_uc *out, int out_stride, short data[64]);
    void (*YCbCr_to_RGB_kernel)(stbi_uc *out, const stbi_uc *y, const stbi_uc *pcb, const stbi_uc *pcr, int count, int step);
@@ -2749,8 +2996,194 @@ static void stbi__jpeg_reset(stbi__jpeg *j)
    // since we don't even allow 1<<30 pixels
 }
 
+// decode and idct one MCU of a baseline scan at column i, row j; in a
+// non-interleaved scan that's a single block
+static int stbi__jpeg_decode_mcu(stbi__jpeg *z, short data[64], int i, int j)
+{
+   int k,x,y;
+   if (z->scan_n == 1) {
+      int n = z->order[0];
+      int ha = z->img_comp[n].ha;
+      if (!stbi__jpeg_decode_block(z, data, z->huff_dc+z->img_comp[n].hd, z->huff_ac+ha, z->fast_ac[ha], n, z->dequant[z->img_comp[n].tq])) return 0;
+      z->idct_block_kernel(z->img_comp[n].data+z->img_comp[n].w2*j*8+i*8, z->img_comp[n].w2, data);
+      return 1;
+   }
+   // scan an interleaved mcu... process scan_n components in order
+   for (k=0; k < z->scan_n; ++k) {
+      int n = z->order[k];
+      // scan out an mcu's worth of this component; that's just determined
+      // by the basic H and V specified for the component
+      for (y=0; y < z->img_comp[n].v; ++y) {
+         for (x=0; x < z->img_comp[n].h; ++x) {
+            int x2 = (i*z->img_comp[n].h + x)*8;
+            int y2 = (j*z->img_comp[n].v + y)*8;
+            int ha = z->img_comp[n].ha;
+            if (!stbi__jpeg_decode_block(z, data, z->huff_dc+z->img_comp[n].hd, z->huff_ac+ha, z->fast_ac[ha], n, z->dequant[z->img_comp[n].tq])) return 0;
+            z->idct_block_kernel(z->img_comp[n].data+z->img_comp[n].w2*y2+x2, z->img_comp[n].w2, data);
+         }
+      }
+   }
+   return 1;
+}
+
+// baseline scans with a restart interval can be split between threads at the
+// RST markers: every interval starts byte aligned, with the dc predictions
+// reset, so it decodes without knowing anything about the ones before it
+
+#define STBI__JPEG_MIN_TASK_MCUS  1024
+
+typedef struct
+{
+   stbi__jpeg *z;
+   stbi_uc **interval; // entropy coded data of each restart interval
+   stbi_uc *end;
+   int mcu_x, mcu_count;
+   int ok[STBI__MAX_THREADS];
+} stbi__jpeg_intervals;
+
+static void stbi__jpeg_decode_intervals(void *ctx, int task, int first, int last)
+{
+   stbi__jpeg_intervals *job = (stbi__jpeg_intervals *) ctx;
+   stbi__jpeg *z = (stbi__jpeg *) stbi__malloc(sizeof(stbi__jpeg));
+   stbi__context s;
+   STBI_SIMD_ALIGN(short, data[64]);
+   int k, mcu;
+
+   job->ok[task] = 0;
+   if (!z) return;
+   // private bit reader and dc predictions, shared tables and component planes
+   memcpy(z, job->z, sizeof(*z));
+   z->s = &s;
+   for (k=first; k < last; ++k) {
+      int end = (k+1) * z->restart_interval;
+      if (end > job->mcu_count) end = job->mcu_count;
+      stbi__start_mem(&s, job->interval[k], (int) (job->end - job->interval[k]));
+      stbi__jpeg_reset(z);
+      for (mcu = k * z->restart_interval; mcu < end; ++mcu)
+         if (!stbi__jpeg_decode_mcu(z, data, mcu % job->mcu_x, mcu / job->mcu_x)) { STBI_FREE(z); return; }
+   }
+   job->ok[task] = 1;
+   STBI_FREE(z);
+}
+
+// read the rest of a callback stream into memory and decode from there
+static int stbi__jpeg_buffer_stream(stbi__jpeg *z)
+{
+   stbi__context *s = z->s;
+   int len = (int) (s->img_buffer_end - s->img_buffer), size = len + (1 << 16), n;
+   stbi_uc *buffer = (stbi_uc *) stbi__malloc(size);
+   if (!buffer) return 0;
+   memcpy(buffer, s->img_buffer, len);
+   for (;;) {
+      if (len == size) {
+         stbi_uc *p;
+         if (size > INT_MAX / 2) { STBI_FREE(buffer); return 0; }
+         p = (stbi_uc *) STBI_REALLOC_SIZED(buffer, size, size * 2);
+         if (!p) { STBI_FREE(buffer); return 0; }
+         buffer = p;
+         size *= 2;
+      }
+      n = (s->io.read)(s->io_user_data, (char *) buffer + len, size - len);
+      if (n <= 0) break;
+      len += n;
+   }
+   z->scan_buffer = buffer;
+   z->scan_read = s->io.read;
+   s->io.read = NULL;
+   s->read_from_callbacks = 0;
+   s->img_buffer = buffer;
+   s->img_buffer_end = buffer + len;
+   return 1;
+}
+
+// hand what's left of the buffered stream back to the callbacks
+static void stbi__jpeg_unbuffer_stream(stbi__jpeg *z)
+{
+   stbi__context *s = z->s;
+   if (!z->scan_buffer) return;
+   s->io.read = z->scan_read;
+   s->read_from_callbacks = 1;
+#ifndef STBI_NO_STDIO
+   // stbi_load_from_file leaves the file right after the image
+   if (s->io.read == stbi__stdio_read && s->img_buffer < s->img_buffer_end)
+      (s->io.skip)(s->io_user_data, - (int) (s->img_buffer_end - s->img_buffer));
+#endif
+   s->img_buffer = s->img_buffer_end = s->buffer_start;
+   STBI_FREE(z->scan_buffer);
+   z->scan_buffer = NULL;
+}
+
+// returns -1 if the scan isn't worth splitting or doesn't have the expected
+// restart markers, and it's left for the serial decoder
+static int stbi__jpeg_decode_parallel(stbi__jpeg *z)
+{
+   stbi__jpeg_intervals job;
+   stbi_uc *p, *end;
+   int intervals, count, tasks, k;
+
+   if (z->progressive || z->restart_interval <= 0) return -1;
+   if (z->scan_n == 1) {
+      int n = z->order[0];
+      job.mcu_x = (z->img_comp[n].x+7) >> 3;
+      job.mcu_count = job.mcu_x * ((z->img_comp[n].y+7) >> 3);
+   } else {
+      job.mcu_x = z->img_mcu_x;
+      job.mcu_count = z->img_mcu_x * z->img_mcu_y;
+   }
+   intervals = (job.mcu_count + z->restart_interval - 1) / z->restart_interval;
+   tasks = stbi__parallel_tasks(intervals, (STBI__JPEG_MIN_TASK_MCUS + z->restart_interval - 1) / z->restart_interval);
+   if (tasks <= 1) return -1;
+
+   if (z->s->read_from_callbacks && !z->scan_buffer)
+      if (!stbi__jpeg_buffer_stream(z)) return stbi__err("outofmem", "Out of memory");
+
+   job.interval = (stbi_uc **) stbi__malloc_mad2(intervals, sizeof(stbi_uc *), 0);
+   if (!job.interval) return stbi__err("outofmem", "Out of memory");
+
+   // find the start of every interval, and the marker after the scan
+   p = z->s->img_buffer;
+   end = z->s->img_buffer_end;
+   job.interval[0] = p;
+   count = 1;
+   while (p+1 < end) {
+      if (p[0] != 0xff) {
+         p = (stbi_uc *) memchr(p, 0xff, end - p);
+         if (!p) { p = end; break; }
+         continue;
+      }
+      if (p[1] == 0x00 || p[1] == 0xff) { // stuffed zero or fill byte
+         p += 1 + (p[1] == 0x00);
+         continue;
+      }
+      if (!STBI__RESTART(p[1])) break;
+      if (count == intervals) { count = -1; break; }
+      job.interval[count++] = p+2;
+      p += 2;
+   }
+   if (count != intervals) { STBI_FREE(job.interval); return -1; }
+
+   job.z = z;
+   job.end = end;
+   stbi__parallel_run(tasks, intervals, stbi__jpeg_decode_intervals, &job);
+   STBI_FREE(job.interval);
+   for (k=0; k < tasks; ++k)
+      if (!job.ok[k]) return stbi__err("bad huffman code", "Corrupt JPEG");
+
+   // carry on after the scan like the serial decoder does
+   if (p+1 < end) {
+      z->marker = p[1];
+      z->s->img_buffer = p+2;
+   } else {
+      z->marker = STBI__MARKER_none;
+      z->s->img_buffer = end;
+   }
+   return 1;
+}
+
 static int stbi__parse_entropy_coded_data(stbi__jpeg *z)
 {
+   int parallel = stbi__jpeg_decode_parallel(z);
+   if (parallel >= 0) return parallel;
    stbi__jpeg_reset(z);
    if (!z->progressive) {
       if (z->scan_n == 1) {
@@ -2765,9 +3198,7 @@ static int stbi__parse_entropy_coded_data(stbi__jpeg *z)
          int h = (z->img_comp[n].y+7) >> 3;
          for (j=0; j < h; ++j) {
             for (i=0; i < w; ++i) {
-               int ha = z->img_comp[n].ha;
-               if (!stbi__jpeg_decode_block(z, data, z->huff_dc+z->img_comp[n].hd, z->huff_ac+ha, z->fast_ac[ha], n, z->dequant[z->img_comp[n].tq])) return 0;
-               z->idct_block_kernel(z->img_comp[n].data+z->img_comp[n].w2*j*8+i*8, z->img_comp[n].w2, data);
+               if (!stbi__jpeg_decode_mcu(z, data, i, j)) return 0;
                // every data block is an MCU, so countdown the restart interval
                if (--z->todo <= 0) {
                   if (z->code_bits < 24) stbi__grow_buffer_unsafe(z);
@@ -2780,25 +3211,11 @@ static int stbi__parse_entropy_coded_data(stbi__jpeg *z)
          }
          return 1;
       } else { // interleaved
-         int i,j,k,x,y;
+         int i,j;
          STBI_SIMD_ALIGN(short, data[64]);
          for (j=0; j < z->img_mcu_y; ++j) {
             for (i=0; i < z->img_mcu_x; ++i) {
-               // scan an interleaved mcu... process scan_n components in order
-               for (k=0; k < z->scan_n; ++k) {
-                  int n = z->order[k];
-                  // scan out an mcu's worth of this component; that's just determined
-                  // by the basic H and V specified for the component
-                  for (y=0; y < z->img_comp[n].v; ++y) {
-                     for (x=0; x < z->img_comp[n].h; ++x) {
-                        int x2 = (i*z->img_comp[n].h + x)*8;
-                        int y2 = (j*z->img_comp[n].v + y)*8;
-                        int ha = z->img_comp[n].ha;
-                        if (!stbi__jpeg_decode_block(z, data, z->huff_dc+z->img_comp[n].hd, z->huff_ac+ha, z->fast_ac[ha], n, z->dequant[z->img_comp[n].tq])) return 0;
-                        z->idct_block_kernel(z->img_comp[n].data+z->img_comp[n].w2*y2+x2, z->img_comp[n].w2, data);
-                     }
-                  }
-               }
+               if (!stbi__jpeg_decode_mcu(z, data, i, j)) return 0;
                // after all interleaved components, that's an interleaved MCU,
                // so now count down the restart interval
                if (--z->todo <= 0) {
@@ -2880,21 +3297,40 @@ static void stbi__jpeg_dequantize(short *data, stbi__uint16 *dequant)
       data[i] *= dequant[i];
 }
 
+typedef struct
+{
+   stbi__jpeg *z;
+   int n;
+} stbi__jpeg_finish_job;
+
+// dequantize and idct block rows [first,last) of component n
+static void stbi__jpeg_finish_rows(void *ctx, int task, int first, int last)
+{
+   stbi__jpeg_finish_job *job = (stbi__jpeg_finish_job *) ctx;
+   stbi__jpeg *z = job->z;
+   int i,j,n = job->n;
+   int w = (z->img_comp[n].x+7) >> 3;
+   STBI_NOTUSED(task);
+   for (j=first; j < last; ++j) {
+      for (i=0; i < w; ++i) {
+         short *data = z->img_comp[n].coeff + 64 * (i + j * z->img_comp[n].coeff_w);
+         stbi__jpeg_dequantize(data, z->dequant[z->img_comp[n].tq]);
+         z->idct_block_kernel(z->img_comp[n].data+z->img_comp[n].w2*j*8+i*8, z->img_comp[n].w2, data);
+      }
+   }
+}
+
 static void stbi__jpeg_finish(stbi__jpeg *z)
 {
    if (z->progressive) {
       // dequantize and idct the data
-      int i,j,n;
-      for (n=0; n < z->s->img_n; ++n) {
-         int w = (z->img_comp[n].x+7) >> 3;
-         int h = (z->img_comp[n].y+7) >> 3;
-         for (j=0; j < h; ++j) {
-            for (i=0; i < w; ++i) {
-               short *data = z->img_comp[n].coeff + 64 * (i + j * z->img_comp[n].coeff_w);
-               stbi__jpeg_dequantize(data, z->dequant[z->img_comp[n].tq]);
-               z->idct_block_kernel(z->img_comp[n].data+z->img_comp[n].w2*j*8+i*8, z->img_comp[n].w2, data);
-            }
-         }
+      stbi__jpeg_finish_job job;
+      job.z = z;
+      for (job.n=0; job.n < z->s->img_n; ++job.n) {
+         int w = (z->img_comp[job.n].x+7) >> 3;
+         int h = (z->img_comp[job.n].y+7) >> 3;
+         int tasks = stbi__parallel_tasks(h, STBI__JPEG_MIN_TASK_MCUS / w + 1);
+         stbi__parallel_run(tasks, h, stbi__jpeg_finish_rows, &job);
       }
    }
 }
@@ -3188,6 +3624,7 @@ static int stbi__decode_jpeg_image(stbi__jpeg *j)
       j->img_comp[m].raw_coeff = NULL;
    }
    j->restart_interval = 0;
+   j->scan_buffer = NULL;
    if (!stbi__decode_jpeg_header(j, STBI__SCAN_load)) return 0;
    m = stbi__get_marker(j);
    while (!stbi__EOI(m)) {
@@ -3617,6 +4054,7 @@ static void stbi__setup_jpeg(stbi__jpeg *j)
 static void stbi__cleanup_jpeg(stbi__jpeg *j)
 {
    stbi__free_jpeg_components(j, j->s->img_n, 0);
+   stbi__jpeg_unbuffer_stream(j);
 }
 
 typedef struct
@@ -3636,9 +4074,142 @@ static stbi_uc stbi__blinn_8x8(stbi_uc x, stbi_uc y)
    return (stbi_uc) ((t + (t >>8)) >> 8);
 }
 
-static stbi_uc *load_jpeg_image(stbi__jpeg *z, int *out_x, int *out_y, int *comp, int req_comp)
+#define STBI__JPEG_MIN_TASK_PIXELS  (1 << 16)
+
+typedef struct
 {
+   stbi__jpeg *z;
+   stbi__resample res_comp[4];
+   stbi_uc *output;
+   stbi_uc *last_rows; // n*img_x+1 bytes per task, see below
+   int pitch;          // bytes from one output row to the next
+   int all_rows;       // every row goes through last_rows, not just the last one
    int n, decode_n, is_rgb;
+} stbi__jpeg_convert_job;
+
+// resample and color-convert output rows [first,last); every task has its own
+// line buffers and works out where the resamplers stand at its first row
+static void stbi__jpeg_convert_rows(void *ctx, int task, int first, int last)
+{
+   stbi__jpeg_convert_job *job = (stbi__jpeg_convert_job *) ctx;
+   stbi__jpeg *z = job->z;
+   stbi__resample res_comp[4];
+   stbi_uc *coutput[4] = { NULL, NULL, NULL, NULL };
+   int n = job->n, decode_n = job->decode_n, is_rgb = job->is_rgb;
+   int img_n = z->s->img_n, app14 = z->app14_color_transform;
+   unsigned int i, w = z->s->img_x;
+   int j,k;
+
+   memcpy(res_comp, job->res_comp, sizeof(res_comp));
+   for (j=0; j < last; ++j) {
+      // the RGB conversions write the alpha byte even when n==3, one byte into the next row; a task's
+      // last row goes through a buffer so that doesn't land on the first row of the task after it
+      // (or, for stbi_load_into, every row, when the byte would land in the caller's row padding)
+      stbi_uc *row = job->output + (size_t) job->pitch * j;
+      stbi_uc *dest = job->last_rows && (j == last-1 || job->all_rows) ? job->last_rows + task * (n * w + 1) : row;
+      stbi_uc *out = dest;
+      for (k=0; k < decode_n; ++k) {
+         stbi__resample *r = &res_comp[k];
+         if (j >= first) {
+            int y_bot = r->ystep >= (r->vs >> 1);
+            coutput[k] = r->resample(z->img_comp[k].linebuf + task * (w + 3),
+                                     y_bot ? r->line1 : r->line0,
+                                     y_bot ? r->line0 : r->line1,
+                                     r->w_lores, r->hs);
+         }
+         if (++r->ystep >= r->vs) {
+            r->ystep = 0;
+            r->line0 = r->line1;
+            if (++r->ypos < z->img_comp[k].y)
+               r->line1 += z->img_comp[k].w2;
+         }
+      }
+      if (j < first) continue;
+      if (n >= 3) {
+         stbi_uc *y = coutput[0];
+         if (img_n == 3) {
+            if (is_rgb) {
+               for (i=0; i < w; ++i) {
+                  out[0] = y[i];
+                  out[1] = coutput[1][i];
+                  out[2] = coutput[2][i];
+                  out[3] = 255;
+                  out += n;
+               }
+            } else {
+               z->YCbCr_to_RGB_kernel(out, y, coutput[1], coutput[2], w, n);
+            }
+         } else if (img_n == 4) {
+            if (app14 == 0) { // CMYK
+               for (i=0; i < w; ++i) {
+                  stbi_uc m = coutput[3][i];
+                  out[0] = stbi__blinn_8x8(coutput[0][i], m);
+                  out[1] = stbi__blinn_8x8(coutput[1][i], m);
+                  out[2] = stbi__blinn_8x8(coutput[2][i], m);
+                  out[3] = 255;
+                  out += n;
+               }
+            } else if (app14 == 2) { // YCCK
+               z->YCbCr_to_RGB_kernel(out, y, coutput[1], coutput[2], w, n);
+               for (i=0; i < w; ++i) {
+                  stbi_uc m = coutput[3][i];
+                  out[0] = stbi__blinn_8x8(255 - out[0], m);
+                  out[1] = stbi__blinn_8x8(255 - out[1], m);
+                  out[2] = stbi__blinn_8x8(255 - out[2], m);
+                  out += n;
+               }
+            } else { // YCbCr + alpha?  Ignore the fourth channel for now
+               z->YCbCr_to_RGB_kernel(out, y, coutput[1], coutput[2], w, n);
+            }
+         } else
+            for (i=0; i < w; ++i) {
+               out[0] = out[1] = out[2] = y[i];
+               out[3] = 255; // not used if n==3
+               out += n;
+            }
+      } else {
+         if (is_rgb) {
+            if (n == 1)
+               for (i=0; i < w; ++i)
+                  *out++ = stbi__compute_y(coutput[0][i], coutput[1][i], coutput[2][i]);
+            else {
+               for (i=0; i < w; ++i, out += 2) {
+                  out[0] = stbi__compute_y(coutput[0][i], coutput[1][i], coutput[2][i]);
+                  out[1] = 255;
+               }
+            }
+         } else if (img_n == 4 && app14 == 0) {
+            for (i=0; i < w; ++i) {
+               stbi_uc m = coutput[3][i];
+               stbi_uc r = stbi__blinn_8x8(coutput[0][i], m);
+               stbi_uc g = stbi__blinn_8x8(coutput[1][i], m);
+               stbi_uc b = stbi__blinn_8x8(coutput[2][i], m);
+               out[0] = stbi__compute_y(r, g, b);
+               out[1] = 255;
+               out += n;
+            }
+         } else if (img_n == 4 && app14 == 2) {
+            for (i=0; i < w; ++i) {
+               out[0] = stbi__blinn_8x8(255 - coutput[0][i], coutput[3][i]);
+               out[1] = 255;
+               out += n;
+            }
+         } else {
+            stbi_uc *y = coutput[0];
+            if (n == 1)
+               for (i=0; i < w; ++i) out[i] = y[i];
+            else
+               for (i=0; i < w; ++i) { *out++ = y[i]; *out++ = 255; }
+         }
+      }
+      if (dest != row)
+         memcpy(row, dest, n * w);
+   }
+}
+
+static stbi_uc *load_jpeg_image(stbi__jpeg *z, int *out_x, int *out_y, int *comp, int req_comp)
+{
+   int n, decode_n, is_rgb, tasks;
    z->s->img_n = 0; // make stbi__cleanup_jpeg safe
 
    // validate req_comp
@@ -3657,21 +4228,21 @@ static stbi_uc *load_jpeg_image(stbi__jpeg *z, int *out_x, int *out_y, int *comp
    else
       decode_n = z->s->img_n;
 
+   // bands of rows are converted in parallel
+   tasks = stbi__parallel_tasks(z->s->img_y, STBI__JPEG_MIN_TASK_PIXELS / z->s->img_x + 1);
+
    // resample and color-convert
    {
-      int k;
-      unsigned int i,j;
-      stbi_uc *output;
-      stbi_uc *coutput[4] = { NULL, NULL, NULL, NULL };
-
-      stbi__resample res_comp[4];
+      int k, pitch = n * z->s->img_x;
+      stbi_uc *output, *dest;
+      stbi__jpeg_convert_job job;
 
       for (k=0; k < decode_n; ++k) {
-         stbi__resample *r = &res_comp[k];
+         stbi__resample *r = &job.res_comp[k];
 
          // allocate line buffer big enough for upsampling off the edges
-         // with upsample factor of 4
-         z->img_comp[k].linebuf = (stbi_uc *) stbi__malloc(z->s->img_x + 3);
+         // with upsample factor of 4, for every task
+         z->img_comp[k].linebuf = (stbi_uc *) stbi__malloc_mad2(tasks, z->s->img_x + 3, 0);
          if (!z->img_comp[k].linebuf) { stbi__cleanup_jpeg(z); return stbi__errpuc("outofmem", "Out of memory"); }
 
          r->hs      = z->img_h_max / z->img_comp[k].h;
@@ -3689,104 +4260,28 @@ static stbi_uc *load_jpeg_image(stbi__jpeg *z, int *out_x, int *out_y, int *comp
       }
 
       // can't error after this so, this is safe
-      output = (stbi_uc *) stbi__malloc_mad3(n, z->s->img_x, z->s->img_y, 1);
+      output = dest = req_comp ? stbi__load_dest(z->s, &pitch) : NULL;
+      if (!output) output = (stbi_uc *) stbi__malloc_mad3(n, z->s->img_x, z->s->img_y, 1);
       if (!output) { stbi__cleanup_jpeg(z); return stbi__errpuc("outofmem", "Out of memory"); }
 
-      // now go ahead and resample
-      for (j=0; j < z->s->img_y; ++j) {
-         stbi_uc *out = output + n * z->s->img_x * j;
-         for (k=0; k < decode_n; ++k) {
-            stbi__resample *r = &res_comp[k];
-            int y_bot = r->ystep >= (r->vs >> 1);
-            coutput[k] = r->resample(z->img_comp[k].linebuf,
-                                     y_bot ? r->line1 : r->line0,
-                                     y_bot ? r->line0 : r->line1,
-                                     r->w_lores, r->hs);
-            if (++r->ystep >= r->vs) {
-               r->ystep = 0;
-               r->line0 = r->line1;
-               if (++r->ypos < z->img_comp[k].y)
-                  r->line1 += z->img_comp[k].w2;
-            }
-         }
-         if (n >= 3) {
-            stbi_uc *y = coutput[0];
-            if (z->s->img_n == 3) {
-               if (is_rgb) {
-                  for (i=0; i < z->s->img_x; ++i) {
-                     out[0] = y[i];
-                     out[1] = coutput[1][i];
-                     out[2] = coutput[2][i];
-                     out[3] = 255;
-                     out += n;
-                  }
-               } else {
-                  z->YCbCr_to_RGB_kernel(out, y, coutput[1], coutput[2], z->s->img_x, n);
-               }
-            } else if (z->s->img_n == 4) {
-               if (z->app14_color_transform == 0) { // CMYK
-                  for (i=0; i < z->s->img_x; ++i) {
-                     stbi_uc m = coutput[3][i];
-                     out[0] = stbi__blinn_8x8(coutput[0][i], m);
-                     out[1] = stbi__blinn_8x8(coutput[1][i], m);
-                     out[2] = stbi__blinn_8x8(coutput[2][i], m);
-                     out[3] = 255;
-                     out += n;
-                  }
-               } else if (z->app14_color_transform == 2) { // YCCK
-                  z->YCbCr_to_RGB_kernel(out, y, coutput[1], coutput[2], z->s->img_x, n);
-                  for (i=0; i < z->s->img_x; ++i) {
-                     stbi_uc m = coutput[3][i];
-                     out[0] = stbi__blinn_8x8(255 - out[0], m);
-                     out[1] = stbi__blinn_8x8(255 - out[1], m);
-                     out[2] = stbi__blinn_8x8(255 - out[2], m);
-                     out += n;
-                  }
-               } else { // YCbCr + alpha?  Ignore the fourth channel for now
-                  z->YCbCr_to_RGB_kernel(out, y, coutput[1], coutput[2], z->s->img_x, n);
-               }
-            } else
-               for (i=0; i < z->s->img_x; ++i) {
-                  out[0] = out[1] = out[2] = y[i];
-                  out[3] = 255; // not used if n==3
-                  out += n;
-               }
-         } else {
-            if (is_rgb) {
-               if (n == 1)
-                  for (i=0; i < z->s->img_x; ++i)
-                     *out++ = stbi__compute_y(coutput[0][i], coutput[1][i], coutput[2][i]);
-               else {
-                  for (i=0; i < z->s->img_x; ++i, out += 2) {
-                     out[0] = stbi__compute_y(coutput[0][i], coutput[1][i], coutput[2][i]);
-                     out[1] = 255;
-                  }
-               }
-            } else if (z->s->img_n == 4 && z->app14_color_transform == 0) {
-               for (i=0; i < z->s->img_x; ++i) {
-                  stbi_uc m = coutput[3][i];
-                  stbi_uc r = stbi__blinn_8x8(coutput[0][i], m);
-                  stbi_uc g = stbi__blinn_8x8(coutput[1][i], m);
-                  stbi_uc b = stbi__blinn_8x8(coutput[2][i], m);
-                  out[0] = stbi__compute_y(r, g, b);
-                  out[1] = 255;
-                  out += n;
-               }
-            } else if (z->s->img_n == 4 && z->app14_color_transform == 2) {
-               for (i=0; i < z->s->img_x; ++i) {
-                  out[0] = stbi__blinn_8x8(255 - coutput[0][i], coutput[3][i]);
-                  out[1] = 255;
-                  out += n;
-               }
-            } else {
-               stbi_uc *y = coutput[0];
-               if (n == 1)
-                  for (i=0; i < z->s->img_x; ++i) out[i] = y[i];
-               else
-                  for (i=0; i < z->s->img_x; ++i) { *out++ = y[i]; *out++ = 255; }
-            }
-         }
+      // the caller's memory has no spare byte after the last row
+      job.all_rows = dest && n == 3 && pitch != n * (int) z->s->img_x;
+      job.last_rows = NULL;
+      if (tasks > 1 || (dest && n == 3)) {
+         job.last_rows = (stbi_uc *) stbi__malloc_mad2(tasks, n * z->s->img_x + 1, 0);
+         if (!job.last_rows) { if (!dest) STBI_FREE(output); stbi__cleanup_jpeg(z); return stbi__errpuc("outofmem", "Out of memory"); }
       }
+
+      // now go ahead and resample
+      job.z = z;
+      job.output = output;
+      job.pitch = pitch;
+      job.n = n;
+      job.decode_n = decode_n;
+      job.is_rgb = is_rgb;
+      stbi__parallel_run(tasks, z->s->img_y, stbi__jpeg_convert_rows, &job);
+      STBI_FREE(job.last_rows);
+
       stbi__cleanup_jpeg(z);
       *out_x = z->s->img_x;
       *out_y = z->s->img_y;
@@ -3848,12 +4343,25 @@ static int stbi__jpeg_info(stbi__context *s, int *x, int *y, int *comp)
 //      - all output is written to a single output buffer (can malloc/realloc)
 //    performance
 //      - fast huffman
+//      - away from the ends of the buffers: 64-bit refills, two literals
+//        per table lookup, and matches copied 8/16/32 bytes at a time
 
 #ifndef STBI_NO_ZLIB
 
 // fast-way is faster to check than jpeg huffman, but slow way is slower
 #define STBI__ZFAST_BITS  9 // accelerate all cases in default tables
 #define STBI__ZFAST_MASK  ((1 << STBI__ZFAST_BITS) - 1)
+#define STBI__ZPAIR_BITS  11 // up to two literals per lookup
+#define STBI__ZPAIR_MASK  ((1 << STBI__ZPAIR_BITS) - 1)
+
+// the fast loop runs while it has this many bytes of output space, enough
+// for the longest match plus the overshoot of a wide copy
+#define STBI__ZFAST_OUT_MARGIN  (258 + 32)
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(_M_ARM64) || defined(__i386__) || defined(__x86_64__) || \
+    (defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define STBI__ZLITTLE_ENDIAN
+#endif
 
 // zlib-style huffman encoding
 // (jpegs packs from left, zlib from right, so can't share code)
@@ -3949,6 +4457,10 @@ typedef struct
    int   z_expandable;
 
    stbi__zhuffman z_length, z_distance;
+
+   // literal/length bits -> 0 if the bits don't start with a literal, else
+   // (bits used << 24) | (literal count << 16) | (second literal << 8) | first literal
+   stbi__uint32 z_pairs[1 << STBI__ZPAIR_BITS];
 } stbi__zbuf;
 
 stbi_inline static stbi_uc stbi__zget8(stbi__zbuf *z)
@@ -3976,12 +4488,13 @@ stbi_inline static unsigned int stbi__zreceive(stbi__zbuf *z, int n)
    return k;
 }
 
-static int stbi__zhuffman_decode_slowpath(stbi__zbuf *a, stbi__zhuffman *z)
+// decode the code at the bottom of code, for codes the fast table doesn't resolve
+static int stbi__zhuffman_decode_code(stbi__zhuffman *z, stbi__uint32 code, int *size)
 {
    int b,s,k;
    // not resolved by fast table, so compute it the slow way
    // use jpeg approach, which requires MSbits at top
-   k = stbi__bit_reverse(a->code_buffer, 16);
+   k = stbi__bit_reverse(code & 0xffff, 16);
    for (s=STBI__ZFAST_BITS+1; ; ++s)
       if (k < z->maxcode[s])
          break;
@@ -3989,9 +4502,17 @@ static int stbi__zhuffman_decode_slowpath(stbi__zbuf *a, stbi__zhuffman *z)
    // code size is s, so:
    b = (k >> (16-s)) - z->firstcode[s] + z->firstsymbol[s];
    STBI_ASSERT(z->size[b] == s);
+   *size = s;
+   return z->value[b];
+}
+
+static int stbi__zhuffman_decode_slowpath(stbi__zbuf *a, stbi__zhuffman *z)
+{
+   int s, v = stbi__zhuffman_decode_code(z, a->code_buffer, &s);
+   if (v < 0) return -1;
    a->code_buffer >>= s;
    a->num_bits -= s;
-   return z->value[b];
+   return v;
 }
 
 stbi_inline static int stbi__zhuffman_decode(stbi__zbuf *a, stbi__zhuffman *z)
@@ -4041,11 +4562,168 @@ static const int stbi__zdist_base[32] = { 1,2,3,4,5,7,9,13,17,25,33,49,65,97,129
 static const int stbi__zdist_extra[32] =
 { 0,0,0,0,1,1,2,2,3,3,4,4,5,5,6,6,7,7,8,8,9,9,10,10,11,11,12,12,13,13};
 
+// a literal followed by a second one if both codes fit in STBI__ZPAIR_BITS
+static void stbi__zbuild_pairs(stbi__zbuf *a)
+{
+   int i;
+   for (i=0; i < (1 << STBI__ZPAIR_BITS); ++i) {
+      int b = a->z_length.fast[i & STBI__ZFAST_MASK];
+      stbi__uint32 e = 0;
+      if (b && (b & 511) < 256) {
+         int s = b >> 9;
+         int b2 = a->z_length.fast[(i >> s) & STBI__ZFAST_MASK];
+         e = ((stbi__uint32) s << 24) | (1 << 16) | (b & 255);
+         if (b2 && (b2 & 511) < 256 && s + (b2 >> 9) <= STBI__ZPAIR_BITS)
+            e = ((stbi__uint32) (s + (b2 >> 9)) << 24) | (2 << 16) | ((b2 & 255) << 8) | (b & 255);
+      }
+      a->z_pairs[i] = e;
+   }
+}
+
+stbi_inline static stbi__uint64 stbi__zload64(const stbi_uc *p)
+{
+#ifdef STBI__ZLITTLE_ENDIAN
+   stbi__uint64 v;
+   memcpy(&v, p, 8);
+   return v;
+#else
+   return  (stbi__uint64) p[0]        | ((stbi__uint64) p[1] <<  8) | ((stbi__uint64) p[2] << 16) | ((stbi__uint64) p[3] << 24) |
+          ((stbi__uint64) p[4] << 32) | ((stbi__uint64) p[5] << 40) | ((stbi__uint64) p[6] << 48) | ((stbi__uint64) p[7] << 56);
+#endif
+}
+
+// decodes symbols while there are at least 8 bytes of input and STBI__ZFAST_OUT_MARGIN
+// bytes of output left, refilling a 64-bit bit buffer once per symbol (56 bits always
+// cover a length, a distance and their extra bits). returns 1 at the end of the block,
+// 0 on error, -1 when it got near the end of a buffer and the careful loop has to go on.
+static int stbi__parse_huffman_fast(stbi__zbuf *a, char **pzout)
+{
+   char *zout = *pzout;
+   char *zout_limit = a->zout_end - STBI__ZFAST_OUT_MARGIN;
+   stbi_uc *in = a->zbuffer;
+   stbi_uc *in_limit = a->zbuffer_end - 8;
+   stbi__uint64 bits = a->code_buffer;
+   int num_bits = a->num_bits;
+   int result = -1;
+
+   while (in <= in_limit && zout <= zout_limit) {
+      stbi__uint32 e;
+      int z,s,len,dist;
+      stbi_uc *p;
+
+      // every byte the refill can't fit in is loaded again next time, at the same place
+      bits |= stbi__zload64(in) << num_bits;
+      in += (63 - num_bits) >> 3;
+      num_bits |= 56;
+
+      e = a->z_pairs[bits & STBI__ZPAIR_MASK];
+      if (e) {
+         zout[0] = (char) e;
+         zout[1] = (char) (e >> 8);
+         zout += (e >> 16) & 3;
+         bits >>= e >> 24;
+         num_bits -= e >> 24;
+         continue;
+      }
+
+      z = a->z_length.fast[bits & STBI__ZFAST_MASK];
+      if (z) {
+         s = z >> 9;
+         z &= 511;
+      } else {
+         z = stbi__zhuffman_decode_code(&a->z_length, (stbi__uint32) bits, &s);
+         if (z < 0) { result = stbi__err("bad huffman code","Corrupt PNG"); break; }
+      }
+      bits >>= s;
+      num_bits -= s;
+      if (z < 256) {
+         *zout++ = (char) z;
+         continue;
+      }
+      if (z == 256) {
+         result = 1;
+         break;
+      }
+      if (z >= 286) { result = stbi__err("bad huffman code","Corrupt PNG"); break; }
+      z -= 257;
+      len = stbi__zlength_base[z];
+      s = stbi__zlength_extra[z];
+      len += (int) (bits & ((1 << s) - 1));
+      bits >>= s;
+      num_bits -= s;
+
+      z = a->z_distance.fast[bits & STBI__ZFAST_MASK];
+      if (z) {
+         s = z >> 9;
+         z &= 511;
+      } else {
+         z = stbi__zhuffman_decode_code(&a->z_distance, (stbi__uint32) bits, &s);
+         if (z < 0) { result = stbi__err("bad huffman code","Corrupt PNG"); break; }
+      }
+      if (z >= 30) { result = stbi__err("bad huffman code","Corrupt PNG"); break; }
+      bits >>= s;
+      num_bits -= s;
+      dist = stbi__zdist_base[z];
+      s = stbi__zdist_extra[z];
+      dist += (int) (bits & ((1 << s) - 1));
+      bits >>= s;
+      num_bits -= s;
+      if (zout - a->zout_start < dist) { result = stbi__err("bad dist","Corrupt PNG"); break; }
+
+      // wide copies overshoot the end of the match into the margin; with dist at least
+      // as wide as the copy, every chunk only reads bytes that are already written
+      p = (stbi_uc *) (zout - dist);
+      if (dist >= 8) {
+         char *end = zout + len;
+         if (dist >= 32)
+            do { memcpy(zout, p, 32); zout += 32; p += 32; } while (zout < end);
+         else if (dist >= 16)
+            do { memcpy(zout, p, 16); zout += 16; p += 16; } while (zout < end);
+         else
+            do { memcpy(zout, p,  8); zout +=  8; p +=  8; } while (zout < end);
+         zout = end;
+      } else if (dist == 1) { // run of one byte; common in images.
+         memset(zout, *p, len);
+         zout += len;
+      } else {
+         // short repeating pattern: lay down 8 bytes of it, then keep storing
+         // the 8 bytes a whole number of periods back
+         char *end = zout + len;
+         int k, step = 8 - 8 % dist;
+         stbi__uint64 v;
+         for (k=0; k < 8; ++k)
+            zout[k] = p[k];
+         for (zout += step; zout < end; zout += step) {
+            memcpy(&v, zout - step, 8);
+            memcpy(zout, &v, 8);
+         }
+         zout = end;
+      }
+   }
+
+   // give the whole bytes left in the bit buffer back to the input; they were all
+   // real input, the careful loop only pads with zeros past the end
+   a->zbuffer = in - (num_bits >> 3);
+   a->num_bits = num_bits & 7;
+   a->code_buffer = (stbi__uint32) (bits & ((1 << (num_bits & 7)) - 1));
+   *pzout = zout;
+   return result;
+}
+
 static int stbi__parse_huffman_block(stbi__zbuf *a)
 {
    char *zout = a->zout;
+   stbi__zbuild_pairs(a);
    for(;;) {
-      int z = stbi__zhuffman_decode(a, &a->z_length);
+      int z;
+      if (a->zbuffer_end - a->zbuffer >= 8 && a->zout_end - zout >= STBI__ZFAST_OUT_MARGIN) {
+         int r = stbi__parse_huffman_fast(a, &zout);
+         if (r >= 0) {
+            a->zout = zout;
+            return r;
+         }
+      }
+      z = stbi__zhuffman_decode(a, &a->z_length);
       if (z < 256) {
          if (z < 0) return stbi__err("bad huffman code","Corrupt PNG"); // error in huffman codes
          if (zout >= a->zout_end) {
@@ -4060,11 +4738,12 @@ static int stbi__parse_huffman_block(stbi__zbuf *a)
             a->zout = zout;
             return 1;
          }
+         if (z >= 286) return stbi__err("bad huffman code","Corrupt PNG"); // per DEFLATE, length codes 286 and 287 must not appear in stream
          z -= 257;
          len = stbi__zlength_base[z];
          if (stbi__zlength_extra[z]) len += stbi__zreceive(a, stbi__zlength_extra[z]);
          z = stbi__zhuffman_decode(a, &a->z_distance);
-         if (z < 0) return stbi__err("bad huffman code","Corrupt PNG");
+         if (z < 0 || z >= 30) return stbi__err("bad huffman code","Corrupt PNG"); // per DEFLATE, distance codes 30 and 31 must not appear in stream
          dist = stbi__zdist_base[z];
          if (stbi__zdist_extra[z]) dist += stbi__zreceive(a, stbi__zdist_extra[z]);
          if (zout - a->zout_start < dist) return stbi__err("bad dist","Corrupt PNG");
@@ -4355,6 +5034,8 @@ typedef struct
 {
    stbi__context *s;
    stbi_uc *idata, *expanded, *out;
+   stbi_uc *dest;          // stbi_load_into destination the final pixels go to, or NULL
+   stbi__uint32 out_pitch; // bytes from one row of out to the next
    int depth;
 } stbi__png;
 
@@ -4392,41 +5073,51 @@ static int stbi__paeth(int a, int b, int c)
 
 static const stbi_uc stbi__depth_scale_table[9] = { 0, 0xff, 0x55, 0, 0x11, 0,0,0, 0x01 };
 
-// create the png data from post-deflated data
-static int stbi__create_png_image_raw(stbi__png *a, stbi_uc *raw, stbi__uint32 raw_len, int out_n, stbi__uint32 x, stbi__uint32 y, int depth, int color)
+// rows filtered with "none" or "sub" don't read the row above, so the
+// image can be unfiltered in runs of rows that start at one of those
+
+#define STBI__PNG_MIN_TASK_PIXELS  (1 << 16)
+
+typedef struct
 {
-   int bytes = (depth == 16? 2 : 1);
-   stbi__context *s = a->s;
-   stbi__uint32 i,j,stride = x*out_n*bytes;
-   stbi__uint32 img_len, img_width_bytes;
+   stbi__png *a;
+   stbi_uc *raw;
+   stbi__uint32 x, y, img_width_bytes;
+   int out_n, depth, color;
+} stbi__png_rows;
+
+static int stbi__png_row_starts_run(stbi__png_rows *job, stbi__uint32 j)
+{
+   int filter = job->raw[(job->img_width_bytes+1)*j];
+   return j == 0 || filter == STBI__F_none || filter == STBI__F_sub;
+}
+
+static void stbi__png_unfilter_rows(void *ctx, int task, int first, int last)
+{
+   stbi__png_rows *job = (stbi__png_rows *) ctx;
+   stbi__png *a = job->a;
+   int out_n = job->out_n, depth = job->depth;
+   stbi__uint32 i,j,x = job->x,stride = a->out_pitch;
+   stbi__uint32 img_width_bytes = job->img_width_bytes;
    int k;
-   int img_n = s->img_n; // copy it into a local for later
+   int img_n = a->s->img_n; // copy it into a local for later
 
+   int bytes = (depth == 16? 2 : 1);
    int output_bytes = out_n*bytes;
    int filter_bytes = img_n*bytes;
    int width = x;
 
-   STBI_ASSERT(out_n == s->img_n || out_n == s->img_n+1);
-   a->out = (stbi_uc *) stbi__malloc_mad3(x, y, output_bytes, 0); // extra bytes to write off the end into
-   if (!a->out) return stbi__err("outofmem", "Out of memory");
-
-   if (!stbi__mad3sizes_valid(img_n, x, depth, 7)) return stbi__err("too large", "Corrupt PNG");
-   img_width_bytes = (((img_n * x * depth) + 7) >> 3);
-   img_len = (img_width_bytes + 1) * y;
-
-   // we used to check for exact match between raw_len and img_len on non-interlaced PNGs,
-   // but issue #276 reported a PNG in the wild that had extra data at the end (all zeros),
-   // so just check for raw_len < img_len always.
-   if (raw_len < img_len) return stbi__err("not enough pixels","Corrupt PNG");
+   STBI_NOTUSED(task);
+   // move both ends of the range to the start of a run, the next task picks up from there
+   while ((stbi__uint32) first < job->y && !stbi__png_row_starts_run(job, first)) ++first;
+   while ((stbi__uint32) last  < job->y && !stbi__png_row_starts_run(job, last))  ++last;
 
-   for (j=0; j < y; ++j) {
+   for (j=first; j < (stbi__uint32) last; ++j) {
       stbi_uc *cur = a->out + stride*j;
       stbi_uc *prior;
+      stbi_uc *raw = job->raw + (img_width_bytes+1)*j;
       int filter = *raw++;
 
-      if (filter > 4)
-         return stbi__err("invalid filter","Corrupt PNG");
-
       if (depth < 8) {
          STBI_ASSERT(img_width_bytes <= x);
          cur += x*out_n - img_width_bytes; // store output to the rightmost img_len bytes, so we can decode in place
@@ -4516,90 +5207,159 @@ static int stbi__create_png_image_raw(stbi__png *a, stbi_uc *raw, stbi__uint32 r
          }
       }
    }
+}
 
-   // we make a separate pass to expand bits to pixels; for performance,
-   // this could run two scanlines behind the above code, so it won't
-   // intefere with filtering but will still be in the cache.
-   if (depth < 8) {
-      for (j=0; j < y; ++j) {
-         stbi_uc *cur = a->out + stride*j;
-         stbi_uc *in  = a->out + stride*j + x*out_n - img_width_bytes;
-         // unpack 1/2/4-bit into a 8-bit buffer. allows us to keep the common 8-bit path optimal at minimal cost for 1/2/4-bit
-         // png guarante byte alignment, if width is not multiple of 8/4/2 we'll decode dummy trailing data that will be skipped in the later loop
-         stbi_uc scale = (color == 0) ? stbi__depth_scale_table[depth] : 1; // scale grayscale values to 0..255 range
-
-         // note that the final byte might overshoot and write more data than desired.
-         // we can allocate enough data that this never writes out of memory, but it
-         // could also overwrite the next scanline. can it overwrite non-empty data
-         // on the next scanline? yes, consider 1-pixel-wide scanlines with 1-bit-per-pixel.
-         // so we need to explicitly clamp the final ones
-
-         if (depth == 4) {
-            for (k=x*img_n; k >= 2; k-=2, ++in) {
-               *cur++ = scale * ((*in >> 4)       );
-               *cur++ = scale * ((*in     ) & 0x0f);
-            }
-            if (k > 0) *cur++ = scale * ((*in >> 4)       );
-         } else if (depth == 2) {
-            for (k=x*img_n; k >= 4; k-=4, ++in) {
-               *cur++ = scale * ((*in >> 6)       );
-               *cur++ = scale * ((*in >> 4) & 0x03);
-               *cur++ = scale * ((*in >> 2) & 0x03);
-               *cur++ = scale * ((*in     ) & 0x03);
-            }
-            if (k > 0) *cur++ = scale * ((*in >> 6)       );
-            if (k > 1) *cur++ = scale * ((*in >> 4) & 0x03);
-            if (k > 2) *cur++ = scale * ((*in >> 2) & 0x03);
-         } else if (depth == 1) {
-            for (k=x*img_n; k >= 8; k-=8, ++in) {
-               *cur++ = scale * ((*in >> 7)       );
-               *cur++ = scale * ((*in >> 6) & 0x01);
-               *cur++ = scale * ((*in >> 5) & 0x01);
-               *cur++ = scale * ((*in >> 4) & 0x01);
-               *cur++ = scale * ((*in >> 3) & 0x01);
-               *cur++ = scale * ((*in >> 2) & 0x01);
-               *cur++ = scale * ((*in >> 1) & 0x01);
-               *cur++ = scale * ((*in     ) & 0x01);
-            }
-            if (k > 0) *cur++ = scale * ((*in >> 7)       );
-            if (k > 1) *cur++ = scale * ((*in >> 6) & 0x01);
-            if (k > 2) *cur++ = scale * ((*in >> 5) & 0x01);
-            if (k > 3) *cur++ = scale * ((*in >> 4) & 0x01);
-            if (k > 4) *cur++ = scale * ((*in >> 3) & 0x01);
-            if (k > 5) *cur++ = scale * ((*in >> 2) & 0x01);
-            if (k > 6) *cur++ = scale * ((*in >> 1) & 0x01);
+// expand 1/2/4-bit rows [first,last) to 8 bits per channel, in place
+static void stbi__png_expand_rows(void *ctx, int task, int first, int last)
+{
+   stbi__png_rows *job = (stbi__png_rows *) ctx;
+   stbi__png *a = job->a;
+   int out_n = job->out_n, depth = job->depth, color = job->color;
+   int img_n = a->s->img_n;
+   stbi__uint32 j,x = job->x,stride = a->out_pitch, img_width_bytes = job->img_width_bytes;
+   int k;
+
+   STBI_NOTUSED(task);
+   for (j=first; j < (stbi__uint32) last; ++j) {
+      stbi_uc *cur = a->out + stride*j;
+      stbi_uc *in  = a->out + stride*j + x*out_n - img_width_bytes;
+      // unpack 1/2/4-bit into a 8-bit buffer. allows us to keep the common 8-bit path optimal at minimal cost for 1/2/4-bit
+      // png guarante byte alignment, if width is not multiple of 8/4/2 we'll decode dummy trailing data that will be skipped in the later loop
+      stbi_uc scale = (color == 0) ? stbi__depth_scale_table[depth] : 1; // scale grayscale values to 0..255 range
+
+      // note that the final byte might overshoot and write more data than desired.
+      // we can allocate enough data that this never writes out of memory, but it
+      // could also overwrite the next scanline. can it overwrite non-empty data
+      // on the next scanline? yes, consider 1-pixel-wide scanlines with 1-bit-per-pixel.
+      // so we need to explicitly clamp the final ones
+
+      if (depth == 4) {
+         for (k=x*img_n; k >= 2; k-=2, ++in) {
+            *cur++ = scale * ((*in >> 4)       );
+            *cur++ = scale * ((*in     ) & 0x0f);
          }
-         if (img_n != out_n) {
-            int q;
-            // insert alpha = 255
-            cur = a->out + stride*j;
-            if (img_n == 1) {
-               for (q=x-1; q >= 0; --q) {
-                  cur[q*2+1] = 255;
-                  cur[q*2+0] = cur[q];
-               }
-            } else {
-               STBI_ASSERT(img_n == 3);
-               for (q=x-1; q >= 0; --q) {
-                  cur[q*4+3] = 255;
-                  cur[q*4+2] = cur[q*3+2];
-                  cur[q*4+1] = cur[q*3+1];
-                  cur[q*4+0] = cur[q*3+0];
-               }
+         if (k > 0) *cur++ = scale * ((*in >> 4)       );
+      } else if (depth == 2) {
+         for (k=x*img_n; k >= 4; k-=4, ++in) {
+            *cur++ = scale * ((*in >> 6)       );
+            *cur++ = scale * ((*in >> 4) & 0x03);
+            *cur++ = scale * ((*in >> 2) & 0x03);
+            *cur++ = scale * ((*in     ) & 0x03);
+         }
+         if (k > 0) *cur++ = scale * ((*in >> 6)       );
+         if (k > 1) *cur++ = scale * ((*in >> 4) & 0x03);
+         if (k > 2) *cur++ = scale * ((*in >> 2) & 0x03);
+      } else if (depth == 1) {
+         for (k=x*img_n; k >= 8; k-=8, ++in) {
+            *cur++ = scale * ((*in >> 7)       );
+            *cur++ = scale * ((*in >> 6) & 0x01);
+            *cur++ = scale * ((*in >> 5) & 0x01);
+            *cur++ = scale * ((*in >> 4) & 0x01);
+            *cur++ = scale * ((*in >> 3) & 0x01);
+            *cur++ = scale * ((*in >> 2) & 0x01);
+            *cur++ = scale * ((*in >> 1) & 0x01);
+            *cur++ = scale * ((*in     ) & 0x01);
+         }
+         if (k > 0) *cur++ = scale * ((*in >> 7)       );
+         if (k > 1) *cur++ = scale * ((*in >> 6) & 0x01);
+         if (k > 2) *cur++ = scale * ((*in >> 5) & 0x01);
+         if (k > 3) *cur++ = scale * ((*in >> 4) & 0x01);
+         if (k > 4) *cur++ = scale * ((*in >> 3) & 0x01);
+         if (k > 5) *cur++ = scale * ((*in >> 2) & 0x01);
+         if (k > 6) *cur++ = scale * ((*in >> 1) & 0x01);
+      }
+      if (img_n != out_n) {
+         int q;
+         // insert alpha = 255
+         cur = a->out + stride*j;
+         if (img_n == 1) {
+            for (q=x-1; q >= 0; --q) {
+               cur[q*2+1] = 255;
+               cur[q*2+0] = cur[q];
+            }
+         } else {
+            STBI_ASSERT(img_n == 3);
+            for (q=x-1; q >= 0; --q) {
+               cur[q*4+3] = 255;
+               cur[q*4+2] = cur[q*3+2];
+               cur[q*4+1] = cur[q*3+1];
+               cur[q*4+0] = cur[q*3+0];
             }
          }
       }
+   }
+}
+
+// force rows [first,last) of 16 bit data from big-endian to platform-native
+static void stbi__png_swap_rows(void *ctx, int task, int first, int last)
+{
+   stbi__png_rows *job = (stbi__png_rows *) ctx;
+   stbi__uint32 i, row = job->x*job->out_n;
+   stbi_uc *cur = job->a->out + row*2*first;
+   stbi__uint16 *cur16 = (stbi__uint16*)cur;
+
+   STBI_NOTUSED(task);
+   for(i=0; i < row*(last-first); ++i,cur16++,cur+=2) {
+      *cur16 = (cur[0] << 8) | cur[1];
+   }
+}
+
+// create the png data from post-deflated data
+static int stbi__create_png_image_raw(stbi__png *a, stbi_uc *raw, stbi__uint32 raw_len, int out_n, stbi__uint32 x, stbi__uint32 y, int depth, int color)
+{
+   int bytes = (depth == 16? 2 : 1);
+   stbi__context *s = a->s;
+   stbi__uint32 j;
+   stbi__uint32 img_len, img_width_bytes;
+   int img_n = s->img_n; // copy it into a local for later
+   int output_bytes = out_n*bytes;
+   int tasks;
+   stbi__png_rows job;
+
+   STBI_ASSERT(out_n == s->img_n || out_n == s->img_n+1);
+   if (a->dest) {
+      a->out = a->dest; // out_pitch was set along with it
+   } else {
+      a->out = (stbi_uc *) stbi__malloc_mad3(x, y, output_bytes, 0); // extra bytes to write off the end into
+      a->out_pitch = x * output_bytes;
+   }
+   if (!a->out) return stbi__err("outofmem", "Out of memory");
+
+   if (!stbi__mad3sizes_valid(img_n, x, depth, 7)) return stbi__err("too large", "Corrupt PNG");
+   img_width_bytes = (((img_n * x * depth) + 7) >> 3);
+   img_len = (img_width_bytes + 1) * y;
+
+   // we used to check for exact match between raw_len and img_len on non-interlaced PNGs,
+   // but issue #276 reported a PNG in the wild that had extra data at the end (all zeros),
+   // so just check for raw_len < img_len always.
+   if (raw_len < img_len) return stbi__err("not enough pixels","Corrupt PNG");
+
+   for (j=0; j < y; ++j)
+      if (raw[(img_width_bytes+1)*j] > 4)
+         return stbi__err("invalid filter","Corrupt PNG");
+
+   job.a = a;
+   job.raw = raw;
+   job.x = x;
+   job.y = y;
+   job.img_width_bytes = img_width_bytes;
+   job.out_n = out_n;
+   job.depth = depth;
+   job.color = color;
+   tasks = stbi__parallel_tasks(y, STBI__PNG_MIN_TASK_PIXELS / x + 1);
+   stbi__parallel_run(tasks, y, stbi__png_unfilter_rows, &job);
+
+   // we make a separate pass to expand bits to pixels; for performance,
+   // this could run two scanlines behind the above code, so it won't
+   // intefere with filtering but will still be in the cache.
+   if (depth < 8) {
+      stbi__parallel_run(tasks, y, stbi__png_expand_rows, &job);
    } else if (depth == 16) {
       // force the image data from big-endian to platform-native.
       // this is done in a separate pass due to the decoding relying
       // on the data being untouched, but could probably be done
       // per-line during decode if care is taken.
-      stbi_uc *cur = a->out;
-      stbi__uint16 *cur16 = (stbi__uint16*)cur;
-
-      for(i=0; i < x*y*out_n; ++i,cur16++,cur+=2) {
-         *cur16 = (cur[0] << 8) | cur[1];
-      }
+      stbi__parallel_run(tasks, y, stbi__png_swap_rows, &job);
    }
 
    return 1;
@@ -4645,6 +5405,7 @@ static int stbi__create_png_image(stbi__png *a, stbi_uc *image_data, stbi__uint3
       }
    }
    a->out = final;
+   a->out_pitch = a->s->img_x * out_bytes;
 
    return 1;
 }
@@ -4652,23 +5413,26 @@ static int stbi__create_png_image(stbi__png *a, stbi_uc *image_data, stbi__uint3
 static int stbi__compute_transparency(stbi__png *z, stbi_uc tc[3], int out_n)
 {
    stbi__context *s = z->s;
-   stbi__uint32 i, pixel_count = s->img_x * s->img_y;
-   stbi_uc *p = z->out;
+   stbi__uint32 i, j;
+   stbi_uc *p;
 
    // compute color-based transparency, assuming we've
    // already got 255 as the alpha value in the output
    STBI_ASSERT(out_n == 2 || out_n == 4);
 
-   if (out_n == 2) {
-      for (i=0; i < pixel_count; ++i) {
-         p[1] = (p[0] == tc[0] ? 0 : 255);
-         p += 2;
-      }
-   } else {
-      for (i=0; i < pixel_count; ++i) {
-         if (p[0] == tc[0] && p[1] == tc[1] && p[2] == tc[2])
-            p[3] = 0;
-         p += 4;
+   for (j=0; j < s->img_y; ++j) {
+      p = z->out + z->out_pitch * j;
+      if (out_n == 2) {
+         for (i=0; i < s->img_x; ++i) {
+            p[1] = (p[0] == tc[0] ? 0 : 255);
+            p += 2;
+         }
+      } else {
+         for (i=0; i < s->img_x; ++i) {
+            if (p[0] == tc[0] && p[1] == tc[1] && p[2] == tc[2])
+               p[3] = 0;
+            p += 4;
+         }
       }
    }
    return 1;
@@ -4699,37 +5463,46 @@ static int stbi__compute_transparency16(stbi__png *z, stbi__uint16 tc[3], int ou
    return 1;
 }
 
-static int stbi__expand_png_palette(stbi__png *a, stbi_uc *palette, int len, int pal_img_n)
+static int stbi__expand_png_palette(stbi__png *a, stbi_uc *palette, int len, int pal_img_n, stbi_uc *dest, stbi__uint32 pitch)
 {
-   stbi__uint32 i, pixel_count = a->s->img_x * a->s->img_y;
+   stbi__uint32 i, j, pixel_count = a->s->img_x * a->s->img_y;
    stbi_uc *p, *temp_out, *orig = a->out;
 
-   p = (stbi_uc *) stbi__malloc_mad2(pixel_count, pal_img_n, 0);
-   if (p == NULL) return stbi__err("outofmem", "Out of memory");
+   // the indices are one byte per pixel, packed; the colors go to dest if there is one
+   if (dest) {
+      temp_out = dest;
+   } else {
+      temp_out = (stbi_uc *) stbi__malloc_mad2(pixel_count, pal_img_n, 0);
+      if (temp_out == NULL) return stbi__err("outofmem", "Out of memory");
+      pitch = a->s->img_x * pal_img_n;
+   }
 
    // between here and free(out) below, exitting would leak
-   temp_out = p;
-
-   if (pal_img_n == 3) {
-      for (i=0; i < pixel_count; ++i) {
-         int n = orig[i]*4;
-         p[0] = palette[n  ];
-         p[1] = palette[n+1];
-         p[2] = palette[n+2];
-         p += 3;
-      }
-   } else {
-      for (i=0; i < pixel_count; ++i) {
-         int n = orig[i]*4;
-         p[0] = palette[n  ];
-         p[1] = palette[n+1];
-         p[2] = palette[n+2];
-         p[3] = palette[n+3];
-         p += 4;
+   for (j=0; j < a->s->img_y; ++j) {
+      p = temp_out + pitch * j;
+      if (pal_img_n == 3) {
+         for (i=0; i < a->s->img_x; ++i) {
+            int n = *orig++*4;
+            p[0] = palette[n  ];
+            p[1] = palette[n+1];
+            p[2] = palette[n+2];
+            p += 3;
+         }
+      } else {
+         for (i=0; i < a->s->img_x; ++i) {
+            int n = *orig++*4;
+            p[0] = palette[n  ];
+            p[1] = palette[n+1];
+            p[2] = palette[n+2];
+            p[3] = palette[n+3];
+            p += 4;
+         }
       }
    }
    STBI_FREE(a->out);
    a->out = temp_out;
+   a->out_pitch = pitch;
+   a->dest = dest;
 
    STBI_NOTUSED(len);
 
@@ -4806,6 +5579,7 @@ static int stbi__parse_png_file(stbi__png *z, int scan, int req_comp)
    z->expanded = NULL;
    z->idata = NULL;
    z->out = NULL;
+   z->dest = NULL;
 
    if (!stbi__check_png_header(s)) return 0;
 
@@ -4906,6 +5680,8 @@ static int stbi__parse_png_file(stbi__png *z, int scan, int req_comp)
 
          case STBI__PNG_TYPE('I','E','N','D'): {
             stbi__uint32 raw_len, bpl;
+            stbi_uc *dest = NULL;
+            int pitch = 0;
             if (first) return stbi__err("first not IHDR", "Corrupt PNG");
             if (scan != STBI__SCAN_load) return 1;
             if (z->idata == NULL) return stbi__err("no IDAT","Corrupt PNG");
@@ -4919,6 +5695,16 @@ static int stbi__parse_png_file(stbi__png *z, int scan, int req_comp)
                s->img_out_n = s->img_n+1;
             else
                s->img_out_n = s->img_n;
+            // stbi_load_into: unfilter straight into the destination if nothing has to move the
+            // pixels around afterwards; paletted images expand their indices into it instead
+            if (z->depth <= 8 && !interlace && !(is_iphone && stbi__de_iphone_flag))
+               dest = stbi__load_dest(s, &pitch);
+            if (dest && (pal_img_n ? req_comp < 3 : req_comp != s->img_out_n))
+               dest = NULL;
+            if (dest && !pal_img_n) {
+               z->dest = dest;
+               z->out_pitch = (stbi__uint32) pitch;
+            }
             if (!stbi__create_png_image(z, z->expanded, raw_len, s->img_out_n, z->depth, color, interlace)) return 0;
             if (has_trans) {
                if (z->depth == 16) {
@@ -4934,7 +5720,7 @@ static int stbi__parse_png_file(stbi__png *z, int scan, int req_comp)
                s->img_n = pal_img_n; // record the actual colors we had
                s->img_out_n = pal_img_n;
                if (req_comp >= 3) s->img_out_n = req_comp;
-               if (!stbi__expand_png_palette(z, palette, pal_len, s->img_out_n))
+               if (!stbi__expand_png_palette(z, palette, pal_len, s->img_out_n, dest, (stbi__uint32) pitch))
                   return 0;
             } else if (has_trans) {
                // non-paletted image with tRNS -> source image has (constant) alpha
@@ -4989,6 +5775,7 @@ static void *stbi__do_png(stbi__png *p, int *x, int *y, int *n, int req_comp, st
       *y = p->s->img_y;
       if (n) *n = p->s->img_n;
    }
+   if (p->out == p->dest) p->out = NULL; // never free the caller's memory
    STBI_FREE(p->out);      p->out      = NULL;
    STBI_FREE(p->expanded); p->expanded = NULL;
    STBI_FREE(p->idata);    p->idata    = NULL;
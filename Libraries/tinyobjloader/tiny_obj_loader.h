@@ -501,6 +501,19 @@ bool LoadObj(attrib_t *attrib, std::vector<shape_t> *shapes,
              MaterialReader *readMatFn = NULL, bool triangulate = true,
              bool default_vcols_fallback = true);
 
+/// Loads object from `len` bytes at `buf`, e.g. a memory mapped file.
+/// `buf` doesn't need to be '\0' terminated. Lines are tokenized in place and
+/// vertices and faces are appended to flat arrays reserved up front, so there
+/// is no per line heap allocation. Produces the same data as the
+/// std::istream version.
+/// LoadObj with a filename memory maps the file and uses this function.
+bool LoadObjFromBuffer(attrib_t *attrib, std::vector<shape_t> *shapes,
+                       std::vector<material_t> *materials, std::string *warn,
+                       std::string *err, const char *buf, size_t len,
+                       MaterialReader *readMatFn = NULL,
+                       bool triangulate = true,
+                       bool default_vcols_fallback = true);
+
 /// Loads materials into std::map
 void LoadMtl(std::map<std::string, int> *material_map,
              std::vector<material_t> *materials, std::istream *inStream,
@@ -536,6 +549,24 @@ bool ParseTextureNameAndOption(std::string *texname, texture_option_t *texopt,
 #include <fstream>
 #include <sstream>
 
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#define TINYOBJLOADER_UNDEF_NOMINMAX
+#endif
+#include <windows.h>
+#ifdef TINYOBJLOADER_UNDEF_NOMINMAX
+#undef NOMINMAX
+#undef TINYOBJLOADER_UNDEF_NOMINMAX
+#endif
+#elif defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define TINYOBJLOADER_USE_MMAP
+#endif
+
 namespace tinyobj {
 
 MaterialReader::~MaterialReader() {}
@@ -550,13 +581,15 @@ struct vertex_index_t {
 
 // Internal data structure for face representation
 // index + smoothing group.
+// The vertex indices of all faces are stored back to back in
+// PrimGroup::faceIndices, so faces don't allocate.
 struct face_t {
   unsigned int
       smoothing_group_id;  // smoothing group id. 0 = smoothing groupd is off.
-  int pad_;
-  std::vector<vertex_index_t> vertex_indices;  // face vertex indices.
+  unsigned int num_vertices;  // face vertex count.
+  size_t first_index;         // first vertex index in PrimGroup::faceIndices.
 
-  face_t() : smoothing_group_id(0), pad_(0) {}
+  face_t() : smoothing_group_id(0), num_vertices(0), first_index(0) {}
 };
 
 // Internal data structure for line representation
@@ -592,15 +625,21 @@ struct obj_shape {
 // Manages group of primitives(face, line, points, ...)
 struct PrimGroup {
   std::vector<face_t> faceGroup;
+  std::vector<vertex_index_t> faceIndices;
   std::vector<__line_t> lineGroup;
   std::vector<__points_t> pointsGroup;
 
   void clear() {
-    faceGroup.clear();
+    clearFaces();
     lineGroup.clear();
     pointsGroup.clear();
   }
 
+  void clearFaces() {
+    faceGroup.clear();
+    faceIndices.clear();
+  }
+
   bool IsEmpty() const {
     return faceGroup.empty() && lineGroup.empty() && pointsGroup.empty();
   }
@@ -1242,28 +1281,46 @@ static bool exportGroupsToShape(shape_t *shape, const PrimGroup &prim_group,
 
   // polygon
   if (!prim_group.faceGroup.empty()) {
+    // Reused by every polygon that needs ear clipping.
+    std::vector<vertex_index_t> remainingFace;
+
     // Flatten vertices and indices
     for (size_t i = 0; i < prim_group.faceGroup.size(); i++) {
       const face_t &face = prim_group.faceGroup[i];
 
-      size_t npolys = face.vertex_indices.size();
+      size_t npolys = face.num_vertices;
 
       if (npolys < 3) {
         // Face must have 3+ vertices.
         continue;
       }
 
-      vertex_index_t i0 = face.vertex_indices[0];
+      const vertex_index_t *indices = &prim_group.faceIndices[face.first_index];
+
+      vertex_index_t i0 = indices[0];
       vertex_index_t i1(-1);
-      vertex_index_t i2 = face.vertex_indices[1];
+      vertex_index_t i2 = indices[1];
+
+      if (triangulate && npolys == 3) {
+        // Already a triangle, ear clipping would give back the same indices.
+        for (size_t k = 0; k < 3; k++) {
+          index_t idx;
+          idx.vertex_index = indices[k].v_idx;
+          idx.normal_index = indices[k].vn_idx;
+          idx.texcoord_index = indices[k].vt_idx;
+          shape->mesh.indices.push_back(idx);
+        }
 
-      if (triangulate) {
+        shape->mesh.num_face_vertices.push_back(3);
+        shape->mesh.material_ids.push_back(material_id);
+        shape->mesh.smoothing_group_ids.push_back(face.smoothing_group_id);
+      } else if (triangulate) {
         // find the two axes to work in
         size_t axes[2] = {1, 2};
         for (size_t k = 0; k < npolys; ++k) {
-          i0 = face.vertex_indices[(k + 0) % npolys];
-          i1 = face.vertex_indices[(k + 1) % npolys];
-          i2 = face.vertex_indices[(k + 2) % npolys];
+          i0 = indices[(k + 0) % npolys];
+          i1 = indices[(k + 1) % npolys];
+          i2 = indices[(k + 2) % npolys];
           size_t vi0 = size_t(i0.v_idx);
           size_t vi1 = size_t(i1.v_idx);
           size_t vi2 = size_t(i2.v_idx);
@@ -1306,8 +1363,8 @@ static bool exportGroupsToShape(shape_t *shape, const PrimGroup &prim_group,
 
         real_t area = 0;
         for (size_t k = 0; k < npolys; ++k) {
-          i0 = face.vertex_indices[(k + 0) % npolys];
-          i1 = face.vertex_indices[(k + 1) % npolys];
+          i0 = indices[(k + 0) % npolys];
+          i1 = indices[(k + 1) % npolys];
           size_t vi0 = size_t(i0.v_idx);
           size_t vi1 = size_t(i1.v_idx);
           if (((vi0 * 3 + axes[0]) >= v.size()) ||
@@ -1324,7 +1381,7 @@ static bool exportGroupsToShape(shape_t *shape, const PrimGroup &prim_group,
           area += (v0x * v1y - v0y * v1x) * static_cast<real_t>(0.5);
         }
 
-        face_t remainingFace = face;  // copy
+        remainingFace.assign(indices, indices + npolys);
         size_t guess_vert = 0;
         vertex_index_t ind[3];
         real_t vx[3];
@@ -1332,12 +1389,12 @@ static bool exportGroupsToShape(shape_t *shape, const PrimGroup &prim_group,
 
         // How many iterations can we do without decreasing the remaining
         // vertices.
-        size_t remainingIterations = face.vertex_indices.size();
-        size_t previousRemainingVertices = remainingFace.vertex_indices.size();
+        size_t remainingIterations = npolys;
+        size_t previousRemainingVertices = remainingFace.size();
 
-        while (remainingFace.vertex_indices.size() > 3 &&
+        while (remainingFace.size() > 3 &&
                remainingIterations > 0) {
-          npolys = remainingFace.vertex_indices.size();
+          npolys = remainingFace.size();
           if (guess_vert >= npolys) {
             guess_vert -= npolys;
           }
@@ -1353,7 +1410,7 @@ static bool exportGroupsToShape(shape_t *shape, const PrimGroup &prim_group,
           }
 
           for (size_t k = 0; k < 3; k++) {
-            ind[k] = remainingFace.vertex_indices[(guess_vert + k) % npolys];
+            ind[k] = remainingFace[(guess_vert + k) % npolys];
             size_t vi = size_t(ind[k].v_idx);
             if (((vi * 3 + axes[0]) >= v.size()) ||
                 ((vi * 3 + axes[1]) >= v.size())) {
@@ -1381,12 +1438,12 @@ static bool exportGroupsToShape(shape_t *shape, const PrimGroup &prim_group,
           for (size_t otherVert = 3; otherVert < npolys; ++otherVert) {
             size_t idx = (guess_vert + otherVert) % npolys;
 
-            if (idx >= remainingFace.vertex_indices.size()) {
+            if (idx >= remainingFace.size()) {
               // ???
               continue;
             }
 
-            size_t ovi = size_t(remainingFace.vertex_indices[idx].v_idx);
+            size_t ovi = size_t(remainingFace[idx].v_idx);
 
             if (((ovi * 3 + axes[0]) >= v.size()) ||
                 ((ovi * 3 + axes[1]) >= v.size())) {
@@ -1431,17 +1488,17 @@ static bool exportGroupsToShape(shape_t *shape, const PrimGroup &prim_group,
           // remove v1 from the list
           size_t removed_vert_index = (guess_vert + 1) % npolys;
           while (removed_vert_index + 1 < npolys) {
-            remainingFace.vertex_indices[removed_vert_index] =
-                remainingFace.vertex_indices[removed_vert_index + 1];
+            remainingFace[removed_vert_index] =
+                remainingFace[removed_vert_index + 1];
             removed_vert_index += 1;
           }
-          remainingFace.vertex_indices.pop_back();
+          remainingFace.pop_back();
         }
 
-        if (remainingFace.vertex_indices.size() == 3) {
-          i0 = remainingFace.vertex_indices[0];
-          i1 = remainingFace.vertex_indices[1];
-          i2 = remainingFace.vertex_indices[2];
+        if (remainingFace.size() == 3) {
+          i0 = remainingFace[0];
+          i1 = remainingFace[1];
+          i2 = remainingFace[2];
           {
             index_t idx0, idx1, idx2;
             idx0.vertex_index = i0.v_idx;
@@ -1466,9 +1523,9 @@ static bool exportGroupsToShape(shape_t *shape, const PrimGroup &prim_group,
       } else {
         for (size_t k = 0; k < npolys; k++) {
           index_t idx;
-          idx.vertex_index = face.vertex_indices[k].v_idx;
-          idx.normal_index = face.vertex_indices[k].vn_idx;
-          idx.texcoord_index = face.vertex_indices[k].vt_idx;
+          idx.vertex_index = indices[k].v_idx;
+          idx.normal_index = indices[k].vn_idx;
+          idx.texcoord_index = indices[k].vt_idx;
           shape->mesh.indices.push_back(idx);
         }
 
@@ -1960,6 +2017,105 @@ bool MaterialStreamReader::operator()(const std::string &matId,
   return true;
 }
 
+///
+/// Read only view of a whole file, memory mapped on Windows and POSIX systems.
+/// Open() fails on other systems and for files that can't be mapped.
+///
+class MappedFile {
+ public:
+  MappedFile() : data_(NULL), size_(0) {}
+  ~MappedFile() {
+    if (data_ && size_ > 0) {
+#if defined(_WIN32)
+      UnmapViewOfFile(data_);
+#elif defined(TINYOBJLOADER_USE_MMAP)
+      munmap(const_cast<char *>(data_), size_);
+#endif
+    }
+  }
+
+  bool Open(const char *filename) {
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL,
+                              OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+      return false;
+    }
+
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size) ||
+        static_cast<unsigned long long>(file_size.QuadPart) >
+            static_cast<unsigned long long>(
+                std::numeric_limits<size_t>::max())) {
+      CloseHandle(file);
+      return false;
+    }
+    if (file_size.QuadPart == 0) {
+      // Empty files can't be mapped.
+      CloseHandle(file);
+      data_ = "";
+      return true;
+    }
+
+    // The view keeps the file mapped after the handles are closed.
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file);
+    if (!mapping) {
+      return false;
+    }
+    data_ = static_cast<const char *>(
+        MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    CloseHandle(mapping);
+    if (!data_) {
+      return false;
+    }
+    size_ = static_cast<size_t>(file_size.QuadPart);
+    return true;
+#elif defined(TINYOBJLOADER_USE_MMAP)
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) {
+      return false;
+    }
+
+    struct stat sb;
+    if (fstat(fd, &sb) != 0 || !S_ISREG(sb.st_mode)) {
+      close(fd);
+      return false;
+    }
+    if (sb.st_size == 0) {
+      // Empty files can't be mapped.
+      close(fd);
+      data_ = "";
+      return true;
+    }
+
+    // The mapping stays valid after the file is closed.
+    void *p = mmap(NULL, static_cast<size_t>(sb.st_size), PROT_READ,
+                   MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED) {
+      return false;
+    }
+    data_ = static_cast<const char *>(p);
+    size_ = static_cast<size_t>(sb.st_size);
+    return true;
+#else
+    (void)filename;
+    return false;
+#endif
+  }
+
+  const char *data() const { return data_; }
+  size_t size() const { return size_; }
+
+ private:
+  MappedFile(const MappedFile &);
+  MappedFile &operator=(const MappedFile &);
+
+  const char *data_;
+  size_t size_;
+};
+
 bool LoadObj(attrib_t *attrib, std::vector<shape_t> *shapes,
              std::vector<material_t> *materials, std::string *warn,
              std::string *err, const char *filename, const char *mtl_basedir,
@@ -1972,15 +2128,6 @@ bool LoadObj(attrib_t *attrib, std::vector<shape_t> *shapes,
 
   std::stringstream errss;
 
-  std::ifstream ifs(filename);
-  if (!ifs) {
-    errss << "Cannot open file [" << filename << "]" << std::endl;
-    if (err) {
-      (*err) = errss.str();
-    }
-    return false;
-  }
-
   std::string baseDir = mtl_basedir ? mtl_basedir : "";
   if (!baseDir.empty()) {
 #ifndef _WIN32
@@ -1992,17 +2139,28 @@ bool LoadObj(attrib_t *attrib, std::vector<shape_t> *shapes,
   }
   MaterialFileReader matFileReader(baseDir);
 
+  MappedFile mapped;
+  if (mapped.Open(filename)) {
+    return LoadObjFromBuffer(attrib, shapes, materials, warn, err,
+                             mapped.data(), mapped.size(), &matFileReader,
+                             trianglulate, default_vcols_fallback);
+  }
+
+  std::ifstream ifs(filename);
+  if (!ifs) {
+    errss << "Cannot open file [" << filename << "]" << std::endl;
+    if (err) {
+      (*err) = errss.str();
+    }
+    return false;
+  }
+
   return LoadObj(attrib, shapes, materials, warn, err, &ifs, &matFileReader,
                  trianglulate, default_vcols_fallback);
 }
 
-bool LoadObj(attrib_t *attrib, std::vector<shape_t> *shapes,
-             std::vector<material_t> *materials, std::string *warn,
-             std::string *err, std::istream *inStream,
-             MaterialReader *readMatFn /*= NULL*/, bool triangulate,
-             bool default_vcols_fallback) {
-  std::stringstream errss;
-
+// Parser state carried from one line to the next.
+struct obj_parse_state {
   std::vector<real_t> v;
   std::vector<real_t> vn;
   std::vector<real_t> vt;
@@ -2013,443 +2171,467 @@ bool LoadObj(attrib_t *attrib, std::vector<shape_t> *shapes,
 
   // material
   std::map<std::string, int> material_map;
-  int material = -1;
+  int material;
 
   // smoothing group id
-  unsigned int current_smoothing_id =
-      0;  // Initial value. 0 means no smoothing.
+  unsigned int current_smoothing_id;  // Initial value. 0 means no smoothing.
 
-  int greatest_v_idx = -1;
-  int greatest_vn_idx = -1;
-  int greatest_vt_idx = -1;
+  int greatest_v_idx;
+  int greatest_vn_idx;
+  int greatest_vt_idx;
 
   shape_t shape;
 
-  bool found_all_colors = true;
+  bool found_all_colors;
 
-  size_t line_num = 0;
-  std::string linebuf;
-  while (inStream->peek() != -1) {
-    safeGetline(*inStream, linebuf);
+  size_t line_num;
 
-    line_num++;
+  obj_parse_state()
+      : material(-1),
+        current_smoothing_id(0),
+        greatest_v_idx(-1),
+        greatest_vn_idx(-1),
+        greatest_vt_idx(-1),
+        found_all_colors(true),
+        line_num(0) {}
+};
 
-    // Trim newline '\r\n' or '\n'
-    if (linebuf.size() > 0) {
-      if (linebuf[linebuf.size() - 1] == '\n')
-        linebuf.erase(linebuf.size() - 1);
-    }
-    if (linebuf.size() > 0) {
-      if (linebuf[linebuf.size() - 1] == '\r')
-        linebuf.erase(linebuf.size() - 1);
+// Parses one line of .obj. `linebuf` is '\0' terminated, without the line
+// ending. Returns false on error.
+static bool parseObjLine(obj_parse_state *state, const char *linebuf,
+                         std::vector<shape_t> *shapes,
+                         std::vector<material_t> *materials,
+                         MaterialReader *readMatFn, bool triangulate,
+                         bool default_vcols_fallback, std::string *warn,
+                         std::string *err) {
+  std::vector<real_t> &v = state->v;
+  std::vector<real_t> &vn = state->vn;
+  std::vector<real_t> &vt = state->vt;
+  std::vector<real_t> &vc = state->vc;
+  std::vector<tag_t> &tags = state->tags;
+  PrimGroup &prim_group = state->prim_group;
+  std::string &name = state->name;
+  std::map<std::string, int> &material_map = state->material_map;
+  int &material = state->material;
+  unsigned int &current_smoothing_id = state->current_smoothing_id;
+  int &greatest_v_idx = state->greatest_v_idx;
+  int &greatest_vn_idx = state->greatest_vn_idx;
+  int &greatest_vt_idx = state->greatest_vt_idx;
+  shape_t &shape = state->shape;
+  bool &found_all_colors = state->found_all_colors;
+  const size_t line_num = state->line_num;
+
+  // Skip leading space.
+  const char *token = linebuf;
+  token += strspn(token, " \t");
+
+  assert(token);
+  if (token[0] == '\0') return true;  // empty line
+
+  if (token[0] == '#') return true;  // comment line
+
+  // vertex
+  if (token[0] == 'v' && IS_SPACE((token[1]))) {
+    token += 2;
+    real_t x, y, z;
+    real_t r, g, b;
+
+    found_all_colors &= parseVertexWithColor(&x, &y, &z, &r, &g, &b, &token);
+
+    v.push_back(x);
+    v.push_back(y);
+    v.push_back(z);
+
+    if (found_all_colors || default_vcols_fallback) {
+      vc.push_back(r);
+      vc.push_back(g);
+      vc.push_back(b);
     }
 
-    // Skip if empty line.
-    if (linebuf.empty()) {
-      continue;
-    }
+    return true;
+  }
 
-    // Skip leading space.
-    const char *token = linebuf.c_str();
-    token += strspn(token, " \t");
+  // normal
+  if (token[0] == 'v' && token[1] == 'n' && IS_SPACE((token[2]))) {
+    token += 3;
+    real_t x, y, z;
+    parseReal3(&x, &y, &z, &token);
+    vn.push_back(x);
+    vn.push_back(y);
+    vn.push_back(z);
+    return true;
+  }
 
-    assert(token);
-    if (token[0] == '\0') continue;  // empty line
+  // texcoord
+  if (token[0] == 'v' && token[1] == 't' && IS_SPACE((token[2]))) {
+    token += 3;
+    real_t x, y;
+    parseReal2(&x, &y, &token);
+    vt.push_back(x);
+    vt.push_back(y);
+    return true;
+  }
 
-    if (token[0] == '#') continue;  // comment line
+  // line
+  if (token[0] == 'l' && IS_SPACE((token[1]))) {
+    token += 2;
 
-    // vertex
-    if (token[0] == 'v' && IS_SPACE((token[1]))) {
-      token += 2;
-      real_t x, y, z;
-      real_t r, g, b;
+    __line_t line;
+
+    while (!IS_NEW_LINE(token[0])) {
+      vertex_index_t vi;
+      if (!parseTriple(&token, static_cast<int>(v.size() / 3),
+                       static_cast<int>(vn.size() / 3),
+                       static_cast<int>(vt.size() / 2), &vi)) {
+        if (err) {
+          std::stringstream ss;
+          ss << "Failed parse `l' line(e.g. zero value for vertex index. line "
+             << line_num << ".)\n";
+          (*err) += ss.str();
+        }
+        return false;
+      }
+
+      line.vertex_indices.push_back(vi);
 
-      found_all_colors &= parseVertexWithColor(&x, &y, &z, &r, &g, &b, &token);
+      size_t n = strspn(token, " \t\r");
+      token += n;
+    }
+
+    prim_group.lineGroup.push_back(line);
+
+    return true;
+  }
+
+  // points
+  if (token[0] == 'p' && IS_SPACE((token[1]))) {
+    token += 2;
 
-      v.push_back(x);
-      v.push_back(y);
-      v.push_back(z);
+    __points_t pts;
 
-      if (found_all_colors || default_vcols_fallback) {
-        vc.push_back(r);
-        vc.push_back(g);
-        vc.push_back(b);
+    while (!IS_NEW_LINE(token[0])) {
+      vertex_index_t vi;
+      if (!parseTriple(&token, static_cast<int>(v.size() / 3),
+                       static_cast<int>(vn.size() / 3),
+                       static_cast<int>(vt.size() / 2), &vi)) {
+        if (err) {
+          std::stringstream ss;
+          ss << "Failed parse `p' line(e.g. zero value for vertex index. line "
+             << line_num << ".)\n";
+          (*err) += ss.str();
+        }
+        return false;
       }
 
-      continue;
-    }
+      pts.vertex_indices.push_back(vi);
 
-    // normal
-    if (token[0] == 'v' && token[1] == 'n' && IS_SPACE((token[2]))) {
-      token += 3;
-      real_t x, y, z;
-      parseReal3(&x, &y, &z, &token);
-      vn.push_back(x);
-      vn.push_back(y);
-      vn.push_back(z);
-      continue;
+      size_t n = strspn(token, " \t\r");
+      token += n;
     }
 
-    // texcoord
-    if (token[0] == 'v' && token[1] == 't' && IS_SPACE((token[2]))) {
-      token += 3;
-      real_t x, y;
-      parseReal2(&x, &y, &token);
-      vt.push_back(x);
-      vt.push_back(y);
-      continue;
-    }
+    prim_group.pointsGroup.push_back(pts);
 
-    // line
-    if (token[0] == 'l' && IS_SPACE((token[1]))) {
-      token += 2;
+    return true;
+  }
 
-      __line_t line;
+  // face
+  if (token[0] == 'f' && IS_SPACE((token[1]))) {
+    token += 2;
+    token += strspn(token, " \t");
 
-      while (!IS_NEW_LINE(token[0])) {
-        vertex_index_t vi;
-        if (!parseTriple(&token, static_cast<int>(v.size() / 3),
-                         static_cast<int>(vn.size() / 3),
-                         static_cast<int>(vt.size() / 2), &vi)) {
-          if (err) {
-            std::stringstream ss;
-            ss << "Failed parse `l' line(e.g. zero value for vertex index. line "
-               << line_num << ".)\n";
-            (*err) += ss.str();
-          }
-          return false;
-        }
+    face_t face;
 
-        line.vertex_indices.push_back(vi);
+    face.smoothing_group_id = current_smoothing_id;
+    face.first_index = prim_group.faceIndices.size();
 
-        size_t n = strspn(token, " \t\r");
-        token += n;
+    while (!IS_NEW_LINE(token[0])) {
+      vertex_index_t vi;
+      if (!parseTriple(&token, static_cast<int>(v.size() / 3),
+                       static_cast<int>(vn.size() / 3),
+                       static_cast<int>(vt.size() / 2), &vi)) {
+        if (err) {
+          std::stringstream ss;
+          ss << "Failed parse `f' line(e.g. zero value for face index. line "
+             << line_num << ".)\n";
+          (*err) += ss.str();
+        }
+        return false;
       }
 
-      prim_group.lineGroup.push_back(line);
+      greatest_v_idx = greatest_v_idx > vi.v_idx ? greatest_v_idx : vi.v_idx;
+      greatest_vn_idx =
+          greatest_vn_idx > vi.vn_idx ? greatest_vn_idx : vi.vn_idx;
+      greatest_vt_idx =
+          greatest_vt_idx > vi.vt_idx ? greatest_vt_idx : vi.vt_idx;
 
-      continue;
+      prim_group.faceIndices.push_back(vi);
+      size_t n = strspn(token, " \t\r");
+      token += n;
     }
 
-    // points
-    if (token[0] == 'p' && IS_SPACE((token[1]))) {
-      token += 2;
+    face.num_vertices = static_cast<unsigned int>(
+        prim_group.faceIndices.size() - face.first_index);
+    prim_group.faceGroup.push_back(face);
 
-      __points_t pts;
+    return true;
+  }
 
-      while (!IS_NEW_LINE(token[0])) {
-        vertex_index_t vi;
-        if (!parseTriple(&token, static_cast<int>(v.size() / 3),
-                         static_cast<int>(vn.size() / 3),
-                         static_cast<int>(vt.size() / 2), &vi)) {
-          if (err) {
-            std::stringstream ss;
-            ss << "Failed parse `p' line(e.g. zero value for vertex index. line "
-               << line_num << ".)\n";
-            (*err) += ss.str();
-          }
-          return false;
-        }
+  // use mtl
+  if ((0 == strncmp(token, "usemtl", 6)) && IS_SPACE((token[6]))) {
+    token += 7;
+    std::string namebuf(token);
 
-        pts.vertex_indices.push_back(vi);
+    int newMaterialId = -1;
+    if (material_map.find(namebuf) != material_map.end()) {
+      newMaterialId = material_map[namebuf];
+    } else {
+      // { error!! material not found }
+    }
 
-        size_t n = strspn(token, " \t\r");
-        token += n;
-      }
+    if (newMaterialId != material) {
+      // Create per-face material. Thus we don't add `shape` to `shapes` at
+      // this time.
+      // just clear `faceGroup` after `exportGroupsToShape()` call.
+      exportGroupsToShape(&shape, prim_group, tags, material, name,
+                          triangulate, v);
+      prim_group.clearFaces();
+      material = newMaterialId;
+    }
 
-      prim_group.pointsGroup.push_back(pts);
+    return true;
+  }
 
-      continue;
-    }
+  // load mtl
+  if ((0 == strncmp(token, "mtllib", 6)) && IS_SPACE((token[6]))) {
+    if (readMatFn) {
+      token += 7;
 
-    // face
-    if (token[0] == 'f' && IS_SPACE((token[1]))) {
-      token += 2;
-      token += strspn(token, " \t");
+      std::vector<std::string> filenames;
+      SplitString(std::string(token), ' ', filenames);
 
-      face_t face;
+      if (filenames.empty()) {
+        if (warn) {
+          std::stringstream ss;
+          ss << "Looks like empty filename for mtllib. Use default "
+                "material (line "
+             << line_num << ".)\n";
+
+          (*warn) += ss.str();
+        }
+      } else {
+        bool found = false;
+        for (size_t s = 0; s < filenames.size(); s++) {
+          std::string warn_mtl;
+          std::string err_mtl;
+          bool ok = (*readMatFn)(filenames[s].c_str(), materials,
+                                 &material_map, &warn_mtl, &err_mtl);
+          if (warn && (!warn_mtl.empty())) {
+            (*warn) += warn_mtl;
+          }
 
-      face.smoothing_group_id = current_smoothing_id;
-      face.vertex_indices.reserve(3);
+          if (err && (!err_mtl.empty())) {
+            (*err) += err_mtl;
+          }
 
-      while (!IS_NEW_LINE(token[0])) {
-        vertex_index_t vi;
-        if (!parseTriple(&token, static_cast<int>(v.size() / 3),
-                         static_cast<int>(vn.size() / 3),
-                         static_cast<int>(vt.size() / 2), &vi)) {
-          if (err) {
-            std::stringstream ss;
-            ss << "Failed parse `f' line(e.g. zero value for face index. line "
-               << line_num << ".)\n";
-            (*err) += ss.str();
+          if (ok) {
+            found = true;
+            break;
           }
-          return false;
         }
 
-        greatest_v_idx = greatest_v_idx > vi.v_idx ? greatest_v_idx : vi.v_idx;
-        greatest_vn_idx =
-            greatest_vn_idx > vi.vn_idx ? greatest_vn_idx : vi.vn_idx;
-        greatest_vt_idx =
-            greatest_vt_idx > vi.vt_idx ? greatest_vt_idx : vi.vt_idx;
-
-        face.vertex_indices.push_back(vi);
-        size_t n = strspn(token, " \t\r");
-        token += n;
+        if (!found) {
+          if (warn) {
+            (*warn) +=
+                "Failed to load material file(s). Use default "
+                "material.\n";
+          }
+        }
       }
+    }
 
-      // replace with emplace_back + std::move on C++11
-      prim_group.faceGroup.push_back(face);
+    return true;
+  }
 
-      continue;
+  // group name
+  if (token[0] == 'g' && IS_SPACE((token[1]))) {
+    // flush previous face group.
+    bool ret = exportGroupsToShape(&shape, prim_group, tags, material, name,
+                                   triangulate, v);
+    (void)ret;  // return value not used.
+
+    if (shape.mesh.indices.size() > 0) {
+      shapes->push_back(shape);
     }
 
-    // use mtl
-    if ((0 == strncmp(token, "usemtl", 6)) && IS_SPACE((token[6]))) {
-      token += 7;
-      std::stringstream ss;
-      ss << token;
-      std::string namebuf = ss.str();
+    shape = shape_t();
 
-      int newMaterialId = -1;
-      if (material_map.find(namebuf) != material_map.end()) {
-        newMaterialId = material_map[namebuf];
-      } else {
-        // { error!! material not found }
+    // material = -1;
+    prim_group.clear();
+
+    std::vector<std::string> names;
+
+    while (!IS_NEW_LINE(token[0])) {
+      std::string str = parseString(&token);
+      names.push_back(str);
+      token += strspn(token, " \t\r");  // skip tag
+    }
+
+    // names[0] must be 'g'
+
+    if (names.size() < 2) {
+      // 'g' with empty names
+      if (warn) {
+        std::stringstream ss;
+        ss << "Empty group name. line: " << line_num << "\n";
+        (*warn) += ss.str();
+        name = "";
       }
+    } else {
+      std::stringstream ss;
+      ss << names[1];
 
-      if (newMaterialId != material) {
-        // Create per-face material. Thus we don't add `shape` to `shapes` at
-        // this time.
-        // just clear `faceGroup` after `exportGroupsToShape()` call.
-        exportGroupsToShape(&shape, prim_group, tags, material, name,
-                            triangulate, v);
-        prim_group.faceGroup.clear();
-        material = newMaterialId;
+      // tinyobjloader does not support multiple groups for a primitive.
+      // Currently we concatinate multiple group names with a space to get
+      // single group name.
+
+      for (size_t i = 2; i < names.size(); i++) {
+        ss << " " << names[i];
       }
 
-      continue;
+      name = ss.str();
     }
 
-    // load mtl
-    if ((0 == strncmp(token, "mtllib", 6)) && IS_SPACE((token[6]))) {
-      if (readMatFn) {
-        token += 7;
+    return true;
+  }
 
-        std::vector<std::string> filenames;
-        SplitString(std::string(token), ' ', filenames);
+  // object name
+  if (token[0] == 'o' && IS_SPACE((token[1]))) {
+    // flush previous face group.
+    bool ret = exportGroupsToShape(&shape, prim_group, tags, material, name,
+                                   triangulate, v);
+    if (ret) {
+      shapes->push_back(shape);
+    }
 
-        if (filenames.empty()) {
-          if (warn) {
-            std::stringstream ss;
-            ss << "Looks like empty filename for mtllib. Use default "
-                  "material (line "
-               << line_num << ".)\n";
+    // material = -1;
+    prim_group.clear();
+    shape = shape_t();
 
-            (*warn) += ss.str();
-          }
-        } else {
-          bool found = false;
-          for (size_t s = 0; s < filenames.size(); s++) {
-            std::string warn_mtl;
-            std::string err_mtl;
-            bool ok = (*readMatFn)(filenames[s].c_str(), materials,
-                                   &material_map, &warn_mtl, &err_mtl);
-            if (warn && (!warn_mtl.empty())) {
-              (*warn) += warn_mtl;
-            }
-
-            if (err && (!err_mtl.empty())) {
-              (*err) += err_mtl;
-            }
-
-            if (ok) {
-              found = true;
-              break;
-            }
-          }
-
-          if (!found) {
-            if (warn) {
-              (*warn) +=
-                  "Failed to load material file(s). Use default "
-                  "material.\n";
-            }
-          }
-        }
-      }
+    // @todo { multiple object name? }
+    token += 2;
+    name = token;
 
-      continue;
-    }
-
-    // group name
-    if (token[0] == 'g' && IS_SPACE((token[1]))) {
-      // flush previous face group.
-      bool ret = exportGroupsToShape(&shape, prim_group, tags, material, name,
-                                     triangulate, v);
-      (void)ret;  // return value not used.
-
-      if (shape.mesh.indices.size() > 0) {
-        shapes->push_back(shape);
-      }
-
-      shape = shape_t();
-
-      // material = -1;
-      prim_group.clear();
+    return true;
+  }
 
-      std::vector<std::string> names;
+  if (token[0] == 't' && IS_SPACE(token[1])) {
+    const int max_tag_nums = 8192;  // FIXME(syoyo): Parameterize.
+    tag_t tag;
 
-      while (!IS_NEW_LINE(token[0])) {
-        std::string str = parseString(&token);
-        names.push_back(str);
-        token += strspn(token, " \t\r");  // skip tag
-      }
+    token += 2;
 
-      // names[0] must be 'g'
+    tag.name = parseString(&token);
 
-      if (names.size() < 2) {
-        // 'g' with empty names
-        if (warn) {
-          std::stringstream ss;
-          ss << "Empty group name. line: " << line_num << "\n";
-          (*warn) += ss.str();
-          name = "";
-        }
-      } else {
-        std::stringstream ss;
-        ss << names[1];
+    tag_sizes ts = parseTagTriple(&token);
 
-        // tinyobjloader does not support multiple groups for a primitive.
-        // Currently we concatinate multiple group names with a space to get
-        // single group name.
-
-        for (size_t i = 2; i < names.size(); i++) {
-          ss << " " << names[i];
-        }
-
-        name = ss.str();
-      }
-
-      continue;
+    if (ts.num_ints < 0) {
+      ts.num_ints = 0;
     }
-
-    // object name
-    if (token[0] == 'o' && IS_SPACE((token[1]))) {
-      // flush previous face group.
-      bool ret = exportGroupsToShape(&shape, prim_group, tags, material, name,
-                                     triangulate, v);
-      if (ret) {
-        shapes->push_back(shape);
-      }
-
-      // material = -1;
-      prim_group.clear();
-      shape = shape_t();
-
-      // @todo { multiple object name? }
-      token += 2;
-      std::stringstream ss;
-      ss << token;
-      name = ss.str();
-
-      continue;
+    if (ts.num_ints > max_tag_nums) {
+      ts.num_ints = max_tag_nums;
     }
 
-    if (token[0] == 't' && IS_SPACE(token[1])) {
-      const int max_tag_nums = 8192;  // FIXME(syoyo): Parameterize.
-      tag_t tag;
-
-      token += 2;
-
-      tag.name = parseString(&token);
+    if (ts.num_reals < 0) {
+      ts.num_reals = 0;
+    }
+    if (ts.num_reals > max_tag_nums) {
+      ts.num_reals = max_tag_nums;
+    }
 
-      tag_sizes ts = parseTagTriple(&token);
+    if (ts.num_strings < 0) {
+      ts.num_strings = 0;
+    }
+    if (ts.num_strings > max_tag_nums) {
+      ts.num_strings = max_tag_nums;
+    }
 
-      if (ts.num_ints < 0) {
-        ts.num_ints = 0;
-      }
-      if (ts.num_ints > max_tag_nums) {
-        ts.num_ints = max_tag_nums;
-      }
+    tag.intValues.resize(static_cast<size_t>(ts.num_ints));
 
-      if (ts.num_reals < 0) {
-        ts.num_reals = 0;
-      }
-      if (ts.num_reals > max_tag_nums) {
-        ts.num_reals = max_tag_nums;
-      }
+    for (size_t i = 0; i < static_cast<size_t>(ts.num_ints); ++i) {
+      tag.intValues[i] = parseInt(&token);
+    }
 
-      if (ts.num_strings < 0) {
-        ts.num_strings = 0;
-      }
-      if (ts.num_strings > max_tag_nums) {
-        ts.num_strings = max_tag_nums;
-      }
+    tag.floatValues.resize(static_cast<size_t>(ts.num_reals));
+    for (size_t i = 0; i < static_cast<size_t>(ts.num_reals); ++i) {
+      tag.floatValues[i] = parseReal(&token);
+    }
 
-      tag.intValues.resize(static_cast<size_t>(ts.num_ints));
+    tag.stringValues.resize(static_cast<size_t>(ts.num_strings));
+    for (size_t i = 0; i < static_cast<size_t>(ts.num_strings); ++i) {
+      tag.stringValues[i] = parseString(&token);
+    }
 
-      for (size_t i = 0; i < static_cast<size_t>(ts.num_ints); ++i) {
-        tag.intValues[i] = parseInt(&token);
-      }
+    tags.push_back(tag);
 
-      tag.floatValues.resize(static_cast<size_t>(ts.num_reals));
-      for (size_t i = 0; i < static_cast<size_t>(ts.num_reals); ++i) {
-        tag.floatValues[i] = parseReal(&token);
-      }
+    return true;
+  }
 
-      tag.stringValues.resize(static_cast<size_t>(ts.num_strings));
-      for (size_t i = 0; i < static_cast<size_t>(ts.num_strings); ++i) {
-        tag.stringValues[i] = parseString(&token);
-      }
+  if (token[0] == 's' && IS_SPACE(token[1])) {
+    // smoothing group id
+    token += 2;
 
-      tags.push_back(tag);
+    // skip space.
+    token += strspn(token, " \t");  // skip space
 
-      continue;
+    if (token[0] == '\0') {
+      return true;
     }
 
-    if (token[0] == 's' && IS_SPACE(token[1])) {
-      // smoothing group id
-      token += 2;
-
-      // skip space.
-      token += strspn(token, " \t");  // skip space
+    if (token[0] == '\r' || token[1] == '\n') {
+      return true;
+    }
 
-      if (token[0] == '\0') {
-        continue;
+    if (strlen(token) >= 3) {
+      if (token[0] == 'o' && token[1] == 'f' && token[2] == 'f') {
+        current_smoothing_id = 0;
       }
-
-      if (token[0] == '\r' || token[1] == '\n') {
-        continue;
-      }
-
-      if (strlen(token) >= 3) {
-        if (token[0] == 'o' && token[1] == 'f' && token[2] == 'f') {
-          current_smoothing_id = 0;
-        }
+    } else {
+      // assume number
+      int smGroupId = parseInt(&token);
+      if (smGroupId < 0) {
+        // parse error. force set to 0.
+        // FIXME(syoyo): Report warning.
+        current_smoothing_id = 0;
       } else {
-        // assume number
-        int smGroupId = parseInt(&token);
-        if (smGroupId < 0) {
-          // parse error. force set to 0.
-          // FIXME(syoyo): Report warning.
-          current_smoothing_id = 0;
-        } else {
-          current_smoothing_id = static_cast<unsigned int>(smGroupId);
-        }
+        current_smoothing_id = static_cast<unsigned int>(smGroupId);
       }
+    }
 
-      continue;
-    }  // smoothing group id
+    return true;
+  }  // smoothing group id
 
-    // Ignore unknown command.
-  }
+  // Ignore unknown command.
+  return true;
+}
+
+// Flushes the last shape and moves the vertex attributes to `attrib`.
+static void finishObj(obj_parse_state *state, attrib_t *attrib,
+                      std::vector<shape_t> *shapes, bool triangulate,
+                      bool default_vcols_fallback, std::string *warn) {
+  std::vector<real_t> &v = state->v;
+  std::vector<real_t> &vn = state->vn;
+  std::vector<real_t> &vt = state->vt;
+  std::vector<real_t> &vc = state->vc;
+  PrimGroup &prim_group = state->prim_group;
+  shape_t &shape = state->shape;
+  const size_t line_num = state->line_num;
 
   // not all vertices have colors, no default colors desired? -> clear colors
-  if (!found_all_colors && !default_vcols_fallback) {
+  if (!state->found_all_colors && !default_vcols_fallback) {
     vc.clear();
   }
 
-  if (greatest_v_idx >= static_cast<int>(v.size() / 3)) {
+  if (state->greatest_v_idx >= static_cast<int>(v.size() / 3)) {
     if (warn) {
       std::stringstream ss;
       ss << "Vertex indices out of bounds (line " << line_num << ".)\n"
@@ -2457,7 +2639,7 @@ bool LoadObj(attrib_t *attrib, std::vector<shape_t> *shapes,
       (*warn) += ss.str();
     }
   }
-  if (greatest_vn_idx >= static_cast<int>(vn.size() / 3)) {
+  if (state->greatest_vn_idx >= static_cast<int>(vn.size() / 3)) {
     if (warn) {
       std::stringstream ss;
       ss << "Vertex normal indices out of bounds (line " << line_num << ".)\n"
@@ -2465,7 +2647,7 @@ bool LoadObj(attrib_t *attrib, std::vector<shape_t> *shapes,
       (*warn) += ss.str();
     }
   }
-  if (greatest_vt_idx >= static_cast<int>(vt.size() / 2)) {
+  if (state->greatest_vt_idx >= static_cast<int>(vt.size() / 2)) {
     if (warn) {
       std::stringstream ss;
       ss << "Vertex texcoord indices out of bounds (line " << line_num << ".)\n"
@@ -2474,7 +2656,8 @@ bool LoadObj(attrib_t *attrib, std::vector<shape_t> *shapes,
     }
   }
 
-  bool ret = exportGroupsToShape(&shape, prim_group, tags, material, name,
+  bool ret = exportGroupsToShape(&shape, prim_group, state->tags,
+                                 state->material, state->name,
                                  triangulate, v);
   // exportGroupsToShape return false when `usemtl` is called in the last
   // line.
@@ -2486,16 +2669,485 @@ bool LoadObj(attrib_t *attrib, std::vector<shape_t> *shapes,
   }
   prim_group.clear();  // for safety
 
-  if (err) {
-    (*err) += errss.str();
-  }
-
   attrib->vertices.swap(v);
   attrib->vertex_weights.swap(v);
   attrib->normals.swap(vn);
   attrib->texcoords.swap(vt);
   attrib->texcoord_ws.swap(vt);
   attrib->colors.swap(vc);
+}
+
+bool LoadObj(attrib_t *attrib, std::vector<shape_t> *shapes,
+             std::vector<material_t> *materials, std::string *warn,
+             std::string *err, std::istream *inStream,
+             MaterialReader *readMatFn /*= NULL*/, bool triangulate,
+             bool default_vcols_fallback) {
+  std::stringstream errss;
+
+  obj_parse_state state;
+
+  std::string linebuf;
+  while (inStream->peek() != -1) {
+    safeGetline(*inStream, linebuf);
+
+    state.line_num++;
+
+    // Trim newline '\r\n' or '\n'
+    if (linebuf.size() > 0) {
+      if (linebuf[linebuf.size() - 1] == '\n')
+        linebuf.erase(linebuf.size() - 1);
+    }
+    if (linebuf.size() > 0) {
+      if (linebuf[linebuf.size() - 1] == '\r')
+        linebuf.erase(linebuf.size() - 1);
+    }
+
+    // Skip if empty line.
+    if (linebuf.empty()) {
+      continue;
+    }
+
+    if (!parseObjLine(&state, linebuf.c_str(), shapes, materials, readMatFn,
+                      triangulate, default_vcols_fallback, warn, err)) {
+      return false;
+    }
+  }
+
+  finishObj(&state, attrib, shapes, triangulate, default_vcols_fallback, warn);
+
+  if (err) {
+    (*err) += errss.str();
+  }
+
+  return true;
+}
+
+//
+// Parsers of LoadObjFromBuffer. A token is [*token, end), where `end` is the
+// end of the line. Nothing past `end` is read, the buffer has no '\0'.
+//
+
+static inline void skipSpaceSpan(const char **token, const char *end) {
+  while ((*token) < end && IS_SPACE((**token))) (*token)++;
+}
+
+// Same delimiters as strcspn(token, " \t\r").
+static inline const char *tokenEndSpan(const char *token, const char *end) {
+  while (token < end && !IS_SPACE((*token)) && (*token) != '\r') token++;
+  return token;
+}
+
+// Same delimiters as strcspn(token, "/ \t\r").
+static inline const char *indexEndSpan(const char *token, const char *end) {
+  while (token < end && !IS_SPACE((*token)) && (*token) != '\r' &&
+         (*token) != '/')
+    token++;
+  return token;
+}
+
+// atoi on a span. Overflow saturates instead of being undefined.
+// Leaves `token` after the digits, unless atoi had to skip leading space:
+// the callers then look for the end of the token from where it was, like
+// strcspn after atoi.
+static inline int parseIntSpan(const char **token, const char *end) {
+  const char *curr = (*token);
+  while (curr < end &&
+         ((*curr) == ' ' || ((*curr) >= '\t' && (*curr) <= '\r')))
+    curr++;
+  const bool skipped_space = curr != (*token);
+
+  bool negative = false;
+  if (curr < end && ((*curr) == '+' || (*curr) == '-')) {
+    negative = (*curr) == '-';
+    curr++;
+  }
+
+  const int int_max = std::numeric_limits<int>::max();
+  int value = 0;
+  while (curr < end && IS_DIGIT((*curr))) {
+    const int digit = (*curr) - '0';
+    value = value > (int_max - digit) / 10 ? int_max : value * 10 + digit;
+    curr++;
+  }
+
+  if (!skipped_space) (*token) = curr;
+  return negative ? -value : value;
+}
+
+// Decimal significand summed 9 digits at a time in 32 bits, which keeps the
+// digit loop off the latency of floating point multiply-adds. Exact up to 15
+// digits.
+struct decimal_significand {
+  double high;
+  unsigned int low;
+  int low_digits;
+  int digits;  // without leading zeros
+
+  decimal_significand() : high(0.0), low(0), low_digits(0), digits(0) {}
+
+  void push(int digit) {
+    if (low_digits == 9) {
+      high = high * 1e9 + low;
+      low = 0;
+      low_digits = 0;
+    }
+    low = low * 10 + static_cast<unsigned int>(digit);
+    low_digits++;
+    digits += (low != 0 || high != 0.0) ? 1 : 0;
+  }
+
+  double value() const {
+    static const double pow_lut[] = {1e0, 1e1, 1e2, 1e3, 1e4,
+                                     1e5, 1e6, 1e7, 1e8, 1e9};
+    return high * pow_lut[low_digits] + low;
+  }
+};
+
+// Parses the same grammar as tryParseDouble, on [*token, s_end). Leaves
+// `token` where the number ends, which may be before the end of the token.
+//
+// Uses the fast path of fast_float (Clinger's algorithm): when the decimal
+// significand has at most 15 digits and the power of ten is at most 22, both
+// are exact doubles and a single multiplication or division gives the
+// correctly rounded result. OBJ files practically always hit it. Anything
+// longer falls back to tryParseDouble.
+static bool tryParseDoubleFast(const char **token, const char *s_end,
+                               double *result) {
+  static const double exact_pow10[] = {
+      1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+      1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+  const char *s = (*token);
+  const char *curr = s;
+
+  bool negative = false;
+  if (curr < s_end && ((*curr) == '+' || (*curr) == '-')) {
+    negative = (*curr) == '-';
+    curr++;
+  }
+
+  // At least one integer digit.
+  if (curr >= s_end || !IS_DIGIT((*curr))) {
+    (*token) = curr;
+    return false;
+  }
+
+  decimal_significand significand;
+  int exponent = 0;
+
+  while (curr < s_end && IS_DIGIT((*curr))) {
+    significand.push((*curr) - '0');
+    curr++;
+  }
+
+  if (curr < s_end && (*curr) == '.') {
+    curr++;
+    while (curr < s_end && IS_DIGIT((*curr))) {
+      significand.push((*curr) - '0');
+      exponent--;
+      curr++;
+    }
+  }
+
+  if (curr < s_end && ((*curr) == 'e' || (*curr) == 'E')) {
+    curr++;
+
+    bool exp_negative = false;
+    if (curr < s_end && ((*curr) == '+' || (*curr) == '-')) {
+      exp_negative = (*curr) == '-';
+      curr++;
+    }
+
+    // Empty E is not allowed.
+    if (curr >= s_end || !IS_DIGIT((*curr))) {
+      (*token) = curr;
+      return false;
+    }
+
+    int exp_value = 0;
+    while (curr < s_end && IS_DIGIT((*curr))) {
+      if (exp_value < 100000) exp_value = exp_value * 10 + ((*curr) - '0');
+      curr++;
+    }
+    exponent += exp_negative ? -exp_value : exp_value;
+  }
+
+  if (significand.digits <= 15 && exponent >= -22 && exponent <= 22) {
+    double value = exponent < 0
+                       ? significand.value() / exact_pow10[-exponent]
+                       : significand.value() * exact_pow10[exponent];
+    *result = negative ? -value : value;
+    (*token) = curr;
+    return true;
+  }
+
+  (*token) = curr;
+  return tryParseDouble(s, curr, result);
+}
+
+static inline real_t parseRealSpan(const char **token, const char *end,
+                                   double default_value = 0.0) {
+  skipSpaceSpan(token, end);
+  double val = default_value;
+  tryParseDoubleFast(token, end, &val);
+  real_t f = static_cast<real_t>(val);
+  (*token) = tokenEndSpan((*token), end);
+  return f;
+}
+
+static inline bool parseRealSpan(const char **token, const char *end,
+                                 real_t *out) {
+  skipSpaceSpan(token, end);
+  double val;
+  bool ret = tryParseDoubleFast(token, end, &val);
+  if (ret) {
+    real_t f = static_cast<real_t>(val);
+    (*out) = f;
+  }
+  (*token) = tokenEndSpan((*token), end);
+  return ret;
+}
+
+// parseTriple on a span.
+static bool parseTripleSpan(const char **token, const char *end, int vsize,
+                            int vnsize, int vtsize, vertex_index_t *ret) {
+  vertex_index_t vi(-1);
+
+  if (!fixIndex(parseIntSpan(token, end), vsize, &(vi.v_idx))) {
+    return false;
+  }
+
+  (*token) = indexEndSpan((*token), end);
+  if ((*token) >= end || (*token)[0] != '/') {
+    (*ret) = vi;
+    return true;
+  }
+  (*token)++;
+
+  // i//k
+  if ((*token) < end && (*token)[0] == '/') {
+    (*token)++;
+    if (!fixIndex(parseIntSpan(token, end), vnsize, &(vi.vn_idx))) {
+      return false;
+    }
+    (*token) = indexEndSpan((*token), end);
+    (*ret) = vi;
+    return true;
+  }
+
+  // i/j/k or i/j
+  if (!fixIndex(parseIntSpan(token, end), vtsize, &(vi.vt_idx))) {
+    return false;
+  }
+
+  (*token) = indexEndSpan((*token), end);
+  if ((*token) >= end || (*token)[0] != '/') {
+    (*ret) = vi;
+    return true;
+  }
+
+  // i/j/k
+  (*token)++;  // skip '/'
+  if (!fixIndex(parseIntSpan(token, end), vnsize, &(vi.vn_idx))) {
+    return false;
+  }
+  (*token) = indexEndSpan((*token), end);
+
+  (*ret) = vi;
+
+  return true;
+}
+
+// End of the line starting at `p`. Lines end with "\n", "\r\n" or "\r", like
+// safeGetline.
+static inline const char *lineEnd(const char *p, const char *end) {
+  while (p < end && (*p) != '\n' && (*p) != '\r') p++;
+  return p;
+}
+
+static inline const char *nextLine(const char *line_end, const char *end) {
+  if (line_end < end && (*line_end) == '\r') {
+    line_end++;
+    if (line_end < end && (*line_end) == '\n') line_end++;
+  } else if (line_end < end) {
+    line_end++;
+  }
+  return line_end;
+}
+
+// Rough count of the vertex and face lines, to reserve the arrays once.
+static void countObjLines(const char *buf, const char *end, size_t *num_v,
+                          size_t *num_vn, size_t *num_vt, size_t *num_f) {
+  (*num_v) = (*num_vn) = (*num_vt) = (*num_f) = 0;
+
+  const char *p = buf;
+  while (end - p >= 2) {
+    if (p[0] == 'v') {
+      (*num_v) += IS_SPACE(p[1]) ? 1 : 0;
+      (*num_vn) += p[1] == 'n' ? 1 : 0;
+      (*num_vt) += p[1] == 't' ? 1 : 0;
+    } else if (p[0] == 'f') {
+      (*num_f) += 1;
+    }
+
+    const char *nl = static_cast<const char *>(
+        memchr(p, '\n', static_cast<size_t>(end - p)));
+    if (!nl) break;
+    p = nl + 1;
+  }
+}
+
+bool LoadObjFromBuffer(attrib_t *attrib, std::vector<shape_t> *shapes,
+                       std::vector<material_t> *materials, std::string *warn,
+                       std::string *err, const char *buf, size_t len,
+                       MaterialReader *readMatFn /*= NULL*/, bool triangulate,
+                       bool default_vcols_fallback) {
+  std::stringstream errss;
+
+  obj_parse_state state;
+
+  const char *const buf_end = buf + len;
+
+  size_t num_v, num_vn, num_vt, num_f;
+  countObjLines(buf, buf_end, &num_v, &num_vn, &num_vt, &num_f);
+  state.v.reserve(3 * num_v);
+  state.vc.reserve(3 * num_v);
+  state.vn.reserve(3 * num_vn);
+  state.vt.reserve(2 * num_vt);
+  state.prim_group.faceGroup.reserve(num_f);
+  state.prim_group.faceIndices.reserve(3 * num_f);
+
+  // Only lines other than v, vn, vt and f are copied, to reuse parseObjLine.
+  std::string linebuf;
+
+  const char *line = buf;
+  while (line < buf_end) {
+    const char *end = lineEnd(line, buf_end);
+    const char *token = line;
+    line = nextLine(end, buf_end);
+
+    state.line_num++;
+
+    // Skip leading space.
+    skipSpaceSpan(&token, end);
+
+    if (token == end) continue;  // empty line
+
+    if (token[0] == '#') continue;  // comment line
+
+    const ptrdiff_t n = end - token;
+
+    // vertex
+    if (token[0] == 'v' && n >= 2 && IS_SPACE((token[1]))) {
+      token += 2;
+      real_t x = parseRealSpan(&token, end);
+      real_t y = parseRealSpan(&token, end);
+      real_t z = parseRealSpan(&token, end);
+      real_t r, g, b;
+
+      const bool found_color = parseRealSpan(&token, end, &r) &&
+                               parseRealSpan(&token, end, &g) &&
+                               parseRealSpan(&token, end, &b);
+      if (!found_color) {
+        r = g = b = 1.0;
+      }
+      state.found_all_colors &= found_color;
+
+      state.v.push_back(x);
+      state.v.push_back(y);
+      state.v.push_back(z);
+
+      if (state.found_all_colors || default_vcols_fallback) {
+        state.vc.push_back(r);
+        state.vc.push_back(g);
+        state.vc.push_back(b);
+      }
+
+      continue;
+    }
+
+    // normal
+    if (token[0] == 'v' && n >= 3 && token[1] == 'n' && IS_SPACE((token[2]))) {
+      token += 3;
+      real_t x = parseRealSpan(&token, end);
+      real_t y = parseRealSpan(&token, end);
+      real_t z = parseRealSpan(&token, end);
+      state.vn.push_back(x);
+      state.vn.push_back(y);
+      state.vn.push_back(z);
+      continue;
+    }
+
+    // texcoord
+    if (token[0] == 'v' && n >= 3 && token[1] == 't' && IS_SPACE((token[2]))) {
+      token += 3;
+      real_t x = parseRealSpan(&token, end);
+      real_t y = parseRealSpan(&token, end);
+      state.vt.push_back(x);
+      state.vt.push_back(y);
+      continue;
+    }
+
+    // face
+    if (token[0] == 'f' && n >= 2 && IS_SPACE((token[1]))) {
+      token += 2;
+      skipSpaceSpan(&token, end);
+
+      PrimGroup &prim_group = state.prim_group;
+
+      face_t face;
+
+      face.smoothing_group_id = state.current_smoothing_id;
+      face.first_index = prim_group.faceIndices.size();
+
+      while (token < end && !IS_NEW_LINE(token[0])) {
+        vertex_index_t vi;
+        if (!parseTripleSpan(&token, end, static_cast<int>(state.v.size() / 3),
+                             static_cast<int>(state.vn.size() / 3),
+                             static_cast<int>(state.vt.size() / 2), &vi)) {
+          if (err) {
+            std::stringstream ss;
+            ss << "Failed parse `f' line(e.g. zero value for face index. line "
+               << state.line_num << ".)\n";
+            (*err) += ss.str();
+          }
+          return false;
+        }
+
+        state.greatest_v_idx = state.greatest_v_idx > vi.v_idx
+                                   ? state.greatest_v_idx
+                                   : vi.v_idx;
+        state.greatest_vn_idx = state.greatest_vn_idx > vi.vn_idx
+                                    ? state.greatest_vn_idx
+                                    : vi.vn_idx;
+        state.greatest_vt_idx = state.greatest_vt_idx > vi.vt_idx
+                                    ? state.greatest_vt_idx
+                                    : vi.vt_idx;
+
+        prim_group.faceIndices.push_back(vi);
+        while (token < end && (IS_SPACE((*token)) || (*token) == '\r'))
+          token++;
+      }
+
+      face.num_vertices = static_cast<unsigned int>(
+          prim_group.faceIndices.size() - face.first_index);
+      prim_group.faceGroup.push_back(face);
+
+      continue;
+    }
+
+    linebuf.assign(token, end);
+    if (!parseObjLine(&state, linebuf.c_str(), shapes, materials, readMatFn,
+                      triangulate, default_vcols_fallback, warn, err)) {
+      return false;
+    }
+  }
+
+  finishObj(&state, attrib, shapes, triangulate, default_vcols_fallback, warn);
+
+  if (err) {
+    (*err) += errss.str();
+  }
 
   return true;
 }
@@ -2790,16 +3442,15 @@ bool ObjReader::ParseFromFile(const std::string &filename,
 
 bool ObjReader::ParseFromString(const std::string &obj_text, const std::string &mtl_text,
                      const ObjReaderConfig &config) {
-  std::stringbuf obj_buf(obj_text);
   std::stringbuf mtl_buf(mtl_text);
 
-  std::istream obj_ifs(&obj_buf);
   std::istream mtl_ifs(&mtl_buf);
 
   MaterialStreamReader mtl_ss(mtl_ifs);
 
-  valid_ = LoadObj(&attrib_, &shapes_, &materials_, &warning_, &error_,
-                   &obj_ifs, &mtl_ss, config.triangulate, config.vertex_color);
+  valid_ = LoadObjFromBuffer(&attrib_, &shapes_, &materials_, &warning_,
+                             &error_, obj_text.data(), obj_text.size(), &mtl_ss,
+                             config.triangulate, config.vertex_color);
 
   return valid_;
 }
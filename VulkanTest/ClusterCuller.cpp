@@ -0,0 +1,312 @@
+/*
+ClusterCuller.cpp
+definitions for the functions in ClusterCuller.h
+*/
+
+#include "ClusterCuller.h"
+#include "DemoApp.h" // InstanceData
+
+#include <array>
+#include <cstring>
+#include <stdexcept>
+
+// Matches local_size_x in ClusterCull.comp.
+static const uint32_t CULL_GROUP_SIZE = 64;
+
+struct ClusterCullPushConstants
+{
+	uint32_t firstMeshlet;
+	uint32_t meshletCount;
+	uint32_t instanceCount;
+};
+
+void ClusterCuller::init(VkDevice device, VkPhysicalDevice physDevice, const std::vector<char>& shaderCode)
+{
+	mDevice = device;
+	mPhysDevice = physDevice;
+
+	// Cull params, meshlets, instances in, visible instances out, draws.
+	std::array<VkDescriptorSetLayoutBinding, 5> bindings = {};
+	for (uint32_t i = 0; i < bindings.size(); ++i)
+	{
+		bindings[i].binding = i;
+		bindings[i].descriptorType = i == 0 ? VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER : VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+		bindings[i].descriptorCount = 1;
+		bindings[i].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+	}
+
+	VkDescriptorSetLayoutCreateInfo layoutInfo = {};
+	layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+	layoutInfo.bindingCount = static_cast<uint32_t>(bindings.size());
+	layoutInfo.pBindings = bindings.data();
+
+	if (vkCreateDescriptorSetLayout(mDevice, &layoutInfo, nullptr, &mDescriptorSetLayout) != VK_SUCCESS)
+		throw std::runtime_error("failed to create cluster culling descriptor set layout!");
+
+	VkPushConstantRange pushConstantRange = {};
+	pushConstantRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+	pushConstantRange.size = sizeof(ClusterCullPushConstants);
+
+	VkPipelineLayoutCreateInfo pipelineLayoutInfo = {};
+	pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+	pipelineLayoutInfo.setLayoutCount = 1;
+	pipelineLayoutInfo.pSetLayouts = &mDescriptorSetLayout;
+	pipelineLayoutInfo.pushConstantRangeCount = 1;
+	pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
+
+	if (vkCreatePipelineLayout(mDevice, &pipelineLayoutInfo, nullptr, &mPipelineLayout) != VK_SUCCESS)
+		throw std::runtime_error("failed to create cluster culling pipeline layout!");
+
+	VkShaderModuleCreateInfo moduleInfo = {};
+	moduleInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+	moduleInfo.codeSize = shaderCode.size();
+	moduleInfo.pCode = reinterpret_cast<const uint32_t*>(shaderCode.data());
+
+	VkShaderModule shaderModule;
+	if (vkCreateShaderModule(mDevice, &moduleInfo, nullptr, &shaderModule) != VK_SUCCESS)
+		throw std::runtime_error("failed to create cluster culling shader module!");
+
+	VkComputePipelineCreateInfo pipelineInfo = {};
+	pipelineInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+	pipelineInfo.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+	pipelineInfo.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+	pipelineInfo.stage.module = shaderModule;
+	pipelineInfo.stage.pName = "main";
+	pipelineInfo.layout = mPipelineLayout;
+
+	VkResult result = vkCreateComputePipelines(mDevice, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &mPipeline);
+	vkDestroyShaderModule(mDevice, shaderModule, nullptr);
+
+	if (result != VK_SUCCESS)
+		throw std::runtime_error("failed to create cluster culling pipeline!");
+}
+
+void ClusterCuller::destroy()
+{
+	if (mDevice == VK_NULL_HANDLE)
+		return;
+
+	destroyFrameResources();
+
+	vkDestroyPipeline(mDevice, mPipeline, nullptr);
+	vkDestroyPipelineLayout(mDevice, mPipelineLayout, nullptr);
+	vkDestroyDescriptorSetLayout(mDevice, mDescriptorSetLayout, nullptr);
+
+	mPipeline = VK_NULL_HANDLE;
+	mPipelineLayout = VK_NULL_HANDLE;
+	mDescriptorSetLayout = VK_NULL_HANDLE;
+	mDevice = VK_NULL_HANDLE;
+}
+
+void ClusterCuller::createFrameResources(const MeshRegistry& meshes, MeshRegistry::MeshHandle mesh, const std::vector<VkBuffer>& instanceBuffers, uint32_t instanceCount)
+{
+	const MeshRecord& record = meshes.get(mesh);
+	if (record.meshlets.empty())
+		throw std::runtime_error("failed to create cluster culling resources, the mesh has no meshlets!");
+
+	mFirstMeshlet = record.firstMeshlet;
+	mMeshletCount = static_cast<uint32_t>(record.meshlets.size());
+	mInstanceCount = instanceCount;
+
+	// Only instanceCount changes from frame to frame, everything else is copied in from here before the culling.
+	VkDeviceSize drawsSize = mMeshletCount * sizeof(VkDrawIndexedIndirectCommand);
+	createBuffer(mDrawTemplate, drawsSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+	void* data;
+	vkMapMemory(mDevice, mDrawTemplate.memory, 0, drawsSize, 0, &data);
+	VkDrawIndexedIndirectCommand* draws = static_cast<VkDrawIndexedIndirectCommand*>(data);
+	for (uint32_t i = 0; i < mMeshletCount; ++i)
+	{
+		draws[i] = meshes.getDrawCommand(mesh, 0);
+		draws[i].firstIndex += record.meshlets[i].firstIndex;
+		draws[i].indexCount = record.meshlets[i].indexCount;
+	}
+	vkUnmapMemory(mDevice, mDrawTemplate.memory);
+
+	uint32_t frameCount = static_cast<uint32_t>(instanceBuffers.size());
+
+	std::array<VkDescriptorPoolSize, 2> poolSizes = {};
+	poolSizes[0].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+	poolSizes[0].descriptorCount = frameCount;
+	poolSizes[1].type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+	poolSizes[1].descriptorCount = frameCount * 4;
+
+	VkDescriptorPoolCreateInfo poolInfo = {};
+	poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+	poolInfo.poolSizeCount = static_cast<uint32_t>(poolSizes.size());
+	poolInfo.pPoolSizes = poolSizes.data();
+	poolInfo.maxSets = frameCount;
+
+	if (vkCreateDescriptorPool(mDevice, &poolInfo, nullptr, &mDescriptorPool) != VK_SUCCESS)
+		throw std::runtime_error("failed to create cluster culling descriptor pool!");
+
+	std::vector<VkDescriptorSetLayout> layouts(frameCount, mDescriptorSetLayout);
+	std::vector<VkDescriptorSet> descriptorSets(frameCount);
+
+	VkDescriptorSetAllocateInfo allocInfo = {};
+	allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+	allocInfo.descriptorPool = mDescriptorPool;
+	allocInfo.descriptorSetCount = frameCount;
+	allocInfo.pSetLayouts = layouts.data();
+
+	if (vkAllocateDescriptorSets(mDevice, &allocInfo, descriptorSets.data()) != VK_SUCCESS)
+		throw std::runtime_error("failed to allocate cluster culling descriptor sets!");
+
+	// Every meshlet gets room for all the instances, that's the worst case of the appends.
+	VkDeviceSize visibleSize = VkDeviceSize(mMeshletCount) * instanceCount * sizeof(InstanceData);
+
+	mFrames.resize(frameCount);
+	for (uint32_t i = 0; i < frameCount; ++i)
+	{
+		Frame& frame = mFrames[i];
+		frame.descriptorSet = descriptorSets[i];
+
+		createBuffer(frame.params, sizeof(ClusterCullParams), VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,
+			VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+		createBuffer(frame.visibleInstances, visibleSize, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+			VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+		createBuffer(frame.draws, drawsSize, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+			VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+		std::array<VkDescriptorBufferInfo, 5> bufferInfos = {};
+		bufferInfos[0] = { frame.params.buffer, 0, sizeof(ClusterCullParams) };
+		bufferInfos[1] = { meshes.getMeshletBuffer(), 0, VK_WHOLE_SIZE }; // Storage buffer offsets have alignment rules, firstMeshlet is pushed instead.
+		bufferInfos[2] = { instanceBuffers[i], 0, instanceCount * sizeof(InstanceData) };
+		bufferInfos[3] = { frame.visibleInstances.buffer, 0, visibleSize };
+		bufferInfos[4] = { frame.draws.buffer, 0, drawsSize };
+
+		std::array<VkWriteDescriptorSet, 5> descriptorWrites = {};
+		for (uint32_t binding = 0; binding < descriptorWrites.size(); ++binding)
+		{
+			descriptorWrites[binding].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+			descriptorWrites[binding].dstSet = frame.descriptorSet;
+			descriptorWrites[binding].dstBinding = binding;
+			descriptorWrites[binding].descriptorType = binding == 0 ? VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER : VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+			descriptorWrites[binding].descriptorCount = 1;
+			descriptorWrites[binding].pBufferInfo = &bufferInfos[binding];
+		}
+
+		vkUpdateDescriptorSets(mDevice, static_cast<uint32_t>(descriptorWrites.size()), descriptorWrites.data(), 0, nullptr);
+	}
+}
+
+void ClusterCuller::destroyFrameResources()
+{
+	for (Frame& frame : mFrames)
+	{
+		destroyBuffer(frame.params);
+		destroyBuffer(frame.visibleInstances);
+		destroyBuffer(frame.draws);
+	}
+	mFrames.clear();
+	destroyBuffer(mDrawTemplate);
+
+	// Frees the descriptor sets as well.
+	if (mDescriptorPool != VK_NULL_HANDLE)
+		vkDestroyDescriptorPool(mDevice, mDescriptorPool, nullptr);
+	mDescriptorPool = VK_NULL_HANDLE;
+}
+
+void ClusterCuller::update(uint32_t frameIndex, const ClusterCullParams& params)
+{
+	void* data;
+	vkMapMemory(mDevice, mFrames[frameIndex].params.memory, 0, sizeof(params), 0, &data);
+	memcpy(data, &params, sizeof(params));
+	vkUnmapMemory(mDevice, mFrames[frameIndex].params.memory);
+}
+
+void ClusterCuller::cull(VkCommandBuffer commandBuffer, uint32_t frameIndex)
+{
+	Frame& frame = mFrames[frameIndex];
+
+	VkBufferCopy region = {};
+	region.size = mMeshletCount * sizeof(VkDrawIndexedIndirectCommand);
+	vkCmdCopyBuffer(commandBuffer, mDrawTemplate.buffer, frame.draws.buffer, 1, &region);
+
+	// The shader counts up from the instanceCount of 0 that was just copied in.
+	VkMemoryBarrier barrier = {};
+	barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+	barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+	barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+	vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+
+	vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, mPipeline);
+	vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, mPipelineLayout, 0, 1, &frame.descriptorSet, 0, nullptr);
+
+	ClusterCullPushConstants pushConstants = { mFirstMeshlet, mMeshletCount, mInstanceCount };
+	vkCmdPushConstants(commandBuffer, mPipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(pushConstants), &pushConstants);
+
+	vkCmdDispatch(commandBuffer, (mInstanceCount + CULL_GROUP_SIZE - 1) / CULL_GROUP_SIZE, mMeshletCount, 1);
+
+	barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+	barrier.dstAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT;
+	vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_VERTEX_INPUT_BIT,
+		0, 1, &barrier, 0, nullptr, 0, nullptr);
+}
+
+void ClusterCuller::draw(VkCommandBuffer commandBuffer, uint32_t frameIndex)
+{
+	Frame& frame = mFrames[frameIndex];
+
+	for (uint32_t meshlet = 0; meshlet < mMeshletCount; ++meshlet)
+	{
+		// The meshlet's visible instances are packed at the start of its slice.
+		VkDeviceSize offset = VkDeviceSize(meshlet) * mInstanceCount * sizeof(InstanceData);
+		vkCmdBindVertexBuffers(commandBuffer, 1, 1, &frame.visibleInstances.buffer, &offset);
+		vkCmdDrawIndexedIndirect(commandBuffer, frame.draws.buffer, meshlet * sizeof(VkDrawIndexedIndirectCommand), 1, sizeof(VkDrawIndexedIndirectCommand));
+	}
+}
+
+void ClusterCuller::createBuffer(Buffer& buffer, VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties)
+{
+	VkBufferCreateInfo bufferInfo = {};
+	bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+	bufferInfo.size = size;
+	bufferInfo.usage = usage;
+	bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+	if (vkCreateBuffer(mDevice, &bufferInfo, nullptr, &buffer.buffer) != VK_SUCCESS)
+		throw std::runtime_error("failed to create cluster culling buffer!");
+
+	VkMemoryRequirements memRequirements;
+	vkGetBufferMemoryRequirements(mDevice, buffer.buffer, &memRequirements);
+
+	VkMemoryAllocateInfo allocInfo = {};
+	allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+	allocInfo.allocationSize = memRequirements.size;
+	allocInfo.memoryTypeIndex = findMemoryType(memRequirements.memoryTypeBits, properties);
+
+	if (vkAllocateMemory(mDevice, &allocInfo, nullptr, &buffer.memory) != VK_SUCCESS)
+	{
+		vkDestroyBuffer(mDevice, buffer.buffer, nullptr);
+		buffer.buffer = VK_NULL_HANDLE;
+		throw std::runtime_error("failed to allocate cluster culling buffer memory!");
+	}
+
+	vkBindBufferMemory(mDevice, buffer.buffer, buffer.memory, 0);
+}
+
+void ClusterCuller::destroyBuffer(Buffer& buffer)
+{
+	if (buffer.buffer != VK_NULL_HANDLE)
+	{
+		vkDestroyBuffer(mDevice, buffer.buffer, nullptr);
+		vkFreeMemory(mDevice, buffer.memory, nullptr);
+	}
+	buffer = Buffer();
+}
+
+uint32_t ClusterCuller::findMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties)
+{
+	VkPhysicalDeviceMemoryProperties memProperties;
+	vkGetPhysicalDeviceMemoryProperties(mPhysDevice, &memProperties);
+
+	for (uint32_t i = 0; i < memProperties.memoryTypeCount; ++i)
+	{
+		if ((typeFilter & (1 << i)) &&
+			(memProperties.memoryTypes[i].propertyFlags & properties) == properties)
+			return i;
+	}
+
+	throw std::runtime_error("failed to find suitable memory type!");
+}
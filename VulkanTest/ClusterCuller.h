@@ -0,0 +1,94 @@
+/*
+ClusterCuller.h
+Culls the meshlets of an instanced mesh on the GPU, then draws what survived.
+
+Every frame a compute shader (shaders/ClusterCull.comp) tests each (instance, meshlet) pair against the view frustum
+and the meshlet's normal cone. Every meshlet has a slice of INSTANCE_COUNT slots in a per image instance buffer, and the
+instances that can see it are appended to its slice. The meshlet is then drawn with one vkCmdDrawIndexedIndirect whose
+instanceCount is the length of that list, with the instance binding pointed at the slice. A meshlet nobody sees becomes
+an empty draw instead of up to MESHLET_MAX_TRIANGLES triangles for every instance.
+
+Only compute shaders and plain indirect draws with a draw count of 1 are used, no mesh shaders, multiDrawIndirect,
+drawIndirectFirstInstance or drawIndirectCount, so this runs on any Vulkan 1.0 device including software ones.
+*/
+
+#ifndef CLUSTER_CULLER_H
+#define CLUSTER_CULLER_H
+
+#include <vulkan/vulkan.h>
+
+#include "MeshRegistry.h"
+
+#include <vector>
+
+// What the culling shader needs each frame, in the space the instances are placed in (before the model matrix).
+struct ClusterCullParams
+{
+	float planes[6][4]; // Frustum planes, xyz normal pointing inside and w distance.
+	float cameraPos[4];
+};
+
+class ClusterCuller
+{
+public:
+	// shaderCode is the SPIR-V of ClusterCull.comp.
+	void init(VkDevice device, VkPhysicalDevice physDevice, const std::vector<char>& shaderCode);
+	void destroy();
+
+	/*
+	Buffers and descriptor sets for drawing mesh, one set per entry of instanceBuffers (one per swap chain image).
+	The instance buffers hold instanceCount InstanceData each and need VK_BUFFER_USAGE_STORAGE_BUFFER_BIT.
+	Has to be called again whenever the mesh, its meshlets, the registry's buffers or the instance buffers change.
+	*/
+	void createFrameResources(const MeshRegistry& meshes, MeshRegistry::MeshHandle mesh, const std::vector<VkBuffer>& instanceBuffers, uint32_t instanceCount);
+	void destroyFrameResources();
+
+	void update(uint32_t frameIndex, const ClusterCullParams& params); // Before submitting the frame.
+
+	// Outside of a render pass: resets the draws, runs the culling and makes the results visible to the draws.
+	void cull(VkCommandBuffer commandBuffer, uint32_t frameIndex);
+
+	/*
+	One indirect draw per meshlet. The caller binds the pipeline, binding 0 and the registry's index buffer,
+	binding 1 (per instance) is bound here.
+	*/
+	void draw(VkCommandBuffer commandBuffer, uint32_t frameIndex);
+
+	uint32_t getMeshletCount() const { return mMeshletCount; }
+
+private:
+	struct Buffer
+	{
+		VkBuffer buffer = VK_NULL_HANDLE;
+		VkDeviceMemory memory = VK_NULL_HANDLE;
+	};
+
+	// Per swap chain image.
+	struct Frame
+	{
+		Buffer params; // ClusterCullParams, host visible.
+		Buffer visibleInstances; // instanceCount InstanceData per meshlet.
+		Buffer draws; // VkDrawIndexedIndirectCommand per meshlet.
+		VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
+	};
+
+	void createBuffer(Buffer& buffer, VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties);
+	void destroyBuffer(Buffer& buffer);
+	uint32_t findMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties);
+
+	VkDevice mDevice = VK_NULL_HANDLE;
+	VkPhysicalDevice mPhysDevice = VK_NULL_HANDLE;
+
+	VkDescriptorSetLayout mDescriptorSetLayout = VK_NULL_HANDLE;
+	VkPipelineLayout mPipelineLayout = VK_NULL_HANDLE;
+	VkPipeline mPipeline = VK_NULL_HANDLE;
+
+	VkDescriptorPool mDescriptorPool = VK_NULL_HANDLE;
+	std::vector<Frame> mFrames;
+	Buffer mDrawTemplate; // The draws with instanceCount 0, copied over the frame's draws before culling.
+	uint32_t mFirstMeshlet = 0;
+	uint32_t mMeshletCount = 0;
+	uint32_t mInstanceCount = 0;
+};
+
+#endif // !CLUSTER_CULLER_H
@@ -59,6 +59,7 @@ void DemoApp::initApp()
 	mWindow = glfwCreateWindow(WINDOW_WIDTH, WINDOW_WIDTH, "Jaminal3D_EMA", nullptr, nullptr); // then just create the window!
 	glfwSetWindowUserPointer(mWindow, this);
 	glfwSetFramebufferSizeCallback(mWindow, framebufferResizeCallback); //Set up the framebuffer resize callback
+	glfwSetKeyCallback(mWindow, keyCallback); // Frame pacing controls, see keyCallback.
 }
 
 // Initializes a lot of vulkan stuff. Like, everything.
@@ -68,6 +69,11 @@ void DemoApp::initApp()
 // Pointer to the variable that stores the handle for the object.
 void DemoApp::initVulkan()
 {
+	//Decided first, the render graph, descriptors and pipelines all depend on it.
+	mVirtualTexturing = ENABLE_VIRTUAL_TEXTURING && std::ifstream("shaders/frag_vt.spv").good() && std::ifstream("shaders/feedback_frag.spv").good();
+	if (ENABLE_VIRTUAL_TEXTURING && !mVirtualTexturing)
+		std::cout << "virtual texturing off: shaders/frag_vt.spv or shaders/feedback_frag.spv is missing, run shaders/compile.bat" << std::endl;
+
 	createInstance();
 	setupDebugManager();
 	createSurface();
@@ -75,21 +81,50 @@ void DemoApp::initVulkan()
 	createLogicalDevice();
 	createSwapChain();
 	createImageViews();
-	createRenderPass();
+	createRenderGraph();
 	createDescriptorSetLayout();
 	createGraphicsPipeline();
+	createShadowPipeline();
+	if (ENABLE_DEPTH_PREPASS)
+		createDepthPrepassPipeline();
+	if (mSettings.postAA == PostAA::FXAA)
+		createPostProcessPipeline();
+	if (mVirtualTexturing)
+		createFeedbackPipeline();
 	createCommandPool();
-	createColorResources();
-	createDepthResources();
-	createFramebuffers();
+	mMeshes.init(mDevice, mPhysDevice, mGraphicsQueue, findQueueFamilies(mPhysDevice).graphicsFamily.value());
+	mTextures.init(mDevice, mPhysDevice, mGraphicsQueue, findQueueFamilies(mPhysDevice).graphicsFamily.value(), mMaterials, mMemoryBudgetSupported ?
+		reinterpret_cast<PFN_vkGetPhysicalDeviceMemoryProperties2KHR>(vkGetInstanceProcAddr(mInstance, "vkGetPhysicalDeviceMemoryProperties2KHR")) : nullptr);
+	mTextures.setBudget(mTextureBudget);
+	mMaterials.setTextureAllocator(
+		[this](int width, int height, size_t& rowPitch, void*& memory) { return mTextures.allocateStaging(width, height, rowPitch, memory); },
+		[this](void* memory) { mTextures.freeStaging(memory); });
+	mTextureRequest = mMaterials.requestTexture(TEXTURE_PATH); // Decodes on a worker thread while the model loads.
+	if (mVirtualTexturing)
+	{
+		// Cutting the texture into pages takes a while, but only happens once.
+		if (!std::ifstream(VIRTUAL_TEXTURE_PATH).good() && !VirtualTexture::build(VIRTUAL_TEXTURE_SOURCE, VIRTUAL_TEXTURE_PATH))
+			throw std::runtime_error("failed to build virtual texture " + VIRTUAL_TEXTURE_PATH + " from " + VIRTUAL_TEXTURE_SOURCE + "!");
+		mVirtualTexture.init(mDevice, mPhysDevice, mGraphicsQueue, findQueueFamilies(mPhysDevice).graphicsFamily.value(), VIRTUAL_TEXTURE_PATH);
+	}
+	mModel = STREAM_MODEL ? streamModel(MODEL_PATH) : loadModel(MODEL_PATH);
+	if (ENABLE_CLUSTER_CULLING)
+	{
+		mMeshes.buildMeshlets(mModel);
+		mClusterCuller.init(mDevice, mPhysDevice, readFile("shaders/cluster_cull_comp.spv"));
+	}
 	createTextureImage();
-	createTextureImageView();
 	createTextureSampler();
-	loadModel();
+	createShadowSampler();
 	prepareInstanceData();
-	createVertexBuffer();
-	createIndexBuffer();
 	createUniformBuffers();
+	createShadowBuffers();
+	createSortedInstanceBuffers();
+	if (ENABLE_CLUSTER_CULLING)
+		mClusterCuller.createFrameResources(mMeshes, mModel, mSortedInstanceBuffers, INSTANCE_COUNT);
+	if (mVirtualTexturing)
+		mVirtualTexture.createFrameResources(static_cast<uint32_t>(mSwapChainImages.size()), VirtualTexture::getFeedbackExtent(mSwapChainExtent));
+	createQueryPool();
 	createDescriptorPool();
 	createDescriptorSets();
 	createCommandBuffers();
@@ -140,6 +175,16 @@ void DemoApp::createInstance()
 	// now get glfw extensions that we need.
 	std::vector<const char*> exts = getRequiredExtensions();
 
+	// VK_EXT_memory_budget is read through vkGetPhysicalDeviceMemoryProperties2KHR, which needs this one. createLogicalDevice checks the device.
+	for (const VkExtensionProperties& ext : extensions)
+	{
+		if (strcmp(ext.extensionName, VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME) == 0)
+		{
+			exts.push_back(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
+			mMemoryBudgetSupported = true;
+		}
+	}
+
 	createInfo.enabledExtensionCount = static_cast<uint32_t>(exts.size());
 	createInfo.ppEnabledExtensionNames = exts.data();
 
@@ -205,7 +250,7 @@ void DemoApp::pickPhysicalDevice()
 		if (isDeviceSuitable(dev))
 		{
 			mPhysDevice = dev;
-			mMSAASamples = getMaxUsableSampleCount();
+			applyRenderSettings();
 			break;
 		}
 	}
@@ -240,6 +285,12 @@ void DemoApp::createLogicalDevice()
 	deviceFeatures.samplerAnisotropy = VK_TRUE;
 	deviceFeatures.sampleRateShading = VK_TRUE; //enable sample shading feature for the device
 
+	//Pipeline statistics are optional, they're only used to report fragment shader invocations.
+	VkPhysicalDeviceFeatures supportedFeatures;
+	vkGetPhysicalDeviceFeatures(mPhysDevice, &supportedFeatures);
+	mPipelineStatisticsSupported = supportedFeatures.pipelineStatisticsQuery == VK_TRUE;
+	deviceFeatures.pipelineStatisticsQuery = supportedFeatures.pipelineStatisticsQuery;
+
 	//deviceFeatures.textureCompressionBC = VK_TRUE; //enable texture compression
 	//deviceFeatures.textureCompressionASTC_LDR = VK_TRUE;
 	//deviceFeatures.textureCompressionETC2 = VK_TRUE;
@@ -250,8 +301,24 @@ void DemoApp::createLogicalDevice()
 	createInfo.queueCreateInfoCount = static_cast<uint32_t>(deviceQueueCreationInfos.size());
 	createInfo.pQueueCreateInfos = deviceQueueCreationInfos.data();
 	createInfo.pEnabledFeatures = &deviceFeatures;
-	createInfo.enabledExtensionCount = static_cast<uint32_t>(deviceExtensions.size());
-	createInfo.ppEnabledExtensionNames = deviceExtensions.data();
+
+	//VK_EXT_memory_budget is optional, without it the texture budget comes from the heap size (see TextureResidency).
+	std::vector<const char*> extensions(deviceExtensions.begin(), deviceExtensions.end());
+	if (mMemoryBudgetSupported)
+	{
+		uint32_t extensionCount;
+		vkEnumerateDeviceExtensionProperties(mPhysDevice, nullptr, &extensionCount, nullptr);
+		std::vector<VkExtensionProperties> availableExtensions(extensionCount);
+		vkEnumerateDeviceExtensionProperties(mPhysDevice, nullptr, &extensionCount, availableExtensions.data());
+
+		mMemoryBudgetSupported = std::any_of(availableExtensions.begin(), availableExtensions.end(),
+			[](const VkExtensionProperties& extension) { return strcmp(extension.extensionName, VK_EXT_MEMORY_BUDGET_EXTENSION_NAME) == 0; });
+		if (mMemoryBudgetSupported)
+			extensions.push_back(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+	}
+
+	createInfo.enabledExtensionCount = static_cast<uint32_t>(extensions.size());
+	createInfo.ppEnabledExtensionNames = extensions.data();
 	//createInfo.enabledExtensionCount = 0;
 
 	// enabledLayerCount and ppEnabledLayerNames are ignored by latest implementations,
@@ -282,6 +349,7 @@ void DemoApp::createSwapChain()
 	// Use helper functions to give us our format, present mode, and extent (bounds)
 	VkSurfaceFormatKHR surfaceFormat = chooseSwapSurfaceFormat(swapChainSupport.mFormats);
 	VkPresentModeKHR presentMode = chooseSwapPresentMode(swapChainSupport.mPresentModes);
+	mPresentMode = presentMode;
 	VkExtent2D extent = chooseSwapExtent(swapChainSupport.mCapabilities);
 
 	// +1 because using just min means sometimes we have to wait on the driver to complete internal ops before aquiring another image to render to.
@@ -358,6 +426,13 @@ void DemoApp::createSwapChain()
 	// Give the images their format and extent
 	mSwapChainImageFormat = surfaceFormat.format;
 	mSwapChainExtent = extent;
+
+	//The projection only changes with the aspect ratio, so it is rebuilt with the swap chain after a resize.
+	mCameraProj = glm::perspective(glm::radians(45.0f), mSwapChainExtent.width / (float)mSwapChainExtent.height, CAMERA_NEAR, CAMERA_FAR);
+
+	//GLM was designed for OpenGL, where the Y coordinate of the clip coordinates is inverted. Flip the sign on the
+	//scaling factor of the Y axis in the projection matrix, otherwise the image is rendered upside down.
+	mCameraProj[1][1] *= -1;
 }
 
 void DemoApp::createImageViews()
@@ -394,154 +469,285 @@ void DemoApp::createImageViews()
 	}
 }
 
-void DemoApp::createRenderPass()
+void DemoApp::createRenderGraph()
 {
-	// A color buffer attachment represented by one of the images from the swap chain
-	VkAttachmentDescription colorAttachment = {};
-	colorAttachment.format = mSwapChainImageFormat;
-	colorAttachment.samples = mMSAASamples; // >1 if multisampling
 	/*
-		VK_ATTACHMENT_LOAD_OP_LOAD: Preserve the existing contents of the attachment
-
-		VK_ATTACHMENT_LOAD_OP_CLEAR: Clear the values to a constant at the start
+	Instead of hand writing a render pass, framebuffers and the images behind them, we describe the frame to the render graph
+	(which images every pass reads and writes) and let it figure out the rest in compile():
+	render passes, framebuffers, layout transitions and barriers, and memory for the images that only live within a frame.
+	*/
+	mRenderGraph.init(mDevice, mPhysDevice);
 
-		VK_ATTACHMENT_LOAD_OP_DONT_CARE: Existing contents are undefined; we don't care about them
+	/*
+	The swap chain images come from the presentation engine, so they are imported.
+	Their contents are garbage when we get them (UNDEFINED), and they have to end up in PRESENT_SRC_KHR.
+	The image available semaphore is waited on at the color attachment output stage, so that's where the
+	first transition has to wait as well.
+	*/
+	RenderGraph::ImageDesc backbufferDesc;
+	backbufferDesc.format = mSwapChainImageFormat;
+	backbufferDesc.extent = mSwapChainExtent;
 
-		VK_ATTACHMENT_STORE_OP_STORE: Rendered contents will be stored in memory and can be read later
+	RenderGraph::ResourceHandle backbuffer = mRenderGraph.importImage("backbuffer", backbufferDesc, mSwapChainImages, mSwapChainImageViews,
+		VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_PRESENT_SRC_KHR, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT);
 
-		VK_ATTACHMENT_STORE_OP_DONT_CARE: Contents of the framebuffer will be undefined after the rendering operation
-	*/
-	colorAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
-	colorAttachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+	// The depth buffer only lives for the duration of the scene pass, so the graph owns it.
+	RenderGraph::ImageDesc depthDesc;
+	depthDesc.format = findDepthFormat();
+	depthDesc.extent = mSwapChainExtent;
+	depthDesc.samples = mMSAASamples;
 
-	// We don't care about depth!
-	colorAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
-	colorAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+	RenderGraph::ResourceHandle depth = mRenderGraph.createImage("depth", depthDesc);
 
 	/*
-		Remember that textures and framebuffers are represented by VkImage objects.
-		common layouts for those include:
+	Shadow map for the point light: a depth cube map, one pass per face.
+	Each face only draws the instances that cullShadowCasters found inside that face's frustum,
+	so an instance costs at most a few draws' worth of vertices instead of six.
+	*/
+	RenderGraph::ImageDesc shadowDesc;
+	shadowDesc.format = findDepthFormat();
+	shadowDesc.extent = { SHADOW_MAP_SIZE, SHADOW_MAP_SIZE };
+	shadowDesc.layers = 6;
+	shadowDesc.viewType = VK_IMAGE_VIEW_TYPE_CUBE;
+	shadowDesc.flags = VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT;
 
-		VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL: Images used as color attachment
+	mShadowMap = mRenderGraph.createImage("shadow map", shadowDesc);
 
-		VK_IMAGE_LAYOUT_PRESENT_SRC_KHR: Images to be presented in the swap chain
+	VkClearDepthStencilValue clearShadow = { 1.0f, 0 };
+	for (uint32_t face = 0; face < 6; ++face)
+	{
+		mShadowPasses[face] = mRenderGraph.addPass("shadow face " + std::to_string(face), [this, face](VkCommandBuffer commandBuffer, uint32_t frameIndex)
+		{
+			vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, mShadowPipeline);
 
-		VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL: Images to be used as destination for a memory copy operation
+			// Every face has its own slice of the shadow instance buffer.
+			VkBuffer vertexBuffers[] = { mMeshes.getPositionBuffer(), mShadowInstanceBuffers[frameIndex] };
+			VkDeviceSize offsets[] = { 0, face * INSTANCE_COUNT * sizeof(InstanceData) };
+			vkCmdBindVertexBuffers(commandBuffer, 0, 2, vertexBuffers, offsets);
+			vkCmdBindIndexBuffer(commandBuffer, mMeshes.getIndexBuffer(), 0, VK_INDEX_TYPE_UINT32);
 
-		The initialLayout specifies which layout the image will have before the render pass begins. 
-		The finalLayout specifies the layout to automatically transition to when the render pass finishes. 
-		Using VK_IMAGE_LAYOUT_UNDEFINED for initialLayout means that we don't care what previous layout the image was in.
-	*/
-	colorAttachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-	colorAttachment.finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+			vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, mShadowPipelineLayout, 0, 1, &mDescriptorSets[frameIndex], 0, nullptr);
+			vkCmdPushConstants(commandBuffer, mShadowPipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(uint32_t), &face);
 
-	// a single render pass can have multiple subpasses (I.e, for post-processing)
+			/*
+			The command buffers are recorded once, but the number of instances per face changes every frame as the light moves.
+			So the instance count comes from a buffer that cullShadowCasters writes each frame.
+			*/
+			vkCmdDrawIndexedIndirect(commandBuffer, mShadowDrawBuffers[frameIndex], face * sizeof(VkDrawIndexedIndirectCommand), 1, sizeof(VkDrawIndexedIndirectCommand));
+		});
+
+		mRenderGraph.addDepthOutput(mShadowPasses[face], mShadowMap, &clearShadow, face);
+	}
 
 	/*
-	The format should be the same as the depth image itself. 
-	This time we don't care about storing the depth data (storeOp), because it will not be used after drawing has finished.
+	Cluster culling: a compute pass that finds, for every meshlet of the model, the instances that can see it (see ClusterCuller).
+	The depth pre-pass and the scene pass both draw from its results, so they still cover exactly the same pixels.
+	It has no attachments for the graph to follow, so it is kept alive as a pass with side effects.
 	*/
-	VkAttachmentDescription depthAttachment = {};
-	depthAttachment.format = findDepthFormat();
-	depthAttachment.samples = mMSAASamples;
-	depthAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
-	depthAttachment.storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
-	depthAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
-	depthAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
-	depthAttachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-	depthAttachment.finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+	if (ENABLE_CLUSTER_CULLING)
+	{
+		mClusterCullPass = mRenderGraph.addPass("cluster culling", [this](VkCommandBuffer commandBuffer, uint32_t frameIndex)
+		{
+			mClusterCuller.cull(commandBuffer, frameIndex);
+		});
+
+		mRenderGraph.setSideEffects(mClusterCullPass);
+	}
+
+	VkClearDepthStencilValue clearDepth = { 1.0f, 0 };
 
 	/*
-	Multisampled images cannot be presented directly.
-	We first need to resolve them to a regular image.
-	This requirement does not apply to the depth buffer,
-	since it won't be presented at any point. 
-	Therefore we will have to add only one new attachment for color which is a so-called resolve attachment:
+	Depth pre-pass: lay down the depth of the whole scene first with a cheap, position only draw.
+	The scene pass then tests with EQUAL and doesn't write depth, so the expensive fragment shader
+	runs exactly once per covered sample no matter how much the teapots overlap.
 	*/
-	VkAttachmentDescription colorAttachmentResolve = {};
-	colorAttachmentResolve.format = mSwapChainImageFormat;
-	colorAttachmentResolve.samples = VK_SAMPLE_COUNT_1_BIT;
-	colorAttachmentResolve.loadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
-	colorAttachmentResolve.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
-	colorAttachmentResolve.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
-	colorAttachmentResolve.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
-	colorAttachmentResolve.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-	colorAttachmentResolve.finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+	if (ENABLE_DEPTH_PREPASS)
+	{
+		mDepthPrepass = mRenderGraph.addPass("depth prepass", [this](VkCommandBuffer commandBuffer, uint32_t frameIndex)
+		{
+			vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, mDepthPrepassPipeline);
 
-	//We intend to use the attachment as a color buffer.
-	VkAttachmentReference colorAttachRef = {};
-	colorAttachRef.attachment = 0; // the index of the attachment descriptions array.
-	colorAttachRef.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+			VkBuffer vertexBuffers[] = { mMeshes.getPositionBuffer(), mSortedInstanceBuffers[frameIndex] };
+			VkDeviceSize offsets[] = { 0, 0 };
+			vkCmdBindVertexBuffers(commandBuffer, 0, 2, vertexBuffers, offsets);
+			vkCmdBindIndexBuffer(commandBuffer, mMeshes.getIndexBuffer(), 0, VK_INDEX_TYPE_UINT32);
 
-	VkAttachmentReference depthAttachRef = {};
-	depthAttachRef.attachment = 1;
-	depthAttachRef.layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+			vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, mPipelineLayout, 0, 1, &mDescriptorSets[frameIndex], 0, nullptr);
 
-	VkAttachmentReference colorAttachmentResolveRef = {};
-	colorAttachmentResolveRef.attachment = 2;
-	colorAttachmentResolveRef.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+			if (ENABLE_CLUSTER_CULLING)
+				mClusterCuller.draw(commandBuffer, frameIndex);
+			else
+			{
+				const MeshRecord& model = mMeshes.get(mModel);
+				vkCmdDrawIndexed(commandBuffer, model.indexCount, INSTANCE_COUNT, model.firstIndex, model.vertexOffset, 0);
+			}
+		});
 
-	VkSubpassDescription subpass = {};
-	subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
-	/*
-	The index of the attachment in this array is directly referenced from the fragment shader with the 
-	layout(location = 0) out vec4 outColor directive!
+		mRenderGraph.addDepthOutput(mDepthPrepass, depth, &clearDepth);
+	}
 
-	Other types of attachments:
-	pInputAttachments: Attachments that are read from a shader
+	mScenePass = mRenderGraph.addPass("scene", [this](VkCommandBuffer commandBuffer, uint32_t frameIndex)
+	{
+		//Count the fragment shader invocations of the scene, see readPipelineStatistics.
+		if (mQueryPool != VK_NULL_HANDLE)
+			vkCmdBeginQuery(commandBuffer, mQueryPool, frameIndex, 0);
 
-	pResolveAttachments: Attachments used for multisampling color attachments
+		//The second parameter specifies if the pipeline object is a graphics or compute pipeline.
+		vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, mGraphicsPipeline);
 
-	pDepthStencilAttachment: Attachments for depth and stencil data
+		/*
+		The first two parameters, besides the command buffer, 
+		specify the offset and number of bindings we're going to specify vertex buffers for. 
+		The last two parameters specify the array of vertex buffers to bind and the byte offsets to start reading vertex data from.
+		*/
+		//The instances are sorted front to back every frame (sortInstances), so they live in a per image buffer.
+		//Every mesh lives in the same vertex arena, so it is bound once no matter how many meshes get drawn.
+		VkBuffer vertexBuffers[] = { mMeshes.getVertexBuffer(), mSortedInstanceBuffers[frameIndex] };
+		VkDeviceSize offsets[] = { 0 };
+		vkCmdBindVertexBuffers(commandBuffer, 0, 1, &vertexBuffers[0], offsets);
+		vkCmdBindVertexBuffers(commandBuffer, 1, 1, &vertexBuffers[1], offsets);
 
-	pPreserveAttachments: Attachments that are not used by this subpass, 
-	but for which the data must be preserved
-	*/
-	subpass.colorAttachmentCount = 1;
-	subpass.pColorAttachments = &colorAttachRef;
-	subpass.pDepthStencilAttachment = &depthAttachRef;
-	subpass.pResolveAttachments = &colorAttachmentResolveRef;
+		//An index buffer is bound with vkCmdBindIndexBuffer which has the index buffer, 
+		//a byte offset into it, and the type of index data as parameters
+		vkCmdBindIndexBuffer(commandBuffer, mMeshes.getIndexBuffer(), 0, VK_INDEX_TYPE_UINT32);
+
+		//Bind the right descriptor set for each swap chain image to the descriptors in the shader.
+		vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, mPipelineLayout, 0, 1, &mDescriptorSets[frameIndex], 0, nullptr);
+
+		/*
+		The first two parameters specify the number of indices and the number of instances.
+		The next parameter specifies an offset into the index buffer, 
+		using a value of 1 would cause the graphics card to start reading at the second index. 
+		The second to last parameter specifies an offset to add to the indices in the index buffer. 
+		The final parameter specifies an offset for instancing.
+		The model's indices start at firstIndex in the index arena and are relative to its first vertex, vertexOffset.
+		*/
+		//With cluster culling every meshlet is its own indirect draw, over just the instances that can see it (binding 1 is rebound per meshlet).
+		if (ENABLE_CLUSTER_CULLING)
+			mClusterCuller.draw(commandBuffer, frameIndex);
+		else
+		{
+			const MeshRecord& model = mMeshes.get(mModel);
+			vkCmdDrawIndexed(commandBuffer, model.indexCount, INSTANCE_COUNT, model.firstIndex, model.vertexOffset, 0);
+		}
+
+		if (mQueryPool != VK_NULL_HANDLE)
+			vkCmdEndQuery(commandBuffer, mQueryPool, frameIndex);
+	});
+
+	VkClearColorValue clearColor = { .0f, .0f, .0f, 1.0f };
 
-	VkSubpassDependency dependency = {};
 	/*
-	The special value VK_SUBPASS_EXTERNAL refers to the implicit subpass before or 
-	after the render pass depending on whether it is specified in srcSubpass or dstSubpass. 
-	The index 0 refers to our subpass, which is the first and only one. 
-	The dstSubpass must always be higher than srcSubpass to prevent cycles in the dependency graph.
+	With a post process AA pass the scene goes into an intermediate image that the pass samples,
+	otherwise the scene ends up in the swap chain image directly.
 	*/
-	dependency.srcSubpass = VK_SUBPASS_EXTERNAL;
-	dependency.dstSubpass = 0;
+	RenderGraph::ResourceHandle sceneTarget = backbuffer;
+	if (mSettings.postAA == PostAA::FXAA)
+	{
+		RenderGraph::ImageDesc sceneColorDesc;
+		sceneColorDesc.format = mSwapChainImageFormat;
+		sceneColorDesc.extent = mSwapChainExtent;
+
+		mSceneColor = mRenderGraph.createImage("scene color", sceneColorDesc);
+		sceneTarget = mSceneColor;
+	}
 
 	/*
-	We need to wait for the swap chain to finish reading from the image before we can access it. 
-	This can be accomplished by waiting on the color attachment output stage itself.
+	Multisampled images cannot be presented directly, we first need to resolve them to a regular image.
+	So with MSAA on we draw into a multisampled color image that only lives inside this pass and resolve it into the scene target.
+	Without it we can just draw straight into the scene target.
 	*/
-	dependency.srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-	dependency.srcAccessMask = 0;
+	if (mMSAASamples != VK_SAMPLE_COUNT_1_BIT)
+	{
+		RenderGraph::ImageDesc colorDesc;
+		colorDesc.format = mSwapChainImageFormat;
+		colorDesc.extent = mSwapChainExtent;
+		colorDesc.samples = mMSAASamples;
+
+		RenderGraph::ResourceHandle color = mRenderGraph.createImage("color", colorDesc);
+
+		mRenderGraph.addColorOutput(mScenePass, color, &clearColor);
+		mRenderGraph.addResolveOutput(mScenePass, sceneTarget);
+	}
+	else
+		mRenderGraph.addColorOutput(mScenePass, sceneTarget, &clearColor);
+
+	if (ENABLE_DEPTH_PREPASS)
+		mRenderGraph.addDepthInput(mScenePass, depth);
+	else
+		mRenderGraph.addDepthOutput(mScenePass, depth, &clearDepth);
+	mRenderGraph.addUsage(mScenePass, mShadowMap, ResourceUsage::SampledFragment);
 
 	/*
-	The operations that should wait on this are in the color attachment stage and 
-	involve the reading and writing of the color attachment. 
-	These settings will prevent the transition from happening until 
-	it's actually necessary (and allowed): 
-	when we want to start writing colors to it.
+	Virtual texture feedback: the scene again, into a small integer target, with a fragment shader that writes the page
+	every pixel samples instead of a color. Its own depth buffer, since the scene's is full size and maybe multisampled.
+	The readback pass copies it into a buffer that the CPU reads once the frame is done (see updateVirtualTexture),
+	nothing in the graph reads that, so it's kept alive by its side effects.
 	*/
-	dependency.dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-	dependency.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+	if (mVirtualTexturing)
+	{
+		RenderGraph::ImageDesc feedbackDesc;
+		feedbackDesc.format = VirtualTexture::FEEDBACK_FORMAT;
+		feedbackDesc.extent = VirtualTexture::getFeedbackExtent(mSwapChainExtent);
+
+		RenderGraph::ImageDesc feedbackDepthDesc = feedbackDesc;
+		feedbackDepthDesc.format = findDepthFormat();
 
-	std::array<VkAttachmentDescription, 3> attachments = { colorAttachment, depthAttachment, colorAttachmentResolve };
+		mFeedback = mRenderGraph.createImage("vt feedback", feedbackDesc);
+		RenderGraph::ResourceHandle feedbackDepth = mRenderGraph.createImage("vt feedback depth", feedbackDepthDesc);
+
+		mFeedbackPass = mRenderGraph.addPass("vt feedback", [this](VkCommandBuffer commandBuffer, uint32_t frameIndex)
+		{
+			vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, mFeedbackPipeline);
 
-	VkRenderPassCreateInfo renderPassInfo = {};
-	renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
-	renderPassInfo.attachmentCount = static_cast<uint32_t>(attachments.size());
-	renderPassInfo.pAttachments = attachments.data();
-	renderPassInfo.subpassCount = 1;
-	renderPassInfo.pSubpasses = &subpass;
-	renderPassInfo.dependencyCount = 1;
-	renderPassInfo.pDependencies = &dependency;
+			VkBuffer vertexBuffers[] = { mMeshes.getVertexBuffer(), mSortedInstanceBuffers[frameIndex] };
+			VkDeviceSize offsets[] = { 0, 0 };
+			vkCmdBindVertexBuffers(commandBuffer, 0, 2, vertexBuffers, offsets);
+			vkCmdBindIndexBuffer(commandBuffer, mMeshes.getIndexBuffer(), 0, VK_INDEX_TYPE_UINT32);
 
-	if (vkCreateRenderPass(mDevice, &renderPassInfo, nullptr, &mRenderPass) != VK_SUCCESS)
-		throw std::runtime_error("Failed to create render pass!");
+			vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, mPipelineLayout, 0, 1, &mDescriptorSets[frameIndex], 0, nullptr);
+
+			if (ENABLE_CLUSTER_CULLING)
+				mClusterCuller.draw(commandBuffer, frameIndex);
+			else
+			{
+				const MeshRecord& model = mMeshes.get(mModel);
+				vkCmdDrawIndexed(commandBuffer, model.indexCount, INSTANCE_COUNT, model.firstIndex, model.vertexOffset, 0);
+			}
+		});
+
+		VkClearColorValue clearFeedback = {};
+		clearFeedback.uint32[0] = VirtualTexture::NO_PAGE;
+		mRenderGraph.addColorOutput(mFeedbackPass, mFeedback, &clearFeedback);
+		mRenderGraph.addDepthOutput(mFeedbackPass, feedbackDepth, &clearDepth);
+
+		mFeedbackReadbackPass = mRenderGraph.addPass("vt feedback readback", [this](VkCommandBuffer commandBuffer, uint32_t frameIndex)
+		{
+			mVirtualTexture.copyFeedback(commandBuffer, mRenderGraph.getImage(mFeedback, frameIndex), frameIndex);
+		});
+
+		mRenderGraph.addUsage(mFeedbackReadbackPass, mFeedback, ResourceUsage::TransferSrc);
+		mRenderGraph.setSideEffects(mFeedbackReadbackPass);
+	}
+
+	if (mSettings.postAA == PostAA::FXAA)
+	{
+		mPostProcessPass = mRenderGraph.addPass("fxaa", [this](VkCommandBuffer commandBuffer, uint32_t frameIndex)
+		{
+			vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, mPostProcessPipeline);
+			vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, mPostProcessPipelineLayout, 0, 1, &mPostProcessDescriptorSet, 0, nullptr);
+			vkCmdDraw(commandBuffer, 3, 1, 0, 0);
+		});
+
+		// Every pixel gets written, so no clear.
+		mRenderGraph.addUsage(mPostProcessPass, mSceneColor, ResourceUsage::SampledFragment);
+		mRenderGraph.addColorOutput(mPostProcessPass, backbuffer);
+	}
+
+	mRenderGraph.compile();
+
+	std::cout << "render graph: " << mRenderGraph.getTransientMemorySize() / 1024 << " KB of transient memory ("
+		<< mRenderGraph.getTransientMemorySizeWithoutAliasing() / 1024 << " KB without aliasing)" << std::endl;
 }
 
 void DemoApp::createDescriptorSetLayout()
@@ -560,7 +766,8 @@ void DemoApp::createDescriptorSetLayout()
 	uboLayoutBinding.descriptorCount = 1;
 
 	//The stageFlags field can be a combination of VkShaderStageFlagBits values or the value VK_SHADER_STAGE_ALL_GRAPHICS
-	uboLayoutBinding.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+	//The fragment shader reads the shadow parameters from it too.
+	uboLayoutBinding.stageFlags = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
 
 	uboLayoutBinding.pImmutableSamplers = nullptr;
 
@@ -571,7 +778,27 @@ void DemoApp::createDescriptorSetLayout()
 	samplerLayoutBinding.pImmutableSamplers = nullptr;
 	samplerLayoutBinding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
 
-	std::array<VkDescriptorSetLayoutBinding, 2> bindings = { uboLayoutBinding, samplerLayoutBinding };
+	VkDescriptorSetLayoutBinding shadowLayoutBinding = {};
+	shadowLayoutBinding.binding = 2;
+	shadowLayoutBinding.descriptorCount = 1;
+	shadowLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+	shadowLayoutBinding.pImmutableSamplers = nullptr;
+	shadowLayoutBinding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+
+	std::vector<VkDescriptorSetLayoutBinding> bindings = { uboLayoutBinding, samplerLayoutBinding, shadowLayoutBinding };
+
+	//The virtual texture's page cache and indirection table, see VirtualTexture.glsl. The feedback pass reads the table too.
+	if (mVirtualTexturing)
+	{
+		VkDescriptorSetLayoutBinding cacheLayoutBinding = samplerLayoutBinding;
+		cacheLayoutBinding.binding = 3;
+		bindings.push_back(cacheLayoutBinding);
+
+		VkDescriptorSetLayoutBinding indirectionLayoutBinding = samplerLayoutBinding;
+		indirectionLayoutBinding.binding = 4;
+		bindings.push_back(indirectionLayoutBinding);
+	}
+
 	VkDescriptorSetLayoutCreateInfo layoutInfo = {};
 	layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
 	layoutInfo.bindingCount = static_cast<uint32_t>(bindings.size());
@@ -584,7 +811,7 @@ void DemoApp::createDescriptorSetLayout()
 void DemoApp::createGraphicsPipeline()
 {
 	std::vector<char> vertShaderCode = readFile("shaders/vert.spv");
-	std::vector<char> fragShaderCode = readFile("shaders/frag.spv");
+	std::vector<char> fragShaderCode = readFile(mVirtualTexturing ? "shaders/frag_vt.spv" : "shaders/frag.spv");
 
 	VkShaderModule vertShaderModule = createShaderModule(vertShaderCode);
 	VkShaderModule fragShaderModule = createShaderModule(fragShaderCode);
@@ -723,9 +950,13 @@ void DemoApp::createGraphicsPipeline()
 	//Multisampling
 	VkPipelineMultisampleStateCreateInfo multisampling = {};
 	multisampling.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
-	multisampling.sampleShadingEnable = VK_TRUE; //enable sample shading in the pipeline
+	/*
+	Sample shading runs the fragment shader per sample instead of per pixel, which also smooths aliasing inside
+	the triangles (texture, specular). It multiplies the fragment cost by up to the sample count, so it's a setting.
+	*/
+	multisampling.sampleShadingEnable = (mSettings.sampleShading && mMSAASamples != VK_SAMPLE_COUNT_1_BIT) ? VK_TRUE : VK_FALSE;
 	multisampling.rasterizationSamples = mMSAASamples;
-	multisampling.minSampleShading = 1.0f; // min fraction for sample shading; closer to one is smoother
+	multisampling.minSampleShading = mSettings.minSampleShading; // min fraction for sample shading; closer to one is smoother
 	multisampling.pSampleMask = nullptr; // Optional
 	multisampling.alphaToCoverageEnable = VK_FALSE; // Optional
 	multisampling.alphaToOneEnable = VK_FALSE; // Optional
@@ -765,12 +996,13 @@ void DemoApp::createGraphicsPipeline()
 	This is useful for drawing transparent objects.
 	*/
 	depthStencil.depthTestEnable = VK_TRUE;
-	depthStencil.depthWriteEnable = VK_TRUE;
+	depthStencil.depthWriteEnable = ENABLE_DEPTH_PREPASS ? VK_FALSE : VK_TRUE; // The pre-pass already wrote the final depth.
 
 	/*
 	The depthCompareOp field specifies the comparison that is performed to keep or discard fragments
+	With the depth pre-pass only the closest surface has a depth EQUAL to the depth buffer.
 	*/
-	depthStencil.depthCompareOp = VK_COMPARE_OP_LESS;
+	depthStencil.depthCompareOp = ENABLE_DEPTH_PREPASS ? VK_COMPARE_OP_EQUAL : VK_COMPARE_OP_LESS;
 
 	/*
 	The depthBoundsTestEnable, minDepthBounds and maxDepthBounds fields are used for the optional depth bound test. 
@@ -825,7 +1057,7 @@ void DemoApp::createGraphicsPipeline()
 	pipelineInfo.layout = mPipelineLayout;
 
 	// get the reference to the render pass & index of sub pass.
-	pipelineInfo.renderPass = mRenderPass;
+	pipelineInfo.renderPass = mRenderGraph.getRenderPass(mScenePass);
 	pipelineInfo.subpass = 0;
 
 	/*
@@ -847,31 +1079,437 @@ void DemoApp::createGraphicsPipeline()
 	vkDestroyShaderModule(mDevice, vertShaderModule, nullptr);
 }
 
-void DemoApp::createFramebuffers()
+void DemoApp::createShadowPipeline()
 {
-	mSwapChainFramebuffers.resize(mSwapChainImageViews.size());
-	// It's straightforward.
-	for (size_t i = 0; i < mSwapChainImageViews.size(); ++i)
-	{
-		/*
-		The color attachment differs for every swap chain image, 
-		but the same depth image can be used by all of them because only a single subpass is running at the same time due to our semaphores.
-		*/
-		std::array<VkImageView, 3> attachments = { mColorImageView, mDepthImageView, mSwapChainImageViews[i] };
-		//VkImageView attachments[] = { mSwapChainImageViews[i] };
+	// Same descriptor set as the main pipeline (for the face matrices in the UBO), plus the face index.
+	VkPushConstantRange pushConstantRange = {};
+	pushConstantRange.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+	pushConstantRange.offset = 0;
+	pushConstantRange.size = sizeof(uint32_t);
 
-		VkFramebufferCreateInfo framebufferInfo = {};
-		framebufferInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
-		framebufferInfo.renderPass = mRenderPass;
-		framebufferInfo.attachmentCount = static_cast<uint32_t>(attachments.size());
-		framebufferInfo.pAttachments = attachments.data();
-		framebufferInfo.width = mSwapChainExtent.width;
-		framebufferInfo.height = mSwapChainExtent.height;
-		framebufferInfo.layers = 1;
+	VkPipelineLayoutCreateInfo pipelineLayoutInfo = {};
+	pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+	pipelineLayoutInfo.setLayoutCount = 1;
+	pipelineLayoutInfo.pSetLayouts = &mDescriptorSetLayout;
+	pipelineLayoutInfo.pushConstantRangeCount = 1;
+	pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
 
-		if (vkCreateFramebuffer(mDevice, &framebufferInfo, nullptr, &mSwapChainFramebuffers[i]) != VK_SUCCESS)
-			throw std::runtime_error("Failed to create framebuffer!");
-	}
+	if (vkCreatePipelineLayout(mDevice, &pipelineLayoutInfo, nullptr, &mShadowPipelineLayout) != VK_SUCCESS)
+		throw std::runtime_error("failed to create shadow pipeline layout!");
+
+	/*
+	The face projections don't flip Y like the main camera does, which flips the winding on screen.
+	So the same back faces are culled with a clockwise front face here.
+	Depth bias pushes the depth back a bit (more on slopes) so surfaces don't shadow themselves (shadow acne).
+	All six face passes have identical (compatible) render passes, any of them will do.
+	*/
+	mShadowPipeline = createDepthOnlyPipeline("shaders/shadow_vert.spv", { SHADOW_MAP_SIZE, SHADOW_MAP_SIZE }, VK_SAMPLE_COUNT_1_BIT,
+		VK_FRONT_FACE_CLOCKWISE, true, mShadowPipelineLayout, mRenderGraph.getRenderPass(mShadowPasses[0]));
+}
+
+void DemoApp::createDepthPrepassPipeline()
+{
+	// Has to match the main pipeline's rasterization exactly (samples, winding), only without a fragment shader.
+	// The pipeline layout is the main one, the descriptor set is the same.
+	mDepthPrepassPipeline = createDepthOnlyPipeline("shaders/depth_vert.spv", mSwapChainExtent, mMSAASamples,
+		VK_FRONT_FACE_COUNTER_CLOCKWISE, false, mPipelineLayout, mRenderGraph.getRenderPass(mDepthPrepass));
+}
+
+VkPipeline DemoApp::createDepthOnlyPipeline(const std::string& shaderFile, VkExtent2D extent, VkSampleCountFlagBits samples, VkFrontFace frontFace, bool depthBias,
+	VkPipelineLayout layout, VkRenderPass renderPass)
+{
+	/*
+	Stripped down copy of the graphics pipeline for passes that only write depth:
+	no fragment shader, only the position stream and the instance transform attributes,
+	no color attachments.
+	*/
+	std::vector<char> vertShaderCode = readFile(shaderFile);
+	VkShaderModule vertShaderModule = createShaderModule(vertShaderCode);
+
+	VkPipelineShaderStageCreateInfo vertShaderStageInfo = {};
+	vertShaderStageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+	vertShaderStageInfo.stage = VK_SHADER_STAGE_VERTEX_BIT;
+	vertShaderStageInfo.module = vertShaderModule;
+	vertShaderStageInfo.pName = "main";
+
+	std::array<VkVertexInputBindingDescription, 2> bindingDescriptions = Vertex::getPositionBindingDescription();
+	std::array<VkVertexInputAttributeDescription, 3> attributeDescriptions = Vertex::getPositionAttributeDescriptions();
+
+	VkPipelineVertexInputStateCreateInfo vertexInputInfo = {};
+	vertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+	vertexInputInfo.vertexBindingDescriptionCount = static_cast<uint32_t>(bindingDescriptions.size());
+	vertexInputInfo.pVertexBindingDescriptions = bindingDescriptions.data();
+	vertexInputInfo.vertexAttributeDescriptionCount = static_cast<uint32_t>(attributeDescriptions.size());
+	vertexInputInfo.pVertexAttributeDescriptions = attributeDescriptions.data();
+
+	VkPipelineInputAssemblyStateCreateInfo inputAssembly = {};
+	inputAssembly.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+	inputAssembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+	inputAssembly.primitiveRestartEnable = VK_FALSE;
+
+	VkViewport viewport = {};
+	viewport.x = 0.0f;
+	viewport.y = 0.0f;
+	viewport.width = (float)extent.width;
+	viewport.height = (float)extent.height;
+	viewport.minDepth = 0.0f;
+	viewport.maxDepth = 1.0f;
+
+	VkRect2D scissor = {};
+	scissor.offset = { 0, 0 };
+	scissor.extent = extent;
+
+	VkPipelineViewportStateCreateInfo viewportState = {};
+	viewportState.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+	viewportState.viewportCount = 1;
+	viewportState.pViewports = &viewport;
+	viewportState.scissorCount = 1;
+	viewportState.pScissors = &scissor;
+
+	VkPipelineRasterizationStateCreateInfo rasterizer = {};
+	rasterizer.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+	rasterizer.depthClampEnable = VK_FALSE;
+	rasterizer.rasterizerDiscardEnable = VK_FALSE;
+	rasterizer.polygonMode = VK_POLYGON_MODE_FILL;
+	rasterizer.lineWidth = 1.0f;
+	rasterizer.cullMode = VK_CULL_MODE_BACK_BIT;
+	rasterizer.frontFace = frontFace;
+	rasterizer.depthBiasEnable = depthBias ? VK_TRUE : VK_FALSE;
+	rasterizer.depthBiasConstantFactor = depthBias ? 1.25f : 0.0f;
+	rasterizer.depthBiasClamp = 0.0f;
+	rasterizer.depthBiasSlopeFactor = depthBias ? 1.75f : 0.0f;
+
+	// No fragment shader, so sample shading doesn't mean anything here.
+	VkPipelineMultisampleStateCreateInfo multisampling = {};
+	multisampling.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+	multisampling.sampleShadingEnable = VK_FALSE;
+	multisampling.rasterizationSamples = samples;
+
+	VkPipelineDepthStencilStateCreateInfo depthStencil = {};
+	depthStencil.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
+	depthStencil.depthTestEnable = VK_TRUE;
+	depthStencil.depthWriteEnable = VK_TRUE;
+	depthStencil.depthCompareOp = VK_COMPARE_OP_LESS;
+	depthStencil.depthBoundsTestEnable = VK_FALSE;
+	depthStencil.minDepthBounds = .0f;
+	depthStencil.maxDepthBounds = 1.f;
+	depthStencil.stencilTestEnable = VK_FALSE;
+
+	VkGraphicsPipelineCreateInfo pipelineInfo = {};
+	pipelineInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+	pipelineInfo.stageCount = 1;
+	pipelineInfo.pStages = &vertShaderStageInfo;
+	pipelineInfo.pVertexInputState = &vertexInputInfo;
+	pipelineInfo.pInputAssemblyState = &inputAssembly;
+	pipelineInfo.pViewportState = &viewportState;
+	pipelineInfo.pRasterizationState = &rasterizer;
+	pipelineInfo.pMultisampleState = &multisampling;
+	pipelineInfo.pDepthStencilState = &depthStencil;
+	pipelineInfo.pColorBlendState = nullptr; // No color attachments.
+	pipelineInfo.pDynamicState = nullptr;
+	pipelineInfo.layout = layout;
+	pipelineInfo.renderPass = renderPass;
+	pipelineInfo.subpass = 0;
+	pipelineInfo.basePipelineHandle = VK_NULL_HANDLE;
+	pipelineInfo.basePipelineIndex = -1;
+
+	VkPipeline pipeline;
+	if (vkCreateGraphicsPipelines(mDevice, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &pipeline) != VK_SUCCESS)
+		throw std::runtime_error("failed to create depth only pipeline from " + shaderFile + "!");
+
+	vkDestroyShaderModule(mDevice, vertShaderModule, nullptr);
+	return pipeline;
+}
+
+void DemoApp::createFeedbackPipeline()
+{
+	/*
+	Stripped down copy of the graphics pipeline for the virtual texture feedback pass: the same vertex shader and inputs
+	(the feedback needs the UVs), Feedback.frag into a single sample integer target, and its own depth test.
+	The pipeline layout is the main one, the descriptor set has the indirection table the level is picked with.
+	*/
+	std::vector<char> vertShaderCode = readFile("shaders/vert.spv");
+	std::vector<char> fragShaderCode = readFile("shaders/feedback_frag.spv");
+
+	VkShaderModule vertShaderModule = createShaderModule(vertShaderCode);
+	VkShaderModule fragShaderModule = createShaderModule(fragShaderCode);
+
+	VkPipelineShaderStageCreateInfo shaderStages[2] = {};
+	shaderStages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+	shaderStages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+	shaderStages[0].module = vertShaderModule;
+	shaderStages[0].pName = "main";
+	shaderStages[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+	shaderStages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+	shaderStages[1].module = fragShaderModule;
+	shaderStages[1].pName = "main";
+
+	std::array<VkVertexInputBindingDescription, 2> bindingDescriptions = Vertex::getBindingDescription();
+	std::array<VkVertexInputAttributeDescription, 8> attributeDescriptions = Vertex::getAttributeDescriptions();
+
+	VkPipelineVertexInputStateCreateInfo vertexInputInfo = {};
+	vertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+	vertexInputInfo.vertexBindingDescriptionCount = static_cast<uint32_t>(bindingDescriptions.size());
+	vertexInputInfo.pVertexBindingDescriptions = bindingDescriptions.data();
+	vertexInputInfo.vertexAttributeDescriptionCount = static_cast<uint32_t>(attributeDescriptions.size());
+	vertexInputInfo.pVertexAttributeDescriptions = attributeDescriptions.data();
+
+	VkPipelineInputAssemblyStateCreateInfo inputAssembly = {};
+	inputAssembly.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+	inputAssembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+	inputAssembly.primitiveRestartEnable = VK_FALSE;
+
+	VkExtent2D extent = mRenderGraph.getPassExtent(mFeedbackPass);
+
+	VkViewport viewport = {};
+	viewport.x = 0.0f;
+	viewport.y = 0.0f;
+	viewport.width = (float)extent.width;
+	viewport.height = (float)extent.height;
+	viewport.minDepth = 0.0f;
+	viewport.maxDepth = 1.0f;
+
+	VkRect2D scissor = {};
+	scissor.offset = { 0, 0 };
+	scissor.extent = extent;
+
+	VkPipelineViewportStateCreateInfo viewportState = {};
+	viewportState.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+	viewportState.viewportCount = 1;
+	viewportState.pViewports = &viewport;
+	viewportState.scissorCount = 1;
+	viewportState.pScissors = &scissor;
+
+	VkPipelineRasterizationStateCreateInfo rasterizer = {};
+	rasterizer.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+	rasterizer.depthClampEnable = VK_FALSE;
+	rasterizer.rasterizerDiscardEnable = VK_FALSE;
+	rasterizer.polygonMode = VK_POLYGON_MODE_FILL;
+	rasterizer.lineWidth = 1.0f;
+	rasterizer.cullMode = VK_CULL_MODE_BACK_BIT;
+	rasterizer.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+	rasterizer.depthBiasEnable = VK_FALSE;
+
+	VkPipelineMultisampleStateCreateInfo multisampling = {};
+	multisampling.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+	multisampling.sampleShadingEnable = VK_FALSE;
+	multisampling.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+
+	// Integer targets can't blend.
+	VkPipelineColorBlendAttachmentState colorBlendAttachment = {};
+	colorBlendAttachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT;
+	colorBlendAttachment.blendEnable = VK_FALSE;
+
+	VkPipelineColorBlendStateCreateInfo colorBlending = {};
+	colorBlending.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+	colorBlending.logicOpEnable = VK_FALSE;
+	colorBlending.attachmentCount = 1;
+	colorBlending.pAttachments = &colorBlendAttachment;
+
+	VkPipelineDepthStencilStateCreateInfo depthStencil = {};
+	depthStencil.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
+	depthStencil.depthTestEnable = VK_TRUE;
+	depthStencil.depthWriteEnable = VK_TRUE;
+	depthStencil.depthCompareOp = VK_COMPARE_OP_LESS;
+	depthStencil.depthBoundsTestEnable = VK_FALSE;
+	depthStencil.minDepthBounds = .0f;
+	depthStencil.maxDepthBounds = 1.f;
+	depthStencil.stencilTestEnable = VK_FALSE;
+
+	VkGraphicsPipelineCreateInfo pipelineInfo = {};
+	pipelineInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+	pipelineInfo.stageCount = 2;
+	pipelineInfo.pStages = shaderStages;
+	pipelineInfo.pVertexInputState = &vertexInputInfo;
+	pipelineInfo.pInputAssemblyState = &inputAssembly;
+	pipelineInfo.pViewportState = &viewportState;
+	pipelineInfo.pRasterizationState = &rasterizer;
+	pipelineInfo.pMultisampleState = &multisampling;
+	pipelineInfo.pDepthStencilState = &depthStencil;
+	pipelineInfo.pColorBlendState = &colorBlending;
+	pipelineInfo.pDynamicState = nullptr;
+	pipelineInfo.layout = mPipelineLayout;
+	pipelineInfo.renderPass = mRenderGraph.getRenderPass(mFeedbackPass);
+	pipelineInfo.subpass = 0;
+	pipelineInfo.basePipelineHandle = VK_NULL_HANDLE;
+	pipelineInfo.basePipelineIndex = -1;
+
+	if (vkCreateGraphicsPipelines(mDevice, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &mFeedbackPipeline) != VK_SUCCESS)
+		throw std::runtime_error("failed to create feedback pipeline!");
+
+	vkDestroyShaderModule(mDevice, fragShaderModule, nullptr);
+	vkDestroyShaderModule(mDevice, vertShaderModule, nullptr);
+}
+
+void DemoApp::createPostProcessPipeline()
+{
+	/*
+	FXAA pass: a fullscreen triangle that samples the resolved scene color.
+	Everything here depends on the render graph (render pass, scene color view), so it's all recreated with the swap chain.
+	*/
+	VkSamplerCreateInfo samplerInfo = {};
+	samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+	samplerInfo.magFilter = VK_FILTER_LINEAR; // FXAA relies on bilinear filtering to blend across the edge.
+	samplerInfo.minFilter = VK_FILTER_LINEAR;
+	samplerInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+	samplerInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+	samplerInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+	samplerInfo.anisotropyEnable = VK_FALSE;
+	samplerInfo.maxAnisotropy = 1;
+	samplerInfo.borderColor = VK_BORDER_COLOR_INT_OPAQUE_BLACK;
+	samplerInfo.unnormalizedCoordinates = VK_FALSE;
+	samplerInfo.compareEnable = VK_FALSE;
+	samplerInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+
+	if (vkCreateSampler(mDevice, &samplerInfo, nullptr, &mPostProcessSampler) != VK_SUCCESS)
+		throw std::runtime_error("Failed to create post process sampler!");
+
+	VkDescriptorSetLayoutBinding colorBinding = {};
+	colorBinding.binding = 0;
+	colorBinding.descriptorCount = 1;
+	colorBinding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+	colorBinding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+
+	VkDescriptorSetLayoutCreateInfo layoutInfo = {};
+	layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+	layoutInfo.bindingCount = 1;
+	layoutInfo.pBindings = &colorBinding;
+
+	if (vkCreateDescriptorSetLayout(mDevice, &layoutInfo, nullptr, &mPostProcessSetLayout) != VK_SUCCESS)
+		throw std::runtime_error("failed to create post process descriptor set layout!");
+
+	// The scene color is a transient image of the graph, the same one every frame, so one set is enough.
+	VkDescriptorPoolSize poolSize = {};
+	poolSize.type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+	poolSize.descriptorCount = 1;
+
+	VkDescriptorPoolCreateInfo poolInfo = {};
+	poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+	poolInfo.poolSizeCount = 1;
+	poolInfo.pPoolSizes = &poolSize;
+	poolInfo.maxSets = 1;
+
+	if (vkCreateDescriptorPool(mDevice, &poolInfo, nullptr, &mPostProcessDescriptorPool) != VK_SUCCESS)
+		throw std::runtime_error("failed to create post process descriptor pool!");
+
+	VkDescriptorSetAllocateInfo allocInfo = {};
+	allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+	allocInfo.descriptorPool = mPostProcessDescriptorPool;
+	allocInfo.descriptorSetCount = 1;
+	allocInfo.pSetLayouts = &mPostProcessSetLayout;
+
+	if (vkAllocateDescriptorSets(mDevice, &allocInfo, &mPostProcessDescriptorSet) != VK_SUCCESS)
+		throw std::runtime_error("failed to allocate post process descriptor set!");
+
+	VkDescriptorImageInfo imageInfo = {};
+	imageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+	imageInfo.imageView = mRenderGraph.getImageView(mSceneColor);
+	imageInfo.sampler = mPostProcessSampler;
+
+	VkWriteDescriptorSet descriptorWrite = {};
+	descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+	descriptorWrite.dstSet = mPostProcessDescriptorSet;
+	descriptorWrite.dstBinding = 0;
+	descriptorWrite.dstArrayElement = 0;
+	descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+	descriptorWrite.descriptorCount = 1;
+	descriptorWrite.pImageInfo = &imageInfo;
+
+	vkUpdateDescriptorSets(mDevice, 1, &descriptorWrite, 0, nullptr);
+
+	VkPipelineLayoutCreateInfo pipelineLayoutInfo = {};
+	pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+	pipelineLayoutInfo.setLayoutCount = 1;
+	pipelineLayoutInfo.pSetLayouts = &mPostProcessSetLayout;
+
+	if (vkCreatePipelineLayout(mDevice, &pipelineLayoutInfo, nullptr, &mPostProcessPipelineLayout) != VK_SUCCESS)
+		throw std::runtime_error("failed to create post process pipeline layout!");
+
+	std::vector<char> vertShaderCode = readFile("shaders/fullscreen_vert.spv");
+	std::vector<char> fragShaderCode = readFile("shaders/fxaa_frag.spv");
+	VkShaderModule vertShaderModule = createShaderModule(vertShaderCode);
+	VkShaderModule fragShaderModule = createShaderModule(fragShaderCode);
+
+	std::array<VkPipelineShaderStageCreateInfo, 2> shaderStages = {};
+	shaderStages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+	shaderStages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+	shaderStages[0].module = vertShaderModule;
+	shaderStages[0].pName = "main";
+	shaderStages[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+	shaderStages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+	shaderStages[1].module = fragShaderModule;
+	shaderStages[1].pName = "main";
+
+	// The fullscreen triangle is generated from gl_VertexIndex, no vertex buffers.
+	VkPipelineVertexInputStateCreateInfo vertexInputInfo = {};
+	vertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+
+	VkPipelineInputAssemblyStateCreateInfo inputAssembly = {};
+	inputAssembly.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+	inputAssembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+	inputAssembly.primitiveRestartEnable = VK_FALSE;
+
+	VkViewport viewport = {};
+	viewport.x = 0.0f;
+	viewport.y = 0.0f;
+	viewport.width = (float)mSwapChainExtent.width;
+	viewport.height = (float)mSwapChainExtent.height;
+	viewport.minDepth = 0.0f;
+	viewport.maxDepth = 1.0f;
+
+	VkRect2D scissor = {};
+	scissor.offset = { 0, 0 };
+	scissor.extent = mSwapChainExtent;
+
+	VkPipelineViewportStateCreateInfo viewportState = {};
+	viewportState.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+	viewportState.viewportCount = 1;
+	viewportState.pViewports = &viewport;
+	viewportState.scissorCount = 1;
+	viewportState.pScissors = &scissor;
+
+	VkPipelineRasterizationStateCreateInfo rasterizer = {};
+	rasterizer.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+	rasterizer.polygonMode = VK_POLYGON_MODE_FILL;
+	rasterizer.lineWidth = 1.0f;
+	rasterizer.cullMode = VK_CULL_MODE_NONE;
+	rasterizer.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+
+	VkPipelineMultisampleStateCreateInfo multisampling = {};
+	multisampling.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+	multisampling.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+
+	VkPipelineColorBlendAttachmentState colorBlendAttachment = {};
+	colorBlendAttachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+	colorBlendAttachment.blendEnable = VK_FALSE;
+
+	VkPipelineColorBlendStateCreateInfo colorBlending = {};
+	colorBlending.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+	colorBlending.attachmentCount = 1;
+	colorBlending.pAttachments = &colorBlendAttachment;
+
+	VkGraphicsPipelineCreateInfo pipelineInfo = {};
+	pipelineInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+	pipelineInfo.stageCount = static_cast<uint32_t>(shaderStages.size());
+	pipelineInfo.pStages = shaderStages.data();
+	pipelineInfo.pVertexInputState = &vertexInputInfo;
+	pipelineInfo.pInputAssemblyState = &inputAssembly;
+	pipelineInfo.pViewportState = &viewportState;
+	pipelineInfo.pRasterizationState = &rasterizer;
+	pipelineInfo.pMultisampleState = &multisampling;
+	pipelineInfo.pDepthStencilState = nullptr; // No depth attachment.
+	pipelineInfo.pColorBlendState = &colorBlending;
+	pipelineInfo.layout = mPostProcessPipelineLayout;
+	pipelineInfo.renderPass = mRenderGraph.getRenderPass(mPostProcessPass);
+	pipelineInfo.subpass = 0;
+	pipelineInfo.basePipelineHandle = VK_NULL_HANDLE;
+	pipelineInfo.basePipelineIndex = -1;
+
+	if (vkCreateGraphicsPipelines(mDevice, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &mPostProcessPipeline) != VK_SUCCESS)
+		throw std::runtime_error("failed to create post process pipeline!");
+
+	vkDestroyShaderModule(mDevice, fragShaderModule, nullptr);
+	vkDestroyShaderModule(mDevice, vertShaderModule, nullptr);
 }
 
 void DemoApp::createCommandPool()
@@ -896,29 +1534,6 @@ void DemoApp::createCommandPool()
 		throw std::runtime_error("failed to create command pool!");
 }
 
-void DemoApp::createColorResources()
-{
-	//We will now create a multisampled color buffer.
-	VkFormat colorFormat = mSwapChainImageFormat;
-
-	createImage(mSwapChainExtent.width, mSwapChainExtent.height, mMSAASamples, colorFormat, VK_IMAGE_TILING_OPTIMAL, 
-		VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT | VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, mColorImage, mColorImageMemory);
-	mColorImageView = createImageView(mColorImage, colorFormat, VK_IMAGE_ASPECT_COLOR_BIT);
-
-	transitionImageLayout(mColorImage, colorFormat, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
-}
-
-void DemoApp::createDepthResources()
-{
-	VkFormat depthFormat = findDepthFormat();
-
-	createImage(mSwapChainExtent.width, mSwapChainExtent.height, mMSAASamples, depthFormat, VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT,
-		VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, mDepthImage, depthImageMemory);
-	mDepthImageView = createImageView(mDepthImage, depthFormat, VK_IMAGE_ASPECT_DEPTH_BIT);
-
-	transitionImageLayout(mDepthImage, depthFormat, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL);
-}
-
 VkFormat DemoApp::findSupportedFormat(const std::vector<VkFormat>& candidates, VkImageTiling tiling, VkFormatFeatureFlags features)
 {
 	for (VkFormat format : candidates)
@@ -945,49 +1560,29 @@ VkFormat DemoApp::findDepthFormat()
 
 void DemoApp::createTextureImage()
 {
-	// We use stb to make image loading easy.
-	int texWidth, texHeight, texChannels;
-
 	/*
-	The stbi_load function takes the file path and number of channels to load as arguments. 
-	The STBI_rgb_alpha value forces the image to be loaded with an alpha channel, even if it doesn't have one.
-
-	The pixels are laid out row by row with 4 bytes per pixel in the case of STBI_rgba_alpha for a total of texWidth * texHeight * 4 values
+	The material library decodes with stb on its worker threads. TEXTURE_PATH was queued before the model started loading,
+	and the model's texture maps as soon as its .mtl file was parsed, so by now they are usually done.
+	The model's diffuse map wins if it has one that decodes.
 	*/
-	stbi_uc* pixels = stbi_load(TEXTURE_PATH.c_str(), &texWidth, &texHeight, &texChannels, STBI_rgb_alpha);
-	VkDeviceSize imageSize = texWidth * texHeight * 4;
+	mMaterials.resolve();
+	uint32_t textureId = mTextureRequest;
+	uint32_t material = mMaterials.findMaterial(mModelMaterialName);
+	if (material != StringTable::INVALID)
+	{
+		uint32_t diffuse = mMaterials.getMaterials()[material].textures[static_cast<size_t>(TextureMap::Diffuse)];
+		if (diffuse != StringTable::INVALID && mMaterials.waitForTexture(diffuse).pixels)
+			textureId = diffuse;
+	}
 
-	if (!pixels)
+	/*
+	The residency manager uploads it from the staging buffer the library decoded it into (see TextureResidency::allocateStaging),
+	blits the mips, and from then on keeps as much of it in device local memory as the texture budget allows.
+	*/
+	mTexture = mTextures.add(textureId);
+	if (!mTextures.makeResident(mTexture))
 		throw std::runtime_error("Failed to load texture image!");
-
-	// We're now going to create a buffer in host visible memory so that we can use vkMapMemory and copy the pixels to it.
-	VkBuffer stagingBuffer;
-	VkDeviceMemory stagingBufferMemory;
-
-	// The buffer should be in host visible memory so that we can map it and it should be usable as a transfer source so that we can copy it to an image later on
-	createBuffer(imageSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, stagingBuffer, stagingBufferMemory);
-
-	// We can then directly copy the pixel values that we got from the image loading library to the buffer
-	void* data;
-	vkMapMemory(mDevice, stagingBufferMemory, 0, imageSize, 0, &data);
-	memcpy(data, pixels, static_cast<size_t>(imageSize));
-	vkUnmapMemory(mDevice, stagingBufferMemory);
-
-	stbi_image_free(pixels);
-
-	//VkCmdBlit is considered a transfer operation, so we must inform Vulkan that we intend to use 
-	//the texture image as both the source and destination of a transfer.
-	//Add VK_IMAGE_USAGE_TRANSFER_SRC_BIT to the texture image's usage flags in createTextureImage:
-	createImage(texWidth, texHeight, VK_SAMPLE_COUNT_1_BIT, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_TILING_OPTIMAL, 
-		VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, 
-		mTextureImage, mTextureImageMemory);
-
-	transitionImageLayout(mTextureImage, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
-	copyBufferToImage(stagingBuffer, mTextureImage, static_cast<uint32_t>(texWidth), static_cast<uint32_t>(texHeight));
-	transitionImageLayout(mTextureImage, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
-
-	vkDestroyBuffer(mDevice, stagingBuffer, nullptr);
-	vkFreeMemory(mDevice, stagingBufferMemory, nullptr);
+	mTextureGeneration = mTextures.getGeneration();
 }
 
 VkSampleCountFlagBits DemoApp::getMaxUsableSampleCount()
@@ -1008,6 +1603,32 @@ VkSampleCountFlagBits DemoApp::getMaxUsableSampleCount()
 	return VK_SAMPLE_COUNT_1_BIT;
 }
 
+void DemoApp::applyRenderSettings()
+{
+	// Highest supported count that doesn't go over the requested one. Counts are single bits, so the masks compare like numbers.
+	VkSampleCountFlagBits maxSamples = getMaxUsableSampleCount();
+	mMSAASamples = VK_SAMPLE_COUNT_1_BIT;
+
+	for (VkSampleCountFlagBits samples : { VK_SAMPLE_COUNT_2_BIT, VK_SAMPLE_COUNT_4_BIT, VK_SAMPLE_COUNT_8_BIT,
+		VK_SAMPLE_COUNT_16_BIT, VK_SAMPLE_COUNT_32_BIT, VK_SAMPLE_COUNT_64_BIT })
+	{
+		if (samples <= mSettings.msaaSamples && samples <= maxSamples)
+			mMSAASamples = samples;
+	}
+}
+
+std::string DemoApp::describeRenderSettings() const
+{
+	std::string description = std::to_string(mMSAASamples) + "x MSAA";
+
+	if (mSettings.sampleShading && mMSAASamples != VK_SAMPLE_COUNT_1_BIT)
+		description += ", sample shading " + std::to_string(mSettings.minSampleShading).substr(0, 4);
+	if (mSettings.postAA == PostAA::FXAA)
+		description += ", FXAA";
+
+	return description;
+}
+
 // Used to abstract image creation
 void DemoApp::createImage(uint32_t width, uint32_t height, VkSampleCountFlagBits numSamples, VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkMemoryPropertyFlags properties, VkImage& image, VkDeviceMemory& imageMemory)
 {
@@ -1077,11 +1698,6 @@ void DemoApp::createImage(uint32_t width, uint32_t height, VkSampleCountFlagBits
 	vkBindImageMemory(mDevice, image, imageMemory, 0);
 }
 
-void DemoApp::createTextureImageView()
-{
-	mTextureImageView = createImageView(mTextureImage, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_ASPECT_COLOR_BIT);
-}
-
 VkImageView DemoApp::createImageView(VkImage image, VkFormat format, VkImageAspectFlags aspectFlags)
 {
 	// Remember, images are accessed through image views.
@@ -1139,12 +1755,40 @@ void DemoApp::createTextureSampler()
 	samplerInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
 	samplerInfo.mipLodBias = 0;
 	samplerInfo.minLod = 0;
-	samplerInfo.maxLod = 0;
+	samplerInfo.maxLod = VK_LOD_CLAMP_NONE; // However many mips the texture has left, see TextureResidency.
 
 	if (vkCreateSampler(mDevice, &samplerInfo, nullptr, &mTextureSampler))
 		throw std::runtime_error("Failed to create sampler!");
 }
 
+void DemoApp::createShadowSampler()
+{
+	/*
+	With compareEnable the sampler compares the reference depth we pass in against the stored depth
+	and filters the results, so every lookup with a linear filter is already a 2x2 PCF.
+	*/
+	VkSamplerCreateInfo samplerInfo = {};
+	samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+	samplerInfo.magFilter = VK_FILTER_LINEAR;
+	samplerInfo.minFilter = VK_FILTER_LINEAR;
+	samplerInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+	samplerInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+	samplerInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+	samplerInfo.anisotropyEnable = VK_FALSE;
+	samplerInfo.maxAnisotropy = 1;
+	samplerInfo.borderColor = VK_BORDER_COLOR_FLOAT_OPAQUE_WHITE;
+	samplerInfo.unnormalizedCoordinates = VK_FALSE;
+	samplerInfo.compareEnable = VK_TRUE;
+	samplerInfo.compareOp = VK_COMPARE_OP_LESS_OR_EQUAL; // lit if our depth <= the closest depth the light sees
+	samplerInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+	samplerInfo.mipLodBias = 0;
+	samplerInfo.minLod = 0;
+	samplerInfo.maxLod = 0;
+
+	if (vkCreateSampler(mDevice, &samplerInfo, nullptr, &mShadowSampler))
+		throw std::runtime_error("Failed to create shadow sampler!");
+}
+
 VkCommandBuffer DemoApp::beginSingleTimeCommands()
 {
 	VkCommandBufferAllocateInfo allocInfo = {};
@@ -1212,10 +1856,8 @@ void DemoApp::transitionImageLayout(VkImage image, VkFormat format, VkImageLayou
 	barrier.subresourceRange.levelCount = 1;
 	barrier.subresourceRange.baseArrayLayer = 0;
 	barrier.subresourceRange.layerCount = 1;
-	barrier.srcAccessMask = 0;
-	barrier.dstAccessMask = 0;
 
-	if (newLayout == VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL)
+	if (isDepthFormat(format))
 	{
 		barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
 
@@ -1226,54 +1868,23 @@ void DemoApp::transitionImageLayout(VkImage image, VkFormat format, VkImageLayou
 		barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
 
 	/*
-	There are two transitions we need to handle:
-
-	Undefined -> transfer destination: transfer writes that don't need to wait on anything
-	Transfer destination -> shader reading: shader reads should wait on transfer writes, 
-	specifically the shader reads in the fragment shader, because that's where we're going to use the texture
+	The barrier has to wait for whatever wrote the image in its old layout, and block whatever is going to use it in the new one.
+	E.g. Undefined -> transfer destination: transfer writes that don't need to wait on anything
+	Transfer destination -> shader reading: shader reads in the fragment shader should wait on transfer writes.
+	getLayoutAccess (RenderGraph.h) knows the stage/access that goes with each layout, the same table the render graph uses.
 
 	For more info on this:
 	https://vulkan-tutorial.com/Texture_mapping/Images
 	https://www.khronos.org/registry/vulkan/specs/1.1-extensions/man/html/VkPipelineStageFlagBits.html
 	*/
-	VkPipelineStageFlags sourceStage;
-	VkPipelineStageFlags destinationStage;
+	ImageAccess src = getLayoutAccess(oldLayout);
+	ImageAccess dst = getLayoutAccess(newLayout);
 
-	if (oldLayout == VK_IMAGE_LAYOUT_UNDEFINED && newLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL) 
-	{
-		barrier.srcAccessMask = 0;
-		barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+	barrier.srcAccessMask = src.access;
+	barrier.dstAccessMask = dst.access;
 
-		sourceStage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
-		destinationStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
-	}
-	else if (oldLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL && newLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL) 
-	{
-		barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-		barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
-
-		sourceStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
-		destinationStage = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
-	}
-	else if (oldLayout == VK_IMAGE_LAYOUT_UNDEFINED && newLayout == VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL)
-	{
-		barrier.srcAccessMask = 0;
-		barrier.dstAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
-
-		sourceStage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
-		destinationStage = VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT;
-	}
-	else if (oldLayout == VK_IMAGE_LAYOUT_UNDEFINED && newLayout == VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL)
-	{
-		barrier.srcAccessMask = 0;
-		barrier.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
-		sourceStage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
-		destinationStage = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-	}
-	else 
-	{
-		throw std::invalid_argument("unsupported layout transition!");
-	}
+	VkPipelineStageFlags sourceStage = src.stages;
+	VkPipelineStageFlags destinationStage = dst.stages;
 
 	/*
 	All types of pipeline barriers are submitted using the same function. 
@@ -1336,7 +1947,7 @@ void DemoApp::copyBufferToImage(VkBuffer buffer, VkImage image, uint32_t width,
 	endSingleTimeCommands(commandBuffer);
 }
 
-void DemoApp::loadModel()
+MeshRegistry::MeshHandle DemoApp::loadModel(const std::string& path)
 {
 	/*
 	Standard way to load models.
@@ -1351,10 +1962,19 @@ void DemoApp::loadModel()
 	std::string warn, err;
 
 	std::unordered_map<Vertex, uint32_t> uniqueVertices = {};
+	std::vector<Vertex> vertices;
+	std::vector<uint32_t> indices;
+	float radius = 0.f;
 
-	if (!tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err, MODEL_PATH.c_str()))
+	std::string baseDir = MaterialLibrary::getDirectory(path);
+	if (!tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err, path.c_str(), baseDir.c_str()))
 		throw std::runtime_error(warn + err);
 
+	// Starts decoding the texture maps right away, createTextureImage picks the diffuse map of the first material.
+	mMaterials.addMaterials(materials, baseDir);
+	if (!shapes.empty() && !shapes[0].mesh.material_ids.empty() && shapes[0].mesh.material_ids[0] >= 0)
+		mModelMaterialName = mMaterials.internMaterialName(materials[shapes[0].mesh.material_ids[0]].name);
+
 	for (const auto& shape : shapes)
 	{
 		for (const auto& index : shape.mesh.indices)
@@ -1389,83 +2009,46 @@ void DemoApp::loadModel()
 
 			if (uniqueVertices.count(vertex) == 0)
 			{
-				uniqueVertices[vertex] = static_cast<uint32_t>(mVertices.size());
-				mVertices.push_back(vertex);
+				uniqueVertices[vertex] = static_cast<uint32_t>(vertices.size());
+				vertices.push_back(vertex);
+
+				// Instances rotate the model around its origin, so this sphere bounds every instance.
+				radius = std::max(radius, glm::length(vertex.pos));
 			}
-			mIndices.push_back(uniqueVertices[vertex]);
+			indices.push_back(uniqueVertices[vertex]);
 		}
 	}
-}
-
-void DemoApp::createVertexBuffer()
-{
-	VkDeviceSize bufferSize = sizeof(mVertices[0]) * mVertices.size();
 
-	VkBuffer stagingBuffer;
-	VkDeviceMemory stagingBufferMemory;
-
-	/*
-	Create the "source" buffer
-	VK_BUFFER_USAGE_TRANSFER_SRC_BIT: Buffer can be used as source in a memory transfer operation.
-
-	VK_BUFFER_USAGE_TRANSFER_DST_BIT: Buffer can be used as destination in a memory transfer operation.
-	*/
-	createBuffer(bufferSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, 
-		VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, stagingBuffer, stagingBufferMemory);
-
-	/*
-	This function allows us to access a region of the specified memory resource defined by an offset and size. 
-	The offset and size here are 0 and bufferInfo.size, respectively. 
-	It is also possible to specify the special value VK_WHOLE_SIZE to map all of the memory. 
-	The second to last parameter can be used to specify flags, but there aren't any available yet in the current API.
-	It must be set to the value 0. 
-	The last parameter specifies the output for the pointer to the mapped memory.
-	*/
-	void* data;
-	vkMapMemory(mDevice, stagingBufferMemory, 0, bufferSize, 0, &data);
-	memcpy(data, mVertices.data(), (size_t)bufferSize);
-	vkUnmapMemory(mDevice, stagingBufferMemory);
-
-	//Create the "destination" buffer
-	createBuffer(bufferSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, 
-		VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, mVertexBuffer, mVertexBufferMemory);
-
-	copyBuffer(stagingBuffer, mVertexBuffer, bufferSize);
-
-	vkDestroyBuffer(mDevice, stagingBuffer, nullptr);
-	vkFreeMemory(mDevice, stagingBufferMemory, nullptr);
+	// Goes through a staging buffer into the shared vertex, position and index arenas.
+	return mMeshes.add(vertices, indices, radius);
 }
 
-void DemoApp::createIndexBuffer()
+MeshRegistry::MeshHandle DemoApp::streamModel(const std::string& path)
 {
 	/*
-	There are only two notable differences from a very similarly looking createVertexBuffer().
-	The bufferSize is now equal to the number of indices times the size of the index type, 
-	either uint16_t or uint32_t. 
-	The usage of the indexBuffer should be VK_BUFFER_USAGE_INDEX_BUFFER_BIT instead of VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, 
-	which makes sense. 
-	Other than that, the process is exactly the same. 
-	We create a staging buffer to copy the contents of indices to and then copy it to the final device local index buffer.
+	Same model as loadModel, but the faces are welded while the file is parsed and go straight into mapped staging memory.
+	The mesh never exists as a whole in host memory, the GPU copies one part while the next one is parsed.
+	Vertices are welded by their v/vt/vn indices rather than by value.
 	*/
-	VkDeviceSize bufferSize = sizeof(mIndices[0]) * mIndices.size();
-
-	VkBuffer stagingBuffer;
-	VkDeviceMemory stagingBufferMemory;
-	createBuffer(bufferSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, 
-		VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, stagingBuffer, stagingBufferMemory);
+	MeshStreamer streamer;
+	streamer.init(mDevice, mPhysDevice, mGraphicsQueue, findQueueFamilies(mPhysDevice).graphicsFamily.value());
 
-	void* data;
-	vkMapMemory(mDevice, stagingBufferMemory, 0, bufferSize, 0, &data);
-	memcpy(data, mIndices.data(), (size_t)bufferSize);
-	vkUnmapMemory(mDevice, stagingBufferMemory);
-
-	createBuffer(bufferSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT, 
-		VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, mIndexBuffer, mIndexBufferMemory);
+	StreamedMesh mesh;
+	try
+	{
+		mesh = streamer.load(path, &mMaterials);
+	}
+	catch (...)
+	{
+		streamer.destroy();
+		throw;
+	}
+	streamer.destroy();
 
-	copyBuffer(stagingBuffer, mIndexBuffer, bufferSize);
+	mModelMaterialName = mesh.materialRanges.empty() ? StringTable::INVALID : mesh.materialRanges[0].materialName;
 
-	vkDestroyBuffer(mDevice, stagingBuffer, nullptr);
-	vkFreeMemory(mDevice, stagingBufferMemory, nullptr);
+	// Copied over into the arenas on the GPU, the streamer's buffers are freed.
+	return mMeshes.add(mesh);
 }
 
 void DemoApp::createUniformBuffers()
@@ -1482,6 +2065,71 @@ void DemoApp::createUniformBuffers()
 	}
 }
 
+void DemoApp::createShadowBuffers()
+{
+	/*
+	Written by the CPU every frame (cullShadowCasters), so host visible like the uniform buffers.
+	Each face gets INSTANCE_COUNT slots in the instance buffer, that's the worst case of every instance touching every face.
+	*/
+	VkDeviceSize instanceBufferSize = 6 * INSTANCE_COUNT * sizeof(InstanceData);
+	VkDeviceSize drawBufferSize = 6 * sizeof(VkDrawIndexedIndirectCommand);
+
+	mShadowInstanceBuffers.resize(mSwapChainImages.size());
+	mShadowInstanceBuffersMemory.resize(mSwapChainImages.size());
+	mShadowDrawBuffers.resize(mSwapChainImages.size());
+	mShadowDrawBuffersMemory.resize(mSwapChainImages.size());
+
+	for (size_t i = 0; i < mSwapChainImages.size(); ++i)
+	{
+		createBuffer(instanceBufferSize, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+			VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, mShadowInstanceBuffers[i], mShadowInstanceBuffersMemory[i]);
+		createBuffer(drawBufferSize, VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT,
+			VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, mShadowDrawBuffers[i], mShadowDrawBuffersMemory[i]);
+	}
+}
+
+void DemoApp::createSortedInstanceBuffers()
+{
+	// The instance order changes every frame (sortInstances), so like the uniform buffers there's one host visible buffer per swap chain image.
+	// The cluster culling shader reads them as storage buffers.
+	VkDeviceSize bufferSize = INSTANCE_COUNT * sizeof(InstanceData);
+
+	mSortedInstanceBuffers.resize(mSwapChainImages.size());
+	mSortedInstanceBuffersMemory.resize(mSwapChainImages.size());
+
+	for (size_t i = 0; i < mSwapChainImages.size(); ++i)
+	{
+		createBuffer(bufferSize, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+			VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, mSortedInstanceBuffers[i], mSortedInstanceBuffersMemory[i]);
+	}
+}
+
+void DemoApp::createQueryPool()
+{
+	/*
+	One pipeline statistics query per swap chain image (the command buffers are per image too),
+	counting fragment shader invocations of the scene pass. That's the number to watch for overdraw:
+	with the depth pre-pass and front to back sorting it should get close to the number of covered samples.
+	*/
+	mQueryPool = VK_NULL_HANDLE;
+	if (!mPipelineStatisticsSupported)
+		return;
+
+	VkQueryPoolCreateInfo queryPoolInfo = {};
+	queryPoolInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+	queryPoolInfo.queryType = VK_QUERY_TYPE_PIPELINE_STATISTICS;
+	queryPoolInfo.queryCount = static_cast<uint32_t>(mSwapChainImages.size());
+	queryPoolInfo.pipelineStatistics = VK_QUERY_PIPELINE_STATISTIC_FRAGMENT_SHADER_INVOCATIONS_BIT;
+
+	if (vkCreateQueryPool(mDevice, &queryPoolInfo, nullptr, &mQueryPool) != VK_SUCCESS)
+		throw std::runtime_error("failed to create query pool!");
+
+	// Queries have to be reset before anything (including vkGetQueryPoolResults) touches them.
+	VkCommandBuffer commandBuffer = beginSingleTimeCommands();
+	vkCmdResetQueryPool(commandBuffer, mQueryPool, 0, queryPoolInfo.queryCount);
+	endSingleTimeCommands(commandBuffer);
+}
+
 void DemoApp::createDescriptorPool()
 {
 	//We first need to describe which descriptor types our descriptor sets are going to 
@@ -1495,7 +2143,7 @@ void DemoApp::createDescriptorPool()
 	poolSizes[0].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
 	poolSizes[0].descriptorCount = static_cast<uint32_t>(mSwapChainImages.size());
 	poolSizes[1].type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-	poolSizes[1].descriptorCount = static_cast<uint32_t>(mSwapChainImages.size());
+	poolSizes[1].descriptorCount = static_cast<uint32_t>(mSwapChainImages.size()) * (mVirtualTexturing ? 4 : 2); // texture + shadow map (+ page cache + indirection table)
 
 	//We will allocate one of these descriptors for every frame. 
 	//This pool size structure is referenced by the main VkDescriptorPoolCreateInfo:
@@ -1541,9 +2189,15 @@ void DemoApp::createDescriptorSets()
 
 		VkDescriptorImageInfo imageInfo = {};
 		imageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-		imageInfo.imageView = mTextureImageView;
+		imageInfo.imageView = mTextures.getView(mTexture);
 		imageInfo.sampler = mTextureSampler;
 
+		//The shadow map belongs to the render graph, which puts it in SHADER_READ_ONLY_OPTIMAL before the scene pass.
+		VkDescriptorImageInfo shadowInfo = {};
+		shadowInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+		shadowInfo.imageView = mRenderGraph.getImageView(mShadowMap);
+		shadowInfo.sampler = mShadowSampler;
+
 		//The configuration of descriptors is updated using the vkUpdateDescriptorSets function, 
 		//which takes an array of VkWriteDescriptorSet structs as parameter.
 		//Remember that descriptors can be arrays, so we also need to specify
@@ -1566,7 +2220,17 @@ void DemoApp::createDescriptorSets()
 		descriptorWrite.pTexelBufferView = nullptr;
 		*/
 
-		std::array<VkWriteDescriptorSet, 2> descriptorWrites = {};
+		VkDescriptorImageInfo cacheInfo = {};
+		cacheInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+		cacheInfo.imageView = mVirtualTexture.getCacheView();
+		cacheInfo.sampler = mVirtualTexture.getCacheSampler();
+
+		VkDescriptorImageInfo indirectionInfo = {};
+		indirectionInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+		indirectionInfo.imageView = mVirtualTexture.getIndirectionView();
+		indirectionInfo.sampler = mVirtualTexture.getIndirectionSampler();
+
+		std::array<VkWriteDescriptorSet, 5> descriptorWrites = {};
 
 		descriptorWrites[0].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
 		descriptorWrites[0].dstSet = mDescriptorSets[i];
@@ -1584,20 +2248,43 @@ void DemoApp::createDescriptorSets()
 		descriptorWrites[1].descriptorCount = 1;
 		descriptorWrites[1].pImageInfo = &imageInfo;
 
+		descriptorWrites[2].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+		descriptorWrites[2].dstSet = mDescriptorSets[i];
+		descriptorWrites[2].dstBinding = 2;
+		descriptorWrites[2].dstArrayElement = 0;
+		descriptorWrites[2].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+		descriptorWrites[2].descriptorCount = 1;
+		descriptorWrites[2].pImageInfo = &shadowInfo;
+
+		//The virtual texture replaces its cache and table contents in place, so these never have to be written again.
+		descriptorWrites[3] = descriptorWrites[1];
+		descriptorWrites[3].dstBinding = 3;
+		descriptorWrites[3].pImageInfo = &cacheInfo;
+
+		descriptorWrites[4] = descriptorWrites[1];
+		descriptorWrites[4].dstBinding = 4;
+		descriptorWrites[4].pImageInfo = &indirectionInfo;
+
 		/*
 		The updates are applied using vkUpdateDescriptorSets. 
 		It accepts two kinds of arrays as parameters: 
 		an array of VkWriteDescriptorSet and an array of VkCopyDescriptorSet. 
 		The latter can be used to copy descriptors to each other, as its name implies.
 		*/
-		vkUpdateDescriptorSets(mDevice, static_cast<uint32_t>(descriptorWrites.size()), descriptorWrites.data(), 0, nullptr);
+		uint32_t writeCount = mVirtualTexturing ? 5 : 3;
+		vkUpdateDescriptorSets(mDevice, writeCount, descriptorWrites.data(), 0, nullptr);
 	}
 }
 
 void DemoApp::prepareInstanceData()
 {
-	std::vector<InstanceData> instanceData;
+	/*
+	Kept on the CPU. Every frame the instances get sorted front to back (sortInstances) and culled per shadow map face (cullShadowCasters),
+	and the results are written into per swap chain image buffers.
+	*/
+	std::vector<InstanceData>& instanceData = mInstanceData;
 	instanceData.resize(INSTANCE_COUNT);
+	mShadowCasters.resize(INSTANCE_COUNT);
 
 	std::default_random_engine rndGenerator((unsigned)time(nullptr));
 	std::uniform_real_distribution<float> uniformDist(0.0, 1.0);
@@ -1614,78 +2301,150 @@ void DemoApp::prepareInstanceData()
 		//Inner ring
 		rho = sqrt(((ring0[1] * ring0[1]) - (ring0[0] * ring0[0])) * uniformDist(rndGenerator) + (ring0[0] * ring0[0]));
 		theta = 2.0f * 3.14f * uniformDist(rndGenerator);
-		instanceData[i].pos = glm::vec3(rho * cos(theta), uniformDist(rndGenerator) * 2.0f, rho * sin(theta));
-		instanceData[i].rot = glm::vec3(3.14f * uniformDist(rndGenerator), 3.14f * uniformDist(rndGenerator), 3.14f * uniformDist(rndGenerator));
-		instanceData[i].scale = 1.5f + uniformDist(rndGenerator) - uniformDist(rndGenerator);
+		instanceData[i].pos = glm::vec3(rho * cos(theta), 0.0f, rho * sin(theta));
 		instanceData[i].texIndex = rndTextureIndex(rndGenerator);
-		instanceData[i].scale *= 0.6f;
 
 		//Outer ring
 		rho = sqrt(((ring1[1] * ring1[1]) - (ring1[0] * ring1[0])) * uniformDist(rndGenerator) + (ring1[0] * ring1[0]));
 		theta = 2.0f * 3.14f * uniformDist(rndGenerator);
-		instanceData[i + INSTANCE_COUNT / 2].pos = glm::vec3(rho * cos(theta), uniformDist(rndGenerator) * 0.5f - 0.25f, rho * sin(theta));
-		instanceData[i + INSTANCE_COUNT / 2].rot = glm::vec3(3.14f * uniformDist(rndGenerator), 3.14f * uniformDist(rndGenerator), 3.14f * uniformDist(rndGenerator));
-		instanceData[i + INSTANCE_COUNT / 2].scale = 1.5f + uniformDist(rndGenerator) - uniformDist(rndGenerator);
+		instanceData[i + INSTANCE_COUNT / 2].pos = glm::vec3(rho * cos(theta), 0.0f, rho * sin(theta));
 		instanceData[i + INSTANCE_COUNT / 2].texIndex = rndTextureIndex(rndGenerator);
-		instanceData[i + INSTANCE_COUNT / 2].scale *= 0.6f;
 	}
 
-	mInstanceBuffer.size = instanceData.size() * sizeof(InstanceData);
+	/*
+	Height, size and rotation come from fractal noise over the ring plane instead of independent draws, so neighbouring
+	rocks look alike and the rings get clumps of big and small ones. Each of the 5 values samples its own slice of 3D noise,
+	and the random seed moves the slices around so every run still looks different.
+	*/
+	const uint32_t channels = 5;
+	const float seed = 100.0f * uniformDist(rndGenerator);
+	std::vector<glm::vec3> samples(channels * INSTANCE_COUNT);
+	for (uint32_t c = 0; c < channels; ++c)
+		for (uint32_t i = 0; i < INSTANCE_COUNT; ++i)
+			samples[c * INSTANCE_COUNT + i] = glm::vec3(instanceData[i].pos.x * 0.15f, instanceData[i].pos.z * 0.15f, seed + 7.0f * c);
 
-	//Staging
-	//Instanced data is static, copy to device local memory
-	//This results in better performance
+	std::vector<float> noise(samples.size());
+	glm::fbmBatch(samples.data(), noise.data(), samples.size(), glm::NOISE_SIMPLEX, 4);
 
-	struct
+	for (uint32_t i = 0; i < INSTANCE_COUNT; ++i)
 	{
-		VkDeviceMemory memory;
-		VkBuffer buffer;
-	} stagingBuffer;
-	
-	createBuffer2(
-		mInstanceBuffer.size,
-		VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-		VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-		stagingBuffer.buffer,
-		stagingBuffer.memory,
-		instanceData.data());
-
-	createBuffer(
-		mInstanceBuffer.size,
-		VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
-		VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
-		mInstanceBuffer.buffer,
-		mInstanceBuffer.memory);
-
-	VkCommandBuffer copyCmd = createCommandBuffer(VK_COMMAND_BUFFER_LEVEL_PRIMARY, true);
+		// fBm stays roughly in [-1, 1], mapped onto the ranges the uniform draws used to cover.
+		const float* n = &noise[i];
+		const float height = glm::clamp(n[0] * 0.5f + 0.5f, 0.0f, 1.0f);
+		instanceData[i].pos.y = i < INSTANCE_COUNT / 2 ? height * 2.0f : height * 0.5f - 0.25f;
+		instanceData[i].rot = 3.14f * glm::clamp(glm::vec3(n[INSTANCE_COUNT], n[2 * INSTANCE_COUNT], n[3 * INSTANCE_COUNT]) * 0.5f + 0.5f, 0.0f, 1.0f);
+		instanceData[i].scale = (1.5f + glm::clamp(n[4 * INSTANCE_COUNT], -1.0f, 1.0f)) * 0.6f;
+	}
 
-	VkBufferCopy copyRegion = {};
-	copyRegion.size = mInstanceBuffer.size;
-	vkCmdCopyBuffer(
-		copyCmd,
-		stagingBuffer.buffer,
-		mInstanceBuffer.buffer,
-		1,
-		&copyRegion);
+	updateInstanceBounds();
+}
 
-	vkEndCommandBuffer(copyCmd);
+void DemoApp::updateInstanceBounds()
+{
+	/*
+	The instances don't move, so their bounding spheres are only packed again when the model changes. Rotation doesn't change a sphere around the origin.
+	The shaders don't apply InstanceData::scale, so neither do the bounds (scaling them made small instances pop out too early).
+	*/
+	const float radius = mMeshes.get(mModel).radius;
 
-	VkSubmitInfo submitInfo = {};
-	submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-	submitInfo.commandBufferCount = 1;
-	submitInfo.pCommandBuffers = &copyCmd;
+	mInstanceCenters.resize(INSTANCE_COUNT);
+	mInstanceRadii.resize(INSTANCE_COUNT);
+	for (uint32_t i = 0; i < INSTANCE_COUNT; ++i)
+	{
+		mInstanceCenters.set(i, mInstanceData[i].pos);
+		mInstanceRadii.set(i, glm::vec1(radius));
+	}
+}
 
-	vkQueueSubmit(mGraphicsQueue, 1, &submitInfo, VK_NULL_HANDLE);
-	vkQueueWaitIdle(mGraphicsQueue);
+void DemoApp::cullShadowCasters(uint32_t currentImage, const glm::mat4 faceViewProj[6])
+{
+	/*
+	Each cube face is a 90 degree frustum. Its six planes come straight out of the face's view-projection matrix,
+	and the bounding spheres of all the instances get tested against them 8 at a time (4 without AVX2),
+	which gives back the indices of the instances that may cast a shadow into that face.
+	*/
+	void* instanceData;
+	vkMapMemory(mDevice, mShadowInstanceBuffersMemory[currentImage], 0, 6 * INSTANCE_COUNT * sizeof(InstanceData), 0, &instanceData);
+	InstanceData* faceInstances = static_cast<InstanceData*>(instanceData);
+
+	std::array<VkDrawIndexedIndirectCommand, 6> draws = {};
+
+	for (int face = 0; face < 6; ++face)
+	{
+		glm::vec4 planes[6];
+		glm::frustumPlanes(faceViewProj[face], planes);
+
+		uint32_t count = static_cast<uint32_t>(glm::intersectSphereFrustumBatch(planes, mInstanceCenters, mInstanceRadii, mShadowCasters.data()));
+		for (uint32_t i = 0; i < count; ++i)
+			faceInstances[face * INSTANCE_COUNT + i] = mInstanceData[mShadowCasters[i]];
+
+		// firstInstance stays 0, non zero would need the drawIndirectFirstInstance feature. The offset is in the vertex buffer binding instead.
+		draws[face] = mMeshes.getDrawCommand(mModel, count);
+	}
+
+	vkUnmapMemory(mDevice, mShadowInstanceBuffersMemory[currentImage]);
+
+	void* drawData;
+	vkMapMemory(mDevice, mShadowDrawBuffersMemory[currentImage], 0, sizeof(draws), 0, &drawData);
+	memcpy(drawData, draws.data(), sizeof(draws));
+	vkUnmapMemory(mDevice, mShadowDrawBuffersMemory[currentImage]);
+}
+
+void DemoApp::sortInstances(uint32_t currentImage, const glm::mat4& modelView)
+{
+	/*
+	Draw the closest instances first, so the depth test (early-Z) rejects as many hidden fragments as possible.
+	The key is the view space depth of the instance center, quantized to 16 bits over the camera's depth range,
+	which is plenty to order teapots and lets a two pass radix sort do the job.
+	*/
+	std::vector<uint16_t>& keys = mSortKeys;
+	keys.resize(mInstanceData.size());
+
+	for (size_t i = 0; i < mInstanceData.size(); ++i)
+	{
+		float depth = -(modelView * glm::vec4(mInstanceData[i].pos, 1.f)).z;
+		float normalized = glm::clamp((depth - CAMERA_NEAR) / (CAMERA_FAR - CAMERA_NEAR), 0.f, 1.f);
+		keys[i] = static_cast<uint16_t>(normalized * 65535.f);
+	}
+
+	radixSort16(keys, mSortOrder, mSortScratch);
+
+	void* data;
+	vkMapMemory(mDevice, mSortedInstanceBuffersMemory[currentImage], 0, INSTANCE_COUNT * sizeof(InstanceData), 0, &data);
+	InstanceData* sorted = static_cast<InstanceData*>(data);
+
+	for (size_t i = 0; i < mSortOrder.size(); ++i)
+		sorted[i] = mInstanceData[mSortOrder[i]];
+
+	vkUnmapMemory(mDevice, mSortedInstanceBuffersMemory[currentImage]);
+}
+
+void DemoApp::readPipelineStatistics(uint32_t imageIndex)
+{
+	if (mQueryPool == VK_NULL_HANDLE)
+		return;
+
+	/*
+	Results of the last frame that used this image. No WAIT flag: if the GPU isn't done with it (or the query was just reset)
+	this returns VK_NOT_READY and we just skip the sample instead of stalling.
+	*/
+	uint64_t fragmentInvocations = 0;
+	VkResult result = vkGetQueryPoolResults(mDevice, mQueryPool, imageIndex, 1, sizeof(fragmentInvocations), &fragmentInvocations,
+		sizeof(fragmentInvocations), VK_QUERY_RESULT_64_BIT);
 
-	vkFreeCommandBuffers(mDevice, mCommandPool, 1, &copyCmd);
+	if (result != VK_SUCCESS)
+		return;
 
-	mInstanceBuffer.descriptor.range = mInstanceBuffer.size;
-	mInstanceBuffer.descriptor.buffer = mInstanceBuffer.buffer;
-	mInstanceBuffer.descriptor.offset = 0;
+	mFragmentInvocations += fragmentInvocations;
+	if (++mStatisticsFrames == 256)
+	{
+		uint64_t pixels = static_cast<uint64_t>(mSwapChainExtent.width) * mSwapChainExtent.height;
+		std::cout << "fragment shader invocations per frame: " << mFragmentInvocations / mStatisticsFrames
+			<< " (" << static_cast<float>(mFragmentInvocations / mStatisticsFrames) / pixels << " per pixel)" << std::endl;
 
-	vkDestroyBuffer(mDevice, stagingBuffer.buffer, nullptr);
-	vkFreeMemory(mDevice, stagingBuffer.memory, nullptr);
+		mFragmentInvocations = 0;
+		mStatisticsFrames = 0;
+	}
 }
 
 void DemoApp::updateUniformBuffer(uint32_t currentImage)
@@ -1703,16 +2462,10 @@ void DemoApp::updateUniformBuffer(uint32_t currentImage)
 	ubo.model = glm::rotate(glm::mat4(1.0f), time / 2 *  glm::radians(90.f), glm::vec3(1.0f, 1.0f, 0.0f));
 
 	//The glm::lookAt function takes the eye position, center position and up axis as parameters.
-	ubo.view = glm::lookAt(glm::vec3(2.0f, 10.0f, 42.0f), glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(1.0f, 1.0f, 0.0f));
-
-	//The other parameters are the aspect ratio, near and far view planes.
-	//It is important to use the current swap chain extent to calculate the 
-	//aspect ratio to take into account the new width and height of the window after a resize.
-	ubo.proj = glm::perspective(glm::radians(45.0f), mSwapChainExtent.width / (float)mSwapChainExtent.height, 0.1f, 100.0f);
+	ubo.view = CAMERA_VIEW;
 
-	//The easiest way to compensate for that is to flip the sign on the scaling factor of the Y axis
-	//in the projection matrix. If you don't do this, then the image will be rendered upside down.
-	ubo.proj[1][1] *= -1;
+	//The projection uses the current swap chain extent for the aspect ratio, see createSwapChain.
+	ubo.proj = mCameraProj;
 
 	// This is me doing lighting now. Help. - Jimmy
 	ubo.uLightPos = glm::vec4(sin(time), 1.5f, -sin(time), 1.f);
@@ -1720,6 +2473,38 @@ void DemoApp::updateUniformBuffer(uint32_t currentImage)
 
 	ubo.uLightCol = glm::vec4(1.f, .93f, .89f, 1.f);
 
+	/*
+	One 90 degree view per cube face, in the order of the cube map layers (+X, -X, +Y, -Y, +Z, -Z).
+	The up vectors are the usual GL cube map ones. No Y flip here: Vulkan's top-down framebuffer
+	already matches the way cube map faces are laid out.
+	*/
+	glm::vec3 lightPos = glm::vec3(ubo.uLightPos);
+
+	const glm::vec3 faceDirs[6] = { { 1, 0, 0 }, { -1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 }, { 0, 0, 1 }, { 0, 0, -1 } };
+	const glm::vec3 faceUps[6] = { { 0, -1, 0 }, { 0, -1, 0 }, { 0, 0, 1 }, { 0, 0, -1 }, { 0, -1, 0 }, { 0, -1, 0 } };
+
+	for (int face = 0; face < 6; ++face)
+		ubo.uShadowViewProj[face] = SHADOW_PROJ * glm::lookAt(lightPos, lightPos + faceDirs[face], faceUps[face]);
+
+	// PCF radius is ~1.5 texels at a distance of 1, the shader scales it with distance.
+	ubo.uShadowParams = glm::vec4(SHADOW_NEAR, SHADOW_FAR, 3.0f / SHADOW_MAP_SIZE, 0.0005f);
+
+	cullShadowCasters(currentImage, ubo.uShadowViewProj);
+	sortInstances(currentImage, ubo.view * ubo.model);
+
+	if (ENABLE_CLUSTER_CULLING)
+	{
+		// The meshlets are culled in the space the instances are placed in, before the model matrix.
+		glm::vec4 planes[6];
+		glm::frustumPlanes(ubo.proj * ubo.view * ubo.model, planes);
+		glm::vec4 cameraPos = glm::inverse(ubo.view * ubo.model)[3];
+
+		ClusterCullParams params;
+		memcpy(params.planes, planes, sizeof(params.planes));
+		memcpy(params.cameraPos, &cameraPos, sizeof(params.cameraPos));
+		mClusterCuller.update(currentImage, params);
+	}
+
 	//All of the transformations are defined now, so we can copy the data in the uniform buffer object to the current uniform buffer. 
 	//This happens in exactly the same way as we did for vertex buffers, except without a staging buffer:
 	void* data;
@@ -1964,7 +2749,7 @@ VkCommandBuffer DemoApp::createCommandBuffer(VkCommandBufferLevel level, bool be
 
 void DemoApp::createCommandBuffers()
 {
-	mCommandBuffers.resize(mSwapChainFramebuffers.size());
+	mCommandBuffers.resize(mSwapChainImages.size());
 	
 	VkCommandBufferAllocateInfo allocInfo = {};
 	allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
@@ -2009,74 +2794,13 @@ void DemoApp::createCommandBuffers()
 		if (vkBeginCommandBuffer(mCommandBuffers[i], &beginInfo) != VK_SUCCESS)
 			throw std::runtime_error("failed to begin recording command buffer!");
 	
-		VkRenderPassBeginInfo renderPassInfo = {};
-		renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-		renderPassInfo.renderPass = mRenderPass;
-		renderPassInfo.framebuffer = mSwapChainFramebuffers[i];
-
-		/*
-		The first parameters are the render pass itself and the attachments to bind. 
-		We created a framebuffer for each swap chain image that specifies it as color attachment
-		*/
-		renderPassInfo.renderArea.offset = { 0, 0 };
-		renderPassInfo.renderArea.extent = mSwapChainExtent;
-
-		/*
-		The next two parameters define the size of the render area. 
-		The render area defines where shader loads and stores will take place. 
-		The pixels outside this region will have undefined values.
-		It should match the size of the attachments for best performance.
-		*/
-		std::array<VkClearValue, 2> clearValues = {};
-		clearValues[0].color = { .0f, .0f, .0f, 1.0f };
-		clearValues[1].depthStencil = { 1.0f, 0 };
-		//VkClearValue clearColor = { 0.0f, 0.0f, 0.0f, 1.0f };
-		renderPassInfo.clearValueCount = static_cast<uint32_t>(clearValues.size());
-		renderPassInfo.pClearValues = clearValues.data();
-
-		/*
-		VK_SUBPASS_CONTENTS_INLINE: The render pass commands will be embedded in the 
-		primary command buffer itself and no secondary command buffers will be executed.
+		// Queries can only be reset outside of a render pass.
+		if (mQueryPool != VK_NULL_HANDLE)
+			vkCmdResetQueryPool(mCommandBuffers[i], mQueryPool, static_cast<uint32_t>(i), 1);
 
-		VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS: The render pass commands will be 
-		executed from secondary command buffers.
-		*/
-		vkCmdBeginRenderPass(mCommandBuffers[i], &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
-
-		//The second parameter specifies if the pipeline object is a graphics or compute pipeline.
-		vkCmdBindPipeline(mCommandBuffers[i], VK_PIPELINE_BIND_POINT_GRAPHICS, mGraphicsPipeline);
-
-		/*
-		The first two parameters, besides the command buffer, 
-		specify the offset and number of bindings we're going to specify vertex buffers for. 
-		The last two parameters specify the array of vertex buffers to bind and the byte offsets to start reading vertex data from.
-		*/
-		VkBuffer vertexBuffers[] = { mVertexBuffer, mInstanceBuffer.buffer };
-		VkDeviceSize offsets[] = { 0 };
-		vkCmdBindVertexBuffers(mCommandBuffers[i], 0, 1, &vertexBuffers[0], offsets);
-		vkCmdBindVertexBuffers(mCommandBuffers[i], 1, 1, &vertexBuffers[1], offsets);
-
-		//An index buffer is bound with vkCmdBindIndexBuffer which has the index buffer, 
-		//a byte offset into it, and the type of index data as parameters
-		vkCmdBindIndexBuffer(mCommandBuffers[i], mIndexBuffer, 0, VK_INDEX_TYPE_UINT32);
-
-		//We now need to update the createCommandBuffers function to actually bind the right descriptor set 
-		//for each swap chain image to the descriptors in the shader with cmdBindDescriptorSets.
-		vkCmdBindDescriptorSets(mCommandBuffers[i], VK_PIPELINE_BIND_POINT_GRAPHICS, mPipelineLayout, 0, 1, &mDescriptorSets[i], 0, nullptr);
-
-		/*
-		A call to this function is very similar to vkCmdDraw. 
-		The first two parameters specify the number of indices and the number of instances.
-		We're not using instancing, so just specify 1 instance. 
-		The number of indices represents the number of vertices that will be passed to the vertex buffer.
-		The next parameter specifies an offset into the index buffer, 
-		using a value of 1 would cause the graphics card to start reading at the second index. 
-		The second to last parameter specifies an offset to add to the indices in the index buffer. 
-		The final parameter specifies an offset for instancing, which we're not using.
-		*/
-		vkCmdDrawIndexed(mCommandBuffers[i], static_cast<uint32_t>(mIndices.size()), INSTANCE_COUNT, 0, 0, 0);
+		// Barriers, the render pass and the draw commands all come from the render graph.
+		mRenderGraph.execute(mCommandBuffers[i], static_cast<uint32_t>(i));
 
-		vkCmdEndRenderPass(mCommandBuffers[i]);
 		if (vkEndCommandBuffer(mCommandBuffers[i]) != VK_SUCCESS)
 			throw std::runtime_error("failed to record command buffer!");
 	}
@@ -2084,10 +2808,20 @@ void DemoApp::createCommandBuffers()
 
 void DemoApp::createSyncObjects()
 {
+	//One set per frame in flight, the count is a frame pacing setting.
+	uint32_t framesInFlight = mFramePacer.getSettings().framesInFlight;
+
 	//Semaphores are used for process synchronization in the multi processing environment
-	mImageAvailableSemaphores.resize(MAX_FRAMES_IN_FLIGHT);
-	mRenderFinishedSemaphores.resize(MAX_FRAMES_IN_FLIGHT);
-	inFlightFences.resize(MAX_FRAMES_IN_FLIGHT);
+	mImageAvailableSemaphores.resize(framesInFlight);
+	mRenderFinishedSemaphores.resize(framesInFlight);
+	inFlightFences.resize(framesInFlight);
+
+	/*
+	The per image resources (uniform buffers, instance buffers) are written right after acquiring the image.
+	With more frames in flight than swap chain images, or when the driver hands out images out of order, the last
+	frame that used the image can still be running. So we remember which fence was used for every image.
+	*/
+	mImagesInFlight.assign(mSwapChainImages.size(), VK_NULL_HANDLE);
 
 	VkSemaphoreCreateInfo semaphoreInfo = {};
 	semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
@@ -2096,13 +2830,165 @@ void DemoApp::createSyncObjects()
 	fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
 	fenceInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT; // Tell it that we've rendered an initial frame already.
 
-	for(size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; ++i)
+	for(size_t i = 0; i < framesInFlight; ++i)
 		if (vkCreateSemaphore(mDevice, &semaphoreInfo, nullptr, &mImageAvailableSemaphores[i]) != VK_SUCCESS ||
 			vkCreateSemaphore(mDevice, &semaphoreInfo, nullptr, &mRenderFinishedSemaphores[i]) != VK_SUCCESS ||
 			vkCreateFence(mDevice, &fenceInfo, nullptr, &inFlightFences[i]) != VK_SUCCESS)
 			throw std::runtime_error("failed to create semaphores!");
 }
 
+void DemoApp::destroySyncObjects()
+{
+	for (size_t i = 0; i < inFlightFences.size(); ++i)
+	{
+		vkDestroySemaphore(mDevice, mRenderFinishedSemaphores[i], nullptr);
+		vkDestroySemaphore(mDevice, mImageAvailableSemaphores[i], nullptr);
+		vkDestroyFence(mDevice, inFlightFences[i], nullptr);
+	}
+
+	mRenderFinishedSemaphores.clear();
+	mImageAvailableSemaphores.clear();
+	inFlightFences.clear();
+}
+
+void DemoApp::setFramePacing(const FramePacingSettings& settings)
+{
+	// Before run() there's nothing to rebuild yet. Afterwards the change is applied at the start of the next frame.
+	if (mDevice == VK_NULL_HANDLE)
+		mFramePacer.setSettings(settings);
+	else
+	{
+		mPendingFramePacing = settings;
+		mFramePacingChanged = true;
+	}
+}
+
+void DemoApp::applyFramePacingChanges()
+{
+	if (!mFramePacingChanged)
+		return;
+
+	mFramePacingChanged = false;
+
+	bool presentPolicyChanged = mPendingFramePacing.presentPolicy != mFramePacer.getSettings().presentPolicy;
+
+	//The sync objects may be in use, and the present mode is baked into the swap chain.
+	vkDeviceWaitIdle(mDevice);
+
+	destroySyncObjects();
+	mFramePacer.setSettings(mPendingFramePacing);
+	createSyncObjects();
+	mCurrentFrame = 0;
+
+	if (presentPolicyChanged)
+		recreateSwapChain();
+
+	const FramePacingSettings& settings = mFramePacer.getSettings();
+	std::cout << "frame pacing: " << FramePacer::getPresentPolicyName(settings.presentPolicy) << ", " << settings.framesInFlight << " frames in flight, "
+		<< (settings.targetFrameTime > 0.0 ? std::to_string(static_cast<int>(std::round(1.0 / settings.targetFrameTime))) + " fps cap" : "no fps cap") << std::endl;
+}
+
+void DemoApp::applyModelChange()
+{
+	if (!mModelChangeRequested)
+		return;
+
+	mModelChangeRequested = false;
+
+	//The arenas can only change once no frame is drawing from them anymore.
+	vkDeviceWaitIdle(mDevice);
+
+	/*
+	The new model is added before the old one goes, so it lands in free space behind it (or the arenas get repacked),
+	and the old model leaves a hole in the free lists that a later model can reuse.
+	*/
+	mModelPathIndex = (mModelPathIndex + 1) % MODEL_PATHS.size();
+	MeshRegistry::MeshHandle model = STREAM_MODEL ? streamModel(MODEL_PATHS[mModelPathIndex]) : loadModel(MODEL_PATHS[mModelPathIndex]);
+	mMeshes.remove(mModel);
+	mModel = model;
+	updateInstanceBounds();
+
+	if (ENABLE_CLUSTER_CULLING)
+	{
+		mMeshes.buildMeshlets(mModel);
+		mClusterCuller.destroyFrameResources();
+		mClusterCuller.createFrameResources(mMeshes, mModel, mSortedInstanceBuffers, INSTANCE_COUNT);
+	}
+
+	//The draws (and the arena buffers, if they were replaced) are baked into the command buffers.
+	vkFreeCommandBuffers(mDevice, mCommandPool, static_cast<uint32_t>(mCommandBuffers.size()), mCommandBuffers.data());
+	createCommandBuffers();
+
+	const MeshRecord& record = mMeshes.get(mModel);
+	std::cout << "model: " << MODEL_PATHS[mModelPathIndex] << ", " << record.vertexCount << " vertices at " << record.vertexOffset
+		<< ", " << record.indexCount << " indices at " << record.firstIndex << ", " << record.meshlets.size() << " meshlets" << std::endl;
+}
+
+void DemoApp::applyTextureResidency()
+{
+	mTextures.beginFrame(mFrameNumber++);
+	mTextures.markUsed(mTexture); // Every instance is drawn with it.
+
+	if (!mTextures.needsUpdate())
+		return;
+
+	//Textures can only be replaced once no frame is sampling them anymore.
+	vkDeviceWaitIdle(mDevice);
+	mTextures.update();
+
+	if (mTextures.getGeneration() == mTextureGeneration)
+		return;
+
+	//The views are in the descriptor sets, and writing those invalidates the command buffers that bind them.
+	writeTextureDescriptors();
+	vkFreeCommandBuffers(mDevice, mCommandPool, static_cast<uint32_t>(mCommandBuffers.size()), mCommandBuffers.data());
+	createCommandBuffers();
+	mTextureGeneration = mTextures.getGeneration();
+
+	const TextureResidencyStats& stats = mTextures.getStats();
+	std::cout << "textures: " << stats.residentBytes / 1.0e6 << " of " << stats.budget / 1.0e6 << " MB, " << stats.hits << " hits, " << stats.misses << " misses, "
+		<< stats.mipEvictions << " mip evictions, " << stats.textureEvictions << " texture evictions, " << stats.streamIns << " uploads" << std::endl;
+}
+
+void DemoApp::writeTextureDescriptors()
+{
+	VkDescriptorImageInfo imageInfo = {};
+	imageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+	imageInfo.imageView = mTextures.getView(mTexture);
+	imageInfo.sampler = mTextureSampler;
+
+	std::vector<VkWriteDescriptorSet> descriptorWrites(mDescriptorSets.size());
+	for (size_t i = 0; i < mDescriptorSets.size(); ++i)
+	{
+		descriptorWrites[i].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+		descriptorWrites[i].dstSet = mDescriptorSets[i];
+		descriptorWrites[i].dstBinding = 1;
+		descriptorWrites[i].dstArrayElement = 0;
+		descriptorWrites[i].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+		descriptorWrites[i].descriptorCount = 1;
+		descriptorWrites[i].pImageInfo = &imageInfo;
+	}
+
+	vkUpdateDescriptorSets(mDevice, static_cast<uint32_t>(descriptorWrites.size()), descriptorWrites.data(), 0, nullptr);
+}
+
+VkCommandBuffer DemoApp::updateVirtualTexture(uint32_t imageIndex)
+{
+	//The last frame that drew with this image is done, so its feedback is in the image's readback buffer.
+	mVirtualTexture.processFeedback(imageIndex);
+	VkCommandBuffer pageUploads = mVirtualTexture.recordUploads(imageIndex);
+
+	//Once the pages the view needs are all in.
+	if (pageUploads != VK_NULL_HANDLE && !mVirtualTexture.isLoading())
+	{
+		const VirtualTextureStats& stats = mVirtualTexture.getStats();
+		std::cout << "virtual texture: " << stats.residentPages << " of " << VirtualTexture::CACHE_PAGES * VirtualTexture::CACHE_PAGES << " pages resident, "
+			<< stats.loads << " loads, " << stats.evictions << " evictions, " << stats.misses << " misses in " << stats.requests << " page requests" << std::endl;
+	}
+
+	return pageUploads;
+}
+
 void DemoApp::recreateSwapChain()
 {
 	//Special case: window minimization. Pause the output until the window is in the foreground.
@@ -2121,16 +3007,29 @@ void DemoApp::recreateSwapChain()
 
 	createSwapChain();
 	createImageViews();
-	createRenderPass();
+	createRenderGraph();
 	createGraphicsPipeline();
-	createColorResources();
-	createColorResources();
-	createDepthResources();
-	createFramebuffers();
+	createShadowPipeline();
+	if (ENABLE_DEPTH_PREPASS)
+		createDepthPrepassPipeline();
+	if (mSettings.postAA == PostAA::FXAA)
+		createPostProcessPipeline();
+	if (mVirtualTexturing)
+		createFeedbackPipeline();
 	createUniformBuffers();
+	createShadowBuffers();
+	createSortedInstanceBuffers();
+	if (ENABLE_CLUSTER_CULLING)
+		mClusterCuller.createFrameResources(mMeshes, mModel, mSortedInstanceBuffers, INSTANCE_COUNT);
+	if (mVirtualTexturing)
+		mVirtualTexture.createFrameResources(static_cast<uint32_t>(mSwapChainImages.size()), VirtualTexture::getFeedbackExtent(mSwapChainExtent));
+	createQueryPool();
 	createDescriptorPool();
 	createDescriptorSets();
 	createCommandBuffers();
+
+	//The number of swap chain images may have changed.
+	mImagesInFlight.assign(mSwapChainImages.size(), VK_NULL_HANDLE);
 }
 
 void DemoApp::framebufferResizeCallback(GLFWwindow* window, int width, int height)
@@ -2140,6 +3039,51 @@ void DemoApp::framebufferResizeCallback(GLFWwindow* window, int width, int heigh
 	app->framebufferResized = true;
 }
 
+void DemoApp::keyCallback(GLFWwindow* window, int key, int scancode, int action, int mods)
+{
+	/*
+	Frame pacing controls, so latency vs throughput can be tuned while looking at the output:
+	F1 cycles the present policy, F2 the frames in flight (1 to FramePacer::MAX_FRAMES_IN_FLIGHT), F3 the frame rate cap.
+	F4 swaps the model for the next one in MODEL_PATHS.
+	*/
+	if (action != GLFW_PRESS)
+		return;
+
+	DemoApp* app = reinterpret_cast<DemoApp*>(glfwGetWindowUserPointer(window));
+
+	if (key == GLFW_KEY_F4)
+	{
+		app->mModelChangeRequested = true;
+		return;
+	}
+
+	FramePacingSettings settings = app->mFramePacingChanged ? app->mPendingFramePacing : app->mFramePacer.getSettings();
+
+	if (key == GLFW_KEY_F1)
+		settings.presentPolicy = static_cast<PresentPolicy>((static_cast<int>(settings.presentPolicy) + 1) % 4);
+	else if (key == GLFW_KEY_F2)
+		settings.framesInFlight = settings.framesInFlight % FramePacer::MAX_FRAMES_IN_FLIGHT + 1;
+	else if (key == GLFW_KEY_F3)
+	{
+		const double caps[] = { 0.0, 30.0, 60.0, 120.0, 144.0 };
+		const size_t capCount = sizeof(caps) / sizeof(caps[0]);
+
+		size_t current = 0;
+		for (size_t i = 0; i < capCount; ++i)
+		{
+			if (caps[i] > 0.0 && std::abs(settings.targetFrameTime - 1.0 / caps[i]) < 1e-6)
+				current = i;
+		}
+
+		double next = caps[(current + 1) % capCount];
+		settings.targetFrameTime = next > 0.0 ? 1.0 / next : 0.0;
+	}
+	else
+		return;
+
+	app->setFramePacing(settings);
+}
+
 std::vector<char> DemoApp::readFile(const std::string& filename)
 {
 	/*
@@ -2361,16 +3305,9 @@ VkPresentModeKHR DemoApp::chooseSwapPresentMode(const std::vector<VkPresentModeK
 	with significantly less latency issues than standard vertical sync that uses double buffering.
 	*/
 
-	VkPresentModeKHR bestMode = VK_PRESENT_MODE_FIFO_KHR;
-
-
-	for (const VkPresentModeKHR& availablePresentMode : availablePresentModes)
-	{
-		if (availablePresentMode == VK_PRESENT_MODE_MAILBOX_KHR)
-			return availablePresentMode;
-		else if (availablePresentMode == VK_PRESENT_MODE_IMMEDIATE_KHR)
-			bestMode = availablePresentMode;
-	}
+	//Which of these we prefer is a frame pacing setting, see PresentPolicy.
+	VkPresentModeKHR bestMode = mFramePacer.choosePresentMode(availablePresentModes);
+	std::cout << "present mode: " << FramePacer::getPresentModeName(bestMode) << std::endl;
 
 	return bestMode;
 }
@@ -2436,6 +3373,12 @@ QueueFamilyIndices DemoApp::findQueueFamilies(VkPhysicalDevice device)
 // polls for events like input. Glfw will handle some things related to that.
 void DemoApp::gameLoop()
 {
+	if (!mBenchmarkSweep.empty())
+	{
+		benchmarkLoop();
+		return;
+	}
+
 	while (!glfwWindowShouldClose(mWindow))
 	{
 		glfwPollEvents();
@@ -2446,6 +3389,65 @@ void DemoApp::gameLoop()
 	vkDeviceWaitIdle(mDevice);
 }
 
+void DemoApp::benchmarkLoop()
+{
+	/*
+	Renders every configuration of the sweep for a fixed number of frames and prints the average frame time.
+	Switching settings rebuilds everything that depends on them (render graph, pipelines) through recreateSwapChain.
+	Vsync would cap every configuration at the refresh rate, so the sweep runs with PresentPolicy::Uncapped and no frame
+	rate cap, and the frame pacing settings are put back afterwards. Without IMMEDIATE and MAILBOX that still ends up
+	as FIFO, so every result says which present mode it was measured with.
+	*/
+	const uint32_t warmupFrames = 32;
+
+	FramePacingSettings pacing = mFramePacingChanged ? mPendingFramePacing : mFramePacer.getSettings();
+	FramePacingSettings uncapped = pacing;
+	uncapped.presentPolicy = PresentPolicy::Uncapped;
+	uncapped.targetFrameTime = 0.0;
+	setFramePacing(uncapped);
+	applyFramePacingChanges();
+
+	std::cout << "--------------------------------" << std::endl;
+	std::cout << "benchmark: " << mBenchmarkSweep.size() << " configurations, " << mBenchmarkFrames << " frames each" << std::endl;
+
+	for (const RenderSettings& settings : mBenchmarkSweep)
+	{
+		if (glfwWindowShouldClose(mWindow))
+			break;
+
+		mSettings = settings;
+		applyRenderSettings();
+		recreateSwapChain();
+
+		for (uint32_t i = 0; i < warmupFrames; ++i)
+		{
+			glfwPollEvents();
+			drawFrame();
+		}
+
+		vkDeviceWaitIdle(mDevice);
+		auto start = std::chrono::high_resolution_clock::now();
+
+		for (uint32_t i = 0; i < mBenchmarkFrames; ++i)
+		{
+			glfwPollEvents();
+			drawFrame();
+		}
+
+		vkDeviceWaitIdle(mDevice);
+		auto end = std::chrono::high_resolution_clock::now();
+
+		double milliseconds = std::chrono::duration<double, std::milli>(end - start).count() / mBenchmarkFrames;
+		std::cout << describeRenderSettings() << ": " << milliseconds << " ms/frame (" << 1000.0 / milliseconds << " fps, "
+			<< FramePacer::getPresentModeName(mPresentMode) << ")" << std::endl;
+	}
+
+	std::cout << "--------------------------------" << std::endl;
+
+	setFramePacing(pacing);
+	applyFramePacingChanges();
+}
+
 void DemoApp::drawFrame()
 {
 	/*
@@ -2455,8 +3457,16 @@ void DemoApp::drawFrame()
 		Execute the command buffer with that image as attachment in the framebuffer
 		Return the image to the swap chain for presentation
 	*/
+	applyFramePacingChanges();
+	applyModelChange();
+	applyTextureResidency();
+
+	//Sleeps here, before anything reads the time or input, if there's a frame rate cap.
+	mFramePacer.beginFrame();
+
 	//Wait for fences to complete their stuff.
 	vkWaitForFences(mDevice, 1, &inFlightFences[mCurrentFrame], VK_TRUE, std::numeric_limits<uint64_t>::max());
+	mFramePacer.markFenceWaited();
 
 	uint32_t imageIndex;
 	/*
@@ -2475,13 +3485,24 @@ void DemoApp::drawFrame()
 	*/
 	if (result == VK_ERROR_OUT_OF_DATE_KHR)
 	{
+		//Nothing gets presented, so this frame would only skew the pacing averages.
+		mFramePacer.discardFrame();
 		recreateSwapChain();
 		return;
 	}
 	else if (result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR)
 		throw std::runtime_error("failed to acquire swap chain image!");
 
+	mFramePacer.markAcquired();
+
+	//Make sure the last frame that used this image is done with its uniform and instance buffers.
+	if (mImagesInFlight[imageIndex] != VK_NULL_HANDLE)
+		vkWaitForFences(mDevice, 1, &mImagesInFlight[imageIndex], VK_TRUE, std::numeric_limits<uint64_t>::max());
+	mImagesInFlight[imageIndex] = inFlightFences[mCurrentFrame];
+
+	readPipelineStatistics(imageIndex);
 	updateUniformBuffer(imageIndex);
+	VkCommandBuffer pageUploads = mVirtualTexturing ? updateVirtualTexture(imageIndex) : VK_NULL_HANDLE;
 
 	VkSubmitInfo submitInfo = {};
 	submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
@@ -2504,8 +3525,10 @@ void DemoApp::drawFrame()
 	The next two parameters specify which command buffers to actually submit for execution. 
 	We should submit the command buffer that binds the swap chain image we just acquired as color attachment.
 	*/
-	submitInfo.commandBufferCount = 1;
-	submitInfo.pCommandBuffers = &mCommandBuffers[imageIndex];
+	//New virtual texture pages go in first, in the same submit so the frame's fence also tells when their staging is free again.
+	VkCommandBuffer commandBuffers[] = { pageUploads, mCommandBuffers[imageIndex] };
+	submitInfo.commandBufferCount = pageUploads != VK_NULL_HANDLE ? 2 : 1;
+	submitInfo.pCommandBuffers = pageUploads != VK_NULL_HANDLE ? commandBuffers : &mCommandBuffers[imageIndex];
 
 	/*
 	The signalSemaphoreCount and pSignalSemaphores parameters specify which 
@@ -2521,6 +3544,8 @@ void DemoApp::drawFrame()
 	if (vkQueueSubmit(mGraphicsQueue, 1, &submitInfo, inFlightFences[mCurrentFrame]) != VK_SUCCESS)
 		throw std::runtime_error("failed to submit draw command buffer!");
 
+	mFramePacer.markSubmitted();
+
 	VkPresentInfoKHR presentInfo = {};
 	presentInfo.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
 	presentInfo.waitSemaphoreCount = 1;
@@ -2536,6 +3561,7 @@ void DemoApp::drawFrame()
 	//vkQueuePresentKHR returns same values as vkAquireNextImageKHR, 
 	//so we want to recreateSwapChain if it's out of date or suboptimal or framebuffer was resized
 	result = vkQueuePresentKHR(mPresentQueue, &presentInfo);
+	mFramePacer.markPresented();
 
 	if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR || framebufferResized)
 	{
@@ -2550,29 +3576,40 @@ void DemoApp::drawFrame()
 	//vkQueueWaitIdle(mPresentQueue);
 
 	// Instead of vkQueueWait, we advance the frame for our frame semaphores.
-	mCurrentFrame = (mCurrentFrame + 1) % MAX_FRAMES_IN_FLIGHT;
+	mCurrentFrame = (mCurrentFrame + 1) % inFlightFences.size();
 }
 
 void DemoApp::cleanupSwapChain()
 {
-	vkDestroyImageView(mDevice, mColorImageView, nullptr);
-	vkDestroyImage(mDevice, mColorImage, nullptr);
-	vkFreeMemory(mDevice, mColorImageMemory, nullptr);
-
-	vkDestroyImageView(mDevice, mDepthImageView, nullptr);
-	vkDestroyImage(mDevice, mDepthImage, nullptr);
-	vkFreeMemory(mDevice, depthImageMemory, nullptr);
-
 	//Cleanup code of all objects that are recreated as part of a swap chain refresh
-	for (VkFramebuffer framebuffer : mSwapChainFramebuffers)
-		vkDestroyFramebuffer(mDevice, framebuffer, nullptr);
+	//The render graph owns the render pass, framebuffers and the color/depth images.
+	mRenderGraph.destroy();
 
 	//We free the command buffers instead of destroying them because we can reuse the existsing pool to allocate the new command buffers
 	vkFreeCommandBuffers(mDevice, mCommandPool, static_cast<uint32_t>(mCommandBuffers.size()), mCommandBuffers.data());
 
 	vkDestroyPipeline(mDevice, mGraphicsPipeline, nullptr);
 	vkDestroyPipelineLayout(mDevice, mPipelineLayout, nullptr);
-	vkDestroyRenderPass(mDevice, mRenderPass, nullptr);
+	vkDestroyPipeline(mDevice, mShadowPipeline, nullptr);
+	vkDestroyPipelineLayout(mDevice, mShadowPipelineLayout, nullptr);
+	if (ENABLE_DEPTH_PREPASS)
+		vkDestroyPipeline(mDevice, mDepthPrepassPipeline, nullptr);
+	if (mVirtualTexturing)
+		vkDestroyPipeline(mDevice, mFeedbackPipeline, nullptr);
+
+	// The post process objects only exist when a post process AA is on, and the settings can change between swap chains.
+	if (mPostProcessPipeline != VK_NULL_HANDLE)
+	{
+		vkDestroyPipeline(mDevice, mPostProcessPipeline, nullptr);
+		vkDestroyPipelineLayout(mDevice, mPostProcessPipelineLayout, nullptr);
+		vkDestroyDescriptorPool(mDevice, mPostProcessDescriptorPool, nullptr);
+		vkDestroyDescriptorSetLayout(mDevice, mPostProcessSetLayout, nullptr);
+		vkDestroySampler(mDevice, mPostProcessSampler, nullptr);
+		mPostProcessPipeline = VK_NULL_HANDLE;
+	}
+
+	if (mQueryPool != VK_NULL_HANDLE)
+		vkDestroyQueryPool(mDevice, mQueryPool, nullptr);
 
 	for (VkImageView imageView : mSwapChainImageViews)
 		vkDestroyImageView(mDevice, imageView, nullptr);
@@ -2583,8 +3620,18 @@ void DemoApp::cleanupSwapChain()
 	{
 		vkDestroyBuffer(mDevice, mUniformBuffers[i], nullptr);
 		vkFreeMemory(mDevice, mUniformBuffersMemory[i], nullptr);
+
+		vkDestroyBuffer(mDevice, mShadowInstanceBuffers[i], nullptr);
+		vkFreeMemory(mDevice, mShadowInstanceBuffersMemory[i], nullptr);
+		vkDestroyBuffer(mDevice, mShadowDrawBuffers[i], nullptr);
+		vkFreeMemory(mDevice, mShadowDrawBuffersMemory[i], nullptr);
+		vkDestroyBuffer(mDevice, mSortedInstanceBuffers[i], nullptr);
+		vkFreeMemory(mDevice, mSortedInstanceBuffersMemory[i], nullptr);
 	}
 
+	mClusterCuller.destroyFrameResources();
+	mVirtualTexture.destroyFrameResources();
+
 	vkDestroyDescriptorPool(mDevice, mDescriptorPool, nullptr);
 }
 
@@ -2594,28 +3641,17 @@ void DemoApp::cleanApp()
 	cleanupSwapChain();
 
 	vkDestroySampler(mDevice, mTextureSampler, nullptr);
-	vkDestroyImageView(mDevice, mTextureImageView, nullptr);
-
-	vkDestroyImage(mDevice, mTextureImage, nullptr);
-	vkFreeMemory(mDevice, mTextureImageMemory, nullptr);
+	vkDestroySampler(mDevice, mShadowSampler, nullptr);
 
 	vkDestroyDescriptorSetLayout(mDevice, mDescriptorSetLayout, nullptr);
 
-	vkDestroyBuffer(mDevice, mIndexBuffer, nullptr);
-	vkFreeMemory(mDevice, mIndexBufferMemory, nullptr);
-
-	vkDestroyBuffer(mDevice, mVertexBuffer, nullptr);
-	vkFreeMemory(mDevice, mVertexBufferMemory, nullptr);
+	mClusterCuller.destroy();
+	mMeshes.destroy();
+	mMaterials.shutdown(); // Textures that were never uploaded still hold staging buffers.
+	mTextures.destroy();
+	mVirtualTexture.destroy();
 
-	vkDestroyBuffer(mDevice, mInstanceBuffer.buffer, nullptr);
-	vkFreeMemory(mDevice, mInstanceBuffer.memory, nullptr);
-
-	for (size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; ++i)
-	{
-		vkDestroySemaphore(mDevice, mRenderFinishedSemaphores[i], nullptr);
-		vkDestroySemaphore(mDevice, mImageAvailableSemaphores[i], nullptr);
-		vkDestroyFence(mDevice, inFlightFences[i], nullptr);
-	}
+	destroySyncObjects();
 
 	vkDestroyCommandPool(mDevice, mCommandPool, nullptr);
 
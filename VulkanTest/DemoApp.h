@@ -14,6 +14,15 @@ https://vulkan-tutorial.com/Drawing_a_triangle
 #include <vulkan/vulkan.h>
 #include <GLFW/glfw3.h>
 
+#include "RenderGraph.h"
+#include "RadixSort.h"
+#include "FramePacer.h"
+#include "MeshStreamer.h"
+#include "MeshRegistry.h"
+#include "ClusterCuller.h"
+#include "MaterialLibrary.h"
+#include "TextureResidency.h"
+#include "VirtualTexture.h"
 
 #include <iostream>
 #include <stdexcept> // used to catch any terrible errors
@@ -27,13 +36,15 @@ https://vulkan-tutorial.com/Drawing_a_triangle
 #include <random>
 
 //Vertex Data
-#define GLM_FORCE_RADIANS
-#define GLM_FORCE_DEPTH_ZERO_TO_ONE //Used for depth buffering.
+//GLM_FORCE_RADIANS, GLM_FORCE_DEPTH_ZERO_TO_ONE (depth buffering) and GLM_FORCE_CONSTEXPR (fixed view and projection matrices
+//computed by the compiler) are set for the whole project in VulkanTest.vcxproj, so every file sees glm configured the same way.
 #define GLM_ENABLE_EXPERIMENTAL // So that we can hash GLM
 //#define GLM_FORCE_DEFAULT_ALIGNED_GENTYPES
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtx/hash.hpp>
+#include <glm/gtx/intersect_batch.hpp>
+#include <glm/gtx/noise_batch.hpp>
 #include <chrono>
 
 #define INSTANCE_COUNT 2048
@@ -42,9 +53,59 @@ const int WINDOW_WIDTH = 800, WINDOW_HEIGHT = 600;
 
 const std::string MODEL_PATH = "models/utah_teapot.obj";
 const std::string TEXTURE_PATH = "textures/Dan.bmp";
+// The virtual texture's tiled file, built from VIRTUAL_TEXTURE_SOURCE the first time it's missing.
+const std::string VIRTUAL_TEXTURE_SOURCE = "textures/chalet.jpg";
+const std::string VIRTUAL_TEXTURE_PATH = "textures/chalet.vt";
 
-// Defines how many frames can be processed concurrently.
-const int MAX_FRAMES_IN_FLIGHT = 2;
+// F4 swaps the instanced model for the next one of these while running, see applyModelChange.
+const std::vector<std::string> MODEL_PATHS = { MODEL_PATH, "models/teapot.obj", "models/teapot2.obj" };
+
+// Point light shadow map. One cube face is SHADOW_MAP_SIZE^2 texels.
+const uint32_t SHADOW_MAP_SIZE = 1024;
+constexpr float SHADOW_NEAR = 0.1f, SHADOW_FAR = 64.f;
+
+constexpr float CAMERA_NEAR = 0.1f, CAMERA_FAR = 100.f;
+
+// The camera doesn't move and every shadow cube face has the same projection.
+// Only the camera projection depends on the window, see mCameraProj.
+GLM_CONSTEXPR_MATH glm::mat4 const CAMERA_VIEW = glm::lookAt(glm::vec3(2.0f, 10.0f, 42.0f), glm::vec3(0.0f), glm::vec3(1.0f, 1.0f, 0.0f));
+GLM_CONSTEXPR_MATH glm::mat4 const SHADOW_PROJ = glm::perspective(glm::radians(90.0f), 1.0f, SHADOW_NEAR, SHADOW_FAR);
+
+// Lay down depth with a position only pass first, then shade with depth EQUAL. Trades one extra (cheap) geometry pass for zero overdraw.
+const bool ENABLE_DEPTH_PREPASS = true;
+
+// Split the model into meshlets and cull them per instance in a compute pass (see ClusterCuller) before the depth pre-pass and scene draws.
+const bool ENABLE_CLUSTER_CULLING = true;
+
+// Parse the model straight into the vertex/index buffers through a small staging ring (see MeshStreamer)
+// instead of loading the whole file, building the vertex/index arrays and uploading those.
+const bool STREAM_MODEL = true;
+
+/*
+Draw the teapots with VIRTUAL_TEXTURE_PATH as a virtual texture (see VirtualTexture) instead of TEXTURE_PATH:
+a low resolution feedback pass finds the pages the frame samples, and only those are loaded into a page cache.
+Needs shaders/frag_vt.spv and shaders/feedback_frag.spv from shaders/compile.bat, without them it's turned off at startup.
+*/
+const bool ENABLE_VIRTUAL_TEXTURING = true;
+
+/*
+Anti-aliasing quality/performance settings.
+MSAA with per sample shading looks best but costs up to samples times the fragment work,
+FXAA is a single fullscreen pass and a lot cheaper, but blurs a bit. They can be combined.
+*/
+enum class PostAA
+{
+	None,
+	FXAA
+};
+
+struct RenderSettings
+{
+	VkSampleCountFlagBits msaaSamples = VK_SAMPLE_COUNT_4_BIT; // Requested count, lowered to what the device supports.
+	bool sampleShading = false;
+	float minSampleShading = 1.0f; // Fraction of the samples that get shaded when sampleShading is on.
+	PostAA postAA = PostAA::None;
+};
 
 // Validation layers setup. 
 const std::vector<const char*> validationLayers  = 
@@ -208,21 +269,34 @@ struct Vertex
 		return attributeDescriptions;
 	}
 
+	/*
+	Bindings for the depth only pipelines (shadow map, depth pre-pass).
+	Binding 0 is the position stream (MeshRegistry::getPositionBuffer), just a vec3 per vertex.
+	*/
+	static std::array<VkVertexInputBindingDescription, 2> getPositionBindingDescription()
+	{
+		std::array<VkVertexInputBindingDescription, 2> bindingDescriptions = getBindingDescription();
+		bindingDescriptions[0].stride = sizeof(glm::vec3);
+
+		return bindingDescriptions;
+	}
+
+	// Position, instance pos and instance rot. Same locations as getAttributeDescriptions so the shaders can share declarations.
+	static std::array<VkVertexInputAttributeDescription, 3> getPositionAttributeDescriptions()
+	{
+		std::array<VkVertexInputAttributeDescription, 8> all = getAttributeDescriptions();
+		std::array<VkVertexInputAttributeDescription, 3> attributeDescriptions = { all[0], all[4], all[5] };
+		attributeDescriptions[0].offset = 0;
+
+		return attributeDescriptions;
+	}
+
 	bool operator==(const Vertex& other) const
 	{
 		return pos == other.pos && color == other.color && texCoord == other.texCoord;
 	}
 };
 
-//Contains the instanced data
-struct InstanceBuffer
-{
-	VkBuffer buffer = VK_NULL_HANDLE;
-	VkDeviceMemory memory = VK_NULL_HANDLE;
-	size_t size = 0;
-	VkDescriptorBufferInfo descriptor;
-};
-
 
 // standard hash operator so that we can use a map.
 // https://en.cppreference.com/w/cpp/utility/hash
@@ -275,6 +349,9 @@ struct UniformBufferObject
 
 	alignas(16) glm::vec4 uLightPos;
 	alignas(16) glm::vec4 uLightCol;
+
+	alignas(16) glm::mat4 uShadowViewProj[6]; // One view-projection per cube face.
+	alignas(16) glm::vec4 uShadowParams; // near, far, PCF radius, depth bias
 };
 
 
@@ -284,6 +361,18 @@ public:
 	// for demo purposes, will just call things as needed.
 	void run();
 
+	// Has to be called before run().
+	void setRenderSettings(const RenderSettings& settings) { mSettings = settings; }
+
+	// Frames in flight, present policy and frame rate cap. Can also be changed while running (F1-F3, see keyCallback).
+	void setFramePacing(const FramePacingSettings& settings);
+
+	// Instead of running interactively, render each settings configuration for framesPerSetting frames and print the timings.
+	void setBenchmark(const std::vector<RenderSettings>& sweep, uint32_t framesPerSetting) { mBenchmarkSweep = sweep; mBenchmarkFrames = framesPerSetting; }
+
+	// Device local bytes the textures may take, 0 to take it from VK_EXT_memory_budget (see TextureResidency). Has to be called before run().
+	void setTextureBudget(VkDeviceSize bytes) { mTextureBudget = bytes; }
+
 private:
 	// initApp will initialize the application, vulkan objects, and so on.
 	void initApp();
@@ -297,42 +386,60 @@ private:
 	void createLogicalDevice();
 	void createSwapChain();
 	void createImageViews();
-	void createRenderPass();
+	void createRenderGraph(); // Describes the frame (passes, attachments) and compiles it.
 	void createDescriptorSetLayout();
 	void createGraphicsPipeline();
-	void createFramebuffers();
+	void createShadowPipeline(); // Depth only variant of the graphics pipeline for the shadow map.
+	void createDepthPrepassPipeline(); // Depth only variant of the graphics pipeline for the depth pre-pass.
+	void createPostProcessPipeline(); // FXAA pass, and the descriptors it needs.
+	void createFeedbackPipeline(); // Writes the virtual texture pages the scene samples, for the feedback pass.
+	VkPipeline createDepthOnlyPipeline(const std::string& shaderFile, VkExtent2D extent, VkSampleCountFlagBits samples, VkFrontFace frontFace,
+		bool depthBias, VkPipelineLayout layout, VkRenderPass renderPass);
 	void createCommandPool();
 	VkCommandBuffer createCommandBuffer(VkCommandBufferLevel level, bool begin);
 	void createCommandBuffers();
 	void createSyncObjects();
+	void destroySyncObjects();
+	void applyFramePacingChanges(); // Rebuilds sync objects and the swap chain after the frame pacing settings changed.
 
 	void recreateSwapChain();
 	//static because GLFW doesn't know how to call a member function with the right this pointer
 	static void framebufferResizeCallback(GLFWwindow* window, int width, int height);
-
-	void loadModel();
-	void createVertexBuffer();
-	void createIndexBuffer();
+	static void keyCallback(GLFWwindow* window, int key, int scancode, int action, int mods);
+
+	MeshRegistry::MeshHandle loadModel(const std::string& path);
+	MeshRegistry::MeshHandle streamModel(const std::string& path); // Same as loadModel, but parses straight into device memory (see MeshStreamer).
+	void applyModelChange(); // Swaps in the next of MODEL_PATHS after F4 was pressed.
+	void applyTextureResidency(); // Marks the textures the frame draws with, then uploads and evicts if needed.
+	void writeTextureDescriptors(); // Points the descriptor sets at the current texture views.
+	VkCommandBuffer updateVirtualTexture(uint32_t imageIndex); // Reads the image's feedback, returns the page uploads to submit with the frame.
 	void createUniformBuffers();
+	void createShadowBuffers();
+	void createSortedInstanceBuffers();
+	void createQueryPool();
 	void createDescriptorPool();
 	void createDescriptorSets();
 
 	void prepareInstanceData();
+	void updateInstanceBounds(); // Bounding spheres of the instances, for the current model.
+	void cullShadowCasters(uint32_t currentImage, const glm::mat4 faceViewProj[6]); // Per cube face instance lists for the shadow pass.
+	void sortInstances(uint32_t currentImage, const glm::mat4& modelView); // Front to back instance order for early-Z.
+	void readPipelineStatistics(uint32_t imageIndex);
 
-	void createColorResources();
-	void createDepthResources();
 	VkFormat findSupportedFormat(const std::vector<VkFormat>& candidates, VkImageTiling tiling, VkFormatFeatureFlags features); // Helper function to get the best depth format on per device.
 	VkFormat findDepthFormat(); // Helper function using ^ to get the best depth format.
 	bool hasStencilComponent(VkFormat format) { return format == VK_FORMAT_D32_SFLOAT_S8_UINT || format == VK_FORMAT_D24_UNORM_S8_UINT; };
 
 	void createTextureImage();
+	void createShadowSampler();
 	void createImage(uint32_t width, uint32_t height, VkSampleCountFlagBits numSamples, VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkMemoryPropertyFlags properties, VkImage& image, VkDeviceMemory& imageMemory);
 
-	void createTextureImageView();
 	VkImageView createImageView(VkImage image, VkFormat format, VkImageAspectFlags aspectFlags);
 
 	void createTextureSampler();
 	VkSampleCountFlagBits getMaxUsableSampleCount();
+	void applyRenderSettings(); // Picks mMSAASamples from mSettings.
+	std::string describeRenderSettings() const;
 
 	VkCommandBuffer beginSingleTimeCommands();
 	void endSingleTimeCommands(VkCommandBuffer commandbuffer);
@@ -363,6 +470,7 @@ private:
 
 	// I mean, it's the game loop.
 	void gameLoop();
+	void benchmarkLoop(); // Runs the settings sweep from setBenchmark instead of the normal loop.
 	void drawFrame();
 
 	// cleanup objects, freeing memory and other important things.
@@ -374,7 +482,7 @@ private:
 	VkDebugUtilsMessengerEXT mDebugMessenger; // object to store debug messages, and will call debugCallback.
 	VkPhysicalDevice mPhysDevice; // The graphics card that we select.
 	GLFWwindow* mWindow;
-	VkDevice mDevice; // Logical device to interface with our physical device.
+	VkDevice mDevice = VK_NULL_HANDLE; // Logical device to interface with our physical device.
 	VkQueue mGraphicsQueue; // Handle to interface with queues on our logical device.
 	VkSurfaceKHR mSurface; // Window System Integration (WSI) extension to display outputs to screen.
 	VkQueue mPresentQueue; // Queue to put stuff on the screen.
@@ -382,51 +490,111 @@ private:
 	std::vector<VkImage> mSwapChainImages; // Holder for images from swap chain.
 	VkFormat mSwapChainImageFormat;	// Format for the images in swap chain.
 	VkExtent2D mSwapChainExtent; // Extent for the images in swap chain.
+	VkPresentModeKHR mPresentMode; // What chooseSwapPresentMode picked for the current swap chain.
+	glm::mat4 mCameraProj; // Camera projection for the swap chain aspect ratio, Y flipped for Vulkan.
 	std::vector<VkImageView> mSwapChainImageViews; // View into an image.
-	VkRenderPass mRenderPass; // The render pass.
 	VkDescriptorSetLayout mDescriptorSetLayout; // Tells Vulkan what type of shader we are using.
 	VkPipelineLayout mPipelineLayout; // Pipeline layout.
 	VkPipeline mGraphicsPipeline; // Literally the pipeline. 
-	std::vector<VkFramebuffer> mSwapChainFramebuffers;  // Stores all of the VkImageViews in a list of Framebuffers.
 	VkCommandPool mCommandPool; // Manage the memory that is used to store the buffers and command buffers are allocated from them.
 	std::vector<VkCommandBuffer> mCommandBuffers;
 	std::vector<VkSemaphore> mImageAvailableSemaphores;
 	std::vector<VkSemaphore> mRenderFinishedSemaphores;
 	std::vector<VkFence> inFlightFences; // Fences are similar to semaphores in the sense that they can be signaled and waited for, but this time we actually wait for them in our own code.
+	std::vector<VkFence> mImagesInFlight; // Per swap chain image, the fence of the last frame that rendered to it.
 	size_t mCurrentFrame = 0; // The current frame that we're on.
+	FramePacer mFramePacer;
+	FramePacingSettings mPendingFramePacing;
+	bool mFramePacingChanged = false;
 	bool framebufferResized = false; // Was the framebuffer resized?
-	VkBuffer mVertexBuffer;
-	VkDeviceMemory mVertexBufferMemory;
-	VkBuffer mIndexBuffer; // What we will use for instancing.
-	VkDeviceMemory mIndexBufferMemory; // Total memory we have to instance.
+	MeshRegistry mMeshes; // Vertex, position and index arenas shared by every mesh.
+	MeshRegistry::MeshHandle mModel = MeshRegistry::INVALID_MESH; // What we will use for instancing.
+	size_t mModelPathIndex = 0; // Into MODEL_PATHS.
+	bool mModelChangeRequested = false;
 	std::vector<VkBuffer> mUniformBuffers; // The uniform buffers we have.
 	std::vector<VkDeviceMemory> mUniformBuffersMemory; // Total memory we have for the uniform buffers.
 	VkDescriptorPool mDescriptorPool;  // Holds all descriptor sets
 	std::vector<VkDescriptorSet> mDescriptorSets; // The descriptor sets
 
-	VkImage mTextureImage; // Image object to retrieve colors by allowing 2D coords & texels.
-	VkDeviceMemory mTextureImageMemory; // memory for ^
-	VkImageView mTextureImageView;
-	VkSampler mTextureSampler;
+	MaterialLibrary mMaterials; // .mtl parsing and texture decoding on worker threads.
+	uint32_t mTextureRequest = StringTable::INVALID; // TEXTURE_PATH, queued in mMaterials.
+	uint32_t mModelMaterialName = StringTable::INVALID; // Material of the model's first faces.
 
-	//Depth stuff
-	VkImage mDepthImage;
-	VkDeviceMemory depthImageMemory;
-	VkImageView mDepthImageView;
+	TextureResidency mTextures; // Device local images of the textures, under a budget.
+	TextureResidency::TextureHandle mTexture = TextureResidency::INVALID_TEXTURE; // What every instance is drawn with.
+	uint32_t mTextureGeneration = 0; // mTextures generation the descriptor sets were written with.
+	VkDeviceSize mTextureBudget = 0;
+	bool mMemoryBudgetSupported = false; // VK_EXT_memory_budget, and the instance extension it needs, are enabled.
+	uint64_t mFrameNumber = 0; // Frames drawn, for the texture LRU.
+	VkSampler mTextureSampler;
 
 	// vertices
-	std::vector <Vertex> mVertices;
-	std::vector<uint32_t> mIndices;
 	//VkBuffer mVertexBuffer;
 	//VkDeviceMemory mVertexBufferMemory;
 
 	//Multisampling
 	VkSampleCountFlagBits mMSAASamples = VK_SAMPLE_COUNT_1_BIT;
-	VkImage mColorImage;
-	VkDeviceMemory mColorImageMemory;
-	VkImageView mColorImageView;
-
-	InstanceBuffer mInstanceBuffer;
+	RenderSettings mSettings;
+
+	//Post process anti-aliasing
+	RenderGraph::ResourceHandle mSceneColor;
+	RenderGraph::PassHandle mPostProcessPass;
+	VkDescriptorSetLayout mPostProcessSetLayout;
+	VkDescriptorPool mPostProcessDescriptorPool;
+	VkDescriptorSet mPostProcessDescriptorSet;
+	VkSampler mPostProcessSampler;
+	VkPipelineLayout mPostProcessPipelineLayout;
+	VkPipeline mPostProcessPipeline = VK_NULL_HANDLE;
+
+	//Benchmark mode
+	std::vector<RenderSettings> mBenchmarkSweep;
+	uint32_t mBenchmarkFrames = 0;
+
+	// Owns the render pass, framebuffers, and the color/depth images.
+	RenderGraph mRenderGraph;
+	RenderGraph::PassHandle mScenePass;
+
+	//Shadows
+	std::array<RenderGraph::PassHandle, 6> mShadowPasses; // One pass per cube face.
+	RenderGraph::ResourceHandle mShadowMap;
+	VkPipelineLayout mShadowPipelineLayout;
+	VkPipeline mShadowPipeline;
+	VkSampler mShadowSampler; // Comparison sampler, so the hardware does a 2x2 PCF per lookup.
+	std::vector<VkBuffer> mShadowInstanceBuffers; // Per swap chain image, the instances visible to each face, INSTANCE_COUNT slots per face.
+	std::vector<VkDeviceMemory> mShadowInstanceBuffersMemory;
+	std::vector<VkBuffer> mShadowDrawBuffers; // Per swap chain image, one VkDrawIndexedIndirectCommand per face.
+	std::vector<VkDeviceMemory> mShadowDrawBuffersMemory;
+	std::vector<InstanceData> mInstanceData; // CPU copy of the instances for culling.
+	glm::vec3_soa mInstanceCenters; // Bounding spheres of the instances as structures of arrays, for the batched frustum tests.
+	glm::vec1_soa mInstanceRadii;
+	std::vector<uint32_t> mShadowCasters; // Scratch for cullShadowCasters, the indices of the instances inside one face.
+
+	//Depth pre-pass and draw order
+	RenderGraph::PassHandle mDepthPrepass;
+	VkPipeline mDepthPrepassPipeline;
+	std::vector<VkBuffer> mSortedInstanceBuffers; // Per swap chain image, the instances sorted front to back.
+	std::vector<VkDeviceMemory> mSortedInstanceBuffersMemory;
+	std::vector<uint16_t> mSortKeys;
+	std::vector<uint32_t> mSortOrder;
+	RadixSortScratch mSortScratch;
+
+	//Cluster culling
+	RenderGraph::PassHandle mClusterCullPass;
+	ClusterCuller mClusterCuller; // Culls the meshlets of mModel against the sorted instances.
+
+	//Virtual texturing
+	bool mVirtualTexturing = false; // ENABLE_VIRTUAL_TEXTURING, and its shaders were built.
+	VirtualTexture mVirtualTexture;
+	RenderGraph::ResourceHandle mFeedback; // Page ids, VirtualTexture::getFeedbackExtent of the screen.
+	RenderGraph::PassHandle mFeedbackPass;
+	RenderGraph::PassHandle mFeedbackReadbackPass;
+	VkPipeline mFeedbackPipeline;
+
+	//Overdraw statistics
+	bool mPipelineStatisticsSupported = false;
+	VkQueryPool mQueryPool = VK_NULL_HANDLE; // One fragment shader invocation query per swap chain image.
+	uint64_t mFragmentInvocations = 0;
+	uint32_t mStatisticsFrames = 0;
 };
 
 #endif // !DEMO_APP_H
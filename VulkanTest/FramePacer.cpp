@@ -0,0 +1,162 @@
+/*
+FramePacer.cpp
+definitions for the functions in FramePacer.h
+*/
+
+#include "FramePacer.h"
+
+#include <algorithm>
+#include <iostream>
+#include <thread>
+
+static double seconds(std::chrono::steady_clock::duration duration)
+{
+	return std::chrono::duration<double>(duration).count();
+}
+
+void FramePacer::setSettings(const FramePacingSettings& settings)
+{
+	mSettings = settings;
+	mSettings.framesInFlight = std::max(1u, std::min(mSettings.framesInFlight, MAX_FRAMES_IN_FLIGHT));
+	mSettings.targetFrameTime = std::max(0.0, mSettings.targetFrameTime);
+}
+
+VkPresentModeKHR FramePacer::choosePresentMode(const std::vector<VkPresentModeKHR>& availablePresentModes) const
+{
+	std::vector<VkPresentModeKHR> preferred;
+
+	switch (mSettings.presentPolicy)
+	{
+	case PresentPolicy::LowLatency:
+		preferred = { VK_PRESENT_MODE_MAILBOX_KHR, VK_PRESENT_MODE_IMMEDIATE_KHR };
+		break;
+	case PresentPolicy::Vsync:
+		break;
+	case PresentPolicy::VsyncRelaxed:
+		preferred = { VK_PRESENT_MODE_FIFO_RELAXED_KHR };
+		break;
+	case PresentPolicy::Uncapped:
+		preferred = { VK_PRESENT_MODE_IMMEDIATE_KHR, VK_PRESENT_MODE_MAILBOX_KHR };
+		break;
+	}
+
+	for (VkPresentModeKHR mode : preferred)
+	{
+		if (std::find(availablePresentModes.begin(), availablePresentModes.end(), mode) != availablePresentModes.end())
+			return mode;
+	}
+
+	// FIFO is the only mode the spec guarantees.
+	return VK_PRESENT_MODE_FIFO_KHR;
+}
+
+void FramePacer::waitUntil(Clock::time_point deadline)
+{
+	auto sleepUntil = deadline - std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(SPIN_TIME));
+	if (Clock::now() < sleepUntil)
+		std::this_thread::sleep_until(sleepUntil);
+
+	while (Clock::now() < deadline)
+		std::this_thread::yield();
+}
+
+void FramePacer::beginFrame()
+{
+	Clock::time_point now = Clock::now();
+	Clock::time_point start = now;
+
+	if (mHasLastFrame && mSettings.targetFrameTime > 0.0)
+	{
+		// Measured from the start of the last frame, so a late frame isn't followed by a burst of short ones trying to catch up.
+		Clock::time_point deadline = mFrameStart + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(mSettings.targetFrameTime));
+
+		if (now < deadline)
+		{
+			waitUntil(deadline);
+			start = Clock::now();
+		}
+	}
+
+	mFrameSleep = 0.0;
+	if (mHasLastFrame)
+	{
+		mFrameSleep = seconds(start - now);
+		mSleepTime += mFrameSleep;
+		mFrameTime += seconds(start - mFrameStart);
+	}
+
+	mFrameStart = start;
+	mHasLastFrame = true;
+}
+
+void FramePacer::markFenceWaited()
+{
+	mFenceWaited = Clock::now();
+	mFenceTime += seconds(mFenceWaited - mFrameStart);
+}
+
+void FramePacer::markAcquired()
+{
+	mAcquired = Clock::now();
+	mAcquireTime += seconds(mAcquired - mFenceWaited);
+}
+
+void FramePacer::markSubmitted()
+{
+	mSubmitted = Clock::now();
+	mRecordTime += seconds(mSubmitted - mAcquired);
+}
+
+void FramePacer::markPresented()
+{
+	mPresentTime += seconds(Clock::now() - mSubmitted);
+
+	if (++mFrames < REPORT_INTERVAL)
+		return;
+
+	/*
+	All CPU side. acquire -> submit is what the CPU adds to the latency of a frame (uniforms, sorting, culling),
+	fence and acquire waits show the CPU running ahead of the GPU or the display, and present is the time vkQueuePresentKHR blocks.
+	*/
+	double toMs = 1000.0 / mFrames;
+	std::cout << "frame pacing (" << getPresentPolicyName(mSettings.presentPolicy) << ", " << mSettings.framesInFlight << " in flight): "
+		<< mFrameTime * toMs << " ms/frame | sleep " << mSleepTime * toMs << " | fence " << mFenceTime * toMs
+		<< " | acquire " << mAcquireTime * toMs << " | acquire->submit " << mRecordTime * toMs
+		<< " | present " << mPresentTime * toMs << " ms" << std::endl;
+
+	mSleepTime = mFenceTime = mAcquireTime = mRecordTime = mPresentTime = mFrameTime = 0.0;
+	mFrames = 0;
+}
+
+void FramePacer::discardFrame()
+{
+	// Takes back what beginFrame and markFenceWaited added. Whatever happens until the next beginFrame (a swap chain rebuild) isn't frame time either.
+	mSleepTime -= mFrameSleep;
+	mFenceTime -= seconds(mFenceWaited - mFrameStart);
+	mHasLastFrame = false;
+}
+
+std::string FramePacer::getPresentPolicyName(PresentPolicy policy)
+{
+	switch (policy)
+	{
+	case PresentPolicy::LowLatency: return "low latency";
+	case PresentPolicy::Vsync: return "vsync";
+	case PresentPolicy::VsyncRelaxed: return "relaxed vsync";
+	case PresentPolicy::Uncapped: return "uncapped";
+	}
+
+	return "unknown";
+}
+
+std::string FramePacer::getPresentModeName(VkPresentModeKHR mode)
+{
+	switch (mode)
+	{
+	case VK_PRESENT_MODE_IMMEDIATE_KHR: return "immediate";
+	case VK_PRESENT_MODE_MAILBOX_KHR: return "mailbox";
+	case VK_PRESENT_MODE_FIFO_KHR: return "fifo";
+	case VK_PRESENT_MODE_FIFO_RELAXED_KHR: return "fifo relaxed";
+	default: return "other";
+	}
+}
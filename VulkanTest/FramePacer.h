@@ -0,0 +1,93 @@
+/*
+FramePacer.h
+Frame pacing and latency control for the render loop.
+
+Trades input-to-photon latency against throughput with three knobs:
+- frames in flight: how far the CPU may run ahead of the GPU. More hides hitches, but every frame queued adds a frame of latency.
+- present policy: which swap chain present mode to prefer (vsync, mailbox, immediate...).
+- target frame time: the CPU sleeps at the start of a frame so frames start no faster than this.
+  Sleeping before input is read (instead of blocking later in acquire/present) is what keeps the latency down with a frame cap.
+
+It also timestamps every frame (start, fence wait, acquire, submit, present) and prints the averages.
+*/
+
+#ifndef FRAME_PACER_H
+#define FRAME_PACER_H
+
+#include <vulkan/vulkan.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+// Which present mode to prefer, from the most to the least wanted.
+enum class PresentPolicy
+{
+	LowLatency,   // MAILBOX, IMMEDIATE, FIFO. No tearing if mailbox exists, newest frame always wins.
+	Vsync,        // FIFO. Always available, lowest power, up to swap chain length frames of latency.
+	VsyncRelaxed, // FIFO_RELAXED, FIFO. Tears instead of stuttering when a frame is late.
+	Uncapped      // IMMEDIATE, MAILBOX, FIFO. Tears, but lowest latency and highest throughput (benchmarks).
+};
+
+struct FramePacingSettings
+{
+	uint32_t framesInFlight = 2;
+	PresentPolicy presentPolicy = PresentPolicy::LowLatency;
+	double targetFrameTime = 0.0; // In seconds, 0 for no cap.
+};
+
+class FramePacer
+{
+public:
+	static const uint32_t MAX_FRAMES_IN_FLIGHT = 4;
+
+	// framesInFlight is clamped to [1, MAX_FRAMES_IN_FLIGHT].
+	void setSettings(const FramePacingSettings& settings);
+	const FramePacingSettings& getSettings() const { return mSettings; }
+
+	VkPresentModeKHR choosePresentMode(const std::vector<VkPresentModeKHR>& availablePresentModes) const;
+
+	// Sleeps until the target frame time since the last frame started has passed, then starts timing the new frame.
+	void beginFrame();
+
+	// Timestamps for the stages of the current frame, call them in this order.
+	void markFenceWaited();
+	void markAcquired();
+	void markSubmitted();
+	void markPresented(); // Ends the frame. Prints the averages every REPORT_INTERVAL frames.
+	// Instead of the rest after markFenceWaited, when the frame won't be presented (out of date swap chain).
+	void discardFrame();
+
+	static std::string getPresentPolicyName(PresentPolicy policy);
+	static std::string getPresentModeName(VkPresentModeKHR mode);
+
+private:
+	typedef std::chrono::steady_clock Clock;
+
+	static const uint32_t REPORT_INTERVAL = 256;
+
+	// sleep_for overshoots by up to a scheduler tick (1 ms or more on Windows), so the last bit is spent spinning.
+	static constexpr double SPIN_TIME = 0.002;
+
+	void waitUntil(Clock::time_point deadline);
+
+	FramePacingSettings mSettings;
+
+	Clock::time_point mFrameStart;
+	Clock::time_point mFenceWaited;
+	Clock::time_point mAcquired;
+	Clock::time_point mSubmitted;
+	bool mHasLastFrame = false;
+	double mFrameSleep = 0.0; // What beginFrame added to mSleepTime for the current frame.
+
+	// Sums over the current report interval, in seconds.
+	double mSleepTime = 0.0;
+	double mFenceTime = 0.0;
+	double mAcquireTime = 0.0;
+	double mRecordTime = 0.0;
+	double mPresentTime = 0.0;
+	double mFrameTime = 0.0;
+	uint32_t mFrames = 0;
+};
+
+#endif // !FRAME_PACER_H
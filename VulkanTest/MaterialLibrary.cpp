@@ -0,0 +1,535 @@
+/*
+MaterialLibrary.cpp
+definitions for the functions in MaterialLibrary.h
+*/
+
+#include "MaterialLibrary.h"
+
+#include <stb_image.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+
+uint64_t StringTable::hash(const std::string& str)
+{
+	// FNV-1a
+	uint64_t h = 14695981039346656037ull;
+	for (char c : str)
+	{
+		h ^= static_cast<unsigned char>(c);
+		h *= 1099511628211ull;
+	}
+	return h;
+}
+
+size_t StringTable::findSlot(const std::string& str, uint64_t strHash) const
+{
+	size_t mask = mSlots.size() - 1;
+	for (size_t slot = static_cast<size_t>(strHash) & mask; ; slot = (slot + 1) & mask)
+	{
+		uint32_t entry = mSlots[slot];
+		if (entry == 0 || (mHashes[entry - 1] == strHash && mStrings[entry - 1] == str))
+			return slot;
+	}
+}
+
+uint32_t StringTable::find(const std::string& str) const
+{
+	if (mSlots.empty())
+		return INVALID;
+
+	uint32_t entry = mSlots[findSlot(str, hash(str))];
+	return entry == 0 ? INVALID : entry - 1;
+}
+
+uint32_t StringTable::intern(const std::string& str)
+{
+	// At most half full, so probe sequences stay short.
+	if ((mStrings.size() + 1) * 2 > mSlots.size())
+		grow();
+
+	uint64_t strHash = hash(str);
+	size_t slot = findSlot(str, strHash);
+	if (mSlots[slot] != 0)
+		return mSlots[slot] - 1;
+
+	mStrings.push_back(str);
+	mHashes.push_back(strHash);
+	mSlots[slot] = static_cast<uint32_t>(mStrings.size());
+
+	return static_cast<uint32_t>(mStrings.size() - 1);
+}
+
+void StringTable::grow()
+{
+	std::vector<uint32_t> slots(std::max<size_t>(16, mSlots.size() * 2), 0);
+	size_t mask = slots.size() - 1;
+
+	for (uint32_t id = 0; id < mStrings.size(); ++id)
+	{
+		size_t slot = static_cast<size_t>(mHashes[id]) & mask;
+		while (slots[slot] != 0)
+			slot = (slot + 1) & mask;
+		slots[slot] = id + 1;
+	}
+
+	mSlots.swap(slots);
+}
+
+void StringTable::clear()
+{
+	mSlots.clear();
+	mHashes.clear();
+	mStrings.clear();
+}
+
+bool MaterialLibrary::Reader::operator()(const std::string& matId, std::vector<tinyobj::material_t>* /*materials*/,
+	std::map<std::string, int>* /*matMap*/, std::string* warn, std::string* /*err*/)
+{
+	std::string path = mBaseDir + matId;
+	if (mLibrary.loadLibrary(path))
+		return true;
+
+	if (warn)
+		*warn += "Material file [ " + path + " ] not found.\n";
+	return false;
+}
+
+MaterialLibrary::~MaterialLibrary()
+{
+	shutdown();
+}
+
+void MaterialLibrary::shutdown()
+{
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mStopping = true;
+		mJobs.clear();
+	}
+	mJobReady.notify_all();
+
+	for (std::thread& worker : mWorkers)
+		worker.join();
+	mWorkers.clear();
+
+	for (auto& slot : mTextures)
+		freeTexture(slot->texture);
+}
+
+void MaterialLibrary::setTextureAllocator(AllocateFunction allocate, FreeFunction free)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	mAllocate = std::move(allocate);
+	mFree = std::move(free);
+}
+
+std::string MaterialLibrary::getDirectory(const std::string& path)
+{
+	size_t separator = path.find_last_of("/\\");
+	return separator == std::string::npos ? std::string() : path.substr(0, separator + 1);
+}
+
+void MaterialLibrary::enqueue(std::function<void()> job)
+{
+	if (mWorkers.empty())
+	{
+		// Decoding is mostly waiting on the disk and inflating, the main thread keeps parsing geometry meanwhile.
+		unsigned threadCount = std::max(1u, std::thread::hardware_concurrency() - 1);
+		for (unsigned i = 0; i < threadCount; ++i)
+			mWorkers.emplace_back(&MaterialLibrary::workerLoop, this);
+	}
+
+	mJobs.push_back(std::move(job));
+	mJobReady.notify_one();
+}
+
+void MaterialLibrary::workerLoop()
+{
+	for (;;)
+	{
+		std::function<void()> job;
+		{
+			std::unique_lock<std::mutex> lock(mMutex);
+			mJobReady.wait(lock, [this] { return mStopping || !mJobs.empty(); });
+			if (mStopping)
+				return;
+
+			job = std::move(mJobs.front());
+			mJobs.pop_front();
+		}
+
+		job();
+	}
+}
+
+bool MaterialLibrary::loadLibrary(const std::string& path)
+{
+	if (!std::ifstream(path))
+		return false;
+
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	mLibraries.emplace_back(new PendingLibrary());
+	PendingLibrary* library = mLibraries.back().get();
+	library->baseDir = getDirectory(path);
+
+	++mPendingLibraryJobs;
+	enqueue([this, library, path] { parseLibrary(library, path); });
+
+	return true;
+}
+
+void MaterialLibrary::parseLibrary(PendingLibrary* library, const std::string& path)
+{
+	std::ifstream file(path, std::ios::binary);
+	std::shared_ptr<std::string> text = std::make_shared<std::string>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+	/*
+	Cut the file into about one piece per worker, each piece starting at a newmtl line.
+	LoadMtl only carries state from one newmtl to the next, so the pieces parse independently.
+	*/
+	std::vector<size_t> cuts(1, 0);
+	size_t pieceSize = std::max(MIN_CHUNK_SIZE, text->size() / std::max<size_t>(1, mWorkers.size()) + 1);
+	for (size_t pos = pieceSize; pos < text->size(); )
+	{
+		size_t line = text->find("\nnewmtl", pos);
+		if (line == std::string::npos)
+			break;
+
+		size_t next = line + 1;
+		char after = next + 6 < text->size() ? (*text)[next + 6] : '\0';
+		if (after == ' ' || after == '\t')
+		{
+			cuts.push_back(next);
+			pos = next + pieceSize;
+		}
+		else
+			pos = next;
+	}
+	cuts.push_back(text->size());
+
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+
+		size_t pieces = cuts.size() - 1;
+		library->chunks.resize(pieces);
+		library->warnings.resize(pieces);
+
+		// The first piece is parsed right here, the others by whichever workers are free.
+		mPendingLibraryJobs += static_cast<uint32_t>(pieces - 1);
+		for (size_t i = 1; i < pieces; ++i)
+			enqueue([this, library, i, text, cuts] { parseChunk(library, i, text, cuts[i], cuts[i + 1]); });
+	}
+
+	parseChunk(library, 0, text, cuts[0], cuts[1]);
+}
+
+void MaterialLibrary::parseChunk(PendingLibrary* library, size_t chunk, std::shared_ptr<std::string> text, size_t begin, size_t end)
+{
+	std::vector<tinyobj::material_t> materials;
+	std::map<std::string, int> materialMap; // Only this piece's names, LoadMtl wants one.
+	std::string warn, err;
+
+	std::istringstream stream(text->substr(begin, end - begin));
+	tinyobj::LoadMtl(&materialMap, &materials, &stream, &warn, &err);
+
+	// LoadMtl always flushes a last material, even if the piece had nothing before its first newmtl.
+	materials.erase(std::remove_if(materials.begin(), materials.end(),
+		[](const tinyobj::material_t& material) { return material.name.empty(); }), materials.end());
+
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	prefetchTextures(materials, library->baseDir);
+	library->chunks[chunk].swap(materials);
+	library->warnings[chunk] = warn + err;
+
+	finishLibraryJob();
+}
+
+void MaterialLibrary::finishLibraryJob()
+{
+	if (--mPendingLibraryJobs == 0)
+		mProgress.notify_all();
+}
+
+// Texture name fields of material_t in TextureMap order.
+static const std::string tinyobj::material_t::* const TEXTURE_NAMES[] =
+{
+	&tinyobj::material_t::ambient_texname,
+	&tinyobj::material_t::diffuse_texname,
+	&tinyobj::material_t::specular_texname,
+	&tinyobj::material_t::specular_highlight_texname,
+	&tinyobj::material_t::bump_texname,
+	&tinyobj::material_t::displacement_texname,
+	&tinyobj::material_t::alpha_texname,
+	&tinyobj::material_t::reflection_texname,
+	&tinyobj::material_t::roughness_texname,
+	&tinyobj::material_t::metallic_texname,
+	&tinyobj::material_t::sheen_texname,
+	&tinyobj::material_t::emissive_texname,
+	&tinyobj::material_t::normal_texname
+};
+
+static const tinyobj::texture_option_t tinyobj::material_t::* const TEXTURE_OPTIONS[] =
+{
+	&tinyobj::material_t::ambient_texopt,
+	&tinyobj::material_t::diffuse_texopt,
+	&tinyobj::material_t::specular_texopt,
+	&tinyobj::material_t::specular_highlight_texopt,
+	&tinyobj::material_t::bump_texopt,
+	&tinyobj::material_t::displacement_texopt,
+	&tinyobj::material_t::alpha_texopt,
+	&tinyobj::material_t::reflection_texopt,
+	&tinyobj::material_t::roughness_texopt,
+	&tinyobj::material_t::metallic_texopt,
+	&tinyobj::material_t::sheen_texopt,
+	&tinyobj::material_t::emissive_texopt,
+	&tinyobj::material_t::normal_texopt
+};
+
+static_assert(sizeof(TEXTURE_NAMES) / sizeof(TEXTURE_NAMES[0]) == static_cast<size_t>(TextureMap::Count), "one name per texture map");
+static_assert(sizeof(TEXTURE_OPTIONS) / sizeof(TEXTURE_OPTIONS[0]) == static_cast<size_t>(TextureMap::Count), "one option set per texture map");
+
+void MaterialLibrary::prefetchTextures(const std::vector<tinyobj::material_t>& materials, const std::string& baseDir)
+{
+	for (const tinyobj::material_t& material : materials)
+	{
+		for (auto name : TEXTURE_NAMES)
+		{
+			if (!(material.*name).empty())
+				requestTextureLocked(baseDir + material.*name);
+		}
+	}
+}
+
+uint32_t MaterialLibrary::requestTexture(const std::string& path)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	return requestTextureLocked(path);
+}
+
+uint32_t MaterialLibrary::requestTextureLocked(const std::string& path)
+{
+	uint32_t id = mTextureNames.intern(path);
+	if (id < mTextures.size())
+		return id;
+
+	mTextures.emplace_back(new TextureSlot());
+	TextureSlot* slot = mTextures.back().get();
+	slot->texture.path = path;
+	queueDecode(slot);
+
+	return id;
+}
+
+void MaterialLibrary::queueDecode(TextureSlot* slot)
+{
+	enqueue([this, slot]
+	{
+		DecodedTexture decoded;
+		decoded.path = slot->texture.path;
+		decodeTexture(decoded);
+
+		std::lock_guard<std::mutex> lock(mMutex);
+		slot->texture = std::move(decoded);
+		slot->done = true;
+		mProgress.notify_all();
+	});
+}
+
+void MaterialLibrary::decodeTexture(DecodedTexture& texture) const
+{
+	// Forced to 4 channels, see TextureResidency::upload.
+	const char* path = texture.path.c_str();
+	int width = 0, height = 0, channels = 0;
+
+	// The header gives the size, so the allocator's memory can be handed to stb before the pixels are decoded.
+	if (mAllocate && stbi_info(path, &width, &height, &channels))
+	{
+		texture.pixels = mAllocate(width, height, texture.rowPitch, texture.memory);
+		if (texture.pixels)
+		{
+			texture.width = width;
+			texture.height = height;
+			if (!stbi_load_into(path, texture.pixels, width, height, static_cast<int>(texture.rowPitch), &channels, STBI_rgb_alpha))
+				freeTexture(texture);
+			return;
+		}
+	}
+
+	texture.pixels = stbi_load(path, &texture.width, &texture.height, &channels, STBI_rgb_alpha);
+	texture.rowPitch = static_cast<size_t>(texture.width) * 4;
+}
+
+void MaterialLibrary::freeTexture(DecodedTexture& texture) const
+{
+	if (texture.memory)
+		mFree(texture.memory);
+	else
+		stbi_image_free(texture.pixels);
+
+	texture.pixels = nullptr;
+	texture.memory = nullptr;
+}
+
+void MaterialLibrary::addMaterials(const std::vector<tinyobj::material_t>& materials, const std::string& baseDir)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	for (const tinyobj::material_t& material : materials)
+		addMaterialLocked(material, baseDir);
+}
+
+uint32_t MaterialLibrary::internMaterialName(const std::string& name)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	return mMaterialNames.intern(name);
+}
+
+template<typename T>
+static void appendBytes(std::string& key, const T& value)
+{
+	key.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+static void appendString(std::string& key, const std::string& value)
+{
+	appendBytes(key, value.size());
+	key += value;
+}
+
+void MaterialLibrary::addMaterialLocked(const tinyobj::material_t& material, const std::string& baseDir)
+{
+	++mParsedMaterials;
+
+	std::array<uint32_t, static_cast<size_t>(TextureMap::Count)> textures;
+	for (size_t i = 0; i < textures.size(); ++i)
+	{
+		const std::string& name = material.*TEXTURE_NAMES[i];
+		textures[i] = name.empty() ? StringTable::INVALID : requestTextureLocked(baseDir + name);
+	}
+
+	/*
+	Two materials are the same if everything but the name matches. Serializing all of it into a key
+	turns deduplication into interning that key. Textures go in as ids, so the same file reached through
+	different .mtl directories still counts as the same texture.
+	*/
+	std::string key;
+	key.reserve(256);
+	for (const tinyobj::real_t* values : { material.ambient, material.diffuse, material.specular, material.transmittance, material.emission })
+		key.append(reinterpret_cast<const char*>(values), 3 * sizeof(tinyobj::real_t));
+	for (tinyobj::real_t value : { material.shininess, material.ior, material.dissolve, material.roughness, material.metallic, material.sheen,
+		material.clearcoat_thickness, material.clearcoat_roughness, material.anisotropy, material.anisotropy_rotation })
+		appendBytes(key, value);
+	appendBytes(key, material.illum);
+
+	for (size_t i = 0; i < textures.size(); ++i)
+	{
+		appendBytes(key, textures[i]);
+		if (textures[i] == StringTable::INVALID)
+			continue;
+
+		const tinyobj::texture_option_t& option = material.*TEXTURE_OPTIONS[i];
+		appendBytes(key, option.type);
+		for (tinyobj::real_t value : { option.sharpness, option.brightness, option.contrast, option.bump_multiplier })
+			appendBytes(key, value);
+		key.append(reinterpret_cast<const char*>(option.origin_offset), sizeof(option.origin_offset));
+		key.append(reinterpret_cast<const char*>(option.scale), sizeof(option.scale));
+		key.append(reinterpret_cast<const char*>(option.turbulence), sizeof(option.turbulence));
+		key += option.clamp ? '1' : '0';
+		key += option.imfchan;
+		key += option.blendu ? '1' : '0';
+		key += option.blendv ? '1' : '0';
+		appendString(key, option.colorspace);
+	}
+
+	for (const auto& parameter : material.unknown_parameter)
+	{
+		appendString(key, parameter.first);
+		appendString(key, parameter.second);
+	}
+
+	uint32_t index = mMaterialKeys.intern(key);
+	if (index == mMaterials.size())
+	{
+		Material unique;
+		unique.params = material;
+		unique.textures = textures;
+		mMaterials.push_back(unique);
+	}
+
+	// Like tinyobj's material map, the first definition of a name wins.
+	uint32_t nameId = mMaterialNames.intern(material.name);
+	if (nameId >= mNameToMaterial.size())
+		mNameToMaterial.resize(nameId + 1, StringTable::INVALID);
+	if (mNameToMaterial[nameId] == StringTable::INVALID)
+		mNameToMaterial[nameId] = index;
+}
+
+void MaterialLibrary::resolve()
+{
+	std::unique_lock<std::mutex> lock(mMutex);
+	mProgress.wait(lock, [this] { return mPendingLibraryJobs == 0; });
+
+	size_t files = mLibraries.size();
+	for (auto& library : mLibraries)
+	{
+		for (size_t i = 0; i < library->chunks.size(); ++i)
+		{
+			for (const tinyobj::material_t& material : library->chunks[i])
+				addMaterialLocked(material, library->baseDir);
+
+			if (!library->warnings[i].empty())
+				std::cout << library->warnings[i];
+		}
+	}
+	mLibraries.clear();
+
+	if (files > 0)
+		std::cout << "materials: " << mParsedMaterials << " parsed from " << files << " files, " << mMaterials.size() << " unique, "
+			<< mTextures.size() << " textures requested" << std::endl;
+}
+
+uint32_t MaterialLibrary::findMaterial(uint32_t nameId) const
+{
+	return nameId < mNameToMaterial.size() ? mNameToMaterial[nameId] : StringTable::INVALID;
+}
+
+const DecodedTexture& MaterialLibrary::waitForTexture(uint32_t id)
+{
+	std::unique_lock<std::mutex> lock(mMutex);
+	TextureSlot* slot = mTextures[id].get();
+	mProgress.wait(lock, [slot] { return slot->done; });
+
+	return slot->texture;
+}
+
+bool MaterialLibrary::isTextureReady(uint32_t id)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	return mTextures[id]->done;
+}
+
+void MaterialLibrary::releaseTexture(uint32_t id)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	TextureSlot* slot = mTextures[id].get();
+	if (slot->done)
+		freeTexture(slot->texture);
+}
+
+void MaterialLibrary::reloadTexture(uint32_t id)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	TextureSlot* slot = mTextures[id].get();
+	if (!slot->done || slot->texture.pixels)
+		return;
+
+	slot->done = false;
+	queueDecode(slot);
+}
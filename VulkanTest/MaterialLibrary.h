@@ -0,0 +1,204 @@
+/*
+MaterialLibrary.h
+Materials and the textures they use, loaded in the background while the geometry is parsed.
+
+- .mtl files are read on worker threads. Large files are cut at newmtl lines and the pieces are parsed in parallel.
+- Material and texture names are interned in flat open addressing tables (StringTable) instead of std::map lookups.
+- Every texture map is queued for decoding as soon as a parsed material mentions it,
+  so the texture I/O overlaps with the .obj parsing instead of starting after it.
+- With a texture allocator the pixels are decoded straight into its memory (stbi_load_into), e.g. a mapped
+  staging buffer, instead of into a buffer stb allocates that then has to be copied.
+- Materials that only differ by name are collapsed into one.
+*/
+
+#ifndef MATERIAL_LIBRARY_H
+#define MATERIAL_LIBRARY_H
+
+#include <tiny_obj_loader.h>
+
+#include <array>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Assigns every distinct string a dense id, 0, 1, 2... Linear probing over a power of two table of ids.
+class StringTable
+{
+public:
+	static constexpr uint32_t INVALID = ~0u;
+
+	uint32_t intern(const std::string& str); // Adds the string if it's new.
+	uint32_t find(const std::string& str) const; // INVALID if it was never interned.
+	const std::string& get(uint32_t id) const { return mStrings[id]; }
+	uint32_t size() const { return static_cast<uint32_t>(mStrings.size()); }
+	void clear();
+
+private:
+	static uint64_t hash(const std::string& str);
+	size_t findSlot(const std::string& str, uint64_t strHash) const;
+	void grow();
+
+	std::vector<uint32_t> mSlots; // id + 1, 0 for an empty slot.
+	std::vector<uint64_t> mHashes; // Per id, so growing doesn't rehash the strings.
+	std::vector<std::string> mStrings;
+};
+
+// Every texture map a material_t can reference.
+enum class TextureMap
+{
+	Ambient,           // map_Ka
+	Diffuse,           // map_Kd
+	Specular,          // map_Ks
+	SpecularHighlight, // map_Ns
+	Bump,              // map_bump, bump
+	Displacement,      // disp
+	Alpha,             // map_d
+	Reflection,        // refl
+	Roughness,         // map_Pr
+	Metallic,          // map_Pm
+	Sheen,             // map_Ps
+	Emissive,          // map_Ke
+	Normal,            // norm
+	Count
+};
+
+struct Material
+{
+	tinyobj::material_t params; // As parsed, named after the first material that had these values.
+	std::array<uint32_t, static_cast<size_t>(TextureMap::Count)> textures; // Texture ids, StringTable::INVALID where there's no map.
+};
+
+struct DecodedTexture
+{
+	std::string path;
+	int width = 0;
+	int height = 0;
+	unsigned char* pixels = nullptr; // RGBA8, nullptr if the file couldn't be decoded (or was released).
+	size_t rowPitch = 0; // Bytes from one row of pixels to the next.
+	void* memory = nullptr; // What the texture allocator returned the pixels with, nullptr if stb allocated them.
+};
+
+class MaterialLibrary
+{
+public:
+	// Hands the mtllib files of an .obj over to loadLibrary, relative to baseDir.
+	class Reader : public tinyobj::MaterialReader
+	{
+	public:
+		Reader(MaterialLibrary& library, const std::string& baseDir) : mLibrary(library), mBaseDir(baseDir) {}
+
+		// Returns as soon as parsing has started, materials and matMap stay empty.
+		bool operator()(const std::string& matId, std::vector<tinyobj::material_t>* materials, std::map<std::string, int>* matMap,
+			std::string* warn, std::string* err) override;
+
+	private:
+		MaterialLibrary& mLibrary;
+		std::string mBaseDir;
+	};
+
+	/*
+	Memory for a width x height RGBA8 texture, called on a worker thread once the file's header has been read.
+	Returns where row 0 goes, rowPitch (at least width * 4) and a handle that is passed to the FreeFunction
+	when the texture is released. Returning nullptr falls back to stb's own allocation.
+	*/
+	typedef std::function<unsigned char*(int width, int height, size_t& rowPitch, void*& memory)> AllocateFunction;
+	typedef std::function<void(void* memory)> FreeFunction;
+
+	~MaterialLibrary();
+
+	// Before the first texture is requested.
+	void setTextureAllocator(AllocateFunction allocate, FreeFunction free);
+
+	// Starts parsing an .mtl file in the background. Texture paths in it are relative to its directory. False if it can't be opened.
+	bool loadLibrary(const std::string& path);
+
+	// Materials something else already parsed (tinyobj::LoadObj). Their textures are looked up in baseDir.
+	void addMaterials(const std::vector<tinyobj::material_t>& materials, const std::string& baseDir);
+
+	// Queues a texture for decoding. Asking for the same path again returns the same id without decoding it twice.
+	uint32_t requestTexture(const std::string& path);
+
+	// Name id for a usemtl line. The material it refers to may not have been parsed yet.
+	uint32_t internMaterialName(const std::string& name);
+
+	// Waits for the .mtl files still being parsed, then deduplicates the new materials. Textures may still be decoding.
+	void resolve();
+
+	// Index into getMaterials() for a name id, INVALID if no material has that name. Only valid after resolve().
+	uint32_t findMaterial(uint32_t nameId) const;
+	const std::vector<Material>& getMaterials() const { return mMaterials; }
+
+	// Blocks until the texture is decoded.
+	const DecodedTexture& waitForTexture(uint32_t id);
+	// Whether waitForTexture would return right away.
+	bool isTextureReady(uint32_t id);
+	// Frees the pixels once they are uploaded.
+	void releaseTexture(uint32_t id);
+	// Decodes a released texture again, e.g. after it was evicted from device memory. Does nothing while its pixels are still there.
+	void reloadTexture(uint32_t id);
+
+	// Stops the workers, dropping queued work, and releases every texture. The destructor does this too, call it
+	// earlier when the allocator's memory has to be gone before the library is (e.g. before destroying the device).
+	void shutdown();
+
+	static std::string getDirectory(const std::string& path); // Including the trailing separator, empty for a bare file name.
+
+private:
+	// Below this size an .mtl file is parsed in one piece.
+	static constexpr size_t MIN_CHUNK_SIZE = 64 * 1024;
+
+	// An .mtl file, one result per piece so the materials come out in file order no matter which piece finishes first.
+	struct PendingLibrary
+	{
+		std::string baseDir;
+		std::vector<std::vector<tinyobj::material_t>> chunks;
+		std::vector<std::string> warnings;
+	};
+
+	struct TextureSlot
+	{
+		DecodedTexture texture;
+		bool done = false;
+	};
+
+	void enqueue(std::function<void()> job); // mMutex held.
+	void workerLoop();
+	void parseLibrary(PendingLibrary* library, const std::string& path);
+	void parseChunk(PendingLibrary* library, size_t chunk, std::shared_ptr<std::string> text, size_t begin, size_t end);
+	void finishLibraryJob();
+	uint32_t requestTextureLocked(const std::string& path);
+	void queueDecode(TextureSlot* slot); // mMutex held.
+	void decodeTexture(DecodedTexture& texture) const; // Fills in everything but the path, no lock needed.
+	void freeTexture(DecodedTexture& texture) const;
+	void prefetchTextures(const std::vector<tinyobj::material_t>& materials, const std::string& baseDir); // mMutex held.
+	void addMaterialLocked(const tinyobj::material_t& material, const std::string& baseDir);
+
+	std::mutex mMutex; // Guards everything below.
+	std::condition_variable mJobReady;
+	std::condition_variable mProgress; // A library job or a texture finished.
+	std::deque<std::function<void()>> mJobs;
+	std::vector<std::thread> mWorkers; // Started with the first job.
+	bool mStopping = false;
+
+	AllocateFunction mAllocate;
+	FreeFunction mFree;
+
+	std::vector<std::unique_ptr<PendingLibrary>> mLibraries; // Parsed or being parsed, not resolved yet.
+	uint32_t mPendingLibraryJobs = 0;
+
+	StringTable mTextureNames; // Texture id = index in mTextures.
+	std::vector<std::unique_ptr<TextureSlot>> mTextures;
+
+	StringTable mMaterialNames;
+	std::vector<uint32_t> mNameToMaterial; // Per name id.
+	StringTable mMaterialKeys; // Everything but the name, serialized. Key id = index in mMaterials.
+	std::vector<Material> mMaterials;
+	uint32_t mParsedMaterials = 0;
+};
+
+#endif // !MATERIAL_LIBRARY_H
@@ -0,0 +1,591 @@
+/*
+MeshRegistry.cpp
+definitions for the functions in MeshRegistry.h
+*/
+
+#include "MeshRegistry.h"
+#include "DemoApp.h" // Vertex
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+
+static const VkBufferUsageFlags VERTEX_ARENA_USAGE = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
+static const VkBufferUsageFlags INDEX_ARENA_USAGE = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT;
+static const VkBufferUsageFlags MESHLET_BUFFER_USAGE = VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+
+void MeshRegistry::FreeList::reset(uint32_t capacity, uint32_t used)
+{
+	mRanges.clear();
+	if (used < capacity)
+		mRanges.push_back({ used, capacity - used });
+}
+
+bool MeshRegistry::FreeList::allocate(uint32_t count, uint32_t& offset)
+{
+	for (size_t i = 0; i < mRanges.size(); ++i)
+	{
+		Range& range = mRanges[i];
+		if (range.count < count)
+			continue;
+
+		offset = range.offset;
+		range.offset += count;
+		range.count -= count;
+		if (range.count == 0)
+			mRanges.erase(mRanges.begin() + i);
+		return true;
+	}
+
+	return false;
+}
+
+void MeshRegistry::FreeList::release(uint32_t offset, uint32_t count)
+{
+	auto next = std::lower_bound(mRanges.begin(), mRanges.end(), offset, [](const Range& range, uint32_t value) { return range.offset < value; });
+
+	// Grow the free range right before it, the one right after it, or both into one.
+	bool mergePrevious = next != mRanges.begin() && (next - 1)->offset + (next - 1)->count == offset;
+	bool mergeNext = next != mRanges.end() && offset + count == next->offset;
+
+	if (mergePrevious && mergeNext)
+	{
+		(next - 1)->count += count + next->count;
+		mRanges.erase(next);
+	}
+	else if (mergePrevious)
+		(next - 1)->count += count;
+	else if (mergeNext)
+	{
+		next->offset = offset;
+		next->count += count;
+	}
+	else
+		mRanges.insert(next, { offset, count });
+}
+
+void MeshRegistry::init(VkDevice device, VkPhysicalDevice physDevice, VkQueue queue, uint32_t queueFamily, uint32_t vertexCapacity, uint32_t indexCapacity)
+{
+	mDevice = device;
+	mPhysDevice = physDevice;
+	mQueue = queue;
+
+	VkCommandPoolCreateInfo poolInfo = {};
+	poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+	poolInfo.queueFamilyIndex = queueFamily;
+	poolInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+
+	if (vkCreateCommandPool(mDevice, &poolInfo, nullptr, &mCommandPool) != VK_SUCCESS)
+		throw std::runtime_error("failed to create mesh registry command pool!");
+
+	VkFenceCreateInfo fenceInfo = {};
+	fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+	if (vkCreateFence(mDevice, &fenceInfo, nullptr, &mFence) != VK_SUCCESS)
+		throw std::runtime_error("failed to create mesh registry fence!");
+
+	rebuild(std::max(vertexCapacity, 1u), std::max(indexCapacity, 1u));
+}
+
+void MeshRegistry::destroy()
+{
+	if (mDevice == VK_NULL_HANDLE)
+		return;
+
+	for (Arena* arena : { &mVertices, &mPositions, &mIndices, &mMeshlets })
+		destroyArena(*arena);
+
+	vkDestroyFence(mDevice, mFence, nullptr);
+	vkDestroyCommandPool(mDevice, mCommandPool, nullptr);
+
+	mMeshes.clear();
+	mLive.clear();
+	mFreeHandles.clear();
+	mVertexCapacity = mIndexCapacity = 0;
+	mUsedVertices = mUsedIndices = 0;
+	mFence = VK_NULL_HANDLE;
+	mCommandPool = VK_NULL_HANDLE;
+	mDevice = VK_NULL_HANDLE;
+}
+
+MeshRegistry::MeshHandle MeshRegistry::add(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices, float radius)
+{
+	if (vertices.empty() || indices.empty())
+		throw std::runtime_error("failed to add an empty mesh!");
+
+	MeshRecord record;
+	record.vertexCount = static_cast<uint32_t>(vertices.size());
+	record.indexCount = static_cast<uint32_t>(indices.size());
+	record.radius = radius;
+	allocate(record);
+
+	// Vertices, positions and indices one after the other in a single staging buffer.
+	VkDeviceSize vertexSize = vertices.size() * sizeof(Vertex);
+	VkDeviceSize positionSize = vertices.size() * sizeof(glm::vec3);
+	VkDeviceSize indexSize = indices.size() * sizeof(uint32_t);
+
+	Arena staging;
+	createArena(staging, vertexSize + positionSize + indexSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+		VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+	void* data;
+	vkMapMemory(mDevice, staging.memory, 0, VK_WHOLE_SIZE, 0, &data);
+	char* bytes = static_cast<char*>(data);
+	memcpy(bytes, vertices.data(), vertexSize);
+	glm::vec3* positions = reinterpret_cast<glm::vec3*>(bytes + vertexSize);
+	for (size_t i = 0; i < vertices.size(); ++i)
+		positions[i] = vertices[i].pos;
+	memcpy(bytes + vertexSize + positionSize, indices.data(), indexSize);
+	vkUnmapMemory(mDevice, staging.memory);
+
+	VkCommandBuffer commandBuffer = beginCommands();
+
+	VkBufferCopy region = {};
+	region.dstOffset = record.vertexOffset * sizeof(Vertex);
+	region.size = vertexSize;
+	vkCmdCopyBuffer(commandBuffer, staging.buffer, mVertices.buffer, 1, &region);
+
+	region.srcOffset = vertexSize;
+	region.dstOffset = record.vertexOffset * sizeof(glm::vec3);
+	region.size = positionSize;
+	vkCmdCopyBuffer(commandBuffer, staging.buffer, mPositions.buffer, 1, &region);
+
+	region.srcOffset = vertexSize + positionSize;
+	region.dstOffset = record.firstIndex * sizeof(uint32_t);
+	region.size = indexSize;
+	vkCmdCopyBuffer(commandBuffer, staging.buffer, mIndices.buffer, 1, &region);
+
+	submitCommands(commandBuffer);
+	destroyArena(staging);
+
+	return insert(record);
+}
+
+MeshRegistry::MeshHandle MeshRegistry::add(StreamedMesh& mesh)
+{
+	if (mesh.vertexCount == 0 || mesh.indexCount == 0)
+		throw std::runtime_error("failed to add an empty mesh!");
+
+	MeshRecord record;
+	record.vertexCount = mesh.vertexCount;
+	record.indexCount = mesh.indexCount;
+	record.radius = mesh.radius;
+	record.materialRanges = mesh.materialRanges;
+	allocate(record);
+
+	// Straight from the streamer's buffers, the mesh never goes back through host memory.
+	VkCommandBuffer commandBuffer = beginCommands();
+
+	VkBufferCopy region = {};
+	region.dstOffset = record.vertexOffset * sizeof(Vertex);
+	region.size = mesh.vertexCount * sizeof(Vertex);
+	vkCmdCopyBuffer(commandBuffer, mesh.vertexBuffer, mVertices.buffer, 1, &region);
+
+	region.dstOffset = record.vertexOffset * sizeof(glm::vec3);
+	region.size = mesh.vertexCount * sizeof(glm::vec3);
+	vkCmdCopyBuffer(commandBuffer, mesh.positionBuffer, mPositions.buffer, 1, &region);
+
+	region.dstOffset = record.firstIndex * sizeof(uint32_t);
+	region.size = mesh.indexCount * sizeof(uint32_t);
+	vkCmdCopyBuffer(commandBuffer, mesh.indexBuffer, mIndices.buffer, 1, &region);
+
+	submitCommands(commandBuffer);
+
+	vkDestroyBuffer(mDevice, mesh.vertexBuffer, nullptr);
+	vkFreeMemory(mDevice, mesh.vertexBufferMemory, nullptr);
+	vkDestroyBuffer(mDevice, mesh.positionBuffer, nullptr);
+	vkFreeMemory(mDevice, mesh.positionBufferMemory, nullptr);
+	vkDestroyBuffer(mDevice, mesh.indexBuffer, nullptr);
+	vkFreeMemory(mDevice, mesh.indexBufferMemory, nullptr);
+	mesh = StreamedMesh();
+
+	return insert(record);
+}
+
+void MeshRegistry::remove(MeshHandle mesh)
+{
+	if (mesh >= mMeshes.size() || !mLive[mesh])
+		throw std::runtime_error("failed to remove mesh, invalid handle!");
+
+	MeshRecord& record = mMeshes[mesh];
+	mFreeVertices.release(static_cast<uint32_t>(record.vertexOffset), record.vertexCount);
+	mFreeIndices.release(record.firstIndex, record.indexCount);
+	mUsedVertices -= record.vertexCount;
+	mUsedIndices -= record.indexCount;
+
+	record = MeshRecord();
+	mLive[mesh] = false;
+	mFreeHandles.push_back(mesh);
+}
+
+void MeshRegistry::compact()
+{
+	rebuild(mVertexCapacity, mIndexCapacity);
+}
+
+void MeshRegistry::buildMeshlets(MeshHandle mesh)
+{
+	if (mesh >= mMeshes.size() || !mLive[mesh])
+		throw std::runtime_error("failed to build meshlets, invalid handle!");
+
+	MeshRecord& record = mMeshes[mesh];
+	VkDeviceSize positionSize = record.vertexCount * sizeof(glm::vec3);
+	VkDeviceSize indexSize = record.indexCount * sizeof(uint32_t);
+
+	// Positions then indices, read back into one staging buffer. The reordered indices go back out through it.
+	Arena staging;
+	createArena(staging, positionSize + indexSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+		VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+	VkCommandBuffer commandBuffer = beginCommands();
+
+	VkBufferCopy region = {};
+	region.srcOffset = record.vertexOffset * sizeof(glm::vec3);
+	region.size = positionSize;
+	vkCmdCopyBuffer(commandBuffer, mPositions.buffer, staging.buffer, 1, &region);
+
+	region.srcOffset = record.firstIndex * sizeof(uint32_t);
+	region.dstOffset = positionSize;
+	region.size = indexSize;
+	vkCmdCopyBuffer(commandBuffer, mIndices.buffer, staging.buffer, 1, &region);
+
+	VkMemoryBarrier barrier = {};
+	barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+	barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+	barrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+	vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+
+	submitCommands(commandBuffer);
+
+	void* data;
+	vkMapMemory(mDevice, staging.memory, 0, VK_WHOLE_SIZE, 0, &data);
+	char* bytes = static_cast<char*>(data);
+	std::vector<float> positions(record.vertexCount * 3);
+	std::vector<uint32_t> indices(record.indexCount);
+	memcpy(positions.data(), bytes, positionSize);
+	memcpy(indices.data(), bytes + positionSize, indexSize);
+
+	record.meshlets = ::buildMeshlets(positions.data(), record.vertexCount, indices);
+
+	memcpy(bytes + positionSize, indices.data(), indexSize);
+	vkUnmapMemory(mDevice, staging.memory);
+
+	commandBuffer = beginCommands();
+
+	region.srcOffset = positionSize;
+	region.dstOffset = record.firstIndex * sizeof(uint32_t);
+	region.size = indexSize;
+	vkCmdCopyBuffer(commandBuffer, staging.buffer, mIndices.buffer, 1, &region);
+
+	submitCommands(commandBuffer);
+	destroyArena(staging);
+
+	uploadMeshlets();
+}
+
+VkDrawIndexedIndirectCommand MeshRegistry::getDrawCommand(MeshHandle mesh, uint32_t instanceCount, uint32_t firstInstance) const
+{
+	const MeshRecord& record = mMeshes[mesh];
+
+	VkDrawIndexedIndirectCommand draw = {};
+	draw.indexCount = record.indexCount;
+	draw.instanceCount = instanceCount;
+	draw.firstIndex = record.firstIndex;
+	draw.vertexOffset = record.vertexOffset;
+	draw.firstInstance = firstInstance;
+	return draw;
+}
+
+void MeshRegistry::allocate(MeshRecord& record)
+{
+	uint32_t vertexOffset, firstIndex;
+	if (mFreeVertices.allocate(record.vertexCount, vertexOffset))
+	{
+		if (mFreeIndices.allocate(record.indexCount, firstIndex))
+		{
+			record.vertexOffset = static_cast<int32_t>(vertexOffset);
+			record.firstIndex = firstIndex;
+			mUsedVertices += record.vertexCount;
+			mUsedIndices += record.indexCount;
+			return;
+		}
+
+		mFreeVertices.release(vertexOffset, record.vertexCount);
+	}
+
+	/*
+	No free range is big enough. Pack the live meshes together, so all the free space ends up in one range at the end,
+	and double whichever arena still couldn't hold the new mesh. vertexOffset is signed, which caps the vertex arena.
+	*/
+	uint64_t vertexCapacity = mVertexCapacity;
+	uint64_t indexCapacity = mIndexCapacity;
+	while (vertexCapacity < static_cast<uint64_t>(mUsedVertices) + record.vertexCount)
+		vertexCapacity *= 2;
+	while (indexCapacity < static_cast<uint64_t>(mUsedIndices) + record.indexCount)
+		indexCapacity *= 2;
+
+	if (vertexCapacity > static_cast<uint64_t>(std::numeric_limits<int32_t>::max()) || indexCapacity > std::numeric_limits<uint32_t>::max())
+		throw std::runtime_error("failed to allocate mesh, the arenas are full!");
+
+	rebuild(static_cast<uint32_t>(vertexCapacity), static_cast<uint32_t>(indexCapacity));
+
+	// After the rebuild the one free range at the end is large enough.
+	mFreeVertices.allocate(record.vertexCount, vertexOffset);
+	mFreeIndices.allocate(record.indexCount, firstIndex);
+	record.vertexOffset = static_cast<int32_t>(vertexOffset);
+	record.firstIndex = firstIndex;
+	mUsedVertices += record.vertexCount;
+	mUsedIndices += record.indexCount;
+}
+
+void MeshRegistry::rebuild(uint32_t vertexCapacity, uint32_t indexCapacity)
+{
+	Arena vertices, positions, indices;
+	createArena(vertices, VkDeviceSize(vertexCapacity) * sizeof(Vertex), VERTEX_ARENA_USAGE, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+	createArena(positions, VkDeviceSize(vertexCapacity) * sizeof(glm::vec3), VERTEX_ARENA_USAGE, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+	createArena(indices, VkDeviceSize(indexCapacity) * sizeof(uint32_t), INDEX_ARENA_USAGE, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+	// Live meshes in the order they already had, each arena on its own, so the packing keeps meshes that were close together close.
+	std::vector<MeshHandle> live;
+	for (MeshHandle mesh = 0; mesh < mMeshes.size(); ++mesh)
+	{
+		if (mLive[mesh])
+			live.push_back(mesh);
+	}
+
+	std::vector<VkBufferCopy> vertexCopies, positionCopies, indexCopies;
+
+	std::sort(live.begin(), live.end(), [this](MeshHandle a, MeshHandle b) { return mMeshes[a].vertexOffset < mMeshes[b].vertexOffset; });
+	uint32_t vertexEnd = 0;
+	for (MeshHandle mesh : live)
+	{
+		MeshRecord& record = mMeshes[mesh];
+
+		VkBufferCopy region = {};
+		region.srcOffset = record.vertexOffset * sizeof(Vertex);
+		region.dstOffset = vertexEnd * sizeof(Vertex);
+		region.size = record.vertexCount * sizeof(Vertex);
+		vertexCopies.push_back(region);
+
+		region.srcOffset = record.vertexOffset * sizeof(glm::vec3);
+		region.dstOffset = vertexEnd * sizeof(glm::vec3);
+		region.size = record.vertexCount * sizeof(glm::vec3);
+		positionCopies.push_back(region);
+
+		record.vertexOffset = static_cast<int32_t>(vertexEnd);
+		vertexEnd += record.vertexCount;
+	}
+
+	std::sort(live.begin(), live.end(), [this](MeshHandle a, MeshHandle b) { return mMeshes[a].firstIndex < mMeshes[b].firstIndex; });
+	uint32_t indexEnd = 0;
+	for (MeshHandle mesh : live)
+	{
+		MeshRecord& record = mMeshes[mesh];
+
+		VkBufferCopy region = {};
+		region.srcOffset = record.firstIndex * sizeof(uint32_t);
+		region.dstOffset = indexEnd * sizeof(uint32_t);
+		region.size = record.indexCount * sizeof(uint32_t);
+		indexCopies.push_back(region);
+
+		record.firstIndex = indexEnd;
+		indexEnd += record.indexCount;
+	}
+
+	if (!live.empty())
+	{
+		VkCommandBuffer commandBuffer = beginCommands();
+		vkCmdCopyBuffer(commandBuffer, mVertices.buffer, vertices.buffer, static_cast<uint32_t>(vertexCopies.size()), vertexCopies.data());
+		vkCmdCopyBuffer(commandBuffer, mPositions.buffer, positions.buffer, static_cast<uint32_t>(positionCopies.size()), positionCopies.data());
+		vkCmdCopyBuffer(commandBuffer, mIndices.buffer, indices.buffer, static_cast<uint32_t>(indexCopies.size()), indexCopies.data());
+		submitCommands(commandBuffer);
+	}
+
+	bool grew = vertexCapacity != mVertexCapacity || indexCapacity != mIndexCapacity;
+	if (mVertices.buffer != VK_NULL_HANDLE)
+	{
+		std::cout << "mesh arenas " << (grew ? "grown" : "repacked") << ": " << live.size() << " meshes, "
+			<< vertexEnd << "/" << vertexCapacity << " vertices, " << indexEnd << "/" << indexCapacity << " indices" << std::endl;
+		++mGeneration;
+	}
+
+	destroyArena(mVertices);
+	destroyArena(mPositions);
+	destroyArena(mIndices);
+	mVertices = vertices;
+	mPositions = positions;
+	mIndices = indices;
+
+	mVertexCapacity = vertexCapacity;
+	mIndexCapacity = indexCapacity;
+	mFreeVertices.reset(vertexCapacity, vertexEnd);
+	mFreeIndices.reset(indexCapacity, indexEnd);
+}
+
+MeshRegistry::MeshHandle MeshRegistry::insert(MeshRecord& record)
+{
+	MeshHandle mesh;
+	if (!mFreeHandles.empty())
+	{
+		mesh = mFreeHandles.back();
+		mFreeHandles.pop_back();
+		mMeshes[mesh] = std::move(record);
+		mLive[mesh] = true;
+	}
+	else
+	{
+		mesh = static_cast<MeshHandle>(mMeshes.size());
+		mMeshes.push_back(std::move(record));
+		mLive.push_back(true);
+	}
+
+	return mesh;
+}
+
+void MeshRegistry::uploadMeshlets()
+{
+	std::vector<Meshlet> meshlets;
+	for (MeshHandle mesh = 0; mesh < mMeshes.size(); ++mesh)
+	{
+		if (!mLive[mesh])
+			continue;
+
+		MeshRecord& record = mMeshes[mesh];
+		record.firstMeshlet = static_cast<uint32_t>(meshlets.size());
+		meshlets.insert(meshlets.end(), record.meshlets.begin(), record.meshlets.end());
+	}
+
+	destroyArena(mMeshlets);
+	++mGeneration;
+	if (meshlets.empty())
+		return;
+
+	VkDeviceSize size = meshlets.size() * sizeof(Meshlet);
+
+	Arena staging;
+	createArena(staging, size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+	void* data;
+	vkMapMemory(mDevice, staging.memory, 0, VK_WHOLE_SIZE, 0, &data);
+	memcpy(data, meshlets.data(), size);
+	vkUnmapMemory(mDevice, staging.memory);
+
+	createArena(mMeshlets, size, MESHLET_BUFFER_USAGE, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+	VkCommandBuffer commandBuffer = beginCommands();
+
+	VkBufferCopy region = {};
+	region.size = size;
+	vkCmdCopyBuffer(commandBuffer, staging.buffer, mMeshlets.buffer, 1, &region);
+
+	submitCommands(commandBuffer);
+	destroyArena(staging);
+}
+
+void MeshRegistry::createArena(Arena& arena, VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties)
+{
+	VkBufferCreateInfo bufferInfo = {};
+	bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+	bufferInfo.size = size;
+	bufferInfo.usage = usage;
+	bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+	if (vkCreateBuffer(mDevice, &bufferInfo, nullptr, &arena.buffer) != VK_SUCCESS)
+		throw std::runtime_error("failed to create mesh arena!");
+
+	VkMemoryRequirements memRequirements;
+	vkGetBufferMemoryRequirements(mDevice, arena.buffer, &memRequirements);
+
+	VkMemoryAllocateInfo allocInfo = {};
+	allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+	allocInfo.allocationSize = memRequirements.size;
+	allocInfo.memoryTypeIndex = findMemoryType(memRequirements.memoryTypeBits, properties);
+
+	if (vkAllocateMemory(mDevice, &allocInfo, nullptr, &arena.memory) != VK_SUCCESS)
+	{
+		vkDestroyBuffer(mDevice, arena.buffer, nullptr);
+		arena.buffer = VK_NULL_HANDLE;
+		throw std::runtime_error("failed to allocate mesh arena memory!");
+	}
+
+	vkBindBufferMemory(mDevice, arena.buffer, arena.memory, 0);
+}
+
+void MeshRegistry::destroyArena(Arena& arena)
+{
+	if (arena.buffer != VK_NULL_HANDLE)
+	{
+		vkDestroyBuffer(mDevice, arena.buffer, nullptr);
+		vkFreeMemory(mDevice, arena.memory, nullptr);
+	}
+	arena = Arena();
+}
+
+VkCommandBuffer MeshRegistry::beginCommands()
+{
+	VkCommandBufferAllocateInfo allocInfo = {};
+	allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+	allocInfo.commandPool = mCommandPool;
+	allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+	allocInfo.commandBufferCount = 1;
+
+	VkCommandBuffer commandBuffer;
+	if (vkAllocateCommandBuffers(mDevice, &allocInfo, &commandBuffer) != VK_SUCCESS)
+		throw std::runtime_error("failed to allocate mesh registry command buffer!");
+
+	VkCommandBufferBeginInfo beginInfo = {};
+	beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+	beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+	vkBeginCommandBuffer(commandBuffer, &beginInfo);
+
+	// Earlier uploads (ours or the streamer's) are known to have finished, but their writes still have to be made visible to these copies.
+	VkMemoryBarrier barrier = {};
+	barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+	barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+	barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+	vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+
+	return commandBuffer;
+}
+
+void MeshRegistry::submitCommands(VkCommandBuffer commandBuffer)
+{
+	// The draws and the cluster culling in later submissions read what was just copied.
+	VkMemoryBarrier barrier = {};
+	barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+	barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+	barrier.dstAccessMask = VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDEX_READ_BIT | VK_ACCESS_SHADER_READ_BIT;
+	vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+		0, 1, &barrier, 0, nullptr, 0, nullptr);
+
+	vkEndCommandBuffer(commandBuffer);
+
+	VkSubmitInfo submitInfo = {};
+	submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+	submitInfo.commandBufferCount = 1;
+	submitInfo.pCommandBuffers = &commandBuffer;
+
+	if (vkQueueSubmit(mQueue, 1, &submitInfo, mFence) != VK_SUCCESS)
+		throw std::runtime_error("failed to submit mesh arena copies!");
+
+	vkWaitForFences(mDevice, 1, &mFence, VK_TRUE, std::numeric_limits<uint64_t>::max());
+	vkResetFences(mDevice, 1, &mFence);
+	vkFreeCommandBuffers(mDevice, mCommandPool, 1, &commandBuffer);
+}
+
+uint32_t MeshRegistry::findMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties)
+{
+	VkPhysicalDeviceMemoryProperties memProperties;
+	vkGetPhysicalDeviceMemoryProperties(mPhysDevice, &memProperties);
+
+	for (uint32_t i = 0; i < memProperties.memoryTypeCount; ++i)
+	{
+		if ((typeFilter & (1 << i)) &&
+			(memProperties.memoryTypes[i].propertyFlags & properties) == properties)
+			return i;
+	}
+
+	throw std::runtime_error("failed to find suitable memory type!");
+}
@@ -0,0 +1,141 @@
+/*
+MeshRegistry.h
+Every mesh of the scene packed into one vertex arena and one index arena.
+
+Each mesh gets a range of vertices and a range of indices in the shared device local buffers.
+Its indices stay relative to its first vertex, the draw adds vertexOffset, so a mesh can be moved
+around in the arenas without touching its indices. The draw passes bind the arenas once and then
+issue one vkCmdDrawIndexed (or one VkDrawIndexedIndirectCommand) per mesh.
+
+Meshes can be added and removed at any time. The free ranges of each arena are kept in a sorted
+free list and neighbours are merged when a range is given back. When a new mesh doesn't fit in any
+free range the live meshes are copied over into new buffers back to back, which squeezes out the holes,
+and the arenas double until the mesh fits.
+*/
+
+#ifndef MESH_REGISTRY_H
+#define MESH_REGISTRY_H
+
+#include <vulkan/vulkan.h>
+
+#include "MeshStreamer.h"
+#include "MeshletBuilder.h"
+
+#include <vector>
+
+struct Vertex;
+
+// Where a mesh lives in the arenas.
+struct MeshRecord
+{
+	uint32_t firstIndex = 0; // In the index arena.
+	uint32_t indexCount = 0;
+	int32_t vertexOffset = 0; // First vertex in the vertex and position arenas, added to every index.
+	uint32_t vertexCount = 0;
+	float radius = 0.f; // Bounding sphere radius around the origin.
+	std::vector<MeshMaterialRange> materialRanges; // firstIndex relative to the mesh.
+	std::vector<Meshlet> meshlets; // Empty until MeshRegistry::buildMeshlets. firstIndex relative to the mesh.
+	uint32_t firstMeshlet = 0; // In the meshlet buffer.
+};
+
+class MeshRegistry
+{
+public:
+	typedef uint32_t MeshHandle;
+
+	static const MeshHandle INVALID_MESH = ~0u;
+	static const uint32_t DEFAULT_VERTEX_CAPACITY = 256 * 1024;
+	static const uint32_t DEFAULT_INDEX_CAPACITY = 1024 * 1024;
+
+	// The copies are submitted to queue, which has to support transfers and belong to queueFamily.
+	void init(VkDevice device, VkPhysicalDevice physDevice, VkQueue queue, uint32_t queueFamily,
+		uint32_t vertexCapacity = DEFAULT_VERTEX_CAPACITY, uint32_t indexCapacity = DEFAULT_INDEX_CAPACITY);
+	void destroy();
+
+	/*
+	add, remove and compact change the arenas right away, so nothing that draws from them may be in flight.
+	The copies have finished when they return. Handles of removed meshes get reused.
+	*/
+	MeshHandle add(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices, float radius);
+	MeshHandle add(StreamedMesh& mesh); // Copies the mesh over and destroys its buffers.
+	void remove(MeshHandle mesh);
+	void compact(); // Moves the meshes back to back, leaving one free range at the end of each arena.
+
+	/*
+	Splits a mesh into meshlets, see MeshletBuilder.h. Its indices are read back, reordered and copied in again,
+	so the same rules as for add apply. The meshlets of all meshes live in one storage buffer, getMeshletBuffer().
+	*/
+	void buildMeshlets(MeshHandle mesh);
+
+	const MeshRecord& get(MeshHandle mesh) const { return mMeshes[mesh]; }
+	VkDrawIndexedIndirectCommand getDrawCommand(MeshHandle mesh, uint32_t instanceCount, uint32_t firstInstance = 0) const;
+
+	VkBuffer getVertexBuffer() const { return mVertices.buffer; }
+	VkBuffer getPositionBuffer() const { return mPositions.buffer; } // glm::vec3 per vertex, for the depth only passes.
+	VkBuffer getIndexBuffer() const { return mIndices.buffer; }
+	VkBuffer getMeshletBuffer() const { return mMeshlets.buffer; } // VK_NULL_HANDLE until a mesh has meshlets.
+
+	// Goes up every time the arena or meshlet buffers are replaced. Command buffers that bind them have to be recorded again.
+	uint32_t getGeneration() const { return mGeneration; }
+
+private:
+	struct Range
+	{
+		uint32_t offset;
+		uint32_t count;
+	};
+
+	// First fit over the free ranges of one arena, sorted by offset.
+	class FreeList
+	{
+	public:
+		void reset(uint32_t capacity, uint32_t used); // Everything from used up to capacity is free.
+		bool allocate(uint32_t count, uint32_t& offset);
+		void release(uint32_t offset, uint32_t count); // Merges with the neighbouring free ranges.
+
+	private:
+		std::vector<Range> mRanges;
+	};
+
+	struct Arena
+	{
+		VkBuffer buffer = VK_NULL_HANDLE;
+		VkDeviceMemory memory = VK_NULL_HANDLE;
+	};
+
+	// Takes the vertex and index ranges for a new mesh out of the free lists, repacking or growing the arenas if needed.
+	void allocate(MeshRecord& record);
+	void rebuild(uint32_t vertexCapacity, uint32_t indexCapacity);
+	MeshHandle insert(MeshRecord& record);
+	void uploadMeshlets(); // Gathers the meshlets of the live meshes into a new meshlet buffer.
+
+	void createArena(Arena& arena, VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties); // Also used for staging.
+	void destroyArena(Arena& arena);
+	VkCommandBuffer beginCommands();
+	void submitCommands(VkCommandBuffer commandBuffer); // Waits for the copies.
+	uint32_t findMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties);
+
+	VkDevice mDevice = VK_NULL_HANDLE;
+	VkPhysicalDevice mPhysDevice = VK_NULL_HANDLE;
+	VkQueue mQueue = VK_NULL_HANDLE;
+	VkCommandPool mCommandPool = VK_NULL_HANDLE;
+	VkFence mFence = VK_NULL_HANDLE;
+
+	Arena mVertices; // Vertex
+	Arena mPositions; // glm::vec3, same indexing as mVertices.
+	Arena mIndices; // uint32_t
+	Arena mMeshlets; // Meshlet
+	uint32_t mVertexCapacity = 0;
+	uint32_t mIndexCapacity = 0;
+	uint32_t mUsedVertices = 0;
+	uint32_t mUsedIndices = 0;
+	FreeList mFreeVertices;
+	FreeList mFreeIndices;
+
+	std::vector<MeshRecord> mMeshes; // Indexed by handle.
+	std::vector<bool> mLive;
+	std::vector<MeshHandle> mFreeHandles;
+	uint32_t mGeneration = 0;
+};
+
+#endif // !MESH_REGISTRY_H
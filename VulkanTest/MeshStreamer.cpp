@@ -0,0 +1,601 @@
+/*
+MeshStreamer.cpp
+definitions for the functions in MeshStreamer.h
+*/
+
+#include "MeshStreamer.h"
+#include "DemoApp.h" // Vertex
+#include "MaterialLibrary.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+
+// Guess used to split a segment between vertices and indices. A closed triangle mesh has about two triangles per vertex.
+static const uint32_t INDICES_PER_VERTEX = 6;
+
+// ifstream reads through a buffer this large instead of the default few KB.
+static const size_t READ_BUFFER_SIZE = 1024 * 1024;
+
+static double seconds(std::chrono::steady_clock::duration duration)
+{
+	return std::chrono::duration<double>(duration).count();
+}
+
+size_t MeshStreamer::CornerKeyHash::operator()(const CornerKey& key) const
+{
+	return (static_cast<size_t>(key.v) * 73856093u) ^ (static_cast<size_t>(key.vt) * 19349663u) ^ (static_cast<size_t>(key.vn) * 83492791u);
+}
+
+void MeshStreamer::init(VkDevice device, VkPhysicalDevice physDevice, VkQueue queue, uint32_t queueFamily, VkDeviceSize ringSize)
+{
+	mDevice = device;
+	mPhysDevice = physDevice;
+	mQueue = queue;
+
+	/*
+	Every segment is cut into three parts: vertices, positions and indices.
+	A segment is submitted as soon as either part is full, so the split only decides how full the other part gets.
+	*/
+	mSegmentSize = ringSize / SEGMENT_COUNT;
+	mSegmentVertices = static_cast<uint32_t>(mSegmentSize / (sizeof(Vertex) + sizeof(glm::vec3) + INDICES_PER_VERTEX * sizeof(uint32_t)));
+	mSegmentIndices = mSegmentVertices * INDICES_PER_VERTEX;
+	mPositionOffset = mSegmentVertices * sizeof(Vertex);
+	mIndexOffset = mPositionOffset + mSegmentVertices * sizeof(glm::vec3);
+
+	if (mSegmentVertices == 0)
+		throw std::runtime_error("mesh streaming ring is too small!");
+
+	VkBufferCreateInfo bufferInfo = {};
+	bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+	bufferInfo.size = mSegmentSize * SEGMENT_COUNT;
+	bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+	bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+	if (vkCreateBuffer(mDevice, &bufferInfo, nullptr, &mRing) != VK_SUCCESS)
+		throw std::runtime_error("failed to create mesh streaming ring!");
+
+	VkMemoryRequirements memRequirements;
+	vkGetBufferMemoryRequirements(mDevice, mRing, &memRequirements);
+
+	// Coherent, so what the parser writes is visible to the copies without flushing ranges.
+	VkMemoryAllocateInfo allocInfo = {};
+	allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+	allocInfo.allocationSize = memRequirements.size;
+	allocInfo.memoryTypeIndex = findMemoryType(memRequirements.memoryTypeBits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+	if (vkAllocateMemory(mDevice, &allocInfo, nullptr, &mRingMemory) != VK_SUCCESS)
+		throw std::runtime_error("failed to allocate mesh streaming ring memory!");
+
+	vkBindBufferMemory(mDevice, mRing, mRingMemory, 0);
+
+	// Stays mapped until destroy().
+	void* data;
+	if (vkMapMemory(mDevice, mRingMemory, 0, VK_WHOLE_SIZE, 0, &data) != VK_SUCCESS)
+		throw std::runtime_error("failed to map mesh streaming ring!");
+	mRingData = static_cast<char*>(data);
+
+	// Segment command buffers get re-recorded every time the ring wraps around.
+	VkCommandPoolCreateInfo poolInfo = {};
+	poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+	poolInfo.queueFamilyIndex = queueFamily;
+	poolInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+
+	if (vkCreateCommandPool(mDevice, &poolInfo, nullptr, &mCommandPool) != VK_SUCCESS)
+		throw std::runtime_error("failed to create mesh streaming command pool!");
+
+	VkCommandBuffer commandBuffers[SEGMENT_COUNT];
+	VkCommandBufferAllocateInfo commandBufferInfo = {};
+	commandBufferInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+	commandBufferInfo.commandPool = mCommandPool;
+	commandBufferInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+	commandBufferInfo.commandBufferCount = SEGMENT_COUNT;
+
+	if (vkAllocateCommandBuffers(mDevice, &commandBufferInfo, commandBuffers) != VK_SUCCESS)
+		throw std::runtime_error("failed to allocate mesh streaming command buffers!");
+
+	VkFenceCreateInfo fenceInfo = {};
+	fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+	for (uint32_t i = 0; i < SEGMENT_COUNT; ++i)
+	{
+		mSegments[i].commandBuffer = commandBuffers[i];
+		if (vkCreateFence(mDevice, &fenceInfo, nullptr, &mSegments[i].fence) != VK_SUCCESS)
+			throw std::runtime_error("failed to create mesh streaming fence!");
+	}
+}
+
+void MeshStreamer::destroy()
+{
+	if (mDevice == VK_NULL_HANDLE)
+		return;
+
+	waitIdle();
+	reset();
+
+	for (Segment& segment : mSegments)
+	{
+		vkDestroyFence(mDevice, segment.fence, nullptr);
+		segment = Segment();
+	}
+
+	vkDestroyCommandPool(mDevice, mCommandPool, nullptr);
+	vkUnmapMemory(mDevice, mRingMemory);
+	vkDestroyBuffer(mDevice, mRing, nullptr);
+	vkFreeMemory(mDevice, mRingMemory, nullptr);
+
+	mCommandPool = VK_NULL_HANDLE;
+	mRing = VK_NULL_HANDLE;
+	mRingMemory = VK_NULL_HANDLE;
+	mRingData = nullptr;
+	mDevice = VK_NULL_HANDLE;
+}
+
+StreamedMesh MeshStreamer::load(const std::string& path, MaterialLibrary* materials)
+{
+	auto start = std::chrono::steady_clock::now();
+
+	reset();
+	mMaterialLibrary = materials;
+	mVertices.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
+	mPositions.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
+	mIndices.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT;
+
+	std::vector<char> readBuffer(READ_BUFFER_SIZE);
+	std::ifstream file;
+	file.rdbuf()->pubsetbuf(readBuffer.data(), readBuffer.size());
+	file.open(path);
+	if (!file)
+		throw std::runtime_error("failed to open " + path);
+
+	tinyobj::callback_t callback;
+	callback.vertex_cb = vertexCallback;
+	callback.normal_cb = normalCallback;
+	callback.texcoord_cb = texcoordCallback;
+	callback.index_cb = indexCallback;
+	callback.usemtl_cb = usemtlCallback;
+
+	std::unique_ptr<MaterialLibrary::Reader> materialReader;
+	if (materials)
+		materialReader.reset(new MaterialLibrary::Reader(*materials, MaterialLibrary::getDirectory(path)));
+
+	std::string warn, err;
+	try
+	{
+		if (!tinyobj::LoadObjWithCallback(file, callback, this, materialReader.get(), &warn, &err))
+			throw std::runtime_error(warn + err);
+
+		if (mIndexCount == 0)
+			throw std::runtime_error(path + " has no faces");
+
+		flush();
+		waitIdle();
+		trim();
+	}
+	catch (...)
+	{
+		waitIdle();
+		reset();
+		throw;
+	}
+
+	if (mSkippedFaces > 0)
+		warn += "skipped " + std::to_string(mSkippedFaces) + " faces with invalid indices\n";
+	if (!warn.empty())
+		std::cout << warn;
+
+	StreamedMesh mesh;
+	mesh.vertexBuffer = mVertices.buffer;
+	mesh.vertexBufferMemory = mVertices.memory;
+	mesh.positionBuffer = mPositions.buffer;
+	mesh.positionBufferMemory = mPositions.memory;
+	mesh.indexBuffer = mIndices.buffer;
+	mesh.indexBufferMemory = mIndices.memory;
+	mesh.vertexCount = mVertexCount;
+	mesh.indexCount = mIndexCount;
+	mesh.radius = mRadius;
+	mMaterialRanges.back().indexCount = mIndexCount - mMaterialRanges.back().firstIndex;
+	for (const MeshMaterialRange& range : mMaterialRanges)
+	{
+		if (range.indexCount > 0)
+			mesh.materialRanges.push_back(range);
+	}
+
+	// The caller owns them now.
+	mVertices = GrowingBuffer();
+	mPositions = GrowingBuffer();
+	mIndices = GrowingBuffer();
+
+	std::cout << "streamed " << path << ": " << mVertexCount << " vertices, " << mIndexCount / 3 << " triangles in "
+		<< mSubmits << " uploads through a " << mSegmentSize * SEGMENT_COUNT / 1024 << " KB ring, "
+		<< seconds(std::chrono::steady_clock::now() - start) * 1000.0 << " ms ("
+		<< mStallTime * 1000.0 << " ms waiting for the ring)" << std::endl;
+
+	// Nothing but the ring needs to stay around until the next load.
+	reset();
+
+	return mesh;
+}
+
+void MeshStreamer::vertexCallback(void* user, tinyobj::real_t x, tinyobj::real_t y, tinyobj::real_t z, tinyobj::real_t /*w*/)
+{
+	std::vector<float>& positions = static_cast<MeshStreamer*>(user)->mObjPositions;
+	positions.push_back(x);
+	positions.push_back(y);
+	positions.push_back(z);
+}
+
+void MeshStreamer::normalCallback(void* user, tinyobj::real_t x, tinyobj::real_t y, tinyobj::real_t z)
+{
+	std::vector<float>& normals = static_cast<MeshStreamer*>(user)->mObjNormals;
+	normals.push_back(x);
+	normals.push_back(y);
+	normals.push_back(z);
+}
+
+void MeshStreamer::texcoordCallback(void* user, tinyobj::real_t x, tinyobj::real_t y, tinyobj::real_t /*z*/)
+{
+	std::vector<float>& texcoords = static_cast<MeshStreamer*>(user)->mObjTexcoords;
+	texcoords.push_back(x);
+	texcoords.push_back(y);
+}
+
+void MeshStreamer::indexCallback(void* user, tinyobj::index_t* indices, int count)
+{
+	static_cast<MeshStreamer*>(user)->addFace(indices, count);
+}
+
+void MeshStreamer::usemtlCallback(void* user, const char* name, int /*materialId*/)
+{
+	// The id tinyobj passes is always -1, the library resolves names once its .mtl files are parsed.
+	MeshStreamer* streamer = static_cast<MeshStreamer*>(user);
+	uint32_t materialName = streamer->mMaterialLibrary ? streamer->mMaterialLibrary->internMaterialName(name) : StringTable::INVALID;
+
+	MeshMaterialRange& current = streamer->mMaterialRanges.back();
+	if (current.firstIndex == streamer->mIndexCount)
+		current.materialName = materialName;
+	else if (current.materialName != materialName)
+	{
+		current.indexCount = streamer->mIndexCount - current.firstIndex;
+		streamer->mMaterialRanges.push_back({ streamer->mIndexCount, 0, materialName });
+	}
+}
+
+bool MeshStreamer::resolveCorner(const tinyobj::index_t& index, CornerKey& key) const
+{
+	/*
+	The callback hands over the indices as written in the file: 1 based, negative counts back from the
+	last element read so far, 0 when the corner has no vt/vn.
+	*/
+	auto resolve = [](int raw, size_t count, int& resolved)
+	{
+		if (raw > 0)
+			resolved = raw - 1;
+		else if (raw < 0)
+			resolved = static_cast<int>(count) + raw;
+		else
+			resolved = -1;
+
+		return resolved < static_cast<int>(count);
+	};
+
+	if (!resolve(index.vertex_index, mObjPositions.size() / 3, key.v) || key.v < 0)
+		return false;
+	if (!resolve(index.texcoord_index, mObjTexcoords.size() / 2, key.vt) || (index.texcoord_index != 0 && key.vt < 0))
+		return false;
+	if (!resolve(index.normal_index, mObjNormals.size() / 3, key.vn) || (index.normal_index != 0 && key.vn < 0))
+		return false;
+
+	return true;
+}
+
+void MeshStreamer::addFace(const tinyobj::index_t* indices, int count)
+{
+	if (count < 3)
+		return; // Points and lines.
+
+	// Check the whole face first, so a bad corner doesn't leave welded vertices nothing points at.
+	CornerKey keys[16];
+	std::vector<CornerKey> manyKeys;
+	CornerKey* corners = keys;
+	if (count > 16)
+	{
+		manyKeys.resize(count);
+		corners = manyKeys.data();
+	}
+
+	for (int i = 0; i < count; ++i)
+	{
+		if (!resolveCorner(indices[i], corners[i]))
+		{
+			++mSkippedFaces;
+			return;
+		}
+	}
+
+	mFaceVertices.clear();
+	for (int i = 0; i < count; ++i)
+		mFaceVertices.push_back(weld(corners[i]));
+
+	// Polygons become a triangle fan, which is only right for convex ones (LoadObj ear clips).
+	for (int i = 1; i + 1 < count; ++i)
+	{
+		if (mSegments[mCurrentSegment].indexCount + 3 > mSegmentIndices)
+			flush();
+
+		Segment& segment = mSegments[mCurrentSegment];
+		uint32_t triangle[3] = { mFaceVertices[0], mFaceVertices[i], mFaceVertices[i + 1] };
+		memcpy(mRingData + mCurrentSegment * mSegmentSize + mIndexOffset + segment.indexCount * sizeof(uint32_t), triangle, sizeof(triangle));
+
+		segment.indexCount += 3;
+		mIndexCount += 3;
+	}
+}
+
+uint32_t MeshStreamer::weld(const CornerKey& key)
+{
+	auto found = mWeldTable.find(key);
+	if (found != mWeldTable.end())
+		return found->second;
+
+	if (mSegments[mCurrentSegment].vertexCount == mSegmentVertices)
+		flush();
+
+	Vertex vertex = {};
+	vertex.pos = glm::vec3(mObjPositions[3 * key.v + 0], mObjPositions[3 * key.v + 1], mObjPositions[3 * key.v + 2]);
+	vertex.color = glm::vec3(1.f, 1.f, 1.f);
+	if (key.vt >= 0)
+		vertex.texCoord = glm::vec2(mObjTexcoords[2 * key.vt + 0], 1.f - mObjTexcoords[2 * key.vt + 1]);
+	if (key.vn >= 0)
+		vertex.normal = glm::vec3(mObjNormals[3 * key.vn + 0], mObjNormals[3 * key.vn + 1], mObjNormals[3 * key.vn + 2]);
+
+	// Straight into the mapped ring, the vertex never goes through a host side array.
+	Segment& segment = mSegments[mCurrentSegment];
+	char* base = mRingData + mCurrentSegment * mSegmentSize;
+	memcpy(base + segment.vertexCount * sizeof(Vertex), &vertex, sizeof(Vertex));
+	memcpy(base + mPositionOffset + segment.vertexCount * sizeof(glm::vec3), &vertex.pos, sizeof(glm::vec3));
+	++segment.vertexCount;
+
+	// Instances rotate the model around its origin, so this sphere bounds every instance.
+	mRadius = std::max(mRadius, glm::length(vertex.pos));
+
+	uint32_t index = mVertexCount++;
+	mWeldTable.emplace(key, index);
+
+	return index;
+}
+
+void MeshStreamer::flush()
+{
+	Segment& segment = mSegments[mCurrentSegment];
+	if (segment.vertexCount == 0 && segment.indexCount == 0)
+		return;
+
+	VkCommandBufferBeginInfo beginInfo = {};
+	beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+	beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+	vkBeginCommandBuffer(segment.commandBuffer, &beginInfo);
+
+	// Appends size bytes from the segment to the end of target, growing it first if they don't fit.
+	VkDeviceSize segmentOffset = mCurrentSegment * mSegmentSize;
+	auto upload = [&](GrowingBuffer& target, VkDeviceSize offset, VkDeviceSize size)
+	{
+		if (size == 0)
+			return;
+
+		if (target.size + size > target.capacity)
+			resize(target, std::max(target.size + size, std::max(target.capacity * 2, mSegmentSize)), segment.commandBuffer);
+
+		VkBufferCopy region = {};
+		region.srcOffset = segmentOffset + offset;
+		region.dstOffset = target.size;
+		region.size = size;
+		vkCmdCopyBuffer(segment.commandBuffer, mRing, target.buffer, 1, &region);
+
+		target.size += size;
+	};
+
+	upload(mVertices, 0, segment.vertexCount * sizeof(Vertex));
+	upload(mPositions, mPositionOffset, segment.vertexCount * sizeof(glm::vec3));
+	upload(mIndices, mIndexOffset, segment.indexCount * sizeof(uint32_t));
+
+	vkEndCommandBuffer(segment.commandBuffer);
+
+	VkSubmitInfo submitInfo = {};
+	submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+	submitInfo.commandBufferCount = 1;
+	submitInfo.pCommandBuffers = &segment.commandBuffer;
+
+	if (vkQueueSubmit(mQueue, 1, &submitInfo, segment.fence) != VK_SUCCESS)
+		throw std::runtime_error("failed to submit mesh upload!");
+
+	segment.pending = true;
+	++mSubmits;
+
+	// Parsing carries on in the next segment while this one is copied. It has to wait only if the GPU is a whole ring behind.
+	mCurrentSegment = (mCurrentSegment + 1) % SEGMENT_COUNT;
+	Segment& next = mSegments[mCurrentSegment];
+
+	auto waitStart = std::chrono::steady_clock::now();
+	waitForSegment(next);
+	mStallTime += seconds(std::chrono::steady_clock::now() - waitStart);
+
+	next.vertexCount = 0;
+	next.indexCount = 0;
+}
+
+void MeshStreamer::waitForSegment(Segment& segment)
+{
+	if (!segment.pending)
+		return;
+
+	vkWaitForFences(mDevice, 1, &segment.fence, VK_TRUE, std::numeric_limits<uint64_t>::max());
+	vkResetFences(mDevice, 1, &segment.fence);
+	segment.pending = false;
+}
+
+void MeshStreamer::waitIdle()
+{
+	for (Segment& segment : mSegments)
+		waitForSegment(segment);
+
+	// Whatever got outgrown has been copied out of by now.
+	releaseRetired();
+}
+
+void MeshStreamer::resize(GrowingBuffer& target, VkDeviceSize capacity, VkCommandBuffer commandBuffer)
+{
+	VkBuffer buffer;
+	VkDeviceMemory memory;
+
+	VkBufferCreateInfo bufferInfo = {};
+	bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+	bufferInfo.size = capacity;
+	bufferInfo.usage = target.usage;
+	bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+	if (vkCreateBuffer(mDevice, &bufferInfo, nullptr, &buffer) != VK_SUCCESS)
+		throw std::runtime_error("failed to create mesh buffer!");
+
+	VkMemoryRequirements memRequirements;
+	vkGetBufferMemoryRequirements(mDevice, buffer, &memRequirements);
+
+	VkMemoryAllocateInfo allocInfo = {};
+	allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+	allocInfo.allocationSize = memRequirements.size;
+	allocInfo.memoryTypeIndex = findMemoryType(memRequirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+	if (vkAllocateMemory(mDevice, &allocInfo, nullptr, &memory) != VK_SUCCESS)
+	{
+		vkDestroyBuffer(mDevice, buffer, nullptr);
+		throw std::runtime_error("failed to allocate mesh buffer memory!");
+	}
+
+	vkBindBufferMemory(mDevice, buffer, memory, 0);
+
+	if (target.buffer != VK_NULL_HANDLE)
+	{
+		/*
+		Move what is already there over on the GPU. Earlier segments may still be copying into the old buffer,
+		the barrier makes this copy wait for them (it covers everything submitted before it on the queue).
+		*/
+		if (target.size > 0)
+		{
+			VkMemoryBarrier barrier = {};
+			barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+			barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+			barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+			vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+
+			VkBufferCopy region = {};
+			region.size = target.size;
+			vkCmdCopyBuffer(commandBuffer, target.buffer, buffer, 1, &region);
+		}
+
+		mRetired.push_back(std::make_pair(target.buffer, target.memory));
+	}
+
+	target.buffer = buffer;
+	target.memory = memory;
+	target.capacity = capacity;
+}
+
+void MeshStreamer::trim()
+{
+	// Doubling leaves up to half of each buffer unused. Only called with the queue idle.
+	if (mVertices.capacity == mVertices.size && mPositions.capacity == mPositions.size && mIndices.capacity == mIndices.size)
+		return;
+
+	Segment& segment = mSegments[mCurrentSegment];
+
+	VkCommandBufferBeginInfo beginInfo = {};
+	beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+	beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+	vkBeginCommandBuffer(segment.commandBuffer, &beginInfo);
+
+	for (GrowingBuffer* target : { &mVertices, &mPositions, &mIndices })
+	{
+		if (target->capacity != target->size)
+			resize(*target, target->size, segment.commandBuffer);
+	}
+
+	vkEndCommandBuffer(segment.commandBuffer);
+
+	VkSubmitInfo submitInfo = {};
+	submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+	submitInfo.commandBufferCount = 1;
+	submitInfo.pCommandBuffers = &segment.commandBuffer;
+
+	if (vkQueueSubmit(mQueue, 1, &submitInfo, segment.fence) != VK_SUCCESS)
+		throw std::runtime_error("failed to submit mesh upload!");
+
+	segment.pending = true;
+	waitIdle();
+}
+
+void MeshStreamer::releaseRetired()
+{
+	for (auto& retired : mRetired)
+	{
+		vkDestroyBuffer(mDevice, retired.first, nullptr);
+		vkFreeMemory(mDevice, retired.second, nullptr);
+	}
+	mRetired.clear();
+}
+
+void MeshStreamer::reset()
+{
+	// Only called with nothing in flight. Outputs still held here weren't handed out, so they go too.
+	releaseRetired();
+	for (GrowingBuffer* target : { &mVertices, &mPositions, &mIndices })
+	{
+		if (target->buffer != VK_NULL_HANDLE)
+		{
+			vkDestroyBuffer(mDevice, target->buffer, nullptr);
+			vkFreeMemory(mDevice, target->memory, nullptr);
+		}
+		*target = GrowingBuffer();
+	}
+
+	for (Segment& segment : mSegments)
+	{
+		segment.vertexCount = 0;
+		segment.indexCount = 0;
+	}
+	mCurrentSegment = 0;
+
+	// swap with empty vectors/maps so the memory is actually given back.
+	std::vector<float>().swap(mObjPositions);
+	std::vector<float>().swap(mObjNormals);
+	std::vector<float>().swap(mObjTexcoords);
+	std::unordered_map<CornerKey, uint32_t, CornerKeyHash>().swap(mWeldTable);
+	mFaceVertices.clear();
+	mVertexCount = 0;
+	mIndexCount = 0;
+	mRadius = 0.f;
+	mSkippedFaces = 0;
+	mMaterialLibrary = nullptr;
+	mMaterialRanges.assign(1, { 0, 0, StringTable::INVALID });
+	mSubmits = 0;
+	mStallTime = 0.0;
+}
+
+uint32_t MeshStreamer::findMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties)
+{
+	VkPhysicalDeviceMemoryProperties memProperties;
+	vkGetPhysicalDeviceMemoryProperties(mPhysDevice, &memProperties);
+
+	for (uint32_t i = 0; i < memProperties.memoryTypeCount; ++i)
+	{
+		if ((typeFilter & (1 << i)) &&
+			(memProperties.memoryTypes[i].propertyFlags & properties) == properties)
+			return i;
+	}
+
+	throw std::runtime_error("failed to find suitable memory type!");
+}
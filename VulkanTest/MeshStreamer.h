@@ -0,0 +1,163 @@
+/*
+MeshStreamer.h
+Streams an .obj file straight into device local vertex/index buffers.
+
+DemoApp::loadModel used to go through three full copies of the mesh: the tinyobj attrib_t and shapes,
+then mVertices/mIndices, then a staging buffer of the same size. The streamer instead parses with
+tinyobj::LoadObjWithCallback and welds every face corner as soon as it is read. New vertices and the
+triangle indices are written into a small persistently mapped staging ring, which is split into segments.
+When a segment fills up its copies into the device local buffers are submitted and parsing carries on in
+the next segment, so the GPU copies one segment while the CPU parses the next. Only when the ring wraps
+around onto a segment that is still being copied does the parser wait.
+
+Host memory is the ring, the v/vt/vn pools (faces can point anywhere back into them) and the weld table,
+no matter how many faces the file has. The destination buffers start at one segment and double on the GPU
+when they run out, then get trimmed to the final size.
+*/
+
+#ifndef MESH_STREAMER_H
+#define MESH_STREAMER_H
+
+#include <vulkan/vulkan.h>
+#include <tiny_obj_loader.h>
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+class MaterialLibrary;
+
+// Consecutive faces that use the same material (usemtl).
+struct MeshMaterialRange
+{
+	uint32_t firstIndex;
+	uint32_t indexCount;
+	uint32_t materialName; // MaterialLibrary name id, StringTable::INVALID before the first usemtl or without a library.
+};
+
+// Buffers of a streamed mesh, owned by the caller after MeshStreamer::load.
+struct StreamedMesh
+{
+	VkBuffer vertexBuffer = VK_NULL_HANDLE; // Vertex (see DemoApp.h)
+	VkDeviceMemory vertexBufferMemory = VK_NULL_HANDLE;
+	VkBuffer positionBuffer = VK_NULL_HANDLE; // glm::vec3 per vertex, for the depth only passes.
+	VkDeviceMemory positionBufferMemory = VK_NULL_HANDLE;
+	VkBuffer indexBuffer = VK_NULL_HANDLE; // uint32_t triangle list.
+	VkDeviceMemory indexBufferMemory = VK_NULL_HANDLE;
+	uint32_t vertexCount = 0;
+	uint32_t indexCount = 0;
+	float radius = 0.f; // Bounding sphere radius around the origin.
+	std::vector<MeshMaterialRange> materialRanges;
+};
+
+class MeshStreamer
+{
+public:
+	static const VkDeviceSize DEFAULT_RING_SIZE = 8 * 1024 * 1024;
+	static const uint32_t SEGMENT_COUNT = 4;
+
+	// The copies are submitted to queue, which has to support transfers and belong to queueFamily.
+	void init(VkDevice device, VkPhysicalDevice physDevice, VkQueue queue, uint32_t queueFamily, VkDeviceSize ringSize = DEFAULT_RING_SIZE);
+	void destroy();
+
+	/*
+	Parses and uploads the whole file. Every copy has finished when it returns. Throws if the file can't be parsed.
+	With a material library, mtllib files start loading in the background as soon as they are seen (see MaterialLibrary).
+	*/
+	StreamedMesh load(const std::string& path, MaterialLibrary* materials = nullptr);
+
+private:
+	// Raw .obj indices of a face corner, already turned into 0 based indices. -1 for a missing vt/vn.
+	struct CornerKey
+	{
+		int v, vt, vn;
+
+		bool operator==(const CornerKey& other) const { return v == other.v && vt == other.vt && vn == other.vn; }
+	};
+
+	struct CornerKeyHash
+	{
+		size_t operator()(const CornerKey& key) const;
+	};
+
+	// A device local buffer that grows while the mesh streams in.
+	struct GrowingBuffer
+	{
+		VkBuffer buffer = VK_NULL_HANDLE;
+		VkDeviceMemory memory = VK_NULL_HANDLE;
+		VkDeviceSize capacity = 0;
+		VkDeviceSize size = 0; // Bytes written (or about to be by recorded copies).
+		VkBufferUsageFlags usage = 0;
+	};
+
+	// One slice of the ring. Vertices, positions and indices each get a fixed part of it.
+	struct Segment
+	{
+		VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+		VkFence fence = VK_NULL_HANDLE;
+		bool pending = false; // Submitted and not waited for yet.
+		uint32_t vertexCount = 0;
+		uint32_t indexCount = 0;
+	};
+
+	static void vertexCallback(void* user, tinyobj::real_t x, tinyobj::real_t y, tinyobj::real_t z, tinyobj::real_t w);
+	static void normalCallback(void* user, tinyobj::real_t x, tinyobj::real_t y, tinyobj::real_t z);
+	static void texcoordCallback(void* user, tinyobj::real_t x, tinyobj::real_t y, tinyobj::real_t z);
+	static void indexCallback(void* user, tinyobj::index_t* indices, int count);
+	static void usemtlCallback(void* user, const char* name, int materialId);
+
+	void addFace(const tinyobj::index_t* indices, int count);
+	bool resolveCorner(const tinyobj::index_t& index, CornerKey& key) const;
+	uint32_t weld(const CornerKey& key);
+
+	void flush(); // Submits the current segment and moves on to the next one.
+	void waitForSegment(Segment& segment);
+	void waitIdle();
+	void resize(GrowingBuffer& target, VkDeviceSize capacity, VkCommandBuffer commandBuffer);
+	void trim(); // Shrinks the outputs to what was written.
+	void releaseRetired();
+	void reset();
+
+	uint32_t findMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties);
+
+	VkDevice mDevice = VK_NULL_HANDLE;
+	VkPhysicalDevice mPhysDevice = VK_NULL_HANDLE;
+	VkQueue mQueue = VK_NULL_HANDLE;
+	VkCommandPool mCommandPool = VK_NULL_HANDLE;
+
+	// The staging ring, mapped for as long as the streamer lives.
+	VkBuffer mRing = VK_NULL_HANDLE;
+	VkDeviceMemory mRingMemory = VK_NULL_HANDLE;
+	char* mRingData = nullptr;
+	VkDeviceSize mSegmentSize = 0;
+	uint32_t mSegmentVertices = 0; // Capacity of a segment.
+	uint32_t mSegmentIndices = 0;
+	VkDeviceSize mPositionOffset = 0; // Offsets of the parts within a segment.
+	VkDeviceSize mIndexOffset = 0;
+	Segment mSegments[SEGMENT_COUNT];
+	uint32_t mCurrentSegment = 0;
+
+	GrowingBuffer mVertices;
+	GrowingBuffer mPositions;
+	GrowingBuffer mIndices;
+	std::vector<std::pair<VkBuffer, VkDeviceMemory>> mRetired; // Outgrown buffers, freed once their copies have run.
+
+	// Parser state
+	std::vector<float> mObjPositions;
+	std::vector<float> mObjNormals;
+	std::vector<float> mObjTexcoords;
+	std::unordered_map<CornerKey, uint32_t, CornerKeyHash> mWeldTable;
+	std::vector<uint32_t> mFaceVertices;
+	uint32_t mVertexCount = 0;
+	uint32_t mIndexCount = 0;
+	float mRadius = 0.f;
+	size_t mSkippedFaces = 0;
+	MaterialLibrary* mMaterialLibrary = nullptr;
+	std::vector<MeshMaterialRange> mMaterialRanges;
+
+	// Statistics
+	uint32_t mSubmits = 0;
+	double mStallTime = 0.0; // Seconds spent waiting for a segment to become free.
+};
+
+#endif // !MESH_STREAMER_H
@@ -0,0 +1,231 @@
+/*
+MeshletBuilder.cpp
+definitions for the functions in MeshletBuilder.h
+*/
+
+#include "MeshletBuilder.h"
+#include "DemoApp.h" // glm, with the app's configuration
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+static const uint32_t NOT_IN_MESHLET = ~0u;
+
+// Sphere and normal cone of the meshlet, indices points at its first index.
+static void computeBounds(Meshlet& meshlet, const glm::vec3* positions, const uint32_t* indices)
+{
+	glm::vec3 minPos(std::numeric_limits<float>::max());
+	glm::vec3 maxPos(-std::numeric_limits<float>::max());
+	for (uint32_t i = 0; i < meshlet.indexCount; ++i)
+	{
+		minPos = glm::min(minPos, positions[indices[i]]);
+		maxPos = glm::max(maxPos, positions[indices[i]]);
+	}
+
+	// Around the middle of the box, a little looser than the smallest sphere but cheap and stable.
+	glm::vec3 center = (minPos + maxPos) * 0.5f;
+	float radius = 0.f;
+	for (uint32_t i = 0; i < meshlet.indexCount; ++i)
+		radius = std::max(radius, glm::length(positions[indices[i]] - center));
+
+	// Face normals, the winding decides which side is the front just like it does for the rasterizer.
+	std::vector<glm::vec3> normals;
+	normals.reserve(meshlet.indexCount / 3);
+	glm::vec3 normalSum(0.f);
+	for (uint32_t i = 0; i < meshlet.indexCount; i += 3)
+	{
+		const glm::vec3& a = positions[indices[i]];
+		glm::vec3 normal = glm::cross(positions[indices[i + 1]] - a, positions[indices[i + 2]] - a);
+		float length = glm::length(normal);
+
+		// Degenerate triangles never get rasterized, they don't constrain the cone.
+		if (length > 0.f)
+		{
+			normals.push_back(normal / length);
+			normalSum += normals.back();
+		}
+	}
+
+	glm::vec3 axis(0.f);
+	float cutoff = 1.f;
+	float sumLength = glm::length(normalSum);
+	if (sumLength > 0.f)
+	{
+		axis = normalSum / sumLength;
+
+		float minDot = 1.f;
+		for (const glm::vec3& normal : normals)
+			minDot = std::min(minDot, glm::dot(axis, normal));
+
+		// At 90 degrees or more from the axis some triangle always faces the camera.
+		if (minDot > 0.f)
+			cutoff = std::sqrt(std::max(0.f, 1.f - minDot * minDot));
+	}
+
+	for (int i = 0; i < 3; ++i)
+	{
+		meshlet.center[i] = center[i];
+		meshlet.coneAxis[i] = axis[i];
+	}
+	meshlet.radius = radius;
+	meshlet.coneCutoff = cutoff;
+}
+
+std::vector<Meshlet> buildMeshlets(const float* positions, size_t vertexCount, std::vector<uint32_t>& indices)
+{
+	if (indices.size() % 3 != 0)
+		throw std::runtime_error("failed to build meshlets, the mesh isn't made of triangles!");
+
+	size_t triangleCount = indices.size() / 3;
+	for (uint32_t index : indices)
+	{
+		if (index >= vertexCount)
+			throw std::runtime_error("failed to build meshlets, index out of range!");
+	}
+
+	// The triangles around every vertex, all in one array with a start offset per vertex.
+	std::vector<uint32_t> adjacencyOffsets(vertexCount + 1, 0);
+	for (uint32_t index : indices)
+		++adjacencyOffsets[index + 1];
+	for (size_t i = 0; i < vertexCount; ++i)
+		adjacencyOffsets[i + 1] += adjacencyOffsets[i];
+
+	std::vector<uint32_t> adjacency(indices.size());
+	std::vector<uint32_t> cursor(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+	for (size_t i = 0; i < indices.size(); ++i)
+		adjacency[cursor[indices[i]]++] = static_cast<uint32_t>(i / 3);
+
+	std::vector<bool> emitted(triangleCount, false);
+	std::vector<uint32_t> meshletSlot(vertexCount, NOT_IN_MESHLET); // Vertex -> its place in the current meshlet.
+	std::vector<uint32_t> meshletVertices;
+	std::vector<uint32_t> candidates; // Triangles touching the current meshlet, may hold duplicates and emitted ones.
+	glm::vec3 vertexSum(0.f);
+	const glm::vec3* points = reinterpret_cast<const glm::vec3*>(positions);
+
+	std::vector<uint32_t> reordered;
+	reordered.reserve(indices.size());
+	std::vector<Meshlet> meshlets;
+
+	auto newVertices = [&](uint32_t triangle)
+	{
+		uint32_t count = 0;
+		for (int corner = 0; corner < 3; ++corner)
+		{
+			uint32_t vertex = indices[triangle * 3 + corner];
+			if (meshletSlot[vertex] == NOT_IN_MESHLET)
+			{
+				// The same new vertex twice in a degenerate triangle still counts once.
+				bool repeated = corner > 0 && indices[triangle * 3] == vertex;
+				repeated = repeated || (corner > 1 && indices[triangle * 3 + 1] == vertex);
+				if (!repeated)
+					++count;
+			}
+		}
+		return count;
+	};
+
+	auto addTriangle = [&](uint32_t triangle)
+	{
+		emitted[triangle] = true;
+		for (int corner = 0; corner < 3; ++corner)
+		{
+			uint32_t vertex = indices[triangle * 3 + corner];
+			reordered.push_back(vertex);
+
+			if (meshletSlot[vertex] != NOT_IN_MESHLET)
+				continue;
+
+			meshletSlot[vertex] = static_cast<uint32_t>(meshletVertices.size());
+			meshletVertices.push_back(vertex);
+			vertexSum += points[vertex];
+			for (uint32_t i = adjacencyOffsets[vertex]; i < adjacencyOffsets[vertex + 1]; ++i)
+			{
+				if (!emitted[adjacency[i]])
+					candidates.push_back(adjacency[i]);
+			}
+		}
+	};
+
+	size_t seed = 0;
+	while (true)
+	{
+		while (seed < triangleCount && emitted[seed])
+			++seed;
+		if (seed == triangleCount)
+			break;
+
+		Meshlet meshlet = {};
+		meshlet.firstIndex = static_cast<uint32_t>(reordered.size());
+		addTriangle(static_cast<uint32_t>(seed));
+		uint32_t triangles = 1;
+
+		while (triangles < MESHLET_MAX_TRIANGLES)
+		{
+			// Fewest new vertices first, then the triangle closest to the middle of the meshlet, which keeps it round.
+			glm::vec3 middle = vertexSum / static_cast<float>(meshletVertices.size());
+			uint32_t best = NOT_IN_MESHLET;
+			uint32_t bestNew = 4;
+			float bestDistance = 0.f;
+			for (size_t i = 0; i < candidates.size();)
+			{
+				uint32_t triangle = candidates[i];
+				if (emitted[triangle])
+				{
+					candidates[i] = candidates.back();
+					candidates.pop_back();
+					continue;
+				}
+				++i;
+
+				uint32_t count = newVertices(triangle);
+				if (count > bestNew || meshletVertices.size() + count > MESHLET_MAX_VERTICES)
+					continue;
+
+				const uint32_t* corners = &indices[triangle * 3];
+				glm::vec3 offset = (points[corners[0]] + points[corners[1]] + points[corners[2]]) / 3.f - middle;
+				float distance = glm::dot(offset, offset);
+				if (count < bestNew || distance < bestDistance)
+				{
+					best = triangle;
+					bestNew = count;
+					bestDistance = distance;
+				}
+			}
+
+			if (best == NOT_IN_MESHLET)
+				break;
+
+			addTriangle(best);
+			++triangles;
+		}
+
+		meshlet.indexCount = triangles * 3;
+		meshlet.vertexCount = static_cast<uint32_t>(meshletVertices.size());
+		computeBounds(meshlet, points, reordered.data() + meshlet.firstIndex);
+		meshlets.push_back(meshlet);
+
+		for (uint32_t vertex : meshletVertices)
+			meshletSlot[vertex] = NOT_IN_MESHLET;
+		meshletVertices.clear();
+		candidates.clear();
+		vertexSum = glm::vec3(0.f);
+	}
+
+	indices.swap(reordered);
+	return meshlets;
+}
+
+bool isMeshletBackFacing(const Meshlet& meshlet, const float cameraPos[3])
+{
+	glm::vec3 toCenter = glm::vec3(meshlet.center[0], meshlet.center[1], meshlet.center[2]) - glm::vec3(cameraPos[0], cameraPos[1], cameraPos[2]);
+	glm::vec3 axis(meshlet.coneAxis[0], meshlet.coneAxis[1], meshlet.coneAxis[2]);
+
+	/*
+	Every point of the bounding sphere has to be seen at no more than 90 degrees minus the cone's half angle from the axis,
+	then no normal of the cone can point back at the camera. The radius is added twice: once for how far a point can sit
+	off the center along the axis, once (scaled by the cutoff) for how much longer its view vector can be.
+	*/
+	return glm::dot(toCenter, axis) >= meshlet.coneCutoff * (glm::length(toCenter) + meshlet.radius) + meshlet.radius;
+}
@@ -0,0 +1,52 @@
+/*
+MeshletBuilder.h
+Splits a triangle mesh into meshlets: small clusters of neighbouring triangles that can be culled on their own.
+
+Every meshlet uses at most MESHLET_MAX_VERTICES distinct vertices and MESHLET_MAX_TRIANGLES triangles, the limits
+mesh shading hardware is built around, so the same clusters would work there too. Each one carries a bounding sphere
+for frustum culling and a normal cone: when the camera sees all of its triangles from behind the whole meshlet can
+be skipped. With a few thousand triangles per instance most of a dense mesh is either outside the view or facing away.
+
+This only needs the positions and the indices and doesn't touch Vulkan, so meshes can also be split offline
+(see --meshlets in main.cpp).
+*/
+
+#ifndef MESHLET_BUILDER_H
+#define MESHLET_BUILDER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+static const uint32_t MESHLET_MAX_VERTICES = 64;
+static const uint32_t MESHLET_MAX_TRIANGLES = 124;
+
+// Laid out to be read as is from a std430 storage buffer (ClusterCull.comp).
+struct Meshlet
+{
+	float center[3]; // Bounding sphere, in model space.
+	float radius;
+	float coneAxis[3]; // Average facing of the triangles.
+	float coneCutoff; // Sine of the widest angle between coneAxis and a triangle normal, 1 when the cone can't cull.
+	uint32_t firstIndex; // Relative to the mesh, in the reordered indices.
+	uint32_t indexCount;
+	uint32_t vertexCount; // Distinct vertices.
+	uint32_t padding;
+};
+
+/*
+Groups the triangles of indices into meshlets. indices is reordered in place so every meshlet is one contiguous range
+of it, the triangles keep their winding. positions holds vertexCount xyz triples.
+
+A meshlet grows from the first triangle nobody has taken yet, always adding the neighbouring triangle that brings
+in the fewest new vertices, until one of the limits is hit or it runs out of neighbours.
+*/
+std::vector<Meshlet> buildMeshlets(const float* positions, size_t vertexCount, std::vector<uint32_t>& indices);
+
+/*
+Whether a camera at cameraPos (model space) only sees the back of every triangle of the meshlet.
+ClusterCull.comp does the same test on the GPU.
+*/
+bool isMeshletBackFacing(const Meshlet& meshlet, const float cameraPos[3]);
+
+#endif // !MESHLET_BUILDER_H
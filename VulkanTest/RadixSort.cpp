@@ -0,0 +1,109 @@
+/*
+RadixSort.cpp
+definitions for the functions in RadixSort.h
+*/
+
+#include "RadixSort.h"
+
+#include <algorithm>
+#include <array>
+#include <thread>
+
+/*
+Below this many keys per thread, another thread isn't worth starting. A thread costs tens of microseconds to start and join,
+about as long as sorting 16K keys takes, so the 2048 instances sorted every frame stay on the calling thread.
+*/
+static const size_t MIN_KEYS_PER_THREAD = 16384;
+
+typedef std::array<uint32_t, 256> Histogram;
+
+void radixSort16(const std::vector<uint16_t>& keys, std::vector<uint32_t>& order, RadixSortScratch& scratch, unsigned threadCount)
+{
+	size_t count = keys.size();
+
+	if (threadCount == 0)
+		threadCount = std::max(1u, std::thread::hardware_concurrency());
+	threadCount = static_cast<unsigned>(std::max<size_t>(1, std::min<size_t>(threadCount, count / MIN_KEYS_PER_THREAD)));
+
+	order.resize(count);
+	for (size_t i = 0; i < count; ++i)
+		order[i] = static_cast<uint32_t>(i);
+
+	// resize keeps the capacity, so once the input size has been seen this doesn't allocate.
+	scratch.order.resize(count);
+	scratch.histograms.resize(threadCount);
+	std::vector<Histogram>& histograms = scratch.histograms;
+
+	// Splits [0, count) into threadCount contiguous chunks and runs job(thread, begin, end) on each.
+	auto parallelFor = [&](auto job)
+	{
+		std::vector<std::thread> threads;
+		for (unsigned t = 1; t < threadCount; ++t)
+			threads.emplace_back(job, t, count * t / threadCount, count * (t + 1) / threadCount);
+
+		// The calling thread does the first chunk itself.
+		job(0u, size_t(0), count / threadCount);
+
+		for (std::thread& thread : threads)
+			thread.join();
+	};
+
+	std::vector<uint32_t>* src = &order;
+	std::vector<uint32_t>* dst = &scratch.order;
+
+	for (unsigned shift = 0; shift < 16; shift += 8)
+	{
+		parallelFor([&](unsigned t, size_t begin, size_t end)
+		{
+			Histogram& histogram = histograms[t];
+			histogram.fill(0);
+
+			for (size_t i = begin; i < end; ++i)
+				++histogram[(keys[(*src)[i]] >> shift) & 0xFF];
+		});
+
+		// All keys in one bucket (e.g. every instance at about the same depth): this pass wouldn't move anything.
+		bool trivial = false;
+		for (uint32_t digit = 0; digit < 256 && !trivial; ++digit)
+		{
+			uint32_t total = 0;
+			for (const Histogram& histogram : histograms)
+				total += histogram[digit];
+			trivial = total == count;
+		}
+
+		if (trivial)
+			continue;
+
+		/*
+		Turn the counts into write offsets. Digit-major, then thread order,
+		so thread t writes its keys for a digit right after thread t - 1's: that keeps the sort stable.
+		*/
+		uint32_t offset = 0;
+		for (uint32_t digit = 0; digit < 256; ++digit)
+		{
+			for (Histogram& histogram : histograms)
+			{
+				uint32_t digitCount = histogram[digit];
+				histogram[digit] = offset;
+				offset += digitCount;
+			}
+		}
+
+		parallelFor([&](unsigned t, size_t begin, size_t end)
+		{
+			Histogram& offsets = histograms[t];
+
+			for (size_t i = begin; i < end; ++i)
+			{
+				uint32_t index = (*src)[i];
+				(*dst)[offsets[(keys[index] >> shift) & 0xFF]++] = index;
+			}
+		});
+
+		std::swap(src, dst);
+	}
+
+	if (src != &order)
+		order.swap(scratch.order);
+}
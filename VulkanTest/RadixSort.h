@@ -0,0 +1,29 @@
+/*
+RadixSort.h
+Parallel LSD radix sort on 16 bit keys, used to sort instances front to back every frame.
+*/
+
+#ifndef RADIX_SORT_H
+#define RADIX_SORT_H
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+// Working memory of radixSort16. Keep one around between calls so sorting every frame doesn't allocate.
+struct RadixSortScratch
+{
+	std::vector<uint32_t> order; // The other half of the ping-pong between passes.
+	std::vector<std::array<uint32_t, 256>> histograms; // One per thread.
+};
+
+/*
+Fills order with the indices 0..keys.size()-1, sorted by ascending key. The sort is stable.
+Two passes of 8 bits. Each pass splits the keys into one chunk per thread: every thread counts its chunk,
+the counts are turned into per thread write offsets, then every thread scatters its chunk.
+threadCount = 0 picks one thread per core. Inputs below a few tens of thousands of keys (like the per frame instance sort)
+are sorted on the calling thread, starting and joining threads costs more than sorting them.
+*/
+void radixSort16(const std::vector<uint16_t>& keys, std::vector<uint32_t>& order, RadixSortScratch& scratch, unsigned threadCount = 0);
+
+#endif // !RADIX_SORT_H
@@ -0,0 +1,1066 @@
+/*
+RenderGraph.cpp
+definitions for the functions in RenderGraph.h
+*/
+
+#include "RenderGraph.h"
+
+#include <algorithm>
+#include <array>
+
+// Every access bit that writes memory. Anything else is a read.
+static const VkAccessFlags WRITE_ACCESS_MASK =
+	VK_ACCESS_SHADER_WRITE_BIT |
+	VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT |
+	VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT |
+	VK_ACCESS_TRANSFER_WRITE_BIT |
+	VK_ACCESS_HOST_WRITE_BIT |
+	VK_ACCESS_MEMORY_WRITE_BIT;
+
+ImageAccess getImageAccess(ResourceUsage usage)
+{
+	/*
+	Depth tests can happen in the early or the late fragment test stage depending on the shader,
+	so depth accesses always cover both.
+	Color attachments are read as well as written, because blending and LOAD_OP_LOAD read them.
+	*/
+	switch (usage)
+	{
+	case ResourceUsage::ColorAttachment:
+		return { VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL };
+	case ResourceUsage::DepthAttachment:
+		return { VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT,
+			VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL };
+	case ResourceUsage::DepthAttachmentReadOnly:
+		return { VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT,
+			VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT, VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL };
+	case ResourceUsage::ResolveAttachment:
+		return { VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL };
+	case ResourceUsage::SampledFragment:
+		return { VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL };
+	case ResourceUsage::SampledCompute:
+		return { VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL };
+	case ResourceUsage::StorageRead:
+		return { VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT, VK_IMAGE_LAYOUT_GENERAL };
+	case ResourceUsage::StorageWrite:
+		return { VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT, VK_IMAGE_LAYOUT_GENERAL };
+	case ResourceUsage::TransferSrc:
+		return { VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_READ_BIT, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL };
+	case ResourceUsage::TransferDst:
+		return { VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL };
+	case ResourceUsage::Present:
+		// The presentation engine synchronizes through the semaphore, so nothing has to be made visible here.
+		return { VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, VK_IMAGE_LAYOUT_PRESENT_SRC_KHR };
+	}
+
+	throw std::invalid_argument("unknown resource usage!");
+}
+
+ImageAccess getLayoutAccess(VkImageLayout layout)
+{
+	switch (layout)
+	{
+	case VK_IMAGE_LAYOUT_UNDEFINED:
+		// Nothing to wait on, the old contents are thrown away.
+		return { VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, 0, layout };
+	case VK_IMAGE_LAYOUT_PREINITIALIZED:
+		return { VK_PIPELINE_STAGE_HOST_BIT, VK_ACCESS_HOST_WRITE_BIT, layout };
+	case VK_IMAGE_LAYOUT_GENERAL:
+		return { VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT, layout };
+	case VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL:
+		return getImageAccess(ResourceUsage::ColorAttachment);
+	case VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL:
+		return getImageAccess(ResourceUsage::DepthAttachment);
+	case VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL:
+		return { VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+			VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_SHADER_READ_BIT, layout };
+	case VK_IMAGE_LAYOUT_DEPTH_READ_ONLY_STENCIL_ATTACHMENT_OPTIMAL:
+	case VK_IMAGE_LAYOUT_DEPTH_ATTACHMENT_STENCIL_READ_ONLY_OPTIMAL:
+		// One aspect is written as an attachment, the other one can also be sampled.
+		return { VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+			VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT | VK_ACCESS_SHADER_READ_BIT, layout };
+	case VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL:
+		return getImageAccess(ResourceUsage::SampledFragment);
+	case VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL:
+		return getImageAccess(ResourceUsage::TransferSrc);
+	case VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL:
+		return getImageAccess(ResourceUsage::TransferDst);
+	case VK_IMAGE_LAYOUT_PRESENT_SRC_KHR:
+		return getImageAccess(ResourceUsage::Present);
+	case VK_IMAGE_LAYOUT_SHARED_PRESENT_KHR:
+		// Rendered to and presented at the same time, so it's used like a color attachment.
+		return { VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT, layout };
+	default:
+		throw std::invalid_argument("unsupported image layout!");
+	}
+}
+
+bool isWriteAccess(VkAccessFlags access)
+{
+	return (access & WRITE_ACCESS_MASK) != 0;
+}
+
+bool isDepthFormat(VkFormat format)
+{
+	return format == VK_FORMAT_D16_UNORM || format == VK_FORMAT_D32_SFLOAT || format == VK_FORMAT_D16_UNORM_S8_UINT ||
+		format == VK_FORMAT_D24_UNORM_S8_UINT || format == VK_FORMAT_D32_SFLOAT_S8_UINT;
+}
+
+bool isStencilFormat(VkFormat format)
+{
+	return format == VK_FORMAT_S8_UINT || format == VK_FORMAT_D16_UNORM_S8_UINT || format == VK_FORMAT_D24_UNORM_S8_UINT || format == VK_FORMAT_D32_SFLOAT_S8_UINT;
+}
+
+// Image usage flags a resource needs to support a usage.
+static VkImageUsageFlags getImageUsageFlags(ResourceUsage usage)
+{
+	switch (usage)
+	{
+	case ResourceUsage::ColorAttachment:
+	case ResourceUsage::ResolveAttachment:
+		return VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+	case ResourceUsage::DepthAttachment:
+	case ResourceUsage::DepthAttachmentReadOnly:
+		return VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
+	case ResourceUsage::SampledFragment:
+	case ResourceUsage::SampledCompute:
+		return VK_IMAGE_USAGE_SAMPLED_BIT;
+	case ResourceUsage::StorageRead:
+	case ResourceUsage::StorageWrite:
+		return VK_IMAGE_USAGE_STORAGE_BIT;
+	case ResourceUsage::TransferSrc:
+		return VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+	case ResourceUsage::TransferDst:
+		return VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+	default:
+		return 0;
+	}
+}
+
+static bool isAttachmentUsage(ResourceUsage usage)
+{
+	return usage == ResourceUsage::ColorAttachment || usage == ResourceUsage::DepthAttachment ||
+		usage == ResourceUsage::DepthAttachmentReadOnly || usage == ResourceUsage::ResolveAttachment;
+}
+
+static VkDeviceSize alignUp(VkDeviceSize value, VkDeviceSize alignment)
+{
+	return (value + alignment - 1) / alignment * alignment;
+}
+
+void RenderGraph::init(VkDevice device, VkPhysicalDevice physDevice)
+{
+	mDevice = device;
+	mPhysDevice = physDevice;
+}
+
+RenderGraph::ResourceHandle RenderGraph::createImage(const std::string& name, const ImageDesc& desc)
+{
+	Resource resource;
+	resource.name = name;
+	resource.desc = desc;
+	resource.imported = false;
+	resource.usage = desc.extraUsage;
+	resource.aspect = isDepthFormat(desc.format) ? VK_IMAGE_ASPECT_DEPTH_BIT : VK_IMAGE_ASPECT_COLOR_BIT;
+
+	if (isStencilFormat(desc.format))
+		resource.aspect |= VK_IMAGE_ASPECT_STENCIL_BIT;
+
+	mResources.push_back(resource);
+	return static_cast<ResourceHandle>(mResources.size() - 1);
+}
+
+RenderGraph::ResourceHandle RenderGraph::importImage(const std::string& name, const ImageDesc& desc, const std::vector<VkImage>& images, const std::vector<VkImageView>& views,
+	VkImageLayout initialLayout, VkImageLayout finalLayout, VkPipelineStageFlags initialStages)
+{
+	if (images.empty() || images.size() != views.size())
+		throw std::invalid_argument("imported images need one view per image!");
+
+	ResourceHandle handle = createImage(name, desc);
+
+	Resource& resource = mResources[handle];
+	resource.imported = true;
+	resource.images = images;
+	resource.views = views;
+	resource.initialLayout = initialLayout;
+	resource.finalLayout = finalLayout;
+	resource.initialStages = initialStages;
+
+	return handle;
+}
+
+RenderGraph::PassHandle RenderGraph::addPass(const std::string& name, RecordFunction record)
+{
+	Pass pass;
+	pass.name = name;
+	pass.record = record;
+
+	mPasses.push_back(pass);
+	return static_cast<PassHandle>(mPasses.size() - 1);
+}
+
+void RenderGraph::addRef(PassHandle pass, ResourceHandle image, ResourceUsage usage, const VkClearValue* clear, uint32_t layer)
+{
+	if (pass >= mPasses.size() || image >= mResources.size())
+		throw std::out_of_range("invalid render graph handle!");
+
+	if (layer != ALL_LAYERS && layer >= mResources[image].desc.layers)
+		throw std::out_of_range("layer is out of range for " + mResources[image].name + "!");
+
+	ResourceRef ref = {};
+	ref.resource = image;
+	ref.usage = usage;
+	ref.layer = layer;
+	ref.clear = clear != nullptr;
+
+	if (clear)
+		ref.clearValue = *clear;
+
+	mPasses[pass].refs.push_back(ref);
+	mResources[image].usage |= getImageUsageFlags(usage);
+}
+
+void RenderGraph::addColorOutput(PassHandle pass, ResourceHandle image, const VkClearColorValue* clear, uint32_t layer)
+{
+	VkClearValue value = {};
+	if (clear)
+		value.color = *clear;
+
+	addRef(pass, image, ResourceUsage::ColorAttachment, clear ? &value : nullptr, layer);
+}
+
+void RenderGraph::addDepthOutput(PassHandle pass, ResourceHandle image, const VkClearDepthStencilValue* clear, uint32_t layer)
+{
+	VkClearValue value = {};
+	if (clear)
+		value.depthStencil = *clear;
+
+	addRef(pass, image, ResourceUsage::DepthAttachment, clear ? &value : nullptr, layer);
+}
+
+void RenderGraph::addDepthInput(PassHandle pass, ResourceHandle image)
+{
+	addRef(pass, image, ResourceUsage::DepthAttachmentReadOnly, nullptr);
+}
+
+void RenderGraph::addResolveOutput(PassHandle pass, ResourceHandle image)
+{
+	addRef(pass, image, ResourceUsage::ResolveAttachment, nullptr);
+}
+
+void RenderGraph::addUsage(PassHandle pass, ResourceHandle image, ResourceUsage usage)
+{
+	if (isAttachmentUsage(usage))
+		throw std::invalid_argument("use the attachment helpers for attachments!");
+
+	addRef(pass, image, usage, nullptr);
+}
+
+void RenderGraph::setSideEffects(PassHandle pass)
+{
+	mPasses[pass].sideEffects = true;
+}
+
+VkImage RenderGraph::getImage(ResourceHandle image, uint32_t frameIndex) const
+{
+	const Resource& resource = mResources[image];
+	if (resource.images.empty())
+		return VK_NULL_HANDLE;
+
+	return resource.images[frameIndex % resource.images.size()];
+}
+
+VkImageView RenderGraph::getImageView(ResourceHandle image, uint32_t frameIndex) const
+{
+	const Resource& resource = mResources[image];
+	if (resource.views.empty())
+		return VK_NULL_HANDLE;
+
+	return resource.views[frameIndex % resource.views.size()];
+}
+
+void RenderGraph::compile()
+{
+	if (mCompiled)
+		releaseVulkanObjects();
+
+	cullPasses();
+	computeLifetimes();
+	createTransientImages();
+	aliasTransientMemory();
+	computeBarriers();
+	createRenderPasses();
+
+	mCompiled = true;
+}
+
+void RenderGraph::cullPasses()
+{
+	/*
+	Reference counting, straight out of the Frostbite talk:
+	a pass is referenced by every resource it writes, a resource by every pass that reads it.
+	Imported resources are the outputs of the frame, so they get an extra reference.
+	Anything that ends up with zero references can't affect the output and is culled.
+	*/
+	for (Resource& resource : mResources)
+	{
+		resource.refCount = resource.imported ? 1 : 0;
+		resource.writers.clear();
+	}
+
+	for (PassHandle p = 0; p < mPasses.size(); ++p)
+	{
+		Pass& pass = mPasses[p];
+		pass.culled = false;
+		pass.refCount = 0;
+
+		for (const ResourceRef& ref : pass.refs)
+		{
+			if (isWriteAccess(getImageAccess(ref.usage).access))
+			{
+				++pass.refCount;
+				mResources[ref.resource].writers.push_back(p);
+			}
+			else
+				++mResources[ref.resource].refCount;
+		}
+	}
+
+	std::vector<ResourceHandle> unreferenced;
+	for (ResourceHandle r = 0; r < mResources.size(); ++r)
+		if (mResources[r].refCount == 0)
+			unreferenced.push_back(r);
+
+	// A pass that doesn't write anything and has no side effects is dead from the start.
+	auto cullPass = [&](PassHandle p)
+	{
+		Pass& pass = mPasses[p];
+		pass.culled = true;
+
+		for (const ResourceRef& ref : pass.refs)
+			if (!isWriteAccess(getImageAccess(ref.usage).access) && --mResources[ref.resource].refCount == 0)
+				unreferenced.push_back(ref.resource);
+	};
+
+	for (PassHandle p = 0; p < mPasses.size(); ++p)
+		if (mPasses[p].refCount == 0 && !mPasses[p].sideEffects)
+			cullPass(p);
+
+	while (!unreferenced.empty())
+	{
+		ResourceHandle r = unreferenced.back();
+		unreferenced.pop_back();
+
+		for (PassHandle writer : mResources[r].writers)
+		{
+			Pass& pass = mPasses[writer];
+			if (pass.culled || pass.sideEffects)
+				continue;
+
+			if (--pass.refCount == 0)
+				cullPass(writer);
+		}
+	}
+}
+
+void RenderGraph::computeLifetimes()
+{
+	for (Resource& resource : mResources)
+	{
+		resource.firstPass = INVALID_INDEX;
+		resource.lastPass = INVALID_INDEX;
+	}
+
+	for (PassHandle p = 0; p < mPasses.size(); ++p)
+	{
+		if (mPasses[p].culled)
+			continue;
+
+		for (const ResourceRef& ref : mPasses[p].refs)
+		{
+			Resource& resource = mResources[ref.resource];
+			if (resource.firstPass == INVALID_INDEX)
+				resource.firstPass = p;
+			resource.lastPass = p;
+		}
+	}
+}
+
+void RenderGraph::createTransientImages()
+{
+	for (Resource& resource : mResources)
+	{
+		if (resource.imported || resource.firstPass == INVALID_INDEX)
+			continue;
+
+		/*
+		An image that is only ever an attachment of a single pass never has to be loaded or stored,
+		so the driver is free to keep it in tile memory.
+		*/
+		VkImageUsageFlags attachmentBits = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
+		VkImageUsageFlags usage = resource.usage;
+		if ((usage & ~attachmentBits) == 0 && resource.firstPass == resource.lastPass)
+			usage |= VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT;
+
+		VkImageCreateInfo imageInfo = {};
+		imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+		imageInfo.flags = resource.desc.flags;
+		imageInfo.imageType = VK_IMAGE_TYPE_2D;
+		imageInfo.format = resource.desc.format;
+		imageInfo.extent.width = resource.desc.extent.width;
+		imageInfo.extent.height = resource.desc.extent.height;
+		imageInfo.extent.depth = 1;
+		imageInfo.mipLevels = 1;
+		imageInfo.arrayLayers = resource.desc.layers;
+		imageInfo.samples = resource.desc.samples;
+		imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+		imageInfo.usage = usage;
+		imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+		imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+		VkImage image;
+		if (vkCreateImage(mDevice, &imageInfo, nullptr, &image) != VK_SUCCESS)
+			throw std::runtime_error("failed to create render graph image " + resource.name + "!");
+
+		vkGetImageMemoryRequirements(mDevice, image, &resource.memRequirements);
+		resource.images.assign(1, image);
+	}
+}
+
+void RenderGraph::aliasTransientMemory()
+{
+	/*
+	Transient images whose lifetimes ([firstPass, lastPass]) don't overlap can share the same memory.
+	For every memory type we place the images largest first, each one at the lowest offset that doesn't
+	collide with an already placed image that is alive at the same time. That's a greedy interval packing,
+	not optimal, but it's what most engines ship with.
+	*/
+	std::vector<ResourceHandle> transients;
+	for (ResourceHandle r = 0; r < mResources.size(); ++r)
+		if (!mResources[r].imported && !mResources[r].images.empty())
+			transients.push_back(r);
+
+	std::sort(transients.begin(), transients.end(), [this](ResourceHandle a, ResourceHandle b)
+	{
+		return mResources[a].memRequirements.size > mResources[b].memRequirements.size;
+	});
+
+	mTransientMemorySize = 0;
+	mTransientMemoryUnaliased = 0;
+
+	std::vector<std::vector<ResourceHandle>> placed;
+	for (ResourceHandle r : transients)
+	{
+		Resource& resource = mResources[r];
+		uint32_t memoryType = findMemoryType(resource.memRequirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+		uint32_t block = INVALID_INDEX;
+		for (uint32_t b = 0; b < mMemoryBlocks.size(); ++b)
+			if (mMemoryBlocks[b].memoryTypeIndex == memoryType)
+				block = b;
+
+		if (block == INVALID_INDEX)
+		{
+			mMemoryBlocks.push_back({ memoryType, 0, VK_NULL_HANDLE });
+			placed.emplace_back();
+			block = static_cast<uint32_t>(mMemoryBlocks.size() - 1);
+		}
+
+		VkDeviceSize size = resource.memRequirements.size;
+		VkDeviceSize alignment = resource.memRequirements.alignment;
+
+		// Candidate offsets: the start of the block, and right after every image we could collide with.
+		std::vector<VkDeviceSize> candidates = { 0 };
+		for (ResourceHandle other : placed[block])
+			candidates.push_back(alignUp(mResources[other].memoryOffset + mResources[other].memRequirements.size, alignment));
+		std::sort(candidates.begin(), candidates.end());
+
+		VkDeviceSize offset = 0;
+		for (VkDeviceSize candidate : candidates)
+		{
+			bool fits = true;
+			for (ResourceHandle other : placed[block])
+			{
+				const Resource& o = mResources[other];
+				bool livesTogether = resource.firstPass <= o.lastPass && o.firstPass <= resource.lastPass;
+				bool overlaps = candidate < o.memoryOffset + o.memRequirements.size && o.memoryOffset < candidate + size;
+
+				if (livesTogether && overlaps)
+				{
+					fits = false;
+					break;
+				}
+			}
+
+			if (fits)
+			{
+				offset = candidate;
+				break;
+			}
+		}
+
+		resource.memoryBlock = block;
+		resource.memoryOffset = offset;
+		placed[block].push_back(r);
+
+		mMemoryBlocks[block].size = std::max(mMemoryBlocks[block].size, offset + size);
+		mTransientMemoryUnaliased += size;
+	}
+
+	for (MemoryBlock& block : mMemoryBlocks)
+	{
+		VkMemoryAllocateInfo allocInfo = {};
+		allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+		allocInfo.allocationSize = block.size;
+		allocInfo.memoryTypeIndex = block.memoryTypeIndex;
+
+		if (vkAllocateMemory(mDevice, &allocInfo, nullptr, &block.memory) != VK_SUCCESS)
+			throw std::runtime_error("failed to allocate render graph memory!");
+
+		mTransientMemorySize += block.size;
+	}
+
+	for (ResourceHandle r : transients)
+	{
+		Resource& resource = mResources[r];
+		vkBindImageMemory(mDevice, resource.images[0], mMemoryBlocks[resource.memoryBlock].memory, resource.memoryOffset);
+
+		// Views only ever look at the depth aspect of depth/stencil images, that's what samplers and attachments want.
+		VkImageViewCreateInfo viewInfo = {};
+		viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+		viewInfo.image = resource.images[0];
+		viewInfo.viewType = resource.desc.viewType;
+		viewInfo.format = resource.desc.format;
+		viewInfo.subresourceRange.aspectMask = (resource.aspect & VK_IMAGE_ASPECT_DEPTH_BIT) ? VK_IMAGE_ASPECT_DEPTH_BIT : resource.aspect;
+		viewInfo.subresourceRange.baseMipLevel = 0;
+		viewInfo.subresourceRange.levelCount = 1;
+		viewInfo.subresourceRange.baseArrayLayer = 0;
+		viewInfo.subresourceRange.layerCount = resource.desc.layers;
+
+		VkImageView view;
+		if (vkCreateImageView(mDevice, &viewInfo, nullptr, &view) != VK_SUCCESS)
+			throw std::runtime_error("failed to create render graph image view " + resource.name + "!");
+
+		resource.views.assign(1, view);
+	}
+}
+
+void RenderGraph::appendBarrier(BarrierBatch& batch, const PlannedBarrier& barrier)
+{
+	// Neighbouring layers of the same image that go through the same transition share one VkImageMemoryBarrier.
+	if (!batch.barriers.empty())
+	{
+		PlannedBarrier& last = batch.barriers.back();
+		if (last.resource == barrier.resource && last.srcAccess == barrier.srcAccess && last.dstAccess == barrier.dstAccess &&
+			last.oldLayout == barrier.oldLayout && last.newLayout == barrier.newLayout && last.baseLayer + last.layerCount == barrier.baseLayer)
+		{
+			last.layerCount += barrier.layerCount;
+			return;
+		}
+	}
+
+	batch.barriers.push_back(barrier);
+}
+
+void RenderGraph::computeBarriers()
+{
+	/*
+	Walk the surviving passes in order and keep track of what happened to every layer of every image last.
+	A barrier is only emitted when it is actually needed:
+
+	- layout change or write after anything: wait for the previous writes and reads, transition if needed.
+	- read after write: make the write visible to the new stage, once. Later reads from the same stages are free.
+	- read after read in the same layout: nothing at all.
+	*/
+	struct TrackedState
+	{
+		VkImageLayout layout;
+		VkPipelineStageFlags writeStages; // Stages of the last write (or layout transition).
+		VkAccessFlags writeAccess;        // Writes that still have to be made available.
+		VkPipelineStageFlags readStages;  // Reads since the last write, a future write has to wait for them.
+		VkPipelineStageFlags visibleStages;
+		VkAccessFlags visibleAccess;
+	};
+
+	struct MergedRef
+	{
+		ResourceHandle resource;
+		uint32_t layer;
+		ImageAccess access;
+	};
+
+	// Merge all references a pass makes to one image (layer) into a single access.
+	auto mergeRefs = [this](const Pass& pass)
+	{
+		std::vector<MergedRef> merged;
+		for (const ResourceRef& ref : pass.refs)
+		{
+			ImageAccess access = getImageAccess(ref.usage);
+
+			auto it = std::find_if(merged.begin(), merged.end(), [&](const MergedRef& m) { return m.resource == ref.resource && m.layer == ref.layer; });
+			if (it == merged.end())
+				merged.push_back({ ref.resource, ref.layer, access });
+			else if (it->access.layout != access.layout)
+				throw std::runtime_error("pass " + pass.name + " uses " + mResources[ref.resource].name + " in two different layouts!");
+			else
+			{
+				it->access.stages |= access.stages;
+				it->access.access |= access.access;
+			}
+		}
+		return merged;
+	};
+
+	auto simulate = [&](bool record)
+	{
+		std::vector<std::vector<TrackedState>> states(mResources.size());
+		for (ResourceHandle r = 0; r < mResources.size(); ++r)
+		{
+			const Resource& resource = mResources[r];
+			TrackedState initial = { resource.initialLayout, resource.initialStages, resource.initialAccess, 0, 0, 0 };
+			states[r].assign(resource.desc.layers, initial);
+		}
+
+		for (Pass& pass : mPasses)
+		{
+			pass.barriers = BarrierBatch();
+			if (pass.culled)
+				continue;
+
+			for (const MergedRef& m : mergeRefs(pass))
+			{
+				const ImageAccess& access = m.access;
+				bool write = isWriteAccess(access.access);
+
+				uint32_t firstLayer = m.layer == ALL_LAYERS ? 0 : m.layer;
+				uint32_t lastLayer = m.layer == ALL_LAYERS ? mResources[m.resource].desc.layers : m.layer + 1;
+
+				for (uint32_t layer = firstLayer; layer < lastLayer; ++layer)
+				{
+					TrackedState& state = states[m.resource][layer];
+					bool layoutChange = state.layout != access.layout;
+
+					if (write || layoutChange)
+					{
+						VkPipelineStageFlags srcStages = state.writeStages | state.readStages;
+						if (srcStages != 0 || layoutChange)
+						{
+							pass.barriers.srcStages |= srcStages;
+							pass.barriers.dstStages |= access.stages;
+
+							// A write-after-read with no layout change only needs the execution dependency.
+							if (layoutChange || state.writeAccess != 0)
+								appendBarrier(pass.barriers, { m.resource, state.writeAccess, access.access, state.layout, access.layout, layer, 1 });
+						}
+
+						state.layout = access.layout;
+						state.writeStages = access.stages;
+						state.writeAccess = access.access & WRITE_ACCESS_MASK;
+						state.readStages = write ? 0 : access.stages;
+						state.visibleStages = access.stages;
+						state.visibleAccess = access.access;
+					}
+					else
+					{
+						bool invisible = (access.stages & ~state.visibleStages) != 0 || (access.access & ~state.visibleAccess) != 0;
+						if (state.writeStages != 0 && invisible)
+						{
+							pass.barriers.srcStages |= state.writeStages;
+							pass.barriers.dstStages |= access.stages;
+
+							if (state.writeAccess != 0)
+								appendBarrier(pass.barriers, { m.resource, state.writeAccess, access.access, state.layout, state.layout, layer, 1 });
+
+							state.visibleStages |= access.stages;
+							state.visibleAccess |= access.access;
+						}
+
+						state.readStages |= access.stages;
+					}
+				}
+			}
+		}
+
+		mFinalBarriers = BarrierBatch();
+		for (ResourceHandle r = 0; r < mResources.size(); ++r)
+		{
+			Resource& resource = mResources[r];
+			resource.finalStages = 0;
+			resource.finalAccess = 0;
+
+			for (uint32_t layer = 0; layer < resource.desc.layers; ++layer)
+			{
+				const TrackedState& state = states[r][layer];
+				VkPipelineStageFlags stages = state.writeStages | state.readStages;
+
+				resource.finalStages |= stages;
+				resource.finalAccess |= state.writeAccess;
+
+				if (!record || !resource.imported || resource.firstPass == INVALID_INDEX)
+					continue;
+
+				if (resource.finalLayout != VK_IMAGE_LAYOUT_UNDEFINED && resource.finalLayout != state.layout)
+				{
+					ImageAccess dst = getLayoutAccess(resource.finalLayout);
+					mFinalBarriers.srcStages |= stages;
+					mFinalBarriers.dstStages |= dst.stages;
+					appendBarrier(mFinalBarriers, { r, state.writeAccess, dst.access, state.layout, resource.finalLayout, layer, 1 });
+				}
+			}
+		}
+	};
+
+	// First pass to learn how every transient is left at the end of the frame.
+	simulate(false);
+
+	/*
+	Transients are discarded at the start of a frame, but the memory might still be in use:
+	by the previous frame's use of the same image, or by another image aliasing the same bytes earlier in this frame.
+	So the first barrier on a transient waits on everything that last touched any overlapping memory.
+	*/
+	for (ResourceHandle r = 0; r < mResources.size(); ++r)
+	{
+		Resource& resource = mResources[r];
+		if (resource.imported || resource.memoryBlock == INVALID_INDEX)
+			continue;
+
+		resource.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+		resource.initialStages = 0;
+		resource.initialAccess = 0;
+
+		for (const Resource& other : mResources)
+		{
+			if (other.imported || other.memoryBlock != resource.memoryBlock)
+				continue;
+
+			bool overlaps = resource.memoryOffset < other.memoryOffset + other.memRequirements.size &&
+				other.memoryOffset < resource.memoryOffset + resource.memRequirements.size;
+
+			if (overlaps)
+			{
+				resource.initialStages |= other.finalStages;
+				resource.initialAccess |= other.finalAccess;
+			}
+		}
+	}
+
+	simulate(true);
+}
+
+VkImageView RenderGraph::createLayerView(const Resource& resource, VkImage image, uint32_t layer)
+{
+	VkImageViewCreateInfo viewInfo = {};
+	viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+	viewInfo.image = image;
+	viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+	viewInfo.format = resource.desc.format;
+	viewInfo.subresourceRange.aspectMask = (resource.aspect & VK_IMAGE_ASPECT_DEPTH_BIT) ? resource.aspect : VK_IMAGE_ASPECT_COLOR_BIT;
+	viewInfo.subresourceRange.baseMipLevel = 0;
+	viewInfo.subresourceRange.levelCount = 1;
+	viewInfo.subresourceRange.baseArrayLayer = layer;
+	viewInfo.subresourceRange.layerCount = 1;
+
+	VkImageView view;
+	if (vkCreateImageView(mDevice, &viewInfo, nullptr, &view) != VK_SUCCESS)
+		throw std::runtime_error("failed to create layer view of " + resource.name + "!");
+
+	return view;
+}
+
+void RenderGraph::createRenderPasses()
+{
+	std::vector<bool> hasContents(mResources.size());
+	for (ResourceHandle r = 0; r < mResources.size(); ++r)
+		hasContents[r] = mResources[r].imported && mResources[r].initialLayout != VK_IMAGE_LAYOUT_UNDEFINED;
+
+	for (PassHandle p = 0; p < mPasses.size(); ++p)
+	{
+		Pass& pass = mPasses[p];
+		if (pass.culled)
+			continue;
+
+		std::vector<VkAttachmentDescription> attachments;
+		std::vector<VkAttachmentReference> colorRefs;
+		std::vector<VkAttachmentReference> resolveRefs;
+		VkAttachmentReference depthRef = {};
+		bool hasDepth = false;
+		std::vector<const ResourceRef*> attachmentRefs;
+
+		// Color attachments go first so that their index matches layout(location = N) in the fragment shader,
+		// then resolves (in the same order), then depth.
+		std::array<ResourceUsage, 4> order = { ResourceUsage::ColorAttachment, ResourceUsage::ResolveAttachment, ResourceUsage::DepthAttachment, ResourceUsage::DepthAttachmentReadOnly };
+		for (ResourceUsage kind : order)
+		{
+			for (const ResourceRef& ref : pass.refs)
+			{
+				if (ref.usage != kind)
+					continue;
+
+				const Resource& resource = mResources[ref.resource];
+				ImageAccess access = getImageAccess(ref.usage);
+
+				// Only store what someone after us (or outside the graph) is going to look at.
+				bool needed = resource.imported || resource.lastPass > p;
+
+				VkAttachmentDescription attachment = {};
+				attachment.format = resource.desc.format;
+				attachment.samples = resource.desc.samples;
+
+				if (ref.clear)
+					attachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+				else if (hasContents[ref.resource] && kind != ResourceUsage::ResolveAttachment)
+					attachment.loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
+				else
+					attachment.loadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+
+				attachment.storeOp = needed ? VK_ATTACHMENT_STORE_OP_STORE : VK_ATTACHMENT_STORE_OP_DONT_CARE;
+
+				bool stencil = isStencilFormat(resource.desc.format);
+				attachment.stencilLoadOp = stencil ? attachment.loadOp : VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+				attachment.stencilStoreOp = stencil ? attachment.storeOp : VK_ATTACHMENT_STORE_OP_DONT_CARE;
+
+				// The graph already put the image in the right layout with a barrier, the render pass doesn't transition anything.
+				attachment.initialLayout = access.layout;
+				attachment.finalLayout = access.layout;
+
+				VkAttachmentReference attachmentRef = {};
+				attachmentRef.attachment = static_cast<uint32_t>(attachments.size());
+				attachmentRef.layout = access.layout;
+
+				if (kind == ResourceUsage::ColorAttachment)
+					colorRefs.push_back(attachmentRef);
+				else if (kind == ResourceUsage::ResolveAttachment)
+					resolveRefs.push_back(attachmentRef);
+				else
+				{
+					if (hasDepth)
+						throw std::runtime_error("pass " + pass.name + " has more than one depth attachment!");
+					depthRef = attachmentRef;
+					hasDepth = true;
+				}
+
+				VkClearValue clearValue = ref.clearValue;
+				pass.clearValues.push_back(clearValue);
+				attachments.push_back(attachment);
+				attachmentRefs.push_back(&ref);
+
+				if (isWriteAccess(access.access))
+					hasContents[ref.resource] = true;
+			}
+		}
+
+		// Non-attachment writes count as contents too (a compute pass writing an image a later pass loads).
+		for (const ResourceRef& ref : pass.refs)
+			if (!isAttachmentUsage(ref.usage) && isWriteAccess(getImageAccess(ref.usage).access))
+				hasContents[ref.resource] = true;
+
+		if (attachments.empty())
+			continue;
+
+		if (!resolveRefs.empty() && resolveRefs.size() != colorRefs.size())
+			throw std::runtime_error("pass " + pass.name + " needs one resolve attachment per color attachment!");
+
+		VkSubpassDescription subpass = {};
+		subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+		subpass.colorAttachmentCount = static_cast<uint32_t>(colorRefs.size());
+		subpass.pColorAttachments = colorRefs.data();
+		subpass.pResolveAttachments = resolveRefs.empty() ? nullptr : resolveRefs.data();
+		subpass.pDepthStencilAttachment = hasDepth ? &depthRef : nullptr;
+
+		VkRenderPassCreateInfo renderPassInfo = {};
+		renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+		renderPassInfo.attachmentCount = static_cast<uint32_t>(attachments.size());
+		renderPassInfo.pAttachments = attachments.data();
+		renderPassInfo.subpassCount = 1;
+		renderPassInfo.pSubpasses = &subpass;
+		renderPassInfo.dependencyCount = 0; // Barriers are recorded by the graph outside of the render pass.
+
+		if (vkCreateRenderPass(mDevice, &renderPassInfo, nullptr, &pass.renderPass) != VK_SUCCESS)
+			throw std::runtime_error("failed to create render pass for " + pass.name + "!");
+
+		// All attachments of a framebuffer have to be (at least) as big as the render area.
+		pass.extent = mResources[attachmentRefs[0]->resource].desc.extent;
+		size_t variants = 1;
+		for (const ResourceRef* ref : attachmentRefs)
+		{
+			const ImageDesc& desc = mResources[ref->resource].desc;
+			if (desc.extent.width != pass.extent.width || desc.extent.height != pass.extent.height)
+				throw std::runtime_error("attachments of pass " + pass.name + " have different sizes!");
+
+			variants = std::max(variants, mResources[ref->resource].views.size());
+		}
+
+		// One framebuffer per swap chain image (or just one if nothing imported is attached).
+		pass.framebuffers.resize(variants);
+		for (size_t v = 0; v < variants; ++v)
+		{
+			std::vector<VkImageView> views;
+			for (const ResourceRef* ref : attachmentRefs)
+			{
+				if (ref->layer == ALL_LAYERS)
+					views.push_back(getImageView(ref->resource, static_cast<uint32_t>(v)));
+				else
+				{
+					const Resource& resource = mResources[ref->resource];
+					pass.attachmentViews.push_back(createLayerView(resource, getImage(ref->resource, static_cast<uint32_t>(v)), ref->layer));
+					views.push_back(pass.attachmentViews.back());
+				}
+			}
+
+			VkFramebufferCreateInfo framebufferInfo = {};
+			framebufferInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+			framebufferInfo.renderPass = pass.renderPass;
+			framebufferInfo.attachmentCount = static_cast<uint32_t>(views.size());
+			framebufferInfo.pAttachments = views.data();
+			framebufferInfo.width = pass.extent.width;
+			framebufferInfo.height = pass.extent.height;
+			framebufferInfo.layers = 1;
+
+			if (vkCreateFramebuffer(mDevice, &framebufferInfo, nullptr, &pass.framebuffers[v]) != VK_SUCCESS)
+				throw std::runtime_error("failed to create framebuffer for " + pass.name + "!");
+		}
+	}
+}
+
+void RenderGraph::recordBarriers(VkCommandBuffer commandBuffer, const BarrierBatch& batch, uint32_t frameIndex)
+{
+	if (batch.srcStages == 0 && batch.dstStages == 0)
+		return;
+
+	std::vector<VkImageMemoryBarrier> imageBarriers;
+	imageBarriers.reserve(batch.barriers.size());
+
+	for (const PlannedBarrier& planned : batch.barriers)
+	{
+		const Resource& resource = mResources[planned.resource];
+
+		VkImageMemoryBarrier barrier = {};
+		barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+		barrier.srcAccessMask = planned.srcAccess;
+		barrier.dstAccessMask = planned.dstAccess;
+		barrier.oldLayout = planned.oldLayout;
+		barrier.newLayout = planned.newLayout;
+		barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.image = getImage(planned.resource, frameIndex);
+		barrier.subresourceRange.aspectMask = resource.aspect;
+		barrier.subresourceRange.baseMipLevel = 0;
+		barrier.subresourceRange.levelCount = 1;
+		barrier.subresourceRange.baseArrayLayer = planned.baseLayer;
+		barrier.subresourceRange.layerCount = planned.layerCount;
+
+		imageBarriers.push_back(barrier);
+	}
+
+	// A zero stage mask isn't allowed. TOP/BOTTOM of pipe are the "nothing" stages on either side.
+	VkPipelineStageFlags srcStages = batch.srcStages ? batch.srcStages : VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+	VkPipelineStageFlags dstStages = batch.dstStages ? batch.dstStages : VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+
+	vkCmdPipelineBarrier(commandBuffer, srcStages, dstStages, 0,
+		0, nullptr,
+		0, nullptr,
+		static_cast<uint32_t>(imageBarriers.size()), imageBarriers.data());
+}
+
+void RenderGraph::execute(VkCommandBuffer commandBuffer, uint32_t frameIndex)
+{
+	if (!mCompiled)
+		throw std::runtime_error("render graph has to be compiled before it can be executed!");
+
+	for (const Pass& pass : mPasses)
+	{
+		if (pass.culled)
+			continue;
+
+		recordBarriers(commandBuffer, pass.barriers, frameIndex);
+
+		if (pass.renderPass != VK_NULL_HANDLE)
+		{
+			VkRenderPassBeginInfo renderPassInfo = {};
+			renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+			renderPassInfo.renderPass = pass.renderPass;
+			renderPassInfo.framebuffer = pass.framebuffers[frameIndex % pass.framebuffers.size()];
+			renderPassInfo.renderArea.offset = { 0, 0 };
+			renderPassInfo.renderArea.extent = pass.extent;
+			renderPassInfo.clearValueCount = static_cast<uint32_t>(pass.clearValues.size());
+			renderPassInfo.pClearValues = pass.clearValues.data();
+
+			vkCmdBeginRenderPass(commandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+		}
+
+		if (pass.record)
+			pass.record(commandBuffer, frameIndex);
+
+		if (pass.renderPass != VK_NULL_HANDLE)
+			vkCmdEndRenderPass(commandBuffer);
+	}
+
+	recordBarriers(commandBuffer, mFinalBarriers, frameIndex);
+}
+
+void RenderGraph::releaseVulkanObjects()
+{
+	for (Pass& pass : mPasses)
+	{
+		for (VkFramebuffer framebuffer : pass.framebuffers)
+			vkDestroyFramebuffer(mDevice, framebuffer, nullptr);
+		for (VkImageView view : pass.attachmentViews)
+			vkDestroyImageView(mDevice, view, nullptr);
+
+		if (pass.renderPass != VK_NULL_HANDLE)
+			vkDestroyRenderPass(mDevice, pass.renderPass, nullptr);
+
+		pass.framebuffers.clear();
+		pass.attachmentViews.clear();
+		pass.clearValues.clear();
+		pass.renderPass = VK_NULL_HANDLE;
+	}
+
+	// Imported images belong to someone else, only destroy what we created.
+	for (Resource& resource : mResources)
+	{
+		if (resource.imported)
+			continue;
+
+		for (VkImageView view : resource.views)
+			vkDestroyImageView(mDevice, view, nullptr);
+		for (VkImage image : resource.images)
+			vkDestroyImage(mDevice, image, nullptr);
+
+		resource.views.clear();
+		resource.images.clear();
+		resource.memoryBlock = INVALID_INDEX;
+	}
+
+	for (MemoryBlock& block : mMemoryBlocks)
+		vkFreeMemory(mDevice, block.memory, nullptr);
+
+	mMemoryBlocks.clear();
+	mFinalBarriers = BarrierBatch();
+	mCompiled = false;
+}
+
+void RenderGraph::destroy()
+{
+	releaseVulkanObjects();
+
+	mPasses.clear();
+	mResources.clear();
+	mTransientMemorySize = 0;
+	mTransientMemoryUnaliased = 0;
+}
+
+uint32_t RenderGraph::findMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties)
+{
+	VkPhysicalDeviceMemoryProperties memProperties;
+	vkGetPhysicalDeviceMemoryProperties(mPhysDevice, &memProperties);
+
+	for (uint32_t i = 0; i < memProperties.memoryTypeCount; ++i)
+	{
+		if ((typeFilter & (1 << i)) &&
+			(memProperties.memoryTypes[i].propertyFlags & properties) == properties)
+			return i;
+	}
+
+	throw std::runtime_error("failed to find suitable memory type!");
+}
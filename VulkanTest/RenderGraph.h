@@ -0,0 +1,256 @@
+/*
+RenderGraph.h
+A small frame graph that sits on top of the Vulkan objects DemoApp creates.
+
+Passes declare which images they read and write. compile() then works out:
+- which passes actually contribute to an output (everything else is culled),
+- the render pass / framebuffer objects for every pass that draws into attachments,
+- the minimal set of image barriers and layout transitions between passes,
+- a shared memory block per memory type where transient images with disjoint lifetimes alias each other.
+
+execute() replays the compiled graph into a command buffer.
+
+Loosely follows the "FrameGraph" talk from Frostbite (GDC 2017) and
+https://themaister.net/blog/2017/08/15/render-graphs-and-vulkan-a-deep-dive/
+*/
+
+#ifndef RENDER_GRAPH_H
+#define RENDER_GRAPH_H
+
+#include <vulkan/vulkan.h>
+
+#include <vector>
+#include <string>
+#include <functional>
+#include <stdexcept>
+
+// Every way a pass is allowed to touch an image.
+// Each usage maps to a single stage/access/layout triple (see getImageAccess), which is all the graph needs to build barriers.
+enum class ResourceUsage
+{
+	ColorAttachment,         // Written as a color target.
+	DepthAttachment,         // Depth test and depth writes.
+	DepthAttachmentReadOnly, // Depth test only, no writes (e.g. an EQUAL pass after a depth pre-pass).
+	ResolveAttachment,       // Destination of an MSAA resolve.
+	SampledFragment,         // Sampled from a fragment shader.
+	SampledCompute,          // Sampled from a compute shader.
+	StorageRead,             // imageLoad from a compute shader.
+	StorageWrite,            // imageStore (and imageLoad) from a compute shader.
+	TransferSrc,
+	TransferDst,
+	Present
+};
+
+// The synchronization scope of one access to an image.
+struct ImageAccess
+{
+	VkPipelineStageFlags stages;
+	VkAccessFlags access;
+	VkImageLayout layout;
+};
+
+// Stage/access/layout that goes with a usage.
+ImageAccess getImageAccess(ResourceUsage usage);
+
+// Stage/access usually associated with an image sitting in a given layout.
+// Used for one-off transitions outside of the graph (e.g. texture uploads).
+// Covers every Vulkan 1.1 layout plus the KHR present ones. Layouts from other extensions throw std::invalid_argument.
+ImageAccess getLayoutAccess(VkImageLayout layout);
+
+// Does the access mask contain anything that writes memory?
+bool isWriteAccess(VkAccessFlags access);
+
+// Helpers for picking the right aspect of an image.
+bool isDepthFormat(VkFormat format);
+bool isStencilFormat(VkFormat format);
+
+class RenderGraph
+{
+public:
+	typedef uint32_t ResourceHandle;
+	typedef uint32_t PassHandle;
+
+	// Used in place of a layer index to mean the whole image.
+	static const uint32_t ALL_LAYERS = ~0u;
+
+	// Called during execute() to record the commands of a pass.
+	// If the pass has attachments, the render pass has already been begun for you.
+	typedef std::function<void(VkCommandBuffer commandBuffer, uint32_t frameIndex)> RecordFunction;
+
+	// Description of an image owned (or imported) by the graph.
+	struct ImageDesc
+	{
+		VkFormat format = VK_FORMAT_UNDEFINED;
+		VkExtent2D extent = { 0, 0 };
+		VkSampleCountFlagBits samples = VK_SAMPLE_COUNT_1_BIT;
+		uint32_t layers = 1;
+		VkImageViewType viewType = VK_IMAGE_VIEW_TYPE_2D;
+		VkImageCreateFlags flags = 0;
+		VkImageUsageFlags extraUsage = 0; // Usage the graph can't infer, e.g. if something outside of the graph copies from it.
+	};
+
+	void init(VkDevice device, VkPhysicalDevice physDevice);
+
+	// Transient image. The graph creates it in compile() and may alias its memory with other transients.
+	// Contents never survive from one frame to the next.
+	ResourceHandle createImage(const std::string& name, const ImageDesc& desc);
+
+	/*
+	Image that lives outside of the graph, such as the swap chain.
+	images/views can hold one entry per frame index (swap chain images); execute() picks images[frameIndex % size].
+	initialStages is the stage the incoming contents were produced at (for the swap chain that's the stage the acquire semaphore waits on).
+	After the last pass that uses it, the graph transitions the image into finalLayout.
+	*/
+	ResourceHandle importImage(const std::string& name, const ImageDesc& desc, const std::vector<VkImage>& images, const std::vector<VkImageView>& views,
+		VkImageLayout initialLayout, VkImageLayout finalLayout, VkPipelineStageFlags initialStages = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT);
+
+	// Passes are executed in the order they are added.
+	PassHandle addPass(const std::string& name, RecordFunction record);
+
+	/*
+	Attachment helpers. Passing a clear value turns the load op into CLEAR.
+	layer picks a single array layer (e.g. one face of a cube map) to render into. Barriers are tracked per layer,
+	so passes writing different layers of the same image don't wait on each other.
+	*/
+	void addColorOutput(PassHandle pass, ResourceHandle image, const VkClearColorValue* clear = nullptr, uint32_t layer = ALL_LAYERS);
+	void addDepthOutput(PassHandle pass, ResourceHandle image, const VkClearDepthStencilValue* clear = nullptr, uint32_t layer = ALL_LAYERS);
+	void addDepthInput(PassHandle pass, ResourceHandle image);
+	void addResolveOutput(PassHandle pass, ResourceHandle image);
+
+	// Anything that is not an attachment (sampling, storage, transfers).
+	void addUsage(PassHandle pass, ResourceHandle image, ResourceUsage usage);
+
+	// Passes with side effects (writing to a buffer the CPU reads, queries...) are never culled.
+	void setSideEffects(PassHandle pass);
+
+	// Builds render passes, framebuffers, memory and barriers. Has to be called again after changing the graph.
+	void compile();
+
+	// Records every surviving pass into the command buffer.
+	void execute(VkCommandBuffer commandBuffer, uint32_t frameIndex);
+
+	// Releases everything compile() created and forgets all passes and resources.
+	void destroy();
+
+	VkRenderPass getRenderPass(PassHandle pass) const { return mPasses[pass].renderPass; }
+	VkExtent2D getPassExtent(PassHandle pass) const { return mPasses[pass].extent; }
+	bool isPassCulled(PassHandle pass) const { return mPasses[pass].culled; }
+	VkImage getImage(ResourceHandle image, uint32_t frameIndex = 0) const;
+	VkImageView getImageView(ResourceHandle image, uint32_t frameIndex = 0) const;
+
+	// Statistics from the last compile(), in bytes.
+	VkDeviceSize getTransientMemorySize() const { return mTransientMemorySize; }
+	VkDeviceSize getTransientMemorySizeWithoutAliasing() const { return mTransientMemoryUnaliased; }
+
+private:
+	static const uint32_t INVALID_INDEX = ~0u;
+
+	struct ResourceRef
+	{
+		ResourceHandle resource;
+		ResourceUsage usage;
+		uint32_t layer;
+		bool clear;
+		VkClearValue clearValue;
+	};
+
+	// A barrier decided at compile time. The actual VkImage is looked up at execute time because
+	// imported images can change with the frame index.
+	struct PlannedBarrier
+	{
+		ResourceHandle resource;
+		VkAccessFlags srcAccess;
+		VkAccessFlags dstAccess;
+		VkImageLayout oldLayout;
+		VkImageLayout newLayout;
+		uint32_t baseLayer;
+		uint32_t layerCount;
+	};
+
+	struct BarrierBatch
+	{
+		VkPipelineStageFlags srcStages = 0;
+		VkPipelineStageFlags dstStages = 0;
+		std::vector<PlannedBarrier> barriers;
+	};
+
+	struct Pass
+	{
+		std::string name;
+		RecordFunction record;
+		std::vector<ResourceRef> refs;
+		bool sideEffects = false;
+		bool culled = false;
+		uint32_t refCount = 0;
+
+		BarrierBatch barriers; // Issued right before the pass.
+
+		VkRenderPass renderPass = VK_NULL_HANDLE;
+		std::vector<VkFramebuffer> framebuffers;
+		std::vector<VkImageView> attachmentViews; // Single layer views for attachments that target one layer.
+		std::vector<VkClearValue> clearValues;
+		VkExtent2D extent = { 0, 0 };
+	};
+
+	struct Resource
+	{
+		std::string name;
+		ImageDesc desc;
+		bool imported = false;
+
+		std::vector<VkImage> images;
+		std::vector<VkImageView> views;
+		VkImageLayout initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+		VkImageLayout finalLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+		VkPipelineStageFlags initialStages = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+		VkAccessFlags initialAccess = 0;
+
+		VkImageUsageFlags usage = 0;
+		VkImageAspectFlags aspect = VK_IMAGE_ASPECT_COLOR_BIT;
+
+		// Filled in by compile()
+		uint32_t refCount = 0;
+		uint32_t firstPass = INVALID_INDEX;
+		uint32_t lastPass = INVALID_INDEX;
+		std::vector<PassHandle> writers;
+		VkMemoryRequirements memRequirements = {};
+		uint32_t memoryBlock = INVALID_INDEX;
+		VkDeviceSize memoryOffset = 0;
+		VkPipelineStageFlags finalStages = 0;
+		VkAccessFlags finalAccess = 0;
+	};
+
+	struct MemoryBlock
+	{
+		uint32_t memoryTypeIndex;
+		VkDeviceSize size;
+		VkDeviceMemory memory;
+	};
+
+	void addRef(PassHandle pass, ResourceHandle image, ResourceUsage usage, const VkClearValue* clear, uint32_t layer = ALL_LAYERS);
+	void cullPasses();
+	void computeLifetimes();
+	void createTransientImages();
+	void aliasTransientMemory();
+	void computeBarriers();
+	void createRenderPasses();
+	void releaseVulkanObjects();
+	VkImageView createLayerView(const Resource& resource, VkImage image, uint32_t layer);
+	static void appendBarrier(BarrierBatch& batch, const PlannedBarrier& barrier);
+	void recordBarriers(VkCommandBuffer commandBuffer, const BarrierBatch& batch, uint32_t frameIndex);
+	uint32_t findMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties);
+
+	VkDevice mDevice = VK_NULL_HANDLE;
+	VkPhysicalDevice mPhysDevice = VK_NULL_HANDLE;
+
+	std::vector<Pass> mPasses;
+	std::vector<Resource> mResources;
+	std::vector<MemoryBlock> mMemoryBlocks;
+	BarrierBatch mFinalBarriers; // Transitions imported images into their final layout.
+
+	VkDeviceSize mTransientMemorySize = 0;
+	VkDeviceSize mTransientMemoryUnaliased = 0;
+	bool mCompiled = false;
+};
+
+#endif // !RENDER_GRAPH_H
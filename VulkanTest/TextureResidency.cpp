@@ -0,0 +1,635 @@
+/*
+TextureResidency.cpp
+definitions for the functions in TextureResidency.h
+*/
+
+#include "TextureResidency.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+static const VkImageUsageFlags TEXTURE_USAGE = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+
+static void imageBarrier(VkCommandBuffer commandBuffer, VkImage image, uint32_t baseLevel, uint32_t levelCount, VkImageLayout oldLayout, VkImageLayout newLayout,
+	VkAccessFlags srcAccess, VkAccessFlags dstAccess, VkPipelineStageFlags srcStage, VkPipelineStageFlags dstStage)
+{
+	VkImageMemoryBarrier barrier = {};
+	barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+	barrier.oldLayout = oldLayout;
+	barrier.newLayout = newLayout;
+	barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	barrier.image = image;
+	barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+	barrier.subresourceRange.baseMipLevel = baseLevel;
+	barrier.subresourceRange.levelCount = levelCount;
+	barrier.subresourceRange.baseArrayLayer = 0;
+	barrier.subresourceRange.layerCount = 1;
+	barrier.srcAccessMask = srcAccess;
+	barrier.dstAccessMask = dstAccess;
+
+	vkCmdPipelineBarrier(commandBuffer, srcStage, dstStage, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+}
+
+void TextureResidency::init(VkDevice device, VkPhysicalDevice physDevice, VkQueue queue, uint32_t queueFamily, MaterialLibrary& library,
+	PFN_vkGetPhysicalDeviceMemoryProperties2KHR getMemoryProperties2)
+{
+	mDevice = device;
+	mPhysDevice = physDevice;
+	mQueue = queue;
+	mLibrary = &library;
+	mGetMemoryProperties2 = getMemoryProperties2;
+	vkGetPhysicalDeviceMemoryProperties(mPhysDevice, &mMemoryProperties);
+
+	VkCommandPoolCreateInfo poolInfo = {};
+	poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+	poolInfo.queueFamilyIndex = queueFamily;
+	poolInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+
+	if (vkCreateCommandPool(mDevice, &poolInfo, nullptr, &mCommandPool) != VK_SUCCESS)
+		throw std::runtime_error("failed to create texture residency command pool!");
+
+	VkFenceCreateInfo fenceInfo = {};
+	fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+	if (vkCreateFence(mDevice, &fenceInfo, nullptr, &mFence) != VK_SUCCESS)
+		throw std::runtime_error("failed to create texture residency fence!");
+
+	// The mips are blitted down from level 0 with a linear filter.
+	VkFormatProperties formatProperties;
+	vkGetPhysicalDeviceFormatProperties(mPhysDevice, FORMAT, &formatProperties);
+	VkFormatFeatureFlags blitFeatures = VK_FORMAT_FEATURE_BLIT_SRC_BIT | VK_FORMAT_FEATURE_BLIT_DST_BIT | VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT;
+	mBlitMips = (formatProperties.optimalTilingFeatures & blitFeatures) == blitFeatures;
+
+	// The fallback is cleared to white, so untextured draws show their vertex colors.
+	VkDeviceSize fallbackBytes;
+	createImage(1, 1, 1, mFallbackImage, mFallbackMemory, mFallbackView, fallbackBytes);
+
+	VkClearColorValue white = { { 1.f, 1.f, 1.f, 1.f } };
+	VkImageSubresourceRange range = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+
+	VkCommandBuffer commandBuffer = beginCommands();
+	imageBarrier(commandBuffer, mFallbackImage, 0, 1, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+		0, VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+	vkCmdClearColorImage(commandBuffer, mFallbackImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &white, 1, &range);
+	imageBarrier(commandBuffer, mFallbackImage, 0, 1, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+		VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
+	submitCommands(commandBuffer);
+
+	refreshBudget();
+}
+
+void TextureResidency::destroy()
+{
+	if (mDevice == VK_NULL_HANDLE)
+		return;
+
+	for (Texture& texture : mTextures)
+		release(texture);
+
+	vkDestroyImageView(mDevice, mFallbackView, nullptr);
+	vkDestroyImage(mDevice, mFallbackImage, nullptr);
+	vkFreeMemory(mDevice, mFallbackMemory, nullptr);
+	vkDestroyFence(mDevice, mFence, nullptr);
+	vkDestroyCommandPool(mDevice, mCommandPool, nullptr);
+
+	mTextures.clear();
+	mStats = TextureResidencyStats();
+	mFallbackView = VK_NULL_HANDLE;
+	mFallbackImage = VK_NULL_HANDLE;
+	mFallbackMemory = VK_NULL_HANDLE;
+	mFence = VK_NULL_HANDLE;
+	mCommandPool = VK_NULL_HANDLE;
+	mLibrary = nullptr;
+	mDevice = VK_NULL_HANDLE;
+}
+
+void TextureResidency::setBudget(VkDeviceSize budget)
+{
+	mManualBudget = budget;
+	if (mDevice != VK_NULL_HANDLE)
+		refreshBudget();
+}
+
+unsigned char* TextureResidency::allocateStaging(int width, int height, size_t& rowPitch, void*& memory)
+{
+	rowPitch = static_cast<size_t>(width) * 4;
+	VkDeviceSize size = static_cast<VkDeviceSize>(rowPitch) * height;
+
+	Staging* staging = new Staging();
+	try
+	{
+		createStaging(*staging, size);
+	}
+	catch (const std::exception&)
+	{
+		delete staging;
+		return nullptr; // The library falls back to stbi_load.
+	}
+
+	void* data = nullptr;
+	if (vkMapMemory(mDevice, staging->memory, 0, size, 0, &data) != VK_SUCCESS)
+	{
+		destroyStaging(*staging);
+		delete staging;
+		return nullptr;
+	}
+
+	memory = staging;
+	return static_cast<unsigned char*>(data);
+}
+
+void TextureResidency::freeStaging(void* memory)
+{
+	Staging* staging = static_cast<Staging*>(memory);
+	vkUnmapMemory(mDevice, staging->memory);
+	destroyStaging(*staging);
+	delete staging;
+}
+
+TextureResidency::TextureHandle TextureResidency::add(uint32_t textureId)
+{
+	Texture texture;
+	texture.textureId = textureId;
+	texture.lastUsed = mFrame;
+	texture.loading = true; // Requesting it from the library started the decode.
+	mTextures.push_back(texture);
+
+	return static_cast<TextureHandle>(mTextures.size() - 1);
+}
+
+bool TextureResidency::makeResident(TextureHandle handle)
+{
+	Texture& texture = mTextures[handle];
+	texture.lastUsed = mFrame;
+	if (!texture.loading && !texture.failed && (texture.residentLevels == 0 || texture.residentLevels < texture.mipLevels))
+	{
+		mLibrary->reloadTexture(texture.textureId);
+		texture.loading = true;
+	}
+
+	if (texture.loading)
+		finishLoading(texture);
+	evict();
+
+	return texture.residentLevels > 0;
+}
+
+void TextureResidency::beginFrame(uint64_t frame)
+{
+	mFrame = frame;
+	if (mFrame - mBudgetFrame >= BUDGET_REFRESH_FRAMES)
+		refreshBudget();
+}
+
+void TextureResidency::markUsed(TextureHandle handle)
+{
+	Texture& texture = mTextures[handle];
+	texture.lastUsed = mFrame;
+
+	if (texture.residentLevels > 0 && texture.residentLevels == texture.mipLevels)
+	{
+		++mStats.hits;
+		return;
+	}
+
+	++mStats.misses;
+	if (texture.loading || texture.failed)
+		return;
+
+	/*
+	An evicted texture always comes back. The missing mips of a texture only do if the whole chain fits
+	into what's left of the budget plus what the stale textures take, otherwise the next update
+	would just drop them again.
+	*/
+	if (texture.residentLevels > 0)
+	{
+		VkDeviceSize available = mStats.budget > mStats.residentBytes ? mStats.budget - mStats.residentBytes : 0;
+		for (const Texture& other : mTextures)
+		{
+			if (other.residentLevels > 0 && isStale(other))
+				available += other.bytes;
+		}
+
+		if (estimateBytes(texture, texture.mipLevels) > texture.bytes + available)
+			return;
+	}
+
+	mLibrary->reloadTexture(texture.textureId);
+	texture.loading = true;
+}
+
+bool TextureResidency::needsUpdate() const
+{
+	for (const Texture& texture : mTextures)
+	{
+		if (texture.loading && mLibrary->isTextureReady(texture.textureId))
+			return true;
+	}
+
+	if (mStats.residentBytes <= mStats.budget)
+		return false;
+
+	for (const Texture& texture : mTextures)
+	{
+		if (canEvict(texture))
+			return true;
+	}
+
+	return false;
+}
+
+void TextureResidency::update()
+{
+	for (Texture& texture : mTextures)
+	{
+		if (texture.loading && mLibrary->isTextureReady(texture.textureId))
+			finishLoading(texture);
+	}
+
+	evict();
+}
+
+VkImageView TextureResidency::getView(TextureHandle handle) const
+{
+	if (handle == INVALID_TEXTURE || mTextures[handle].residentLevels == 0)
+		return mFallbackView;
+
+	return mTextures[handle].view;
+}
+
+void TextureResidency::finishLoading(Texture& texture)
+{
+	const DecodedTexture& decoded = mLibrary->waitForTexture(texture.textureId);
+	texture.loading = false;
+
+	if (decoded.pixels)
+		upload(texture, decoded);
+	else
+		texture.failed = true;
+
+	mLibrary->releaseTexture(texture.textureId);
+}
+
+void TextureResidency::upload(Texture& texture, const DecodedTexture& decoded)
+{
+	texture.width = static_cast<uint32_t>(decoded.width);
+	texture.height = static_cast<uint32_t>(decoded.height);
+	texture.mipLevels = 1;
+	if (mBlitMips)
+	{
+		for (uint32_t size = std::max(texture.width, texture.height); size > 1; size >>= 1)
+			++texture.mipLevels;
+	}
+
+	// Normally the library decoded straight into one of our staging buffers, only stb's own allocations need one made here.
+	Staging staging;
+	VkBuffer buffer;
+	if (decoded.memory)
+		buffer = static_cast<Staging*>(decoded.memory)->buffer;
+	else
+	{
+		VkDeviceSize size = static_cast<VkDeviceSize>(decoded.rowPitch) * texture.height;
+		createStaging(staging, size);
+
+		void* data;
+		vkMapMemory(mDevice, staging.memory, 0, size, 0, &data);
+		memcpy(data, decoded.pixels, static_cast<size_t>(size));
+		vkUnmapMemory(mDevice, staging.memory);
+		buffer = staging.buffer;
+	}
+
+	VkImage image;
+	VkDeviceMemory memory;
+	VkImageView view;
+	VkDeviceSize bytes;
+	createImage(texture.width, texture.height, texture.mipLevels, image, memory, view, bytes);
+
+	VkCommandBuffer commandBuffer = beginCommands();
+	imageBarrier(commandBuffer, image, 0, texture.mipLevels, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+		0, VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+
+	VkBufferImageCopy region = {};
+	region.bufferOffset = 0;
+	region.bufferRowLength = static_cast<uint32_t>(decoded.rowPitch / 4);
+	region.bufferImageHeight = 0;
+	region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+	region.imageSubresource.mipLevel = 0;
+	region.imageSubresource.baseArrayLayer = 0;
+	region.imageSubresource.layerCount = 1;
+	region.imageOffset = { 0, 0, 0 };
+	region.imageExtent = { texture.width, texture.height, 1 };
+	vkCmdCopyBufferToImage(commandBuffer, buffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+
+	// Each level is blitted from the one above it, which then goes to the shaders.
+	int32_t mipWidth = static_cast<int32_t>(texture.width);
+	int32_t mipHeight = static_cast<int32_t>(texture.height);
+	for (uint32_t level = 1; level < texture.mipLevels; ++level)
+	{
+		imageBarrier(commandBuffer, image, level - 1, 1, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+			VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_TRANSFER_READ_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+
+		VkImageBlit blit = {};
+		blit.srcOffsets[0] = { 0, 0, 0 };
+		blit.srcOffsets[1] = { mipWidth, mipHeight, 1 };
+		blit.srcSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, level - 1, 0, 1 };
+		mipWidth = std::max(mipWidth / 2, 1);
+		mipHeight = std::max(mipHeight / 2, 1);
+		blit.dstOffsets[0] = { 0, 0, 0 };
+		blit.dstOffsets[1] = { mipWidth, mipHeight, 1 };
+		blit.dstSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, level, 0, 1 };
+		vkCmdBlitImage(commandBuffer, image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &blit, VK_FILTER_LINEAR);
+
+		imageBarrier(commandBuffer, image, level - 1, 1, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+			VK_ACCESS_TRANSFER_READ_BIT, VK_ACCESS_SHADER_READ_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
+	}
+
+	imageBarrier(commandBuffer, image, texture.mipLevels - 1, 1, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+		VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
+	submitCommands(commandBuffer);
+
+	if (staging.buffer != VK_NULL_HANDLE)
+		destroyStaging(staging);
+
+	// Replaces what was left of the texture after mip evictions.
+	release(texture);
+	texture.image = image;
+	texture.memory = memory;
+	texture.view = view;
+	texture.bytes = bytes;
+	texture.residentLevels = texture.mipLevels;
+	mStats.residentBytes += bytes;
+	++mStats.streamIns;
+	++mGeneration;
+}
+
+void TextureResidency::evict()
+{
+	while (mStats.residentBytes > mStats.budget)
+	{
+		Texture* victim = nullptr;
+		for (Texture& texture : mTextures)
+		{
+			if (canEvict(texture) && (!victim || texture.lastUsed < victim->lastUsed))
+				victim = &texture;
+		}
+
+		if (!victim)
+			break;
+
+		if (isStale(*victim))
+		{
+			release(*victim);
+			++mStats.textureEvictions;
+			++mGeneration;
+		}
+		else
+			dropLargestMip(*victim);
+	}
+}
+
+void TextureResidency::dropLargestMip(Texture& texture)
+{
+	// Level 0 of the new image is level `first` of the full chain. The old image starts one level above it.
+	uint32_t levels = texture.residentLevels - 1;
+	uint32_t first = texture.mipLevels - levels;
+	uint32_t width = std::max(texture.width >> first, 1u);
+	uint32_t height = std::max(texture.height >> first, 1u);
+
+	VkImage image;
+	VkDeviceMemory memory;
+	VkImageView view;
+	VkDeviceSize bytes;
+	createImage(width, height, levels, image, memory, view, bytes);
+
+	std::vector<VkImageCopy> regions(levels);
+	for (uint32_t level = 0; level < levels; ++level)
+	{
+		VkImageCopy& region = regions[level];
+		region.srcSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, level + 1, 0, 1 };
+		region.srcOffset = { 0, 0, 0 };
+		region.dstSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, level, 0, 1 };
+		region.dstOffset = { 0, 0, 0 };
+		region.extent = { std::max(width >> level, 1u), std::max(height >> level, 1u), 1 };
+	}
+
+	VkCommandBuffer commandBuffer = beginCommands();
+	imageBarrier(commandBuffer, texture.image, 1, levels, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+		VK_ACCESS_SHADER_READ_BIT, VK_ACCESS_TRANSFER_READ_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+	imageBarrier(commandBuffer, image, 0, levels, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+		0, VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+	vkCmdCopyImage(commandBuffer, texture.image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+		levels, regions.data());
+	imageBarrier(commandBuffer, image, 0, levels, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+		VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
+	submitCommands(commandBuffer);
+
+	release(texture);
+	texture.image = image;
+	texture.memory = memory;
+	texture.view = view;
+	texture.bytes = bytes;
+	texture.residentLevels = levels;
+	mStats.residentBytes += bytes;
+	++mStats.mipEvictions;
+	++mGeneration;
+}
+
+void TextureResidency::release(Texture& texture)
+{
+	if (texture.image != VK_NULL_HANDLE)
+	{
+		vkDestroyImageView(mDevice, texture.view, nullptr);
+		vkDestroyImage(mDevice, texture.image, nullptr);
+		vkFreeMemory(mDevice, texture.memory, nullptr);
+		mStats.residentBytes -= texture.bytes;
+	}
+
+	texture.image = VK_NULL_HANDLE;
+	texture.memory = VK_NULL_HANDLE;
+	texture.view = VK_NULL_HANDLE;
+	texture.bytes = 0;
+	texture.residentLevels = 0;
+}
+
+VkDeviceSize TextureResidency::estimateBytes(const Texture& texture, uint32_t levels) const
+{
+	VkDeviceSize bytes = 0;
+	for (uint32_t level = texture.mipLevels - levels; level < texture.mipLevels; ++level)
+		bytes += static_cast<VkDeviceSize>(std::max(texture.width >> level, 1u)) * std::max(texture.height >> level, 1u) * 4;
+
+	return bytes;
+}
+
+void TextureResidency::refreshBudget()
+{
+	mBudgetFrame = mFrame;
+	if (mManualBudget != 0)
+	{
+		mStats.budget = mManualBudget;
+		return;
+	}
+
+	VkDeviceSize available = mMemoryProperties.memoryHeaps[mHeapIndex].size;
+	if (mGetMemoryProperties2)
+	{
+		VkPhysicalDeviceMemoryBudgetPropertiesEXT budget = {};
+		budget.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT;
+
+		VkPhysicalDeviceMemoryProperties2KHR properties = {};
+		properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2_KHR;
+		properties.pNext = &budget;
+		mGetMemoryProperties2(mPhysDevice, &properties);
+
+		// The heap's usage includes our own textures, they shouldn't shrink their own budget.
+		VkDeviceSize usage = budget.heapUsage[mHeapIndex];
+		VkDeviceSize others = usage > mStats.residentBytes ? usage - mStats.residentBytes : 0;
+		available = budget.heapBudget[mHeapIndex] > others ? budget.heapBudget[mHeapIndex] - others : 0;
+	}
+
+	mStats.budget = static_cast<VkDeviceSize>(available * BUDGET_FRACTION);
+}
+
+void TextureResidency::createImage(uint32_t width, uint32_t height, uint32_t levels, VkImage& image, VkDeviceMemory& memory, VkImageView& view, VkDeviceSize& bytes)
+{
+	VkImageCreateInfo imageInfo = {};
+	imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+	imageInfo.imageType = VK_IMAGE_TYPE_2D;
+	imageInfo.extent.width = width;
+	imageInfo.extent.height = height;
+	imageInfo.extent.depth = 1;
+	imageInfo.mipLevels = levels;
+	imageInfo.arrayLayers = 1;
+	imageInfo.format = FORMAT;
+	imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+	imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+	imageInfo.usage = TEXTURE_USAGE;
+	imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+	imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+
+	if (vkCreateImage(mDevice, &imageInfo, nullptr, &image) != VK_SUCCESS)
+		throw std::runtime_error("failed to create texture image!");
+
+	VkMemoryRequirements memRequirements;
+	vkGetImageMemoryRequirements(mDevice, image, &memRequirements);
+
+	VkMemoryAllocateInfo allocInfo = {};
+	allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+	allocInfo.allocationSize = memRequirements.size;
+	allocInfo.memoryTypeIndex = findMemoryType(memRequirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+	mHeapIndex = mMemoryProperties.memoryTypes[allocInfo.memoryTypeIndex].heapIndex;
+
+	if (vkAllocateMemory(mDevice, &allocInfo, nullptr, &memory) != VK_SUCCESS)
+	{
+		vkDestroyImage(mDevice, image, nullptr);
+		throw std::runtime_error("failed to allocate texture image memory!");
+	}
+
+	vkBindImageMemory(mDevice, image, memory, 0);
+	bytes = memRequirements.size;
+
+	VkImageViewCreateInfo viewInfo = {};
+	viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+	viewInfo.image = image;
+	viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+	viewInfo.format = FORMAT;
+	viewInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+	viewInfo.subresourceRange.baseMipLevel = 0;
+	viewInfo.subresourceRange.levelCount = levels;
+	viewInfo.subresourceRange.baseArrayLayer = 0;
+	viewInfo.subresourceRange.layerCount = 1;
+
+	if (vkCreateImageView(mDevice, &viewInfo, nullptr, &view) != VK_SUCCESS)
+	{
+		vkDestroyImage(mDevice, image, nullptr);
+		vkFreeMemory(mDevice, memory, nullptr);
+		throw std::runtime_error("failed to create texture image view!");
+	}
+}
+
+void TextureResidency::createStaging(Staging& staging, VkDeviceSize size)
+{
+	VkBufferCreateInfo bufferInfo = {};
+	bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+	bufferInfo.size = size;
+	bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+	bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+	if (vkCreateBuffer(mDevice, &bufferInfo, nullptr, &staging.buffer) != VK_SUCCESS)
+		throw std::runtime_error("failed to create texture staging buffer!");
+
+	VkMemoryRequirements memRequirements;
+	vkGetBufferMemoryRequirements(mDevice, staging.buffer, &memRequirements);
+
+	VkMemoryAllocateInfo allocInfo = {};
+	allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+	allocInfo.allocationSize = memRequirements.size;
+	allocInfo.memoryTypeIndex = findMemoryType(memRequirements.memoryTypeBits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+	if (vkAllocateMemory(mDevice, &allocInfo, nullptr, &staging.memory) != VK_SUCCESS)
+	{
+		vkDestroyBuffer(mDevice, staging.buffer, nullptr);
+		staging.buffer = VK_NULL_HANDLE;
+		throw std::runtime_error("failed to allocate texture staging memory!");
+	}
+
+	vkBindBufferMemory(mDevice, staging.buffer, staging.memory, 0);
+}
+
+void TextureResidency::destroyStaging(Staging& staging)
+{
+	vkDestroyBuffer(mDevice, staging.buffer, nullptr);
+	vkFreeMemory(mDevice, staging.memory, nullptr);
+	staging = Staging();
+}
+
+VkCommandBuffer TextureResidency::beginCommands()
+{
+	VkCommandBufferAllocateInfo allocInfo = {};
+	allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+	allocInfo.commandPool = mCommandPool;
+	allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+	allocInfo.commandBufferCount = 1;
+
+	VkCommandBuffer commandBuffer;
+	if (vkAllocateCommandBuffers(mDevice, &allocInfo, &commandBuffer) != VK_SUCCESS)
+		throw std::runtime_error("failed to allocate texture residency command buffer!");
+
+	VkCommandBufferBeginInfo beginInfo = {};
+	beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+	beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+	vkBeginCommandBuffer(commandBuffer, &beginInfo);
+
+	return commandBuffer;
+}
+
+void TextureResidency::submitCommands(VkCommandBuffer commandBuffer)
+{
+	vkEndCommandBuffer(commandBuffer);
+
+	VkSubmitInfo submitInfo = {};
+	submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+	submitInfo.commandBufferCount = 1;
+	submitInfo.pCommandBuffers = &commandBuffer;
+
+	if (vkQueueSubmit(mQueue, 1, &submitInfo, mFence) != VK_SUCCESS)
+		throw std::runtime_error("failed to submit texture uploads!");
+
+	vkWaitForFences(mDevice, 1, &mFence, VK_TRUE, std::numeric_limits<uint64_t>::max());
+	vkResetFences(mDevice, 1, &mFence);
+	vkFreeCommandBuffers(mDevice, mCommandPool, 1, &commandBuffer);
+}
+
+uint32_t TextureResidency::findMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties)
+{
+	for (uint32_t i = 0; i < mMemoryProperties.memoryTypeCount; ++i)
+	{
+		if ((typeFilter & (1 << i)) &&
+			(mMemoryProperties.memoryTypes[i].propertyFlags & properties) == properties)
+			return i;
+	}
+
+	throw std::runtime_error("failed to find suitable memory type!");
+}
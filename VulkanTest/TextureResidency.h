@@ -0,0 +1,152 @@
+/*
+TextureResidency.h
+Keeps the textures in device local memory under a budget.
+
+Textures are registered with their MaterialLibrary id and uploaded with a full mip chain (blitted down from level 0).
+Every frame the renderer marks the textures its draws use, which counts a hit if all of the texture's mips
+are resident and a miss otherwise. When the textures take more than the budget, the least recently used
+texture goes first: a texture that hasn't been used for EVICT_AFTER_FRAMES frames is dropped completely,
+a more recent one loses its largest mip (its smaller mips are copied into a new image at half the size).
+Missing textures and mips are streamed back in when a draw uses them again and they fit: the library
+decodes the file again on its workers and update() uploads it once it's done.
+
+The budget is set by hand, or is a share of what VK_EXT_memory_budget says the device local heap has left
+for us (the heap's size without the extension).
+
+Images are only replaced or destroyed in update(), which the caller runs once nothing in flight uses the
+textures anymore. getView() changes when a texture is replaced, getGeneration() tells when that happened.
+*/
+
+#ifndef TEXTURE_RESIDENCY_H
+#define TEXTURE_RESIDENCY_H
+
+#include <vulkan/vulkan.h>
+
+#include "MaterialLibrary.h"
+
+#include <vector>
+
+struct TextureResidencyStats
+{
+	uint64_t hits = 0; // markUsed on a texture with all of its mips resident.
+	uint64_t misses = 0; // markUsed on a texture that is loading, evicted or missing mips.
+	uint64_t mipEvictions = 0; // Largest mips dropped.
+	uint64_t textureEvictions = 0; // Whole textures dropped.
+	uint64_t streamIns = 0; // Uploads, the first one of a texture included.
+	VkDeviceSize residentBytes = 0;
+	VkDeviceSize budget = 0;
+};
+
+class TextureResidency
+{
+public:
+	typedef uint32_t TextureHandle;
+
+	static const TextureHandle INVALID_TEXTURE = ~0u;
+	static const VkFormat FORMAT = VK_FORMAT_R8G8B8A8_UNORM; // What the library decodes to.
+	static const uint32_t EVICT_AFTER_FRAMES = 120; // Unused for this long, a texture can be dropped instead of losing mips.
+	static const uint32_t BUDGET_REFRESH_FRAMES = 60; // How often VK_EXT_memory_budget is asked again.
+	static constexpr double BUDGET_FRACTION = 0.5; // Of the device local heap that's left, without a manual budget.
+
+	/*
+	getMemoryProperties2 is vkGetPhysicalDeviceMemoryProperties2(KHR) if VK_EXT_memory_budget is enabled on the device,
+	nullptr otherwise. The uploads are submitted to queue, which has to support graphics (for the blits) and belong to queueFamily.
+	*/
+	void init(VkDevice device, VkPhysicalDevice physDevice, VkQueue queue, uint32_t queueFamily, MaterialLibrary& library,
+		PFN_vkGetPhysicalDeviceMemoryProperties2KHR getMemoryProperties2 = nullptr);
+	void destroy(); // After the library is shut down, it may still hold staging buffers.
+
+	// In bytes, 0 (the default) for BUDGET_FRACTION of the device local heap.
+	void setBudget(VkDeviceSize budget);
+
+	/*
+	MaterialLibrary texture allocator, decodes the textures straight into mapped staging buffers (tightly packed rows),
+	which the uploads copy from as they are. Runs on the library's workers.
+	*/
+	unsigned char* allocateStaging(int width, int height, size_t& rowPitch, void*& memory);
+	void freeStaging(void* memory);
+
+	// The texture has to be requested from the library already. It is uploaded once it's used and decoded.
+	TextureHandle add(uint32_t textureId);
+	// Waits for the decode and uploads the texture right away, e.g. before the first frame. False if the file couldn't be decoded.
+	bool makeResident(TextureHandle texture);
+
+	void beginFrame(uint64_t frame);
+	void markUsed(TextureHandle texture); // For every texture the frame's draws use.
+
+	// Whether update() has something to do: decoded textures to upload, or textures to evict.
+	bool needsUpdate() const;
+	// Uploads what finished decoding and evicts down to the budget. Nothing in flight may use the textures.
+	void update();
+
+	// A 1x1 white texture while nothing of the texture is resident.
+	VkImageView getView(TextureHandle texture) const;
+	// Goes up every time a view is replaced. Descriptor sets that use the views have to be written again.
+	uint32_t getGeneration() const { return mGeneration; }
+	const TextureResidencyStats& getStats() const { return mStats; }
+
+private:
+	struct Texture
+	{
+		uint32_t textureId = 0; // In the library.
+		uint32_t width = 0; // Of the full texture, known after its first decode.
+		uint32_t height = 0;
+		uint32_t mipLevels = 0; // Of the full chain.
+		uint32_t residentLevels = 0; // The smallest ones, 0 when nothing is resident.
+		VkImage image = VK_NULL_HANDLE;
+		VkDeviceMemory memory = VK_NULL_HANDLE;
+		VkImageView view = VK_NULL_HANDLE;
+		VkDeviceSize bytes = 0; // Of memory.
+		uint64_t lastUsed = 0;
+		bool loading = false; // The library is decoding it.
+		bool failed = false; // The file couldn't be decoded, don't try again.
+	};
+
+	// What allocateStaging hands the library as memory.
+	struct Staging
+	{
+		VkBuffer buffer = VK_NULL_HANDLE;
+		VkDeviceMemory memory = VK_NULL_HANDLE;
+	};
+
+	void finishLoading(Texture& texture); // Uploads the decoded texture and gives the pixels back to the library.
+	void upload(Texture& texture, const DecodedTexture& decoded);
+	void evict(); // Down to the budget, or until nothing is left to evict.
+	void dropLargestMip(Texture& texture);
+	void release(Texture& texture); // Destroys the image, keeps the size.
+	bool isStale(const Texture& texture) const { return mFrame - texture.lastUsed >= EVICT_AFTER_FRAMES; }
+	bool canEvict(const Texture& texture) const { return texture.residentLevels > 1 || (texture.residentLevels == 1 && isStale(texture)); }
+	VkDeviceSize estimateBytes(const Texture& texture, uint32_t levels) const; // Tightly packed, the real size may be a bit larger.
+	void refreshBudget();
+
+	void createImage(uint32_t width, uint32_t height, uint32_t levels, VkImage& image, VkDeviceMemory& memory, VkImageView& view, VkDeviceSize& bytes);
+	void createStaging(Staging& staging, VkDeviceSize size);
+	void destroyStaging(Staging& staging);
+	VkCommandBuffer beginCommands();
+	void submitCommands(VkCommandBuffer commandBuffer); // Waits for the copies.
+	uint32_t findMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties);
+
+	VkDevice mDevice = VK_NULL_HANDLE;
+	VkPhysicalDevice mPhysDevice = VK_NULL_HANDLE;
+	VkQueue mQueue = VK_NULL_HANDLE;
+	VkCommandPool mCommandPool = VK_NULL_HANDLE;
+	VkFence mFence = VK_NULL_HANDLE;
+	MaterialLibrary* mLibrary = nullptr;
+	PFN_vkGetPhysicalDeviceMemoryProperties2KHR mGetMemoryProperties2 = nullptr;
+	VkPhysicalDeviceMemoryProperties mMemoryProperties = {};
+	bool mBlitMips = false; // FORMAT supports linear blits, otherwise textures get a single level.
+
+	VkImage mFallbackImage = VK_NULL_HANDLE;
+	VkDeviceMemory mFallbackMemory = VK_NULL_HANDLE;
+	VkImageView mFallbackView = VK_NULL_HANDLE;
+	uint32_t mHeapIndex = 0; // Where the texture images are allocated from.
+
+	std::vector<Texture> mTextures; // Indexed by handle.
+	VkDeviceSize mManualBudget = 0;
+	uint64_t mFrame = 0;
+	uint64_t mBudgetFrame = 0; // When the budget was last refreshed.
+	uint32_t mGeneration = 0;
+	TextureResidencyStats mStats;
+};
+
+#endif // !TEXTURE_RESIDENCY_H
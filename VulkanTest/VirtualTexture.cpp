@@ -0,0 +1,756 @@
+/*
+VirtualTexture.cpp
+definitions for the functions in VirtualTexture.h
+*/
+
+#include "VirtualTexture.h"
+
+#include <stb_image.h>
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+
+static void imageBarrier(VkCommandBuffer commandBuffer, VkImage image, uint32_t levelCount, VkImageLayout oldLayout, VkImageLayout newLayout,
+	VkAccessFlags srcAccess, VkAccessFlags dstAccess, VkPipelineStageFlags srcStage, VkPipelineStageFlags dstStage)
+{
+	VkImageMemoryBarrier barrier = {};
+	barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+	barrier.oldLayout = oldLayout;
+	barrier.newLayout = newLayout;
+	barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	barrier.image = image;
+	barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+	barrier.subresourceRange.baseMipLevel = 0;
+	barrier.subresourceRange.levelCount = levelCount;
+	barrier.subresourceRange.baseArrayLayer = 0;
+	barrier.subresourceRange.layerCount = 1;
+	barrier.srcAccessMask = srcAccess;
+	barrier.dstAccessMask = dstAccess;
+
+	vkCmdPipelineBarrier(commandBuffer, srcStage, dstStage, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+}
+
+bool VirtualTexture::build(const std::string& imagePath, const std::string& outPath)
+{
+	int width, height, channels;
+	stbi_uc* pixels = stbi_load(imagePath.c_str(), &width, &height, &channels, STBI_rgb_alpha);
+	if (!pixels)
+		return false;
+
+	uint32_t size = static_cast<uint32_t>(width);
+	if (width != height || size < PAGE_SIZE || (size & (size - 1)) != 0)
+	{
+		stbi_image_free(pixels);
+		return false;
+	}
+
+	// The mip chain down to a single page, every level a 2x2 box filter of the one above.
+	std::vector<std::vector<unsigned char>> levels(1, std::vector<unsigned char>(pixels, pixels + static_cast<size_t>(size) * size * 4));
+	stbi_image_free(pixels);
+
+	for (uint32_t levelSize = size / 2; levelSize >= PAGE_SIZE; levelSize /= 2)
+	{
+		const unsigned char* src = levels.back().data();
+		size_t srcPitch = static_cast<size_t>(levelSize) * 2 * 4;
+		std::vector<unsigned char> dst(static_cast<size_t>(levelSize) * levelSize * 4);
+
+		for (uint32_t y = 0; y < levelSize; ++y)
+		{
+			const unsigned char* row0 = src + y * 2 * srcPitch;
+			const unsigned char* row1 = row0 + srcPitch;
+			unsigned char* out = &dst[static_cast<size_t>(y) * levelSize * 4];
+			for (uint32_t i = 0; i < levelSize * 4; ++i)
+			{
+				uint32_t x = (i / 4) * 8 + i % 4;
+				out[i] = static_cast<unsigned char>((row0[x] + row0[x + 4] + row1[x] + row1[x + 4] + 2) / 4);
+			}
+		}
+
+		levels.push_back(std::move(dst));
+	}
+
+	std::ofstream file(outPath, std::ios::binary);
+	if (!file)
+		return false;
+
+	FileHeader header = { { 'V', 'T', 'E', 'X' }, FILE_VERSION, size, PAGE_SIZE, PAGE_BORDER, static_cast<uint32_t>(levels.size()) };
+	file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+	std::vector<unsigned char> page(PAGE_BYTES);
+	for (uint32_t level = 0; level < levels.size(); ++level)
+	{
+		uint32_t levelSize = size >> level;
+		uint32_t pages = levelSize / PAGE_SIZE;
+		const unsigned char* src = levels[level].data();
+
+		for (uint32_t pageY = 0; pageY < pages; ++pageY)
+		{
+			for (uint32_t pageX = 0; pageX < pages; ++pageX)
+			{
+				// The border wraps around the texture like the REPEAT sampler it would be drawn with. levelSize is a power of two.
+				for (uint32_t y = 0; y < PAGE_STRIDE; ++y)
+				{
+					uint32_t srcY = (pageY * PAGE_SIZE + y - PAGE_BORDER) & (levelSize - 1);
+					for (uint32_t x = 0; x < PAGE_STRIDE; ++x)
+					{
+						uint32_t srcX = (pageX * PAGE_SIZE + x - PAGE_BORDER) & (levelSize - 1);
+						std::memcpy(&page[(static_cast<size_t>(y) * PAGE_STRIDE + x) * 4], &src[(static_cast<size_t>(srcY) * levelSize + srcX) * 4], 4);
+					}
+				}
+
+				file.write(reinterpret_cast<const char*>(page.data()), PAGE_BYTES);
+			}
+		}
+	}
+
+	return static_cast<bool>(file);
+}
+
+VkExtent2D VirtualTexture::getFeedbackExtent(VkExtent2D screenExtent)
+{
+	return { std::max(screenExtent.width / FEEDBACK_DIVISOR, 1u), std::max(screenExtent.height / FEEDBACK_DIVISOR, 1u) };
+}
+
+void VirtualTexture::init(VkDevice device, VkPhysicalDevice physDevice, VkQueue queue, uint32_t queueFamily, const std::string& path)
+{
+	mDevice = device;
+	mPhysDevice = physDevice;
+	mQueue = queue;
+
+	// The page coordinates in the feedback have 12 bits, so no more than 4096 pages per side (13 levels).
+	FileHeader header = {};
+	mFile.open(path, std::ios::binary);
+	if (!mFile.read(reinterpret_cast<char*>(&header), sizeof(header)) || std::memcmp(header.magic, "VTEX", 4) != 0 || header.version != FILE_VERSION ||
+		header.pageSize != PAGE_SIZE || header.pageBorder != PAGE_BORDER || header.levels == 0 || header.levels > 13 || header.size != PAGE_SIZE << (header.levels - 1))
+		throw std::runtime_error("failed to open virtual texture " + path + "!");
+
+	uint32_t pageCount = 0;
+	mLevels.resize(header.levels);
+	for (uint32_t level = 0; level < header.levels; ++level)
+	{
+		mLevels[level].pages = (header.size >> level) / PAGE_SIZE;
+		mLevels[level].firstPage = pageCount;
+		pageCount += mLevels[level].pages * mLevels[level].pages;
+	}
+
+	mPages.assign(pageCount, Page());
+	mSlots.assign(CACHE_PAGES * CACHE_PAGES, NO_PAGE);
+	mIndirection.assign(static_cast<size_t>(pageCount) * 4, 0);
+
+	// The frames' command buffers are reset and recorded again whenever they have uploads.
+	VkCommandPoolCreateInfo poolInfo = {};
+	poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+	poolInfo.queueFamilyIndex = queueFamily;
+	poolInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+
+	if (vkCreateCommandPool(mDevice, &poolInfo, nullptr, &mCommandPool) != VK_SUCCESS)
+		throw std::runtime_error("failed to create virtual texture command pool!");
+
+	VkFenceCreateInfo fenceInfo = {};
+	fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+	if (vkCreateFence(mDevice, &fenceInfo, nullptr, &mFence) != VK_SUCCESS)
+		throw std::runtime_error("failed to create virtual texture fence!");
+
+	createImage(CACHE_PAGES * PAGE_STRIDE, CACHE_PAGES * PAGE_STRIDE, 1, FORMAT, mCache, mCacheMemory, mCacheView);
+	createImage(mLevels[0].pages, mLevels[0].pages, header.levels, INDIRECTION_FORMAT, mIndirectionImage, mIndirectionMemory, mIndirectionView);
+	mCacheSampler = createSampler(VK_FILTER_LINEAR);
+	mIndirectionSampler = createSampler(VK_FILTER_NEAREST);
+
+	// The coarsest level is a single page. It goes into slot 0 right away and stays there, as the fallback for every other page.
+	uint32_t root = pageCount - 1;
+	VkDeviceSize stagingSize = PAGE_BYTES + mIndirection.size();
+	VkBuffer stagingBuffer;
+	VkDeviceMemory stagingMemory;
+	createBuffer(stagingSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, stagingBuffer, stagingMemory);
+
+	void* data;
+	vkMapMemory(mDevice, stagingMemory, 0, stagingSize, 0, &data);
+	unsigned char* staging = static_cast<unsigned char*>(data);
+	if (!readPage(root, staging))
+		throw std::runtime_error("failed to read virtual texture " + path + "!");
+
+	mPages[root].slot = 0;
+	mSlots[0] = root;
+	mStats.residentPages = 1;
+	buildIndirection();
+	std::memcpy(staging + PAGE_BYTES, mIndirection.data(), mIndirection.size());
+	vkUnmapMemory(mDevice, stagingMemory);
+
+	VkBufferImageCopy region = {};
+	region.imageSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1 };
+	region.imageExtent = { PAGE_STRIDE, PAGE_STRIDE, 1 };
+
+	// The rest of the cache stays undefined, nothing points at it.
+	VkCommandBuffer commandBuffer = beginCommands();
+	imageBarrier(commandBuffer, mCache, 1, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+		0, VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+	imageBarrier(commandBuffer, mIndirectionImage, header.levels, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+		0, VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+	vkCmdCopyBufferToImage(commandBuffer, stagingBuffer, mCache, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+	recordIndirectionUpload(commandBuffer, stagingBuffer, PAGE_BYTES);
+	imageBarrier(commandBuffer, mCache, 1, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+		VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
+	imageBarrier(commandBuffer, mIndirectionImage, header.levels, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+		VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
+	submitCommands(commandBuffer);
+
+	vkDestroyBuffer(mDevice, stagingBuffer, nullptr);
+	vkFreeMemory(mDevice, stagingMemory, nullptr);
+
+	mStop = false;
+	mLoader = std::thread(&VirtualTexture::loaderLoop, this);
+}
+
+void VirtualTexture::destroy()
+{
+	if (mDevice == VK_NULL_HANDLE)
+		return;
+
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mStop = true;
+	}
+	mWake.notify_all();
+	if (mLoader.joinable())
+		mLoader.join();
+
+	destroyFrameResources();
+
+	vkDestroySampler(mDevice, mCacheSampler, nullptr);
+	vkDestroySampler(mDevice, mIndirectionSampler, nullptr);
+	vkDestroyImageView(mDevice, mCacheView, nullptr);
+	vkDestroyImage(mDevice, mCache, nullptr);
+	vkFreeMemory(mDevice, mCacheMemory, nullptr);
+	vkDestroyImageView(mDevice, mIndirectionView, nullptr);
+	vkDestroyImage(mDevice, mIndirectionImage, nullptr);
+	vkFreeMemory(mDevice, mIndirectionMemory, nullptr);
+	vkDestroyFence(mDevice, mFence, nullptr);
+	vkDestroyCommandPool(mDevice, mCommandPool, nullptr);
+
+	mFile.close();
+	mLevels.clear();
+	mPages.clear();
+	mSlots.clear();
+	mIndirection.clear();
+	mLoadQueue.clear();
+	mLoaded.clear();
+	mFrame = 0;
+	mStats = VirtualTextureStats();
+	mCacheSampler = mIndirectionSampler = VK_NULL_HANDLE;
+	mCacheView = mIndirectionView = VK_NULL_HANDLE;
+	mCache = mIndirectionImage = VK_NULL_HANDLE;
+	mCacheMemory = mIndirectionMemory = VK_NULL_HANDLE;
+	mFence = VK_NULL_HANDLE;
+	mCommandPool = VK_NULL_HANDLE;
+	mDevice = VK_NULL_HANDLE;
+}
+
+void VirtualTexture::createFrameResources(uint32_t frameCount, VkExtent2D feedbackExtent)
+{
+	mFeedbackExtent = feedbackExtent;
+	mFrames.resize(frameCount);
+
+	std::vector<VkCommandBuffer> commandBuffers(frameCount);
+	VkCommandBufferAllocateInfo allocInfo = {};
+	allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+	allocInfo.commandPool = mCommandPool;
+	allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+	allocInfo.commandBufferCount = frameCount;
+
+	if (vkAllocateCommandBuffers(mDevice, &allocInfo, commandBuffers.data()) != VK_SUCCESS)
+		throw std::runtime_error("failed to allocate virtual texture command buffers!");
+
+	VkDeviceSize feedbackSize = static_cast<VkDeviceSize>(feedbackExtent.width) * feedbackExtent.height * sizeof(uint32_t);
+	VkDeviceSize stagingSize = MAX_UPLOADS_PER_FRAME * PAGE_BYTES + mIndirection.size(); // The pages, then the whole table.
+
+	for (uint32_t i = 0; i < frameCount; ++i)
+	{
+		Frame& frame = mFrames[i];
+		frame.commandBuffer = commandBuffers[i];
+
+		void* data;
+		createBuffer(feedbackSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+			frame.feedbackBuffer, frame.feedbackMemory);
+		vkMapMemory(mDevice, frame.feedbackMemory, 0, feedbackSize, 0, &data);
+		std::memset(data, 0xff, feedbackSize); // NO_PAGE until a frame has written it.
+		frame.feedback = static_cast<const uint32_t*>(data);
+
+		createBuffer(stagingSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+			frame.stagingBuffer, frame.stagingMemory);
+		vkMapMemory(mDevice, frame.stagingMemory, 0, stagingSize, 0, &data);
+		frame.staging = static_cast<unsigned char*>(data);
+	}
+}
+
+void VirtualTexture::destroyFrameResources()
+{
+	for (Frame& frame : mFrames)
+	{
+		// Freeing the memory unmaps it.
+		vkDestroyBuffer(mDevice, frame.feedbackBuffer, nullptr);
+		vkFreeMemory(mDevice, frame.feedbackMemory, nullptr);
+		vkDestroyBuffer(mDevice, frame.stagingBuffer, nullptr);
+		vkFreeMemory(mDevice, frame.stagingMemory, nullptr);
+		vkFreeCommandBuffers(mDevice, mCommandPool, 1, &frame.commandBuffer);
+	}
+
+	mFrames.clear();
+}
+
+void VirtualTexture::copyFeedback(VkCommandBuffer commandBuffer, VkImage feedback, uint32_t frameIndex)
+{
+	const Frame& frame = mFrames[frameIndex];
+
+	VkBufferImageCopy region = {};
+	region.imageSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1 };
+	region.imageExtent = { mFeedbackExtent.width, mFeedbackExtent.height, 1 };
+
+	vkCmdCopyImageToBuffer(commandBuffer, feedback, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, frame.feedbackBuffer, 1, &region);
+
+	// processFeedback reads it on the CPU after the frame's fence.
+	VkBufferMemoryBarrier barrier = {};
+	barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+	barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+	barrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+	barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	barrier.buffer = frame.feedbackBuffer;
+	barrier.offset = 0;
+	barrier.size = VK_WHOLE_SIZE;
+
+	vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 0, nullptr, 1, &barrier, 0, nullptr);
+}
+
+void VirtualTexture::processFeedback(uint32_t frameIndex)
+{
+	++mFrame;
+
+	const uint32_t* feedback = mFrames[frameIndex].feedback;
+	size_t pixelCount = static_cast<size_t>(mFeedbackExtent.width) * mFeedbackExtent.height;
+	uint32_t levelCount = static_cast<uint32_t>(mLevels.size());
+
+	std::vector<uint32_t> requested;
+	uint32_t previous = NO_PAGE;
+	for (size_t i = 0; i < pixelCount; ++i)
+	{
+		// Neighbouring pixels mostly want the same page.
+		uint32_t value = feedback[i];
+		if (value == NO_PAGE || value == previous)
+			continue;
+		previous = value;
+
+		uint32_t x = value & 0xfff;
+		uint32_t y = (value >> 12) & 0xfff;
+		uint32_t level = value >> 24;
+		if (level >= levelCount || x >= mLevels[level].pages || y >= mLevels[level].pages)
+			continue;
+
+		request(mLevels[level].firstPage + y * mLevels[level].pages + x, level, requested);
+	}
+
+	mStats.requests += requested.size();
+
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	// Whatever the loader hasn't started on yet is queued again below if this frame still needs it, in this frame's order.
+	for (uint32_t page : mLoadQueue)
+		mPages[page].loading = false;
+	mLoadQueue.clear();
+
+	for (uint32_t page : requested)
+	{
+		if (mPages[page].slot != NO_PAGE)
+			continue;
+
+		++mStats.misses;
+		if (!mPages[page].loading)
+		{
+			mPages[page].loading = true;
+			mLoadQueue.push_back(page);
+		}
+	}
+
+	// Coarse levels first: they're the fallback for the finer pages, and they cover more of the screen. Coarser levels have higher page numbers.
+	std::sort(mLoadQueue.begin(), mLoadQueue.end(), std::greater<uint32_t>());
+
+	if (!mLoadQueue.empty())
+		mWake.notify_one();
+}
+
+VkCommandBuffer VirtualTexture::recordUploads(uint32_t frameIndex)
+{
+	std::vector<LoadedPage> loaded;
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		size_t count = std::min<size_t>(mLoaded.size(), MAX_UPLOADS_PER_FRAME);
+		loaded.assign(std::make_move_iterator(mLoaded.begin()), std::make_move_iterator(mLoaded.begin() + count));
+		mLoaded.erase(mLoaded.begin(), mLoaded.begin() + count);
+	}
+
+	if (loaded.empty())
+		return VK_NULL_HANDLE;
+
+	Frame& frame = mFrames[frameIndex];
+	std::vector<VkBufferImageCopy> regions;
+
+	for (LoadedPage& page : loaded)
+	{
+		Page& state = mPages[page.page];
+		state.loading = false;
+
+		// A page that couldn't be read is asked for again by the next feedback, as is one that finds the cache full of pages in use.
+		uint32_t slot = page.texels.empty() ? NO_PAGE : findSlot();
+		if (slot == NO_PAGE)
+			continue;
+
+		if (mSlots[slot] != NO_PAGE)
+		{
+			mPages[mSlots[slot]].slot = NO_PAGE;
+			++mStats.evictions;
+		}
+		else
+			++mStats.residentPages;
+
+		mSlots[slot] = page.page;
+		state.slot = slot;
+		state.lastRequested = mFrame; // Counts as in use, so the rest of the batch doesn't land in the same slot.
+		++mStats.loads;
+
+		VkDeviceSize offset = regions.size() * PAGE_BYTES;
+		std::memcpy(frame.staging + offset, page.texels.data(), PAGE_BYTES);
+
+		VkBufferImageCopy region = {};
+		region.bufferOffset = offset;
+		region.imageSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1 };
+		region.imageOffset = { static_cast<int32_t>(slot % CACHE_PAGES * PAGE_STRIDE), static_cast<int32_t>(slot / CACHE_PAGES * PAGE_STRIDE), 0 };
+		region.imageExtent = { PAGE_STRIDE, PAGE_STRIDE, 1 };
+		regions.push_back(region);
+	}
+
+	if (regions.empty())
+		return VK_NULL_HANDLE;
+
+	buildIndirection();
+	VkDeviceSize tableOffset = MAX_UPLOADS_PER_FRAME * PAGE_BYTES;
+	std::memcpy(frame.staging + tableOffset, mIndirection.data(), mIndirection.size());
+
+	vkResetCommandBuffer(frame.commandBuffer, 0);
+
+	VkCommandBufferBeginInfo beginInfo = {};
+	beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+	beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+	vkBeginCommandBuffer(frame.commandBuffer, &beginInfo);
+
+	/*
+	The frames in flight may still sample the slots that get replaced. The first scope of a barrier covers everything
+	submitted to the queue before it, so waiting for their fragment shaders here is enough: they see the old pages
+	with the old table, the frame these commands are submitted with sees the new ones.
+	*/
+	uint32_t levelCount = static_cast<uint32_t>(mLevels.size());
+	imageBarrier(frame.commandBuffer, mCache, 1, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+		0, VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+	imageBarrier(frame.commandBuffer, mIndirectionImage, levelCount, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+		0, VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+
+	vkCmdCopyBufferToImage(frame.commandBuffer, frame.stagingBuffer, mCache, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, static_cast<uint32_t>(regions.size()), regions.data());
+	recordIndirectionUpload(frame.commandBuffer, frame.stagingBuffer, tableOffset);
+
+	imageBarrier(frame.commandBuffer, mCache, 1, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+		VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
+	imageBarrier(frame.commandBuffer, mIndirectionImage, levelCount, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+		VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
+
+	if (vkEndCommandBuffer(frame.commandBuffer) != VK_SUCCESS)
+		throw std::runtime_error("failed to record virtual texture uploads!");
+
+	return frame.commandBuffer;
+}
+
+bool VirtualTexture::isLoading() const
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	return !mLoadQueue.empty() || mReading > 0 || !mLoaded.empty();
+}
+
+void VirtualTexture::loaderLoop()
+{
+	std::unique_lock<std::mutex> lock(mMutex);
+
+	for (;;)
+	{
+		mWake.wait(lock, [this] { return mStop || !mLoadQueue.empty(); });
+		if (mStop)
+			return;
+
+		LoadedPage loaded;
+		loaded.page = mLoadQueue.front();
+		mLoadQueue.pop_front();
+		++mReading;
+
+		// The file is only read here once init is done, the lock is only for the queues.
+		lock.unlock();
+		loaded.texels.resize(PAGE_BYTES);
+		if (!readPage(loaded.page, loaded.texels.data()))
+			loaded.texels.clear();
+		lock.lock();
+
+		--mReading;
+		mLoaded.push_back(std::move(loaded));
+	}
+}
+
+bool VirtualTexture::readPage(uint32_t page, unsigned char* texels)
+{
+	mFile.clear();
+	mFile.seekg(sizeof(FileHeader) + page * PAGE_BYTES);
+	return static_cast<bool>(mFile.read(reinterpret_cast<char*>(texels), PAGE_BYTES));
+}
+
+void VirtualTexture::request(uint32_t page, uint32_t level, std::vector<uint32_t>& requested)
+{
+	// The ancestors are the fallback while the page loads. One that was requested this frame already had its own ancestors requested.
+	for (;;)
+	{
+		if (mPages[page].lastRequested == mFrame)
+			return;
+
+		mPages[page].lastRequested = mFrame;
+		requested.push_back(page);
+
+		if (level + 1 == mLevels.size())
+			return;
+
+		page = getParent(page, level++);
+	}
+}
+
+uint32_t VirtualTexture::findSlot()
+{
+	uint32_t root = static_cast<uint32_t>(mPages.size()) - 1;
+	uint32_t oldestSlot = NO_PAGE;
+	uint64_t oldest = mFrame;
+
+	for (uint32_t slot = 0; slot < mSlots.size(); ++slot)
+	{
+		uint32_t page = mSlots[slot];
+		if (page == NO_PAGE)
+			return slot;
+
+		if (page != root && mPages[page].lastRequested < oldest)
+		{
+			oldest = mPages[page].lastRequested;
+			oldestSlot = slot;
+		}
+	}
+
+	return oldestSlot;
+}
+
+void VirtualTexture::buildIndirection()
+{
+	// Top down, so a page that isn't resident can copy its parent's entry, which is final already. The coarsest page is always resident.
+	for (uint32_t level = static_cast<uint32_t>(mLevels.size()); level-- > 0;)
+	{
+		const Level& info = mLevels[level];
+		for (uint32_t y = 0; y < info.pages; ++y)
+		{
+			for (uint32_t x = 0; x < info.pages; ++x)
+			{
+				uint32_t page = info.firstPage + y * info.pages + x;
+				unsigned char* entry = &mIndirection[static_cast<size_t>(page) * 4];
+				uint32_t slot = mPages[page].slot;
+
+				if (slot != NO_PAGE)
+				{
+					entry[0] = static_cast<unsigned char>(slot % CACHE_PAGES);
+					entry[1] = static_cast<unsigned char>(slot / CACHE_PAGES);
+					entry[2] = static_cast<unsigned char>(level);
+					entry[3] = 0;
+				}
+				else
+				{
+					const Level& parent = mLevels[level + 1];
+					std::memcpy(entry, &mIndirection[static_cast<size_t>(parent.firstPage + (y / 2) * parent.pages + x / 2) * 4], 4);
+				}
+			}
+		}
+	}
+}
+
+void VirtualTexture::recordIndirectionUpload(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset)
+{
+	// mIndirection is laid out level by level, so every level is a tightly packed mip of the table.
+	std::vector<VkBufferImageCopy> regions(mLevels.size());
+	for (uint32_t level = 0; level < mLevels.size(); ++level)
+	{
+		regions[level].bufferOffset = offset + static_cast<VkDeviceSize>(mLevels[level].firstPage) * 4;
+		regions[level].imageSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, level, 0, 1 };
+		regions[level].imageExtent = { mLevels[level].pages, mLevels[level].pages, 1 };
+	}
+
+	vkCmdCopyBufferToImage(commandBuffer, buffer, mIndirectionImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, static_cast<uint32_t>(regions.size()), regions.data());
+}
+
+uint32_t VirtualTexture::getParent(uint32_t page, uint32_t level) const
+{
+	const Level& info = mLevels[level];
+	const Level& parent = mLevels[level + 1];
+	uint32_t x = (page - info.firstPage) % info.pages;
+	uint32_t y = (page - info.firstPage) / info.pages;
+	return parent.firstPage + (y / 2) * parent.pages + x / 2;
+}
+
+void VirtualTexture::createImage(uint32_t width, uint32_t height, uint32_t levels, VkFormat format, VkImage& image, VkDeviceMemory& memory, VkImageView& view)
+{
+	VkImageCreateInfo imageInfo = {};
+	imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+	imageInfo.imageType = VK_IMAGE_TYPE_2D;
+	imageInfo.extent.width = width;
+	imageInfo.extent.height = height;
+	imageInfo.extent.depth = 1;
+	imageInfo.mipLevels = levels;
+	imageInfo.arrayLayers = 1;
+	imageInfo.format = format;
+	imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+	imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+	imageInfo.usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+	imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+	imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+
+	if (vkCreateImage(mDevice, &imageInfo, nullptr, &image) != VK_SUCCESS)
+		throw std::runtime_error("failed to create virtual texture image!");
+
+	VkMemoryRequirements memRequirements;
+	vkGetImageMemoryRequirements(mDevice, image, &memRequirements);
+
+	VkMemoryAllocateInfo allocInfo = {};
+	allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+	allocInfo.allocationSize = memRequirements.size;
+	allocInfo.memoryTypeIndex = findMemoryType(memRequirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+	if (vkAllocateMemory(mDevice, &allocInfo, nullptr, &memory) != VK_SUCCESS)
+		throw std::runtime_error("failed to allocate virtual texture image memory!");
+
+	vkBindImageMemory(mDevice, image, memory, 0);
+
+	VkImageViewCreateInfo viewInfo = {};
+	viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+	viewInfo.image = image;
+	viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+	viewInfo.format = format;
+	viewInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+	viewInfo.subresourceRange.baseMipLevel = 0;
+	viewInfo.subresourceRange.levelCount = levels;
+	viewInfo.subresourceRange.baseArrayLayer = 0;
+	viewInfo.subresourceRange.layerCount = 1;
+
+	if (vkCreateImageView(mDevice, &viewInfo, nullptr, &view) != VK_SUCCESS)
+		throw std::runtime_error("failed to create virtual texture image view!");
+}
+
+void VirtualTexture::createBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties, VkBuffer& buffer, VkDeviceMemory& memory)
+{
+	VkBufferCreateInfo bufferInfo = {};
+	bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+	bufferInfo.size = size;
+	bufferInfo.usage = usage;
+	bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+	if (vkCreateBuffer(mDevice, &bufferInfo, nullptr, &buffer) != VK_SUCCESS)
+		throw std::runtime_error("failed to create virtual texture buffer!");
+
+	VkMemoryRequirements memRequirements;
+	vkGetBufferMemoryRequirements(mDevice, buffer, &memRequirements);
+
+	VkMemoryAllocateInfo allocInfo = {};
+	allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+	allocInfo.allocationSize = memRequirements.size;
+	allocInfo.memoryTypeIndex = findMemoryType(memRequirements.memoryTypeBits, properties);
+
+	if (vkAllocateMemory(mDevice, &allocInfo, nullptr, &memory) != VK_SUCCESS)
+		throw std::runtime_error("failed to allocate virtual texture buffer memory!");
+
+	vkBindBufferMemory(mDevice, buffer, memory, 0);
+}
+
+VkSampler VirtualTexture::createSampler(VkFilter filter)
+{
+	// The borders cover the bilinear footprint, so no anisotropy (its footprint is larger) and no mips.
+	VkSamplerCreateInfo samplerInfo = {};
+	samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+	samplerInfo.magFilter = filter;
+	samplerInfo.minFilter = filter;
+	samplerInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+	samplerInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+	samplerInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+	samplerInfo.anisotropyEnable = VK_FALSE;
+	samplerInfo.maxAnisotropy = 1;
+	samplerInfo.borderColor = VK_BORDER_COLOR_INT_OPAQUE_BLACK;
+	samplerInfo.unnormalizedCoordinates = VK_FALSE;
+	samplerInfo.compareEnable = VK_FALSE;
+	samplerInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+
+	VkSampler sampler;
+	if (vkCreateSampler(mDevice, &samplerInfo, nullptr, &sampler) != VK_SUCCESS)
+		throw std::runtime_error("failed to create virtual texture sampler!");
+
+	return sampler;
+}
+
+VkCommandBuffer VirtualTexture::beginCommands()
+{
+	VkCommandBufferAllocateInfo allocInfo = {};
+	allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+	allocInfo.commandPool = mCommandPool;
+	allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+	allocInfo.commandBufferCount = 1;
+
+	VkCommandBuffer commandBuffer;
+	if (vkAllocateCommandBuffers(mDevice, &allocInfo, &commandBuffer) != VK_SUCCESS)
+		throw std::runtime_error("failed to allocate virtual texture command buffer!");
+
+	VkCommandBufferBeginInfo beginInfo = {};
+	beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+	beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+	vkBeginCommandBuffer(commandBuffer, &beginInfo);
+
+	return commandBuffer;
+}
+
+void VirtualTexture::submitCommands(VkCommandBuffer commandBuffer)
+{
+	vkEndCommandBuffer(commandBuffer);
+
+	VkSubmitInfo submitInfo = {};
+	submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+	submitInfo.commandBufferCount = 1;
+	submitInfo.pCommandBuffers = &commandBuffer;
+
+	if (vkQueueSubmit(mQueue, 1, &submitInfo, mFence) != VK_SUCCESS)
+		throw std::runtime_error("failed to submit virtual texture uploads!");
+
+	vkWaitForFences(mDevice, 1, &mFence, VK_TRUE, std::numeric_limits<uint64_t>::max());
+	vkResetFences(mDevice, 1, &mFence);
+	vkFreeCommandBuffers(mDevice, mCommandPool, 1, &commandBuffer);
+}
+
+uint32_t VirtualTexture::findMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties)
+{
+	VkPhysicalDeviceMemoryProperties memProperties;
+	vkGetPhysicalDeviceMemoryProperties(mPhysDevice, &memProperties);
+
+	for (uint32_t i = 0; i < memProperties.memoryTypeCount; ++i)
+	{
+		if ((typeFilter & (1 << i)) &&
+			(memProperties.memoryTypes[i].propertyFlags & properties) == properties)
+			return i;
+	}
+
+	throw std::runtime_error("failed to find suitable memory type!");
+}
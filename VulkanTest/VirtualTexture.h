@@ -0,0 +1,189 @@
+/*
+VirtualTexture.h
+Virtual texturing for textures too large to upload whole: only the pages the frame actually samples are resident.
+
+The texture is converted once (build()) into a tiled file: its mip chain cut into PAGE_SIZE^2 pages, each stored with
+a PAGE_BORDER texel border taken from its neighbours, so bilinear filtering still works at page edges in the cache.
+At runtime:
+- A low resolution feedback pass (shaders/Feedback.frag, FEEDBACK_DIVISOR times smaller than the screen) writes the
+  page (level, x, y) every pixel needs, and copyFeedback() copies it into a host visible buffer per swap chain image.
+- processFeedback() reads that buffer once the frame that wrote it is done, dedupes the pages and queues the missing
+  ones (and their missing ancestors) for the loader thread, coarse levels first.
+- recordUploads() copies what the loader read into slots of the physical page cache, replacing the least recently
+  requested pages when it's full, and uploads the indirection table: one texel per page of every level, holding the
+  cache slot of the page, or of its closest resident ancestor while it isn't resident.
+- The scene shader (TestFrag.frag built with VIRTUAL_TEXTURE) fetches the page's entry from the table and samples the cache.
+
+No sparse images or sparse binding, the cache and the table are ordinary images, so this runs on any Vulkan device
+including software ones. The coarsest level is a single page that stays resident, so every lookup finds something.
+*/
+
+#ifndef VIRTUAL_TEXTURE_H
+#define VIRTUAL_TEXTURE_H
+
+#include <vulkan/vulkan.h>
+
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct VirtualTextureStats
+{
+	uint64_t requests = 0; // Distinct pages the feedback asked for, summed over the frames.
+	uint64_t misses = 0; // Requested pages that weren't resident.
+	uint64_t loads = 0; // Pages read from the file and uploaded.
+	uint64_t evictions = 0; // Resident pages replaced by other pages.
+	uint32_t residentPages = 0;
+};
+
+class VirtualTexture
+{
+public:
+	static const uint32_t PAGE_SIZE = 128; // Texels of the texture per page side. Has to match VirtualTexture.glsl.
+	static const uint32_t PAGE_BORDER = 4; // Has to match VirtualTexture.glsl.
+	static const uint32_t PAGE_STRIDE = PAGE_SIZE + 2 * PAGE_BORDER; // Texels per page side as stored, in the file and in the cache.
+	static const uint32_t CACHE_PAGES = 16; // Slots per side of the cache, so at most CACHE_PAGES^2 pages are resident.
+	static const uint32_t FEEDBACK_DIVISOR = 8; // Feedback resolution divisor. Has to match FEEDBACK_LOD_BIAS in Feedback.frag.
+	static const uint32_t MAX_UPLOADS_PER_FRAME = 16;
+	static constexpr uint32_t NO_PAGE = ~0u; // What the feedback is cleared to, where nothing uses the texture.
+	static const VkFormat FORMAT = VK_FORMAT_R8G8B8A8_UNORM;
+	static const VkFormat FEEDBACK_FORMAT = VK_FORMAT_R32_UINT; // x | y << 12 | level << 24, see Feedback.frag.
+	static const VkFormat INDIRECTION_FORMAT = VK_FORMAT_R8G8B8A8_UINT; // Slot x, slot y, resident level.
+
+	/*
+	Converts the image at imagePath into the tiled format at outPath.
+	The image has to be square, a power of two and at least PAGE_SIZE wide. False if it isn't, or can't be read or written.
+	*/
+	static bool build(const std::string& imagePath, const std::string& outPath);
+
+	static VkExtent2D getFeedbackExtent(VkExtent2D screenExtent);
+
+	// Opens a file written by build(). The uploads go to queue, which belongs to queueFamily.
+	void init(VkDevice device, VkPhysicalDevice physDevice, VkQueue queue, uint32_t queueFamily, const std::string& path);
+	void destroy();
+
+	// Feedback readback buffers and upload staging, one of each per swap chain image. Again whenever the swap chain changes.
+	void createFrameResources(uint32_t frameCount, VkExtent2D feedbackExtent);
+	void destroyFrameResources();
+
+	// Outside of a render pass, with feedback (getFeedbackExtent of the screen) in TRANSFER_SRC_OPTIMAL.
+	void copyFeedback(VkCommandBuffer commandBuffer, VkImage feedback, uint32_t frameIndex);
+
+	// Once the last frame that used frameIndex is done.
+	void processFeedback(uint32_t frameIndex);
+
+	/*
+	Copies up to MAX_UPLOADS_PER_FRAME loaded pages into the cache and updates the indirection table.
+	VK_NULL_HANDLE if there's nothing to upload. Otherwise it has to go into the same submit as the frame's commands,
+	ahead of them: the frame's fence guards the staging, and its barriers wait for the frames in flight to stop sampling.
+	*/
+	VkCommandBuffer recordUploads(uint32_t frameIndex);
+
+	bool isLoading() const; // Pages are queued, being read or waiting for an upload.
+
+	VkImageView getCacheView() const { return mCacheView; }
+	VkSampler getCacheSampler() const { return mCacheSampler; }
+	VkImageView getIndirectionView() const { return mIndirectionView; }
+	VkSampler getIndirectionSampler() const { return mIndirectionSampler; }
+	const VirtualTextureStats& getStats() const { return mStats; }
+
+private:
+	struct FileHeader
+	{
+		char magic[4];
+		uint32_t version;
+		uint32_t size; // Texels per side of level 0.
+		uint32_t pageSize;
+		uint32_t pageBorder;
+		uint32_t levels;
+	};
+
+	struct Level
+	{
+		uint32_t pages = 0; // Per side.
+		uint32_t firstPage = 0; // Pages are numbered level by level, row by row.
+	};
+
+	struct Page
+	{
+		uint32_t slot = NO_PAGE; // In the cache, NO_PAGE while not resident.
+		uint64_t lastRequested = 0; // Frame.
+		bool loading = false; // Queued, being read or waiting for an upload.
+	};
+
+	struct LoadedPage
+	{
+		uint32_t page;
+		std::vector<unsigned char> texels; // PAGE_STRIDE^2, RGBA8.
+	};
+
+	// Per swap chain image.
+	struct Frame
+	{
+		VkBuffer feedbackBuffer = VK_NULL_HANDLE;
+		VkDeviceMemory feedbackMemory = VK_NULL_HANDLE;
+		const uint32_t* feedback = nullptr; // Persistently mapped.
+		VkBuffer stagingBuffer = VK_NULL_HANDLE;
+		VkDeviceMemory stagingMemory = VK_NULL_HANDLE;
+		unsigned char* staging = nullptr; // Persistently mapped.
+		VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+	};
+
+	static const uint32_t FILE_VERSION = 1;
+	static const VkDeviceSize PAGE_BYTES = PAGE_STRIDE * PAGE_STRIDE * 4;
+
+	void loaderLoop();
+	bool readPage(uint32_t page, unsigned char* texels); // PAGE_BYTES from the file.
+	void request(uint32_t page, uint32_t level, std::vector<uint32_t>& requested); // Marks the page and its ancestors as requested this frame.
+	uint32_t findSlot(); // A free slot, or the least recently requested page's. NO_PAGE if every page in the cache is in use.
+	void buildIndirection(); // Into mIndirection, from the resident pages.
+	void recordIndirectionUpload(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset);
+	uint32_t getParent(uint32_t page, uint32_t level) const;
+
+	void createImage(uint32_t width, uint32_t height, uint32_t levels, VkFormat format, VkImage& image, VkDeviceMemory& memory, VkImageView& view);
+	void createBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties, VkBuffer& buffer, VkDeviceMemory& memory);
+	VkSampler createSampler(VkFilter filter);
+	VkCommandBuffer beginCommands();
+	void submitCommands(VkCommandBuffer commandBuffer); // Waits for the commands.
+	uint32_t findMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties);
+
+	VkDevice mDevice = VK_NULL_HANDLE;
+	VkPhysicalDevice mPhysDevice = VK_NULL_HANDLE;
+	VkQueue mQueue = VK_NULL_HANDLE;
+	VkCommandPool mCommandPool = VK_NULL_HANDLE;
+	VkFence mFence = VK_NULL_HANDLE;
+
+	VkImage mCache = VK_NULL_HANDLE; // CACHE_PAGES^2 slots of PAGE_STRIDE^2 texels.
+	VkDeviceMemory mCacheMemory = VK_NULL_HANDLE;
+	VkImageView mCacheView = VK_NULL_HANDLE;
+	VkSampler mCacheSampler = VK_NULL_HANDLE; // Bilinear, a single level.
+	VkImage mIndirectionImage = VK_NULL_HANDLE; // One texel per page, one mip per level.
+	VkDeviceMemory mIndirectionMemory = VK_NULL_HANDLE;
+	VkImageView mIndirectionView = VK_NULL_HANDLE;
+	VkSampler mIndirectionSampler = VK_NULL_HANDLE; // Nearest, the shader only uses texelFetch.
+
+	std::vector<Level> mLevels;
+	std::vector<Page> mPages;
+	std::vector<uint32_t> mSlots; // Page in every cache slot, NO_PAGE for a free one.
+	std::vector<unsigned char> mIndirection; // 4 bytes per page, in page order, so every level is one contiguous mip.
+	std::vector<Frame> mFrames;
+	VkExtent2D mFeedbackExtent = { 0, 0 };
+	uint64_t mFrame = 0;
+	VirtualTextureStats mStats;
+
+	// Shared with the loader thread.
+	std::ifstream mFile;
+	std::thread mLoader;
+	mutable std::mutex mMutex;
+	std::condition_variable mWake;
+	std::deque<uint32_t> mLoadQueue; // Pages to read, most important first.
+	std::vector<LoadedPage> mLoaded;
+	uint32_t mReading = 0; // Pages the loader took off the queue and hasn't put into mLoaded yet.
+	bool mStop = false;
+};
+
+#endif // !VIRTUAL_TEXTURE_H
@@ -7,18 +7,405 @@ using glfw, multiply using glm, and close it.
 #define GLFW_INCLUDE_VULKAN
 #include <GLFW/glfw3.h>
 
-#define GLM_FORCE_RADIANS
-#define GLM_FORCE_DEPTH_ZERO_TO_ONE
-#include <glm/vec4.hpp>
-#include <glm/mat4x4.hpp>
-
 #include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <cstdlib>
+#include <algorithm>
+#include <filesystem>
 
 #include "DemoApp.h"
+#include "MeshletBuilder.h"
+#include <tiny_obj_loader.h>
+#include <stb_image.h>
+
+/*
+Anti-aliasing configurations the benchmark goes through: every MSAA count with and without
+sample shading, and FXAA on its own and on top of 2x MSAA.
+Counts the device doesn't support get lowered, so some lines may repeat on smaller GPUs.
+*/
+static std::vector<RenderSettings> getBenchmarkSweep()
+{
+	std::vector<RenderSettings> sweep;
+
+	for (VkSampleCountFlagBits samples : { VK_SAMPLE_COUNT_1_BIT, VK_SAMPLE_COUNT_2_BIT, VK_SAMPLE_COUNT_4_BIT, VK_SAMPLE_COUNT_8_BIT })
+	{
+		RenderSettings settings;
+		settings.msaaSamples = samples;
+		sweep.push_back(settings);
+
+		if (samples == VK_SAMPLE_COUNT_1_BIT)
+			continue;
+
+		for (float minSampleShading : { 0.5f, 1.0f })
+		{
+			settings.sampleShading = true;
+			settings.minSampleShading = minSampleShading;
+			sweep.push_back(settings);
+		}
+	}
+
+	for (VkSampleCountFlagBits samples : { VK_SAMPLE_COUNT_1_BIT, VK_SAMPLE_COUNT_2_BIT })
+	{
+		RenderSettings settings;
+		settings.msaaSamples = samples;
+		settings.postAA = PostAA::FXAA;
+		sweep.push_back(settings);
+	}
+
+	return sweep;
+}
+
+/*
+Times the .obj parser on the teapot models: LoadObj reading a std::istream line by line against
+LoadObjFromBuffer tokenizing the file in place, which is what LoadObj does with a filename.
+Both parse the same bytes from memory, so the numbers leave out the disk. Prints the best of
+`repetitions` runs.
+*/
+static void benchmarkObjLoading(int repetitions)
+{
+	const char* models[] = { "models/teapot.obj", "models/teapot2.obj", "models/utah_teapot.obj" };
+
+	for (const char* model : models)
+	{
+		std::ifstream file(model, std::ios::binary);
+		if (!file)
+		{
+			std::cerr << "cannot open " << model << std::endl;
+			continue;
+		}
+		std::stringstream contents;
+		contents << file.rdbuf();
+		const std::string text = contents.str();
+		const double megabytes = text.size() / 1.0e6;
+
+		double streamTime = 1.0e9, bufferTime = 1.0e9;
+		size_t streamIndices = 0, bufferIndices = 0;
+
+		for (int i = 0; i < repetitions; ++i)
+		{
+			tinyobj::attrib_t attrib;
+			std::vector<tinyobj::shape_t> shapes;
+			std::vector<tinyobj::material_t> materials;
+			std::string warn, err;
+			std::istringstream stream(text);
+
+			auto start = std::chrono::high_resolution_clock::now();
+			tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err, &stream);
+			streamTime = std::min(streamTime, std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count());
+
+			streamIndices = 0;
+			for (const auto& shape : shapes)
+				streamIndices += shape.mesh.indices.size();
+		}
+
+		for (int i = 0; i < repetitions; ++i)
+		{
+			tinyobj::attrib_t attrib;
+			std::vector<tinyobj::shape_t> shapes;
+			std::vector<tinyobj::material_t> materials;
+			std::string warn, err;
+
+			auto start = std::chrono::high_resolution_clock::now();
+			tinyobj::LoadObjFromBuffer(&attrib, &shapes, &materials, &warn, &err, text.data(), text.size());
+			bufferTime = std::min(bufferTime, std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count());
+
+			bufferIndices = 0;
+			for (const auto& shape : shapes)
+				bufferIndices += shape.mesh.indices.size();
+		}
+
+		std::cout << model << " (" << megabytes << " MB): istream " << megabytes / streamTime << " MB/s, buffer "
+			<< megabytes / bufferTime << " MB/s, " << streamTime / bufferTime << "x";
+		if (streamIndices != bufferIndices)
+			std::cout << ", index counts differ (" << streamIndices << " vs " << bufferIndices << ")";
+		std::cout << std::endl;
+	}
+}
+
+/*
+Splits the teapot models into meshlets the way the app does at load time (see MeshletBuilder.h)
+and prints how well they fill up and how long it takes. Meshlets are built from the .obj positions,
+so the numbers don't depend on how the app welds vertices.
+*/
+static void printMeshletStats()
+{
+	const char* models[] = { "models/teapot.obj", "models/teapot2.obj", "models/utah_teapot.obj" };
+
+	for (const char* model : models)
+	{
+		tinyobj::attrib_t attrib;
+		std::vector<tinyobj::shape_t> shapes;
+		std::vector<tinyobj::material_t> materials;
+		std::string warn, err;
+
+		if (!tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err, model))
+		{
+			std::cerr << "cannot load " << model << ": " << err << std::endl;
+			continue;
+		}
+
+		std::vector<uint32_t> indices;
+		for (const auto& shape : shapes)
+			for (const auto& index : shape.mesh.indices)
+				indices.push_back(static_cast<uint32_t>(index.vertex_index));
+
+		auto start = std::chrono::high_resolution_clock::now();
+		std::vector<Meshlet> meshlets = buildMeshlets(attrib.vertices.data(), attrib.vertices.size() / 3, indices);
+		double time = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
 
-int main()
+		size_t vertices = 0, cones = 0;
+		for (const Meshlet& meshlet : meshlets)
+		{
+			vertices += meshlet.vertexCount;
+			if (meshlet.coneCutoff < 1.f)
+				++cones;
+		}
+
+		std::cout << model << ": " << indices.size() / 3 << " triangles in " << meshlets.size() << " meshlets, "
+			<< static_cast<double>(indices.size() / 3) / meshlets.size() << " triangles and " << static_cast<double>(vertices) / meshlets.size()
+			<< " vertices each, " << cones << " with a usable normal cone, " << time * 1000.0 << " ms" << std::endl;
+	}
+}
+
+/*
+Decodes every image in textures/ on the calling thread only and then with stb_image's default
+thread count (see "Multithreaded decoding" in stb_image.h), and checks both give the same pixels.
+Decodes from memory, as RGBA like the app does, so the numbers leave out the disk. Then compares
+decoding and copying into a staging buffer with decoding straight into it (stbi_load_from_memory_into,
+what the material library does with DemoApp's staging buffers). Prints the best of `repetitions` runs,
+MB/s are of decoded pixels.
+*/
+static void benchmarkTextureDecoding(int repetitions)
+{
+	for (const auto& entry : std::filesystem::directory_iterator("textures"))
+	{
+		if (!entry.is_regular_file())
+			continue;
+
+		const std::string path = entry.path().generic_string();
+		std::ifstream file(path, std::ios::binary);
+		std::stringstream contents;
+		contents << file.rdbuf();
+		const std::string bytes = contents.str();
+
+		int width = 0, height = 0, channels = 0;
+		if (!stbi_info_from_memory(reinterpret_cast<const stbi_uc*>(bytes.data()), static_cast<int>(bytes.size()), &width, &height, &channels))
+		{
+			std::cerr << "skipping " << path << ": " << stbi_failure_reason() << std::endl;
+			continue;
+		}
+		const size_t imageSize = static_cast<size_t>(width) * height * STBI_rgb_alpha;
+		const double megabytes = imageSize / 1.0e6;
+
+		double times[2] = { 1.0e9, 1.0e9 };
+		std::vector<stbi_uc> pixels[2];
+
+		for (int threads = 0; threads < 2; ++threads)
+		{
+			stbi_set_decode_thread_count(threads == 0 ? 1 : 0);
+
+			for (int i = 0; i < repetitions; ++i)
+			{
+				auto start = std::chrono::high_resolution_clock::now();
+				stbi_uc* decoded = stbi_load_from_memory(reinterpret_cast<const stbi_uc*>(bytes.data()), static_cast<int>(bytes.size()),
+					&width, &height, &channels, STBI_rgb_alpha);
+				times[threads] = std::min(times[threads], std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count());
+
+				if (decoded)
+					pixels[threads].assign(decoded, decoded + imageSize);
+				stbi_image_free(decoded);
+			}
+		}
+		stbi_set_decode_thread_count(0);
+
+		// Stands in for mapped staging memory.
+		std::vector<stbi_uc> staging(imageSize);
+		double copyTime = 1.0e9, intoTime = 1.0e9;
+		bool intoFailed = false;
+
+		for (int i = 0; i < repetitions; ++i)
+		{
+			auto start = std::chrono::high_resolution_clock::now();
+			stbi_uc* decoded = stbi_load_from_memory(reinterpret_cast<const stbi_uc*>(bytes.data()), static_cast<int>(bytes.size()),
+				&width, &height, &channels, STBI_rgb_alpha);
+			if (decoded)
+				std::copy(decoded, decoded + imageSize, staging.begin());
+			stbi_image_free(decoded);
+			copyTime = std::min(copyTime, std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count());
+
+			start = std::chrono::high_resolution_clock::now();
+			intoFailed |= !stbi_load_from_memory_into(reinterpret_cast<const stbi_uc*>(bytes.data()), static_cast<int>(bytes.size()),
+				staging.data(), width, height, width * STBI_rgb_alpha, &channels, STBI_rgb_alpha);
+			intoTime = std::min(intoTime, std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count());
+		}
+
+		std::cout << path << " (" << width << "x" << height << "): 1 thread " << megabytes / times[0] << " MB/s, all threads "
+			<< megabytes / times[1] << " MB/s, " << times[0] / times[1] << "x; decode + copy " << megabytes / copyTime
+			<< " MB/s, decode into staging " << megabytes / intoTime << " MB/s";
+		if (pixels[0].empty() || pixels[0] != pixels[1])
+			std::cout << ", decoded images differ";
+		if (intoFailed || staging != pixels[1])
+			std::cout << ", stbi_load_into differs";
+		std::cout << std::endl;
+	}
+}
+
+/*
+Times stb_image's inflate on the PNGs in `directory`: the IDAT chunks of each file are joined
+into the zlib stream the PNG loader hands to stbi_zlib_decode_malloc_guesssize_headerflag, and
+that is decoded on its own. Prints the best of `repetitions` runs, MB/s are of inflated data.
+*/
+static void benchmarkInflate(const std::string& directory, int repetitions)
+{
+	for (const auto& entry : std::filesystem::directory_iterator(directory))
+	{
+		if (!entry.is_regular_file() || entry.path().extension() != ".png")
+			continue;
+
+		const std::string path = entry.path().generic_string();
+		std::ifstream file(path, std::ios::binary);
+		std::stringstream contents;
+		contents << file.rdbuf();
+		const std::string bytes = contents.str();
+
+		// 8 byte signature, then chunks of big endian length, type, data and CRC.
+		std::string stream;
+		for (size_t offset = 8; offset + 12 <= bytes.size();)
+		{
+			const unsigned char* chunk = reinterpret_cast<const unsigned char*>(bytes.data()) + offset;
+			const size_t length = (static_cast<size_t>(chunk[0]) << 24) | (chunk[1] << 16) | (chunk[2] << 8) | chunk[3];
+			if (offset + 12 + length > bytes.size())
+				break;
+			if (bytes.compare(offset + 4, 4, "IDAT") == 0)
+				stream.append(bytes, offset + 8, length);
+			offset += 12 + length;
+		}
+
+		double time = 1.0e9;
+		int inflatedSize = 0;
+		for (int i = 0; i < repetitions; ++i)
+		{
+			auto start = std::chrono::high_resolution_clock::now();
+			char* inflated = stbi_zlib_decode_malloc_guesssize_headerflag(stream.data(), static_cast<int>(stream.size()), 16384, &inflatedSize, 1);
+			time = std::min(time, std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count());
+
+			if (!inflated)
+			{
+				inflatedSize = 0;
+				break;
+			}
+			stbi_image_free(inflated);
+		}
+
+		if (inflatedSize == 0)
+			std::cerr << path << ": " << stbi_failure_reason() << std::endl;
+		else
+			std::cout << path << ": " << stream.size() / 1.0e6 << " MB inflated to " << inflatedSize / 1.0e6 << " MB, "
+				<< inflatedSize / 1.0e6 / time << " MB/s" << std::endl;
+	}
+}
+
+/*
+Command line:
+--msaa <samples>            MSAA sample count (1, 2, 4, 8, ...)
+--sample-shading <fraction> enable sample shading with that minSampleShading
+--fxaa                      FXAA post process pass
+--benchmark [frames]        time every configuration from getBenchmarkSweep instead of running interactively
+--frames-in-flight <count>  how many frames the CPU may queue ahead of the GPU
+--present <policy>          low-latency, vsync, relaxed or uncapped (see PresentPolicy)
+--fps <rate>                frame rate cap, 0 for none
+--texture-budget <MB>       device local memory the textures may take, VK_EXT_memory_budget decides by default (see TextureResidency)
+--obj-benchmark [runs]      time the .obj parser on the teapot models (see benchmarkObjLoading) and exit
+--meshlets                  split the teapot models into meshlets and print their stats (see printMeshletStats) and exit
+--texture-benchmark [runs]  time single and multithreaded decoding of the textures, and decoding into staging (see benchmarkTextureDecoding), and exit
+--inflate-benchmark [dir]   time inflating the PNGs in dir, textures by default (see benchmarkInflate) and exit
+--build-virtual-texture [image] cut image, VIRTUAL_TEXTURE_SOURCE by default, into pages for VirtualTexture (next to it, as .vt) and exit
+*/
+int main(int argc, char** argv)
 {
 	DemoApp app;
+	RenderSettings settings;
+	FramePacingSettings pacing;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string arg = argv[i];
+		bool hasValue = i + 1 < argc && argv[i + 1][0] != '-';
+
+		if (arg == "--msaa" && hasValue)
+			settings.msaaSamples = static_cast<VkSampleCountFlagBits>(std::atoi(argv[++i]));
+		else if (arg == "--sample-shading" && hasValue)
+		{
+			settings.sampleShading = true;
+			settings.minSampleShading = static_cast<float>(std::atof(argv[++i]));
+		}
+		else if (arg == "--fxaa")
+			settings.postAA = PostAA::FXAA;
+		else if (arg == "--benchmark")
+			app.setBenchmark(getBenchmarkSweep(), hasValue ? std::atoi(argv[++i]) : 500);
+		else if (arg == "--frames-in-flight" && hasValue)
+			pacing.framesInFlight = static_cast<uint32_t>(std::atoi(argv[++i]));
+		else if (arg == "--present" && hasValue)
+		{
+			std::string policy = argv[++i];
+			if (policy == "vsync")
+				pacing.presentPolicy = PresentPolicy::Vsync;
+			else if (policy == "relaxed")
+				pacing.presentPolicy = PresentPolicy::VsyncRelaxed;
+			else if (policy == "uncapped")
+				pacing.presentPolicy = PresentPolicy::Uncapped;
+			else
+				pacing.presentPolicy = PresentPolicy::LowLatency;
+		}
+		else if (arg == "--fps" && hasValue)
+		{
+			double fps = std::atof(argv[++i]);
+			pacing.targetFrameTime = fps > 0.0 ? 1.0 / fps : 0.0;
+		}
+		else if (arg == "--texture-budget" && hasValue)
+			app.setTextureBudget(static_cast<VkDeviceSize>(std::atof(argv[++i]) * 1024 * 1024));
+		else if (arg == "--obj-benchmark")
+		{
+			benchmarkObjLoading(hasValue ? std::atoi(argv[++i]) : 20);
+			return EXIT_SUCCESS;
+		}
+		else if (arg == "--meshlets")
+		{
+			printMeshletStats();
+			return EXIT_SUCCESS;
+		}
+		else if (arg == "--texture-benchmark")
+		{
+			benchmarkTextureDecoding(hasValue ? std::atoi(argv[++i]) : 10);
+			return EXIT_SUCCESS;
+		}
+		else if (arg == "--inflate-benchmark")
+		{
+			benchmarkInflate(hasValue ? argv[++i] : "textures", 10);
+			return EXIT_SUCCESS;
+		}
+		else if (arg == "--build-virtual-texture")
+		{
+			std::filesystem::path image = hasValue ? argv[++i] : VIRTUAL_TEXTURE_SOURCE;
+			std::filesystem::path tiled = std::filesystem::path(image).replace_extension(".vt");
+			if (!VirtualTexture::build(image.string(), tiled.string()))
+			{
+				std::cerr << "failed to build " << tiled.string() << ", " << image.string() << " has to be square, a power of two and at least "
+					<< VirtualTexture::PAGE_SIZE << " texels wide" << std::endl;
+				return EXIT_FAILURE;
+			}
+
+			std::cout << image.string() << " -> " << tiled.string() << std::endl;
+			return EXIT_SUCCESS;
+		}
+		else
+			std::cerr << "unknown argument " << arg << std::endl;
+	}
+
+	app.setRenderSettings(settings);
+	app.setFramePacing(pacing);
 
 	try
 	{
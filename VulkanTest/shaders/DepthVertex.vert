@@ -0,0 +1,62 @@
+#version 450
+
+// Depth pre-pass vertex shader. Has to produce bit-identical positions to TestVertex.vert,
+// because the main pass only draws fragments whose depth is EQUAL to what this pass wrote.
+layout (set = 0, binding = 0) uniform UniformBufferObject
+{
+	mat4 model;
+	mat4 view;
+	mat4 proj;
+
+	vec4 uLightPos;
+	vec4 uLightCol;
+
+	mat4 uShadowViewProj[6];
+	vec4 uShadowParams;
+} ubo;
+
+// Attributes. Position only stream.
+layout (location = 0) in vec3 inPosition;
+
+//instance attributes
+layout(location = 4) in vec3 aInstancePos;
+layout(location = 5) in vec3 aInstanceRot;
+
+// Keeps the compiler from computing gl_Position differently than in TestVertex.vert.
+invariant gl_Position;
+
+void main()
+{
+	// Same rotation as TestVertex.vert.
+	mat3 mx, my, mz;
+	// rotate around x
+	float s = sin(aInstanceRot.x);
+	float c = cos(aInstanceRot.x);
+
+	mx[0] = vec3(c, s, .0);
+	mx[1] = vec3(-s, c, .0);
+	mx[2] = vec3(.0, .0, 1.0);
+
+	// rotate around y
+	s = sin(aInstanceRot.y);
+	c = cos(aInstanceRot.y);
+
+	my[0] = vec3(c, 0.0, s);
+	my[1] = vec3(0.0, 1.0, 0.0);
+	my[2] = vec3(-s, 0.0, c);
+	
+	// rotate around z
+	s = sin(aInstanceRot.z);
+	c = cos(aInstanceRot.z);	
+	
+	mz[0] = vec3(1.0, 0.0, 0.0);
+	mz[1] = vec3(0.0, c, s);
+	mz[2] = vec3(0.0, -s, c);
+	
+	mat3 rotMat = mz * my * mx;
+
+	vec4 localPos = vec4(inPosition.xyz * rotMat, 1.);
+	vec4 pos = vec4((localPos.xyz) + aInstancePos, 1.);
+
+	gl_Position = ubo.proj * ubo.view * ubo.model * pos;
+}
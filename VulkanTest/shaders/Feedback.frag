@@ -0,0 +1,21 @@
+#version 450
+#extension GL_GOOGLE_include_directive : require
+
+// Virtual texture feedback: the page every pixel samples, read back by VirtualTexture::processFeedback.
+// Drawn with TestVertex.vert into a target VirtualTexture::FEEDBACK_DIVISOR times smaller than the screen.
+#include "VirtualTexture.glsl"
+
+layout(location = 6) in vec3 vUV;
+
+layout(location = 0) out uint rtPage;
+
+// The derivatives are FEEDBACK_DIVISOR times larger than on screen, -log2 of it brings the level back to what the scene pass picks.
+const float FEEDBACK_LOD_BIAS = -3.;
+
+void main()
+{
+	int level = vtLevel(vUV.xy, FEEDBACK_LOD_BIAS);
+	ivec2 page = ivec2(vtPageCoord(vUV.xy, level));
+
+	rtPage = uint(page.x) | (uint(page.y) << 12) | (uint(level) << 24);
+}
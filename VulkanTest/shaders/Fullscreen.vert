@@ -0,0 +1,11 @@
+#version 450
+
+// Fullscreen triangle for post processing passes. No vertex buffer, the positions come from gl_VertexIndex:
+// one triangle that covers the whole screen is cheaper than a quad (no diagonal seam with 2x2 quad shading waste).
+layout(location = 0) out vec2 vTexCoord;
+
+void main()
+{
+	vTexCoord = vec2((gl_VertexIndex << 1) & 2, gl_VertexIndex & 2);
+	gl_Position = vec4(vTexCoord * 2.0 - 1.0, 0.0, 1.0);
+}
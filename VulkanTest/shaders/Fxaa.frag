@@ -0,0 +1,143 @@
+#version 450
+
+// FXAA, after Timothy Lottes' FXAA 3.11 (PC quality preset, trimmed down).
+// Finds edges from luma contrast, walks along the edge to find its ends, and blends across it.
+// A fraction of the cost of MSAA with sample shading, at the price of some blur on fine texture detail.
+layout(set = 0, binding = 0) uniform sampler2D sceneColor;
+
+layout(location = 0) in vec2 vTexCoord;
+
+layout(location = 0) out vec4 outColor;
+
+const float EDGE_THRESHOLD = 0.125; // Minimum local contrast to be considered an edge.
+const float EDGE_THRESHOLD_MIN = 0.0312; // Skips dark areas, where the noise would be processed otherwise.
+const float SUBPIX_QUALITY = 0.75; // Amount of sub-pixel aliasing removal.
+const int SEARCH_STEPS = 8;
+const float SEARCH_STEP_SIZES[SEARCH_STEPS] = float[](1.0, 1.0, 1.0, 1.5, 2.0, 2.0, 4.0, 8.0);
+
+float luma(vec3 color)
+{
+	return sqrt(dot(color, vec3(0.299, 0.587, 0.114)));
+}
+
+float lumaAt(vec2 uv)
+{
+	return luma(textureLod(sceneColor, uv, 0.0).rgb);
+}
+
+void main()
+{
+	vec2 texel = 1.0 / vec2(textureSize(sceneColor, 0));
+	vec3 colorCenter = textureLod(sceneColor, vTexCoord, 0.0).rgb;
+
+	float lumaCenter = luma(colorCenter);
+	float lumaDown = luma(textureLodOffset(sceneColor, vTexCoord, 0.0, ivec2(0, 1)).rgb);
+	float lumaUp = luma(textureLodOffset(sceneColor, vTexCoord, 0.0, ivec2(0, -1)).rgb);
+	float lumaLeft = luma(textureLodOffset(sceneColor, vTexCoord, 0.0, ivec2(-1, 0)).rgb);
+	float lumaRight = luma(textureLodOffset(sceneColor, vTexCoord, 0.0, ivec2(1, 0)).rgb);
+
+	float lumaMin = min(lumaCenter, min(min(lumaDown, lumaUp), min(lumaLeft, lumaRight)));
+	float lumaMax = max(lumaCenter, max(max(lumaDown, lumaUp), max(lumaLeft, lumaRight)));
+	float lumaRange = lumaMax - lumaMin;
+
+	// Not an edge, keep the pixel as it is.
+	if (lumaRange < max(EDGE_THRESHOLD_MIN, lumaMax * EDGE_THRESHOLD))
+	{
+		outColor = vec4(colorCenter, 1.0);
+		return;
+	}
+
+	float lumaDownLeft = luma(textureLodOffset(sceneColor, vTexCoord, 0.0, ivec2(-1, 1)).rgb);
+	float lumaUpRight = luma(textureLodOffset(sceneColor, vTexCoord, 0.0, ivec2(1, -1)).rgb);
+	float lumaUpLeft = luma(textureLodOffset(sceneColor, vTexCoord, 0.0, ivec2(-1, -1)).rgb);
+	float lumaDownRight = luma(textureLodOffset(sceneColor, vTexCoord, 0.0, ivec2(1, 1)).rgb);
+
+	float lumaDownUp = lumaDown + lumaUp;
+	float lumaLeftRight = lumaLeft + lumaRight;
+	float lumaLeftCorners = lumaDownLeft + lumaUpLeft;
+	float lumaDownCorners = lumaDownLeft + lumaDownRight;
+	float lumaRightCorners = lumaDownRight + lumaUpRight;
+	float lumaUpCorners = lumaUpRight + lumaUpLeft;
+
+	// Is the edge horizontal or vertical?
+	float edgeHorizontal = abs(-2.0 * lumaLeft + lumaLeftCorners) + abs(-2.0 * lumaCenter + lumaDownUp) * 2.0 + abs(-2.0 * lumaRight + lumaRightCorners);
+	float edgeVertical = abs(-2.0 * lumaUp + lumaUpCorners) + abs(-2.0 * lumaCenter + lumaLeftRight) * 2.0 + abs(-2.0 * lumaDown + lumaDownCorners);
+	bool isHorizontal = edgeHorizontal >= edgeVertical;
+
+	// Which side of the pixel the edge is on.
+	float luma1 = isHorizontal ? lumaUp : lumaLeft;
+	float luma2 = isHorizontal ? lumaDown : lumaRight;
+	float gradient1 = luma1 - lumaCenter;
+	float gradient2 = luma2 - lumaCenter;
+	bool is1Steepest = abs(gradient1) >= abs(gradient2);
+	float gradientScaled = 0.25 * max(abs(gradient1), abs(gradient2));
+
+	float stepLength = isHorizontal ? texel.y : texel.x;
+	float lumaLocalAverage;
+	if (is1Steepest)
+	{
+		stepLength = -stepLength;
+		lumaLocalAverage = 0.5 * (luma1 + lumaCenter);
+	}
+	else
+		lumaLocalAverage = 0.5 * (luma2 + lumaCenter);
+
+	// Move half a pixel onto the edge.
+	vec2 uvEdge = vTexCoord;
+	if (isHorizontal)
+		uvEdge.y += stepLength * 0.5;
+	else
+		uvEdge.x += stepLength * 0.5;
+
+	// Walk both ways along the edge until the luma difference says we left it.
+	vec2 offset = isHorizontal ? vec2(texel.x, 0.0) : vec2(0.0, texel.y);
+	vec2 uv1 = uvEdge - offset * SEARCH_STEP_SIZES[0];
+	vec2 uv2 = uvEdge + offset * SEARCH_STEP_SIZES[0];
+	float lumaEnd1 = lumaAt(uv1) - lumaLocalAverage;
+	float lumaEnd2 = lumaAt(uv2) - lumaLocalAverage;
+	bool reached1 = abs(lumaEnd1) >= gradientScaled;
+	bool reached2 = abs(lumaEnd2) >= gradientScaled;
+
+	for (int i = 1; i < SEARCH_STEPS && !(reached1 && reached2); ++i)
+	{
+		if (!reached1)
+		{
+			uv1 -= offset * SEARCH_STEP_SIZES[i];
+			lumaEnd1 = lumaAt(uv1) - lumaLocalAverage;
+			reached1 = abs(lumaEnd1) >= gradientScaled;
+		}
+		if (!reached2)
+		{
+			uv2 += offset * SEARCH_STEP_SIZES[i];
+			lumaEnd2 = lumaAt(uv2) - lumaLocalAverage;
+			reached2 = abs(lumaEnd2) >= gradientScaled;
+		}
+	}
+
+	float distance1 = isHorizontal ? (vTexCoord.x - uv1.x) : (vTexCoord.y - uv1.y);
+	float distance2 = isHorizontal ? (uv2.x - vTexCoord.x) : (uv2.y - vTexCoord.y);
+	bool isDirection1 = distance1 < distance2;
+	float distanceFinal = min(distance1, distance2);
+	float edgeThickness = distance1 + distance2;
+
+	// Only blend if the closer end of the edge varies the same way the center does.
+	bool isLumaCenterSmaller = lumaCenter < lumaLocalAverage;
+	bool correctVariation = ((isDirection1 ? lumaEnd1 : lumaEnd2) < 0.0) != isLumaCenterSmaller;
+	float pixelOffset = correctVariation ? (-distanceFinal / edgeThickness + 0.5) : 0.0;
+
+	// Sub-pixel aliasing: thin features that the edge walk doesn't catch.
+	float lumaAverage = (1.0 / 12.0) * (2.0 * (lumaDownUp + lumaLeftRight) + lumaLeftCorners + lumaRightCorners);
+	float subPixelOffset1 = clamp(abs(lumaAverage - lumaCenter) / lumaRange, 0.0, 1.0);
+	float subPixelOffset2 = (-2.0 * subPixelOffset1 + 3.0) * subPixelOffset1 * subPixelOffset1;
+	float subPixelOffset = subPixelOffset2 * subPixelOffset2 * SUBPIX_QUALITY;
+
+	pixelOffset = max(pixelOffset, subPixelOffset);
+
+	vec2 uvFinal = vTexCoord;
+	if (isHorizontal)
+		uvFinal.y += pixelOffset * stepLength;
+	else
+		uvFinal.x += pixelOffset * stepLength;
+
+	outColor = vec4(textureLod(sceneColor, uvFinal, 0.0).rgb, 1.0);
+}
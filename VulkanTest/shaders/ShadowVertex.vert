@@ -0,0 +1,65 @@
+#version 450
+
+// Depth only vertex shader for the point light shadow map.
+// Same UBO as TestVertex.vert, but only the shadow face matrices are used.
+layout (set = 0, binding = 0) uniform UniformBufferObject
+{
+	mat4 model;
+	mat4 view;
+	mat4 proj;
+
+	vec4 uLightPos;
+	vec4 uLightCol;
+
+	mat4 uShadowViewProj[6];
+	vec4 uShadowParams;
+} ubo;
+
+// Which cube face we're rendering into.
+layout (push_constant) uniform ShadowPush
+{
+	uint face;
+} push;
+
+// Attributes. Only the position is needed for depth.
+layout (location = 0) in vec3 inPosition;
+
+//instance attributes
+layout(location = 4) in vec3 aInstancePos;
+layout(location = 5) in vec3 aInstanceRot;
+
+void main()
+{
+	// Same rotation as TestVertex.vert, so the shadow matches what we draw.
+	mat3 mx, my, mz;
+	// rotate around x
+	float s = sin(aInstanceRot.x);
+	float c = cos(aInstanceRot.x);
+
+	mx[0] = vec3(c, s, .0);
+	mx[1] = vec3(-s, c, .0);
+	mx[2] = vec3(.0, .0, 1.0);
+
+	// rotate around y
+	s = sin(aInstanceRot.y);
+	c = cos(aInstanceRot.y);
+
+	my[0] = vec3(c, 0.0, s);
+	my[1] = vec3(0.0, 1.0, 0.0);
+	my[2] = vec3(-s, 0.0, c);
+	
+	// rotate around z
+	s = sin(aInstanceRot.z);
+	c = cos(aInstanceRot.z);	
+	
+	mz[0] = vec3(1.0, 0.0, 0.0);
+	mz[1] = vec3(0.0, c, s);
+	mz[2] = vec3(0.0, -s, c);
+	
+	mat3 rotMat = mz * my * mx;
+
+	vec3 pos = inPosition.xyz * rotMat + aInstancePos;
+
+	// The light lives in the same (model) space as the instances, so no model matrix here.
+	gl_Position = ubo.uShadowViewProj[push.face] * vec4(pos, 1.);
+}
@@ -2,6 +2,12 @@
 #version 450
 #extension GL_ARB_separate_shader_objects : enable
 
+// Built a second time with -DVIRTUAL_TEXTURE (frag_vt.spv), which takes the diffuse color from the virtual texture instead of texSampler.
+#ifdef VIRTUAL_TEXTURE
+#extension GL_GOOGLE_include_directive : require
+#include "VirtualTexture.glsl"
+#endif
+
 layout(location = 0) in vec3 fragColor;
 layout(location = 1) in vec2 fragTexCoord;
 layout(location = 2) in vec4 lightPos;
@@ -10,11 +16,58 @@ layout(location = 4) in vec3 vNormal;
 layout(location = 5) in vec3 vPosition;
 layout(location = 6) in vec3 vUV;
 layout(location = 7) in vec4 debug;
+layout(location = 8) in vec3 vShadowVec;
+
+layout (set = 0, binding = 0) uniform UniformBufferObject
+{
+	mat4 model;
+	mat4 view;
+	mat4 proj;
+
+	vec4 uLightPos;
+	vec4 uLightCol;
+
+	mat4 uShadowViewProj[6];
+	vec4 uShadowParams; // near, far, PCF radius, depth bias
+} ubo;
 
 
 
 layout(location = 0) out vec4 rtFragColor;
 layout(binding = 1) uniform sampler2D texSampler;
+layout(binding = 2) uniform samplerCubeShadow shadowMap;
+
+// PCF taps, the corners of a cube around the lookup direction.
+// Each tap is already a 2x2 bilinear comparison thanks to the comparison sampler.
+const vec3 pcfOffsets[8] = vec3[]
+(
+	vec3(1., 1., 1.), vec3(1., -1., 1.), vec3(-1., -1., 1.), vec3(-1., 1., 1.),
+	vec3(1., 1., -1.), vec3(1., -1., -1.), vec3(-1., -1., -1.), vec3(-1., 1., -1.)
+);
+
+// 1 when lit, 0 when in shadow, something in between at the edges.
+float shadowCalc()
+{
+	float n = ubo.uShadowParams.x;
+	float f = ubo.uShadowParams.y;
+
+	/*
+	Each cube face is rendered with a 90 degree perspective looking down one axis,
+	so the depth stored for this fragment is the projected distance along the major axis, not the euclidian distance.
+	*/
+	vec3 v = vShadowVec;
+	float axisDist = max(abs(v.x), max(abs(v.y), abs(v.z)));
+	float depth = (f / (f - n)) - (f * n) / ((f - n) * axisDist) - ubo.uShadowParams.w;
+
+	// Scale the filter with distance so the penumbra is about the same number of texels everywhere.
+	float radius = ubo.uShadowParams.z * axisDist;
+
+	float lit = 0.;
+	for (int i = 0; i < 8; ++i)
+		lit += texture(shadowMap, vec4(v + pcfOffsets[i] * radius, depth));
+
+	return lit / 8.;
+}
 
 vec4 phongCalc()
 {
@@ -34,7 +87,8 @@ vec4 phongCalc()
 
 	vec4 ambient = vec4(.01, .01, .01, .01);
 
-	vec4 total = ambient + vec4((diffuse + specular), diffuse);
+	// Only the direct light gets shadowed.
+	vec4 total = ambient + vec4((diffuse + specular), diffuse) * shadowCalc();
 
 	return total;
 	//return vec4(diffuse, 1.);
@@ -50,7 +104,11 @@ void main()
 	//rtFragColor = texture(texSampler, fragTexCoord);
 	//rtFragColor = vec4(fragTexCoord, 0.0, 1.f);
 	//rtFragColor = vec4(vPosition, 1.);
+#ifdef VIRTUAL_TEXTURE
+	rtFragColor = phongCalc() * vtSample(vUV.xy);
+#else
 	rtFragColor = phongCalc() * texture(texSampler, vUV.xy);
+#endif
 	//rtFragColor = lightPos;
 	//rtFragColor = vec4(1., 0, 0, 1.);
 	//rtFragColor = texture(texSampler, vUV.xy);
@@ -10,6 +10,9 @@ layout (set = 0, binding = 0) uniform UniformBufferObject
 
 	vec4 uLightPos;
 	vec4 uLightCol;
+
+	mat4 uShadowViewProj[6];
+	vec4 uShadowParams; // near, far, PCF radius, depth bias
 } ubo;
 
 // Attributes
@@ -34,6 +37,10 @@ layout(location = 5) out vec3 vPosition;
 layout(location = 6) out vec3 vUV;
 
 layout(location = 7) out vec4 debug;
+layout(location = 8) out vec3 vShadowVec; // light -> vertex, in the space the shadow map was rendered in
+
+// The depth pre-pass (DepthVertex.vert) computes gl_Position the same way, and the results have to match exactly.
+invariant gl_Position;
 
 void main()
 {
@@ -71,6 +78,7 @@ void main()
 
 	vec4 localPos = vec4(inPosition.xyz * rotMat, 1.);
 	vec4 pos = vec4((localPos.xyz) + aInstancePos, 1.);
+	vShadowVec = pos.xyz - ubo.uLightPos.xyz;
 
 	gl_Position = ubo.proj * ubo.view * ubo.model * pos;
 	fragColor = inColor;
@@ -0,0 +1,38 @@
+// Virtual texture lookups (see VirtualTexture.h), included by TestFrag.frag built with VIRTUAL_TEXTURE and by Feedback.frag.
+// The constants have to match VirtualTexture::PAGE_SIZE and PAGE_BORDER.
+const float VT_PAGE_SIZE = 128.;
+const float VT_PAGE_BORDER = 4.;
+
+// Physical pages, every slot is PAGE_SIZE texels plus a border on each side.
+layout(binding = 3) uniform sampler2D vtCache;
+// One texel per page and a mip per level: the cache slot (x, y) and the level of the page that's resident in its place.
+layout(binding = 4) uniform usampler2D vtIndirection;
+
+// The level of the virtual texture a lookup at uv needs, from the screen space derivatives.
+int vtLevel(vec2 uv, float lodBias)
+{
+	vec2 texels = uv * vec2(textureSize(vtIndirection, 0)) * VT_PAGE_SIZE;
+	vec2 dx = dFdx(texels);
+	vec2 dy = dFdy(texels);
+	float lod = .5 * log2(max(dot(dx, dx), dot(dy, dy))) + lodBias;
+	return int(clamp(lod, 0., float(textureQueryLevels(vtIndirection) - 1)));
+}
+
+// The page of the level the texture repeats with, like the REPEAT sampler it used to be drawn with.
+vec2 vtPageCoord(vec2 uv, int level)
+{
+	return fract(uv) * vec2(textureSize(vtIndirection, level));
+}
+
+vec4 vtSample(vec2 uv)
+{
+	int level = vtLevel(uv, 0.);
+	vec2 pageCoord = vtPageCoord(uv, level);
+	uvec4 entry = texelFetch(vtIndirection, ivec2(pageCoord), level);
+
+	// While the page isn't resident the entry is one of its ancestors', which covers 2^(entry level - level) pages per side.
+	vec2 inPage = fract(pageCoord * exp2(float(level) - float(entry.z)));
+	vec2 texel = vec2(entry.xy) * (VT_PAGE_SIZE + 2. * VT_PAGE_BORDER) + VT_PAGE_BORDER + inPage * VT_PAGE_SIZE;
+
+	return textureLod(vtCache, texel / vec2(textureSize(vtCache, 0)), 0.);
+}
@@ -1,3 +1,10 @@
 C:/VulkanSDK/1.1.101.0/Bin32/glslangValidator.exe -V TestVertex.vert
 C:/VulkanSDK/1.1.101.0/Bin32/glslangValidator.exe -V TestFrag.frag
+C:/VulkanSDK/1.1.101.0/Bin32/glslangValidator.exe -V -DVIRTUAL_TEXTURE TestFrag.frag -o frag_vt.spv
+C:/VulkanSDK/1.1.101.0/Bin32/glslangValidator.exe -V ShadowVertex.vert -o shadow_vert.spv
+C:/VulkanSDK/1.1.101.0/Bin32/glslangValidator.exe -V DepthVertex.vert -o depth_vert.spv
+C:/VulkanSDK/1.1.101.0/Bin32/glslangValidator.exe -V Fullscreen.vert -o fullscreen_vert.spv
+C:/VulkanSDK/1.1.101.0/Bin32/glslangValidator.exe -V Fxaa.frag -o fxaa_frag.spv
+C:/VulkanSDK/1.1.101.0/Bin32/glslangValidator.exe -V ClusterCull.comp -o cluster_cull_comp.spv
+C:/VulkanSDK/1.1.101.0/Bin32/glslangValidator.exe -V Feedback.frag -o feedback_frag.spv
 pause